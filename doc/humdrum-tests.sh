@@ -0,0 +1,27 @@
+#!/bin/bash
+
+# Convert the Humdrum (and MusicXML through Humdrum) files of ./tests/humdrum/ to MEI and compare it with the expected
+# one next to them, which was written by the version importing the Humdrum data through an MEI round-trip
+# The generated ids, the date and the version of the output are ignored since they change from one conversion to another
+
+dir="./tests/humdrum"
+failed=0
+
+for k in `\ls $dir/*.krn $dir/*.musicxml`; do
+    expected=${k%.*}.mei
+    format=humdrum
+    if [ "${k##*.}" == "musicxml" ]; then
+        format=musicxml-hum
+    fi
+    ../tools/verovio -r ../data/ -f $format -t mei -a -o humdrum-tests.tmp.mei $k > /dev/null 2>&1
+    normalize='s/-[0-9]{16}/-/g; s/<application isodate="[^"]*" version="[^"]*"/<application/'
+    if sed -E "$normalize" $expected | diff -q - <(sed -E "$normalize" humdrum-tests.tmp.mei) > /dev/null; then
+        echo "$k: ok"
+    else
+        echo "$k: FAILED"
+        failed=1
+    fi
+done
+
+rm -f humdrum-tests.tmp.mei
+exit $failed
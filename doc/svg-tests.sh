@@ -0,0 +1,33 @@
+#!/bin/bash
+
+# Render the MEI files of ./tests/svg/ and compare the SVG with the expected one next to them
+# The generated ids are ignored since they depend on the random number generator
+
+dir="./tests/svg"
+failed=0
+
+for k in `\ls $dir/*.mei`; do
+    expected=${k%.mei}.svg
+    ../tools/verovio -r ../data/ --page-width 1000 --adjust-page-height -x 1 -o - $k 2> /dev/null \
+        | sed -E 's/-[0-9]{8,}"/"/g' > svg-tests.tmp
+    if sed -E 's/-[0-9]{8,}"/"/g' $expected | diff -q - svg-tests.tmp > /dev/null; then
+        echo "$k: ok"
+    else
+        echo "$k: FAILED"
+        failed=1
+    fi
+done
+
+rm -f svg-tests.tmp
+
+# Check the incremental cast off against a full one after an edit, when the benchmark tool is built
+# It is run on the test files and on a generated lead sheet, which spans several pages
+if [ -x ../tools/benchmark ]; then
+    ../tools/benchmark lead-sheet 200 > cast-off-tests.tmp.mei
+    if ! ../tools/benchmark incremental-cast-off -r ../data/ $dir/*.mei cast-off-tests.tmp.mei; then
+        failed=1
+    fi
+    rm -f cast-off-tests.tmp.mei
+fi
+
+exit $failed
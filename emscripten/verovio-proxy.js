@@ -24,6 +24,9 @@ verovio.vrvToolkit.getElementAttr = Module.cwrap('vrvToolkit_getElementAttr', 's
 // char *getElementsAtTime(Toolkit *ic, int time)
 verovio.vrvToolkit.getElementsAtTime = Module.cwrap('vrvToolkit_getElementsAtTime', 'string', ['number', 'number']);
 
+// char *getElementsAtTimes(Toolkit *ic, int startTime, int endTime, int step)
+verovio.vrvToolkit.getElementsAtTimes = Module.cwrap('vrvToolkit_getElementsAtTimes', 'string', ['number', 'number', 'number', 'number']);
+
 // char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId);
 verovio.vrvToolkit.getExpansionIdsForElement = Module.cwrap('vrvToolkit_getExpansionIdsForElement', 'string', ['number', 'string']);
 
@@ -48,6 +51,9 @@ verovio.vrvToolkit.getPageCount = Module.cwrap('vrvToolkit_getPageCount', 'numbe
 // int getPageWithElement(Toolkit *ic, const char *xmlId)
 verovio.vrvToolkit.getPageWithElement = Module.cwrap('vrvToolkit_getPageWithElement', 'number', ['number', 'string']);
 
+// char *getProfile(Toolkit *ic)
+verovio.vrvToolkit.getProfile = Module.cwrap('vrvToolkit_getProfile', 'string', ['number']);
+
 // double getTimeForElement(Toolkit *ic, const char *xmlId)
 verovio.vrvToolkit.getTimeForElement = Module.cwrap('vrvToolkit_getTimeForElement', 'number', ['number', 'string']);
 
@@ -63,6 +69,9 @@ verovio.vrvToolkit.loadData = Module.cwrap('vrvToolkit_loadData', 'number', ['nu
 // void redoLayout(Toolkit *ic)
 verovio.vrvToolkit.redoLayout = Module.cwrap('vrvToolkit_redoLayout', null, ['number']);
 
+// void redoLayoutIncremental(Toolkit *ic)
+verovio.vrvToolkit.redoLayoutIncremental = Module.cwrap('vrvToolkit_redoLayoutIncremental', null, ['number']);
+
 // void redoPagePitchPosLayout(Toolkit *ic)
 verovio.vrvToolkit.redoPagePitchPosLayout = Module.cwrap('vrvToolkit_redoPagePitchPosLayout', null, ['number']);
 
@@ -78,6 +87,9 @@ verovio.vrvToolkit.renderToSVG = Module.cwrap('vrvToolkit_renderToSVG', 'string'
 // char *renderToTimemap(Toolkit *ic)
 verovio.vrvToolkit.renderToTimemap = Module.cwrap('vrvToolkit_renderToTimemap', 'string', ['number']);
 
+// void resetProfile(Toolkit *ic)
+verovio.vrvToolkit.resetProfile = Module.cwrap('vrvToolkit_resetProfile', null, ['number']);
+
 // void setOptions(Toolkit *ic, const char *options) 
 verovio.vrvToolkit.setOptions = Module.cwrap('vrvToolkit_setOptions', null, ['number', 'string']);
 
@@ -118,6 +130,10 @@ verovio.toolkit.prototype.getElementsAtTime = function (millisec) {
 	return JSON.parse(verovio.vrvToolkit.getElementsAtTime(this.ptr, millisec));
 };
 
+verovio.toolkit.prototype.getElementsAtTimes = function (startMillisec, endMillisec, stepMillisec) {
+	return JSON.parse(verovio.vrvToolkit.getElementsAtTimes(this.ptr, startMillisec, endMillisec, stepMillisec));
+};
+
 verovio.toolkit.prototype.getExpansionIdsForElement = function (xmlId) {
 	return JSON.parse(verovio.vrvToolkit.getExpansionIdsForElement(this.ptr, xmlId));
 };
@@ -154,6 +170,10 @@ verovio.toolkit.prototype.getPageWithElement = function (xmlId) {
 	return verovio.vrvToolkit.getPageWithElement(this.ptr, xmlId);
 };
 
+verovio.toolkit.prototype.getProfile = function () {
+	return JSON.parse(verovio.vrvToolkit.getProfile(this.ptr));
+};
+
 verovio.toolkit.prototype.getTimeForElement = function (xmlId) {
 	return verovio.vrvToolkit.getTimeForElement(this.ptr, xmlId);
 };
@@ -170,6 +190,10 @@ verovio.toolkit.prototype.redoLayout = function () {
 	verovio.vrvToolkit.redoLayout(this.ptr);
 }
 
+verovio.toolkit.prototype.redoLayoutIncremental = function () {
+	verovio.vrvToolkit.redoLayoutIncremental(this.ptr);
+}
+
 verovio.toolkit.prototype.redoPagePitchPosLayout = function () {
 	verovio.vrvToolkit.redoPagePitchPosLayout(this.ptr);
 }
@@ -200,6 +224,10 @@ verovio.toolkit.prototype.renderToTimemap = function () {
 	return JSON.parse(verovio.vrvToolkit.renderToTimemap(this.ptr));
 };
 
+verovio.toolkit.prototype.resetProfile = function () {
+	verovio.vrvToolkit.resetProfile(this.ptr);
+};
+
 verovio.toolkit.prototype.setOptions = function (options) {
 	verovio.vrvToolkit.setOptions(this.ptr, JSON.stringify(options));
 };
@@ -8,7 +8,11 @@
 #ifndef __VRV_ATT_H__
 #define __VRV_ATT_H__
 
+#include <algorithm>
+#include <map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
@@ -34,7 +38,7 @@ public:
     /** @name Constructors and destructor */
     ///@{
     Att();
-    virtual ~Att();
+    ~Att();
     ///@}
 
     /**
@@ -126,7 +130,7 @@ public:
     data_BEATRPT_REND StrToBeatrptRend(std::string value, bool logWarning = true) const;
 
     std::string DurationToStr(data_DURATION data) const;
-    data_DURATION StrToDuration(std::string value, bool logWarning = true) const;
+    data_DURATION StrToDuration(std::string_view value, bool logWarning = true) const;
 
     std::string FontsizenumericToStr(data_FONTSIZENUMERIC data) const;
     data_FONTSIZENUMERIC StrToFontsizenumeric(std::string value, bool logWarning = true) const;
@@ -192,7 +196,7 @@ public:
     data_PERCENT_LIMITED_SIGNED StrToPercentLimitedSigned(std::string value, bool logWarning = true) const;
 
     std::string PitchnameToStr(data_PITCHNAME data) const;
-    data_PITCHNAME StrToPitchname(std::string value, bool logWarning = true) const;
+    data_PITCHNAME StrToPitchname(std::string_view value, bool logWarning = true) const;
 
     std::string ProlatioToStr(data_PROLATIO data) const;
     data_PROLATIO StrToProlatio(std::string value, bool logWarning = true) const;
@@ -236,6 +240,52 @@ public:
 // Interface
 //----------------------------------------------------------------------------
 
+//----------------------------------------------------------------------------
+// AttClassTable
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds the MEI att classes and the interfaces registered by an object or by an interface.
+ * Tables are immutable and shared by all the objects registering the same classes in the same order, that is by all
+ * the objects of a class. Each registration moves the object to the table extended with the registered class.
+ * Tables are created on first use and never deleted.
+ */
+class AttClassTable {
+public:
+    /** The table of an object without any registered class */
+    static const AttClassTable *GetEmpty();
+
+    /**
+     * @name Return the table extended with an att class or with an interface and its att classes
+     */
+    ///@{
+    const AttClassTable *WithAttClass(AttClassId attClassId) const;
+    const AttClassTable *WithInterface(const std::vector<AttClassId> *attClasses, InterfaceId interfaceId) const;
+    ///@}
+
+    bool HasAttClass(AttClassId attClassId) const
+    {
+        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
+    }
+    bool HasInterface(InterfaceId interfaceId) const
+    {
+        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
+    }
+
+    const std::vector<AttClassId> *GetAttClasses() const { return &m_attClasses; }
+
+private:
+    AttClassTable() {}
+
+    const AttClassTable *GetNext(int key, const std::vector<AttClassId> *attClasses, InterfaceId interfaceId) const;
+
+private:
+    std::vector<AttClassId> m_attClasses;
+    std::vector<InterfaceId> m_interfaces;
+    /** The extended tables, with att classes as positive keys and interfaces as negative keys */
+    mutable std::map<int, const AttClassTable *> m_next;
+};
+
 /**
  * This is a base class for regrouping MEI att classes.
  * It is not an abstract class but it should not be instanciated directly.
@@ -251,19 +301,22 @@ public:
      * Reset method reset all attribute classes
      */
     ///@{
-    Interface(){};
+    Interface() : m_interfaceAttClasses(AttClassTable::GetEmpty()){};
     virtual ~Interface(){};
     ///@}
 
     /**
      * Method for registering an MEI att classes in the interface.
      */
-    void RegisterInterfaceAttClass(AttClassId attClassId) { m_interfaceAttClasses.push_back(attClassId); }
+    void RegisterInterfaceAttClass(AttClassId attClassId)
+    {
+        m_interfaceAttClasses = m_interfaceAttClasses->WithAttClass(attClassId);
+    }
 
     /**
      * Method for obtaining a pointer to the attribute class vector of the interface
      */
-    std::vector<AttClassId> *GetAttClasses() { return &m_interfaceAttClasses; }
+    const std::vector<AttClassId> *GetAttClasses() const { return m_interfaceAttClasses->GetAttClasses(); }
 
     /**
      * Virtual method returning the InterfaceId of the interface.
@@ -273,9 +326,9 @@ public:
 
 private:
     /**
-     * A vector for storing all the MEI att classes grouped in the interface
+     * The table of the MEI att classes grouped in the interface (shared by all the instances of the interface)
      */
-    std::vector<AttClassId> m_interfaceAttClasses;
+    const AttClassTable *m_interfaceAttClasses;
 };
 
 } // namespace vrv
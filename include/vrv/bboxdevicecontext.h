@@ -143,6 +143,11 @@ public:
     bool UpdateHorizontalValues() { return (m_update != BBOX_VERTICAL_ONLY); }
     bool UpdateVerticalValues() { return (m_update != BBOX_HORIZONTAL_ONLY); }
 
+    /**
+     * Return the number of graphics (objects) started, i.e., of bounding boxes filled
+     */
+    int GetGraphicCount() const { return m_graphicCount; }
+
     /**
      * @name Method for adding description element
      */
@@ -193,6 +198,11 @@ private:
      */
     std::vector<Object *> m_objects;
 
+    /**
+     * The number of graphics started
+     */
+    int m_graphicCount;
+
     /**
      * The view are calling from - used to flip back the Y coordinates
      */
@@ -222,14 +222,14 @@ private:
      * Calculate the rectangles with 2 anchor points.
      * Return false (and one single rectangle) when anchor points are out of the boundaries.
      */
-    bool GetGlyph2PointRectangles(const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2, Glyph *glyph1,
+    bool GetGlyph2PointRectangles(const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2, const Glyph *glyph1,
         Point rect[3][2], Doc *doc) const;
 
     /**
      * Calculate the rectangles with 1 anchor point.
      * Return false (and one single rectangle) when anchor points are out of the boundaries.
      */
-    bool GetGlyph1PointRectangles(const SMuFLGlyphAnchor &anchor, Glyph *glyph, Point rect[2][2], Doc *doc) const;
+    bool GetGlyph1PointRectangles(const SMuFLGlyphAnchor &anchor, const Glyph *glyph, Point rect[2][2], Doc *doc) const;
 
 public:
     //
@@ -264,6 +264,65 @@ private:
     int m_smuflGlyphFontSize;
 };
 
+//----------------------------------------------------------------------------
+// BezierCurve
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds a cubic bezier curve prepared for being evaluated at many positions.
+ * The position on the curve is linear in x, as with BoundingBox::CalcBezierAtPosition, and the
+ * values are the same.
+ */
+class BezierCurve {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    BezierCurve();
+    BezierCurve(const Point bezier[4]);
+    virtual ~BezierCurve(){};
+    void SetPoints(const Point bezier[4]);
+    ///@}
+
+    /**
+     * Calculate the y position of the curve at position x
+     */
+    int CalcYAtPosition(int x) const;
+
+    /**
+     * Calculate the y positions of the curve for an array of x positions.
+     * The loop has no data dependent branch and can be vectorized by the compiler.
+     */
+    void CalcYAtPositions(const int *x, int *y, int count) const;
+
+    /**
+     * Calculate the point of the curve for a t between 0.0 and 1.0
+     */
+    Point CalcPointAt(double t) const;
+
+private:
+    //
+public:
+    //
+private:
+    /**
+     * The x of the start point and the width (0.0 for a vertical curve) for calculating t from x
+     */
+    ///@{
+    int m_x0;
+    double m_width;
+    ///@}
+
+    /**
+     * The coordinates of the points
+     */
+    ///@{
+    double m_x[4];
+    double m_y[4];
+    ///@}
+};
+
 //----------------------------------------------------------------------------
 // SegmentedLine
 //----------------------------------------------------------------------------
@@ -321,6 +380,78 @@ private:
     ArrayOfIntPairs m_segments;
 };
 
+//----------------------------------------------------------------------------
+// HorizontalBBoxIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores bounding boxes in insertion order together with an index of their horizontal position.
+ * Boxes are registered in fixed-width buckets along the x axis, which avoids checking all the boxes when
+ * looking for the ones that overlap horizontally with another one.
+ * The boxes are expected not to move horizontally once added.
+ */
+class HorizontalBBoxIndex {
+public:
+    /**
+     * @name Constructors, destructors, reset methods
+     */
+    ///@{
+    HorizontalBBoxIndex() {}
+    virtual ~HorizontalBBoxIndex(){};
+    void Reset();
+    ///@}
+
+    /**
+     * Add a bounding box to the index
+     */
+    void Add(BoundingBox *box);
+
+    /**
+     * Return all the boxes in insertion order
+     */
+    const ArrayOfBoundingBoxes &GetBoxes() const { return m_boxes; }
+
+    /**
+     * Fill the array with the boxes that box overlaps horizontally (see BoundingBox::HorizontalContentOverlap).
+     * The boxes are given in insertion order, as if all of them were checked one by one.
+     */
+    void FindHorizontalContentOverlaps(const BoundingBox *box, ArrayOfBoundingBoxes &overlaps) const;
+
+private:
+    /**
+     * Return the bucket for a x position
+     */
+    static int GetBucket(int x);
+
+public:
+    //
+private:
+    /**
+     * The boxes in insertion order
+     */
+    ArrayOfBoundingBoxes m_boxes;
+
+    /**
+     * The first bucket of each box in m_boxes
+     */
+    std::vector<int> m_firstBuckets;
+
+    /**
+     * The positions in m_boxes of the boxes in each bucket
+     */
+    std::map<int, std::vector<int> > m_buckets;
+
+    /**
+     * The positions of the boxes without horizontal content bounding box when added
+     */
+    std::vector<int> m_unindexed;
+
+    /**
+     * The width of the buckets (as a shift)
+     */
+    static const int s_bucketShift;
+};
+
 } // namespace vrv
 
 #endif
@@ -8,6 +8,10 @@
 #ifndef __VRV_COMPARISON_H__
 #define __VRV_COMPARISON_H__
 
+#include <set>
+
+//----------------------------------------------------------------------------
+
 #include "artic.h"
 #include "atts_shared.h"
 #include "durationinterface.h"
@@ -154,6 +158,27 @@ public:
     bool MatchesType(Object *object) { return true; }
 };
 
+//----------------------------------------------------------------------------
+// IsLayerElementComparison
+//----------------------------------------------------------------------------
+
+/**
+ * This class evaluates if the object is a layer element.
+ */
+class IsLayerElementComparison : public Comparison {
+
+public:
+    IsLayerElementComparison() : Comparison() {}
+
+    virtual bool operator()(Object *object)
+    {
+        if (object->IsLayerElement()) return true;
+        return false;
+    }
+
+    bool MatchesType(Object *object) { return true; }
+};
+
 //----------------------------------------------------------------------------
 // IsEmptyComparison
 //----------------------------------------------------------------------------
@@ -221,7 +246,7 @@ public:
         if (!MatchesType(object)) return false;
         // This should not happen, but just in case
         if (!object->HasAttClass(ATT_NINTEGER)) return false;
-        AttNInteger *element = dynamic_cast<AttNInteger *>(object);
+        AttNInteger *element = vrv_cross_cast<AttNInteger *>(object);
         assert(element);
         return (element->GetN() == m_n);
     }
@@ -249,7 +274,7 @@ public:
         if (!MatchesType(object)) return false;
         // This should not happen, but just in case
         if (!object->HasAttClass(ATT_NINTEGER)) return false;
-        AttNInteger *element = dynamic_cast<AttNInteger *>(object);
+        AttNInteger *element = vrv_cross_cast<AttNInteger *>(object);
         assert(element);
         return (std::find(m_ns.begin(), m_ns.end(), element->GetN()) != m_ns.end());
     }
@@ -277,7 +302,7 @@ public:
         if (!MatchesType(object)) return false;
         // This should not happen, but just in case
         if (!object->HasAttClass(ATT_NNUMBERLIKE)) return false;
-        AttNNumberLike *element = dynamic_cast<AttNNumberLike *>(object);
+        AttNNumberLike *element = vrv_cross_cast<AttNNumberLike *>(object);
         assert(element);
         return (element->GetN() == m_n);
     }
@@ -310,7 +335,7 @@ public:
     virtual bool operator()(Object *object)
     {
         if (!object->HasInterface(INTERFACE_DURATION)) return false;
-        DurationInterface *interface = dynamic_cast<DurationInterface *>(object);
+        DurationInterface *interface = vrv_cross_cast<DurationInterface *>(object);
         assert(interface);
         if (interface->HasDur()) {
             if ((m_extremeType == LONGEST) && (interface->GetActualDur() < m_extremeDur)) {
@@ -347,7 +372,7 @@ public:
     virtual bool operator()(Object *object)
     {
         if (!MatchesType(object)) return false;
-        ArticPart *articPart = dynamic_cast<ArticPart *>(object);
+        ArticPart *articPart = vrv_cast<ArticPart *>(object);
         assert(articPart);
         return (articPart->GetType() == m_type);
     }
@@ -373,7 +398,7 @@ public:
     virtual bool operator()(Object *object)
     {
         if (!MatchesType(object)) return false;
-        Alignment *alignment = dynamic_cast<Alignment *>(object);
+        Alignment *alignment = vrv_cast<Alignment *>(object);
         assert(alignment);
         return (alignment->GetType() == m_type);
     }
@@ -382,6 +407,33 @@ private:
     AlignmentType m_type;
 };
 
+//----------------------------------------------------------------------------
+// MeasureExclusionComparison
+//----------------------------------------------------------------------------
+
+/**
+ * This class evaluates if the object is a measure that is not in a set of measures to exclude
+ */
+class MeasureExclusionComparison : public ClassIdComparison {
+
+public:
+    MeasureExclusionComparison(const std::set<Measure *> &excluded) : ClassIdComparison(MEASURE)
+    {
+        m_excluded = excluded;
+    }
+
+    virtual bool operator()(Object *object)
+    {
+        if (!MatchesType(object)) return false;
+        Measure *measure = vrv_cast<Measure *>(object);
+        assert(measure);
+        return (m_excluded.count(measure) == 0);
+    }
+
+private:
+    std::set<Measure *> m_excluded;
+};
+
 //----------------------------------------------------------------------------
 // MeasureOnsetOffsetComparison
 //----------------------------------------------------------------------------
@@ -399,7 +451,7 @@ public:
     virtual bool operator()(Object *object)
     {
         if (!MatchesType(object)) return false;
-        Measure *measure = dynamic_cast<Measure *>(object);
+        Measure *measure = vrv_cast<Measure *>(object);
         assert(measure);
         return (measure->EnclosesTime(m_time) > 0);
     }
@@ -425,7 +477,7 @@ public:
     virtual bool operator()(Object *object)
     {
         if (!MatchesType(object)) return false;
-        Note *note = dynamic_cast<Note *>(object);
+        Note *note = vrv_cast<Note *>(object);
         assert(note);
         return ((m_time >= note->GetRealTimeOnsetMilliseconds()) && (m_time <= note->GetRealTimeOffsetMilliseconds()));
     }
@@ -24,6 +24,7 @@ namespace vrv {
 
 class Glyph;
 class Object;
+class Resources;
 class View;
 class Zone;
 
@@ -67,6 +68,7 @@ public:
         m_height = 0;
         m_userScaleX = 1.0;
         m_userScaleY = 1.0;
+        m_resources = NULL;
     }
     virtual ~DeviceContext(){};
     virtual ClassId GetClassId() const;
@@ -91,6 +93,15 @@ public:
     double GetUserScaleY() { return m_userScaleY; }
     ///@}
 
+    /**
+     * @name Getter and setter for the resources (fonts) used by the device context.
+     * They are set by View::DrawCurrentPage to the ones of the document.
+     */
+    ///@{
+    void SetResources(const Resources *resources) { m_resources = resources; }
+    const Resources *GetResources() const { return m_resources; }
+    ///@}
+
     /**
      * @name Setters
      * Non-virtual methods cannot be overridden and manage the Pen, Brush and FontInfo stacks
@@ -267,7 +278,7 @@ public:
     virtual bool UseGlobalStyling() { return false; }
 
 private:
-    void AddGlyphToTextExtend(Glyph *glyph, TextExtend *extend);
+    void AddGlyphToTextExtend(const Glyph *glyph, TextExtend *extend);
 
 public:
     //
@@ -282,6 +293,9 @@ protected:
 
     Zone *m_facsimile = NULL;
 
+    /** The resources (not owned) */
+    const Resources *m_resources;
+
 private:
     /** stores the width and height of the device context */
     int m_width;
@@ -13,6 +13,7 @@
 #include "facsimile.h"
 #include "options.h"
 #include "scoredef.h"
+#include "vrv.h"
 
 namespace smf {
 class MidiFile;
@@ -23,12 +24,48 @@ namespace vrv {
 class CastOffPagesParams;
 class FontInfo;
 class Glyph;
+class Measure;
 class Pages;
 class Page;
 class Score;
 
 enum DocType { Raw = 0, Rendering, Transcription, Facs };
 
+//----------------------------------------------------------------------------
+// TimeIndexEntry
+//----------------------------------------------------------------------------
+
+/**
+ * An entry of the real time index of the document (see Doc::FindElementsAtTime).
+ * Times are in millisecond. For measures, they are absolute and there is one entry per repeat.
+ * For notes and rests, they are relative to the measure.
+ */
+struct TimeIndexEntry {
+    double m_onset;
+    double m_offset;
+    /** The maximum offset of this entry and of all the entries before it in the index */
+    double m_maxOffset;
+    /** The position of the object in the document (measures) or in the measure (notes and rests) */
+    int m_order;
+    /** The repeat (1-based) for measures - unused for notes and rests */
+    int m_repeat;
+    Object *m_object;
+};
+
+typedef std::vector<TimeIndexEntry> ArrayOfTimeIndexEntries;
+
+/**
+ * The metrics of a glyph of the music font scaled to the music font size, and to the grace factor for grace sizes.
+ * The staff size remains to be applied (see Doc::GetGlyphHeight).
+ */
+struct GlyphMetrics {
+    int m_descender;
+    int m_width;
+    int m_height;
+    int m_advX;
+    bool m_exists;
+};
+
 //----------------------------------------------------------------------------
 // Doc
 //----------------------------------------------------------------------------
@@ -70,6 +107,14 @@ public:
     Options *GetOptions() const { return m_options; }
     void SetOptions(Options *options) { (*m_options) = *options; };
 
+    /**
+     * Getter for the resources (path and fonts) of the document
+     */
+    ///@{
+    Resources &GetResources() { return m_resources; }
+    const Resources &GetResources() const { return m_resources; }
+    ///@}
+
     /**
      * Generate a document scoreDef when none is provided.
      * This only looks at the content first system of the document.
@@ -199,6 +244,17 @@ public:
      */
     bool HasMidiTimemap();
 
+    /**
+     * Look for the notes and the rests sounding at the given time (in millisecond) and fill the arrays with them.
+     * Return the measure in which they are, or NULL if no measure is playing at that time.
+     * The MIDI timemap is calculated if necessary, with the real time index of the measures, notes and rests.
+     * The index is kept until the timemap is calculated again or until a measure, a note or a rest is removed
+     * from the document, in which case it is built again from the timemap.
+     * For the notes, the result is the same as looking for the measure with MeasureOnsetOffsetComparison and
+     * then for the notes in it with NoteOnsetOffsetComparison.
+     */
+    Measure *FindElementsAtTime(int millisec, ArrayOfObjects *notes, ArrayOfObjects *rests);
+
     /**
      * Export the document to a MIDI file.
      * Run trough all the layers and fill the midi file content.
@@ -240,6 +296,30 @@ public:
      */
     void CastOffDoc();
 
+    /**
+     * Casts off the document again after some measures have been edited (see Measure::SetEdited).
+     * Only the systems from the first edited one are re-laid out horizontally, and the re-flow stops as soon as
+     * the system breaks line up with the previous cast off. Pages are re-filled from the first affected page using the
+     * system heights kept from the previous cast off.
+     * Falls back to a full UnCastOffDoc and CastOffDoc if the document was not cast off with CastOffDoc, if the
+     * options or the fonts changed since then (see Doc::CalcCastOffStamp), or if something outside the measures was
+     * edited (see Doc::SetCastOffOutdated).
+     */
+    void CastOffDocIncremental();
+
+    /**
+     * Mark the previous cast off as outdated so that the next CastOffDocIncremental does a full cast off.
+     * To be called when an edit changes something outside the measures, e.g., a scoreDef or a staffDef.
+     */
+    void SetCastOffOutdated() { m_castOffStamp.clear(); }
+
+    /**
+     * Free the horizontal layout stored in the measures by the cast off (see Measure::StoreHorizontalLayout).
+     * With systemBoundariesOnly, only for the first and the last measure of each system, which are always laid out
+     * again. Otherwise for all the measures, e.g., when the pages are not going to be drawn.
+     */
+    void ClearStoredHorizontalLayout(bool systemBoundariesOnly);
+
     /**
      * Casts off the running elements (headers and footer)
      * Called from Doc::CastOffDoc
@@ -308,6 +388,22 @@ public:
      */
     void RefreshViews(){};
 
+    /**
+     * Look for an element with the specified uuid using the uuid index of the document.
+     * The objects are removed from the index when they are detached or deleted (see Object::DetachChild,
+     * Object::DeleteChild, etc.). The index is rebuilt only when a uuid is not found and the document has been
+     * modified since it was last built, since the objects added are not indexed one by one.
+     * If an ancestor is given, the element is returned only if it is a descendant of it.
+     * The element returned is the same as with Object::FindDescendantByUuid on the document (or on the ancestor).
+     */
+    Object *FindElementByUuid(const std::string &uuid, Object *ancestor = NULL);
+
+    /**
+     * Remove the object and its descendants from the uuid index, and clear the real time index if a measure,
+     * a note or a rest is removed. Called by Object before the object is detached or deleted.
+     */
+    void RemoveFromIndexes(Object *object);
+
     /**
      * Set drawing values (page size, etc) when drawing a page.
      * By default, the page size of the document is taken.
@@ -384,6 +480,43 @@ private:
      */
     int CalcMusicFontSize();
 
+    /**
+     * Return true if the scoreDef has to be optimized when casting off the document.
+     */
+    bool IsCastOffOptimized();
+
+    /**
+     * Return a stamp of the options and of the font version, used to check that the layout settings did not change
+     * since the last CastOffDoc.
+     */
+    std::string CalcCastOffStamp() const;
+
+    /**
+     * Mark the uuid index as incomplete if the document was modified since it was built.
+     */
+    void ResetUuidIndexIfModified();
+
+    /**
+     * Build the real time index from the MIDI timemap.
+     */
+    void BuildTimeIndex();
+
+    /**
+     * Clear the real time index.
+     */
+    void ClearTimeIndex();
+
+    /**
+     * Return the scaled metrics of a glyph of the music font.
+     * The table of the metrics is filled again when the font, the music font size or the grace factor changes.
+     */
+    const GlyphMetrics &GetGlyphMetrics(wchar_t code, bool graceSize) const;
+
+    /**
+     * Calculate the scaled metrics of a glyph of the music font
+     */
+    GlyphMetrics CalcGlyphMetrics(const Glyph *glyph, bool graceSize) const;
+
 public:
     /**
      * A copy of the header tree stored as pugi::xml_document
@@ -443,6 +576,11 @@ private:
      */
     Options *m_options;
 
+    /**
+     * The resources (path and fonts) used by the document.
+     */
+    Resources m_resources;
+
     /*
      * The following values are set in the Doc::SetDrawingPage.
      * They are all current values to be used when drawing a page in a View and
@@ -479,6 +617,20 @@ private:
      */
     bool m_currentScoreDefDone;
 
+    /**
+     * @name The heights of the running elements calculated in CastOffDoc.
+     * Kept for CastOffDocIncremental and VRV_UNSET when the document is not cast off with CastOffDoc.
+     */
+    ///@{
+    int m_castOffPgHeadHeight;
+    int m_castOffPgFootHeight;
+    int m_castOffPgHead2Height;
+    int m_castOffPgFoot2Height;
+    ///@}
+
+    /** The stamp of the options and fonts used by the last CastOffDoc */
+    std::string m_castOffStamp;
+
     /**
      * A flag to indicate if the drawing preparation has been done. If yes,
      * drawing preparation will be reset before being done again.
@@ -520,6 +672,42 @@ private:
 
     /** Facsimile information */
     Facsimile *m_facsimile = NULL;
+
+    /**
+     * The uuid index used by FindElementByUuid.
+     * It contains only objects of the document and all of them as long as it is complete, i.e., the document was not
+     * marked as modified since it was built (see Object::Modify). The duplicated uuids are kept apart since the
+     * index has only the first object for them.
+     */
+    MapOfUuidObjects m_uuidIndex;
+    SetOfUuidKeys m_uuidIndexDuplicates;
+    bool m_uuidIndexComplete;
+
+    /**
+     * @name The real time index used by FindElementsAtTime.
+     * Measure entries are sorted by onset. The note and rest entries of each measure are sorted by onset too
+     * and are accessed with the m_order of the measure entry.
+     */
+    ///@{
+    ArrayOfTimeIndexEntries m_timeIndexMeasures;
+    std::vector<ArrayOfTimeIndexEntries> m_timeIndexNotes;
+    std::vector<ArrayOfTimeIndexEntries> m_timeIndexRests;
+    bool m_timeIndexDone;
+    ///@}
+
+    /**
+     * @name The table of the scaled metrics of the glyphs of the music font used by GetGlyphMetrics.
+     * It is indexed by the code from SMUFL_FIRST_CODE, with the metrics for the normal and the grace size one after
+     * the other. It is valid for the font version, the music font size and the grace factor it was filled for.
+     */
+    ///@{
+    mutable std::vector<GlyphMetrics> m_glyphMetrics;
+    mutable int m_glyphMetricsFontVersion;
+    mutable int m_glyphMetricsFontSize;
+    mutable double m_glyphMetricsGraceFactor;
+    /** The metrics of a glyph outside the table */
+    mutable GlyphMetrics m_glyphMetricsOutside;
+    ///@}
 };
 
 } // namespace vrv
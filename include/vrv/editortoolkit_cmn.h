@@ -63,6 +63,13 @@ protected:
 
     Object *GetElement(std::string &elementId);
 
+    /**
+     * Flag the measure of the element (or the measure itself) as edited.
+     * This is used by Doc::CastOffDocIncremental for re-laying out only the systems affected and must be called
+     * only by the actions that change the element, not when simply looking it up.
+     */
+    void SetMeasureEdited(Object *element);
+
 public:
     //
 protected:
@@ -130,8 +130,9 @@ private:
      * When a group is created based on an object address, it is stack on the vector.
      * The ids of the group is then the position in the vector + GRPS_BASE_ID.
      * Groups coded in MEI have negative ids (-@vgrp value)
+     * The vector is per thread since it is filled while laying out a document.
      */
-    static std::vector<void *> s_drawingObjectIds;
+    static thread_local std::vector<void *> s_drawingObjectIds;
 };
 
 //----------------------------------------------------------------------------
@@ -270,10 +271,22 @@ public:
     int CalcMinMaxY(const Point points[4]);
 
     /**
-     * Calculate the adjustment needed for an element for the curve not to overlap with it.
-     * Discard will be true if the element already fits.
+     * Calculate the adjustments needed for the spanned elements for the curve not to overlap with them.
+     * The curves are evaluated for all the elements in a single pass. The elements that already fit are
+     * marked as discarded and their adjustment is 0, as for the elements already discarded.
      */
-    int CalcAdjustment(BoundingBox *boundingBox, bool &discard, int margin = 0);
+    void CalcAdjustments(
+        const ArrayOfCurveSpannedElements *spannedElements, std::vector<int> &adjustments, int margin = 0);
+
+    /**
+     * Return the points of the curve above and below (see BoundingBox::CalcThickBezier) and their BezierCurve.
+     * They are cached as long as the curve parameters and its drawingY do not change.
+     */
+    ///@{
+    void GetThickBezier(Point topBezier[4], Point bottomBezier[4]);
+    const BezierCurve &GetTopCurve();
+    const BezierCurve &GetBottomCurve();
+    ///@}
 
     /**
      * @name Getters for the current parameters
@@ -302,7 +315,11 @@ public:
     const ArrayOfCurveSpannedElements *GetSpannedElements() { return &m_spannedElements; }
 
 private:
-    //
+    /**
+     * Calculate the curves above and below if the cached ones are not for the current drawingY.
+     */
+    void UpdateThickBezier();
+
 public:
     //
 private:
@@ -321,6 +338,17 @@ private:
 
     /** The cached min or max value (depending on the curvature) */
     int m_cachedMinMaxY;
+
+    /**
+     * @name The cached curves above and below and the drawingY they were calculated for (VRV_UNSET if not)
+     */
+    ///@{
+    Point m_cachedTopBezier[4];
+    Point m_cachedBottomBezier[4];
+    BezierCurve m_cachedTopCurve;
+    BezierCurve m_cachedBottomCurve;
+    int m_cachedThickBezierY;
+    ///@}
 };
 
 //----------------------------------------------------------------------------
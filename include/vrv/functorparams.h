@@ -85,6 +85,26 @@ public:
     Doc *m_doc;
 };
 
+//----------------------------------------------------------------------------
+// AddToUuidIndexParams
+//----------------------------------------------------------------------------
+
+/**
+ * member 0: the MapOfUuidObjects index to fill
+ * member 1: the set of the duplicated uuids
+ **/
+
+class AddToUuidIndexParams : public FunctorParams {
+public:
+    AddToUuidIndexParams(MapOfUuidObjects *uuidIndex, SetOfUuidKeys *duplicates)
+    {
+        m_uuidIndex = uuidIndex;
+        m_duplicates = duplicates;
+    }
+    MapOfUuidObjects *m_uuidIndex;
+    SetOfUuidKeys *m_duplicates;
+};
+
 //----------------------------------------------------------------------------
 // AddLayerElementToFlatListParams
 //----------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 #define __VRV_GLYPH_H__
 
 #include <algorithm>
+#include <memory>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -16,6 +17,10 @@
 #include "devicecontextbase.h"
 #include "vrvdef.h"
 
+namespace pugi {
+class xml_document;
+}
+
 namespace vrv {
 
 /**
@@ -41,7 +46,7 @@ public:
     ///@}
 
     /** Get the bounds of the glyph */
-    void GetBoundingBox(int &x, int &y, int &w, int &h);
+    void GetBoundingBox(int &x, int &y, int &w, int &h) const;
 
     /**
      * Set the bounds of the glyph
@@ -54,16 +59,16 @@ public:
     int GetUnitsPerEm() const { return m_unitsPerEm; }
 
     /** Get the path */
-    std::string GetPath() { return m_path; }
+    std::string GetPath() const { return m_path; }
 
     /** Get the code string */
-    std::string GetCodeStr() { return m_codeStr; }
+    std::string GetCodeStr() const { return m_codeStr; }
 
     /**
      * @name Setter and getter for the horizAdvX
      */
     ///@{
-    int GetHorizAdvX() { return m_horizAdvX; }
+    int GetHorizAdvX() const { return m_horizAdvX; }
     void SetHorizAdvX(double horizAdvX) { m_horizAdvX = (int)(horizAdvX * 10.0); }
     ///@}
 
@@ -76,12 +81,37 @@ public:
     /**
      * Check if the glyph has anchor provided.
      */
-    bool HasAnchor(SMuFLGlyphAnchor anchor);
+    bool HasAnchor(SMuFLGlyphAnchor anchor) const;
 
     /**
      * Return the SMuFL anchor for the glyph.
+     * Returns NULL if the glyph does not have the anchor (see Glyph::HasAnchor)
+     */
+    const Point *GetAnchor(SMuFLGlyphAnchor anchor) const;
+
+    /**
+     * Return the XML content (SVG <symbol>) of the glyph when it was read from a font bundle.
+     * Returns NULL otherwise, in which case the XML has to be loaded from the file (see Glyph::GetPath).
+     * The content is not parsed and remains valid as long as the glyph exists.
+     */
+    const char *GetXML(size_t &length) const;
+
+    /**
+     * Return the parsed XML content (SVG <symbol>) of the glyph, from the font bundle or from the file.
+     * The content is parsed only once and shared by all the callers (e.g., all the SVG device contexts).
+     * Returns an empty pointer if the XML cannot be loaded.
+     */
+    std::shared_ptr<const pugi::xml_document> GetXMLDocument() const;
+
+    /**
+     * @name Binary serialization of the glyph for the font bundles (see Resources::WriteFontBundle)
+     * The values are written as they are stored (ten times the original values) in the native byte order.
+     * ReadBinary keeps a reference to the bundle for the XML content, which is not copied.
      */
-    const Point *GetAnchor(SMuFLGlyphAnchor anchor);
+    ///@{
+    void WriteBinary(std::string &buffer, const std::string &filename, const std::string &xml) const;
+    bool ReadBinary(const std::shared_ptr<const std::string> &bundle, size_t &pos, const std::string &dirname);
+    ///@}
 
 private:
     //
@@ -103,6 +133,12 @@ private:
     std::string m_codeStr;
     /** A map of the available anchors */
     std::map<SMuFLGlyphAnchor, Point> m_anchors;
+    /** The font bundle and the position of the XML content of the glyph in it (if read from a bundle) */
+    std::shared_ptr<const std::string> m_bundle;
+    size_t m_xmlOffset;
+    size_t m_xmlLength;
+    /** The parsed XML content, loaded on demand (see Glyph::GetXMLDocument) */
+    mutable std::shared_ptr<const pugi::xml_document> m_xmlDocument;
 };
 
 } // namespace vrv
@@ -327,6 +327,9 @@ public:
     std::string GetHumdrumString();
     std::string GetMeiString();
 
+    // Embed the **kern data of each layer in a comment (on by default).
+    void SetKernComments(bool comments) { m_comment = comments; }
+
 protected:
     void clear();
     bool convertHumdrum();
@@ -518,6 +521,7 @@ protected:
     void promoteInstrumentsForStaffGroup(StaffGrp *group);
     void promoteInstrumentAbbreviationsToGroup();
     void promoteInstrumentAbbreviationsForStaffGroup(StaffGrp *group);
+    void resetAttributeUuids();
     std::string getInstrumentName(StaffDef *sd);
     std::string getInstrumentAbbreviation(StaffDef *sd);
     void removeInstrumentName(StaffDef *sd);
@@ -348,7 +348,7 @@ private:
     ///@}
 
     /**
-     * Write unsupported attributes stored in Object::m_unsupported (not tested)
+     * Write unsupported attributes stored in the Object (not tested)
      */
     void WriteUnsupportedAttr(pugi::xml_node currentNode, Object *object);
 
@@ -422,6 +422,12 @@ public:
 
     virtual bool Import(const std::string &mei);
 
+    /**
+     * Setter for the flag indicating if the unsupported attributes have to be preserved.
+     * When false, the attributes read are not removed from the nodes, which speeds up the import.
+     */
+    void SetReadUnsupportedAttr(bool readUnsupportedAttr) { m_readUnsupportedAttr = readUnsupportedAttr; }
+
 private:
     bool ReadDoc(pugi::xml_node root);
 
@@ -627,7 +633,7 @@ private:
     ///@}
 
     /**
-     * Write unsupported attributes and store them in Object::m_unsupported (not tested)
+     * Read unsupported attributes and store them in the Object (not tested)
      */
     void ReadUnsupportedAttr(pugi::xml_node element, Object *object);
 
@@ -714,6 +720,12 @@ private:
      * This is not the case when selecting a mDiv that is not the first one with a score in the tree.
      */
     bool m_useScoreDefForDoc;
+
+    /**
+     * A flag indicating if the unsupported attributes are stored in the Object.
+     * The attributes read by the att classes are removed from the nodes only when true.
+     */
+    bool m_readUnsupportedAttr;
 };
 
 } // namespace vrv
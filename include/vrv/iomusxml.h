@@ -8,6 +8,7 @@
 #ifndef __VRV_IOMUSXML_H__
 #define __VRV_IOMUSXML_H__
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -201,6 +202,11 @@ private:
      */
     void AddMeasure(Section *section, Measure *measure, int i);
 
+    /*
+     * Returns the first measure added to the section with the @n, or NULL if none.
+     */
+    Measure *GetMeasureByN(const std::string &measureN);
+
     /*
      * Add a Layer element to the layer or to the LayerElement at the top of m_elementStack.
      */
@@ -251,9 +257,20 @@ private:
      */
     ///@{
     std::string GetContent(pugi::xml_node node);
-    std::string GetContentOfChild(pugi::xml_node node, std::string child);
+    std::string GetContentOfChild(pugi::xml_node node, const std::string &child);
     ///@}
 
+    /*
+     * Return the compiled XPath query, compiling it only the first time it is used.
+     * Plain element names are looked up with pugi::xml_node::child instead.
+     */
+    const pugi::xpath_query &GetXPathQuery(const std::string &query);
+
+    /*
+     * Returns true if the node is within the first part of the score.
+     */
+    bool IsInFirstPart(pugi::xml_node node);
+
     /*
      * @name Methods for opening and closing ties and slurs.
      * Opened ties and slurs are stacked together with musicxml::OpenTie
@@ -333,7 +350,7 @@ private:
     /* A maps of time stamps (score time) to indicate write pointer of a given layer */
     std::map<Layer *, int> m_layerEndTimes;
     /* To remember layer of last element (note) to handle chords */
-    Layer *m_prevLayer;
+    Layer *m_prevLayer = NULL;
     /* The stack for open slurs */
     std::vector<std::pair<Slur *, musicxml::OpenSlur> > m_slurStack;
     /* The stack for slur stops that might come before the slur has been opened */
@@ -370,6 +387,10 @@ private:
     std::vector<std::pair<Arpeg *, musicxml::OpenArpeggio> > m_ArpeggioStack;
     /* a map for the measure counts storing the index of each measure created */
     std::map<Measure *, int> m_measureCounts;
+    /* the measures added to the section by @n */
+    std::map<std::string, Measure *> m_measuresByN;
+    /* the compiled XPath queries */
+    std::map<std::string, pugi::xpath_query> m_xpathQueries;
 };
 
 } // namespace vrv
@@ -175,6 +175,44 @@ public:
     void SetDrawingScoreDef(ScoreDef *drawingScoreDef);
     ///@}
 
+    /**
+     * @name Setter and getter of the edited flag.
+     * Set when the content of the measure is changed by an editor action and reset when it is cast off again.
+     * Used by Doc::CastOffDocIncremental to find the systems to re-lay out.
+     */
+    ///@{
+    bool IsEdited() const { return m_isEdited; }
+    void SetEdited(bool isEdited) { m_isEdited = isEdited; }
+    ///@}
+
+    /**
+     * The steps of Page::LayOutHorizontally at which the horizontal layout of the measure is stored:
+     * once the alignments are positioned (before the bounding box drawing), after the drawing, and once the
+     * measure-level adjustments are done.
+     */
+    enum LayoutStep { LAYOUT_ALIGNED = 0, LAYOUT_DRAWN, LAYOUT_ADJUSTED };
+
+    /**
+     * @name Store and restore the horizontal layout of the measure.
+     * The x positions of the alignments are stored by Page::LayOutHorizontally when casting off the document, before
+     * the system-dependent adjustments. They are restored once when the page is laid out, and only if the layout of
+     * the measure does not depend on the system breaks, i.e., if it has no scoreDef or cautionary elements to draw,
+     * no hidden staff, no articulation (placed only by the vertical layout) and was not edited.
+     * Since the bounding box drawing sets some positions from the alignments (e.g., the centering of the measure
+     * rests), the layout before the drawing is restored first and the adjusted one once the page is drawn. The
+     * adjustments of the layer elements are applied as offsets to the positions set by the drawing.
+     */
+    ///@{
+    void StoreHorizontalLayout(LayoutStep step);
+    bool RestoreHorizontalLayout();
+    void RestoreAdjustedHorizontalLayout();
+    ///@}
+
+    /**
+     * Free the stored horizontal layout, e.g., when the measure is laid out again or is not going to be drawn.
+     */
+    void ClearStoredHorizontalLayout();
+
     /**
      * @name Setter and getter of the drawing ending
      */
@@ -205,6 +243,16 @@ public:
      */
     double GetRealTimeOffsetMilliseconds(int repeat) const;
 
+    /**
+     * Return the number of times the measure is played, i.e., the number of real time offsets.
+     */
+    int GetRepeatCount() const { return (int)m_realTimeOffsetMilliseconds.size(); }
+
+    /**
+     * Return the real time duration of the measure in millisecond, as used by Measure::EnclosesTime.
+     */
+    int GetRealTimeDurationMilliseconds() const;
+
     //----------//
     // Functors //
     //----------//
@@ -456,6 +504,23 @@ private:
      */
     bool m_hasAlignmentRefWithMultipleLayers;
 
+    /**
+     * A flag indicating that the measure was edited since the last cast off
+     */
+    bool m_isEdited;
+
+    /**
+     * @name The x positions of the measure aligner alignments and the relative positions of the layer elements
+     * stored when casting off the document, before the drawing, and the ones after the adjustments (the latter as
+     * offsets to the positions after the drawing for the layer elements)
+     */
+    ///@{
+    std::vector<int> m_storedAlignmentXRels;
+    std::vector<std::pair<int, int>> m_storedElementRels;
+    std::vector<int> m_storedAdjustedAlignmentXRels;
+    std::vector<std::pair<int, int>> m_storedElementOffsets;
+    ///@}
+
     /**
      * Start time state variables.
      */
@@ -8,14 +8,20 @@
 #ifndef __VRV_OBJECT_H__
 #define __VRV_OBJECT_H__
 
+#include <assert.h>
+#include <cstddef>
 #include <cstdlib>
 #include <ctime>
+#include <deque>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <string>
+#include <type_traits>
 
 //----------------------------------------------------------------------------
 
+#include "att.h"
 #include "attclasses.h"
 #include "boundingbox.h"
 #include "vrvdef.h"
@@ -120,16 +126,13 @@ public:
      * @name Methods for registering a MEI att class and for registering interfaces regrouping MEI att classes.
      */
     ///@{
-    void RegisterAttClass(AttClassId attClassId) { m_attClasses.push_back(attClassId); }
-    bool HasAttClass(AttClassId attClassId) const
+    void RegisterAttClass(AttClassId attClassId) { m_attClassTable = m_attClassTable->WithAttClass(attClassId); }
+    bool HasAttClass(AttClassId attClassId) const { return m_attClassTable->HasAttClass(attClassId); }
+    void RegisterInterface(const std::vector<AttClassId> *attClasses, InterfaceId interfaceId)
     {
-        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
-    }
-    void RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId);
-    bool HasInterface(InterfaceId interfaceId) const
-    {
-        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
+        m_attClassTable = m_attClassTable->WithInterface(attClasses, interfaceId);
     }
+    bool HasInterface(InterfaceId interfaceId) const { return m_attClassTable->HasInterface(interfaceId); }
     ///@}
 
     virtual DurationInterface *GetDurationInterface() { return NULL; }
@@ -221,15 +224,46 @@ public:
      */
     virtual void CloneReset();
 
-    std::string GetUuid() const { return m_uuid; }
+    /**
+     * @name Get and set the uuid.
+     * Generated uuids (the class prefix and 16 digits) are stored as a number and the string is built on demand.
+     */
+    ///@{
+    std::string GetUuid() const;
     void SetUuid(std::string uuid);
+    ///@}
+    /**
+     * @name Get the key of the uuid in the uuid index of the Doc, without formatting a uuid stored as a number.
+     * UuidToKey gives the key of any uuid, e.g., for looking it up in the index.
+     */
+    ///@{
+    UuidKey GetUuidKey() const;
+    static UuidKey UuidToKey(const std::string &uuid);
+    ///@}
     void SwapUuid(Object *other);
     void ResetUuid();
+    /**
+     * Seed the uuid generator of the current thread (0 for a random seed).
+     * The generator is a std::mt19937 and not std::rand anymore, so the uuids for a seed differ from the ones of
+     * version 2.6.0 and before.
+     */
     static void SeedUuid(unsigned int seed = 0);
 
-    std::string GetComment() const { return m_comment; }
-    void SetComment(std::string comment) { m_comment = comment; }
-    bool HasComment() { return !m_comment.empty(); }
+    std::string GetComment() const { return (m_extraData) ? m_extraData->m_comment : ""; }
+    void SetComment(std::string comment) { this->GetExtraData()->m_comment = comment; }
+    bool HasComment() { return (m_extraData && !m_extraData->m_comment.empty()); }
+
+    /**
+     * @name Add and get the unsupported attributes stored as pairs.
+     * This can be used for writing back data.
+     */
+    ///@{
+    void AddUnsupportedAttr(const std::string &name, const std::string &value)
+    {
+        this->GetExtraData()->m_unsupported.push_back(std::make_pair(name, value));
+    }
+    const ArrayOfStrAttr &GetUnsupportedAttrs() const;
+    ///@}
 
     /**
      * @name Children count, with or without a ClassId.
@@ -421,6 +455,7 @@ public:
 
     /**
      * Clear the children vector and delete all the objects.
+     * The objects are removed from the indexes of the Doc.
      */
     void ClearChildren();
 
@@ -501,6 +536,15 @@ public:
     virtual void Process(Functor *functor, FunctorParams *functorParams, Functor *endFunctor = NULL,
         ArrayOfComparisons *filters = NULL, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
 
+    /**
+     * Process several passes in a single traversal of the tree.
+     * Each FunctorPass has its own functors, params and filters, and each object is processed for every pass
+     * it would have been processed by with a Process call for that pass. Since the calls of the passes are
+     * interleaved, this can only be used for passes that are independent from each other, for example passes
+     * by staff / layer that modify only the content of their own layer.
+     */
+    void ProcessPasses(ArrayOfFunctorPasses &passes, int deepness = UNLIMITED_DEPTH);
+
     //----------//
     // Functors //
     //----------//
@@ -510,6 +554,11 @@ public:
      */
     virtual int AddLayerElementToFlatList(FunctorParams *functorParams);
 
+    /**
+     * Add each Object to a uuid index (the first one is kept for duplicated uuids)
+     */
+    virtual int AddToUuidIndex(FunctorParams *functorParams);
+
     /**
      * @name Functors for finding objects
      */
@@ -1129,17 +1178,48 @@ private:
      */
     void GenerateUuid();
 
+    /**
+     * Return true if the children of the object are not processed by functors processing only visible objects.
+     */
+    bool IsHiddenForProcessing();
+
+    /**
+     * Return true if the object matches the filters of a Process call.
+     */
+    bool MatchesFilters(ArrayOfComparisons *filters);
+
+    /**
+     * Recursive part of ProcessPasses.
+     * The buffers hold two arrays of passes for each depth and are re-used across the traversal.
+     */
+    void ProcessPasses(
+        ArrayOfFunctorPasses &passes, int deepness, std::deque<ArrayOfFunctorPasses> &buffers, int depth);
+
     /**
      * Initialisation method taking a uuid prefix argument.
      */
-    void Init(const std::string&);
+    void Init(const std::string &);
+
+    /**
+     * Delete the children (unless relinquished or for a reference object) and clear the children vector.
+     * Unlike ClearChildren, it does not update the indexes of the Doc and is used when the object is deleted.
+     */
+    void DeleteChildren();
 
-public:
     /**
-     * Keep an array of unsupported attributes as pairs.
-     * This can be used for writing back data
+     * Remove the child and its descendants from the indexes of the Doc the object belongs to, if any.
+     * It has to be called before the child is detached or deleted.
      */
-    ArrayOfStrAttr m_unsupported;
+    void RemoveFromDocIndexes(Object *child);
+
+    /**
+     * The comment and the unsupported attributes, allocated only when one of them is set.
+     */
+    struct ExtraData {
+        std::string m_comment;
+        ArrayOfStrAttr m_unsupported;
+    };
+    ExtraData *GetExtraData();
 
 protected:
     /**
@@ -1155,11 +1235,16 @@ private:
     Object *m_parent;
 
     /**
-     * Members for storing / generating uuids
+     * Members for storing / generating uuids.
+     * The prefix is shared by all the objects of a class.
+     * The number is the one of a generated uuid (or of a uuid with the same format) and -1 otherwise.
+     * Generated uuids are below INT_MAX, but a uuid read with the same format and a larger number silently stays
+     * a string in m_uuid.
      */
     ///@{
+    const std::string *m_classid;
+    int m_uuidNr;
     std::string m_uuid;
-    std::string m_classid;
     ///@}
 
     /**
@@ -1176,6 +1261,17 @@ private:
      */
     mutable bool m_isModified;
 
+    /**
+     * A flag indicating if the Object represents an attribute in the original MEI.
+     * For example, a Artic child in Note for an original @artic
+     */
+    bool m_isAttribute;
+
+    /**
+     * A flag indicating if the Object is a copy created by an expanded expansion element.
+     */
+    bool m_isExpansion;
+
     /**
      * Members used for caching iterator values.
      * See Object::IterGetFirst, Object::IterGetNext and Object::IterIsNotEnd
@@ -1187,38 +1283,70 @@ private:
     ///@}
 
     /**
-     * A vector for storing the list of AttClassId (MEI att classes) implemented.
-     */
-    std::vector<AttClassId> m_attClasses;
-
-    /**
-     * A vector for storing the list of InterfaceId (group of MEI att classes) implemented.
+     * The table of the MEI att classes and of the interfaces implemented (shared by all the objects of a class).
      */
-    std::vector<InterfaceId> m_interfaces;
+    const AttClassTable *m_attClassTable;
 
     /**
-     * A string for storing a comment to be printed immediately before
-     * the object when printing an MEI element.
+     * The comment to be printed immediately before the object when printing an MEI element
+     * and the unsupported attributes.
      */
-    std::string m_comment;
+    std::unique_ptr<ExtraData> m_extraData;
+};
 
-    /**
-     * A flag indicating if the Object represents an attribute in the original MEI.
-     * For example, a Artic child in Note for an original @artic
-     */
-    bool m_isAttribute;
+//----------------------------------------------------------------------------
+// CrossCastOffsets
+//----------------------------------------------------------------------------
 
-    /**
-     * A flag indicating if the Object is a copy created by an expanded expansion element.
-     */
-    bool m_isExpansion;
+/**
+ * This class caches the offset of an att class (or of an interface) T within the objects of each ClassId.
+ * Since each ClassId corresponds to one class, the offset is the same for all the objects with that ClassId and it is
+ * looked up with a dynamic_cast only once per ClassId and per thread. It is used through vrv_cross_cast.
+ */
+template <class T> class CrossCastOffsets {
+public:
+    static T *Cast(Object *object)
+    {
+        if (!object) return NULL;
+        Entry &entry = s_entries[object->GetClassId()];
+        if (!entry.m_known) {
+            T *target = dynamic_cast<T *>(object);
+            entry.m_known = true;
+            entry.m_isBase = (target != NULL);
+            entry.m_offset = (target) ? reinterpret_cast<char *>(target) - reinterpret_cast<char *>(object) : 0;
+            return target;
+        }
+        T *target = (entry.m_isBase) ? reinterpret_cast<T *>(reinterpret_cast<char *>(object) + entry.m_offset) : NULL;
+        assert(target == dynamic_cast<T *>(object));
+        return target;
+    }
 
-    /**
-     * A static counter for uuid generation.
-     */
-    static unsigned long s_objectCounter;
+private:
+    struct Entry {
+        bool m_known;
+        bool m_isBase;
+        std::ptrdiff_t m_offset;
+    };
+    static thread_local Entry s_entries[UNSPECIFIED + 1];
 };
 
+template <class T> thread_local typename CrossCastOffsets<T>::Entry CrossCastOffsets<T>::s_entries[UNSPECIFIED + 1];
+
+/**
+ * Cast an object to one of its att classes or interfaces (a cross-cast that vrv_cast cannot do), for example
+ * vrv_cross_cast<AttNInteger *>(object). It returns NULL if the object does not have it, like a dynamic_cast.
+ */
+///@{
+template <class T> T vrv_cross_cast(Object *object)
+{
+    return CrossCastOffsets<std::remove_cv_t<std::remove_pointer_t<T>>>::Cast(object);
+}
+template <class T> T vrv_cross_cast(const Object *object)
+{
+    return CrossCastOffsets<std::remove_cv_t<std::remove_pointer_t<T>>>::Cast(const_cast<Object *>(object));
+}
+///@}
+
 //----------------------------------------------------------------------------
 // ObjectListInterface
 //----------------------------------------------------------------------------
@@ -1341,12 +1469,17 @@ public:
     // constructor - takes pointer to an object and pointer to a member and stores
     // them in two private variables
     Functor();
-    Functor(int (Object::*_obj_fpt)(FunctorParams *));
+    Functor(int (Object::*_obj_fpt)(FunctorParams *), const std::string &name = "");
     virtual ~Functor(){};
 
     // override function "Call"
     virtual void Call(Object *ptr, FunctorParams *functorParams);
 
+    /**
+     * The name of the functor (used for profiling)
+     */
+    std::string GetName() const { return m_name; }
+
 private:
     //
 public:
@@ -1362,8 +1495,45 @@ public:
      * The value is true by default.
      */
     bool m_visibleOnly;
+    /**
+     * @name Counters for profiling.
+     * The number of objects processed and of calls, and a flag indicating that the root object is being processed.
+     */
+    ///@{
+    long m_visitCount;
+    long m_callCount;
+    bool m_isProcessing;
+    ///@}
 
 private:
+    std::string m_name;
+};
+
+//----------------------------------------------------------------------------
+// FunctorPass
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds one pass processed by Object::ProcessPasses.
+ * The functors are copied so that each pass has its own return codes. The params and the filters are not owned.
+ */
+class FunctorPass {
+public:
+    FunctorPass(const Functor &functor, FunctorParams *functorParams, const Functor *endFunctor = NULL);
+    virtual ~FunctorPass();
+    FunctorPass(const FunctorPass &) = delete;
+    FunctorPass &operator=(const FunctorPass &) = delete;
+
+private:
+    //
+public:
+    Functor m_functor;
+    Functor *m_endFunctor;
+    FunctorParams *m_functorParams;
+    ArrayOfComparisons m_filters;
+
+private:
+    //
 };
 
 //----------------------------------------------------------------------------
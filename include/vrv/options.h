@@ -473,6 +473,7 @@ public:
     OptionBool m_justifySystemsOnly;
     OptionBool m_justifyVertically;
     OptionBool m_landscape;
+    OptionBool m_lazyLayout;
     OptionBool m_mensuralToMeasure;
     OptionDbl m_midiTempoAdjustment;
     OptionDbl m_minLastJustification;
@@ -488,8 +489,10 @@ public:
     OptionInt m_pageMarginRight;
     OptionInt m_pageMarginTop;
     OptionInt m_pageWidth;
+    OptionBool m_profile;
     OptionString m_expand;
     OptionBool m_svgBoundingBoxes;
+    OptionBool m_svgSharedDefs;
     OptionBool m_svgViewBox;
     OptionInt m_unit;
     OptionBool m_useFacsimile;
@@ -18,6 +18,7 @@ class PrepareProcessingListsParams;
 class RunningElement;
 class Staff;
 class System;
+class View;
 
 //----------------------------------------------------------------------------
 // Page
@@ -88,6 +89,11 @@ public:
      */
     void LayOut(bool force = false);
 
+    /**
+     * Mark the layout of the page as not done, e.g., when its drawing scoreDefs are set again.
+     */
+    void ResetLayoutDone() { m_layoutDone = false; }
+
     /**
      * Do the layout for a transcription page (with layout information).
      * This only calculates positioning or layer element parts using provided layout of parents.
@@ -95,9 +101,11 @@ public:
     void LayOutTranscription(bool force = false);
 
     /**
-     * Lay out the content of the page (measures and their content) horizontally
+     * Lay out the content of the page (measures and their content) horizontally.
+     * With storeLayout, the layout of each measure is stored before the system-dependent adjustments so it can be
+     * restored when the page is laid out after the cast-off (see Measure::StoreHorizontalLayout).
      */
-    void LayOutHorizontally();
+    void LayOutHorizontally(bool storeLayout = false);
 
     /**
      * Justifiy the content of the page (measures and their content) horizontally
@@ -106,8 +114,11 @@ public:
 
     /**
      * Lay out the content of the page (system/staves) vertically.
+     * Without drawing, the layout is only estimated: the overflow of the bounding boxes of the horizontal
+     * layout and the staff and system spacing are taken into account, but no floating element is positioned.
+     * This is used for the page breaks when doing the cast off with --lazy-layout.
      */
-    void LayOutVertically();
+    void LayOutVertically(bool drawing = true);
 
     /**
      * Justifiy the content of the page (system/staves) vertically
@@ -119,6 +130,12 @@ public:
      */
     void LayOutPitchPos();
 
+    /**
+     * Lay out the content of the page horizontally by time only, for the MIDI output and the timemap.
+     * Only the alignments and their times are set - no position and no bounding box is calculated.
+     */
+    void LayOutTimes();
+
     /**
      * Return the height of the content by looking at the last system of the page.
      * This is used for adjusting the page height when this is the expected behaviour,
@@ -174,6 +191,12 @@ private:
      */
     void AdjustSylSpacingByVerse(PrepareProcessingListsParams &listsParams, Doc *doc);
 
+    /**
+     * Draw the page with the view in a BBoxDeviceContext for filling the bounding boxes of its content.
+     * The drawing is recorded as a pass when a profiler is running, with the number of bounding boxes filled as visits.
+     */
+    void DrawBoundingBoxes(View &view, unsigned char update);
+
     //
 public:
     /** Page width (MEI scoredef@page.width). Saved if != -1 */
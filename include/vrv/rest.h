@@ -70,6 +70,16 @@ public:
      */
     int GetRestLocOffset(int loc);
 
+    /**
+     * MIDI timing information
+     */
+    ///@{
+    void SetRealTimeOnsetSeconds(double timeInSeconds);
+    void SetRealTimeOffsetSeconds(double timeInSeconds);
+    double GetRealTimeOnsetMilliseconds() const { return m_realTimeOnsetMilliseconds; }
+    double GetRealTimeOffsetMilliseconds() const { return m_realTimeOffsetMilliseconds; }
+    ///@}
+
     //----------//
     // Functors //
     //----------//
@@ -104,6 +114,15 @@ private:
 public:
     //
 private:
+    /**
+     * The time in milliseconds since the start of the measure element that contains the rest.
+     */
+    double m_realTimeOnsetMilliseconds;
+
+    /**
+     * The time in milliseconds since the start of the measure element to the end of the rest.
+     */
+    double m_realTimeOffsetMilliseconds;
 };
 
 } // namespace vrv
@@ -117,9 +117,9 @@ public:
     void SetCurrentPageNum(Page *currentPage);
 
     /**
-     * Load the footer from the resources (footer.svg)
+     * Load the footer from the resources of the doc (footer.svg)
      */
-    void LoadFooter();
+    void LoadFooter(const Doc *doc);
 
     /**
      * Add page numbering to the running element.
@@ -17,6 +17,7 @@
 namespace vrv {
 
 class Clef;
+class Doc;
 class KeySig;
 class Mensur;
 class MeterSig;
@@ -169,6 +170,11 @@ public:
     void SetDrawingWidth(int drawingWidth);
     ///@}
 
+    /**
+     * Calculate the drawing width from the clef and the longest key signature of the scoreDef and of its staffDefs.
+     */
+    int CalcDrawingWidth(Doc *doc);
+
     /**
      * @name Getters for running elements
      */
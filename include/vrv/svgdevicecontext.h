@@ -11,6 +11,8 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -23,6 +25,147 @@
 
 namespace vrv {
 
+class SvgBuffer;
+
+//----------------------------------------------------------------------------
+// SvgMarker
+//----------------------------------------------------------------------------
+
+/**
+ * This class marks the positions where the content of a <g> already written can be completed.
+ * It is used when a graphic is resumed (see SvgDeviceContext::ResumeGraphic).
+ * The positions are kept up-to-date when the content of the buffer changes or is moved to the buffer of the parent.
+ */
+class SvgMarker {
+public:
+    SvgMarker();
+    virtual ~SvgMarker() {}
+
+    /** Check if the element has content after its shapes (e.g., <g> children) */
+    bool HasGroups() const { return !m_isEmpty && (m_shapesEnd < m_end); }
+
+    /** The buffer in which the element is currently written */
+    SvgBuffer *m_buffer;
+    /** The position where the shapes are inserted (before the first <g> child) */
+    size_t m_shapesEnd;
+    /** The position of the end tag, or of the " />" when the element is empty */
+    size_t m_end;
+    /** The element was written as an empty element */
+    bool m_isEmpty;
+    /** The depth of the element in the SVG */
+    int m_depth;
+    /** The font-family of the element (if any) */
+    std::string m_fontFamily;
+};
+
+//----------------------------------------------------------------------------
+// SvgBuffer
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds a piece of serialized SVG and the markers of the <g> it contains.
+ */
+class SvgBuffer {
+public:
+    SvgBuffer() {}
+    virtual ~SvgBuffer() {}
+
+    bool IsEmpty() const { return m_data.empty(); }
+    size_t GetSize() const { return m_data.size(); }
+
+    /**
+     * Insert the content of another buffer at a position, replacing length characters.
+     * The markers are moved from the other buffer, which is emptied.
+     */
+    void Insert(size_t pos, SvgBuffer &buffer, size_t length = 0);
+
+    /**
+     * Append the content of another buffer
+     */
+    void Append(SvgBuffer &buffer) { this->Insert(m_data.size(), buffer); }
+
+private:
+    SvgBuffer(const SvgBuffer &);
+    SvgBuffer &operator=(const SvgBuffer &);
+
+public:
+    /** The serialized SVG */
+    std::string m_data;
+    /** The markers in it */
+    std::vector<SvgMarker *> m_markers;
+};
+
+//----------------------------------------------------------------------------
+// SvgElement
+//----------------------------------------------------------------------------
+
+/**
+ * This class is an SVG element being written.
+ * The start tag is written when the element is ended, since attributes can be added until then.
+ * The content is kept in two buffers because the shapes are written before the <g> children of the element.
+ */
+class SvgElement {
+public:
+    /** How the element is added to its parent */
+    enum Position { APPEND = 0, APPEND_SHAPE, PREPEND };
+
+    SvgElement(const std::string &name, Position position = APPEND);
+    virtual ~SvgElement() {}
+
+    /**
+     * @name Add an attribute - numbers are formatted as in pugixml
+     */
+    ///@{
+    void AddAttribute(const std::string &name, const std::string &value);
+    void AddAttribute(const std::string &name, int value);
+    void AddAttribute(const std::string &name, double value);
+    ///@}
+
+    /**
+     * Return the value of the first attribute with the name, or NULL
+     */
+    const std::string *GetAttribute(const std::string &name) const;
+
+    /**
+     * Set the text content of the element, which cannot have other children
+     */
+    void SetText(const std::string &text);
+
+    /**
+     * Write the element at its depth into the buffer, moving the content buffers into it.
+     * Returns a marker to fill (if not NULL) for the element to be resumed.
+     */
+    void Write(SvgBuffer &buffer, SvgMarker *marker, bool newLine = true);
+
+    /**
+     * @name Helpers for writing serialized SVG
+     */
+    ///@{
+    static void WriteIndent(std::string &data, int depth);
+    static void WriteEscaped(std::string &data, const std::string &value, bool isAttribute);
+    ///@}
+
+private:
+    SvgElement(const SvgElement &);
+    SvgElement &operator=(const SvgElement &);
+
+public:
+    std::string m_name;
+    Position m_position;
+    std::vector<std::pair<std::string, std::string>> m_attributes;
+    bool m_hasText;
+    std::string m_text;
+    /** The content before the first <g> child */
+    SvgBuffer m_shapes;
+    /** The content from the first <g> child */
+    SvgBuffer m_groups;
+    int m_depth;
+    /** The element receiving the content instead of this one (when resuming an element not ended yet) */
+    SvgElement *m_target;
+    /** The marker of the element ended and resumed */
+    SvgMarker *m_resumed;
+};
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
@@ -31,6 +174,10 @@ namespace vrv {
  * This class implements a drawing context for generating SVG files.
  * The music font is embedded by incorporating ./data/[fontname]/[glyph].xml glyphs within
  * the SVG file.
+ * The SVG is serialized as the elements are ended instead of being built as a DOM.
+ * It is not streamed to an output stream since the dimensions of the root and the <defs> are known only when the page
+ * is committed, the bounding boxes are prepended and ResumeGraphic adds content to elements already written.
+ * The page is held as a string, which is what GetStringSVG returns.
  */
 class SvgDeviceContext : public DeviceContext {
 public:
@@ -182,6 +329,13 @@ public:
      */
     void SetSvgViewBox(bool svgViewBox) { m_svgViewBox = svgViewBox; }
 
+    /**
+     * Setting the ids of the <defs> already written by previous SVGs (NULL by default).
+     * When set, only the glyphs (and the VerovioText font) not in the list are written and added to it.
+     * This is for sharing the <defs> between SVGs (e.g., pages) that are inlined in the same document.
+     */
+    void SetSharedDefs(std::set<std::string> *sharedDefs) { m_sharedDefs = sharedDefs; }
+
 private:
     /**
      * Copy the content of a file to the output stream.
@@ -189,6 +343,12 @@ private:
      */
     bool CopyFileToStream(const std::string &filename, std::ostream &dest);
 
+    /**
+     * Add the id to the shared <defs> (if any).
+     * Returns false if it was already written by a previous SVG and should be skipped.
+     */
+    bool AddSharedDef(const std::string &id);
+
     /**
      * Internal method for drawing debug SVG bounding box
      */
@@ -214,7 +374,20 @@ private:
 
     std::string GetColour(int colour);
 
-    pugi::xml_node AppendChild(std::string name);
+    /**
+     * @name Methods for writing the elements
+     * Shapes are added before the <g> children of the current element (see SvgElement::Position).
+     */
+    ///@{
+    SvgElement *GetCurrentElement();
+    /** The outermost <g> with the id not ended yet (NULL if none), which comes first in the document */
+    SvgElement *GetOpenGraphic(const std::string &gId);
+    SvgElement *StartElement(const std::string &name, SvgElement::Position position = SvgElement::APPEND);
+    void EndElement();
+    void AppendChild(SvgElement &element);
+    void AppendCopy(pugi::xml_node node, SvgElement::Position position = SvgElement::APPEND);
+    void AddToElement(SvgElement *element, SvgBuffer &buffer, const std::string &name, SvgElement::Position position);
+    ///@}
 
 public:
     //
@@ -226,25 +399,23 @@ private:
      */
     bool m_vrvTextFont;
 
-    // we use a std::stringstream because we want to prepend the <defs> which will know only when we reach the end of
-    // the page
+    // the svg is serialized in Commit, when the <defs> and the size of the root are known
     // some viewer seem to support to have the <defs> at the end, but some do not (pdf2svg, for example)
-    // for this reason, the full svg is finally written a string from the destructor or when Flush() is called
-    std::ostringstream m_outdata;
+    std::string m_outdata;
 
     bool m_committed; // did we flushed the file?
     int m_originX, m_originY;
 
     // holds the list of glyphs from the smufl font used so far
     // they will be added at the end of the file as <defs>
-    std::vector<std::string> m_smuflGlyphs;
+    std::vector<const Glyph *> m_smuflGlyphs;
 
-    // pugixml data
-    pugi::xml_document m_svgDoc;
-    pugi::xml_node m_svgNode;
-    pugi::xml_node m_pageNode;
-    pugi::xml_node m_currentNode;
-    std::list<pugi::xml_node> m_svgNodeStack;
+    // the elements being written, the first one being the <svg> root
+    std::list<SvgElement> m_elements;
+    // the markers of the <g> already written for resuming them (the first one written for an id)
+    std::map<std::string, SvgMarker> m_markers;
+    // the page-margin element while the page is drawn
+    SvgElement *m_pageElement;
 
     // output as mm (for pdf generation with a 72 dpi)
     bool m_mmOutput;
@@ -253,6 +424,8 @@ private:
     bool m_svgBoundingBoxes;
     // use viewbox on svg root element
     bool m_svgViewBox;
+    // the ids of the <defs> shared with other SVGs (if any)
+    std::set<std::string> *m_sharedDefs;
 };
 
 } // namespace vrv
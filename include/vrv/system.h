@@ -86,6 +86,15 @@ public:
      */
     int GetHeight() const;
 
+    /**
+     * @name Setter and getter of the height used when casting off pages.
+     * This is the height calculated on the content page, which is changed by the page layout afterwards.
+     */
+    ///@{
+    int GetCastOffHeight() const { return m_castOffHeight; }
+    void SetCastOffHeight(int castOffHeight) { m_castOffHeight = castOffHeight; }
+    ///@}
+
     /**
      * Return the index position of the system in its page parent
      */
@@ -304,6 +313,12 @@ private:
      * This does not mean that a staff is hidden, but only that it can be optimized.
      */
     bool m_drawingIsOptimized;
+
+    /**
+     * The height of the system when cast off (VRV_UNSET if not cast off yet).
+     * Kept for re-paginating without redoing the vertical layout, see Doc::CastOffDocIncremental.
+     */
+    int m_castOffHeight;
 };
 
 } // namespace vrv
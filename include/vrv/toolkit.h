@@ -8,6 +8,7 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <set>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -17,6 +18,10 @@
 
 //----------------------------------------------------------------------------
 
+namespace jsonxx {
+class Object;
+}
+
 namespace vrv {
 
 class EditorToolkit;
@@ -35,20 +40,32 @@ enum FileFormat {
     MUSEDATAHUM,
     ESAC,
     MIDI,
-    TIMEMAP
+    TIMEMAP,
+    SVGFILE
 };
 
 //----------------------------------------------------------------------------
 // Toolkit
 //----------------------------------------------------------------------------
 
+/**
+ * This class is the main entry point of the library.
+ * Each instance has its own document, options and resources (path and fonts), so several
+ * instances can be used in parallel from different threads. An instance itself is not
+ * thread-safe and must be used by only one thread at a time.
+ * Resources::SetDefaultPath and DisableLog are global and should be called before any thread
+ * is started. The humlib library used for the Humdrum input and the conversions to Humdrum was
+ * not audited for thread-safety: LoadData holds a lock from the conversion until the input is
+ * deleted, so these loads are serialized, and using HumdrumInput outside a Toolkit is not safe.
+ * The stress test is the parallel-toolkits mode of tools/benchmark.cpp.
+ */
 class Toolkit {
 public:
     /**
      * @name Constructors and destructors
      */
     ///@{
-    /** If initFont is set to false, Resources::InitFonts will have to be called explicitely */
+    /** If initFont is set to false, Toolkit::SetResourcePath will have to be called explicitely */
     Toolkit(bool initFont = true);
     virtual ~Toolkit();
     ///@}
@@ -60,10 +77,18 @@ public:
     Options *GetOptions() { return m_options; }
 
     /**
-     * Set the resource path. To be called if the constructor had initFont=false.
-     * This needs refactoring.
+     * @name Getter and setter for the resource path of the toolkit.
+     * Setting it also (re-)loads the fonts. To be called if the constructor had initFont=false.
      */
+    ///@{
+    std::string GetResourcePath() const { return m_doc.GetResources().GetPath(); }
     bool SetResourcePath(const std::string &path);
+    ///@}
+
+    /**
+     * Select the music font of the toolkit (e.g., "Bravura").
+     */
+    bool SetFont(const std::string &fontName);
 
     /**
      * Load a file with the specified type.
@@ -124,6 +149,19 @@ public:
      */
     void ResetLogBuffer();
 
+    /**
+     * Returns the profiling information as a JSON string.
+     * It gives the wall time (in ms) and the number of calls of the toolkit methods, and for each pass run on the
+     * document the wall time, the number of runs, the number of objects visited and the number of functor calls.
+     * Times are inclusive. Nothing is recorded unless the profile option is set.
+     */
+    std::string GetProfile();
+
+    /**
+     * Resets the profiling information.
+     */
+    void ResetProfile();
+
     /**
      * Render the page to the deviceContext.
      * Page number is 1-based.
@@ -182,6 +220,12 @@ public:
      */
     std::string GetElementsAtTime(int millisec);
 
+    /**
+     * Returns an array with the IDs of the elements being played for every step between two times.
+     * Each object of the array is the one GetElementsAtTime would return with the time added.
+     */
+    std::string GetElementsAtTimes(int startMillisec, int endMillisec, int stepMillisec);
+
     /**
      * Get the MEI as a string.
      * Get all the pages unless a page number (1-based) is specified
@@ -207,8 +251,10 @@ public:
      * Redo the layout of the loaded data.
      * This can be called once the rendering option were changed,
      * For example with a new page (sceen) height or a new zoom level.
+     * With incremental, only the systems with measures changed by editor actions are re-laid out, which expects the
+     * rendering options to be unchanged since the previous layout.
      */
-    void RedoLayout();
+    void RedoLayout(bool incremental = false);
 
     /**
      * Redo the layout of the pitch postitions of the current drawing page.
@@ -258,6 +304,7 @@ public:
     /**
      * @name Get the output file format (defined as FileFormat)
      * The SetOutputTo with FileFormat does not perform any validation
+     * When the output is set to svg, midi or timemap, the unsupported MEI attributes are not preserved on import.
      */
     ///@{
     bool SetOutputTo(std::string const &outputTo);
@@ -300,6 +347,22 @@ private:
     bool IsUTF16(const std::string &filename);
     bool LoadUTF16File(const std::string &filename);
 
+    /**
+     * Fill the JSON object with the IDs of the elements being played at the given time and their page.
+     */
+    void GetElementsAtTime(int millisec, jsonxx::Object &o);
+
+    /**
+     * Return the profiler if the profile option is set, NULL otherwise
+     */
+    Profiler *GetProfiler() { return (m_options->m_profile.GetValue()) ? &m_profiler : NULL; }
+
+    /**
+     * Cast off the document if LoadData deferred it because the output was MIDI or a timemap.
+     * Called by the methods accessing the pages, so the page count and the pages are the same as with another output.
+     */
+    void CastOffDeferredDoc();
+
 public:
     //
 private:
@@ -309,8 +372,11 @@ private:
     FileFormat m_inputFrom;
     FileFormat m_outputTo;
     bool m_scoreBasedMei;
+    /** The cast off deferred by LoadData, with the encoded breaks or not (see Toolkit::CastOffDeferredDoc) */
+    bool m_castOffDeferred;
+    bool m_castOffEncoding;
 
-    static char *m_humdrumBuffer;
+    char *m_humdrumBuffer;
 
     Options *m_options;
 
@@ -320,6 +386,14 @@ private:
     char *m_cString;
 
     EditorToolkit *m_editorToolkit;
+
+    Profiler m_profiler;
+
+    /**
+     * The ids of the <defs> already written in the SVG output (see the svgSharedDefs option).
+     * Reset when the data, the options, or the resources change.
+     */
+    std::set<std::string> m_svgSharedDefs;
 };
 
 } // namespace vrv
@@ -179,8 +179,8 @@ public:
      * @name Adds a bounding box to the array of overflowing objects above or below
      */
     ///@{
-    void AddBBoxAbove(BoundingBox *box) { m_overflowAboveBBoxes.push_back(box); }
-    void AddBBoxBelow(BoundingBox *box) { m_overflowBelowBBoxes.push_back(box); }
+    void AddBBoxAbove(BoundingBox *box) { m_overflowAboveBBoxes.Add(box); }
+    void AddBBoxBelow(BoundingBox *box) { m_overflowBelowBBoxes.Add(box); }
     ///@}
 
     /**
@@ -272,9 +272,10 @@ private:
 
     /**
      * The list of overflowing bounding boxes (e.g, LayerElement or FloatingPositioner)
+     * They are indexed horizontally for looking up the ones overlapping a given box
      */
-    std::vector<BoundingBox *> m_overflowAboveBBoxes;
-    std::vector<BoundingBox *> m_overflowBelowBBoxes;
+    HorizontalBBoxIndex m_overflowAboveBBoxes;
+    HorizontalBBoxIndex m_overflowBelowBBoxes;
 };
 
 } // namespace vrv
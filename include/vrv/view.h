@@ -577,10 +577,10 @@ protected:
     ScoreDef m_drawingScoreDef;
 
 private:
-    /** @name Internal values for storing temporary values for ligatures */
+    /** @name Internal values for storing temporary values for ligatures (per thread) */
     ///@{
-    static int s_drawingLigX[2], s_drawingLigY[2];
-    static bool s_drawingLigObliqua;
+    static thread_local int s_drawingLigX[2], s_drawingLigY[2];
+    static thread_local bool s_drawingLigObliqua;
     ///@}
 };
 
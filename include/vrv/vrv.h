@@ -10,6 +10,7 @@
 
 #include <cstring>
 #include <map>
+#include <memory>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string>
@@ -21,6 +22,10 @@
 #include <time.h>
 #endif
 
+namespace pugi {
+class xml_document;
+}
+
 namespace vrv {
 
 class Glyph;
@@ -39,10 +44,11 @@ void DisableLog();
 
 /**
  * Member and functions specific to emscripten loging that uses a vector of string to buffer the logs.
+ * The buffer is per thread.
  */
 #ifdef __EMSCRIPTEN__
 enum consoleLogLevel { CONSOLE_LOG = 0, CONSOLE_INFO, CONSOLE_WARN, CONSOLE_ERROR };
-extern std::vector<std::string> logBuffer;
+extern thread_local std::vector<std::string> logBuffer;
 bool LogBufferContains(const std::string &s);
 void AppendLogBuffer(bool checkDuplicate, std::string message, consoleLogLevel level);
 #endif
@@ -92,14 +98,15 @@ std::string GetFilename(std::string fullpath);
 std::string GetVersion();
 
 /**
- *
+ * Global flag for disabling the logging.
+ * It is shared by all threads and is expected to be set only once (see DisableLog)
  */
 extern bool noLog;
 
 /**
  * Functions for logging in milliseconds the elapsed time of an
  * operation (for debugging purposes).
- * LogElapsedTimeStart needs to be called before the operation
+ * LogElapsedTimeStart needs to be called before the operation (in the same thread)
  *
  * Ex:
  *
@@ -107,56 +114,243 @@ extern bool noLog;
  * ... Do something
  * LogElapsedTimeEnd("name of the operation");
  */
-extern struct timeval start;
+extern thread_local struct timeval start;
 void LogElapsedTimeStart();
 void LogElapsedTimeEnd(const char *msg = "unspecified operation");
 
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+/**
+ * This class records the wall time spent in the Toolkit entry points and in the Object::Process passes.
+ * A profiler becomes the current one of the calling thread with a ProfilerScope. Passes processed without
+ * a current profiler are not recorded. Times are inclusive, i.e., the time of a pass includes the time of
+ * the passes it runs itself, and the time of an entry point the one of the entry points it calls.
+ */
+class Profiler {
+public:
+    /**
+     * The values recorded for an entry point or a pass
+     */
+    struct Entry {
+        /** The number of times it was run */
+        int m_count = 0;
+        /** The wall time in milliseconds */
+        double m_time = 0.0;
+        /** The number of objects visited (passes only) */
+        long m_visits = 0;
+        /** The number of functor calls, including the end functor (passes only) */
+        long m_calls = 0;
+    };
+
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    Profiler() {}
+    virtual ~Profiler() {}
+    void Reset();
+    ///@}
+
+    /**
+     * @name Record an entry point or a pass
+     */
+    ///@{
+    void AddEntryPoint(const std::string &name, double time);
+    void AddPass(const std::string &name, double time, long visits, long calls);
+    ///@}
+
+    /**
+     * @name Getters for the recorded values (by name)
+     */
+    ///@{
+    const std::map<std::string, Entry> &GetEntryPoints() const { return m_entryPoints; }
+    const std::map<std::string, Entry> &GetPasses() const { return m_passes; }
+    ///@}
+
+    /**
+     * Return the current profiler for the calling thread (NULL if none)
+     */
+    static Profiler *GetCurrent() { return s_current; }
+
+    /**
+     * Return a monotonic time in milliseconds
+     */
+    static double GetTime();
+
+private:
+    //
+public:
+    //
+private:
+    std::map<std::string, Entry> m_entryPoints;
+    std::map<std::string, Entry> m_passes;
+
+    /** The current profiler of the thread */
+    static thread_local Profiler *s_current;
+
+    friend class ProfilerScope;
+};
+
+//----------------------------------------------------------------------------
+// ProfilerScope
+//----------------------------------------------------------------------------
+
+/**
+ * This class makes a profiler the current one of the thread for its lifetime and records it as an entry point.
+ * Nothing is done when the profiler is NULL.
+ */
+class ProfilerScope {
+public:
+    ProfilerScope(Profiler *profiler, const std::string &name);
+    virtual ~ProfilerScope();
+
+private:
+    //
+public:
+    //
+private:
+    Profiler *m_profiler;
+    Profiler *m_previous;
+    std::string m_name;
+    double m_start;
+};
+
 /**
  * Method that simply checks if the Object is not NULL
  * Also asserts it for stopping in debug mode
  */
 bool Check(Object *object);
 
+/** The range of the SMuFL codes (the Private Use Area of the Unicode Basic Multilingual Plane) */
+#define SMUFL_FIRST_CODE 0xE000
+#define SMUFL_LAST_CODE 0xF8FF
+
 //----------------------------------------------------------------------------
 // Resources
 //----------------------------------------------------------------------------
 
 /**
- * This class provides static resource values.
- * The default values can be changed by setters.
+ * This class provides the resource values and the glyphs of the fonts.
+ * Each Doc owns its own instance, which makes it possible to have several documents
+ * (or toolkits) with different resource paths and fonts working in parallel.
+ * The glyph tables loaded from the resource directory are immutable and shared by
+ * all instances (each font is loaded only once per process).
+ * The default path is static and should be set before any instance is used.
  */
 
 class Resources {
 public:
+    /** A table of glyphs as loaded from a font directory */
+    typedef std::map<wchar_t, Glyph> GlyphTable;
+    /** The glyphs of the current font, pointing to the shared glyph tables */
+    typedef std::map<wchar_t, const Glyph *> GlyphMap;
+
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    Resources();
+    virtual ~Resources();
+    ///@}
+
     /**
-     * @name Setters and getters for static environment variables
+     * @name Setters and getters for the default resource path used by all instances without a path
+     */
+    ///@{
+    static std::string GetDefaultPath() { return s_defaultPath; }
+    static void SetDefaultPath(const std::string &path) { s_defaultPath = path; }
+    ///@}
+
+    /**
+     * @name Setters and getters for the resources of the instance
      */
     ///@{
     /** Resource path */
-    static std::string GetPath() { return m_path; }
-    static void SetPath(std::string path) { m_path = path; }
+    std::string GetPath() const { return (m_path.empty()) ? s_defaultPath : m_path; }
+    void SetPath(const std::string &path) { m_path = path; }
     /** Init the SMufL music and text fonts */
-    static bool InitFonts();
+    bool InitFonts();
     /** Init the text font (bounding boxes and ASCII only) */
-    static bool InitTextFont(std::string fontName);
+    bool InitTextFont(const std::string &fontName);
     /** Select a particular font */
-    static bool SetFont(std::string fontName);
+    bool SetFont(const std::string &fontName);
     /** Returns the glyph (if exists) for the current SMuFL font */
-    static Glyph *GetGlyph(wchar_t smuflCode);
+    const Glyph *GetGlyph(wchar_t smuflCode) const;
     /** Returns the glyph (if exists) for the text font (bounding box and ASCII only) */
-    static Glyph *GetTextGlyph(wchar_t code);
+    const Glyph *GetTextGlyph(wchar_t code) const;
+    /**
+     * Returns the number of codes indexed from SMUFL_FIRST_CODE for the current SMuFL font.
+     * All the glyphs of the font with a code in the SMuFL range are within these codes.
+     */
+    int GetSmuflCodeCount() const { return (int)m_smuflGlyphs.size(); }
+    /** Returns a version of the fonts incremented each time they change (e.g., for invalidating scaled metrics) */
+    int GetFontVersion() const { return m_fontVersion; }
+    /**
+     * Returns the parsed woff.xml file (VerovioText font embedded in the SVG output).
+     * The file is loaded only once per resource path and shared by all instances.
+     */
+    std::shared_ptr<const pugi::xml_document> GetWoffDocument() const;
     ///@}
 
+    /**
+     * Write the binary bundle of a font (<fontName>.bin) from its XML files in the resource directory.
+     * When present, the bundle is loaded in one read instead of the XML files of the glyphs and of the bounding boxes.
+     * It has to be generated again when the XML files change (see the fontbundles target). A bundle older than the
+     * bounding box file or the font directory (glyphs added or removed) is ignored and the XML files are loaded. The
+     * glyph files are not checked one by one, so a bundle has to be generated again after editing a glyph in place.
+     */
+    static bool WriteFontBundle(const std::string &path, const std::string &fontName);
+
 private:
-    static bool LoadFont(std::string fontName);
+    bool LoadFont(const std::string &fontName);
+
+    /**
+     * Fill the dense tables of the glyphs from the maps once the fonts have changed
+     */
+    void IndexGlyphs();
+
+    /**
+     * @name Load a glyph table from the resource directory, or get it from the shared cache
+     * Return an empty pointer if the font cannot be loaded.
+     */
+    ///@{
+    static std::shared_ptr<const GlyphTable> GetFontTable(const std::string &path, const std::string &fontName);
+    static std::shared_ptr<const GlyphTable> GetTextFontTable(const std::string &path, const std::string &fontName);
+    ///@}
+
+    /**
+     * @name Load a glyph table from the XML files of the font or from its binary bundle (if any)
+     */
+    ///@{
+    static std::shared_ptr<GlyphTable> LoadFontXML(const std::string &path, const std::string &fontName);
+    static std::shared_ptr<GlyphTable> LoadFontBundle(const std::string &path, const std::string &fontName);
+    ///@}
 
+public:
+    //
 private:
+    /** The default path to the resources directory */
+    static std::string s_defaultPath;
     /** The path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
-    static std::string m_path;
+    std::string m_path;
     /** The loaded SMuFL font */
-    static std::map<wchar_t, Glyph> m_font;
+    GlyphMap m_font;
     /** A text font used for bounding box calculations */
-    static std::map<wchar_t, Glyph> m_textFont;
+    GlyphMap m_textFont;
+    /**
+     * @name Dense tables of the glyphs, for the SMuFL range (indexed from SMUFL_FIRST_CODE) and the ASCII range of
+     * the text font, with NULL for the codes without a glyph. The lookup in the maps is too slow for the layout.
+     */
+    ///@{
+    std::vector<const Glyph *> m_smuflGlyphs;
+    std::vector<const Glyph *> m_asciiTextGlyphs;
+    ///@}
+    /** The version of the fonts */
+    int m_fontVersion;
+    /** The shared glyph tables used by m_font and m_textFont */
+    std::vector<std::shared_ptr<const GlyphTable>> m_tables;
 };
 
 //----------------------------------------------------------------------------
@@ -11,6 +11,10 @@
 #include <algorithm>
 #include <list>
 #include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -256,6 +260,7 @@ class BoundingBox;
 class Comparison;
 class CurveSpannedElement;
 class FloatingPositioner;
+class FunctorPass;
 class GraceAligner;
 class InterfaceComparison;
 class LayerElement;
@@ -277,6 +282,8 @@ typedef std::vector<Object *> ArrayOfObjects;
 
 typedef std::vector<Comparison *> ArrayOfComparisons;
 
+typedef std::vector<FunctorPass *> ArrayOfFunctorPasses;
+
 typedef std::vector<Note *> ChordCluster;
 
 typedef std::vector<std::tuple<Alignment *, Alignment *, int> > ArrayOfAdjustmentTuples;
@@ -332,6 +339,36 @@ struct IntTree {
 
 typedef std::map<int, IntTree> IntTree_t;
 
+/**
+ * The key of an object in the uuid index of the Doc (see Object::GetUuidKey).
+ * A uuid in the format of the generated ones (the class prefix and 16 digits) is the interned prefix and the number,
+ * so the key of an object storing its uuid as a number is made without formatting the uuid. Any other uuid is kept as
+ * a string.
+ */
+struct UuidKey {
+    const std::string *m_prefix = NULL;
+    int m_nr = -1;
+    std::string m_uuid;
+
+    bool operator==(const UuidKey &key) const
+    {
+        return (m_prefix == key.m_prefix) && (m_nr == key.m_nr) && (m_uuid == key.m_uuid);
+    }
+    bool operator!=(const UuidKey &key) const { return !(*this == key); }
+};
+
+struct UuidKeyHash {
+    size_t operator()(const UuidKey &key) const
+    {
+        if (key.m_prefix) return std::hash<const std::string *>()(key.m_prefix) ^ std::hash<int>()(key.m_nr);
+        return std::hash<std::string>()(key.m_uuid);
+    }
+};
+
+typedef std::unordered_map<UuidKey, Object *, UuidKeyHash> MapOfUuidObjects;
+
+typedef std::unordered_set<UuidKey, UuidKeyHash> SetOfUuidKeys;
+
 /**
  * This is the alternate way for representing map of maps. With this solution,
  * we can easily have different types of key (attribute) at each level. We could
@@ -352,6 +389,18 @@ typedef std::map<int, LayerN_VerserN_t> StaffN_LayerN_VerseN_t;
 
 #define durRound(dur) round(dur *pow(10, 8)) / pow(10, 8)
 
+/**
+ * Cast for downcasting an object (or functor parameters, or a comparison) whose class is known, for example after
+ * checking its ClassId with Object::Is. In debug builds it is a dynamic_cast, so the assert that is expected to follow
+ * it checks the class. In release builds it is a static_cast and does not walk the class hierarchy.
+ * Cross-casts to att classes or interfaces have to use vrv_cross_cast (see object.h).
+ */
+#ifdef NDEBUG
+#define vrv_cast static_cast
+#else
+#define vrv_cast dynamic_cast
+#endif
+
 /**
  * Codes returned by Functors.
  * Default is FUNCTOR_CONTINUE.
@@ -49,19 +49,26 @@ std::string AttConverter::AccidentalGesturalToStr(data_ACCIDENTAL_GESTURAL data)
     return value;
 }
 
-data_ACCIDENTAL_GESTURAL AttConverter::StrToAccidentalGestural(std::string value, bool logWarning) const
-{
-    if (value == "s") return ACCIDENTAL_GESTURAL_s;
-    if (value == "f") return ACCIDENTAL_GESTURAL_f;
-    if (value == "ss") return ACCIDENTAL_GESTURAL_ss;
-    if (value == "ff") return ACCIDENTAL_GESTURAL_ff;
-    if (value == "n") return ACCIDENTAL_GESTURAL_n;
-    if (value == "su") return ACCIDENTAL_GESTURAL_su;
-    if (value == "sd") return ACCIDENTAL_GESTURAL_sd;
-    if (value == "fu") return ACCIDENTAL_GESTURAL_fu;
-    if (value == "fd") return ACCIDENTAL_GESTURAL_fd;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ACCIDENTAL.GESTURAL", value.c_str());
+data_ACCIDENTAL_GESTURAL AttConverter::StrToAccidentalGestural(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 1:
+            if (value == "s") return ACCIDENTAL_GESTURAL_s;
+            if (value == "f") return ACCIDENTAL_GESTURAL_f;
+            if (value == "n") return ACCIDENTAL_GESTURAL_n;
+            break;
+        case 2:
+            if (value == "ss") return ACCIDENTAL_GESTURAL_ss;
+            if (value == "ff") return ACCIDENTAL_GESTURAL_ff;
+            if (value == "su") return ACCIDENTAL_GESTURAL_su;
+            if (value == "sd") return ACCIDENTAL_GESTURAL_sd;
+            if (value == "fu") return ACCIDENTAL_GESTURAL_fu;
+            if (value == "fd") return ACCIDENTAL_GESTURAL_fd;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.ACCIDENTAL.GESTURAL", std::string(value).c_str());
     return ACCIDENTAL_GESTURAL_NONE;
 }
 
@@ -99,32 +106,41 @@ std::string AttConverter::AccidentalWrittenToStr(data_ACCIDENTAL_WRITTEN data) c
     return value;
 }
 
-data_ACCIDENTAL_WRITTEN AttConverter::StrToAccidentalWritten(std::string value, bool logWarning) const
+data_ACCIDENTAL_WRITTEN AttConverter::StrToAccidentalWritten(std::string_view value, bool logWarning) const
 {
-    if (value == "s") return ACCIDENTAL_WRITTEN_s;
-    if (value == "f") return ACCIDENTAL_WRITTEN_f;
-    if (value == "ss") return ACCIDENTAL_WRITTEN_ss;
-    if (value == "x") return ACCIDENTAL_WRITTEN_x;
-    if (value == "ff") return ACCIDENTAL_WRITTEN_ff;
-    if (value == "xs") return ACCIDENTAL_WRITTEN_xs;
-    if (value == "sx") return ACCIDENTAL_WRITTEN_sx;
-    if (value == "ts") return ACCIDENTAL_WRITTEN_ts;
-    if (value == "tf") return ACCIDENTAL_WRITTEN_tf;
-    if (value == "n") return ACCIDENTAL_WRITTEN_n;
-    if (value == "nf") return ACCIDENTAL_WRITTEN_nf;
-    if (value == "ns") return ACCIDENTAL_WRITTEN_ns;
-    if (value == "su") return ACCIDENTAL_WRITTEN_su;
-    if (value == "sd") return ACCIDENTAL_WRITTEN_sd;
-    if (value == "fu") return ACCIDENTAL_WRITTEN_fu;
-    if (value == "fd") return ACCIDENTAL_WRITTEN_fd;
-    if (value == "nu") return ACCIDENTAL_WRITTEN_nu;
-    if (value == "nd") return ACCIDENTAL_WRITTEN_nd;
-    if (value == "1qf") return ACCIDENTAL_WRITTEN_1qf;
-    if (value == "3qf") return ACCIDENTAL_WRITTEN_3qf;
-    if (value == "1qs") return ACCIDENTAL_WRITTEN_1qs;
-    if (value == "3qs") return ACCIDENTAL_WRITTEN_3qs;
+    switch (value.size()) {
+        case 1:
+            if (value == "s") return ACCIDENTAL_WRITTEN_s;
+            if (value == "f") return ACCIDENTAL_WRITTEN_f;
+            if (value == "x") return ACCIDENTAL_WRITTEN_x;
+            if (value == "n") return ACCIDENTAL_WRITTEN_n;
+            break;
+        case 2:
+            if (value == "ss") return ACCIDENTAL_WRITTEN_ss;
+            if (value == "ff") return ACCIDENTAL_WRITTEN_ff;
+            if (value == "xs") return ACCIDENTAL_WRITTEN_xs;
+            if (value == "sx") return ACCIDENTAL_WRITTEN_sx;
+            if (value == "ts") return ACCIDENTAL_WRITTEN_ts;
+            if (value == "tf") return ACCIDENTAL_WRITTEN_tf;
+            if (value == "nf") return ACCIDENTAL_WRITTEN_nf;
+            if (value == "ns") return ACCIDENTAL_WRITTEN_ns;
+            if (value == "su") return ACCIDENTAL_WRITTEN_su;
+            if (value == "sd") return ACCIDENTAL_WRITTEN_sd;
+            if (value == "fu") return ACCIDENTAL_WRITTEN_fu;
+            if (value == "fd") return ACCIDENTAL_WRITTEN_fd;
+            if (value == "nu") return ACCIDENTAL_WRITTEN_nu;
+            if (value == "nd") return ACCIDENTAL_WRITTEN_nd;
+            break;
+        case 3:
+            if (value == "1qf") return ACCIDENTAL_WRITTEN_1qf;
+            if (value == "3qf") return ACCIDENTAL_WRITTEN_3qf;
+            if (value == "1qs") return ACCIDENTAL_WRITTEN_1qs;
+            if (value == "3qs") return ACCIDENTAL_WRITTEN_3qs;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ACCIDENTAL.WRITTEN", value.c_str());
+        LogWarning("Unsupported value '%s' for data.ACCIDENTAL.WRITTEN", std::string(value).c_str());
     return ACCIDENTAL_WRITTEN_NONE;
 }
 
@@ -173,43 +189,62 @@ std::string AttConverter::ArticulationToStr(data_ARTICULATION data) const
     return value;
 }
 
-data_ARTICULATION AttConverter::StrToArticulation(std::string value, bool logWarning) const
-{
-    if (value == "acc") return ARTICULATION_acc;
-    if (value == "stacc") return ARTICULATION_stacc;
-    if (value == "ten") return ARTICULATION_ten;
-    if (value == "stacciss") return ARTICULATION_stacciss;
-    if (value == "marc") return ARTICULATION_marc;
-    if (value == "spicc") return ARTICULATION_spicc;
-    if (value == "doit") return ARTICULATION_doit;
-    if (value == "scoop") return ARTICULATION_scoop;
-    if (value == "rip") return ARTICULATION_rip;
-    if (value == "plop") return ARTICULATION_plop;
-    if (value == "fall") return ARTICULATION_fall;
-    if (value == "longfall") return ARTICULATION_longfall;
-    if (value == "bend") return ARTICULATION_bend;
-    if (value == "flip") return ARTICULATION_flip;
-    if (value == "smear") return ARTICULATION_smear;
-    if (value == "shake") return ARTICULATION_shake;
-    if (value == "dnbow") return ARTICULATION_dnbow;
-    if (value == "upbow") return ARTICULATION_upbow;
-    if (value == "harm") return ARTICULATION_harm;
-    if (value == "snap") return ARTICULATION_snap;
-    if (value == "fingernail") return ARTICULATION_fingernail;
-    if (value == "damp") return ARTICULATION_damp;
-    if (value == "dampall") return ARTICULATION_dampall;
-    if (value == "open") return ARTICULATION_open;
-    if (value == "stop") return ARTICULATION_stop;
-    if (value == "dbltongue") return ARTICULATION_dbltongue;
-    if (value == "trpltongue") return ARTICULATION_trpltongue;
-    if (value == "heel") return ARTICULATION_heel;
-    if (value == "toe") return ARTICULATION_toe;
-    if (value == "tap") return ARTICULATION_tap;
-    if (value == "lhpizz") return ARTICULATION_lhpizz;
-    if (value == "dot") return ARTICULATION_dot;
-    if (value == "stroke") return ARTICULATION_stroke;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ARTICULATION", value.c_str());
+data_ARTICULATION AttConverter::StrToArticulation(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 3:
+            if (value == "acc") return ARTICULATION_acc;
+            if (value == "ten") return ARTICULATION_ten;
+            if (value == "rip") return ARTICULATION_rip;
+            if (value == "toe") return ARTICULATION_toe;
+            if (value == "tap") return ARTICULATION_tap;
+            if (value == "dot") return ARTICULATION_dot;
+            break;
+        case 4:
+            if (value == "marc") return ARTICULATION_marc;
+            if (value == "doit") return ARTICULATION_doit;
+            if (value == "plop") return ARTICULATION_plop;
+            if (value == "fall") return ARTICULATION_fall;
+            if (value == "bend") return ARTICULATION_bend;
+            if (value == "flip") return ARTICULATION_flip;
+            if (value == "harm") return ARTICULATION_harm;
+            if (value == "snap") return ARTICULATION_snap;
+            if (value == "damp") return ARTICULATION_damp;
+            if (value == "open") return ARTICULATION_open;
+            if (value == "stop") return ARTICULATION_stop;
+            if (value == "heel") return ARTICULATION_heel;
+            break;
+        case 5:
+            if (value == "stacc") return ARTICULATION_stacc;
+            if (value == "spicc") return ARTICULATION_spicc;
+            if (value == "scoop") return ARTICULATION_scoop;
+            if (value == "smear") return ARTICULATION_smear;
+            if (value == "shake") return ARTICULATION_shake;
+            if (value == "dnbow") return ARTICULATION_dnbow;
+            if (value == "upbow") return ARTICULATION_upbow;
+            break;
+        case 6:
+            if (value == "lhpizz") return ARTICULATION_lhpizz;
+            if (value == "stroke") return ARTICULATION_stroke;
+            break;
+        case 7:
+            if (value == "dampall") return ARTICULATION_dampall;
+            break;
+        case 8:
+            if (value == "stacciss") return ARTICULATION_stacciss;
+            if (value == "longfall") return ARTICULATION_longfall;
+            break;
+        case 9:
+            if (value == "dbltongue") return ARTICULATION_dbltongue;
+            break;
+        case 10:
+            if (value == "fingernail") return ARTICULATION_fingernail;
+            if (value == "trpltongue") return ARTICULATION_trpltongue;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.ARTICULATION", std::string(value).c_str());
     return ARTICULATION_NONE;
 }
 
@@ -228,13 +263,22 @@ std::string AttConverter::BarmethodToStr(data_BARMETHOD data) const
     return value;
 }
 
-data_BARMETHOD AttConverter::StrToBarmethod(std::string value, bool logWarning) const
+data_BARMETHOD AttConverter::StrToBarmethod(std::string_view value, bool logWarning) const
 {
-    if (value == "mensur") return BARMETHOD_mensur;
-    if (value == "staff") return BARMETHOD_staff;
-    if (value == "takt") return BARMETHOD_takt;
+    switch (value.size()) {
+        case 4:
+            if (value == "takt") return BARMETHOD_takt;
+            break;
+        case 5:
+            if (value == "staff") return BARMETHOD_staff;
+            break;
+        case 6:
+            if (value == "mensur") return BARMETHOD_mensur;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BARMETHOD", value.c_str());
+        LogWarning("Unsupported value '%s' for data.BARMETHOD", std::string(value).c_str());
     return BARMETHOD_NONE;
 }
 
@@ -261,21 +305,36 @@ std::string AttConverter::BarrenditionToStr(data_BARRENDITION data) const
     return value;
 }
 
-data_BARRENDITION AttConverter::StrToBarrendition(std::string value, bool logWarning) const
+data_BARRENDITION AttConverter::StrToBarrendition(std::string_view value, bool logWarning) const
 {
-    if (value == "dashed") return BARRENDITION_dashed;
-    if (value == "dotted") return BARRENDITION_dotted;
-    if (value == "dbl") return BARRENDITION_dbl;
-    if (value == "dbldashed") return BARRENDITION_dbldashed;
-    if (value == "dbldotted") return BARRENDITION_dbldotted;
-    if (value == "end") return BARRENDITION_end;
-    if (value == "invis") return BARRENDITION_invis;
-    if (value == "rptstart") return BARRENDITION_rptstart;
-    if (value == "rptboth") return BARRENDITION_rptboth;
-    if (value == "rptend") return BARRENDITION_rptend;
-    if (value == "single") return BARRENDITION_single;
+    switch (value.size()) {
+        case 3:
+            if (value == "dbl") return BARRENDITION_dbl;
+            if (value == "end") return BARRENDITION_end;
+            break;
+        case 5:
+            if (value == "invis") return BARRENDITION_invis;
+            break;
+        case 6:
+            if (value == "dashed") return BARRENDITION_dashed;
+            if (value == "dotted") return BARRENDITION_dotted;
+            if (value == "rptend") return BARRENDITION_rptend;
+            if (value == "single") return BARRENDITION_single;
+            break;
+        case 7:
+            if (value == "rptboth") return BARRENDITION_rptboth;
+            break;
+        case 8:
+            if (value == "rptstart") return BARRENDITION_rptstart;
+            break;
+        case 9:
+            if (value == "dbldashed") return BARRENDITION_dbldashed;
+            if (value == "dbldotted") return BARRENDITION_dbldotted;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BARRENDITION", value.c_str());
+        LogWarning("Unsupported value '%s' for data.BARRENDITION", std::string(value).c_str());
     return BARRENDITION_NONE;
 }
 
@@ -294,13 +353,18 @@ std::string AttConverter::BeamplaceToStr(data_BEAMPLACE data) const
     return value;
 }
 
-data_BEAMPLACE AttConverter::StrToBeamplace(std::string value, bool logWarning) const
+data_BEAMPLACE AttConverter::StrToBeamplace(std::string_view value, bool logWarning) const
 {
-    if (value == "above") return BEAMPLACE_above;
-    if (value == "below") return BEAMPLACE_below;
-    if (value == "mixed") return BEAMPLACE_mixed;
+    switch (value.size()) {
+        case 5:
+            if (value == "above") return BEAMPLACE_above;
+            if (value == "below") return BEAMPLACE_below;
+            if (value == "mixed") return BEAMPLACE_mixed;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BEAMPLACE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.BEAMPLACE", std::string(value).c_str());
     return BEAMPLACE_NONE;
 }
 
@@ -329,23 +393,40 @@ std::string AttConverter::BetypeToStr(data_BETYPE data) const
     return value;
 }
 
-data_BETYPE AttConverter::StrToBetype(std::string value, bool logWarning) const
+data_BETYPE AttConverter::StrToBetype(std::string_view value, bool logWarning) const
 {
-    if (value == "byte") return BETYPE_byte;
-    if (value == "smil") return BETYPE_smil;
-    if (value == "midi") return BETYPE_midi;
-    if (value == "mmc") return BETYPE_mmc;
-    if (value == "mtc") return BETYPE_mtc;
-    if (value == "smpte-25") return BETYPE_smpte_25;
-    if (value == "smpte-24") return BETYPE_smpte_24;
-    if (value == "smpte-df30") return BETYPE_smpte_df30;
-    if (value == "smpte-ndf30") return BETYPE_smpte_ndf30;
-    if (value == "smpte-df29.97") return BETYPE_smpte_df29_97;
-    if (value == "smpte-ndf29.97") return BETYPE_smpte_ndf29_97;
-    if (value == "tcf") return BETYPE_tcf;
-    if (value == "time") return BETYPE_time;
+    switch (value.size()) {
+        case 3:
+            if (value == "mmc") return BETYPE_mmc;
+            if (value == "mtc") return BETYPE_mtc;
+            if (value == "tcf") return BETYPE_tcf;
+            break;
+        case 4:
+            if (value == "byte") return BETYPE_byte;
+            if (value == "smil") return BETYPE_smil;
+            if (value == "midi") return BETYPE_midi;
+            if (value == "time") return BETYPE_time;
+            break;
+        case 8:
+            if (value == "smpte-25") return BETYPE_smpte_25;
+            if (value == "smpte-24") return BETYPE_smpte_24;
+            break;
+        case 10:
+            if (value == "smpte-df30") return BETYPE_smpte_df30;
+            break;
+        case 11:
+            if (value == "smpte-ndf30") return BETYPE_smpte_ndf30;
+            break;
+        case 13:
+            if (value == "smpte-df29.97") return BETYPE_smpte_df29_97;
+            break;
+        case 14:
+            if (value == "smpte-ndf29.97") return BETYPE_smpte_ndf29_97;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BETYPE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.BETYPE", std::string(value).c_str());
     return BETYPE_NONE;
 }
 
@@ -363,12 +444,19 @@ std::string AttConverter::BooleanToStr(data_BOOLEAN data) const
     return value;
 }
 
-data_BOOLEAN AttConverter::StrToBoolean(std::string value, bool logWarning) const
+data_BOOLEAN AttConverter::StrToBoolean(std::string_view value, bool logWarning) const
 {
-    if (value == "true") return BOOLEAN_true;
-    if (value == "false") return BOOLEAN_false;
+    switch (value.size()) {
+        case 4:
+            if (value == "true") return BOOLEAN_true;
+            break;
+        case 5:
+            if (value == "false") return BOOLEAN_false;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.BOOLEAN", value.c_str());
+        LogWarning("Unsupported value '%s' for data.BOOLEAN", std::string(value).c_str());
     return BOOLEAN_NONE;
 }
 
@@ -388,14 +476,25 @@ std::string AttConverter::CertaintyToStr(data_CERTAINTY data) const
     return value;
 }
 
-data_CERTAINTY AttConverter::StrToCertainty(std::string value, bool logWarning) const
+data_CERTAINTY AttConverter::StrToCertainty(std::string_view value, bool logWarning) const
 {
-    if (value == "high") return CERTAINTY_high;
-    if (value == "medium") return CERTAINTY_medium;
-    if (value == "low") return CERTAINTY_low;
-    if (value == "unknown") return CERTAINTY_unknown;
+    switch (value.size()) {
+        case 3:
+            if (value == "low") return CERTAINTY_low;
+            break;
+        case 4:
+            if (value == "high") return CERTAINTY_high;
+            break;
+        case 6:
+            if (value == "medium") return CERTAINTY_medium;
+            break;
+        case 7:
+            if (value == "unknown") return CERTAINTY_unknown;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.CERTAINTY", value.c_str());
+        LogWarning("Unsupported value '%s' for data.CERTAINTY", std::string(value).c_str());
     return CERTAINTY_NONE;
 }
 
@@ -417,16 +516,27 @@ std::string AttConverter::ClefshapeToStr(data_CLEFSHAPE data) const
     return value;
 }
 
-data_CLEFSHAPE AttConverter::StrToClefshape(std::string value, bool logWarning) const
+data_CLEFSHAPE AttConverter::StrToClefshape(std::string_view value, bool logWarning) const
 {
-    if (value == "G") return CLEFSHAPE_G;
-    if (value == "GG") return CLEFSHAPE_GG;
-    if (value == "F") return CLEFSHAPE_F;
-    if (value == "C") return CLEFSHAPE_C;
-    if (value == "perc") return CLEFSHAPE_perc;
-    if (value == "TAB") return CLEFSHAPE_TAB;
+    switch (value.size()) {
+        case 1:
+            if (value == "G") return CLEFSHAPE_G;
+            if (value == "F") return CLEFSHAPE_F;
+            if (value == "C") return CLEFSHAPE_C;
+            break;
+        case 2:
+            if (value == "GG") return CLEFSHAPE_GG;
+            break;
+        case 3:
+            if (value == "TAB") return CLEFSHAPE_TAB;
+            break;
+        case 4:
+            if (value == "perc") return CLEFSHAPE_perc;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.CLEFSHAPE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.CLEFSHAPE", std::string(value).c_str());
     return CLEFSHAPE_NONE;
 }
 
@@ -445,13 +555,20 @@ std::string AttConverter::ClusterToStr(data_CLUSTER data) const
     return value;
 }
 
-data_CLUSTER AttConverter::StrToCluster(std::string value, bool logWarning) const
+data_CLUSTER AttConverter::StrToCluster(std::string_view value, bool logWarning) const
 {
-    if (value == "white") return CLUSTER_white;
-    if (value == "black") return CLUSTER_black;
-    if (value == "chromatic") return CLUSTER_chromatic;
+    switch (value.size()) {
+        case 5:
+            if (value == "white") return CLUSTER_white;
+            if (value == "black") return CLUSTER_black;
+            break;
+        case 9:
+            if (value == "chromatic") return CLUSTER_chromatic;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.CLUSTER", value.c_str());
+        LogWarning("Unsupported value '%s' for data.CLUSTER", std::string(value).c_str());
     return CLUSTER_NONE;
 }
 
@@ -615,158 +732,193 @@ std::string AttConverter::ColornamesToStr(data_COLORNAMES data) const
     return value;
 }
 
-data_COLORNAMES AttConverter::StrToColornames(std::string value, bool logWarning) const
-{
-    if (value == "aliceblue") return COLORNAMES_aliceblue;
-    if (value == "antiquewhite") return COLORNAMES_antiquewhite;
-    if (value == "aqua") return COLORNAMES_aqua;
-    if (value == "aquamarine") return COLORNAMES_aquamarine;
-    if (value == "azure") return COLORNAMES_azure;
-    if (value == "beige") return COLORNAMES_beige;
-    if (value == "bisque") return COLORNAMES_bisque;
-    if (value == "black") return COLORNAMES_black;
-    if (value == "blanchedalmond") return COLORNAMES_blanchedalmond;
-    if (value == "blue") return COLORNAMES_blue;
-    if (value == "blueviolet") return COLORNAMES_blueviolet;
-    if (value == "brown") return COLORNAMES_brown;
-    if (value == "burlywood") return COLORNAMES_burlywood;
-    if (value == "cadetblue") return COLORNAMES_cadetblue;
-    if (value == "chartreuse") return COLORNAMES_chartreuse;
-    if (value == "chocolate") return COLORNAMES_chocolate;
-    if (value == "coral") return COLORNAMES_coral;
-    if (value == "cornflowerblue") return COLORNAMES_cornflowerblue;
-    if (value == "cornsilk") return COLORNAMES_cornsilk;
-    if (value == "crimson") return COLORNAMES_crimson;
-    if (value == "cyan") return COLORNAMES_cyan;
-    if (value == "darkblue") return COLORNAMES_darkblue;
-    if (value == "darkcyan") return COLORNAMES_darkcyan;
-    if (value == "darkgoldenrod") return COLORNAMES_darkgoldenrod;
-    if (value == "darkgray") return COLORNAMES_darkgray;
-    if (value == "darkgreen") return COLORNAMES_darkgreen;
-    if (value == "darkgrey") return COLORNAMES_darkgrey;
-    if (value == "darkkhaki") return COLORNAMES_darkkhaki;
-    if (value == "darkmagenta") return COLORNAMES_darkmagenta;
-    if (value == "darkolivegreen") return COLORNAMES_darkolivegreen;
-    if (value == "darkorange") return COLORNAMES_darkorange;
-    if (value == "darkorchid") return COLORNAMES_darkorchid;
-    if (value == "darkred") return COLORNAMES_darkred;
-    if (value == "darksalmon") return COLORNAMES_darksalmon;
-    if (value == "darkseagreen") return COLORNAMES_darkseagreen;
-    if (value == "darkslateblue") return COLORNAMES_darkslateblue;
-    if (value == "darkslategray") return COLORNAMES_darkslategray;
-    if (value == "darkslategrey") return COLORNAMES_darkslategrey;
-    if (value == "darkturquoise") return COLORNAMES_darkturquoise;
-    if (value == "darkviolet") return COLORNAMES_darkviolet;
-    if (value == "deeppink") return COLORNAMES_deeppink;
-    if (value == "deepskyblue") return COLORNAMES_deepskyblue;
-    if (value == "dimgray") return COLORNAMES_dimgray;
-    if (value == "dimgrey") return COLORNAMES_dimgrey;
-    if (value == "dodgerblue") return COLORNAMES_dodgerblue;
-    if (value == "firebrick") return COLORNAMES_firebrick;
-    if (value == "floralwhite") return COLORNAMES_floralwhite;
-    if (value == "forestgreen") return COLORNAMES_forestgreen;
-    if (value == "fuchsia") return COLORNAMES_fuchsia;
-    if (value == "gainsboro") return COLORNAMES_gainsboro;
-    if (value == "ghostwhite") return COLORNAMES_ghostwhite;
-    if (value == "gold") return COLORNAMES_gold;
-    if (value == "goldenrod") return COLORNAMES_goldenrod;
-    if (value == "gray") return COLORNAMES_gray;
-    if (value == "green") return COLORNAMES_green;
-    if (value == "greenyellow") return COLORNAMES_greenyellow;
-    if (value == "grey") return COLORNAMES_grey;
-    if (value == "honeydew") return COLORNAMES_honeydew;
-    if (value == "hotpink") return COLORNAMES_hotpink;
-    if (value == "indianred") return COLORNAMES_indianred;
-    if (value == "indigo") return COLORNAMES_indigo;
-    if (value == "ivory") return COLORNAMES_ivory;
-    if (value == "khaki") return COLORNAMES_khaki;
-    if (value == "lavender") return COLORNAMES_lavender;
-    if (value == "lavenderblush") return COLORNAMES_lavenderblush;
-    if (value == "lawngreen") return COLORNAMES_lawngreen;
-    if (value == "lemonchiffon") return COLORNAMES_lemonchiffon;
-    if (value == "lightblue") return COLORNAMES_lightblue;
-    if (value == "lightcoral") return COLORNAMES_lightcoral;
-    if (value == "lightcyan") return COLORNAMES_lightcyan;
-    if (value == "lightgoldenrodyellow") return COLORNAMES_lightgoldenrodyellow;
-    if (value == "lightgray") return COLORNAMES_lightgray;
-    if (value == "lightgreen") return COLORNAMES_lightgreen;
-    if (value == "lightgrey") return COLORNAMES_lightgrey;
-    if (value == "lightpink") return COLORNAMES_lightpink;
-    if (value == "lightsalmon") return COLORNAMES_lightsalmon;
-    if (value == "lightseagreen") return COLORNAMES_lightseagreen;
-    if (value == "lightskyblue") return COLORNAMES_lightskyblue;
-    if (value == "lightslategray") return COLORNAMES_lightslategray;
-    if (value == "lightslategrey") return COLORNAMES_lightslategrey;
-    if (value == "lightsteelblue") return COLORNAMES_lightsteelblue;
-    if (value == "lightyellow") return COLORNAMES_lightyellow;
-    if (value == "lime") return COLORNAMES_lime;
-    if (value == "limegreen") return COLORNAMES_limegreen;
-    if (value == "linen") return COLORNAMES_linen;
-    if (value == "magenta") return COLORNAMES_magenta;
-    if (value == "maroon") return COLORNAMES_maroon;
-    if (value == "mediumaquamarine") return COLORNAMES_mediumaquamarine;
-    if (value == "mediumblue") return COLORNAMES_mediumblue;
-    if (value == "mediumorchid") return COLORNAMES_mediumorchid;
-    if (value == "mediumpurple") return COLORNAMES_mediumpurple;
-    if (value == "mediumseagreen") return COLORNAMES_mediumseagreen;
-    if (value == "mediumslateblue") return COLORNAMES_mediumslateblue;
-    if (value == "mediumspringgreen") return COLORNAMES_mediumspringgreen;
-    if (value == "mediumturquoise") return COLORNAMES_mediumturquoise;
-    if (value == "mediumvioletred") return COLORNAMES_mediumvioletred;
-    if (value == "midnightblue") return COLORNAMES_midnightblue;
-    if (value == "mintcream") return COLORNAMES_mintcream;
-    if (value == "mistyrose") return COLORNAMES_mistyrose;
-    if (value == "moccasin") return COLORNAMES_moccasin;
-    if (value == "navajowhite") return COLORNAMES_navajowhite;
-    if (value == "navy") return COLORNAMES_navy;
-    if (value == "oldlace") return COLORNAMES_oldlace;
-    if (value == "olive") return COLORNAMES_olive;
-    if (value == "olivedrab") return COLORNAMES_olivedrab;
-    if (value == "orange") return COLORNAMES_orange;
-    if (value == "orangered") return COLORNAMES_orangered;
-    if (value == "orchid") return COLORNAMES_orchid;
-    if (value == "palegoldenrod") return COLORNAMES_palegoldenrod;
-    if (value == "palegreen") return COLORNAMES_palegreen;
-    if (value == "paleturquoise") return COLORNAMES_paleturquoise;
-    if (value == "palevioletred") return COLORNAMES_palevioletred;
-    if (value == "papayawhip") return COLORNAMES_papayawhip;
-    if (value == "peachpuff") return COLORNAMES_peachpuff;
-    if (value == "peru") return COLORNAMES_peru;
-    if (value == "pink") return COLORNAMES_pink;
-    if (value == "plum") return COLORNAMES_plum;
-    if (value == "powderblue") return COLORNAMES_powderblue;
-    if (value == "purple") return COLORNAMES_purple;
-    if (value == "rebeccapurple") return COLORNAMES_rebeccapurple;
-    if (value == "red") return COLORNAMES_red;
-    if (value == "rosybrown") return COLORNAMES_rosybrown;
-    if (value == "royalblue") return COLORNAMES_royalblue;
-    if (value == "saddlebrown") return COLORNAMES_saddlebrown;
-    if (value == "salmon") return COLORNAMES_salmon;
-    if (value == "sandybrown") return COLORNAMES_sandybrown;
-    if (value == "seagreen") return COLORNAMES_seagreen;
-    if (value == "seashell") return COLORNAMES_seashell;
-    if (value == "sienna") return COLORNAMES_sienna;
-    if (value == "silver") return COLORNAMES_silver;
-    if (value == "skyblue") return COLORNAMES_skyblue;
-    if (value == "slateblue") return COLORNAMES_slateblue;
-    if (value == "slategray") return COLORNAMES_slategray;
-    if (value == "slategrey") return COLORNAMES_slategrey;
-    if (value == "snow") return COLORNAMES_snow;
-    if (value == "springgreen") return COLORNAMES_springgreen;
-    if (value == "steelblue") return COLORNAMES_steelblue;
-    if (value == "tan") return COLORNAMES_tan;
-    if (value == "teal") return COLORNAMES_teal;
-    if (value == "thistle") return COLORNAMES_thistle;
-    if (value == "tomato") return COLORNAMES_tomato;
-    if (value == "turquoise") return COLORNAMES_turquoise;
-    if (value == "violet") return COLORNAMES_violet;
-    if (value == "wheat") return COLORNAMES_wheat;
-    if (value == "white") return COLORNAMES_white;
-    if (value == "whitesmoke") return COLORNAMES_whitesmoke;
-    if (value == "yellow") return COLORNAMES_yellow;
-    if (value == "yellowgreen") return COLORNAMES_yellowgreen;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.COLORNAMES", value.c_str());
+data_COLORNAMES AttConverter::StrToColornames(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 3:
+            if (value == "red") return COLORNAMES_red;
+            if (value == "tan") return COLORNAMES_tan;
+            break;
+        case 4:
+            if (value == "aqua") return COLORNAMES_aqua;
+            if (value == "blue") return COLORNAMES_blue;
+            if (value == "cyan") return COLORNAMES_cyan;
+            if (value == "gold") return COLORNAMES_gold;
+            if (value == "gray") return COLORNAMES_gray;
+            if (value == "grey") return COLORNAMES_grey;
+            if (value == "lime") return COLORNAMES_lime;
+            if (value == "navy") return COLORNAMES_navy;
+            if (value == "peru") return COLORNAMES_peru;
+            if (value == "pink") return COLORNAMES_pink;
+            if (value == "plum") return COLORNAMES_plum;
+            if (value == "snow") return COLORNAMES_snow;
+            if (value == "teal") return COLORNAMES_teal;
+            break;
+        case 5:
+            if (value == "azure") return COLORNAMES_azure;
+            if (value == "beige") return COLORNAMES_beige;
+            if (value == "black") return COLORNAMES_black;
+            if (value == "brown") return COLORNAMES_brown;
+            if (value == "coral") return COLORNAMES_coral;
+            if (value == "green") return COLORNAMES_green;
+            if (value == "ivory") return COLORNAMES_ivory;
+            if (value == "khaki") return COLORNAMES_khaki;
+            if (value == "linen") return COLORNAMES_linen;
+            if (value == "olive") return COLORNAMES_olive;
+            if (value == "wheat") return COLORNAMES_wheat;
+            if (value == "white") return COLORNAMES_white;
+            break;
+        case 6:
+            if (value == "bisque") return COLORNAMES_bisque;
+            if (value == "indigo") return COLORNAMES_indigo;
+            if (value == "maroon") return COLORNAMES_maroon;
+            if (value == "orange") return COLORNAMES_orange;
+            if (value == "orchid") return COLORNAMES_orchid;
+            if (value == "purple") return COLORNAMES_purple;
+            if (value == "salmon") return COLORNAMES_salmon;
+            if (value == "sienna") return COLORNAMES_sienna;
+            if (value == "silver") return COLORNAMES_silver;
+            if (value == "tomato") return COLORNAMES_tomato;
+            if (value == "violet") return COLORNAMES_violet;
+            if (value == "yellow") return COLORNAMES_yellow;
+            break;
+        case 7:
+            if (value == "crimson") return COLORNAMES_crimson;
+            if (value == "darkred") return COLORNAMES_darkred;
+            if (value == "dimgray") return COLORNAMES_dimgray;
+            if (value == "dimgrey") return COLORNAMES_dimgrey;
+            if (value == "fuchsia") return COLORNAMES_fuchsia;
+            if (value == "hotpink") return COLORNAMES_hotpink;
+            if (value == "magenta") return COLORNAMES_magenta;
+            if (value == "oldlace") return COLORNAMES_oldlace;
+            if (value == "skyblue") return COLORNAMES_skyblue;
+            if (value == "thistle") return COLORNAMES_thistle;
+            break;
+        case 8:
+            if (value == "cornsilk") return COLORNAMES_cornsilk;
+            if (value == "darkblue") return COLORNAMES_darkblue;
+            if (value == "darkcyan") return COLORNAMES_darkcyan;
+            if (value == "darkgray") return COLORNAMES_darkgray;
+            if (value == "darkgrey") return COLORNAMES_darkgrey;
+            if (value == "deeppink") return COLORNAMES_deeppink;
+            if (value == "honeydew") return COLORNAMES_honeydew;
+            if (value == "lavender") return COLORNAMES_lavender;
+            if (value == "moccasin") return COLORNAMES_moccasin;
+            if (value == "seagreen") return COLORNAMES_seagreen;
+            if (value == "seashell") return COLORNAMES_seashell;
+            break;
+        case 9:
+            if (value == "aliceblue") return COLORNAMES_aliceblue;
+            if (value == "burlywood") return COLORNAMES_burlywood;
+            if (value == "cadetblue") return COLORNAMES_cadetblue;
+            if (value == "chocolate") return COLORNAMES_chocolate;
+            if (value == "darkgreen") return COLORNAMES_darkgreen;
+            if (value == "darkkhaki") return COLORNAMES_darkkhaki;
+            if (value == "firebrick") return COLORNAMES_firebrick;
+            if (value == "gainsboro") return COLORNAMES_gainsboro;
+            if (value == "goldenrod") return COLORNAMES_goldenrod;
+            if (value == "indianred") return COLORNAMES_indianred;
+            if (value == "lawngreen") return COLORNAMES_lawngreen;
+            if (value == "lightblue") return COLORNAMES_lightblue;
+            if (value == "lightcyan") return COLORNAMES_lightcyan;
+            if (value == "lightgray") return COLORNAMES_lightgray;
+            if (value == "lightgrey") return COLORNAMES_lightgrey;
+            if (value == "lightpink") return COLORNAMES_lightpink;
+            if (value == "limegreen") return COLORNAMES_limegreen;
+            if (value == "mintcream") return COLORNAMES_mintcream;
+            if (value == "mistyrose") return COLORNAMES_mistyrose;
+            if (value == "olivedrab") return COLORNAMES_olivedrab;
+            if (value == "orangered") return COLORNAMES_orangered;
+            if (value == "palegreen") return COLORNAMES_palegreen;
+            if (value == "peachpuff") return COLORNAMES_peachpuff;
+            if (value == "rosybrown") return COLORNAMES_rosybrown;
+            if (value == "royalblue") return COLORNAMES_royalblue;
+            if (value == "slateblue") return COLORNAMES_slateblue;
+            if (value == "slategray") return COLORNAMES_slategray;
+            if (value == "slategrey") return COLORNAMES_slategrey;
+            if (value == "steelblue") return COLORNAMES_steelblue;
+            if (value == "turquoise") return COLORNAMES_turquoise;
+            break;
+        case 10:
+            if (value == "aquamarine") return COLORNAMES_aquamarine;
+            if (value == "blueviolet") return COLORNAMES_blueviolet;
+            if (value == "chartreuse") return COLORNAMES_chartreuse;
+            if (value == "darkorange") return COLORNAMES_darkorange;
+            if (value == "darkorchid") return COLORNAMES_darkorchid;
+            if (value == "darksalmon") return COLORNAMES_darksalmon;
+            if (value == "darkviolet") return COLORNAMES_darkviolet;
+            if (value == "dodgerblue") return COLORNAMES_dodgerblue;
+            if (value == "ghostwhite") return COLORNAMES_ghostwhite;
+            if (value == "lightcoral") return COLORNAMES_lightcoral;
+            if (value == "lightgreen") return COLORNAMES_lightgreen;
+            if (value == "mediumblue") return COLORNAMES_mediumblue;
+            if (value == "papayawhip") return COLORNAMES_papayawhip;
+            if (value == "powderblue") return COLORNAMES_powderblue;
+            if (value == "sandybrown") return COLORNAMES_sandybrown;
+            if (value == "whitesmoke") return COLORNAMES_whitesmoke;
+            break;
+        case 11:
+            if (value == "darkmagenta") return COLORNAMES_darkmagenta;
+            if (value == "deepskyblue") return COLORNAMES_deepskyblue;
+            if (value == "floralwhite") return COLORNAMES_floralwhite;
+            if (value == "forestgreen") return COLORNAMES_forestgreen;
+            if (value == "greenyellow") return COLORNAMES_greenyellow;
+            if (value == "lightsalmon") return COLORNAMES_lightsalmon;
+            if (value == "lightyellow") return COLORNAMES_lightyellow;
+            if (value == "navajowhite") return COLORNAMES_navajowhite;
+            if (value == "saddlebrown") return COLORNAMES_saddlebrown;
+            if (value == "springgreen") return COLORNAMES_springgreen;
+            if (value == "yellowgreen") return COLORNAMES_yellowgreen;
+            break;
+        case 12:
+            if (value == "antiquewhite") return COLORNAMES_antiquewhite;
+            if (value == "darkseagreen") return COLORNAMES_darkseagreen;
+            if (value == "lemonchiffon") return COLORNAMES_lemonchiffon;
+            if (value == "lightskyblue") return COLORNAMES_lightskyblue;
+            if (value == "mediumorchid") return COLORNAMES_mediumorchid;
+            if (value == "mediumpurple") return COLORNAMES_mediumpurple;
+            if (value == "midnightblue") return COLORNAMES_midnightblue;
+            break;
+        case 13:
+            if (value == "darkgoldenrod") return COLORNAMES_darkgoldenrod;
+            if (value == "darkslateblue") return COLORNAMES_darkslateblue;
+            if (value == "darkslategray") return COLORNAMES_darkslategray;
+            if (value == "darkslategrey") return COLORNAMES_darkslategrey;
+            if (value == "darkturquoise") return COLORNAMES_darkturquoise;
+            if (value == "lavenderblush") return COLORNAMES_lavenderblush;
+            if (value == "lightseagreen") return COLORNAMES_lightseagreen;
+            if (value == "palegoldenrod") return COLORNAMES_palegoldenrod;
+            if (value == "paleturquoise") return COLORNAMES_paleturquoise;
+            if (value == "palevioletred") return COLORNAMES_palevioletred;
+            if (value == "rebeccapurple") return COLORNAMES_rebeccapurple;
+            break;
+        case 14:
+            if (value == "blanchedalmond") return COLORNAMES_blanchedalmond;
+            if (value == "cornflowerblue") return COLORNAMES_cornflowerblue;
+            if (value == "darkolivegreen") return COLORNAMES_darkolivegreen;
+            if (value == "lightslategray") return COLORNAMES_lightslategray;
+            if (value == "lightslategrey") return COLORNAMES_lightslategrey;
+            if (value == "lightsteelblue") return COLORNAMES_lightsteelblue;
+            if (value == "mediumseagreen") return COLORNAMES_mediumseagreen;
+            break;
+        case 15:
+            if (value == "mediumslateblue") return COLORNAMES_mediumslateblue;
+            if (value == "mediumturquoise") return COLORNAMES_mediumturquoise;
+            if (value == "mediumvioletred") return COLORNAMES_mediumvioletred;
+            break;
+        case 16:
+            if (value == "mediumaquamarine") return COLORNAMES_mediumaquamarine;
+            break;
+        case 17:
+            if (value == "mediumspringgreen") return COLORNAMES_mediumspringgreen;
+            break;
+        case 20:
+            if (value == "lightgoldenrodyellow") return COLORNAMES_lightgoldenrodyellow;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.COLORNAMES", std::string(value).c_str());
     return COLORNAMES_NONE;
 }
 
@@ -790,18 +942,25 @@ std::string AttConverter::CompassdirectionToStr(data_COMPASSDIRECTION data) cons
     return value;
 }
 
-data_COMPASSDIRECTION AttConverter::StrToCompassdirection(std::string value, bool logWarning) const
+data_COMPASSDIRECTION AttConverter::StrToCompassdirection(std::string_view value, bool logWarning) const
 {
-    if (value == "n") return COMPASSDIRECTION_n;
-    if (value == "e") return COMPASSDIRECTION_e;
-    if (value == "s") return COMPASSDIRECTION_s;
-    if (value == "w") return COMPASSDIRECTION_w;
-    if (value == "ne") return COMPASSDIRECTION_ne;
-    if (value == "nw") return COMPASSDIRECTION_nw;
-    if (value == "se") return COMPASSDIRECTION_se;
-    if (value == "sw") return COMPASSDIRECTION_sw;
+    switch (value.size()) {
+        case 1:
+            if (value == "n") return COMPASSDIRECTION_n;
+            if (value == "e") return COMPASSDIRECTION_e;
+            if (value == "s") return COMPASSDIRECTION_s;
+            if (value == "w") return COMPASSDIRECTION_w;
+            break;
+        case 2:
+            if (value == "ne") return COMPASSDIRECTION_ne;
+            if (value == "nw") return COMPASSDIRECTION_nw;
+            if (value == "se") return COMPASSDIRECTION_se;
+            if (value == "sw") return COMPASSDIRECTION_sw;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION", value.c_str());
+        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION", std::string(value).c_str());
     return COMPASSDIRECTION_NONE;
 }
 
@@ -821,14 +980,19 @@ std::string AttConverter::CompassdirectionBasicToStr(data_COMPASSDIRECTION_basic
     return value;
 }
 
-data_COMPASSDIRECTION_basic AttConverter::StrToCompassdirectionBasic(std::string value, bool logWarning) const
+data_COMPASSDIRECTION_basic AttConverter::StrToCompassdirectionBasic(std::string_view value, bool logWarning) const
 {
-    if (value == "n") return COMPASSDIRECTION_basic_n;
-    if (value == "e") return COMPASSDIRECTION_basic_e;
-    if (value == "s") return COMPASSDIRECTION_basic_s;
-    if (value == "w") return COMPASSDIRECTION_basic_w;
+    switch (value.size()) {
+        case 1:
+            if (value == "n") return COMPASSDIRECTION_basic_n;
+            if (value == "e") return COMPASSDIRECTION_basic_e;
+            if (value == "s") return COMPASSDIRECTION_basic_s;
+            if (value == "w") return COMPASSDIRECTION_basic_w;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION.basic", value.c_str());
+        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION.basic", std::string(value).c_str());
     return COMPASSDIRECTION_basic_NONE;
 }
 
@@ -848,14 +1012,20 @@ std::string AttConverter::CompassdirectionExtendedToStr(data_COMPASSDIRECTION_ex
     return value;
 }
 
-data_COMPASSDIRECTION_extended AttConverter::StrToCompassdirectionExtended(std::string value, bool logWarning) const
+data_COMPASSDIRECTION_extended AttConverter::StrToCompassdirectionExtended(
+    std::string_view value, bool logWarning) const
 {
-    if (value == "ne") return COMPASSDIRECTION_extended_ne;
-    if (value == "nw") return COMPASSDIRECTION_extended_nw;
-    if (value == "se") return COMPASSDIRECTION_extended_se;
-    if (value == "sw") return COMPASSDIRECTION_extended_sw;
+    switch (value.size()) {
+        case 2:
+            if (value == "ne") return COMPASSDIRECTION_extended_ne;
+            if (value == "nw") return COMPASSDIRECTION_extended_nw;
+            if (value == "se") return COMPASSDIRECTION_extended_se;
+            if (value == "sw") return COMPASSDIRECTION_extended_sw;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION.extended", value.c_str());
+        LogWarning("Unsupported value '%s' for data.COMPASSDIRECTION.extended", std::string(value).c_str());
     return COMPASSDIRECTION_extended_NONE;
 }
 
@@ -873,12 +1043,17 @@ std::string AttConverter::EnclosureToStr(data_ENCLOSURE data) const
     return value;
 }
 
-data_ENCLOSURE AttConverter::StrToEnclosure(std::string value, bool logWarning) const
+data_ENCLOSURE AttConverter::StrToEnclosure(std::string_view value, bool logWarning) const
 {
-    if (value == "paren") return ENCLOSURE_paren;
-    if (value == "brack") return ENCLOSURE_brack;
+    switch (value.size()) {
+        case 5:
+            if (value == "paren") return ENCLOSURE_paren;
+            if (value == "brack") return ENCLOSURE_brack;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ENCLOSURE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.ENCLOSURE", std::string(value).c_str());
     return ENCLOSURE_NONE;
 }
 
@@ -902,18 +1077,29 @@ std::string AttConverter::EventrelToStr(data_EVENTREL data) const
     return value;
 }
 
-data_EVENTREL AttConverter::StrToEventrel(std::string value, bool logWarning) const
+data_EVENTREL AttConverter::StrToEventrel(std::string_view value, bool logWarning) const
 {
-    if (value == "above") return EVENTREL_above;
-    if (value == "below") return EVENTREL_below;
-    if (value == "left") return EVENTREL_left;
-    if (value == "right") return EVENTREL_right;
-    if (value == "above-left") return EVENTREL_above_left;
-    if (value == "above-right") return EVENTREL_above_right;
-    if (value == "below-left") return EVENTREL_below_left;
-    if (value == "below-right") return EVENTREL_below_right;
+    switch (value.size()) {
+        case 4:
+            if (value == "left") return EVENTREL_left;
+            break;
+        case 5:
+            if (value == "above") return EVENTREL_above;
+            if (value == "below") return EVENTREL_below;
+            if (value == "right") return EVENTREL_right;
+            break;
+        case 10:
+            if (value == "above-left") return EVENTREL_above_left;
+            if (value == "below-left") return EVENTREL_below_left;
+            break;
+        case 11:
+            if (value == "above-right") return EVENTREL_above_right;
+            if (value == "below-right") return EVENTREL_below_right;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.EVENTREL", value.c_str());
+        LogWarning("Unsupported value '%s' for data.EVENTREL", std::string(value).c_str());
     return EVENTREL_NONE;
 }
 
@@ -933,14 +1119,21 @@ std::string AttConverter::EventrelBasicToStr(data_EVENTREL_basic data) const
     return value;
 }
 
-data_EVENTREL_basic AttConverter::StrToEventrelBasic(std::string value, bool logWarning) const
+data_EVENTREL_basic AttConverter::StrToEventrelBasic(std::string_view value, bool logWarning) const
 {
-    if (value == "above") return EVENTREL_basic_above;
-    if (value == "below") return EVENTREL_basic_below;
-    if (value == "left") return EVENTREL_basic_left;
-    if (value == "right") return EVENTREL_basic_right;
+    switch (value.size()) {
+        case 4:
+            if (value == "left") return EVENTREL_basic_left;
+            break;
+        case 5:
+            if (value == "above") return EVENTREL_basic_above;
+            if (value == "below") return EVENTREL_basic_below;
+            if (value == "right") return EVENTREL_basic_right;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.EVENTREL.basic", value.c_str());
+        LogWarning("Unsupported value '%s' for data.EVENTREL.basic", std::string(value).c_str());
     return EVENTREL_basic_NONE;
 }
 
@@ -960,14 +1153,21 @@ std::string AttConverter::EventrelExtendedToStr(data_EVENTREL_extended data) con
     return value;
 }
 
-data_EVENTREL_extended AttConverter::StrToEventrelExtended(std::string value, bool logWarning) const
+data_EVENTREL_extended AttConverter::StrToEventrelExtended(std::string_view value, bool logWarning) const
 {
-    if (value == "above-left") return EVENTREL_extended_above_left;
-    if (value == "above-right") return EVENTREL_extended_above_right;
-    if (value == "below-left") return EVENTREL_extended_below_left;
-    if (value == "below-right") return EVENTREL_extended_below_right;
+    switch (value.size()) {
+        case 10:
+            if (value == "above-left") return EVENTREL_extended_above_left;
+            if (value == "below-left") return EVENTREL_extended_below_left;
+            break;
+        case 11:
+            if (value == "above-right") return EVENTREL_extended_above_right;
+            if (value == "below-right") return EVENTREL_extended_below_right;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.EVENTREL.extended", value.c_str());
+        LogWarning("Unsupported value '%s' for data.EVENTREL.extended", std::string(value).c_str());
     return EVENTREL_extended_NONE;
 }
 
@@ -989,16 +1189,27 @@ std::string AttConverter::FillToStr(data_FILL data) const
     return value;
 }
 
-data_FILL AttConverter::StrToFill(std::string value, bool logWarning) const
+data_FILL AttConverter::StrToFill(std::string_view value, bool logWarning) const
 {
-    if (value == "void") return FILL_void;
-    if (value == "solid") return FILL_solid;
-    if (value == "top") return FILL_top;
-    if (value == "bottom") return FILL_bottom;
-    if (value == "left") return FILL_left;
-    if (value == "right") return FILL_right;
+    switch (value.size()) {
+        case 3:
+            if (value == "top") return FILL_top;
+            break;
+        case 4:
+            if (value == "void") return FILL_void;
+            if (value == "left") return FILL_left;
+            break;
+        case 5:
+            if (value == "solid") return FILL_solid;
+            if (value == "right") return FILL_right;
+            break;
+        case 6:
+            if (value == "bottom") return FILL_bottom;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FILL", value.c_str());
+        LogWarning("Unsupported value '%s' for data.FILL", std::string(value).c_str());
     return FILL_NONE;
 }
 
@@ -1023,19 +1234,30 @@ std::string AttConverter::FontsizetermToStr(data_FONTSIZETERM data) const
     return value;
 }
 
-data_FONTSIZETERM AttConverter::StrToFontsizeterm(std::string value, bool logWarning) const
+data_FONTSIZETERM AttConverter::StrToFontsizeterm(std::string_view value, bool logWarning) const
 {
-    if (value == "xx-small") return FONTSIZETERM_xx_small;
-    if (value == "x-small") return FONTSIZETERM_x_small;
-    if (value == "small") return FONTSIZETERM_small;
-    if (value == "normal") return FONTSIZETERM_normal;
-    if (value == "large") return FONTSIZETERM_large;
-    if (value == "x-large") return FONTSIZETERM_x_large;
-    if (value == "xx-large") return FONTSIZETERM_xx_large;
-    if (value == "smaller") return FONTSIZETERM_smaller;
-    if (value == "larger") return FONTSIZETERM_larger;
+    switch (value.size()) {
+        case 5:
+            if (value == "small") return FONTSIZETERM_small;
+            if (value == "large") return FONTSIZETERM_large;
+            break;
+        case 6:
+            if (value == "normal") return FONTSIZETERM_normal;
+            if (value == "larger") return FONTSIZETERM_larger;
+            break;
+        case 7:
+            if (value == "x-small") return FONTSIZETERM_x_small;
+            if (value == "x-large") return FONTSIZETERM_x_large;
+            if (value == "smaller") return FONTSIZETERM_smaller;
+            break;
+        case 8:
+            if (value == "xx-small") return FONTSIZETERM_xx_small;
+            if (value == "xx-large") return FONTSIZETERM_xx_large;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FONTSIZETERM", value.c_str());
+        LogWarning("Unsupported value '%s' for data.FONTSIZETERM", std::string(value).c_str());
     return FONTSIZETERM_NONE;
 }
 
@@ -1054,13 +1276,20 @@ std::string AttConverter::FontstyleToStr(data_FONTSTYLE data) const
     return value;
 }
 
-data_FONTSTYLE AttConverter::StrToFontstyle(std::string value, bool logWarning) const
+data_FONTSTYLE AttConverter::StrToFontstyle(std::string_view value, bool logWarning) const
 {
-    if (value == "italic") return FONTSTYLE_italic;
-    if (value == "normal") return FONTSTYLE_normal;
-    if (value == "oblique") return FONTSTYLE_oblique;
+    switch (value.size()) {
+        case 6:
+            if (value == "italic") return FONTSTYLE_italic;
+            if (value == "normal") return FONTSTYLE_normal;
+            break;
+        case 7:
+            if (value == "oblique") return FONTSTYLE_oblique;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FONTSTYLE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.FONTSTYLE", std::string(value).c_str());
     return FONTSTYLE_NONE;
 }
 
@@ -1078,12 +1307,19 @@ std::string AttConverter::FontweightToStr(data_FONTWEIGHT data) const
     return value;
 }
 
-data_FONTWEIGHT AttConverter::StrToFontweight(std::string value, bool logWarning) const
+data_FONTWEIGHT AttConverter::StrToFontweight(std::string_view value, bool logWarning) const
 {
-    if (value == "bold") return FONTWEIGHT_bold;
-    if (value == "normal") return FONTWEIGHT_normal;
+    switch (value.size()) {
+        case 4:
+            if (value == "bold") return FONTWEIGHT_bold;
+            break;
+        case 6:
+            if (value == "normal") return FONTWEIGHT_normal;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FONTWEIGHT", value.c_str());
+        LogWarning("Unsupported value '%s' for data.FONTWEIGHT", std::string(value).c_str());
     return FONTWEIGHT_NONE;
 }
 
@@ -1135,46 +1371,71 @@ std::string AttConverter::FrbrrelationshipToStr(data_FRBRRELATIONSHIP data) cons
     return value;
 }
 
-data_FRBRRELATIONSHIP AttConverter::StrToFrbrrelationship(std::string value, bool logWarning) const
-{
-    if (value == "hasAbridgement") return FRBRRELATIONSHIP_hasAbridgement;
-    if (value == "isAbridgementOf") return FRBRRELATIONSHIP_isAbridgementOf;
-    if (value == "hasAdaptation") return FRBRRELATIONSHIP_hasAdaptation;
-    if (value == "isAdaptationOf") return FRBRRELATIONSHIP_isAdaptationOf;
-    if (value == "hasAlternate") return FRBRRELATIONSHIP_hasAlternate;
-    if (value == "isAlternateOf") return FRBRRELATIONSHIP_isAlternateOf;
-    if (value == "hasArrangement") return FRBRRELATIONSHIP_hasArrangement;
-    if (value == "isArrangementOf") return FRBRRELATIONSHIP_isArrangementOf;
-    if (value == "hasComplement") return FRBRRELATIONSHIP_hasComplement;
-    if (value == "isComplementOf") return FRBRRELATIONSHIP_isComplementOf;
-    if (value == "hasEmbodiment") return FRBRRELATIONSHIP_hasEmbodiment;
-    if (value == "isEmbodimentOf") return FRBRRELATIONSHIP_isEmbodimentOf;
-    if (value == "hasExemplar") return FRBRRELATIONSHIP_hasExemplar;
-    if (value == "isExemplarOf") return FRBRRELATIONSHIP_isExemplarOf;
-    if (value == "hasImitation") return FRBRRELATIONSHIP_hasImitation;
-    if (value == "isImitationOf") return FRBRRELATIONSHIP_isImitationOf;
-    if (value == "hasPart") return FRBRRELATIONSHIP_hasPart;
-    if (value == "isPartOf") return FRBRRELATIONSHIP_isPartOf;
-    if (value == "hasRealization") return FRBRRELATIONSHIP_hasRealization;
-    if (value == "isRealizationOf") return FRBRRELATIONSHIP_isRealizationOf;
-    if (value == "hasReconfiguration") return FRBRRELATIONSHIP_hasReconfiguration;
-    if (value == "isReconfigurationOf") return FRBRRELATIONSHIP_isReconfigurationOf;
-    if (value == "hasReproduction") return FRBRRELATIONSHIP_hasReproduction;
-    if (value == "isReproductionOf") return FRBRRELATIONSHIP_isReproductionOf;
-    if (value == "hasRevision") return FRBRRELATIONSHIP_hasRevision;
-    if (value == "isRevisionOf") return FRBRRELATIONSHIP_isRevisionOf;
-    if (value == "hasSuccessor") return FRBRRELATIONSHIP_hasSuccessor;
-    if (value == "isSuccessorOf") return FRBRRELATIONSHIP_isSuccessorOf;
-    if (value == "hasSummarization") return FRBRRELATIONSHIP_hasSummarization;
-    if (value == "isSummarizationOf") return FRBRRELATIONSHIP_isSummarizationOf;
-    if (value == "hasSupplement") return FRBRRELATIONSHIP_hasSupplement;
-    if (value == "isSupplementOf") return FRBRRELATIONSHIP_isSupplementOf;
-    if (value == "hasTransformation") return FRBRRELATIONSHIP_hasTransformation;
-    if (value == "isTransformationOf") return FRBRRELATIONSHIP_isTransformationOf;
-    if (value == "hasTranslation") return FRBRRELATIONSHIP_hasTranslation;
-    if (value == "isTranslationOf") return FRBRRELATIONSHIP_isTranslationOf;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.FRBRRELATIONSHIP", value.c_str());
+data_FRBRRELATIONSHIP AttConverter::StrToFrbrrelationship(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 7:
+            if (value == "hasPart") return FRBRRELATIONSHIP_hasPart;
+            break;
+        case 8:
+            if (value == "isPartOf") return FRBRRELATIONSHIP_isPartOf;
+            break;
+        case 11:
+            if (value == "hasExemplar") return FRBRRELATIONSHIP_hasExemplar;
+            if (value == "hasRevision") return FRBRRELATIONSHIP_hasRevision;
+            break;
+        case 12:
+            if (value == "hasAlternate") return FRBRRELATIONSHIP_hasAlternate;
+            if (value == "isExemplarOf") return FRBRRELATIONSHIP_isExemplarOf;
+            if (value == "hasImitation") return FRBRRELATIONSHIP_hasImitation;
+            if (value == "isRevisionOf") return FRBRRELATIONSHIP_isRevisionOf;
+            if (value == "hasSuccessor") return FRBRRELATIONSHIP_hasSuccessor;
+            break;
+        case 13:
+            if (value == "hasAdaptation") return FRBRRELATIONSHIP_hasAdaptation;
+            if (value == "isAlternateOf") return FRBRRELATIONSHIP_isAlternateOf;
+            if (value == "hasComplement") return FRBRRELATIONSHIP_hasComplement;
+            if (value == "hasEmbodiment") return FRBRRELATIONSHIP_hasEmbodiment;
+            if (value == "isImitationOf") return FRBRRELATIONSHIP_isImitationOf;
+            if (value == "isSuccessorOf") return FRBRRELATIONSHIP_isSuccessorOf;
+            if (value == "hasSupplement") return FRBRRELATIONSHIP_hasSupplement;
+            break;
+        case 14:
+            if (value == "hasAbridgement") return FRBRRELATIONSHIP_hasAbridgement;
+            if (value == "isAdaptationOf") return FRBRRELATIONSHIP_isAdaptationOf;
+            if (value == "hasArrangement") return FRBRRELATIONSHIP_hasArrangement;
+            if (value == "isComplementOf") return FRBRRELATIONSHIP_isComplementOf;
+            if (value == "isEmbodimentOf") return FRBRRELATIONSHIP_isEmbodimentOf;
+            if (value == "hasRealization") return FRBRRELATIONSHIP_hasRealization;
+            if (value == "isSupplementOf") return FRBRRELATIONSHIP_isSupplementOf;
+            if (value == "hasTranslation") return FRBRRELATIONSHIP_hasTranslation;
+            break;
+        case 15:
+            if (value == "isAbridgementOf") return FRBRRELATIONSHIP_isAbridgementOf;
+            if (value == "isArrangementOf") return FRBRRELATIONSHIP_isArrangementOf;
+            if (value == "isRealizationOf") return FRBRRELATIONSHIP_isRealizationOf;
+            if (value == "hasReproduction") return FRBRRELATIONSHIP_hasReproduction;
+            if (value == "isTranslationOf") return FRBRRELATIONSHIP_isTranslationOf;
+            break;
+        case 16:
+            if (value == "isReproductionOf") return FRBRRELATIONSHIP_isReproductionOf;
+            if (value == "hasSummarization") return FRBRRELATIONSHIP_hasSummarization;
+            break;
+        case 17:
+            if (value == "isSummarizationOf") return FRBRRELATIONSHIP_isSummarizationOf;
+            if (value == "hasTransformation") return FRBRRELATIONSHIP_hasTransformation;
+            break;
+        case 18:
+            if (value == "hasReconfiguration") return FRBRRELATIONSHIP_hasReconfiguration;
+            if (value == "isTransformationOf") return FRBRRELATIONSHIP_isTransformationOf;
+            break;
+        case 19:
+            if (value == "isReconfigurationOf") return FRBRRELATIONSHIP_isReconfigurationOf;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.FRBRRELATIONSHIP", std::string(value).c_str());
     return FRBRRELATIONSHIP_NONE;
 }
 
@@ -1193,13 +1454,18 @@ std::string AttConverter::GlissandoToStr(data_GLISSANDO data) const
     return value;
 }
 
-data_GLISSANDO AttConverter::StrToGlissando(std::string value, bool logWarning) const
+data_GLISSANDO AttConverter::StrToGlissando(std::string_view value, bool logWarning) const
 {
-    if (value == "i") return GLISSANDO_i;
-    if (value == "m") return GLISSANDO_m;
-    if (value == "t") return GLISSANDO_t;
+    switch (value.size()) {
+        case 1:
+            if (value == "i") return GLISSANDO_i;
+            if (value == "m") return GLISSANDO_m;
+            if (value == "t") return GLISSANDO_t;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.GLISSANDO", value.c_str());
+        LogWarning("Unsupported value '%s' for data.GLISSANDO", std::string(value).c_str());
     return GLISSANDO_NONE;
 }
 
@@ -1218,13 +1484,22 @@ std::string AttConverter::GraceToStr(data_GRACE data) const
     return value;
 }
 
-data_GRACE AttConverter::StrToGrace(std::string value, bool logWarning) const
+data_GRACE AttConverter::StrToGrace(std::string_view value, bool logWarning) const
 {
-    if (value == "acc") return GRACE_acc;
-    if (value == "unacc") return GRACE_unacc;
-    if (value == "unknown") return GRACE_unknown;
+    switch (value.size()) {
+        case 3:
+            if (value == "acc") return GRACE_acc;
+            break;
+        case 5:
+            if (value == "unacc") return GRACE_unacc;
+            break;
+        case 7:
+            if (value == "unknown") return GRACE_unknown;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.GRACE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.GRACE", std::string(value).c_str());
     return GRACE_NONE;
 }
 
@@ -1256,26 +1531,47 @@ std::string AttConverter::HeadshapeToStr(data_HEADSHAPE data) const
     return value;
 }
 
-data_HEADSHAPE AttConverter::StrToHeadshape(std::string value, bool logWarning) const
+data_HEADSHAPE AttConverter::StrToHeadshape(std::string_view value, bool logWarning) const
 {
-    if (value == "quarter") return HEADSHAPE_quarter;
-    if (value == "half") return HEADSHAPE_half;
-    if (value == "whole") return HEADSHAPE_whole;
-    if (value == "backslash") return HEADSHAPE_backslash;
-    if (value == "circle") return HEADSHAPE_circle;
-    if (value == "+") return HEADSHAPE_plus;
-    if (value == "diamond") return HEADSHAPE_diamond;
-    if (value == "isotriangle") return HEADSHAPE_isotriangle;
-    if (value == "oval") return HEADSHAPE_oval;
-    if (value == "piewedge") return HEADSHAPE_piewedge;
-    if (value == "rectangle") return HEADSHAPE_rectangle;
-    if (value == "rtriangle") return HEADSHAPE_rtriangle;
-    if (value == "semicircle") return HEADSHAPE_semicircle;
-    if (value == "slash") return HEADSHAPE_slash;
-    if (value == "square") return HEADSHAPE_square;
-    if (value == "x") return HEADSHAPE_x;
+    switch (value.size()) {
+        case 1:
+            if (value == "+") return HEADSHAPE_plus;
+            if (value == "x") return HEADSHAPE_x;
+            break;
+        case 4:
+            if (value == "half") return HEADSHAPE_half;
+            if (value == "oval") return HEADSHAPE_oval;
+            break;
+        case 5:
+            if (value == "whole") return HEADSHAPE_whole;
+            if (value == "slash") return HEADSHAPE_slash;
+            break;
+        case 6:
+            if (value == "circle") return HEADSHAPE_circle;
+            if (value == "square") return HEADSHAPE_square;
+            break;
+        case 7:
+            if (value == "quarter") return HEADSHAPE_quarter;
+            if (value == "diamond") return HEADSHAPE_diamond;
+            break;
+        case 8:
+            if (value == "piewedge") return HEADSHAPE_piewedge;
+            break;
+        case 9:
+            if (value == "backslash") return HEADSHAPE_backslash;
+            if (value == "rectangle") return HEADSHAPE_rectangle;
+            if (value == "rtriangle") return HEADSHAPE_rtriangle;
+            break;
+        case 10:
+            if (value == "semicircle") return HEADSHAPE_semicircle;
+            break;
+        case 11:
+            if (value == "isotriangle") return HEADSHAPE_isotriangle;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.HEADSHAPE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.HEADSHAPE", std::string(value).c_str());
     return HEADSHAPE_NONE;
 }
 
@@ -1307,26 +1603,47 @@ std::string AttConverter::HeadshapeListToStr(data_HEADSHAPE_list data) const
     return value;
 }
 
-data_HEADSHAPE_list AttConverter::StrToHeadshapeList(std::string value, bool logWarning) const
+data_HEADSHAPE_list AttConverter::StrToHeadshapeList(std::string_view value, bool logWarning) const
 {
-    if (value == "quarter") return HEADSHAPE_list_quarter;
-    if (value == "half") return HEADSHAPE_list_half;
-    if (value == "whole") return HEADSHAPE_list_whole;
-    if (value == "backslash") return HEADSHAPE_list_backslash;
-    if (value == "circle") return HEADSHAPE_list_circle;
-    if (value == "+") return HEADSHAPE_list_plus;
-    if (value == "diamond") return HEADSHAPE_list_diamond;
-    if (value == "isotriangle") return HEADSHAPE_list_isotriangle;
-    if (value == "oval") return HEADSHAPE_list_oval;
-    if (value == "piewedge") return HEADSHAPE_list_piewedge;
-    if (value == "rectangle") return HEADSHAPE_list_rectangle;
-    if (value == "rtriangle") return HEADSHAPE_list_rtriangle;
-    if (value == "semicircle") return HEADSHAPE_list_semicircle;
-    if (value == "slash") return HEADSHAPE_list_slash;
-    if (value == "square") return HEADSHAPE_list_square;
-    if (value == "x") return HEADSHAPE_list_x;
+    switch (value.size()) {
+        case 1:
+            if (value == "+") return HEADSHAPE_list_plus;
+            if (value == "x") return HEADSHAPE_list_x;
+            break;
+        case 4:
+            if (value == "half") return HEADSHAPE_list_half;
+            if (value == "oval") return HEADSHAPE_list_oval;
+            break;
+        case 5:
+            if (value == "whole") return HEADSHAPE_list_whole;
+            if (value == "slash") return HEADSHAPE_list_slash;
+            break;
+        case 6:
+            if (value == "circle") return HEADSHAPE_list_circle;
+            if (value == "square") return HEADSHAPE_list_square;
+            break;
+        case 7:
+            if (value == "quarter") return HEADSHAPE_list_quarter;
+            if (value == "diamond") return HEADSHAPE_list_diamond;
+            break;
+        case 8:
+            if (value == "piewedge") return HEADSHAPE_list_piewedge;
+            break;
+        case 9:
+            if (value == "backslash") return HEADSHAPE_list_backslash;
+            if (value == "rectangle") return HEADSHAPE_list_rectangle;
+            if (value == "rtriangle") return HEADSHAPE_list_rtriangle;
+            break;
+        case 10:
+            if (value == "semicircle") return HEADSHAPE_list_semicircle;
+            break;
+        case 11:
+            if (value == "isotriangle") return HEADSHAPE_list_isotriangle;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", value.c_str());
+        LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", std::string(value).c_str());
     return HEADSHAPE_list_NONE;
 }
 
@@ -1346,14 +1663,25 @@ std::string AttConverter::HorizontalalignmentToStr(data_HORIZONTALALIGNMENT data
     return value;
 }
 
-data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(std::string value, bool logWarning) const
+data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(std::string_view value, bool logWarning) const
 {
-    if (value == "left") return HORIZONTALALIGNMENT_left;
-    if (value == "right") return HORIZONTALALIGNMENT_right;
-    if (value == "center") return HORIZONTALALIGNMENT_center;
-    if (value == "justify") return HORIZONTALALIGNMENT_justify;
+    switch (value.size()) {
+        case 4:
+            if (value == "left") return HORIZONTALALIGNMENT_left;
+            break;
+        case 5:
+            if (value == "right") return HORIZONTALALIGNMENT_right;
+            break;
+        case 6:
+            if (value == "center") return HORIZONTALALIGNMENT_center;
+            break;
+        case 7:
+            if (value == "justify") return HORIZONTALALIGNMENT_justify;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.HORIZONTALALIGNMENT", value.c_str());
+        LogWarning("Unsupported value '%s' for data.HORIZONTALALIGNMENT", std::string(value).c_str());
     return HORIZONTALALIGNMENT_NONE;
 }
 
@@ -1374,15 +1702,22 @@ std::string AttConverter::LayerschemeToStr(data_LAYERSCHEME data) const
     return value;
 }
 
-data_LAYERSCHEME AttConverter::StrToLayerscheme(std::string value, bool logWarning) const
+data_LAYERSCHEME AttConverter::StrToLayerscheme(std::string_view value, bool logWarning) const
 {
-    if (value == "1") return LAYERSCHEME_1;
-    if (value == "2o") return LAYERSCHEME_2o;
-    if (value == "2f") return LAYERSCHEME_2f;
-    if (value == "3o") return LAYERSCHEME_3o;
-    if (value == "3f") return LAYERSCHEME_3f;
+    switch (value.size()) {
+        case 1:
+            if (value == "1") return LAYERSCHEME_1;
+            break;
+        case 2:
+            if (value == "2o") return LAYERSCHEME_2o;
+            if (value == "2f") return LAYERSCHEME_2f;
+            if (value == "3o") return LAYERSCHEME_3o;
+            if (value == "3f") return LAYERSCHEME_3f;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LAYERSCHEME", value.c_str());
+        LogWarning("Unsupported value '%s' for data.LAYERSCHEME", std::string(value).c_str());
     return LAYERSCHEME_NONE;
 }
 
@@ -1400,12 +1735,19 @@ std::string AttConverter::LigatureformToStr(data_LIGATUREFORM data) const
     return value;
 }
 
-data_LIGATUREFORM AttConverter::StrToLigatureform(std::string value, bool logWarning) const
+data_LIGATUREFORM AttConverter::StrToLigatureform(std::string_view value, bool logWarning) const
 {
-    if (value == "recta") return LIGATUREFORM_recta;
-    if (value == "obliqua") return LIGATUREFORM_obliqua;
+    switch (value.size()) {
+        case 5:
+            if (value == "recta") return LIGATUREFORM_recta;
+            break;
+        case 7:
+            if (value == "obliqua") return LIGATUREFORM_obliqua;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LIGATUREFORM", value.c_str());
+        LogWarning("Unsupported value '%s' for data.LIGATUREFORM", std::string(value).c_str());
     return LIGATUREFORM_NONE;
 }
 
@@ -1425,14 +1767,23 @@ std::string AttConverter::LineformToStr(data_LINEFORM data) const
     return value;
 }
 
-data_LINEFORM AttConverter::StrToLineform(std::string value, bool logWarning) const
+data_LINEFORM AttConverter::StrToLineform(std::string_view value, bool logWarning) const
 {
-    if (value == "dashed") return LINEFORM_dashed;
-    if (value == "dotted") return LINEFORM_dotted;
-    if (value == "solid") return LINEFORM_solid;
-    if (value == "wavy") return LINEFORM_wavy;
+    switch (value.size()) {
+        case 4:
+            if (value == "wavy") return LINEFORM_wavy;
+            break;
+        case 5:
+            if (value == "solid") return LINEFORM_solid;
+            break;
+        case 6:
+            if (value == "dashed") return LINEFORM_dashed;
+            if (value == "dotted") return LINEFORM_dotted;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LINEFORM", value.c_str());
+        LogWarning("Unsupported value '%s' for data.LINEFORM", std::string(value).c_str());
     return LINEFORM_NONE;
 }
 
@@ -1468,30 +1819,51 @@ std::string AttConverter::LinestartendsymbolToStr(data_LINESTARTENDSYMBOL data)
     return value;
 }
 
-data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(std::string value, bool logWarning) const
+data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(std::string_view value, bool logWarning) const
 {
-    if (value == "angledown") return LINESTARTENDSYMBOL_angledown;
-    if (value == "angleup") return LINESTARTENDSYMBOL_angleup;
-    if (value == "angleright") return LINESTARTENDSYMBOL_angleright;
-    if (value == "angleleft") return LINESTARTENDSYMBOL_angleleft;
-    if (value == "arrow") return LINESTARTENDSYMBOL_arrow;
-    if (value == "arrowopen") return LINESTARTENDSYMBOL_arrowopen;
-    if (value == "arrowwhite") return LINESTARTENDSYMBOL_arrowwhite;
-    if (value == "harpoonleft") return LINESTARTENDSYMBOL_harpoonleft;
-    if (value == "harpoonright") return LINESTARTENDSYMBOL_harpoonright;
-    if (value == "H") return LINESTARTENDSYMBOL_H;
-    if (value == "N") return LINESTARTENDSYMBOL_N;
-    if (value == "Th") return LINESTARTENDSYMBOL_Th;
-    if (value == "ThRetro") return LINESTARTENDSYMBOL_ThRetro;
-    if (value == "ThRetroInv") return LINESTARTENDSYMBOL_ThRetroInv;
-    if (value == "ThInv") return LINESTARTENDSYMBOL_ThInv;
-    if (value == "T") return LINESTARTENDSYMBOL_T;
-    if (value == "TInv") return LINESTARTENDSYMBOL_TInv;
-    if (value == "CH") return LINESTARTENDSYMBOL_CH;
-    if (value == "RH") return LINESTARTENDSYMBOL_RH;
-    if (value == "none") return LINESTARTENDSYMBOL_none;
+    switch (value.size()) {
+        case 1:
+            if (value == "H") return LINESTARTENDSYMBOL_H;
+            if (value == "N") return LINESTARTENDSYMBOL_N;
+            if (value == "T") return LINESTARTENDSYMBOL_T;
+            break;
+        case 2:
+            if (value == "Th") return LINESTARTENDSYMBOL_Th;
+            if (value == "CH") return LINESTARTENDSYMBOL_CH;
+            if (value == "RH") return LINESTARTENDSYMBOL_RH;
+            break;
+        case 4:
+            if (value == "TInv") return LINESTARTENDSYMBOL_TInv;
+            if (value == "none") return LINESTARTENDSYMBOL_none;
+            break;
+        case 5:
+            if (value == "arrow") return LINESTARTENDSYMBOL_arrow;
+            if (value == "ThInv") return LINESTARTENDSYMBOL_ThInv;
+            break;
+        case 7:
+            if (value == "angleup") return LINESTARTENDSYMBOL_angleup;
+            if (value == "ThRetro") return LINESTARTENDSYMBOL_ThRetro;
+            break;
+        case 9:
+            if (value == "angledown") return LINESTARTENDSYMBOL_angledown;
+            if (value == "angleleft") return LINESTARTENDSYMBOL_angleleft;
+            if (value == "arrowopen") return LINESTARTENDSYMBOL_arrowopen;
+            break;
+        case 10:
+            if (value == "angleright") return LINESTARTENDSYMBOL_angleright;
+            if (value == "arrowwhite") return LINESTARTENDSYMBOL_arrowwhite;
+            if (value == "ThRetroInv") return LINESTARTENDSYMBOL_ThRetroInv;
+            break;
+        case 11:
+            if (value == "harpoonleft") return LINESTARTENDSYMBOL_harpoonleft;
+            break;
+        case 12:
+            if (value == "harpoonright") return LINESTARTENDSYMBOL_harpoonright;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", value.c_str());
+        LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", std::string(value).c_str());
     return LINESTARTENDSYMBOL_NONE;
 }
 
@@ -1510,13 +1882,20 @@ std::string AttConverter::LinewidthtermToStr(data_LINEWIDTHTERM data) const
     return value;
 }
 
-data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(std::string value, bool logWarning) const
+data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(std::string_view value, bool logWarning) const
 {
-    if (value == "narrow") return LINEWIDTHTERM_narrow;
-    if (value == "medium") return LINEWIDTHTERM_medium;
-    if (value == "wide") return LINEWIDTHTERM_wide;
+    switch (value.size()) {
+        case 4:
+            if (value == "wide") return LINEWIDTHTERM_wide;
+            break;
+        case 6:
+            if (value == "narrow") return LINEWIDTHTERM_narrow;
+            if (value == "medium") return LINEWIDTHTERM_medium;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.LINEWIDTHTERM", value.c_str());
+        LogWarning("Unsupported value '%s' for data.LINEWIDTHTERM", std::string(value).c_str());
     return LINEWIDTHTERM_NONE;
 }
 
@@ -1560,38 +1939,49 @@ std::string AttConverter::MelodicfunctionToStr(data_MELODICFUNCTION data) const
     return value;
 }
 
-data_MELODICFUNCTION AttConverter::StrToMelodicfunction(std::string value, bool logWarning) const
-{
-    if (value == "aln") return MELODICFUNCTION_aln;
-    if (value == "ant") return MELODICFUNCTION_ant;
-    if (value == "app") return MELODICFUNCTION_app;
-    if (value == "apt") return MELODICFUNCTION_apt;
-    if (value == "arp") return MELODICFUNCTION_arp;
-    if (value == "arp7") return MELODICFUNCTION_arp7;
-    if (value == "aun") return MELODICFUNCTION_aun;
-    if (value == "chg") return MELODICFUNCTION_chg;
-    if (value == "cln") return MELODICFUNCTION_cln;
-    if (value == "ct") return MELODICFUNCTION_ct;
-    if (value == "ct7") return MELODICFUNCTION_ct7;
-    if (value == "cun") return MELODICFUNCTION_cun;
-    if (value == "cup") return MELODICFUNCTION_cup;
-    if (value == "et") return MELODICFUNCTION_et;
-    if (value == "ln") return MELODICFUNCTION_ln;
-    if (value == "ped") return MELODICFUNCTION_ped;
-    if (value == "rep") return MELODICFUNCTION_rep;
-    if (value == "ret") return MELODICFUNCTION_ret;
-    if (value == "23ret") return MELODICFUNCTION_23ret;
-    if (value == "78ret") return MELODICFUNCTION_78ret;
-    if (value == "sus") return MELODICFUNCTION_sus;
-    if (value == "43sus") return MELODICFUNCTION_43sus;
-    if (value == "98sus") return MELODICFUNCTION_98sus;
-    if (value == "76sus") return MELODICFUNCTION_76sus;
-    if (value == "un") return MELODICFUNCTION_un;
-    if (value == "un7") return MELODICFUNCTION_un7;
-    if (value == "upt") return MELODICFUNCTION_upt;
-    if (value == "upt7") return MELODICFUNCTION_upt7;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", value.c_str());
+data_MELODICFUNCTION AttConverter::StrToMelodicfunction(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 2:
+            if (value == "ct") return MELODICFUNCTION_ct;
+            if (value == "et") return MELODICFUNCTION_et;
+            if (value == "ln") return MELODICFUNCTION_ln;
+            if (value == "un") return MELODICFUNCTION_un;
+            break;
+        case 3:
+            if (value == "aln") return MELODICFUNCTION_aln;
+            if (value == "ant") return MELODICFUNCTION_ant;
+            if (value == "app") return MELODICFUNCTION_app;
+            if (value == "apt") return MELODICFUNCTION_apt;
+            if (value == "arp") return MELODICFUNCTION_arp;
+            if (value == "aun") return MELODICFUNCTION_aun;
+            if (value == "chg") return MELODICFUNCTION_chg;
+            if (value == "cln") return MELODICFUNCTION_cln;
+            if (value == "ct7") return MELODICFUNCTION_ct7;
+            if (value == "cun") return MELODICFUNCTION_cun;
+            if (value == "cup") return MELODICFUNCTION_cup;
+            if (value == "ped") return MELODICFUNCTION_ped;
+            if (value == "rep") return MELODICFUNCTION_rep;
+            if (value == "ret") return MELODICFUNCTION_ret;
+            if (value == "sus") return MELODICFUNCTION_sus;
+            if (value == "un7") return MELODICFUNCTION_un7;
+            if (value == "upt") return MELODICFUNCTION_upt;
+            break;
+        case 4:
+            if (value == "arp7") return MELODICFUNCTION_arp7;
+            if (value == "upt7") return MELODICFUNCTION_upt7;
+            break;
+        case 5:
+            if (value == "23ret") return MELODICFUNCTION_23ret;
+            if (value == "78ret") return MELODICFUNCTION_78ret;
+            if (value == "43sus") return MELODICFUNCTION_43sus;
+            if (value == "98sus") return MELODICFUNCTION_98sus;
+            if (value == "76sus") return MELODICFUNCTION_76sus;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", std::string(value).c_str());
     return MELODICFUNCTION_NONE;
 }
 
@@ -1609,12 +1999,17 @@ std::string AttConverter::MensurationsignToStr(data_MENSURATIONSIGN data) const
     return value;
 }
 
-data_MENSURATIONSIGN AttConverter::StrToMensurationsign(std::string value, bool logWarning) const
+data_MENSURATIONSIGN AttConverter::StrToMensurationsign(std::string_view value, bool logWarning) const
 {
-    if (value == "C") return MENSURATIONSIGN_C;
-    if (value == "O") return MENSURATIONSIGN_O;
+    switch (value.size()) {
+        case 1:
+            if (value == "C") return MENSURATIONSIGN_C;
+            if (value == "O") return MENSURATIONSIGN_O;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", value.c_str());
+        LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", std::string(value).c_str());
     return MENSURATIONSIGN_NONE;
 }
 
@@ -1634,14 +2029,25 @@ std::string AttConverter::MeterformToStr(data_METERFORM data) const
     return value;
 }
 
-data_METERFORM AttConverter::StrToMeterform(std::string value, bool logWarning) const
+data_METERFORM AttConverter::StrToMeterform(std::string_view value, bool logWarning) const
 {
-    if (value == "num") return METERFORM_num;
-    if (value == "denomsym") return METERFORM_denomsym;
-    if (value == "norm") return METERFORM_norm;
-    if (value == "invis") return METERFORM_invis;
+    switch (value.size()) {
+        case 3:
+            if (value == "num") return METERFORM_num;
+            break;
+        case 4:
+            if (value == "norm") return METERFORM_norm;
+            break;
+        case 5:
+            if (value == "invis") return METERFORM_invis;
+            break;
+        case 8:
+            if (value == "denomsym") return METERFORM_denomsym;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.METERFORM", value.c_str());
+        LogWarning("Unsupported value '%s' for data.METERFORM", std::string(value).c_str());
     return METERFORM_NONE;
 }
 
@@ -1659,12 +2065,19 @@ std::string AttConverter::MetersignToStr(data_METERSIGN data) const
     return value;
 }
 
-data_METERSIGN AttConverter::StrToMetersign(std::string value, bool logWarning) const
+data_METERSIGN AttConverter::StrToMetersign(std::string_view value, bool logWarning) const
 {
-    if (value == "common") return METERSIGN_common;
-    if (value == "cut") return METERSIGN_cut;
+    switch (value.size()) {
+        case 3:
+            if (value == "cut") return METERSIGN_cut;
+            break;
+        case 6:
+            if (value == "common") return METERSIGN_common;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.METERSIGN", value.c_str());
+        LogWarning("Unsupported value '%s' for data.METERSIGN", std::string(value).c_str());
     return METERSIGN_NONE;
 }
 
@@ -1855,185 +2268,222 @@ std::string AttConverter::MidinamesToStr(data_MIDINAMES data) const
     return value;
 }
 
-data_MIDINAMES AttConverter::StrToMidinames(std::string value, bool logWarning) const
-{
-    if (value == "Acoustic_Grand_Piano") return MIDINAMES_Acoustic_Grand_Piano;
-    if (value == "Bright_Acoustic_Piano") return MIDINAMES_Bright_Acoustic_Piano;
-    if (value == "Electric_Grand_Piano") return MIDINAMES_Electric_Grand_Piano;
-    if (value == "Honky-tonk_Piano") return MIDINAMES_Honky_tonk_Piano;
-    if (value == "Electric_Piano_1") return MIDINAMES_Electric_Piano_1;
-    if (value == "Electric_Piano_2") return MIDINAMES_Electric_Piano_2;
-    if (value == "Harpsichord") return MIDINAMES_Harpsichord;
-    if (value == "Clavi") return MIDINAMES_Clavi;
-    if (value == "Celesta") return MIDINAMES_Celesta;
-    if (value == "Glockenspiel") return MIDINAMES_Glockenspiel;
-    if (value == "Music_Box") return MIDINAMES_Music_Box;
-    if (value == "Vibraphone") return MIDINAMES_Vibraphone;
-    if (value == "Marimba") return MIDINAMES_Marimba;
-    if (value == "Xylophone") return MIDINAMES_Xylophone;
-    if (value == "Tubular_Bells") return MIDINAMES_Tubular_Bells;
-    if (value == "Dulcimer") return MIDINAMES_Dulcimer;
-    if (value == "Drawbar_Organ") return MIDINAMES_Drawbar_Organ;
-    if (value == "Percussive_Organ") return MIDINAMES_Percussive_Organ;
-    if (value == "Rock_Organ") return MIDINAMES_Rock_Organ;
-    if (value == "Church_Organ") return MIDINAMES_Church_Organ;
-    if (value == "Reed_Organ") return MIDINAMES_Reed_Organ;
-    if (value == "Accordion") return MIDINAMES_Accordion;
-    if (value == "Harmonica") return MIDINAMES_Harmonica;
-    if (value == "Tango_Accordion") return MIDINAMES_Tango_Accordion;
-    if (value == "Acoustic_Guitar_nylon") return MIDINAMES_Acoustic_Guitar_nylon;
-    if (value == "Acoustic_Guitar_steel") return MIDINAMES_Acoustic_Guitar_steel;
-    if (value == "Electric_Guitar_jazz") return MIDINAMES_Electric_Guitar_jazz;
-    if (value == "Electric_Guitar_clean") return MIDINAMES_Electric_Guitar_clean;
-    if (value == "Electric_Guitar_muted") return MIDINAMES_Electric_Guitar_muted;
-    if (value == "Overdriven_Guitar") return MIDINAMES_Overdriven_Guitar;
-    if (value == "Distortion_Guitar") return MIDINAMES_Distortion_Guitar;
-    if (value == "Guitar_harmonics") return MIDINAMES_Guitar_harmonics;
-    if (value == "Acoustic_Bass") return MIDINAMES_Acoustic_Bass;
-    if (value == "Electric_Bass_finger") return MIDINAMES_Electric_Bass_finger;
-    if (value == "Electric_Bass_pick") return MIDINAMES_Electric_Bass_pick;
-    if (value == "Fretless_Bass") return MIDINAMES_Fretless_Bass;
-    if (value == "Slap_Bass_1") return MIDINAMES_Slap_Bass_1;
-    if (value == "Slap_Bass_2") return MIDINAMES_Slap_Bass_2;
-    if (value == "Synth_Bass_1") return MIDINAMES_Synth_Bass_1;
-    if (value == "Synth_Bass_2") return MIDINAMES_Synth_Bass_2;
-    if (value == "Violin") return MIDINAMES_Violin;
-    if (value == "Viola") return MIDINAMES_Viola;
-    if (value == "Cello") return MIDINAMES_Cello;
-    if (value == "Contrabass") return MIDINAMES_Contrabass;
-    if (value == "Tremolo_Strings") return MIDINAMES_Tremolo_Strings;
-    if (value == "Pizzicato_Strings") return MIDINAMES_Pizzicato_Strings;
-    if (value == "Orchestral_Harp") return MIDINAMES_Orchestral_Harp;
-    if (value == "Timpani") return MIDINAMES_Timpani;
-    if (value == "String_Ensemble_1") return MIDINAMES_String_Ensemble_1;
-    if (value == "String_Ensemble_2") return MIDINAMES_String_Ensemble_2;
-    if (value == "SynthStrings_1") return MIDINAMES_SynthStrings_1;
-    if (value == "SynthStrings_2") return MIDINAMES_SynthStrings_2;
-    if (value == "Choir_Aahs") return MIDINAMES_Choir_Aahs;
-    if (value == "Voice_Oohs") return MIDINAMES_Voice_Oohs;
-    if (value == "Synth_Voice") return MIDINAMES_Synth_Voice;
-    if (value == "Orchestra_Hit") return MIDINAMES_Orchestra_Hit;
-    if (value == "Trumpet") return MIDINAMES_Trumpet;
-    if (value == "Trombone") return MIDINAMES_Trombone;
-    if (value == "Tuba") return MIDINAMES_Tuba;
-    if (value == "Muted_Trumpet") return MIDINAMES_Muted_Trumpet;
-    if (value == "French_Horn") return MIDINAMES_French_Horn;
-    if (value == "Brass_Section") return MIDINAMES_Brass_Section;
-    if (value == "SynthBrass_1") return MIDINAMES_SynthBrass_1;
-    if (value == "SynthBrass_2") return MIDINAMES_SynthBrass_2;
-    if (value == "Soprano_Sax") return MIDINAMES_Soprano_Sax;
-    if (value == "Alto_Sax") return MIDINAMES_Alto_Sax;
-    if (value == "Tenor_Sax") return MIDINAMES_Tenor_Sax;
-    if (value == "Baritone_Sax") return MIDINAMES_Baritone_Sax;
-    if (value == "Oboe") return MIDINAMES_Oboe;
-    if (value == "English_Horn") return MIDINAMES_English_Horn;
-    if (value == "Bassoon") return MIDINAMES_Bassoon;
-    if (value == "Clarinet") return MIDINAMES_Clarinet;
-    if (value == "Piccolo") return MIDINAMES_Piccolo;
-    if (value == "Flute") return MIDINAMES_Flute;
-    if (value == "Recorder") return MIDINAMES_Recorder;
-    if (value == "Pan_Flute") return MIDINAMES_Pan_Flute;
-    if (value == "Blown_Bottle") return MIDINAMES_Blown_Bottle;
-    if (value == "Shakuhachi") return MIDINAMES_Shakuhachi;
-    if (value == "Whistle") return MIDINAMES_Whistle;
-    if (value == "Ocarina") return MIDINAMES_Ocarina;
-    if (value == "Lead_1_square") return MIDINAMES_Lead_1_square;
-    if (value == "Lead_2_sawtooth") return MIDINAMES_Lead_2_sawtooth;
-    if (value == "Lead_3_calliope") return MIDINAMES_Lead_3_calliope;
-    if (value == "Lead_4_chiff") return MIDINAMES_Lead_4_chiff;
-    if (value == "Lead_5_charang") return MIDINAMES_Lead_5_charang;
-    if (value == "Lead_6_voice") return MIDINAMES_Lead_6_voice;
-    if (value == "Lead_7_fifths") return MIDINAMES_Lead_7_fifths;
-    if (value == "Lead_8_bass_and_lead") return MIDINAMES_Lead_8_bass_and_lead;
-    if (value == "Pad_1_new_age") return MIDINAMES_Pad_1_new_age;
-    if (value == "Pad_2_warm") return MIDINAMES_Pad_2_warm;
-    if (value == "Pad_3_polysynth") return MIDINAMES_Pad_3_polysynth;
-    if (value == "Pad_4_choir") return MIDINAMES_Pad_4_choir;
-    if (value == "Pad_5_bowed") return MIDINAMES_Pad_5_bowed;
-    if (value == "Pad_6_metallic") return MIDINAMES_Pad_6_metallic;
-    if (value == "Pad_7_halo") return MIDINAMES_Pad_7_halo;
-    if (value == "Pad_8_sweep") return MIDINAMES_Pad_8_sweep;
-    if (value == "FX_1_rain") return MIDINAMES_FX_1_rain;
-    if (value == "FX_2_soundtrack") return MIDINAMES_FX_2_soundtrack;
-    if (value == "FX_3_crystal") return MIDINAMES_FX_3_crystal;
-    if (value == "FX_4_atmosphere") return MIDINAMES_FX_4_atmosphere;
-    if (value == "FX_5_brightness") return MIDINAMES_FX_5_brightness;
-    if (value == "FX_6_goblins") return MIDINAMES_FX_6_goblins;
-    if (value == "FX_7_echoes") return MIDINAMES_FX_7_echoes;
-    if (value == "FX_8_sci-fi") return MIDINAMES_FX_8_sci_fi;
-    if (value == "Sitar") return MIDINAMES_Sitar;
-    if (value == "Banjo") return MIDINAMES_Banjo;
-    if (value == "Shamisen") return MIDINAMES_Shamisen;
-    if (value == "Koto") return MIDINAMES_Koto;
-    if (value == "Kalimba") return MIDINAMES_Kalimba;
-    if (value == "Bagpipe") return MIDINAMES_Bagpipe;
-    if (value == "Fiddle") return MIDINAMES_Fiddle;
-    if (value == "Shanai") return MIDINAMES_Shanai;
-    if (value == "Tinkle_Bell") return MIDINAMES_Tinkle_Bell;
-    if (value == "Agogo") return MIDINAMES_Agogo;
-    if (value == "Steel_Drums") return MIDINAMES_Steel_Drums;
-    if (value == "Woodblock") return MIDINAMES_Woodblock;
-    if (value == "Taiko_Drum") return MIDINAMES_Taiko_Drum;
-    if (value == "Melodic_Tom") return MIDINAMES_Melodic_Tom;
-    if (value == "Synth_Drum") return MIDINAMES_Synth_Drum;
-    if (value == "Reverse_Cymbal") return MIDINAMES_Reverse_Cymbal;
-    if (value == "Guitar_Fret_Noise") return MIDINAMES_Guitar_Fret_Noise;
-    if (value == "Breath_Noise") return MIDINAMES_Breath_Noise;
-    if (value == "Seashore") return MIDINAMES_Seashore;
-    if (value == "Bird_Tweet") return MIDINAMES_Bird_Tweet;
-    if (value == "Telephone_Ring") return MIDINAMES_Telephone_Ring;
-    if (value == "Helicopter") return MIDINAMES_Helicopter;
-    if (value == "Applause") return MIDINAMES_Applause;
-    if (value == "Gunshot") return MIDINAMES_Gunshot;
-    if (value == "Acoustic_Bass_Drum") return MIDINAMES_Acoustic_Bass_Drum;
-    if (value == "Bass_Drum_1") return MIDINAMES_Bass_Drum_1;
-    if (value == "Side_Stick") return MIDINAMES_Side_Stick;
-    if (value == "Acoustic_Snare") return MIDINAMES_Acoustic_Snare;
-    if (value == "Hand_Clap") return MIDINAMES_Hand_Clap;
-    if (value == "Electric_Snare") return MIDINAMES_Electric_Snare;
-    if (value == "Low_Floor_Tom") return MIDINAMES_Low_Floor_Tom;
-    if (value == "Closed_Hi_Hat") return MIDINAMES_Closed_Hi_Hat;
-    if (value == "High_Floor_Tom") return MIDINAMES_High_Floor_Tom;
-    if (value == "Pedal_Hi-Hat") return MIDINAMES_Pedal_Hi_Hat;
-    if (value == "Low_Tom") return MIDINAMES_Low_Tom;
-    if (value == "Open_Hi-Hat") return MIDINAMES_Open_Hi_Hat;
-    if (value == "Low-Mid_Tom") return MIDINAMES_Low_Mid_Tom;
-    if (value == "Hi-Mid_Tom") return MIDINAMES_Hi_Mid_Tom;
-    if (value == "Crash_Cymbal_1") return MIDINAMES_Crash_Cymbal_1;
-    if (value == "High_Tom") return MIDINAMES_High_Tom;
-    if (value == "Ride_Cymbal_1") return MIDINAMES_Ride_Cymbal_1;
-    if (value == "Chinese_Cymbal") return MIDINAMES_Chinese_Cymbal;
-    if (value == "Ride_Bell") return MIDINAMES_Ride_Bell;
-    if (value == "Tambourine") return MIDINAMES_Tambourine;
-    if (value == "Splash_Cymbal") return MIDINAMES_Splash_Cymbal;
-    if (value == "Cowbell") return MIDINAMES_Cowbell;
-    if (value == "Crash_Cymbal_2") return MIDINAMES_Crash_Cymbal_2;
-    if (value == "Vibraslap") return MIDINAMES_Vibraslap;
-    if (value == "Ride_Cymbal_2") return MIDINAMES_Ride_Cymbal_2;
-    if (value == "Hi_Bongo") return MIDINAMES_Hi_Bongo;
-    if (value == "Low_Bongo") return MIDINAMES_Low_Bongo;
-    if (value == "Mute_Hi_Conga") return MIDINAMES_Mute_Hi_Conga;
-    if (value == "Open_Hi_Conga") return MIDINAMES_Open_Hi_Conga;
-    if (value == "Low_Conga") return MIDINAMES_Low_Conga;
-    if (value == "High_Timbale") return MIDINAMES_High_Timbale;
-    if (value == "Low_Timbale") return MIDINAMES_Low_Timbale;
-    if (value == "High_Agogo") return MIDINAMES_High_Agogo;
-    if (value == "Low_Agogo") return MIDINAMES_Low_Agogo;
-    if (value == "Cabasa") return MIDINAMES_Cabasa;
-    if (value == "Maracas") return MIDINAMES_Maracas;
-    if (value == "Short_Whistle") return MIDINAMES_Short_Whistle;
-    if (value == "Long_Whistle") return MIDINAMES_Long_Whistle;
-    if (value == "Short_Guiro") return MIDINAMES_Short_Guiro;
-    if (value == "Long_Guiro") return MIDINAMES_Long_Guiro;
-    if (value == "Claves") return MIDINAMES_Claves;
-    if (value == "Hi_Wood_Block") return MIDINAMES_Hi_Wood_Block;
-    if (value == "Low_Wood_Block") return MIDINAMES_Low_Wood_Block;
-    if (value == "Mute_Cuica") return MIDINAMES_Mute_Cuica;
-    if (value == "Open_Cuica") return MIDINAMES_Open_Cuica;
-    if (value == "Mute_Triangle") return MIDINAMES_Mute_Triangle;
-    if (value == "Open_Triangle") return MIDINAMES_Open_Triangle;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MIDINAMES", value.c_str());
+data_MIDINAMES AttConverter::StrToMidinames(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 4:
+            if (value == "Tuba") return MIDINAMES_Tuba;
+            if (value == "Oboe") return MIDINAMES_Oboe;
+            if (value == "Koto") return MIDINAMES_Koto;
+            break;
+        case 5:
+            if (value == "Clavi") return MIDINAMES_Clavi;
+            if (value == "Viola") return MIDINAMES_Viola;
+            if (value == "Cello") return MIDINAMES_Cello;
+            if (value == "Flute") return MIDINAMES_Flute;
+            if (value == "Sitar") return MIDINAMES_Sitar;
+            if (value == "Banjo") return MIDINAMES_Banjo;
+            if (value == "Agogo") return MIDINAMES_Agogo;
+            break;
+        case 6:
+            if (value == "Violin") return MIDINAMES_Violin;
+            if (value == "Fiddle") return MIDINAMES_Fiddle;
+            if (value == "Shanai") return MIDINAMES_Shanai;
+            if (value == "Cabasa") return MIDINAMES_Cabasa;
+            if (value == "Claves") return MIDINAMES_Claves;
+            break;
+        case 7:
+            if (value == "Celesta") return MIDINAMES_Celesta;
+            if (value == "Marimba") return MIDINAMES_Marimba;
+            if (value == "Timpani") return MIDINAMES_Timpani;
+            if (value == "Trumpet") return MIDINAMES_Trumpet;
+            if (value == "Bassoon") return MIDINAMES_Bassoon;
+            if (value == "Piccolo") return MIDINAMES_Piccolo;
+            if (value == "Whistle") return MIDINAMES_Whistle;
+            if (value == "Ocarina") return MIDINAMES_Ocarina;
+            if (value == "Kalimba") return MIDINAMES_Kalimba;
+            if (value == "Bagpipe") return MIDINAMES_Bagpipe;
+            if (value == "Gunshot") return MIDINAMES_Gunshot;
+            if (value == "Low_Tom") return MIDINAMES_Low_Tom;
+            if (value == "Cowbell") return MIDINAMES_Cowbell;
+            if (value == "Maracas") return MIDINAMES_Maracas;
+            break;
+        case 8:
+            if (value == "Dulcimer") return MIDINAMES_Dulcimer;
+            if (value == "Trombone") return MIDINAMES_Trombone;
+            if (value == "Alto_Sax") return MIDINAMES_Alto_Sax;
+            if (value == "Clarinet") return MIDINAMES_Clarinet;
+            if (value == "Recorder") return MIDINAMES_Recorder;
+            if (value == "Shamisen") return MIDINAMES_Shamisen;
+            if (value == "Seashore") return MIDINAMES_Seashore;
+            if (value == "Applause") return MIDINAMES_Applause;
+            if (value == "High_Tom") return MIDINAMES_High_Tom;
+            if (value == "Hi_Bongo") return MIDINAMES_Hi_Bongo;
+            break;
+        case 9:
+            if (value == "Music_Box") return MIDINAMES_Music_Box;
+            if (value == "Xylophone") return MIDINAMES_Xylophone;
+            if (value == "Accordion") return MIDINAMES_Accordion;
+            if (value == "Harmonica") return MIDINAMES_Harmonica;
+            if (value == "Tenor_Sax") return MIDINAMES_Tenor_Sax;
+            if (value == "Pan_Flute") return MIDINAMES_Pan_Flute;
+            if (value == "FX_1_rain") return MIDINAMES_FX_1_rain;
+            if (value == "Woodblock") return MIDINAMES_Woodblock;
+            if (value == "Hand_Clap") return MIDINAMES_Hand_Clap;
+            if (value == "Ride_Bell") return MIDINAMES_Ride_Bell;
+            if (value == "Vibraslap") return MIDINAMES_Vibraslap;
+            if (value == "Low_Bongo") return MIDINAMES_Low_Bongo;
+            if (value == "Low_Conga") return MIDINAMES_Low_Conga;
+            if (value == "Low_Agogo") return MIDINAMES_Low_Agogo;
+            break;
+        case 10:
+            if (value == "Vibraphone") return MIDINAMES_Vibraphone;
+            if (value == "Rock_Organ") return MIDINAMES_Rock_Organ;
+            if (value == "Reed_Organ") return MIDINAMES_Reed_Organ;
+            if (value == "Contrabass") return MIDINAMES_Contrabass;
+            if (value == "Choir_Aahs") return MIDINAMES_Choir_Aahs;
+            if (value == "Voice_Oohs") return MIDINAMES_Voice_Oohs;
+            if (value == "Shakuhachi") return MIDINAMES_Shakuhachi;
+            if (value == "Pad_2_warm") return MIDINAMES_Pad_2_warm;
+            if (value == "Pad_7_halo") return MIDINAMES_Pad_7_halo;
+            if (value == "Taiko_Drum") return MIDINAMES_Taiko_Drum;
+            if (value == "Synth_Drum") return MIDINAMES_Synth_Drum;
+            if (value == "Bird_Tweet") return MIDINAMES_Bird_Tweet;
+            if (value == "Helicopter") return MIDINAMES_Helicopter;
+            if (value == "Side_Stick") return MIDINAMES_Side_Stick;
+            if (value == "Hi-Mid_Tom") return MIDINAMES_Hi_Mid_Tom;
+            if (value == "Tambourine") return MIDINAMES_Tambourine;
+            if (value == "High_Agogo") return MIDINAMES_High_Agogo;
+            if (value == "Long_Guiro") return MIDINAMES_Long_Guiro;
+            if (value == "Mute_Cuica") return MIDINAMES_Mute_Cuica;
+            if (value == "Open_Cuica") return MIDINAMES_Open_Cuica;
+            break;
+        case 11:
+            if (value == "Harpsichord") return MIDINAMES_Harpsichord;
+            if (value == "Slap_Bass_1") return MIDINAMES_Slap_Bass_1;
+            if (value == "Slap_Bass_2") return MIDINAMES_Slap_Bass_2;
+            if (value == "Synth_Voice") return MIDINAMES_Synth_Voice;
+            if (value == "French_Horn") return MIDINAMES_French_Horn;
+            if (value == "Soprano_Sax") return MIDINAMES_Soprano_Sax;
+            if (value == "Pad_4_choir") return MIDINAMES_Pad_4_choir;
+            if (value == "Pad_5_bowed") return MIDINAMES_Pad_5_bowed;
+            if (value == "Pad_8_sweep") return MIDINAMES_Pad_8_sweep;
+            if (value == "FX_7_echoes") return MIDINAMES_FX_7_echoes;
+            if (value == "FX_8_sci-fi") return MIDINAMES_FX_8_sci_fi;
+            if (value == "Tinkle_Bell") return MIDINAMES_Tinkle_Bell;
+            if (value == "Steel_Drums") return MIDINAMES_Steel_Drums;
+            if (value == "Melodic_Tom") return MIDINAMES_Melodic_Tom;
+            if (value == "Bass_Drum_1") return MIDINAMES_Bass_Drum_1;
+            if (value == "Open_Hi-Hat") return MIDINAMES_Open_Hi_Hat;
+            if (value == "Low-Mid_Tom") return MIDINAMES_Low_Mid_Tom;
+            if (value == "Low_Timbale") return MIDINAMES_Low_Timbale;
+            if (value == "Short_Guiro") return MIDINAMES_Short_Guiro;
+            break;
+        case 12:
+            if (value == "Glockenspiel") return MIDINAMES_Glockenspiel;
+            if (value == "Church_Organ") return MIDINAMES_Church_Organ;
+            if (value == "Synth_Bass_1") return MIDINAMES_Synth_Bass_1;
+            if (value == "Synth_Bass_2") return MIDINAMES_Synth_Bass_2;
+            if (value == "SynthBrass_1") return MIDINAMES_SynthBrass_1;
+            if (value == "SynthBrass_2") return MIDINAMES_SynthBrass_2;
+            if (value == "Baritone_Sax") return MIDINAMES_Baritone_Sax;
+            if (value == "English_Horn") return MIDINAMES_English_Horn;
+            if (value == "Blown_Bottle") return MIDINAMES_Blown_Bottle;
+            if (value == "Lead_4_chiff") return MIDINAMES_Lead_4_chiff;
+            if (value == "Lead_6_voice") return MIDINAMES_Lead_6_voice;
+            if (value == "FX_3_crystal") return MIDINAMES_FX_3_crystal;
+            if (value == "FX_6_goblins") return MIDINAMES_FX_6_goblins;
+            if (value == "Breath_Noise") return MIDINAMES_Breath_Noise;
+            if (value == "Pedal_Hi-Hat") return MIDINAMES_Pedal_Hi_Hat;
+            if (value == "High_Timbale") return MIDINAMES_High_Timbale;
+            if (value == "Long_Whistle") return MIDINAMES_Long_Whistle;
+            break;
+        case 13:
+            if (value == "Tubular_Bells") return MIDINAMES_Tubular_Bells;
+            if (value == "Drawbar_Organ") return MIDINAMES_Drawbar_Organ;
+            if (value == "Acoustic_Bass") return MIDINAMES_Acoustic_Bass;
+            if (value == "Fretless_Bass") return MIDINAMES_Fretless_Bass;
+            if (value == "Orchestra_Hit") return MIDINAMES_Orchestra_Hit;
+            if (value == "Muted_Trumpet") return MIDINAMES_Muted_Trumpet;
+            if (value == "Brass_Section") return MIDINAMES_Brass_Section;
+            if (value == "Lead_1_square") return MIDINAMES_Lead_1_square;
+            if (value == "Lead_7_fifths") return MIDINAMES_Lead_7_fifths;
+            if (value == "Pad_1_new_age") return MIDINAMES_Pad_1_new_age;
+            if (value == "Low_Floor_Tom") return MIDINAMES_Low_Floor_Tom;
+            if (value == "Closed_Hi_Hat") return MIDINAMES_Closed_Hi_Hat;
+            if (value == "Ride_Cymbal_1") return MIDINAMES_Ride_Cymbal_1;
+            if (value == "Splash_Cymbal") return MIDINAMES_Splash_Cymbal;
+            if (value == "Ride_Cymbal_2") return MIDINAMES_Ride_Cymbal_2;
+            if (value == "Mute_Hi_Conga") return MIDINAMES_Mute_Hi_Conga;
+            if (value == "Open_Hi_Conga") return MIDINAMES_Open_Hi_Conga;
+            if (value == "Short_Whistle") return MIDINAMES_Short_Whistle;
+            if (value == "Hi_Wood_Block") return MIDINAMES_Hi_Wood_Block;
+            if (value == "Mute_Triangle") return MIDINAMES_Mute_Triangle;
+            if (value == "Open_Triangle") return MIDINAMES_Open_Triangle;
+            break;
+        case 14:
+            if (value == "SynthStrings_1") return MIDINAMES_SynthStrings_1;
+            if (value == "SynthStrings_2") return MIDINAMES_SynthStrings_2;
+            if (value == "Lead_5_charang") return MIDINAMES_Lead_5_charang;
+            if (value == "Pad_6_metallic") return MIDINAMES_Pad_6_metallic;
+            if (value == "Reverse_Cymbal") return MIDINAMES_Reverse_Cymbal;
+            if (value == "Telephone_Ring") return MIDINAMES_Telephone_Ring;
+            if (value == "Acoustic_Snare") return MIDINAMES_Acoustic_Snare;
+            if (value == "Electric_Snare") return MIDINAMES_Electric_Snare;
+            if (value == "High_Floor_Tom") return MIDINAMES_High_Floor_Tom;
+            if (value == "Crash_Cymbal_1") return MIDINAMES_Crash_Cymbal_1;
+            if (value == "Chinese_Cymbal") return MIDINAMES_Chinese_Cymbal;
+            if (value == "Crash_Cymbal_2") return MIDINAMES_Crash_Cymbal_2;
+            if (value == "Low_Wood_Block") return MIDINAMES_Low_Wood_Block;
+            break;
+        case 15:
+            if (value == "Tango_Accordion") return MIDINAMES_Tango_Accordion;
+            if (value == "Tremolo_Strings") return MIDINAMES_Tremolo_Strings;
+            if (value == "Orchestral_Harp") return MIDINAMES_Orchestral_Harp;
+            if (value == "Lead_2_sawtooth") return MIDINAMES_Lead_2_sawtooth;
+            if (value == "Lead_3_calliope") return MIDINAMES_Lead_3_calliope;
+            if (value == "Pad_3_polysynth") return MIDINAMES_Pad_3_polysynth;
+            if (value == "FX_2_soundtrack") return MIDINAMES_FX_2_soundtrack;
+            if (value == "FX_4_atmosphere") return MIDINAMES_FX_4_atmosphere;
+            if (value == "FX_5_brightness") return MIDINAMES_FX_5_brightness;
+            break;
+        case 16:
+            if (value == "Honky-tonk_Piano") return MIDINAMES_Honky_tonk_Piano;
+            if (value == "Electric_Piano_1") return MIDINAMES_Electric_Piano_1;
+            if (value == "Electric_Piano_2") return MIDINAMES_Electric_Piano_2;
+            if (value == "Percussive_Organ") return MIDINAMES_Percussive_Organ;
+            if (value == "Guitar_harmonics") return MIDINAMES_Guitar_harmonics;
+            break;
+        case 17:
+            if (value == "Overdriven_Guitar") return MIDINAMES_Overdriven_Guitar;
+            if (value == "Distortion_Guitar") return MIDINAMES_Distortion_Guitar;
+            if (value == "Pizzicato_Strings") return MIDINAMES_Pizzicato_Strings;
+            if (value == "String_Ensemble_1") return MIDINAMES_String_Ensemble_1;
+            if (value == "String_Ensemble_2") return MIDINAMES_String_Ensemble_2;
+            if (value == "Guitar_Fret_Noise") return MIDINAMES_Guitar_Fret_Noise;
+            break;
+        case 18:
+            if (value == "Electric_Bass_pick") return MIDINAMES_Electric_Bass_pick;
+            if (value == "Acoustic_Bass_Drum") return MIDINAMES_Acoustic_Bass_Drum;
+            break;
+        case 20:
+            if (value == "Acoustic_Grand_Piano") return MIDINAMES_Acoustic_Grand_Piano;
+            if (value == "Electric_Grand_Piano") return MIDINAMES_Electric_Grand_Piano;
+            if (value == "Electric_Guitar_jazz") return MIDINAMES_Electric_Guitar_jazz;
+            if (value == "Electric_Bass_finger") return MIDINAMES_Electric_Bass_finger;
+            if (value == "Lead_8_bass_and_lead") return MIDINAMES_Lead_8_bass_and_lead;
+            break;
+        case 21:
+            if (value == "Bright_Acoustic_Piano") return MIDINAMES_Bright_Acoustic_Piano;
+            if (value == "Acoustic_Guitar_nylon") return MIDINAMES_Acoustic_Guitar_nylon;
+            if (value == "Acoustic_Guitar_steel") return MIDINAMES_Acoustic_Guitar_steel;
+            if (value == "Electric_Guitar_clean") return MIDINAMES_Electric_Guitar_clean;
+            if (value == "Electric_Guitar_muted") return MIDINAMES_Electric_Guitar_muted;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.MIDINAMES", std::string(value).c_str());
     return MIDINAMES_NONE;
 }
 
@@ -2057,18 +2507,31 @@ std::string AttConverter::ModeToStr(data_MODE data) const
     return value;
 }
 
-data_MODE AttConverter::StrToMode(std::string value, bool logWarning) const
+data_MODE AttConverter::StrToMode(std::string_view value, bool logWarning) const
 {
-    if (value == "major") return MODE_major;
-    if (value == "minor") return MODE_minor;
-    if (value == "dorian") return MODE_dorian;
-    if (value == "phrygian") return MODE_phrygian;
-    if (value == "lydian") return MODE_lydian;
-    if (value == "mixolydian") return MODE_mixolydian;
-    if (value == "aeolian") return MODE_aeolian;
-    if (value == "locrian") return MODE_locrian;
+    switch (value.size()) {
+        case 5:
+            if (value == "major") return MODE_major;
+            if (value == "minor") return MODE_minor;
+            break;
+        case 6:
+            if (value == "dorian") return MODE_dorian;
+            if (value == "lydian") return MODE_lydian;
+            break;
+        case 7:
+            if (value == "aeolian") return MODE_aeolian;
+            if (value == "locrian") return MODE_locrian;
+            break;
+        case 8:
+            if (value == "phrygian") return MODE_phrygian;
+            break;
+        case 10:
+            if (value == "mixolydian") return MODE_mixolydian;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MODE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.MODE", std::string(value).c_str());
     return MODE_NONE;
 }
 
@@ -2093,19 +2556,36 @@ std::string AttConverter::ModsrelationshipToStr(data_MODSRELATIONSHIP data) cons
     return value;
 }
 
-data_MODSRELATIONSHIP AttConverter::StrToModsrelationship(std::string value, bool logWarning) const
+data_MODSRELATIONSHIP AttConverter::StrToModsrelationship(std::string_view value, bool logWarning) const
 {
-    if (value == "preceding") return MODSRELATIONSHIP_preceding;
-    if (value == "succeeding") return MODSRELATIONSHIP_succeeding;
-    if (value == "original") return MODSRELATIONSHIP_original;
-    if (value == "host") return MODSRELATIONSHIP_host;
-    if (value == "constituent") return MODSRELATIONSHIP_constituent;
-    if (value == "otherVersion") return MODSRELATIONSHIP_otherVersion;
-    if (value == "otherFormat") return MODSRELATIONSHIP_otherFormat;
-    if (value == "isReferencedBy") return MODSRELATIONSHIP_isReferencedBy;
-    if (value == "references") return MODSRELATIONSHIP_references;
+    switch (value.size()) {
+        case 4:
+            if (value == "host") return MODSRELATIONSHIP_host;
+            break;
+        case 8:
+            if (value == "original") return MODSRELATIONSHIP_original;
+            break;
+        case 9:
+            if (value == "preceding") return MODSRELATIONSHIP_preceding;
+            break;
+        case 10:
+            if (value == "succeeding") return MODSRELATIONSHIP_succeeding;
+            if (value == "references") return MODSRELATIONSHIP_references;
+            break;
+        case 11:
+            if (value == "constituent") return MODSRELATIONSHIP_constituent;
+            if (value == "otherFormat") return MODSRELATIONSHIP_otherFormat;
+            break;
+        case 12:
+            if (value == "otherVersion") return MODSRELATIONSHIP_otherVersion;
+            break;
+        case 14:
+            if (value == "isReferencedBy") return MODSRELATIONSHIP_isReferencedBy;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.MODSRELATIONSHIP", value.c_str());
+        LogWarning("Unsupported value '%s' for data.MODSRELATIONSHIP", std::string(value).c_str());
     return MODSRELATIONSHIP_NONE;
 }
 
@@ -2134,23 +2614,38 @@ std::string AttConverter::NonstaffplaceToStr(data_NONSTAFFPLACE data) const
     return value;
 }
 
-data_NONSTAFFPLACE AttConverter::StrToNonstaffplace(std::string value, bool logWarning) const
+data_NONSTAFFPLACE AttConverter::StrToNonstaffplace(std::string_view value, bool logWarning) const
 {
-    if (value == "botmar") return NONSTAFFPLACE_botmar;
-    if (value == "topmar") return NONSTAFFPLACE_topmar;
-    if (value == "leftmar") return NONSTAFFPLACE_leftmar;
-    if (value == "rightmar") return NONSTAFFPLACE_rightmar;
-    if (value == "facing") return NONSTAFFPLACE_facing;
-    if (value == "overleaf") return NONSTAFFPLACE_overleaf;
-    if (value == "end") return NONSTAFFPLACE_end;
-    if (value == "inter") return NONSTAFFPLACE_inter;
-    if (value == "intra") return NONSTAFFPLACE_intra;
-    if (value == "super") return NONSTAFFPLACE_super;
-    if (value == "sub") return NONSTAFFPLACE_sub;
-    if (value == "inspace") return NONSTAFFPLACE_inspace;
-    if (value == "superimposed") return NONSTAFFPLACE_superimposed;
+    switch (value.size()) {
+        case 3:
+            if (value == "end") return NONSTAFFPLACE_end;
+            if (value == "sub") return NONSTAFFPLACE_sub;
+            break;
+        case 5:
+            if (value == "inter") return NONSTAFFPLACE_inter;
+            if (value == "intra") return NONSTAFFPLACE_intra;
+            if (value == "super") return NONSTAFFPLACE_super;
+            break;
+        case 6:
+            if (value == "botmar") return NONSTAFFPLACE_botmar;
+            if (value == "topmar") return NONSTAFFPLACE_topmar;
+            if (value == "facing") return NONSTAFFPLACE_facing;
+            break;
+        case 7:
+            if (value == "leftmar") return NONSTAFFPLACE_leftmar;
+            if (value == "inspace") return NONSTAFFPLACE_inspace;
+            break;
+        case 8:
+            if (value == "rightmar") return NONSTAFFPLACE_rightmar;
+            if (value == "overleaf") return NONSTAFFPLACE_overleaf;
+            break;
+        case 12:
+            if (value == "superimposed") return NONSTAFFPLACE_superimposed;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.NONSTAFFPLACE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.NONSTAFFPLACE", std::string(value).c_str());
     return NONSTAFFPLACE_NONE;
 }
 
@@ -2172,16 +2667,27 @@ std::string AttConverter::NotationtypeToStr(data_NOTATIONTYPE data) const
     return value;
 }
 
-data_NOTATIONTYPE AttConverter::StrToNotationtype(std::string value, bool logWarning) const
+data_NOTATIONTYPE AttConverter::StrToNotationtype(std::string_view value, bool logWarning) const
 {
-    if (value == "cmn") return NOTATIONTYPE_cmn;
-    if (value == "mensural") return NOTATIONTYPE_mensural;
-    if (value == "mensural.black") return NOTATIONTYPE_mensural_black;
-    if (value == "mensural.white") return NOTATIONTYPE_mensural_white;
-    if (value == "neume") return NOTATIONTYPE_neume;
-    if (value == "tab") return NOTATIONTYPE_tab;
+    switch (value.size()) {
+        case 3:
+            if (value == "cmn") return NOTATIONTYPE_cmn;
+            if (value == "tab") return NOTATIONTYPE_tab;
+            break;
+        case 5:
+            if (value == "neume") return NOTATIONTYPE_neume;
+            break;
+        case 8:
+            if (value == "mensural") return NOTATIONTYPE_mensural;
+            break;
+        case 14:
+            if (value == "mensural.black") return NOTATIONTYPE_mensural_black;
+            if (value == "mensural.white") return NOTATIONTYPE_mensural_white;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", value.c_str());
+        LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", std::string(value).c_str());
     return NOTATIONTYPE_NONE;
 }
 
@@ -2207,20 +2713,33 @@ std::string AttConverter::NoteheadmodifierToStr(data_NOTEHEADMODIFIER data) cons
     return value;
 }
 
-data_NOTEHEADMODIFIER AttConverter::StrToNoteheadmodifier(std::string value, bool logWarning) const
+data_NOTEHEADMODIFIER AttConverter::StrToNoteheadmodifier(std::string_view value, bool logWarning) const
 {
-    if (value == "slash") return NOTEHEADMODIFIER_slash;
-    if (value == "backslash") return NOTEHEADMODIFIER_backslash;
-    if (value == "vline") return NOTEHEADMODIFIER_vline;
-    if (value == "hline") return NOTEHEADMODIFIER_hline;
-    if (value == "centerdot") return NOTEHEADMODIFIER_centerdot;
-    if (value == "paren") return NOTEHEADMODIFIER_paren;
-    if (value == "brack") return NOTEHEADMODIFIER_brack;
-    if (value == "box") return NOTEHEADMODIFIER_box;
-    if (value == "circle") return NOTEHEADMODIFIER_circle;
-    if (value == "dblwhole") return NOTEHEADMODIFIER_dblwhole;
+    switch (value.size()) {
+        case 3:
+            if (value == "box") return NOTEHEADMODIFIER_box;
+            break;
+        case 5:
+            if (value == "slash") return NOTEHEADMODIFIER_slash;
+            if (value == "vline") return NOTEHEADMODIFIER_vline;
+            if (value == "hline") return NOTEHEADMODIFIER_hline;
+            if (value == "paren") return NOTEHEADMODIFIER_paren;
+            if (value == "brack") return NOTEHEADMODIFIER_brack;
+            break;
+        case 6:
+            if (value == "circle") return NOTEHEADMODIFIER_circle;
+            break;
+        case 8:
+            if (value == "dblwhole") return NOTEHEADMODIFIER_dblwhole;
+            break;
+        case 9:
+            if (value == "backslash") return NOTEHEADMODIFIER_backslash;
+            if (value == "centerdot") return NOTEHEADMODIFIER_centerdot;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER", value.c_str());
+        LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER", std::string(value).c_str());
     return NOTEHEADMODIFIER_NONE;
 }
 
@@ -2246,20 +2765,33 @@ std::string AttConverter::NoteheadmodifierListToStr(data_NOTEHEADMODIFIER_list d
     return value;
 }
 
-data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(std::string value, bool logWarning) const
+data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(std::string_view value, bool logWarning) const
 {
-    if (value == "slash") return NOTEHEADMODIFIER_list_slash;
-    if (value == "backslash") return NOTEHEADMODIFIER_list_backslash;
-    if (value == "vline") return NOTEHEADMODIFIER_list_vline;
-    if (value == "hline") return NOTEHEADMODIFIER_list_hline;
-    if (value == "centerdot") return NOTEHEADMODIFIER_list_centerdot;
-    if (value == "paren") return NOTEHEADMODIFIER_list_paren;
-    if (value == "brack") return NOTEHEADMODIFIER_list_brack;
-    if (value == "box") return NOTEHEADMODIFIER_list_box;
-    if (value == "circle") return NOTEHEADMODIFIER_list_circle;
-    if (value == "dblwhole") return NOTEHEADMODIFIER_list_dblwhole;
+    switch (value.size()) {
+        case 3:
+            if (value == "box") return NOTEHEADMODIFIER_list_box;
+            break;
+        case 5:
+            if (value == "slash") return NOTEHEADMODIFIER_list_slash;
+            if (value == "vline") return NOTEHEADMODIFIER_list_vline;
+            if (value == "hline") return NOTEHEADMODIFIER_list_hline;
+            if (value == "paren") return NOTEHEADMODIFIER_list_paren;
+            if (value == "brack") return NOTEHEADMODIFIER_list_brack;
+            break;
+        case 6:
+            if (value == "circle") return NOTEHEADMODIFIER_list_circle;
+            break;
+        case 8:
+            if (value == "dblwhole") return NOTEHEADMODIFIER_list_dblwhole;
+            break;
+        case 9:
+            if (value == "backslash") return NOTEHEADMODIFIER_list_backslash;
+            if (value == "centerdot") return NOTEHEADMODIFIER_list_centerdot;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", value.c_str());
+        LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", std::string(value).c_str());
     return NOTEHEADMODIFIER_list_NONE;
 }
 
@@ -2277,12 +2809,17 @@ std::string AttConverter::OtherstaffToStr(data_OTHERSTAFF data) const
     return value;
 }
 
-data_OTHERSTAFF AttConverter::StrToOtherstaff(std::string value, bool logWarning) const
+data_OTHERSTAFF AttConverter::StrToOtherstaff(std::string_view value, bool logWarning) const
 {
-    if (value == "above") return OTHERSTAFF_above;
-    if (value == "below") return OTHERSTAFF_below;
+    switch (value.size()) {
+        case 5:
+            if (value == "above") return OTHERSTAFF_above;
+            if (value == "below") return OTHERSTAFF_below;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.OTHERSTAFF", value.c_str());
+        LogWarning("Unsupported value '%s' for data.OTHERSTAFF", std::string(value).c_str());
     return OTHERSTAFF_NONE;
 }
 
@@ -2343,55 +2880,86 @@ std::string AttConverter::RelationshipToStr(data_RELATIONSHIP data) const
     return value;
 }
 
-data_RELATIONSHIP AttConverter::StrToRelationship(std::string value, bool logWarning) const
-{
-    if (value == "hasAbridgement") return RELATIONSHIP_hasAbridgement;
-    if (value == "isAbridgementOf") return RELATIONSHIP_isAbridgementOf;
-    if (value == "hasAdaptation") return RELATIONSHIP_hasAdaptation;
-    if (value == "isAdaptationOf") return RELATIONSHIP_isAdaptationOf;
-    if (value == "hasAlternate") return RELATIONSHIP_hasAlternate;
-    if (value == "isAlternateOf") return RELATIONSHIP_isAlternateOf;
-    if (value == "hasArrangement") return RELATIONSHIP_hasArrangement;
-    if (value == "isArrangementOf") return RELATIONSHIP_isArrangementOf;
-    if (value == "hasComplement") return RELATIONSHIP_hasComplement;
-    if (value == "isComplementOf") return RELATIONSHIP_isComplementOf;
-    if (value == "hasEmbodiment") return RELATIONSHIP_hasEmbodiment;
-    if (value == "isEmbodimentOf") return RELATIONSHIP_isEmbodimentOf;
-    if (value == "hasExemplar") return RELATIONSHIP_hasExemplar;
-    if (value == "isExemplarOf") return RELATIONSHIP_isExemplarOf;
-    if (value == "hasImitation") return RELATIONSHIP_hasImitation;
-    if (value == "isImitationOf") return RELATIONSHIP_isImitationOf;
-    if (value == "hasPart") return RELATIONSHIP_hasPart;
-    if (value == "isPartOf") return RELATIONSHIP_isPartOf;
-    if (value == "hasRealization") return RELATIONSHIP_hasRealization;
-    if (value == "isRealizationOf") return RELATIONSHIP_isRealizationOf;
-    if (value == "hasReconfiguration") return RELATIONSHIP_hasReconfiguration;
-    if (value == "isReconfigurationOf") return RELATIONSHIP_isReconfigurationOf;
-    if (value == "hasReproduction") return RELATIONSHIP_hasReproduction;
-    if (value == "isReproductionOf") return RELATIONSHIP_isReproductionOf;
-    if (value == "hasRevision") return RELATIONSHIP_hasRevision;
-    if (value == "isRevisionOf") return RELATIONSHIP_isRevisionOf;
-    if (value == "hasSuccessor") return RELATIONSHIP_hasSuccessor;
-    if (value == "isSuccessorOf") return RELATIONSHIP_isSuccessorOf;
-    if (value == "hasSummarization") return RELATIONSHIP_hasSummarization;
-    if (value == "isSummarizationOf") return RELATIONSHIP_isSummarizationOf;
-    if (value == "hasSupplement") return RELATIONSHIP_hasSupplement;
-    if (value == "isSupplementOf") return RELATIONSHIP_isSupplementOf;
-    if (value == "hasTransformation") return RELATIONSHIP_hasTransformation;
-    if (value == "isTransformationOf") return RELATIONSHIP_isTransformationOf;
-    if (value == "hasTranslation") return RELATIONSHIP_hasTranslation;
-    if (value == "isTranslationOf") return RELATIONSHIP_isTranslationOf;
-    if (value == "preceding") return RELATIONSHIP_preceding;
-    if (value == "succeeding") return RELATIONSHIP_succeeding;
-    if (value == "original") return RELATIONSHIP_original;
-    if (value == "host") return RELATIONSHIP_host;
-    if (value == "constituent") return RELATIONSHIP_constituent;
-    if (value == "otherVersion") return RELATIONSHIP_otherVersion;
-    if (value == "otherFormat") return RELATIONSHIP_otherFormat;
-    if (value == "isReferencedBy") return RELATIONSHIP_isReferencedBy;
-    if (value == "references") return RELATIONSHIP_references;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.RELATIONSHIP", value.c_str());
+data_RELATIONSHIP AttConverter::StrToRelationship(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 4:
+            if (value == "host") return RELATIONSHIP_host;
+            break;
+        case 7:
+            if (value == "hasPart") return RELATIONSHIP_hasPart;
+            break;
+        case 8:
+            if (value == "isPartOf") return RELATIONSHIP_isPartOf;
+            if (value == "original") return RELATIONSHIP_original;
+            break;
+        case 9:
+            if (value == "preceding") return RELATIONSHIP_preceding;
+            break;
+        case 10:
+            if (value == "succeeding") return RELATIONSHIP_succeeding;
+            if (value == "references") return RELATIONSHIP_references;
+            break;
+        case 11:
+            if (value == "hasExemplar") return RELATIONSHIP_hasExemplar;
+            if (value == "hasRevision") return RELATIONSHIP_hasRevision;
+            if (value == "constituent") return RELATIONSHIP_constituent;
+            if (value == "otherFormat") return RELATIONSHIP_otherFormat;
+            break;
+        case 12:
+            if (value == "hasAlternate") return RELATIONSHIP_hasAlternate;
+            if (value == "isExemplarOf") return RELATIONSHIP_isExemplarOf;
+            if (value == "hasImitation") return RELATIONSHIP_hasImitation;
+            if (value == "isRevisionOf") return RELATIONSHIP_isRevisionOf;
+            if (value == "hasSuccessor") return RELATIONSHIP_hasSuccessor;
+            if (value == "otherVersion") return RELATIONSHIP_otherVersion;
+            break;
+        case 13:
+            if (value == "hasAdaptation") return RELATIONSHIP_hasAdaptation;
+            if (value == "isAlternateOf") return RELATIONSHIP_isAlternateOf;
+            if (value == "hasComplement") return RELATIONSHIP_hasComplement;
+            if (value == "hasEmbodiment") return RELATIONSHIP_hasEmbodiment;
+            if (value == "isImitationOf") return RELATIONSHIP_isImitationOf;
+            if (value == "isSuccessorOf") return RELATIONSHIP_isSuccessorOf;
+            if (value == "hasSupplement") return RELATIONSHIP_hasSupplement;
+            break;
+        case 14:
+            if (value == "hasAbridgement") return RELATIONSHIP_hasAbridgement;
+            if (value == "isAdaptationOf") return RELATIONSHIP_isAdaptationOf;
+            if (value == "hasArrangement") return RELATIONSHIP_hasArrangement;
+            if (value == "isComplementOf") return RELATIONSHIP_isComplementOf;
+            if (value == "isEmbodimentOf") return RELATIONSHIP_isEmbodimentOf;
+            if (value == "hasRealization") return RELATIONSHIP_hasRealization;
+            if (value == "isSupplementOf") return RELATIONSHIP_isSupplementOf;
+            if (value == "hasTranslation") return RELATIONSHIP_hasTranslation;
+            if (value == "isReferencedBy") return RELATIONSHIP_isReferencedBy;
+            break;
+        case 15:
+            if (value == "isAbridgementOf") return RELATIONSHIP_isAbridgementOf;
+            if (value == "isArrangementOf") return RELATIONSHIP_isArrangementOf;
+            if (value == "isRealizationOf") return RELATIONSHIP_isRealizationOf;
+            if (value == "hasReproduction") return RELATIONSHIP_hasReproduction;
+            if (value == "isTranslationOf") return RELATIONSHIP_isTranslationOf;
+            break;
+        case 16:
+            if (value == "isReproductionOf") return RELATIONSHIP_isReproductionOf;
+            if (value == "hasSummarization") return RELATIONSHIP_hasSummarization;
+            break;
+        case 17:
+            if (value == "isSummarizationOf") return RELATIONSHIP_isSummarizationOf;
+            if (value == "hasTransformation") return RELATIONSHIP_hasTransformation;
+            break;
+        case 18:
+            if (value == "hasReconfiguration") return RELATIONSHIP_hasReconfiguration;
+            if (value == "isTransformationOf") return RELATIONSHIP_isTransformationOf;
+            break;
+        case 19:
+            if (value == "isReconfigurationOf") return RELATIONSHIP_isReconfigurationOf;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.RELATIONSHIP", std::string(value).c_str());
     return RELATIONSHIP_NONE;
 }
 
@@ -2414,17 +2982,24 @@ std::string AttConverter::RotationToStr(data_ROTATION data) const
     return value;
 }
 
-data_ROTATION AttConverter::StrToRotation(std::string value, bool logWarning) const
+data_ROTATION AttConverter::StrToRotation(std::string_view value, bool logWarning) const
 {
-    if (value == "none") return ROTATION_none;
-    if (value == "down") return ROTATION_down;
-    if (value == "left") return ROTATION_left;
-    if (value == "ne") return ROTATION_ne;
-    if (value == "nw") return ROTATION_nw;
-    if (value == "se") return ROTATION_se;
-    if (value == "sw") return ROTATION_sw;
+    switch (value.size()) {
+        case 2:
+            if (value == "ne") return ROTATION_ne;
+            if (value == "nw") return ROTATION_nw;
+            if (value == "se") return ROTATION_se;
+            if (value == "sw") return ROTATION_sw;
+            break;
+        case 4:
+            if (value == "none") return ROTATION_none;
+            if (value == "down") return ROTATION_down;
+            if (value == "left") return ROTATION_left;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ROTATION", value.c_str());
+        LogWarning("Unsupported value '%s' for data.ROTATION", std::string(value).c_str());
     return ROTATION_NONE;
 }
 
@@ -2447,17 +3022,24 @@ std::string AttConverter::RotationdirectionToStr(data_ROTATIONDIRECTION data) co
     return value;
 }
 
-data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(std::string value, bool logWarning) const
+data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(std::string_view value, bool logWarning) const
 {
-    if (value == "none") return ROTATIONDIRECTION_none;
-    if (value == "down") return ROTATIONDIRECTION_down;
-    if (value == "left") return ROTATIONDIRECTION_left;
-    if (value == "ne") return ROTATIONDIRECTION_ne;
-    if (value == "nw") return ROTATIONDIRECTION_nw;
-    if (value == "se") return ROTATIONDIRECTION_se;
-    if (value == "sw") return ROTATIONDIRECTION_sw;
+    switch (value.size()) {
+        case 2:
+            if (value == "ne") return ROTATIONDIRECTION_ne;
+            if (value == "nw") return ROTATIONDIRECTION_nw;
+            if (value == "se") return ROTATIONDIRECTION_se;
+            if (value == "sw") return ROTATIONDIRECTION_sw;
+            break;
+        case 4:
+            if (value == "none") return ROTATIONDIRECTION_none;
+            if (value == "down") return ROTATIONDIRECTION_down;
+            if (value == "left") return ROTATIONDIRECTION_left;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.ROTATIONDIRECTION", value.c_str());
+        LogWarning("Unsupported value '%s' for data.ROTATIONDIRECTION", std::string(value).c_str());
     return ROTATIONDIRECTION_NONE;
 }
 
@@ -2502,39 +3084,60 @@ std::string AttConverter::StaffitemToStr(data_STAFFITEM data) const
     return value;
 }
 
-data_STAFFITEM AttConverter::StrToStaffitem(std::string value, bool logWarning) const
-{
-    if (value == "accid") return STAFFITEM_accid;
-    if (value == "annot") return STAFFITEM_annot;
-    if (value == "artic") return STAFFITEM_artic;
-    if (value == "dir") return STAFFITEM_dir;
-    if (value == "dynam") return STAFFITEM_dynam;
-    if (value == "harm") return STAFFITEM_harm;
-    if (value == "ornam") return STAFFITEM_ornam;
-    if (value == "sp") return STAFFITEM_sp;
-    if (value == "stageDir") return STAFFITEM_stageDir;
-    if (value == "tempo") return STAFFITEM_tempo;
-    if (value == "beam") return STAFFITEM_beam;
-    if (value == "bend") return STAFFITEM_bend;
-    if (value == "bracketSpan") return STAFFITEM_bracketSpan;
-    if (value == "breath") return STAFFITEM_breath;
-    if (value == "cpMark") return STAFFITEM_cpMark;
-    if (value == "fermata") return STAFFITEM_fermata;
-    if (value == "fing") return STAFFITEM_fing;
-    if (value == "hairpin") return STAFFITEM_hairpin;
-    if (value == "harpPedal") return STAFFITEM_harpPedal;
-    if (value == "lv") return STAFFITEM_lv;
-    if (value == "mordent") return STAFFITEM_mordent;
-    if (value == "octave") return STAFFITEM_octave;
-    if (value == "pedal") return STAFFITEM_pedal;
-    if (value == "reh") return STAFFITEM_reh;
-    if (value == "tie") return STAFFITEM_tie;
-    if (value == "trill") return STAFFITEM_trill;
-    if (value == "tuplet") return STAFFITEM_tuplet;
-    if (value == "turn") return STAFFITEM_turn;
-    if (value == "ligature") return STAFFITEM_ligature;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFITEM", value.c_str());
+data_STAFFITEM AttConverter::StrToStaffitem(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 2:
+            if (value == "sp") return STAFFITEM_sp;
+            if (value == "lv") return STAFFITEM_lv;
+            break;
+        case 3:
+            if (value == "dir") return STAFFITEM_dir;
+            if (value == "reh") return STAFFITEM_reh;
+            if (value == "tie") return STAFFITEM_tie;
+            break;
+        case 4:
+            if (value == "harm") return STAFFITEM_harm;
+            if (value == "beam") return STAFFITEM_beam;
+            if (value == "bend") return STAFFITEM_bend;
+            if (value == "fing") return STAFFITEM_fing;
+            if (value == "turn") return STAFFITEM_turn;
+            break;
+        case 5:
+            if (value == "accid") return STAFFITEM_accid;
+            if (value == "annot") return STAFFITEM_annot;
+            if (value == "artic") return STAFFITEM_artic;
+            if (value == "dynam") return STAFFITEM_dynam;
+            if (value == "ornam") return STAFFITEM_ornam;
+            if (value == "tempo") return STAFFITEM_tempo;
+            if (value == "pedal") return STAFFITEM_pedal;
+            if (value == "trill") return STAFFITEM_trill;
+            break;
+        case 6:
+            if (value == "breath") return STAFFITEM_breath;
+            if (value == "cpMark") return STAFFITEM_cpMark;
+            if (value == "octave") return STAFFITEM_octave;
+            if (value == "tuplet") return STAFFITEM_tuplet;
+            break;
+        case 7:
+            if (value == "fermata") return STAFFITEM_fermata;
+            if (value == "hairpin") return STAFFITEM_hairpin;
+            if (value == "mordent") return STAFFITEM_mordent;
+            break;
+        case 8:
+            if (value == "stageDir") return STAFFITEM_stageDir;
+            if (value == "ligature") return STAFFITEM_ligature;
+            break;
+        case 9:
+            if (value == "harpPedal") return STAFFITEM_harpPedal;
+            break;
+        case 11:
+            if (value == "bracketSpan") return STAFFITEM_bracketSpan;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.STAFFITEM", std::string(value).c_str());
     return STAFFITEM_NONE;
 }
 
@@ -2560,20 +3163,33 @@ std::string AttConverter::StaffitemBasicToStr(data_STAFFITEM_basic data) const
     return value;
 }
 
-data_STAFFITEM_basic AttConverter::StrToStaffitemBasic(std::string value, bool logWarning) const
+data_STAFFITEM_basic AttConverter::StrToStaffitemBasic(std::string_view value, bool logWarning) const
 {
-    if (value == "accid") return STAFFITEM_basic_accid;
-    if (value == "annot") return STAFFITEM_basic_annot;
-    if (value == "artic") return STAFFITEM_basic_artic;
-    if (value == "dir") return STAFFITEM_basic_dir;
-    if (value == "dynam") return STAFFITEM_basic_dynam;
-    if (value == "harm") return STAFFITEM_basic_harm;
-    if (value == "ornam") return STAFFITEM_basic_ornam;
-    if (value == "sp") return STAFFITEM_basic_sp;
-    if (value == "stageDir") return STAFFITEM_basic_stageDir;
-    if (value == "tempo") return STAFFITEM_basic_tempo;
+    switch (value.size()) {
+        case 2:
+            if (value == "sp") return STAFFITEM_basic_sp;
+            break;
+        case 3:
+            if (value == "dir") return STAFFITEM_basic_dir;
+            break;
+        case 4:
+            if (value == "harm") return STAFFITEM_basic_harm;
+            break;
+        case 5:
+            if (value == "accid") return STAFFITEM_basic_accid;
+            if (value == "annot") return STAFFITEM_basic_annot;
+            if (value == "artic") return STAFFITEM_basic_artic;
+            if (value == "dynam") return STAFFITEM_basic_dynam;
+            if (value == "ornam") return STAFFITEM_basic_ornam;
+            if (value == "tempo") return STAFFITEM_basic_tempo;
+            break;
+        case 8:
+            if (value == "stageDir") return STAFFITEM_basic_stageDir;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFITEM.basic", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STAFFITEM.basic", std::string(value).c_str());
     return STAFFITEM_basic_NONE;
 }
 
@@ -2607,28 +3223,47 @@ std::string AttConverter::StaffitemCmnToStr(data_STAFFITEM_cmn data) const
     return value;
 }
 
-data_STAFFITEM_cmn AttConverter::StrToStaffitemCmn(std::string value, bool logWarning) const
+data_STAFFITEM_cmn AttConverter::StrToStaffitemCmn(std::string_view value, bool logWarning) const
 {
-    if (value == "beam") return STAFFITEM_cmn_beam;
-    if (value == "bend") return STAFFITEM_cmn_bend;
-    if (value == "bracketSpan") return STAFFITEM_cmn_bracketSpan;
-    if (value == "breath") return STAFFITEM_cmn_breath;
-    if (value == "cpMark") return STAFFITEM_cmn_cpMark;
-    if (value == "fermata") return STAFFITEM_cmn_fermata;
-    if (value == "fing") return STAFFITEM_cmn_fing;
-    if (value == "hairpin") return STAFFITEM_cmn_hairpin;
-    if (value == "harpPedal") return STAFFITEM_cmn_harpPedal;
-    if (value == "lv") return STAFFITEM_cmn_lv;
-    if (value == "mordent") return STAFFITEM_cmn_mordent;
-    if (value == "octave") return STAFFITEM_cmn_octave;
-    if (value == "pedal") return STAFFITEM_cmn_pedal;
-    if (value == "reh") return STAFFITEM_cmn_reh;
-    if (value == "tie") return STAFFITEM_cmn_tie;
-    if (value == "trill") return STAFFITEM_cmn_trill;
-    if (value == "tuplet") return STAFFITEM_cmn_tuplet;
-    if (value == "turn") return STAFFITEM_cmn_turn;
+    switch (value.size()) {
+        case 2:
+            if (value == "lv") return STAFFITEM_cmn_lv;
+            break;
+        case 3:
+            if (value == "reh") return STAFFITEM_cmn_reh;
+            if (value == "tie") return STAFFITEM_cmn_tie;
+            break;
+        case 4:
+            if (value == "beam") return STAFFITEM_cmn_beam;
+            if (value == "bend") return STAFFITEM_cmn_bend;
+            if (value == "fing") return STAFFITEM_cmn_fing;
+            if (value == "turn") return STAFFITEM_cmn_turn;
+            break;
+        case 5:
+            if (value == "pedal") return STAFFITEM_cmn_pedal;
+            if (value == "trill") return STAFFITEM_cmn_trill;
+            break;
+        case 6:
+            if (value == "breath") return STAFFITEM_cmn_breath;
+            if (value == "cpMark") return STAFFITEM_cmn_cpMark;
+            if (value == "octave") return STAFFITEM_cmn_octave;
+            if (value == "tuplet") return STAFFITEM_cmn_tuplet;
+            break;
+        case 7:
+            if (value == "fermata") return STAFFITEM_cmn_fermata;
+            if (value == "hairpin") return STAFFITEM_cmn_hairpin;
+            if (value == "mordent") return STAFFITEM_cmn_mordent;
+            break;
+        case 9:
+            if (value == "harpPedal") return STAFFITEM_cmn_harpPedal;
+            break;
+        case 11:
+            if (value == "bracketSpan") return STAFFITEM_cmn_bracketSpan;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFITEM.cmn", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STAFFITEM.cmn", std::string(value).c_str());
     return STAFFITEM_cmn_NONE;
 }
 
@@ -2645,11 +3280,16 @@ std::string AttConverter::StaffitemMensuralToStr(data_STAFFITEM_mensural data) c
     return value;
 }
 
-data_STAFFITEM_mensural AttConverter::StrToStaffitemMensural(std::string value, bool logWarning) const
+data_STAFFITEM_mensural AttConverter::StrToStaffitemMensural(std::string_view value, bool logWarning) const
 {
-    if (value == "ligature") return STAFFITEM_mensural_ligature;
+    switch (value.size()) {
+        case 8:
+            if (value == "ligature") return STAFFITEM_mensural_ligature;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFITEM.mensural", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STAFFITEM.mensural", std::string(value).c_str());
     return STAFFITEM_mensural_NONE;
 }
 
@@ -2669,14 +3309,23 @@ std::string AttConverter::StaffrelToStr(data_STAFFREL data) const
     return value;
 }
 
-data_STAFFREL AttConverter::StrToStaffrel(std::string value, bool logWarning) const
+data_STAFFREL AttConverter::StrToStaffrel(std::string_view value, bool logWarning) const
 {
-    if (value == "above") return STAFFREL_above;
-    if (value == "below") return STAFFREL_below;
-    if (value == "between") return STAFFREL_between;
-    if (value == "within") return STAFFREL_within;
+    switch (value.size()) {
+        case 5:
+            if (value == "above") return STAFFREL_above;
+            if (value == "below") return STAFFREL_below;
+            break;
+        case 6:
+            if (value == "within") return STAFFREL_within;
+            break;
+        case 7:
+            if (value == "between") return STAFFREL_between;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFREL", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STAFFREL", std::string(value).c_str());
     return STAFFREL_NONE;
 }
 
@@ -2694,12 +3343,17 @@ std::string AttConverter::StaffrelBasicToStr(data_STAFFREL_basic data) const
     return value;
 }
 
-data_STAFFREL_basic AttConverter::StrToStaffrelBasic(std::string value, bool logWarning) const
+data_STAFFREL_basic AttConverter::StrToStaffrelBasic(std::string_view value, bool logWarning) const
 {
-    if (value == "above") return STAFFREL_basic_above;
-    if (value == "below") return STAFFREL_basic_below;
+    switch (value.size()) {
+        case 5:
+            if (value == "above") return STAFFREL_basic_above;
+            if (value == "below") return STAFFREL_basic_below;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFREL.basic", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STAFFREL.basic", std::string(value).c_str());
     return STAFFREL_basic_NONE;
 }
 
@@ -2717,12 +3371,19 @@ std::string AttConverter::StaffrelExtendedToStr(data_STAFFREL_extended data) con
     return value;
 }
 
-data_STAFFREL_extended AttConverter::StrToStaffrelExtended(std::string value, bool logWarning) const
+data_STAFFREL_extended AttConverter::StrToStaffrelExtended(std::string_view value, bool logWarning) const
 {
-    if (value == "between") return STAFFREL_extended_between;
-    if (value == "within") return STAFFREL_extended_within;
+    switch (value.size()) {
+        case 6:
+            if (value == "within") return STAFFREL_extended_within;
+            break;
+        case 7:
+            if (value == "between") return STAFFREL_extended_between;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STAFFREL.extended", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STAFFREL.extended", std::string(value).c_str());
     return STAFFREL_extended_NONE;
 }
 
@@ -2746,18 +3407,27 @@ std::string AttConverter::StemdirectionToStr(data_STEMDIRECTION data) const
     return value;
 }
 
-data_STEMDIRECTION AttConverter::StrToStemdirection(std::string value, bool logWarning) const
+data_STEMDIRECTION AttConverter::StrToStemdirection(std::string_view value, bool logWarning) const
 {
-    if (value == "up") return STEMDIRECTION_up;
-    if (value == "down") return STEMDIRECTION_down;
-    if (value == "left") return STEMDIRECTION_left;
-    if (value == "right") return STEMDIRECTION_right;
-    if (value == "ne") return STEMDIRECTION_ne;
-    if (value == "se") return STEMDIRECTION_se;
-    if (value == "nw") return STEMDIRECTION_nw;
-    if (value == "sw") return STEMDIRECTION_sw;
+    switch (value.size()) {
+        case 2:
+            if (value == "up") return STEMDIRECTION_up;
+            if (value == "ne") return STEMDIRECTION_ne;
+            if (value == "se") return STEMDIRECTION_se;
+            if (value == "nw") return STEMDIRECTION_nw;
+            if (value == "sw") return STEMDIRECTION_sw;
+            break;
+        case 4:
+            if (value == "down") return STEMDIRECTION_down;
+            if (value == "left") return STEMDIRECTION_left;
+            break;
+        case 5:
+            if (value == "right") return STEMDIRECTION_right;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMDIRECTION", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STEMDIRECTION", std::string(value).c_str());
     return STEMDIRECTION_NONE;
 }
 
@@ -2775,12 +3445,19 @@ std::string AttConverter::StemdirectionBasicToStr(data_STEMDIRECTION_basic data)
     return value;
 }
 
-data_STEMDIRECTION_basic AttConverter::StrToStemdirectionBasic(std::string value, bool logWarning) const
+data_STEMDIRECTION_basic AttConverter::StrToStemdirectionBasic(std::string_view value, bool logWarning) const
 {
-    if (value == "up") return STEMDIRECTION_basic_up;
-    if (value == "down") return STEMDIRECTION_basic_down;
+    switch (value.size()) {
+        case 2:
+            if (value == "up") return STEMDIRECTION_basic_up;
+            break;
+        case 4:
+            if (value == "down") return STEMDIRECTION_basic_down;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMDIRECTION.basic", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STEMDIRECTION.basic", std::string(value).c_str());
     return STEMDIRECTION_basic_NONE;
 }
 
@@ -2802,16 +3479,25 @@ std::string AttConverter::StemdirectionExtendedToStr(data_STEMDIRECTION_extended
     return value;
 }
 
-data_STEMDIRECTION_extended AttConverter::StrToStemdirectionExtended(std::string value, bool logWarning) const
+data_STEMDIRECTION_extended AttConverter::StrToStemdirectionExtended(std::string_view value, bool logWarning) const
 {
-    if (value == "left") return STEMDIRECTION_extended_left;
-    if (value == "right") return STEMDIRECTION_extended_right;
-    if (value == "ne") return STEMDIRECTION_extended_ne;
-    if (value == "se") return STEMDIRECTION_extended_se;
-    if (value == "nw") return STEMDIRECTION_extended_nw;
-    if (value == "sw") return STEMDIRECTION_extended_sw;
+    switch (value.size()) {
+        case 2:
+            if (value == "ne") return STEMDIRECTION_extended_ne;
+            if (value == "se") return STEMDIRECTION_extended_se;
+            if (value == "nw") return STEMDIRECTION_extended_nw;
+            if (value == "sw") return STEMDIRECTION_extended_sw;
+            break;
+        case 4:
+            if (value == "left") return STEMDIRECTION_extended_left;
+            break;
+        case 5:
+            if (value == "right") return STEMDIRECTION_extended_right;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMDIRECTION.extended", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STEMDIRECTION.extended", std::string(value).c_str());
     return STEMDIRECTION_extended_NONE;
 }
 
@@ -2836,19 +3522,28 @@ std::string AttConverter::StemmodifierToStr(data_STEMMODIFIER data) const
     return value;
 }
 
-data_STEMMODIFIER AttConverter::StrToStemmodifier(std::string value, bool logWarning) const
+data_STEMMODIFIER AttConverter::StrToStemmodifier(std::string_view value, bool logWarning) const
 {
-    if (value == "none") return STEMMODIFIER_none;
-    if (value == "1slash") return STEMMODIFIER_1slash;
-    if (value == "2slash") return STEMMODIFIER_2slash;
-    if (value == "3slash") return STEMMODIFIER_3slash;
-    if (value == "4slash") return STEMMODIFIER_4slash;
-    if (value == "5slash") return STEMMODIFIER_5slash;
-    if (value == "6slash") return STEMMODIFIER_6slash;
-    if (value == "sprech") return STEMMODIFIER_sprech;
-    if (value == "z") return STEMMODIFIER_z;
+    switch (value.size()) {
+        case 1:
+            if (value == "z") return STEMMODIFIER_z;
+            break;
+        case 4:
+            if (value == "none") return STEMMODIFIER_none;
+            break;
+        case 6:
+            if (value == "1slash") return STEMMODIFIER_1slash;
+            if (value == "2slash") return STEMMODIFIER_2slash;
+            if (value == "3slash") return STEMMODIFIER_3slash;
+            if (value == "4slash") return STEMMODIFIER_4slash;
+            if (value == "5slash") return STEMMODIFIER_5slash;
+            if (value == "6slash") return STEMMODIFIER_6slash;
+            if (value == "sprech") return STEMMODIFIER_sprech;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMMODIFIER", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STEMMODIFIER", std::string(value).c_str());
     return STEMMODIFIER_NONE;
 }
 
@@ -2867,13 +3562,22 @@ std::string AttConverter::StempositionToStr(data_STEMPOSITION data) const
     return value;
 }
 
-data_STEMPOSITION AttConverter::StrToStemposition(std::string value, bool logWarning) const
+data_STEMPOSITION AttConverter::StrToStemposition(std::string_view value, bool logWarning) const
 {
-    if (value == "left") return STEMPOSITION_left;
-    if (value == "right") return STEMPOSITION_right;
-    if (value == "center") return STEMPOSITION_center;
+    switch (value.size()) {
+        case 4:
+            if (value == "left") return STEMPOSITION_left;
+            break;
+        case 5:
+            if (value == "right") return STEMPOSITION_right;
+            break;
+        case 6:
+            if (value == "center") return STEMPOSITION_center;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.STEMPOSITION", value.c_str());
+        LogWarning("Unsupported value '%s' for data.STEMPOSITION", std::string(value).c_str());
     return STEMPOSITION_NONE;
 }
 
@@ -2893,14 +3597,23 @@ std::string AttConverter::TemperamentToStr(data_TEMPERAMENT data) const
     return value;
 }
 
-data_TEMPERAMENT AttConverter::StrToTemperament(std::string value, bool logWarning) const
+data_TEMPERAMENT AttConverter::StrToTemperament(std::string_view value, bool logWarning) const
 {
-    if (value == "equal") return TEMPERAMENT_equal;
-    if (value == "just") return TEMPERAMENT_just;
-    if (value == "mean") return TEMPERAMENT_mean;
-    if (value == "pythagorean") return TEMPERAMENT_pythagorean;
+    switch (value.size()) {
+        case 4:
+            if (value == "just") return TEMPERAMENT_just;
+            if (value == "mean") return TEMPERAMENT_mean;
+            break;
+        case 5:
+            if (value == "equal") return TEMPERAMENT_equal;
+            break;
+        case 11:
+            if (value == "pythagorean") return TEMPERAMENT_pythagorean;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.TEMPERAMENT", value.c_str());
+        LogWarning("Unsupported value '%s' for data.TEMPERAMENT", std::string(value).c_str());
     return TEMPERAMENT_NONE;
 }
 
@@ -2944,38 +3657,61 @@ std::string AttConverter::TextrenditionToStr(data_TEXTRENDITION data) const
     return value;
 }
 
-data_TEXTRENDITION AttConverter::StrToTextrendition(std::string value, bool logWarning) const
-{
-    if (value == "quote") return TEXTRENDITION_quote;
-    if (value == "quotedbl") return TEXTRENDITION_quotedbl;
-    if (value == "italic") return TEXTRENDITION_italic;
-    if (value == "oblique") return TEXTRENDITION_oblique;
-    if (value == "smcaps") return TEXTRENDITION_smcaps;
-    if (value == "bold") return TEXTRENDITION_bold;
-    if (value == "bolder") return TEXTRENDITION_bolder;
-    if (value == "lighter") return TEXTRENDITION_lighter;
-    if (value == "box") return TEXTRENDITION_box;
-    if (value == "circle") return TEXTRENDITION_circle;
-    if (value == "dbox") return TEXTRENDITION_dbox;
-    if (value == "tbox") return TEXTRENDITION_tbox;
-    if (value == "bslash") return TEXTRENDITION_bslash;
-    if (value == "fslash") return TEXTRENDITION_fslash;
-    if (value == "line-through") return TEXTRENDITION_line_through;
-    if (value == "none") return TEXTRENDITION_none;
-    if (value == "overline") return TEXTRENDITION_overline;
-    if (value == "overstrike") return TEXTRENDITION_overstrike;
-    if (value == "strike") return TEXTRENDITION_strike;
-    if (value == "sub") return TEXTRENDITION_sub;
-    if (value == "sup") return TEXTRENDITION_sup;
-    if (value == "superimpose") return TEXTRENDITION_superimpose;
-    if (value == "underline") return TEXTRENDITION_underline;
-    if (value == "x-through") return TEXTRENDITION_x_through;
-    if (value == "ltr") return TEXTRENDITION_ltr;
-    if (value == "rtl") return TEXTRENDITION_rtl;
-    if (value == "lro") return TEXTRENDITION_lro;
-    if (value == "rlo") return TEXTRENDITION_rlo;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.TEXTRENDITION", value.c_str());
+data_TEXTRENDITION AttConverter::StrToTextrendition(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 3:
+            if (value == "box") return TEXTRENDITION_box;
+            if (value == "sub") return TEXTRENDITION_sub;
+            if (value == "sup") return TEXTRENDITION_sup;
+            if (value == "ltr") return TEXTRENDITION_ltr;
+            if (value == "rtl") return TEXTRENDITION_rtl;
+            if (value == "lro") return TEXTRENDITION_lro;
+            if (value == "rlo") return TEXTRENDITION_rlo;
+            break;
+        case 4:
+            if (value == "bold") return TEXTRENDITION_bold;
+            if (value == "dbox") return TEXTRENDITION_dbox;
+            if (value == "tbox") return TEXTRENDITION_tbox;
+            if (value == "none") return TEXTRENDITION_none;
+            break;
+        case 5:
+            if (value == "quote") return TEXTRENDITION_quote;
+            break;
+        case 6:
+            if (value == "italic") return TEXTRENDITION_italic;
+            if (value == "smcaps") return TEXTRENDITION_smcaps;
+            if (value == "bolder") return TEXTRENDITION_bolder;
+            if (value == "circle") return TEXTRENDITION_circle;
+            if (value == "bslash") return TEXTRENDITION_bslash;
+            if (value == "fslash") return TEXTRENDITION_fslash;
+            if (value == "strike") return TEXTRENDITION_strike;
+            break;
+        case 7:
+            if (value == "oblique") return TEXTRENDITION_oblique;
+            if (value == "lighter") return TEXTRENDITION_lighter;
+            break;
+        case 8:
+            if (value == "quotedbl") return TEXTRENDITION_quotedbl;
+            if (value == "overline") return TEXTRENDITION_overline;
+            break;
+        case 9:
+            if (value == "underline") return TEXTRENDITION_underline;
+            if (value == "x-through") return TEXTRENDITION_x_through;
+            break;
+        case 10:
+            if (value == "overstrike") return TEXTRENDITION_overstrike;
+            break;
+        case 11:
+            if (value == "superimpose") return TEXTRENDITION_superimpose;
+            break;
+        case 12:
+            if (value == "line-through") return TEXTRENDITION_line_through;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.TEXTRENDITION", std::string(value).c_str());
     return TEXTRENDITION_NONE;
 }
 
@@ -3019,38 +3755,61 @@ std::string AttConverter::TextrenditionlistToStr(data_TEXTRENDITIONLIST data) co
     return value;
 }
 
-data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(std::string value, bool logWarning) const
-{
-    if (value == "quote") return TEXTRENDITIONLIST_quote;
-    if (value == "quotedbl") return TEXTRENDITIONLIST_quotedbl;
-    if (value == "italic") return TEXTRENDITIONLIST_italic;
-    if (value == "oblique") return TEXTRENDITIONLIST_oblique;
-    if (value == "smcaps") return TEXTRENDITIONLIST_smcaps;
-    if (value == "bold") return TEXTRENDITIONLIST_bold;
-    if (value == "bolder") return TEXTRENDITIONLIST_bolder;
-    if (value == "lighter") return TEXTRENDITIONLIST_lighter;
-    if (value == "box") return TEXTRENDITIONLIST_box;
-    if (value == "circle") return TEXTRENDITIONLIST_circle;
-    if (value == "dbox") return TEXTRENDITIONLIST_dbox;
-    if (value == "tbox") return TEXTRENDITIONLIST_tbox;
-    if (value == "bslash") return TEXTRENDITIONLIST_bslash;
-    if (value == "fslash") return TEXTRENDITIONLIST_fslash;
-    if (value == "line-through") return TEXTRENDITIONLIST_line_through;
-    if (value == "none") return TEXTRENDITIONLIST_none;
-    if (value == "overline") return TEXTRENDITIONLIST_overline;
-    if (value == "overstrike") return TEXTRENDITIONLIST_overstrike;
-    if (value == "strike") return TEXTRENDITIONLIST_strike;
-    if (value == "sub") return TEXTRENDITIONLIST_sub;
-    if (value == "sup") return TEXTRENDITIONLIST_sup;
-    if (value == "superimpose") return TEXTRENDITIONLIST_superimpose;
-    if (value == "underline") return TEXTRENDITIONLIST_underline;
-    if (value == "x-through") return TEXTRENDITIONLIST_x_through;
-    if (value == "ltr") return TEXTRENDITIONLIST_ltr;
-    if (value == "rtl") return TEXTRENDITIONLIST_rtl;
-    if (value == "lro") return TEXTRENDITIONLIST_lro;
-    if (value == "rlo") return TEXTRENDITIONLIST_rlo;
-    if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", value.c_str());
+data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 3:
+            if (value == "box") return TEXTRENDITIONLIST_box;
+            if (value == "sub") return TEXTRENDITIONLIST_sub;
+            if (value == "sup") return TEXTRENDITIONLIST_sup;
+            if (value == "ltr") return TEXTRENDITIONLIST_ltr;
+            if (value == "rtl") return TEXTRENDITIONLIST_rtl;
+            if (value == "lro") return TEXTRENDITIONLIST_lro;
+            if (value == "rlo") return TEXTRENDITIONLIST_rlo;
+            break;
+        case 4:
+            if (value == "bold") return TEXTRENDITIONLIST_bold;
+            if (value == "dbox") return TEXTRENDITIONLIST_dbox;
+            if (value == "tbox") return TEXTRENDITIONLIST_tbox;
+            if (value == "none") return TEXTRENDITIONLIST_none;
+            break;
+        case 5:
+            if (value == "quote") return TEXTRENDITIONLIST_quote;
+            break;
+        case 6:
+            if (value == "italic") return TEXTRENDITIONLIST_italic;
+            if (value == "smcaps") return TEXTRENDITIONLIST_smcaps;
+            if (value == "bolder") return TEXTRENDITIONLIST_bolder;
+            if (value == "circle") return TEXTRENDITIONLIST_circle;
+            if (value == "bslash") return TEXTRENDITIONLIST_bslash;
+            if (value == "fslash") return TEXTRENDITIONLIST_fslash;
+            if (value == "strike") return TEXTRENDITIONLIST_strike;
+            break;
+        case 7:
+            if (value == "oblique") return TEXTRENDITIONLIST_oblique;
+            if (value == "lighter") return TEXTRENDITIONLIST_lighter;
+            break;
+        case 8:
+            if (value == "quotedbl") return TEXTRENDITIONLIST_quotedbl;
+            if (value == "overline") return TEXTRENDITIONLIST_overline;
+            break;
+        case 9:
+            if (value == "underline") return TEXTRENDITIONLIST_underline;
+            if (value == "x-through") return TEXTRENDITIONLIST_x_through;
+            break;
+        case 10:
+            if (value == "overstrike") return TEXTRENDITIONLIST_overstrike;
+            break;
+        case 11:
+            if (value == "superimpose") return TEXTRENDITIONLIST_superimpose;
+            break;
+        case 12:
+            if (value == "line-through") return TEXTRENDITIONLIST_line_through;
+            break;
+        default: break;
+    }
+    if (logWarning && !value.empty())
+        LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", std::string(value).c_str());
     return TEXTRENDITIONLIST_NONE;
 }
 
@@ -3070,14 +3829,23 @@ std::string AttConverter::VerticalalignmentToStr(data_VERTICALALIGNMENT data) co
     return value;
 }
 
-data_VERTICALALIGNMENT AttConverter::StrToVerticalalignment(std::string value, bool logWarning) const
+data_VERTICALALIGNMENT AttConverter::StrToVerticalalignment(std::string_view value, bool logWarning) const
 {
-    if (value == "top") return VERTICALALIGNMENT_top;
-    if (value == "middle") return VERTICALALIGNMENT_middle;
-    if (value == "bottom") return VERTICALALIGNMENT_bottom;
-    if (value == "baseline") return VERTICALALIGNMENT_baseline;
+    switch (value.size()) {
+        case 3:
+            if (value == "top") return VERTICALALIGNMENT_top;
+            break;
+        case 6:
+            if (value == "middle") return VERTICALALIGNMENT_middle;
+            if (value == "bottom") return VERTICALALIGNMENT_bottom;
+            break;
+        case 8:
+            if (value == "baseline") return VERTICALALIGNMENT_baseline;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for data.VERTICALALIGNMENT", value.c_str());
+        LogWarning("Unsupported value '%s' for data.VERTICALALIGNMENT", std::string(value).c_str());
     return VERTICALALIGNMENT_NONE;
 }
 
@@ -3095,12 +3863,19 @@ std::string AttConverter::AccidLogFuncToStr(accidLog_FUNC data) const
     return value;
 }
 
-accidLog_FUNC AttConverter::StrToAccidLogFunc(std::string value, bool logWarning) const
+accidLog_FUNC AttConverter::StrToAccidLogFunc(std::string_view value, bool logWarning) const
 {
-    if (value == "caution") return accidLog_FUNC_caution;
-    if (value == "edit") return accidLog_FUNC_edit;
+    switch (value.size()) {
+        case 4:
+            if (value == "edit") return accidLog_FUNC_edit;
+            break;
+        case 7:
+            if (value == "caution") return accidLog_FUNC_caution;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.accid.log@func", value.c_str());
+        LogWarning("Unsupported value '%s' for att.accid.log@func", std::string(value).c_str());
     return accidLog_FUNC_NONE;
 }
 
@@ -3117,11 +3892,16 @@ std::string AttConverter::AnchoredTextLogFuncToStr(anchoredTextLog_FUNC data) co
     return value;
 }
 
-anchoredTextLog_FUNC AttConverter::StrToAnchoredTextLogFunc(std::string value, bool logWarning) const
+anchoredTextLog_FUNC AttConverter::StrToAnchoredTextLogFunc(std::string_view value, bool logWarning) const
 {
-    if (value == "unknown") return anchoredTextLog_FUNC_unknown;
+    switch (value.size()) {
+        case 7:
+            if (value == "unknown") return anchoredTextLog_FUNC_unknown;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.anchoredText.log@func", value.c_str());
+        LogWarning("Unsupported value '%s' for att.anchoredText.log@func", std::string(value).c_str());
     return anchoredTextLog_FUNC_NONE;
 }
 
@@ -3140,13 +3920,22 @@ std::string AttConverter::ArpegLogOrderToStr(arpegLog_ORDER data) const
     return value;
 }
 
-arpegLog_ORDER AttConverter::StrToArpegLogOrder(std::string value, bool logWarning) const
+arpegLog_ORDER AttConverter::StrToArpegLogOrder(std::string_view value, bool logWarning) const
 {
-    if (value == "up") return arpegLog_ORDER_up;
-    if (value == "down") return arpegLog_ORDER_down;
-    if (value == "nonarp") return arpegLog_ORDER_nonarp;
+    switch (value.size()) {
+        case 2:
+            if (value == "up") return arpegLog_ORDER_up;
+            break;
+        case 4:
+            if (value == "down") return arpegLog_ORDER_down;
+            break;
+        case 6:
+            if (value == "nonarp") return arpegLog_ORDER_nonarp;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.arpeg.log@order", value.c_str());
+        LogWarning("Unsupported value '%s' for att.arpeg.log@order", std::string(value).c_str());
     return arpegLog_ORDER_NONE;
 }
 
@@ -3164,12 +3953,19 @@ std::string AttConverter::AudienceAudienceToStr(audience_AUDIENCE data) const
     return value;
 }
 
-audience_AUDIENCE AttConverter::StrToAudienceAudience(std::string value, bool logWarning) const
+audience_AUDIENCE AttConverter::StrToAudienceAudience(std::string_view value, bool logWarning) const
 {
-    if (value == "private") return audience_AUDIENCE_private;
-    if (value == "public") return audience_AUDIENCE_public;
+    switch (value.size()) {
+        case 6:
+            if (value == "public") return audience_AUDIENCE_public;
+            break;
+        case 7:
+            if (value == "private") return audience_AUDIENCE_private;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.audience@audience", value.c_str());
+        LogWarning("Unsupported value '%s' for att.audience@audience", std::string(value).c_str());
     return audience_AUDIENCE_NONE;
 }
 
@@ -3187,12 +3983,19 @@ std::string AttConverter::BTremLogFormToStr(bTremLog_FORM data) const
     return value;
 }
 
-bTremLog_FORM AttConverter::StrToBTremLogForm(std::string value, bool logWarning) const
+bTremLog_FORM AttConverter::StrToBTremLogForm(std::string_view value, bool logWarning) const
 {
-    if (value == "meas") return bTremLog_FORM_meas;
-    if (value == "unmeas") return bTremLog_FORM_unmeas;
+    switch (value.size()) {
+        case 4:
+            if (value == "meas") return bTremLog_FORM_meas;
+            break;
+        case 6:
+            if (value == "unmeas") return bTremLog_FORM_unmeas;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.bTrem.log@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.bTrem.log@form", std::string(value).c_str());
     return bTremLog_FORM_NONE;
 }
 
@@ -3212,14 +4015,23 @@ std::string AttConverter::BeamRendFormToStr(beamRend_FORM data) const
     return value;
 }
 
-beamRend_FORM AttConverter::StrToBeamRendForm(std::string value, bool logWarning) const
+beamRend_FORM AttConverter::StrToBeamRendForm(std::string_view value, bool logWarning) const
 {
-    if (value == "acc") return beamRend_FORM_acc;
-    if (value == "mixed") return beamRend_FORM_mixed;
-    if (value == "rit") return beamRend_FORM_rit;
-    if (value == "norm") return beamRend_FORM_norm;
+    switch (value.size()) {
+        case 3:
+            if (value == "acc") return beamRend_FORM_acc;
+            if (value == "rit") return beamRend_FORM_rit;
+            break;
+        case 4:
+            if (value == "norm") return beamRend_FORM_norm;
+            break;
+        case 5:
+            if (value == "mixed") return beamRend_FORM_mixed;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.beamRend@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.beamRend@form", std::string(value).c_str());
     return beamRend_FORM_NONE;
 }
 
@@ -3238,13 +4050,20 @@ std::string AttConverter::BeamingVisBeamrendToStr(beamingVis_BEAMREND data) cons
     return value;
 }
 
-beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(std::string value, bool logWarning) const
+beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(std::string_view value, bool logWarning) const
 {
-    if (value == "acc") return beamingVis_BEAMREND_acc;
-    if (value == "rit") return beamingVis_BEAMREND_rit;
-    if (value == "norm") return beamingVis_BEAMREND_norm;
+    switch (value.size()) {
+        case 3:
+            if (value == "acc") return beamingVis_BEAMREND_acc;
+            if (value == "rit") return beamingVis_BEAMREND_rit;
+            break;
+        case 4:
+            if (value == "norm") return beamingVis_BEAMREND_norm;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.beaming.vis@beam.rend", value.c_str());
+        LogWarning("Unsupported value '%s' for att.beaming.vis@beam.rend", std::string(value).c_str());
     return beamingVis_BEAMREND_NONE;
 }
 
@@ -3263,13 +4082,22 @@ std::string AttConverter::BracketSpanLogFuncToStr(bracketSpanLog_FUNC data) cons
     return value;
 }
 
-bracketSpanLog_FUNC AttConverter::StrToBracketSpanLogFunc(std::string value, bool logWarning) const
+bracketSpanLog_FUNC AttConverter::StrToBracketSpanLogFunc(std::string_view value, bool logWarning) const
 {
-    if (value == "coloration") return bracketSpanLog_FUNC_coloration;
-    if (value == "cross-rhythm") return bracketSpanLog_FUNC_cross_rhythm;
-    if (value == "ligature") return bracketSpanLog_FUNC_ligature;
+    switch (value.size()) {
+        case 8:
+            if (value == "ligature") return bracketSpanLog_FUNC_ligature;
+            break;
+        case 10:
+            if (value == "coloration") return bracketSpanLog_FUNC_coloration;
+            break;
+        case 12:
+            if (value == "cross-rhythm") return bracketSpanLog_FUNC_cross_rhythm;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.bracketSpan.log@func", value.c_str());
+        LogWarning("Unsupported value '%s' for att.bracketSpan.log@func", std::string(value).c_str());
     return bracketSpanLog_FUNC_NONE;
 }
 
@@ -3288,13 +4116,18 @@ std::string AttConverter::CurvatureCurvedirToStr(curvature_CURVEDIR data) const
     return value;
 }
 
-curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(std::string value, bool logWarning) const
+curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(std::string_view value, bool logWarning) const
 {
-    if (value == "above") return curvature_CURVEDIR_above;
-    if (value == "below") return curvature_CURVEDIR_below;
-    if (value == "mixed") return curvature_CURVEDIR_mixed;
+    switch (value.size()) {
+        case 5:
+            if (value == "above") return curvature_CURVEDIR_above;
+            if (value == "below") return curvature_CURVEDIR_below;
+            if (value == "mixed") return curvature_CURVEDIR_mixed;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.curvature@curvedir", value.c_str());
+        LogWarning("Unsupported value '%s' for att.curvature@curvedir", std::string(value).c_str());
     return curvature_CURVEDIR_NONE;
 }
 
@@ -3311,11 +4144,16 @@ std::string AttConverter::CurveLogFuncToStr(curveLog_FUNC data) const
     return value;
 }
 
-curveLog_FUNC AttConverter::StrToCurveLogFunc(std::string value, bool logWarning) const
+curveLog_FUNC AttConverter::StrToCurveLogFunc(std::string_view value, bool logWarning) const
 {
-    if (value == "unknown") return curveLog_FUNC_unknown;
+    switch (value.size()) {
+        case 7:
+            if (value == "unknown") return curveLog_FUNC_unknown;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.curve.log@func", value.c_str());
+        LogWarning("Unsupported value '%s' for att.curve.log@func", std::string(value).c_str());
     return curveLog_FUNC_NONE;
 }
 
@@ -3332,11 +4170,16 @@ std::string AttConverter::CutoutCutoutToStr(cutout_CUTOUT data) const
     return value;
 }
 
-cutout_CUTOUT AttConverter::StrToCutoutCutout(std::string value, bool logWarning) const
+cutout_CUTOUT AttConverter::StrToCutoutCutout(std::string_view value, bool logWarning) const
 {
-    if (value == "cutout") return cutout_CUTOUT_cutout;
+    switch (value.size()) {
+        case 6:
+            if (value == "cutout") return cutout_CUTOUT_cutout;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.cutout@cutout", value.c_str());
+        LogWarning("Unsupported value '%s' for att.cutout@cutout", std::string(value).c_str());
     return cutout_CUTOUT_NONE;
 }
 
@@ -3354,12 +4197,17 @@ std::string AttConverter::DotLogFormToStr(dotLog_FORM data) const
     return value;
 }
 
-dotLog_FORM AttConverter::StrToDotLogForm(std::string value, bool logWarning) const
+dotLog_FORM AttConverter::StrToDotLogForm(std::string_view value, bool logWarning) const
 {
-    if (value == "aug") return dotLog_FORM_aug;
-    if (value == "div") return dotLog_FORM_div;
+    switch (value.size()) {
+        case 3:
+            if (value == "aug") return dotLog_FORM_aug;
+            if (value == "div") return dotLog_FORM_div;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.dot.log@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.dot.log@form", std::string(value).c_str());
     return dotLog_FORM_NONE;
 }
 
@@ -3378,13 +4226,22 @@ std::string AttConverter::EndingsEndingrendToStr(endings_ENDINGREND data) const
     return value;
 }
 
-endings_ENDINGREND AttConverter::StrToEndingsEndingrend(std::string value, bool logWarning) const
+endings_ENDINGREND AttConverter::StrToEndingsEndingrend(std::string_view value, bool logWarning) const
 {
-    if (value == "top") return endings_ENDINGREND_top;
-    if (value == "barred") return endings_ENDINGREND_barred;
-    if (value == "grouped") return endings_ENDINGREND_grouped;
+    switch (value.size()) {
+        case 3:
+            if (value == "top") return endings_ENDINGREND_top;
+            break;
+        case 6:
+            if (value == "barred") return endings_ENDINGREND_barred;
+            break;
+        case 7:
+            if (value == "grouped") return endings_ENDINGREND_grouped;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.endings@ending.rend", value.c_str());
+        LogWarning("Unsupported value '%s' for att.endings@ending.rend", std::string(value).c_str());
     return endings_ENDINGREND_NONE;
 }
 
@@ -3402,12 +4259,17 @@ std::string AttConverter::EpisemaVisFormToStr(episemaVis_FORM data) const
     return value;
 }
 
-episemaVis_FORM AttConverter::StrToEpisemaVisForm(std::string value, bool logWarning) const
+episemaVis_FORM AttConverter::StrToEpisemaVisForm(std::string_view value, bool logWarning) const
 {
-    if (value == "h") return episemaVis_FORM_h;
-    if (value == "v") return episemaVis_FORM_v;
+    switch (value.size()) {
+        case 1:
+            if (value == "h") return episemaVis_FORM_h;
+            if (value == "v") return episemaVis_FORM_v;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.episema.vis@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.episema.vis@form", std::string(value).c_str());
     return episemaVis_FORM_NONE;
 }
 
@@ -3426,13 +4288,20 @@ std::string AttConverter::EvidenceEvidenceToStr(evidence_EVIDENCE data) const
     return value;
 }
 
-evidence_EVIDENCE AttConverter::StrToEvidenceEvidence(std::string value, bool logWarning) const
+evidence_EVIDENCE AttConverter::StrToEvidenceEvidence(std::string_view value, bool logWarning) const
 {
-    if (value == "internal") return evidence_EVIDENCE_internal;
-    if (value == "external") return evidence_EVIDENCE_external;
-    if (value == "conjecture") return evidence_EVIDENCE_conjecture;
+    switch (value.size()) {
+        case 8:
+            if (value == "internal") return evidence_EVIDENCE_internal;
+            if (value == "external") return evidence_EVIDENCE_external;
+            break;
+        case 10:
+            if (value == "conjecture") return evidence_EVIDENCE_conjecture;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.evidence@evidence", value.c_str());
+        LogWarning("Unsupported value '%s' for att.evidence@evidence", std::string(value).c_str());
     return evidence_EVIDENCE_NONE;
 }
 
@@ -3449,11 +4318,16 @@ std::string AttConverter::ExtSymGlyphauthToStr(extSym_GLYPHAUTH data) const
     return value;
 }
 
-extSym_GLYPHAUTH AttConverter::StrToExtSymGlyphauth(std::string value, bool logWarning) const
+extSym_GLYPHAUTH AttConverter::StrToExtSymGlyphauth(std::string_view value, bool logWarning) const
 {
-    if (value == "smufl") return extSym_GLYPHAUTH_smufl;
+    switch (value.size()) {
+        case 5:
+            if (value == "smufl") return extSym_GLYPHAUTH_smufl;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.extSym@glyph.auth", value.c_str());
+        LogWarning("Unsupported value '%s' for att.extSym@glyph.auth", std::string(value).c_str());
     return extSym_GLYPHAUTH_NONE;
 }
 
@@ -3471,12 +4345,19 @@ std::string AttConverter::FTremLogFormToStr(fTremLog_FORM data) const
     return value;
 }
 
-fTremLog_FORM AttConverter::StrToFTremLogForm(std::string value, bool logWarning) const
+fTremLog_FORM AttConverter::StrToFTremLogForm(std::string_view value, bool logWarning) const
 {
-    if (value == "meas") return fTremLog_FORM_meas;
-    if (value == "unmeas") return fTremLog_FORM_unmeas;
+    switch (value.size()) {
+        case 4:
+            if (value == "meas") return fTremLog_FORM_meas;
+            break;
+        case 6:
+            if (value == "unmeas") return fTremLog_FORM_unmeas;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fTrem.log@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.fTrem.log@form", std::string(value).c_str());
     return fTremLog_FORM_NONE;
 }
 
@@ -3494,12 +4375,19 @@ std::string AttConverter::FermataVisFormToStr(fermataVis_FORM data) const
     return value;
 }
 
-fermataVis_FORM AttConverter::StrToFermataVisForm(std::string value, bool logWarning) const
+fermataVis_FORM AttConverter::StrToFermataVisForm(std::string_view value, bool logWarning) const
 {
-    if (value == "inv") return fermataVis_FORM_inv;
-    if (value == "norm") return fermataVis_FORM_norm;
+    switch (value.size()) {
+        case 3:
+            if (value == "inv") return fermataVis_FORM_inv;
+            break;
+        case 4:
+            if (value == "norm") return fermataVis_FORM_norm;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fermata.vis@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.fermata.vis@form", std::string(value).c_str());
     return fermataVis_FORM_NONE;
 }
 
@@ -3518,13 +4406,20 @@ std::string AttConverter::FermataVisShapeToStr(fermataVis_SHAPE data) const
     return value;
 }
 
-fermataVis_SHAPE AttConverter::StrToFermataVisShape(std::string value, bool logWarning) const
+fermataVis_SHAPE AttConverter::StrToFermataVisShape(std::string_view value, bool logWarning) const
 {
-    if (value == "curved") return fermataVis_SHAPE_curved;
-    if (value == "square") return fermataVis_SHAPE_square;
-    if (value == "angular") return fermataVis_SHAPE_angular;
+    switch (value.size()) {
+        case 6:
+            if (value == "curved") return fermataVis_SHAPE_curved;
+            if (value == "square") return fermataVis_SHAPE_square;
+            break;
+        case 7:
+            if (value == "angular") return fermataVis_SHAPE_angular;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fermata.vis@shape", value.c_str());
+        LogWarning("Unsupported value '%s' for att.fermata.vis@shape", std::string(value).c_str());
     return fermataVis_SHAPE_NONE;
 }
 
@@ -3543,13 +4438,18 @@ std::string AttConverter::FingGrpLogFormToStr(fingGrpLog_FORM data) const
     return value;
 }
 
-fingGrpLog_FORM AttConverter::StrToFingGrpLogForm(std::string value, bool logWarning) const
+fingGrpLog_FORM AttConverter::StrToFingGrpLogForm(std::string_view value, bool logWarning) const
 {
-    if (value == "alter") return fingGrpLog_FORM_alter;
-    if (value == "combi") return fingGrpLog_FORM_combi;
-    if (value == "subst") return fingGrpLog_FORM_subst;
+    switch (value.size()) {
+        case 5:
+            if (value == "alter") return fingGrpLog_FORM_alter;
+            if (value == "combi") return fingGrpLog_FORM_combi;
+            if (value == "subst") return fingGrpLog_FORM_subst;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fingGrp.log@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.fingGrp.log@form", std::string(value).c_str());
     return fingGrpLog_FORM_NONE;
 }
 
@@ -3567,12 +4467,19 @@ std::string AttConverter::FingGrpVisOrientToStr(fingGrpVis_ORIENT data) const
     return value;
 }
 
-fingGrpVis_ORIENT AttConverter::StrToFingGrpVisOrient(std::string value, bool logWarning) const
+fingGrpVis_ORIENT AttConverter::StrToFingGrpVisOrient(std::string_view value, bool logWarning) const
 {
-    if (value == "horiz") return fingGrpVis_ORIENT_horiz;
-    if (value == "vert") return fingGrpVis_ORIENT_vert;
+    switch (value.size()) {
+        case 4:
+            if (value == "vert") return fingGrpVis_ORIENT_vert;
+            break;
+        case 5:
+            if (value == "horiz") return fingGrpVis_ORIENT_horiz;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.fingGrp.vis@orient", value.c_str());
+        LogWarning("Unsupported value '%s' for att.fingGrp.vis@orient", std::string(value).c_str());
     return fingGrpVis_ORIENT_NONE;
 }
 
@@ -3591,13 +4498,22 @@ std::string AttConverter::GraceGrpLogAttachToStr(graceGrpLog_ATTACH data) const
     return value;
 }
 
-graceGrpLog_ATTACH AttConverter::StrToGraceGrpLogAttach(std::string value, bool logWarning) const
+graceGrpLog_ATTACH AttConverter::StrToGraceGrpLogAttach(std::string_view value, bool logWarning) const
 {
-    if (value == "pre") return graceGrpLog_ATTACH_pre;
-    if (value == "post") return graceGrpLog_ATTACH_post;
-    if (value == "unknown") return graceGrpLog_ATTACH_unknown;
+    switch (value.size()) {
+        case 3:
+            if (value == "pre") return graceGrpLog_ATTACH_pre;
+            break;
+        case 4:
+            if (value == "post") return graceGrpLog_ATTACH_post;
+            break;
+        case 7:
+            if (value == "unknown") return graceGrpLog_ATTACH_unknown;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.graceGrp.log@attach", value.c_str());
+        LogWarning("Unsupported value '%s' for att.graceGrp.log@attach", std::string(value).c_str());
     return graceGrpLog_ATTACH_NONE;
 }
 
@@ -3615,12 +4531,19 @@ std::string AttConverter::HairpinLogFormToStr(hairpinLog_FORM data) const
     return value;
 }
 
-hairpinLog_FORM AttConverter::StrToHairpinLogForm(std::string value, bool logWarning) const
+hairpinLog_FORM AttConverter::StrToHairpinLogForm(std::string_view value, bool logWarning) const
 {
-    if (value == "cres") return hairpinLog_FORM_cres;
-    if (value == "dim") return hairpinLog_FORM_dim;
+    switch (value.size()) {
+        case 3:
+            if (value == "dim") return hairpinLog_FORM_dim;
+            break;
+        case 4:
+            if (value == "cres") return hairpinLog_FORM_cres;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.hairpin.log@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.hairpin.log@form", std::string(value).c_str());
     return hairpinLog_FORM_NONE;
 }
 
@@ -3638,12 +4561,19 @@ std::string AttConverter::HarmAnlFormToStr(harmAnl_FORM data) const
     return value;
 }
 
-harmAnl_FORM AttConverter::StrToHarmAnlForm(std::string value, bool logWarning) const
+harmAnl_FORM AttConverter::StrToHarmAnlForm(std::string_view value, bool logWarning) const
 {
-    if (value == "explicit") return harmAnl_FORM_explicit;
-    if (value == "implied") return harmAnl_FORM_implied;
+    switch (value.size()) {
+        case 7:
+            if (value == "implied") return harmAnl_FORM_implied;
+            break;
+        case 8:
+            if (value == "explicit") return harmAnl_FORM_explicit;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harm.anl@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.harm.anl@form", std::string(value).c_str());
     return harmAnl_FORM_NONE;
 }
 
@@ -3662,13 +4592,20 @@ std::string AttConverter::HarmVisRendgridToStr(harmVis_RENDGRID data) const
     return value;
 }
 
-harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(std::string value, bool logWarning) const
+harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(std::string_view value, bool logWarning) const
 {
-    if (value == "grid") return harmVis_RENDGRID_grid;
-    if (value == "gridtext") return harmVis_RENDGRID_gridtext;
-    if (value == "text") return harmVis_RENDGRID_text;
+    switch (value.size()) {
+        case 4:
+            if (value == "grid") return harmVis_RENDGRID_grid;
+            if (value == "text") return harmVis_RENDGRID_text;
+            break;
+        case 8:
+            if (value == "gridtext") return harmVis_RENDGRID_gridtext;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harm.vis@rendgrid", value.c_str());
+        LogWarning("Unsupported value '%s' for att.harm.vis@rendgrid", std::string(value).c_str());
     return harmVis_RENDGRID_NONE;
 }
 
@@ -3687,13 +4624,18 @@ std::string AttConverter::HarpPedalLogAToStr(harpPedalLog_A data) const
     return value;
 }
 
-harpPedalLog_A AttConverter::StrToHarpPedalLogA(std::string value, bool logWarning) const
+harpPedalLog_A AttConverter::StrToHarpPedalLogA(std::string_view value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_A_f;
-    if (value == "n") return harpPedalLog_A_n;
-    if (value == "s") return harpPedalLog_A_s;
+    switch (value.size()) {
+        case 1:
+            if (value == "f") return harpPedalLog_A_f;
+            if (value == "n") return harpPedalLog_A_n;
+            if (value == "s") return harpPedalLog_A_s;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@a", value.c_str());
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@a", std::string(value).c_str());
     return harpPedalLog_A_NONE;
 }
 
@@ -3712,13 +4654,18 @@ std::string AttConverter::HarpPedalLogBToStr(harpPedalLog_B data) const
     return value;
 }
 
-harpPedalLog_B AttConverter::StrToHarpPedalLogB(std::string value, bool logWarning) const
+harpPedalLog_B AttConverter::StrToHarpPedalLogB(std::string_view value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_B_f;
-    if (value == "n") return harpPedalLog_B_n;
-    if (value == "s") return harpPedalLog_B_s;
+    switch (value.size()) {
+        case 1:
+            if (value == "f") return harpPedalLog_B_f;
+            if (value == "n") return harpPedalLog_B_n;
+            if (value == "s") return harpPedalLog_B_s;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@b", value.c_str());
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@b", std::string(value).c_str());
     return harpPedalLog_B_NONE;
 }
 
@@ -3737,13 +4684,18 @@ std::string AttConverter::HarpPedalLogCToStr(harpPedalLog_C data) const
     return value;
 }
 
-harpPedalLog_C AttConverter::StrToHarpPedalLogC(std::string value, bool logWarning) const
+harpPedalLog_C AttConverter::StrToHarpPedalLogC(std::string_view value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_C_f;
-    if (value == "n") return harpPedalLog_C_n;
-    if (value == "s") return harpPedalLog_C_s;
+    switch (value.size()) {
+        case 1:
+            if (value == "f") return harpPedalLog_C_f;
+            if (value == "n") return harpPedalLog_C_n;
+            if (value == "s") return harpPedalLog_C_s;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@c", value.c_str());
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@c", std::string(value).c_str());
     return harpPedalLog_C_NONE;
 }
 
@@ -3762,13 +4714,18 @@ std::string AttConverter::HarpPedalLogDToStr(harpPedalLog_D data) const
     return value;
 }
 
-harpPedalLog_D AttConverter::StrToHarpPedalLogD(std::string value, bool logWarning) const
+harpPedalLog_D AttConverter::StrToHarpPedalLogD(std::string_view value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_D_f;
-    if (value == "n") return harpPedalLog_D_n;
-    if (value == "s") return harpPedalLog_D_s;
+    switch (value.size()) {
+        case 1:
+            if (value == "f") return harpPedalLog_D_f;
+            if (value == "n") return harpPedalLog_D_n;
+            if (value == "s") return harpPedalLog_D_s;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@d", value.c_str());
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@d", std::string(value).c_str());
     return harpPedalLog_D_NONE;
 }
 
@@ -3787,13 +4744,18 @@ std::string AttConverter::HarpPedalLogEToStr(harpPedalLog_E data) const
     return value;
 }
 
-harpPedalLog_E AttConverter::StrToHarpPedalLogE(std::string value, bool logWarning) const
+harpPedalLog_E AttConverter::StrToHarpPedalLogE(std::string_view value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_E_f;
-    if (value == "n") return harpPedalLog_E_n;
-    if (value == "s") return harpPedalLog_E_s;
+    switch (value.size()) {
+        case 1:
+            if (value == "f") return harpPedalLog_E_f;
+            if (value == "n") return harpPedalLog_E_n;
+            if (value == "s") return harpPedalLog_E_s;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@e", value.c_str());
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@e", std::string(value).c_str());
     return harpPedalLog_E_NONE;
 }
 
@@ -3812,13 +4774,18 @@ std::string AttConverter::HarpPedalLogFToStr(harpPedalLog_F data) const
     return value;
 }
 
-harpPedalLog_F AttConverter::StrToHarpPedalLogF(std::string value, bool logWarning) const
+harpPedalLog_F AttConverter::StrToHarpPedalLogF(std::string_view value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_F_f;
-    if (value == "n") return harpPedalLog_F_n;
-    if (value == "s") return harpPedalLog_F_s;
+    switch (value.size()) {
+        case 1:
+            if (value == "f") return harpPedalLog_F_f;
+            if (value == "n") return harpPedalLog_F_n;
+            if (value == "s") return harpPedalLog_F_s;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@f", value.c_str());
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@f", std::string(value).c_str());
     return harpPedalLog_F_NONE;
 }
 
@@ -3837,13 +4804,18 @@ std::string AttConverter::HarpPedalLogGToStr(harpPedalLog_G data) const
     return value;
 }
 
-harpPedalLog_G AttConverter::StrToHarpPedalLogG(std::string value, bool logWarning) const
+harpPedalLog_G AttConverter::StrToHarpPedalLogG(std::string_view value, bool logWarning) const
 {
-    if (value == "f") return harpPedalLog_G_f;
-    if (value == "n") return harpPedalLog_G_n;
-    if (value == "s") return harpPedalLog_G_s;
+    switch (value.size()) {
+        case 1:
+            if (value == "f") return harpPedalLog_G_f;
+            if (value == "n") return harpPedalLog_G_n;
+            if (value == "s") return harpPedalLog_G_s;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.harpPedal.log@g", value.c_str());
+        LogWarning("Unsupported value '%s' for att.harpPedal.log@g", std::string(value).c_str());
     return harpPedalLog_G_NONE;
 }
 
@@ -3862,13 +4834,22 @@ std::string AttConverter::LineLogFuncToStr(lineLog_FUNC data) const
     return value;
 }
 
-lineLog_FUNC AttConverter::StrToLineLogFunc(std::string value, bool logWarning) const
+lineLog_FUNC AttConverter::StrToLineLogFunc(std::string_view value, bool logWarning) const
 {
-    if (value == "coloration") return lineLog_FUNC_coloration;
-    if (value == "ligature") return lineLog_FUNC_ligature;
-    if (value == "unknown") return lineLog_FUNC_unknown;
+    switch (value.size()) {
+        case 7:
+            if (value == "unknown") return lineLog_FUNC_unknown;
+            break;
+        case 8:
+            if (value == "ligature") return lineLog_FUNC_ligature;
+            break;
+        case 10:
+            if (value == "coloration") return lineLog_FUNC_coloration;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.line.log@func", value.c_str());
+        LogWarning("Unsupported value '%s' for att.line.log@func", std::string(value).c_str());
     return lineLog_FUNC_NONE;
 }
 
@@ -3886,12 +4867,17 @@ std::string AttConverter::LiquescentVisCurveToStr(liquescentVis_CURVE data) cons
     return value;
 }
 
-liquescentVis_CURVE AttConverter::StrToLiquescentVisCurve(std::string value, bool logWarning) const
+liquescentVis_CURVE AttConverter::StrToLiquescentVisCurve(std::string_view value, bool logWarning) const
 {
-    if (value == "a") return liquescentVis_CURVE_a;
-    if (value == "c") return liquescentVis_CURVE_c;
+    switch (value.size()) {
+        case 1:
+            if (value == "a") return liquescentVis_CURVE_a;
+            if (value == "c") return liquescentVis_CURVE_c;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.liquescent.vis@curve", value.c_str());
+        LogWarning("Unsupported value '%s' for att.liquescent.vis@curve", std::string(value).c_str());
     return liquescentVis_CURVE_NONE;
 }
 
@@ -3924,27 +4910,42 @@ std::string AttConverter::MeasurementUnitToStr(measurement_UNIT data) const
     return value;
 }
 
-measurement_UNIT AttConverter::StrToMeasurementUnit(std::string value, bool logWarning) const
+measurement_UNIT AttConverter::StrToMeasurementUnit(std::string_view value, bool logWarning) const
 {
-    if (value == "byte") return measurement_UNIT_byte;
-    if (value == "char") return measurement_UNIT_char;
-    if (value == "cm") return measurement_UNIT_cm;
-    if (value == "deg") return measurement_UNIT_deg;
-    if (value == "in") return measurement_UNIT_in;
-    if (value == "issue") return measurement_UNIT_issue;
-    if (value == "ft") return measurement_UNIT_ft;
-    if (value == "m") return measurement_UNIT_m;
-    if (value == "mm") return measurement_UNIT_mm;
-    if (value == "page") return measurement_UNIT_page;
-    if (value == "pc") return measurement_UNIT_pc;
-    if (value == "pt") return measurement_UNIT_pt;
-    if (value == "px") return measurement_UNIT_px;
-    if (value == "rad") return measurement_UNIT_rad;
-    if (value == "record") return measurement_UNIT_record;
-    if (value == "vol") return measurement_UNIT_vol;
-    if (value == "vu") return measurement_UNIT_vu;
+    switch (value.size()) {
+        case 1:
+            if (value == "m") return measurement_UNIT_m;
+            break;
+        case 2:
+            if (value == "cm") return measurement_UNIT_cm;
+            if (value == "in") return measurement_UNIT_in;
+            if (value == "ft") return measurement_UNIT_ft;
+            if (value == "mm") return measurement_UNIT_mm;
+            if (value == "pc") return measurement_UNIT_pc;
+            if (value == "pt") return measurement_UNIT_pt;
+            if (value == "px") return measurement_UNIT_px;
+            if (value == "vu") return measurement_UNIT_vu;
+            break;
+        case 3:
+            if (value == "deg") return measurement_UNIT_deg;
+            if (value == "rad") return measurement_UNIT_rad;
+            if (value == "vol") return measurement_UNIT_vol;
+            break;
+        case 4:
+            if (value == "byte") return measurement_UNIT_byte;
+            if (value == "char") return measurement_UNIT_char;
+            if (value == "page") return measurement_UNIT_page;
+            break;
+        case 5:
+            if (value == "issue") return measurement_UNIT_issue;
+            break;
+        case 6:
+            if (value == "record") return measurement_UNIT_record;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.measurement@unit", value.c_str());
+        LogWarning("Unsupported value '%s' for att.measurement@unit", std::string(value).c_str());
     return measurement_UNIT_NONE;
 }
 
@@ -3962,12 +4963,17 @@ std::string AttConverter::MeiVersionMeiversionToStr(meiVersion_MEIVERSION data)
     return value;
 }
 
-meiVersion_MEIVERSION AttConverter::StrToMeiVersionMeiversion(std::string value, bool logWarning) const
+meiVersion_MEIVERSION AttConverter::StrToMeiVersionMeiversion(std::string_view value, bool logWarning) const
 {
-    if (value == "4.0.0") return meiVersion_MEIVERSION_4_0_0;
-    if (value == "4.0.1") return meiVersion_MEIVERSION_4_0_1;
+    switch (value.size()) {
+        case 5:
+            if (value == "4.0.0") return meiVersion_MEIVERSION_4_0_0;
+            if (value == "4.0.1") return meiVersion_MEIVERSION_4_0_1;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.meiVersion@meiversion", value.c_str());
+        LogWarning("Unsupported value '%s' for att.meiVersion@meiversion", std::string(value).c_str());
     return meiVersion_MEIVERSION_NONE;
 }
 
@@ -3985,12 +4991,19 @@ std::string AttConverter::MensurVisFormToStr(mensurVis_FORM data) const
     return value;
 }
 
-mensurVis_FORM AttConverter::StrToMensurVisForm(std::string value, bool logWarning) const
+mensurVis_FORM AttConverter::StrToMensurVisForm(std::string_view value, bool logWarning) const
 {
-    if (value == "horizontal") return mensurVis_FORM_horizontal;
-    if (value == "vertical") return mensurVis_FORM_vertical;
+    switch (value.size()) {
+        case 8:
+            if (value == "vertical") return mensurVis_FORM_vertical;
+            break;
+        case 10:
+            if (value == "horizontal") return mensurVis_FORM_horizontal;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.mensur.vis@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.mensur.vis@form", std::string(value).c_str());
     return mensurVis_FORM_NONE;
 }
 
@@ -4008,12 +5021,19 @@ std::string AttConverter::MensuralVisMensurformToStr(mensuralVis_MENSURFORM data
     return value;
 }
 
-mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(std::string value, bool logWarning) const
+mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(std::string_view value, bool logWarning) const
 {
-    if (value == "horizontal") return mensuralVis_MENSURFORM_horizontal;
-    if (value == "vertical") return mensuralVis_MENSURFORM_vertical;
+    switch (value.size()) {
+        case 8:
+            if (value == "vertical") return mensuralVis_MENSURFORM_vertical;
+            break;
+        case 10:
+            if (value == "horizontal") return mensuralVis_MENSURFORM_horizontal;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.mensural.vis@mensur.form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.mensural.vis@mensur.form", std::string(value).c_str());
     return mensuralVis_MENSURFORM_NONE;
 }
 
@@ -4032,13 +5052,18 @@ std::string AttConverter::MeterConformanceMetconToStr(meterConformance_METCON da
     return value;
 }
 
-meterConformance_METCON AttConverter::StrToMeterConformanceMetcon(std::string value, bool logWarning) const
+meterConformance_METCON AttConverter::StrToMeterConformanceMetcon(std::string_view value, bool logWarning) const
 {
-    if (value == "c") return meterConformance_METCON_c;
-    if (value == "i") return meterConformance_METCON_i;
-    if (value == "o") return meterConformance_METCON_o;
+    switch (value.size()) {
+        case 1:
+            if (value == "c") return meterConformance_METCON_c;
+            if (value == "i") return meterConformance_METCON_i;
+            if (value == "o") return meterConformance_METCON_o;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.meterConformance@metcon", value.c_str());
+        LogWarning("Unsupported value '%s' for att.meterConformance@metcon", std::string(value).c_str());
     return meterConformance_METCON_NONE;
 }
 
@@ -4057,13 +5082,22 @@ std::string AttConverter::MeterSigGrpLogFuncToStr(meterSigGrpLog_FUNC data) cons
     return value;
 }
 
-meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(std::string value, bool logWarning) const
+meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(std::string_view value, bool logWarning) const
 {
-    if (value == "alternating") return meterSigGrpLog_FUNC_alternating;
-    if (value == "interchanging") return meterSigGrpLog_FUNC_interchanging;
-    if (value == "mixed") return meterSigGrpLog_FUNC_mixed;
+    switch (value.size()) {
+        case 5:
+            if (value == "mixed") return meterSigGrpLog_FUNC_mixed;
+            break;
+        case 11:
+            if (value == "alternating") return meterSigGrpLog_FUNC_alternating;
+            break;
+        case 13:
+            if (value == "interchanging") return meterSigGrpLog_FUNC_interchanging;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.meterSigGrp.log@func", value.c_str());
+        LogWarning("Unsupported value '%s' for att.meterSigGrp.log@func", std::string(value).c_str());
     return meterSigGrpLog_FUNC_NONE;
 }
 
@@ -4081,12 +5115,17 @@ std::string AttConverter::MordentLogFormToStr(mordentLog_FORM data) const
     return value;
 }
 
-mordentLog_FORM AttConverter::StrToMordentLogForm(std::string value, bool logWarning) const
+mordentLog_FORM AttConverter::StrToMordentLogForm(std::string_view value, bool logWarning) const
 {
-    if (value == "lower") return mordentLog_FORM_lower;
-    if (value == "upper") return mordentLog_FORM_upper;
+    switch (value.size()) {
+        case 5:
+            if (value == "lower") return mordentLog_FORM_lower;
+            if (value == "upper") return mordentLog_FORM_upper;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.mordent.log@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.mordent.log@form", std::string(value).c_str());
     return mordentLog_FORM_NONE;
 }
 
@@ -4105,13 +5144,18 @@ std::string AttConverter::NcFormConToStr(ncForm_CON data) const
     return value;
 }
 
-ncForm_CON AttConverter::StrToNcFormCon(std::string value, bool logWarning) const
+ncForm_CON AttConverter::StrToNcFormCon(std::string_view value, bool logWarning) const
 {
-    if (value == "g") return ncForm_CON_g;
-    if (value == "l") return ncForm_CON_l;
-    if (value == "e") return ncForm_CON_e;
+    switch (value.size()) {
+        case 1:
+            if (value == "g") return ncForm_CON_g;
+            if (value == "l") return ncForm_CON_l;
+            if (value == "e") return ncForm_CON_e;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.ncForm@con", value.c_str());
+        LogWarning("Unsupported value '%s' for att.ncForm@con", std::string(value).c_str());
     return ncForm_CON_NONE;
 }
 
@@ -4129,12 +5173,17 @@ std::string AttConverter::NcFormCurveToStr(ncForm_CURVE data) const
     return value;
 }
 
-ncForm_CURVE AttConverter::StrToNcFormCurve(std::string value, bool logWarning) const
+ncForm_CURVE AttConverter::StrToNcFormCurve(std::string_view value, bool logWarning) const
 {
-    if (value == "a") return ncForm_CURVE_a;
-    if (value == "c") return ncForm_CURVE_c;
+    switch (value.size()) {
+        case 1:
+            if (value == "a") return ncForm_CURVE_a;
+            if (value == "c") return ncForm_CURVE_c;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.ncForm@curve", value.c_str());
+        LogWarning("Unsupported value '%s' for att.ncForm@curve", std::string(value).c_str());
     return ncForm_CURVE_NONE;
 }
 
@@ -4152,12 +5201,17 @@ std::string AttConverter::NcFormRellenToStr(ncForm_RELLEN data) const
     return value;
 }
 
-ncForm_RELLEN AttConverter::StrToNcFormRellen(std::string value, bool logWarning) const
+ncForm_RELLEN AttConverter::StrToNcFormRellen(std::string_view value, bool logWarning) const
 {
-    if (value == "l") return ncForm_RELLEN_l;
-    if (value == "s") return ncForm_RELLEN_s;
+    switch (value.size()) {
+        case 1:
+            if (value == "l") return ncForm_RELLEN_l;
+            if (value == "s") return ncForm_RELLEN_s;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.ncForm@rellen", value.c_str());
+        LogWarning("Unsupported value '%s' for att.ncForm@rellen", std::string(value).c_str());
     return ncForm_RELLEN_NONE;
 }
 
@@ -4175,12 +5229,19 @@ std::string AttConverter::NoteAnlMensuralLigToStr(noteAnlMensural_LIG data) cons
     return value;
 }
 
-noteAnlMensural_LIG AttConverter::StrToNoteAnlMensuralLig(std::string value, bool logWarning) const
+noteAnlMensural_LIG AttConverter::StrToNoteAnlMensuralLig(std::string_view value, bool logWarning) const
 {
-    if (value == "recta") return noteAnlMensural_LIG_recta;
-    if (value == "obliqua") return noteAnlMensural_LIG_obliqua;
+    switch (value.size()) {
+        case 5:
+            if (value == "recta") return noteAnlMensural_LIG_recta;
+            break;
+        case 7:
+            if (value == "obliqua") return noteAnlMensural_LIG_obliqua;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.note.anl.mensural@lig", value.c_str());
+        LogWarning("Unsupported value '%s' for att.note.anl.mensural@lig", std::string(value).c_str());
     return noteAnlMensural_LIG_NONE;
 }
 
@@ -4198,12 +5259,19 @@ std::string AttConverter::NoteGesExtremisToStr(noteGes_EXTREMIS data) const
     return value;
 }
 
-noteGes_EXTREMIS AttConverter::StrToNoteGesExtremis(std::string value, bool logWarning) const
+noteGes_EXTREMIS AttConverter::StrToNoteGesExtremis(std::string_view value, bool logWarning) const
 {
-    if (value == "highest") return noteGes_EXTREMIS_highest;
-    if (value == "lowest") return noteGes_EXTREMIS_lowest;
+    switch (value.size()) {
+        case 6:
+            if (value == "lowest") return noteGes_EXTREMIS_lowest;
+            break;
+        case 7:
+            if (value == "highest") return noteGes_EXTREMIS_highest;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.note.ges@extremis", value.c_str());
+        LogWarning("Unsupported value '%s' for att.note.ges@extremis", std::string(value).c_str());
     return noteGes_EXTREMIS_NONE;
 }
 
@@ -4220,11 +5288,16 @@ std::string AttConverter::NoteHeadsHeadauthToStr(noteHeads_HEADAUTH data) const
     return value;
 }
 
-noteHeads_HEADAUTH AttConverter::StrToNoteHeadsHeadauth(std::string value, bool logWarning) const
+noteHeads_HEADAUTH AttConverter::StrToNoteHeadsHeadauth(std::string_view value, bool logWarning) const
 {
-    if (value == "smufl") return noteHeads_HEADAUTH_smufl;
+    switch (value.size()) {
+        case 5:
+            if (value == "smufl") return noteHeads_HEADAUTH_smufl;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.noteHeads@head.auth", value.c_str());
+        LogWarning("Unsupported value '%s' for att.noteHeads@head.auth", std::string(value).c_str());
     return noteHeads_HEADAUTH_NONE;
 }
 
@@ -4241,11 +5314,16 @@ std::string AttConverter::OctaveLogCollToStr(octaveLog_COLL data) const
     return value;
 }
 
-octaveLog_COLL AttConverter::StrToOctaveLogColl(std::string value, bool logWarning) const
+octaveLog_COLL AttConverter::StrToOctaveLogColl(std::string_view value, bool logWarning) const
 {
-    if (value == "coll") return octaveLog_COLL_coll;
+    switch (value.size()) {
+        case 4:
+            if (value == "coll") return octaveLog_COLL_coll;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.octave.log@coll", value.c_str());
+        LogWarning("Unsupported value '%s' for att.octave.log@coll", std::string(value).c_str());
     return octaveLog_COLL_NONE;
 }
 
@@ -4263,12 +5341,17 @@ std::string AttConverter::PbVisFoliumToStr(pbVis_FOLIUM data) const
     return value;
 }
 
-pbVis_FOLIUM AttConverter::StrToPbVisFolium(std::string value, bool logWarning) const
+pbVis_FOLIUM AttConverter::StrToPbVisFolium(std::string_view value, bool logWarning) const
 {
-    if (value == "verso") return pbVis_FOLIUM_verso;
-    if (value == "recto") return pbVis_FOLIUM_recto;
+    switch (value.size()) {
+        case 5:
+            if (value == "verso") return pbVis_FOLIUM_verso;
+            if (value == "recto") return pbVis_FOLIUM_recto;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pb.vis@folium", value.c_str());
+        LogWarning("Unsupported value '%s' for att.pb.vis@folium", std::string(value).c_str());
     return pbVis_FOLIUM_NONE;
 }
 
@@ -4288,14 +5371,23 @@ std::string AttConverter::PedalLogDirToStr(pedalLog_DIR data) const
     return value;
 }
 
-pedalLog_DIR AttConverter::StrToPedalLogDir(std::string value, bool logWarning) const
+pedalLog_DIR AttConverter::StrToPedalLogDir(std::string_view value, bool logWarning) const
 {
-    if (value == "down") return pedalLog_DIR_down;
-    if (value == "up") return pedalLog_DIR_up;
-    if (value == "half") return pedalLog_DIR_half;
-    if (value == "bounce") return pedalLog_DIR_bounce;
+    switch (value.size()) {
+        case 2:
+            if (value == "up") return pedalLog_DIR_up;
+            break;
+        case 4:
+            if (value == "down") return pedalLog_DIR_down;
+            if (value == "half") return pedalLog_DIR_half;
+            break;
+        case 6:
+            if (value == "bounce") return pedalLog_DIR_bounce;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pedal.log@dir", value.c_str());
+        LogWarning("Unsupported value '%s' for att.pedal.log@dir", std::string(value).c_str());
     return pedalLog_DIR_NONE;
 }
 
@@ -4315,14 +5407,25 @@ std::string AttConverter::PedalLogFuncToStr(pedalLog_FUNC data) const
     return value;
 }
 
-pedalLog_FUNC AttConverter::StrToPedalLogFunc(std::string value, bool logWarning) const
+pedalLog_FUNC AttConverter::StrToPedalLogFunc(std::string_view value, bool logWarning) const
 {
-    if (value == "sustain") return pedalLog_FUNC_sustain;
-    if (value == "soft") return pedalLog_FUNC_soft;
-    if (value == "sostenuto") return pedalLog_FUNC_sostenuto;
-    if (value == "silent") return pedalLog_FUNC_silent;
+    switch (value.size()) {
+        case 4:
+            if (value == "soft") return pedalLog_FUNC_soft;
+            break;
+        case 6:
+            if (value == "silent") return pedalLog_FUNC_silent;
+            break;
+        case 7:
+            if (value == "sustain") return pedalLog_FUNC_sustain;
+            break;
+        case 9:
+            if (value == "sostenuto") return pedalLog_FUNC_sostenuto;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pedal.log@func", value.c_str());
+        LogWarning("Unsupported value '%s' for att.pedal.log@func", std::string(value).c_str());
     return pedalLog_FUNC_NONE;
 }
 
@@ -4341,13 +5444,22 @@ std::string AttConverter::PedalVisFormToStr(pedalVis_FORM data) const
     return value;
 }
 
-pedalVis_FORM AttConverter::StrToPedalVisForm(std::string value, bool logWarning) const
+pedalVis_FORM AttConverter::StrToPedalVisForm(std::string_view value, bool logWarning) const
 {
-    if (value == "line") return pedalVis_FORM_line;
-    if (value == "pedstar") return pedalVis_FORM_pedstar;
-    if (value == "altpedstar") return pedalVis_FORM_altpedstar;
+    switch (value.size()) {
+        case 4:
+            if (value == "line") return pedalVis_FORM_line;
+            break;
+        case 7:
+            if (value == "pedstar") return pedalVis_FORM_pedstar;
+            break;
+        case 10:
+            if (value == "altpedstar") return pedalVis_FORM_altpedstar;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pedal.vis@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.pedal.vis@form", std::string(value).c_str());
     return pedalVis_FORM_NONE;
 }
 
@@ -4366,13 +5478,22 @@ std::string AttConverter::PianoPedalsPedalstyleToStr(pianoPedals_PEDALSTYLE data
     return value;
 }
 
-pianoPedals_PEDALSTYLE AttConverter::StrToPianoPedalsPedalstyle(std::string value, bool logWarning) const
+pianoPedals_PEDALSTYLE AttConverter::StrToPianoPedalsPedalstyle(std::string_view value, bool logWarning) const
 {
-    if (value == "line") return pianoPedals_PEDALSTYLE_line;
-    if (value == "pedstar") return pianoPedals_PEDALSTYLE_pedstar;
-    if (value == "altpedstar") return pianoPedals_PEDALSTYLE_altpedstar;
+    switch (value.size()) {
+        case 4:
+            if (value == "line") return pianoPedals_PEDALSTYLE_line;
+            break;
+        case 7:
+            if (value == "pedstar") return pianoPedals_PEDALSTYLE_pedstar;
+            break;
+        case 10:
+            if (value == "altpedstar") return pianoPedals_PEDALSTYLE_altpedstar;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pianoPedals@pedal.style", value.c_str());
+        LogWarning("Unsupported value '%s' for att.pianoPedals@pedal.style", std::string(value).c_str());
     return pianoPedals_PEDALSTYLE_NONE;
 }
 
@@ -4392,14 +5513,25 @@ std::string AttConverter::PointingXlinkactuateToStr(pointing_XLINKACTUATE data)
     return value;
 }
 
-pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(std::string value, bool logWarning) const
+pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(std::string_view value, bool logWarning) const
 {
-    if (value == "onLoad") return pointing_XLINKACTUATE_onLoad;
-    if (value == "onRequest") return pointing_XLINKACTUATE_onRequest;
-    if (value == "none") return pointing_XLINKACTUATE_none;
-    if (value == "other") return pointing_XLINKACTUATE_other;
+    switch (value.size()) {
+        case 4:
+            if (value == "none") return pointing_XLINKACTUATE_none;
+            break;
+        case 5:
+            if (value == "other") return pointing_XLINKACTUATE_other;
+            break;
+        case 6:
+            if (value == "onLoad") return pointing_XLINKACTUATE_onLoad;
+            break;
+        case 9:
+            if (value == "onRequest") return pointing_XLINKACTUATE_onRequest;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pointing@xlink:actuate", value.c_str());
+        LogWarning("Unsupported value '%s' for att.pointing@xlink:actuate", std::string(value).c_str());
     return pointing_XLINKACTUATE_NONE;
 }
 
@@ -4420,15 +5552,26 @@ std::string AttConverter::PointingXlinkshowToStr(pointing_XLINKSHOW data) const
     return value;
 }
 
-pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(std::string value, bool logWarning) const
+pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(std::string_view value, bool logWarning) const
 {
-    if (value == "new") return pointing_XLINKSHOW_new;
-    if (value == "replace") return pointing_XLINKSHOW_replace;
-    if (value == "embed") return pointing_XLINKSHOW_embed;
-    if (value == "none") return pointing_XLINKSHOW_none;
-    if (value == "other") return pointing_XLINKSHOW_other;
+    switch (value.size()) {
+        case 3:
+            if (value == "new") return pointing_XLINKSHOW_new;
+            break;
+        case 4:
+            if (value == "none") return pointing_XLINKSHOW_none;
+            break;
+        case 5:
+            if (value == "embed") return pointing_XLINKSHOW_embed;
+            if (value == "other") return pointing_XLINKSHOW_other;
+            break;
+        case 7:
+            if (value == "replace") return pointing_XLINKSHOW_replace;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.pointing@xlink:show", value.c_str());
+        LogWarning("Unsupported value '%s' for att.pointing@xlink:show", std::string(value).c_str());
     return pointing_XLINKSHOW_NONE;
 }
 
@@ -4458,24 +5601,29 @@ std::string AttConverter::RecordTypeRecordtypeToStr(recordType_RECORDTYPE data)
     return value;
 }
 
-recordType_RECORDTYPE AttConverter::StrToRecordTypeRecordtype(std::string value, bool logWarning) const
+recordType_RECORDTYPE AttConverter::StrToRecordTypeRecordtype(std::string_view value, bool logWarning) const
 {
-    if (value == "a") return recordType_RECORDTYPE_a;
-    if (value == "c") return recordType_RECORDTYPE_c;
-    if (value == "d") return recordType_RECORDTYPE_d;
-    if (value == "e") return recordType_RECORDTYPE_e;
-    if (value == "f") return recordType_RECORDTYPE_f;
-    if (value == "g") return recordType_RECORDTYPE_g;
-    if (value == "i") return recordType_RECORDTYPE_i;
-    if (value == "j") return recordType_RECORDTYPE_j;
-    if (value == "k") return recordType_RECORDTYPE_k;
-    if (value == "m") return recordType_RECORDTYPE_m;
-    if (value == "o") return recordType_RECORDTYPE_o;
-    if (value == "p") return recordType_RECORDTYPE_p;
-    if (value == "r") return recordType_RECORDTYPE_r;
-    if (value == "t") return recordType_RECORDTYPE_t;
+    switch (value.size()) {
+        case 1:
+            if (value == "a") return recordType_RECORDTYPE_a;
+            if (value == "c") return recordType_RECORDTYPE_c;
+            if (value == "d") return recordType_RECORDTYPE_d;
+            if (value == "e") return recordType_RECORDTYPE_e;
+            if (value == "f") return recordType_RECORDTYPE_f;
+            if (value == "g") return recordType_RECORDTYPE_g;
+            if (value == "i") return recordType_RECORDTYPE_i;
+            if (value == "j") return recordType_RECORDTYPE_j;
+            if (value == "k") return recordType_RECORDTYPE_k;
+            if (value == "m") return recordType_RECORDTYPE_m;
+            if (value == "o") return recordType_RECORDTYPE_o;
+            if (value == "p") return recordType_RECORDTYPE_p;
+            if (value == "r") return recordType_RECORDTYPE_r;
+            if (value == "t") return recordType_RECORDTYPE_t;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.recordType@recordtype", value.c_str());
+        LogWarning("Unsupported value '%s' for att.recordType@recordtype", std::string(value).c_str());
     return recordType_RECORDTYPE_NONE;
 }
 
@@ -4493,12 +5641,19 @@ std::string AttConverter::RegularMethodMethodToStr(regularMethod_METHOD data) co
     return value;
 }
 
-regularMethod_METHOD AttConverter::StrToRegularMethodMethod(std::string value, bool logWarning) const
+regularMethod_METHOD AttConverter::StrToRegularMethodMethod(std::string_view value, bool logWarning) const
 {
-    if (value == "silent") return regularMethod_METHOD_silent;
-    if (value == "tags") return regularMethod_METHOD_tags;
+    switch (value.size()) {
+        case 4:
+            if (value == "tags") return regularMethod_METHOD_tags;
+            break;
+        case 6:
+            if (value == "silent") return regularMethod_METHOD_silent;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.regularMethod@method", value.c_str());
+        LogWarning("Unsupported value '%s' for att.regularMethod@method", std::string(value).c_str());
     return regularMethod_METHOD_NONE;
 }
 
@@ -4517,13 +5672,22 @@ std::string AttConverter::RehearsalRehencloseToStr(rehearsal_REHENCLOSE data) co
     return value;
 }
 
-rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(std::string value, bool logWarning) const
+rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(std::string_view value, bool logWarning) const
 {
-    if (value == "box") return rehearsal_REHENCLOSE_box;
-    if (value == "circle") return rehearsal_REHENCLOSE_circle;
-    if (value == "none") return rehearsal_REHENCLOSE_none;
+    switch (value.size()) {
+        case 3:
+            if (value == "box") return rehearsal_REHENCLOSE_box;
+            break;
+        case 4:
+            if (value == "none") return rehearsal_REHENCLOSE_none;
+            break;
+        case 6:
+            if (value == "circle") return rehearsal_REHENCLOSE_circle;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.rehearsal@reh.enclose", value.c_str());
+        LogWarning("Unsupported value '%s' for att.rehearsal@reh.enclose", std::string(value).c_str());
     return rehearsal_REHENCLOSE_NONE;
 }
 
@@ -4540,11 +5704,16 @@ std::string AttConverter::SbVisFormToStr(sbVis_FORM data) const
     return value;
 }
 
-sbVis_FORM AttConverter::StrToSbVisForm(std::string value, bool logWarning) const
+sbVis_FORM AttConverter::StrToSbVisForm(std::string_view value, bool logWarning) const
 {
-    if (value == "hash") return sbVis_FORM_hash;
+    switch (value.size()) {
+        case 4:
+            if (value == "hash") return sbVis_FORM_hash;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.sb.vis@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.sb.vis@form", std::string(value).c_str());
     return sbVis_FORM_NONE;
 }
 
@@ -4565,15 +5734,26 @@ std::string AttConverter::StaffGroupingSymSymbolToStr(staffGroupingSym_SYMBOL da
     return value;
 }
 
-staffGroupingSym_SYMBOL AttConverter::StrToStaffGroupingSymSymbol(std::string value, bool logWarning) const
+staffGroupingSym_SYMBOL AttConverter::StrToStaffGroupingSymSymbol(std::string_view value, bool logWarning) const
 {
-    if (value == "brace") return staffGroupingSym_SYMBOL_brace;
-    if (value == "bracket") return staffGroupingSym_SYMBOL_bracket;
-    if (value == "bracketsq") return staffGroupingSym_SYMBOL_bracketsq;
-    if (value == "line") return staffGroupingSym_SYMBOL_line;
-    if (value == "none") return staffGroupingSym_SYMBOL_none;
+    switch (value.size()) {
+        case 4:
+            if (value == "line") return staffGroupingSym_SYMBOL_line;
+            if (value == "none") return staffGroupingSym_SYMBOL_none;
+            break;
+        case 5:
+            if (value == "brace") return staffGroupingSym_SYMBOL_brace;
+            break;
+        case 7:
+            if (value == "bracket") return staffGroupingSym_SYMBOL_bracket;
+            break;
+        case 9:
+            if (value == "bracketsq") return staffGroupingSym_SYMBOL_bracketsq;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.staffGroupingSym@symbol", value.c_str());
+        LogWarning("Unsupported value '%s' for att.staffGroupingSym@symbol", std::string(value).c_str());
     return staffGroupingSym_SYMBOL_NONE;
 }
 
@@ -4597,18 +5777,23 @@ std::string AttConverter::SylLogConToStr(sylLog_CON data) const
     return value;
 }
 
-sylLog_CON AttConverter::StrToSylLogCon(std::string value, bool logWarning) const
+sylLog_CON AttConverter::StrToSylLogCon(std::string_view value, bool logWarning) const
 {
-    if (value == "s") return sylLog_CON_s;
-    if (value == "d") return sylLog_CON_d;
-    if (value == "u") return sylLog_CON_u;
-    if (value == "t") return sylLog_CON_t;
-    if (value == "c") return sylLog_CON_c;
-    if (value == "v") return sylLog_CON_v;
-    if (value == "i") return sylLog_CON_i;
-    if (value == "b") return sylLog_CON_b;
+    switch (value.size()) {
+        case 1:
+            if (value == "s") return sylLog_CON_s;
+            if (value == "d") return sylLog_CON_d;
+            if (value == "u") return sylLog_CON_u;
+            if (value == "t") return sylLog_CON_t;
+            if (value == "c") return sylLog_CON_c;
+            if (value == "v") return sylLog_CON_v;
+            if (value == "i") return sylLog_CON_i;
+            if (value == "b") return sylLog_CON_b;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.syl.log@con", value.c_str());
+        LogWarning("Unsupported value '%s' for att.syl.log@con", std::string(value).c_str());
     return sylLog_CON_NONE;
 }
 
@@ -4628,14 +5813,19 @@ std::string AttConverter::SylLogWordposToStr(sylLog_WORDPOS data) const
     return value;
 }
 
-sylLog_WORDPOS AttConverter::StrToSylLogWordpos(std::string value, bool logWarning) const
+sylLog_WORDPOS AttConverter::StrToSylLogWordpos(std::string_view value, bool logWarning) const
 {
-    if (value == "i") return sylLog_WORDPOS_i;
-    if (value == "m") return sylLog_WORDPOS_m;
-    if (value == "s") return sylLog_WORDPOS_s;
-    if (value == "t") return sylLog_WORDPOS_t;
+    switch (value.size()) {
+        case 1:
+            if (value == "i") return sylLog_WORDPOS_i;
+            if (value == "m") return sylLog_WORDPOS_m;
+            if (value == "s") return sylLog_WORDPOS_s;
+            if (value == "t") return sylLog_WORDPOS_t;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.syl.log@wordpos", value.c_str());
+        LogWarning("Unsupported value '%s' for att.syl.log@wordpos", std::string(value).c_str());
     return sylLog_WORDPOS_NONE;
 }
 
@@ -4654,13 +5844,20 @@ std::string AttConverter::TargetEvalEvaluateToStr(targetEval_EVALUATE data) cons
     return value;
 }
 
-targetEval_EVALUATE AttConverter::StrToTargetEvalEvaluate(std::string value, bool logWarning) const
+targetEval_EVALUATE AttConverter::StrToTargetEvalEvaluate(std::string_view value, bool logWarning) const
 {
-    if (value == "all") return targetEval_EVALUATE_all;
-    if (value == "one") return targetEval_EVALUATE_one;
-    if (value == "none") return targetEval_EVALUATE_none;
+    switch (value.size()) {
+        case 3:
+            if (value == "all") return targetEval_EVALUATE_all;
+            if (value == "one") return targetEval_EVALUATE_one;
+            break;
+        case 4:
+            if (value == "none") return targetEval_EVALUATE_none;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.targetEval@evaluate", value.c_str());
+        LogWarning("Unsupported value '%s' for att.targetEval@evaluate", std::string(value).c_str());
     return targetEval_EVALUATE_NONE;
 }
 
@@ -4680,14 +5877,23 @@ std::string AttConverter::TempoLogFuncToStr(tempoLog_FUNC data) const
     return value;
 }
 
-tempoLog_FUNC AttConverter::StrToTempoLogFunc(std::string value, bool logWarning) const
+tempoLog_FUNC AttConverter::StrToTempoLogFunc(std::string_view value, bool logWarning) const
 {
-    if (value == "continuous") return tempoLog_FUNC_continuous;
-    if (value == "instantaneous") return tempoLog_FUNC_instantaneous;
-    if (value == "metricmod") return tempoLog_FUNC_metricmod;
-    if (value == "precedente") return tempoLog_FUNC_precedente;
+    switch (value.size()) {
+        case 9:
+            if (value == "metricmod") return tempoLog_FUNC_metricmod;
+            break;
+        case 10:
+            if (value == "continuous") return tempoLog_FUNC_continuous;
+            if (value == "precedente") return tempoLog_FUNC_precedente;
+            break;
+        case 13:
+            if (value == "instantaneous") return tempoLog_FUNC_instantaneous;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.tempo.log@func", value.c_str());
+        LogWarning("Unsupported value '%s' for att.tempo.log@func", std::string(value).c_str());
     return tempoLog_FUNC_NONE;
 }
 
@@ -4705,12 +5911,17 @@ std::string AttConverter::TupletVisNumformatToStr(tupletVis_NUMFORMAT data) cons
     return value;
 }
 
-tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(std::string value, bool logWarning) const
+tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(std::string_view value, bool logWarning) const
 {
-    if (value == "count") return tupletVis_NUMFORMAT_count;
-    if (value == "ratio") return tupletVis_NUMFORMAT_ratio;
+    switch (value.size()) {
+        case 5:
+            if (value == "count") return tupletVis_NUMFORMAT_count;
+            if (value == "ratio") return tupletVis_NUMFORMAT_ratio;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.tuplet.vis@num.format", value.c_str());
+        LogWarning("Unsupported value '%s' for att.tuplet.vis@num.format", std::string(value).c_str());
     return tupletVis_NUMFORMAT_NONE;
 }
 
@@ -4728,12 +5939,17 @@ std::string AttConverter::TurnLogFormToStr(turnLog_FORM data) const
     return value;
 }
 
-turnLog_FORM AttConverter::StrToTurnLogForm(std::string value, bool logWarning) const
+turnLog_FORM AttConverter::StrToTurnLogForm(std::string_view value, bool logWarning) const
 {
-    if (value == "lower") return turnLog_FORM_lower;
-    if (value == "upper") return turnLog_FORM_upper;
+    switch (value.size()) {
+        case 5:
+            if (value == "lower") return turnLog_FORM_lower;
+            if (value == "upper") return turnLog_FORM_upper;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.turn.log@form", value.c_str());
+        LogWarning("Unsupported value '%s' for att.turn.log@form", std::string(value).c_str());
     return turnLog_FORM_NONE;
 }
 
@@ -4754,15 +5970,26 @@ std::string AttConverter::VoltaGroupingSymVoltasymToStr(voltaGroupingSym_VOLTASY
     return value;
 }
 
-voltaGroupingSym_VOLTASYM AttConverter::StrToVoltaGroupingSymVoltasym(std::string value, bool logWarning) const
+voltaGroupingSym_VOLTASYM AttConverter::StrToVoltaGroupingSymVoltasym(std::string_view value, bool logWarning) const
 {
-    if (value == "brace") return voltaGroupingSym_VOLTASYM_brace;
-    if (value == "bracket") return voltaGroupingSym_VOLTASYM_bracket;
-    if (value == "bracketsq") return voltaGroupingSym_VOLTASYM_bracketsq;
-    if (value == "line") return voltaGroupingSym_VOLTASYM_line;
-    if (value == "none") return voltaGroupingSym_VOLTASYM_none;
+    switch (value.size()) {
+        case 4:
+            if (value == "line") return voltaGroupingSym_VOLTASYM_line;
+            if (value == "none") return voltaGroupingSym_VOLTASYM_none;
+            break;
+        case 5:
+            if (value == "brace") return voltaGroupingSym_VOLTASYM_brace;
+            break;
+        case 7:
+            if (value == "bracket") return voltaGroupingSym_VOLTASYM_bracket;
+            break;
+        case 9:
+            if (value == "bracketsq") return voltaGroupingSym_VOLTASYM_bracketsq;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.voltaGroupingSym@voltasym", value.c_str());
+        LogWarning("Unsupported value '%s' for att.voltaGroupingSym@voltasym", std::string(value).c_str());
     return voltaGroupingSym_VOLTASYM_NONE;
 }
 
@@ -4780,12 +6007,19 @@ std::string AttConverter::WhitespaceXmlspaceToStr(whitespace_XMLSPACE data) cons
     return value;
 }
 
-whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(std::string value, bool logWarning) const
+whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(std::string_view value, bool logWarning) const
 {
-    if (value == "default") return whitespace_XMLSPACE_default;
-    if (value == "preserve") return whitespace_XMLSPACE_preserve;
+    switch (value.size()) {
+        case 7:
+            if (value == "default") return whitespace_XMLSPACE_default;
+            break;
+        case 8:
+            if (value == "preserve") return whitespace_XMLSPACE_preserve;
+            break;
+        default: break;
+    }
     if (logWarning && !value.empty())
-        LogWarning("Unsupported value '%s' for att.whitespace@xml:space", value.c_str());
+        LogWarning("Unsupported value '%s' for att.whitespace@xml:space", std::string(value).c_str());
     return whitespace_XMLSPACE_NONE;
 }
 
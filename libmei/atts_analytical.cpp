@@ -44,12 +44,12 @@ void AttHarmAnl::ResetHarmAnl()
     m_form = harmAnl_FORM_NONE;
 }
 
-bool AttHarmAnl::ReadHarmAnl(pugi::xml_node element)
+bool AttHarmAnl::ReadHarmAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHarmAnlForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToHarmAnlForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +90,12 @@ void AttHarmonicFunction::ResetHarmonicFunction()
     m_deg = "";
 }
 
-bool AttHarmonicFunction::ReadHarmonicFunction(pugi::xml_node element)
+bool AttHarmonicFunction::ReadHarmonicFunction(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("deg")) {
-        this->SetDeg(StrToStr(element.attribute("deg").value()));
-        element.remove_attribute("deg");
+    if (pugi::xml_attribute attribute = element.attribute("deg")) {
+        this->SetDeg(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -136,12 +136,12 @@ void AttIntervalHarmonic::ResetIntervalHarmonic()
     m_inth = "";
 }
 
-bool AttIntervalHarmonic::ReadIntervalHarmonic(pugi::xml_node element)
+bool AttIntervalHarmonic::ReadIntervalHarmonic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("inth")) {
-        this->SetInth(StrToStr(element.attribute("inth").value()));
-        element.remove_attribute("inth");
+    if (pugi::xml_attribute attribute = element.attribute("inth")) {
+        this->SetInth(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -182,12 +182,12 @@ void AttIntervalMelodic::ResetIntervalMelodic()
     m_intm = "";
 }
 
-bool AttIntervalMelodic::ReadIntervalMelodic(pugi::xml_node element)
+bool AttIntervalMelodic::ReadIntervalMelodic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("intm")) {
-        this->SetIntm(StrToStr(element.attribute("intm").value()));
-        element.remove_attribute("intm");
+    if (pugi::xml_attribute attribute = element.attribute("intm")) {
+        this->SetIntm(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -228,12 +228,12 @@ void AttKeySigAnl::ResetKeySigAnl()
     m_mode = MODE_NONE;
 }
 
-bool AttKeySigAnl::ReadKeySigAnl(pugi::xml_node element)
+bool AttKeySigAnl::ReadKeySigAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mode")) {
-        this->SetMode(StrToMode(element.attribute("mode").value()));
-        element.remove_attribute("mode");
+    if (pugi::xml_attribute attribute = element.attribute("mode")) {
+        this->SetMode(StrToMode(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -276,22 +276,22 @@ void AttKeySigDefaultAnl::ResetKeySigDefaultAnl()
     m_keyPname = PITCHNAME_NONE;
 }
 
-bool AttKeySigDefaultAnl::ReadKeySigDefaultAnl(pugi::xml_node element)
+bool AttKeySigDefaultAnl::ReadKeySigDefaultAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.accid")) {
-        this->SetKeyAccid(StrToAccidentalGestural(element.attribute("key.accid").value()));
-        element.remove_attribute("key.accid");
+    if (pugi::xml_attribute attribute = element.attribute("key.accid")) {
+        this->SetKeyAccid(StrToAccidentalGestural(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("key.mode")) {
-        this->SetKeyMode(StrToMode(element.attribute("key.mode").value()));
-        element.remove_attribute("key.mode");
+    if (pugi::xml_attribute attribute = element.attribute("key.mode")) {
+        this->SetKeyMode(StrToMode(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("key.pname")) {
-        this->SetKeyPname(StrToPitchname(element.attribute("key.pname").value()));
-        element.remove_attribute("key.pname");
+    if (pugi::xml_attribute attribute = element.attribute("key.pname")) {
+        this->SetKeyPname(StrToPitchname(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -350,12 +350,12 @@ void AttMelodicFunction::ResetMelodicFunction()
     m_mfunc = MELODICFUNCTION_NONE;
 }
 
-bool AttMelodicFunction::ReadMelodicFunction(pugi::xml_node element)
+bool AttMelodicFunction::ReadMelodicFunction(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mfunc")) {
-        this->SetMfunc(StrToMelodicfunction(element.attribute("mfunc").value()));
-        element.remove_attribute("mfunc");
+    if (pugi::xml_attribute attribute = element.attribute("mfunc")) {
+        this->SetMfunc(StrToMelodicfunction(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -396,12 +396,12 @@ void AttPitchClass::ResetPitchClass()
     m_pclass = 0;
 }
 
-bool AttPitchClass::ReadPitchClass(pugi::xml_node element)
+bool AttPitchClass::ReadPitchClass(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pclass")) {
-        this->SetPclass(StrToInt(element.attribute("pclass").value()));
-        element.remove_attribute("pclass");
+    if (pugi::xml_attribute attribute = element.attribute("pclass")) {
+        this->SetPclass(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -442,12 +442,12 @@ void AttSolfa::ResetSolfa()
     m_psolfa = "";
 }
 
-bool AttSolfa::ReadSolfa(pugi::xml_node element)
+bool AttSolfa::ReadSolfa(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("psolfa")) {
-        this->SetPsolfa(StrToStr(element.attribute("psolfa").value()));
-        element.remove_attribute("psolfa");
+    if (pugi::xml_attribute attribute = element.attribute("psolfa")) {
+        this->SetPsolfa(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -32,13 +32,13 @@ namespace vrv {
 class AttHarmAnl : public Att {
 public:
     AttHarmAnl();
-    virtual ~AttHarmAnl();
+    ~AttHarmAnl();
 
     /** Reset the default values for the attribute class **/
     void ResetHarmAnl();
 
     /** Read the values for the attribute class **/
-    bool ReadHarmAnl(pugi::xml_node element);
+    bool ReadHarmAnl(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHarmAnl(pugi::xml_node element);
@@ -68,13 +68,13 @@ private:
 class AttHarmonicFunction : public Att {
 public:
     AttHarmonicFunction();
-    virtual ~AttHarmonicFunction();
+    ~AttHarmonicFunction();
 
     /** Reset the default values for the attribute class **/
     void ResetHarmonicFunction();
 
     /** Read the values for the attribute class **/
-    bool ReadHarmonicFunction(pugi::xml_node element);
+    bool ReadHarmonicFunction(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHarmonicFunction(pugi::xml_node element);
@@ -111,13 +111,13 @@ private:
 class AttIntervalHarmonic : public Att {
 public:
     AttIntervalHarmonic();
-    virtual ~AttIntervalHarmonic();
+    ~AttIntervalHarmonic();
 
     /** Reset the default values for the attribute class **/
     void ResetIntervalHarmonic();
 
     /** Read the values for the attribute class **/
-    bool ReadIntervalHarmonic(pugi::xml_node element);
+    bool ReadIntervalHarmonic(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteIntervalHarmonic(pugi::xml_node element);
@@ -147,13 +147,13 @@ private:
 class AttIntervalMelodic : public Att {
 public:
     AttIntervalMelodic();
-    virtual ~AttIntervalMelodic();
+    ~AttIntervalMelodic();
 
     /** Reset the default values for the attribute class **/
     void ResetIntervalMelodic();
 
     /** Read the values for the attribute class **/
-    bool ReadIntervalMelodic(pugi::xml_node element);
+    bool ReadIntervalMelodic(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteIntervalMelodic(pugi::xml_node element);
@@ -188,13 +188,13 @@ private:
 class AttKeySigAnl : public Att {
 public:
     AttKeySigAnl();
-    virtual ~AttKeySigAnl();
+    ~AttKeySigAnl();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigAnl();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigAnl(pugi::xml_node element);
+    bool ReadKeySigAnl(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigAnl(pugi::xml_node element);
@@ -224,13 +224,13 @@ private:
 class AttKeySigDefaultAnl : public Att {
 public:
     AttKeySigDefaultAnl();
-    virtual ~AttKeySigDefaultAnl();
+    ~AttKeySigDefaultAnl();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigDefaultAnl();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigDefaultAnl(pugi::xml_node element);
+    bool ReadKeySigDefaultAnl(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultAnl(pugi::xml_node element);
@@ -278,13 +278,13 @@ private:
 class AttMelodicFunction : public Att {
 public:
     AttMelodicFunction();
-    virtual ~AttMelodicFunction();
+    ~AttMelodicFunction();
 
     /** Reset the default values for the attribute class **/
     void ResetMelodicFunction();
 
     /** Read the values for the attribute class **/
-    bool ReadMelodicFunction(pugi::xml_node element);
+    bool ReadMelodicFunction(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMelodicFunction(pugi::xml_node element);
@@ -314,13 +314,13 @@ private:
 class AttPitchClass : public Att {
 public:
     AttPitchClass();
-    virtual ~AttPitchClass();
+    ~AttPitchClass();
 
     /** Reset the default values for the attribute class **/
     void ResetPitchClass();
 
     /** Read the values for the attribute class **/
-    bool ReadPitchClass(pugi::xml_node element);
+    bool ReadPitchClass(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePitchClass(pugi::xml_node element);
@@ -350,13 +350,13 @@ private:
 class AttSolfa : public Att {
 public:
     AttSolfa();
-    virtual ~AttSolfa();
+    ~AttSolfa();
 
     /** Reset the default values for the attribute class **/
     void ResetSolfa();
 
     /** Read the values for the attribute class **/
-    bool ReadSolfa(pugi::xml_node element);
+    bool ReadSolfa(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSolfa(pugi::xml_node element);
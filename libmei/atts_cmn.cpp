@@ -44,12 +44,12 @@ void AttArpegLog::ResetArpegLog()
     m_order = arpegLog_ORDER_NONE;
 }
 
-bool AttArpegLog::ReadArpegLog(pugi::xml_node element)
+bool AttArpegLog::ReadArpegLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("order")) {
-        this->SetOrder(StrToArpegLogOrder(element.attribute("order").value()));
-        element.remove_attribute("order");
+    if (pugi::xml_attribute attribute = element.attribute("order")) {
+        this->SetOrder(StrToArpegLogOrder(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +90,12 @@ void AttBTremLog::ResetBTremLog()
     m_form = bTremLog_FORM_NONE;
 }
 
-bool AttBTremLog::ReadBTremLog(pugi::xml_node element)
+bool AttBTremLog::ReadBTremLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBTremLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToBTremLogForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -136,12 +136,12 @@ void AttBeamPresent::ResetBeamPresent()
     m_beam = "";
 }
 
-bool AttBeamPresent::ReadBeamPresent(pugi::xml_node element)
+bool AttBeamPresent::ReadBeamPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam")) {
-        this->SetBeam(StrToStr(element.attribute("beam").value()));
-        element.remove_attribute("beam");
+    if (pugi::xml_attribute attribute = element.attribute("beam")) {
+        this->SetBeam(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -185,27 +185,27 @@ void AttBeamRend::ResetBeamRend()
     m_slope = 0.0;
 }
 
-bool AttBeamRend::ReadBeamRend(pugi::xml_node element)
+bool AttBeamRend::ReadBeamRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBeamRendForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToBeamRendForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToBeamplace(element.attribute("place").value()));
-        element.remove_attribute("place");
+    if (pugi::xml_attribute attribute = element.attribute("place")) {
+        this->SetPlace(StrToBeamplace(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBoolean(element.attribute("slash").value()));
-        element.remove_attribute("slash");
+    if (pugi::xml_attribute attribute = element.attribute("slash")) {
+        this->SetSlash(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("slope")) {
-        this->SetSlope(StrToDbl(element.attribute("slope").value()));
-        element.remove_attribute("slope");
+    if (pugi::xml_attribute attribute = element.attribute("slope")) {
+        this->SetSlope(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -273,12 +273,12 @@ void AttBeamSecondary::ResetBeamSecondary()
     m_breaksec = 0;
 }
 
-bool AttBeamSecondary::ReadBeamSecondary(pugi::xml_node element)
+bool AttBeamSecondary::ReadBeamSecondary(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("breaksec")) {
-        this->SetBreaksec(StrToInt(element.attribute("breaksec").value()));
-        element.remove_attribute("breaksec");
+    if (pugi::xml_attribute attribute = element.attribute("breaksec")) {
+        this->SetBreaksec(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -319,12 +319,12 @@ void AttBeamedWith::ResetBeamedWith()
     m_beamWith = OTHERSTAFF_NONE;
 }
 
-bool AttBeamedWith::ReadBeamedWith(pugi::xml_node element)
+bool AttBeamedWith::ReadBeamedWith(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.with")) {
-        this->SetBeamWith(StrToOtherstaff(element.attribute("beam.with").value()));
-        element.remove_attribute("beam.with");
+    if (pugi::xml_attribute attribute = element.attribute("beam.with")) {
+        this->SetBeamWith(StrToOtherstaff(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -366,17 +366,17 @@ void AttBeamingLog::ResetBeamingLog()
     m_beamRests = BOOLEAN_NONE;
 }
 
-bool AttBeamingLog::ReadBeamingLog(pugi::xml_node element)
+bool AttBeamingLog::ReadBeamingLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.group")) {
-        this->SetBeamGroup(StrToStr(element.attribute("beam.group").value()));
-        element.remove_attribute("beam.group");
+    if (pugi::xml_attribute attribute = element.attribute("beam.group")) {
+        this->SetBeamGroup(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("beam.rests")) {
-        this->SetBeamRests(StrToBoolean(element.attribute("beam.rests").value()));
-        element.remove_attribute("beam.rests");
+    if (pugi::xml_attribute attribute = element.attribute("beam.rests")) {
+        this->SetBeamRests(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -426,12 +426,12 @@ void AttBeatRptLog::ResetBeatRptLog()
     m_beatdef = 0.0;
 }
 
-bool AttBeatRptLog::ReadBeatRptLog(pugi::xml_node element)
+bool AttBeatRptLog::ReadBeatRptLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beatdef")) {
-        this->SetBeatdef(StrToDbl(element.attribute("beatdef").value()));
-        element.remove_attribute("beatdef");
+    if (pugi::xml_attribute attribute = element.attribute("beatdef")) {
+        this->SetBeatdef(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -472,12 +472,12 @@ void AttBracketSpanLog::ResetBracketSpanLog()
     m_func = "";
 }
 
-bool AttBracketSpanLog::ReadBracketSpanLog(pugi::xml_node element)
+bool AttBracketSpanLog::ReadBracketSpanLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -518,12 +518,12 @@ void AttCutout::ResetCutout()
     m_cutout = cutout_CUTOUT_NONE;
 }
 
-bool AttCutout::ReadCutout(pugi::xml_node element)
+bool AttCutout::ReadCutout(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cutout")) {
-        this->SetCutout(StrToCutoutCutout(element.attribute("cutout").value()));
-        element.remove_attribute("cutout");
+    if (pugi::xml_attribute attribute = element.attribute("cutout")) {
+        this->SetCutout(StrToCutoutCutout(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -564,12 +564,12 @@ void AttExpandable::ResetExpandable()
     m_expand = BOOLEAN_NONE;
 }
 
-bool AttExpandable::ReadExpandable(pugi::xml_node element)
+bool AttExpandable::ReadExpandable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("expand")) {
-        this->SetExpand(StrToBoolean(element.attribute("expand").value()));
-        element.remove_attribute("expand");
+    if (pugi::xml_attribute attribute = element.attribute("expand")) {
+        this->SetExpand(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -610,12 +610,12 @@ void AttFTremLog::ResetFTremLog()
     m_form = fTremLog_FORM_NONE;
 }
 
-bool AttFTremLog::ReadFTremLog(pugi::xml_node element)
+bool AttFTremLog::ReadFTremLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFTremLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToFTremLogForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -656,12 +656,12 @@ void AttGlissPresent::ResetGlissPresent()
     m_gliss = GLISSANDO_NONE;
 }
 
-bool AttGlissPresent::ReadGlissPresent(pugi::xml_node element)
+bool AttGlissPresent::ReadGlissPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("gliss")) {
-        this->SetGliss(StrToGlissando(element.attribute("gliss").value()));
-        element.remove_attribute("gliss");
+    if (pugi::xml_attribute attribute = element.attribute("gliss")) {
+        this->SetGliss(StrToGlissando(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -702,12 +702,12 @@ void AttGraceGrpLog::ResetGraceGrpLog()
     m_attach = graceGrpLog_ATTACH_NONE;
 }
 
-bool AttGraceGrpLog::ReadGraceGrpLog(pugi::xml_node element)
+bool AttGraceGrpLog::ReadGraceGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("attach")) {
-        this->SetAttach(StrToGraceGrpLogAttach(element.attribute("attach").value()));
-        element.remove_attribute("attach");
+    if (pugi::xml_attribute attribute = element.attribute("attach")) {
+        this->SetAttach(StrToGraceGrpLogAttach(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -749,17 +749,17 @@ void AttGraced::ResetGraced()
     m_graceTime = -1.0;
 }
 
-bool AttGraced::ReadGraced(pugi::xml_node element)
+bool AttGraced::ReadGraced(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grace")) {
-        this->SetGrace(StrToGrace(element.attribute("grace").value()));
-        element.remove_attribute("grace");
+    if (pugi::xml_attribute attribute = element.attribute("grace")) {
+        this->SetGrace(StrToGrace(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("grace.time")) {
-        this->SetGraceTime(StrToPercent(element.attribute("grace.time").value()));
-        element.remove_attribute("grace.time");
+    if (pugi::xml_attribute attribute = element.attribute("grace.time")) {
+        this->SetGraceTime(StrToPercent(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -810,17 +810,17 @@ void AttHairpinLog::ResetHairpinLog()
     m_niente = BOOLEAN_NONE;
 }
 
-bool AttHairpinLog::ReadHairpinLog(pugi::xml_node element)
+bool AttHairpinLog::ReadHairpinLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHairpinLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToHairpinLogForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("niente")) {
-        this->SetNiente(StrToBoolean(element.attribute("niente").value()));
-        element.remove_attribute("niente");
+    if (pugi::xml_attribute attribute = element.attribute("niente")) {
+        this->SetNiente(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -876,42 +876,42 @@ void AttHarpPedalLog::ResetHarpPedalLog()
     m_b = harpPedalLog_B_NONE;
 }
 
-bool AttHarpPedalLog::ReadHarpPedalLog(pugi::xml_node element)
+bool AttHarpPedalLog::ReadHarpPedalLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("c")) {
-        this->SetC(StrToHarpPedalLogC(element.attribute("c").value()));
-        element.remove_attribute("c");
+    if (pugi::xml_attribute attribute = element.attribute("c")) {
+        this->SetC(StrToHarpPedalLogC(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("d")) {
-        this->SetD(StrToHarpPedalLogD(element.attribute("d").value()));
-        element.remove_attribute("d");
+    if (pugi::xml_attribute attribute = element.attribute("d")) {
+        this->SetD(StrToHarpPedalLogD(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("e")) {
-        this->SetE(StrToHarpPedalLogE(element.attribute("e").value()));
-        element.remove_attribute("e");
+    if (pugi::xml_attribute attribute = element.attribute("e")) {
+        this->SetE(StrToHarpPedalLogE(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("f")) {
-        this->SetF(StrToHarpPedalLogF(element.attribute("f").value()));
-        element.remove_attribute("f");
+    if (pugi::xml_attribute attribute = element.attribute("f")) {
+        this->SetF(StrToHarpPedalLogF(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("g")) {
-        this->SetG(StrToHarpPedalLogG(element.attribute("g").value()));
-        element.remove_attribute("g");
+    if (pugi::xml_attribute attribute = element.attribute("g")) {
+        this->SetG(StrToHarpPedalLogG(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("a")) {
-        this->SetA(StrToHarpPedalLogA(element.attribute("a").value()));
-        element.remove_attribute("a");
+    if (pugi::xml_attribute attribute = element.attribute("a")) {
+        this->SetA(StrToHarpPedalLogA(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("b")) {
-        this->SetB(StrToHarpPedalLogB(element.attribute("b").value()));
-        element.remove_attribute("b");
+    if (pugi::xml_attribute attribute = element.attribute("b")) {
+        this->SetB(StrToHarpPedalLogB(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1006,12 +1006,12 @@ void AttLvPresent::ResetLvPresent()
     m_lv = BOOLEAN_NONE;
 }
 
-bool AttLvPresent::ReadLvPresent(pugi::xml_node element)
+bool AttLvPresent::ReadLvPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lv")) {
-        this->SetLv(StrToBoolean(element.attribute("lv").value()));
-        element.remove_attribute("lv");
+    if (pugi::xml_attribute attribute = element.attribute("lv")) {
+        this->SetLv(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1053,17 +1053,17 @@ void AttMeasureLog::ResetMeasureLog()
     m_right = BARRENDITION_NONE;
 }
 
-bool AttMeasureLog::ReadMeasureLog(pugi::xml_node element)
+bool AttMeasureLog::ReadMeasureLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("left")) {
-        this->SetLeft(StrToBarrendition(element.attribute("left").value()));
-        element.remove_attribute("left");
+    if (pugi::xml_attribute attribute = element.attribute("left")) {
+        this->SetLeft(StrToBarrendition(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("right")) {
-        this->SetRight(StrToBarrendition(element.attribute("right").value()));
-        element.remove_attribute("right");
+    if (pugi::xml_attribute attribute = element.attribute("right")) {
+        this->SetRight(StrToBarrendition(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1113,12 +1113,12 @@ void AttMeterSigGrpLog::ResetMeterSigGrpLog()
     m_func = meterSigGrpLog_FUNC_NONE;
 }
 
-bool AttMeterSigGrpLog::ReadMeterSigGrpLog(pugi::xml_node element)
+bool AttMeterSigGrpLog::ReadMeterSigGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToMeterSigGrpLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToMeterSigGrpLogFunc(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1160,17 +1160,17 @@ void AttNumberPlacement::ResetNumberPlacement()
     m_numVisible = BOOLEAN_NONE;
 }
 
-bool AttNumberPlacement::ReadNumberPlacement(pugi::xml_node element)
+bool AttNumberPlacement::ReadNumberPlacement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num.place")) {
-        this->SetNumPlace(StrToStaffrelBasic(element.attribute("num.place").value()));
-        element.remove_attribute("num.place");
+    if (pugi::xml_attribute attribute = element.attribute("num.place")) {
+        this->SetNumPlace(StrToStaffrelBasic(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("num.visible")) {
-        this->SetNumVisible(StrToBoolean(element.attribute("num.visible").value()));
-        element.remove_attribute("num.visible");
+    if (pugi::xml_attribute attribute = element.attribute("num.visible")) {
+        this->SetNumVisible(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1220,12 +1220,12 @@ void AttNumbered::ResetNumbered()
     m_num = 0;
 }
 
-bool AttNumbered::ReadNumbered(pugi::xml_node element)
+bool AttNumbered::ReadNumbered(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    if (pugi::xml_attribute attribute = element.attribute("num")) {
+        this->SetNum(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1266,12 +1266,12 @@ void AttOctaveLog::ResetOctaveLog()
     m_coll = octaveLog_COLL_NONE;
 }
 
-bool AttOctaveLog::ReadOctaveLog(pugi::xml_node element)
+bool AttOctaveLog::ReadOctaveLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coll")) {
-        this->SetColl(StrToOctaveLogColl(element.attribute("coll").value()));
-        element.remove_attribute("coll");
+    if (pugi::xml_attribute attribute = element.attribute("coll")) {
+        this->SetColl(StrToOctaveLogColl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1313,17 +1313,17 @@ void AttPedalLog::ResetPedalLog()
     m_func = "";
 }
 
-bool AttPedalLog::ReadPedalLog(pugi::xml_node element)
+bool AttPedalLog::ReadPedalLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToPedalLogDir(element.attribute("dir").value()));
-        element.remove_attribute("dir");
+    if (pugi::xml_attribute attribute = element.attribute("dir")) {
+        this->SetDir(StrToPedalLogDir(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1373,12 +1373,12 @@ void AttPianoPedals::ResetPianoPedals()
     m_pedalStyle = pianoPedals_PEDALSTYLE_NONE;
 }
 
-bool AttPianoPedals::ReadPianoPedals(pugi::xml_node element)
+bool AttPianoPedals::ReadPianoPedals(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pedal.style")) {
-        this->SetPedalStyle(StrToPianoPedalsPedalstyle(element.attribute("pedal.style").value()));
-        element.remove_attribute("pedal.style");
+    if (pugi::xml_attribute attribute = element.attribute("pedal.style")) {
+        this->SetPedalStyle(StrToPianoPedalsPedalstyle(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1419,12 +1419,12 @@ void AttRehearsal::ResetRehearsal()
     m_rehEnclose = rehearsal_REHENCLOSE_NONE;
 }
 
-bool AttRehearsal::ReadRehearsal(pugi::xml_node element)
+bool AttRehearsal::ReadRehearsal(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("reh.enclose")) {
-        this->SetRehEnclose(StrToRehearsalRehenclose(element.attribute("reh.enclose").value()));
-        element.remove_attribute("reh.enclose");
+    if (pugi::xml_attribute attribute = element.attribute("reh.enclose")) {
+        this->SetRehEnclose(StrToRehearsalRehenclose(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1465,12 +1465,12 @@ void AttScoreDefVisCmn::ResetScoreDefVisCmn()
     m_gridShow = BOOLEAN_NONE;
 }
 
-bool AttScoreDefVisCmn::ReadScoreDefVisCmn(pugi::xml_node element)
+bool AttScoreDefVisCmn::ReadScoreDefVisCmn(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        element.remove_attribute("grid.show");
+    if (pugi::xml_attribute attribute = element.attribute("grid.show")) {
+        this->SetGridShow(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1512,17 +1512,17 @@ void AttSlurRend::ResetSlurRend()
     m_slurLwidth = data_LINEWIDTH();
 }
 
-bool AttSlurRend::ReadSlurRend(pugi::xml_node element)
+bool AttSlurRend::ReadSlurRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur.lform")) {
-        this->SetSlurLform(StrToLineform(element.attribute("slur.lform").value()));
-        element.remove_attribute("slur.lform");
+    if (pugi::xml_attribute attribute = element.attribute("slur.lform")) {
+        this->SetSlurLform(StrToLineform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("slur.lwidth")) {
-        this->SetSlurLwidth(StrToLinewidth(element.attribute("slur.lwidth").value()));
-        element.remove_attribute("slur.lwidth");
+    if (pugi::xml_attribute attribute = element.attribute("slur.lwidth")) {
+        this->SetSlurLwidth(StrToLinewidth(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1572,12 +1572,12 @@ void AttStemsCmn::ResetStemsCmn()
     m_stemWith = OTHERSTAFF_NONE;
 }
 
-bool AttStemsCmn::ReadStemsCmn(pugi::xml_node element)
+bool AttStemsCmn::ReadStemsCmn(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.with")) {
-        this->SetStemWith(StrToOtherstaff(element.attribute("stem.with").value()));
-        element.remove_attribute("stem.with");
+    if (pugi::xml_attribute attribute = element.attribute("stem.with")) {
+        this->SetStemWith(StrToOtherstaff(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1619,17 +1619,17 @@ void AttTieRend::ResetTieRend()
     m_tieLwidth = data_LINEWIDTH();
 }
 
-bool AttTieRend::ReadTieRend(pugi::xml_node element)
+bool AttTieRend::ReadTieRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie.lform")) {
-        this->SetTieLform(StrToLineform(element.attribute("tie.lform").value()));
-        element.remove_attribute("tie.lform");
+    if (pugi::xml_attribute attribute = element.attribute("tie.lform")) {
+        this->SetTieLform(StrToLineform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tie.lwidth")) {
-        this->SetTieLwidth(StrToLinewidth(element.attribute("tie.lwidth").value()));
-        element.remove_attribute("tie.lwidth");
+    if (pugi::xml_attribute attribute = element.attribute("tie.lwidth")) {
+        this->SetTieLwidth(StrToLinewidth(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1679,12 +1679,12 @@ void AttTremMeasured::ResetTremMeasured()
     m_unitdur = DURATION_NONE;
 }
 
-bool AttTremMeasured::ReadTremMeasured(pugi::xml_node element)
+bool AttTremMeasured::ReadTremMeasured(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("unitdur")) {
-        this->SetUnitdur(StrToDuration(element.attribute("unitdur").value()));
-        element.remove_attribute("unitdur");
+    if (pugi::xml_attribute attribute = element.attribute("unitdur")) {
+        this->SetUnitdur(StrToDuration(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -32,13 +32,13 @@ namespace vrv {
 class AttArpegLog : public Att {
 public:
     AttArpegLog();
-    virtual ~AttArpegLog();
+    ~AttArpegLog();
 
     /** Reset the default values for the attribute class **/
     void ResetArpegLog();
 
     /** Read the values for the attribute class **/
-    bool ReadArpegLog(pugi::xml_node element);
+    bool ReadArpegLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteArpegLog(pugi::xml_node element);
@@ -68,13 +68,13 @@ private:
 class AttBTremLog : public Att {
 public:
     AttBTremLog();
-    virtual ~AttBTremLog();
+    ~AttBTremLog();
 
     /** Reset the default values for the attribute class **/
     void ResetBTremLog();
 
     /** Read the values for the attribute class **/
-    bool ReadBTremLog(pugi::xml_node element);
+    bool ReadBTremLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBTremLog(pugi::xml_node element);
@@ -104,13 +104,13 @@ private:
 class AttBeamPresent : public Att {
 public:
     AttBeamPresent();
-    virtual ~AttBeamPresent();
+    ~AttBeamPresent();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamPresent();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamPresent(pugi::xml_node element);
+    bool ReadBeamPresent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBeamPresent(pugi::xml_node element);
@@ -140,13 +140,13 @@ private:
 class AttBeamRend : public Att {
 public:
     AttBeamRend();
-    virtual ~AttBeamRend();
+    ~AttBeamRend();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamRend();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamRend(pugi::xml_node element);
+    bool ReadBeamRend(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBeamRend(pugi::xml_node element);
@@ -194,13 +194,13 @@ private:
 class AttBeamSecondary : public Att {
 public:
     AttBeamSecondary();
-    virtual ~AttBeamSecondary();
+    ~AttBeamSecondary();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamSecondary();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamSecondary(pugi::xml_node element);
+    bool ReadBeamSecondary(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBeamSecondary(pugi::xml_node element);
@@ -235,13 +235,13 @@ private:
 class AttBeamedWith : public Att {
 public:
     AttBeamedWith();
-    virtual ~AttBeamedWith();
+    ~AttBeamedWith();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamedWith();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamedWith(pugi::xml_node element);
+    bool ReadBeamedWith(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBeamedWith(pugi::xml_node element);
@@ -275,13 +275,13 @@ private:
 class AttBeamingLog : public Att {
 public:
     AttBeamingLog();
-    virtual ~AttBeamingLog();
+    ~AttBeamingLog();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamingLog();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamingLog(pugi::xml_node element);
+    bool ReadBeamingLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBeamingLog(pugi::xml_node element);
@@ -323,13 +323,13 @@ private:
 class AttBeatRptLog : public Att {
 public:
     AttBeatRptLog();
-    virtual ~AttBeatRptLog();
+    ~AttBeatRptLog();
 
     /** Reset the default values for the attribute class **/
     void ResetBeatRptLog();
 
     /** Read the values for the attribute class **/
-    bool ReadBeatRptLog(pugi::xml_node element);
+    bool ReadBeatRptLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBeatRptLog(pugi::xml_node element);
@@ -362,13 +362,13 @@ private:
 class AttBracketSpanLog : public Att {
 public:
     AttBracketSpanLog();
-    virtual ~AttBracketSpanLog();
+    ~AttBracketSpanLog();
 
     /** Reset the default values for the attribute class **/
     void ResetBracketSpanLog();
 
     /** Read the values for the attribute class **/
-    bool ReadBracketSpanLog(pugi::xml_node element);
+    bool ReadBracketSpanLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBracketSpanLog(pugi::xml_node element);
@@ -398,13 +398,13 @@ private:
 class AttCutout : public Att {
 public:
     AttCutout();
-    virtual ~AttCutout();
+    ~AttCutout();
 
     /** Reset the default values for the attribute class **/
     void ResetCutout();
 
     /** Read the values for the attribute class **/
-    bool ReadCutout(pugi::xml_node element);
+    bool ReadCutout(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCutout(pugi::xml_node element);
@@ -434,13 +434,13 @@ private:
 class AttExpandable : public Att {
 public:
     AttExpandable();
-    virtual ~AttExpandable();
+    ~AttExpandable();
 
     /** Reset the default values for the attribute class **/
     void ResetExpandable();
 
     /** Read the values for the attribute class **/
-    bool ReadExpandable(pugi::xml_node element);
+    bool ReadExpandable(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteExpandable(pugi::xml_node element);
@@ -475,13 +475,13 @@ private:
 class AttFTremLog : public Att {
 public:
     AttFTremLog();
-    virtual ~AttFTremLog();
+    ~AttFTremLog();
 
     /** Reset the default values for the attribute class **/
     void ResetFTremLog();
 
     /** Read the values for the attribute class **/
-    bool ReadFTremLog(pugi::xml_node element);
+    bool ReadFTremLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteFTremLog(pugi::xml_node element);
@@ -511,13 +511,13 @@ private:
 class AttGlissPresent : public Att {
 public:
     AttGlissPresent();
-    virtual ~AttGlissPresent();
+    ~AttGlissPresent();
 
     /** Reset the default values for the attribute class **/
     void ResetGlissPresent();
 
     /** Read the values for the attribute class **/
-    bool ReadGlissPresent(pugi::xml_node element);
+    bool ReadGlissPresent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteGlissPresent(pugi::xml_node element);
@@ -550,13 +550,13 @@ private:
 class AttGraceGrpLog : public Att {
 public:
     AttGraceGrpLog();
-    virtual ~AttGraceGrpLog();
+    ~AttGraceGrpLog();
 
     /** Reset the default values for the attribute class **/
     void ResetGraceGrpLog();
 
     /** Read the values for the attribute class **/
-    bool ReadGraceGrpLog(pugi::xml_node element);
+    bool ReadGraceGrpLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteGraceGrpLog(pugi::xml_node element);
@@ -590,13 +590,13 @@ private:
 class AttGraced : public Att {
 public:
     AttGraced();
-    virtual ~AttGraced();
+    ~AttGraced();
 
     /** Reset the default values for the attribute class **/
     void ResetGraced();
 
     /** Read the values for the attribute class **/
-    bool ReadGraced(pugi::xml_node element);
+    bool ReadGraced(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteGraced(pugi::xml_node element);
@@ -635,13 +635,13 @@ private:
 class AttHairpinLog : public Att {
 public:
     AttHairpinLog();
-    virtual ~AttHairpinLog();
+    ~AttHairpinLog();
 
     /** Reset the default values for the attribute class **/
     void ResetHairpinLog();
 
     /** Read the values for the attribute class **/
-    bool ReadHairpinLog(pugi::xml_node element);
+    bool ReadHairpinLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHairpinLog(pugi::xml_node element);
@@ -681,13 +681,13 @@ private:
 class AttHarpPedalLog : public Att {
 public:
     AttHarpPedalLog();
-    virtual ~AttHarpPedalLog();
+    ~AttHarpPedalLog();
 
     /** Reset the default values for the attribute class **/
     void ResetHarpPedalLog();
 
     /** Read the values for the attribute class **/
-    bool ReadHarpPedalLog(pugi::xml_node element);
+    bool ReadHarpPedalLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHarpPedalLog(pugi::xml_node element);
@@ -753,13 +753,13 @@ private:
 class AttLvPresent : public Att {
 public:
     AttLvPresent();
-    virtual ~AttLvPresent();
+    ~AttLvPresent();
 
     /** Reset the default values for the attribute class **/
     void ResetLvPresent();
 
     /** Read the values for the attribute class **/
-    bool ReadLvPresent(pugi::xml_node element);
+    bool ReadLvPresent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLvPresent(pugi::xml_node element);
@@ -792,13 +792,13 @@ private:
 class AttMeasureLog : public Att {
 public:
     AttMeasureLog();
-    virtual ~AttMeasureLog();
+    ~AttMeasureLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMeasureLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMeasureLog(pugi::xml_node element);
+    bool ReadMeasureLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeasureLog(pugi::xml_node element);
@@ -838,13 +838,13 @@ private:
 class AttMeterSigGrpLog : public Att {
 public:
     AttMeterSigGrpLog();
-    virtual ~AttMeterSigGrpLog();
+    ~AttMeterSigGrpLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigGrpLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigGrpLog(pugi::xml_node element);
+    bool ReadMeterSigGrpLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigGrpLog(pugi::xml_node element);
@@ -874,13 +874,13 @@ private:
 class AttNumberPlacement : public Att {
 public:
     AttNumberPlacement();
-    virtual ~AttNumberPlacement();
+    ~AttNumberPlacement();
 
     /** Reset the default values for the attribute class **/
     void ResetNumberPlacement();
 
     /** Read the values for the attribute class **/
-    bool ReadNumberPlacement(pugi::xml_node element);
+    bool ReadNumberPlacement(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNumberPlacement(pugi::xml_node element);
@@ -916,13 +916,13 @@ private:
 class AttNumbered : public Att {
 public:
     AttNumbered();
-    virtual ~AttNumbered();
+    ~AttNumbered();
 
     /** Reset the default values for the attribute class **/
     void ResetNumbered();
 
     /** Read the values for the attribute class **/
-    bool ReadNumbered(pugi::xml_node element);
+    bool ReadNumbered(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNumbered(pugi::xml_node element);
@@ -952,13 +952,13 @@ private:
 class AttOctaveLog : public Att {
 public:
     AttOctaveLog();
-    virtual ~AttOctaveLog();
+    ~AttOctaveLog();
 
     /** Reset the default values for the attribute class **/
     void ResetOctaveLog();
 
     /** Read the values for the attribute class **/
-    bool ReadOctaveLog(pugi::xml_node element);
+    bool ReadOctaveLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOctaveLog(pugi::xml_node element);
@@ -994,13 +994,13 @@ private:
 class AttPedalLog : public Att {
 public:
     AttPedalLog();
-    virtual ~AttPedalLog();
+    ~AttPedalLog();
 
     /** Reset the default values for the attribute class **/
     void ResetPedalLog();
 
     /** Read the values for the attribute class **/
-    bool ReadPedalLog(pugi::xml_node element);
+    bool ReadPedalLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePedalLog(pugi::xml_node element);
@@ -1036,13 +1036,13 @@ private:
 class AttPianoPedals : public Att {
 public:
     AttPianoPedals();
-    virtual ~AttPianoPedals();
+    ~AttPianoPedals();
 
     /** Reset the default values for the attribute class **/
     void ResetPianoPedals();
 
     /** Read the values for the attribute class **/
-    bool ReadPianoPedals(pugi::xml_node element);
+    bool ReadPianoPedals(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePianoPedals(pugi::xml_node element);
@@ -1072,13 +1072,13 @@ private:
 class AttRehearsal : public Att {
 public:
     AttRehearsal();
-    virtual ~AttRehearsal();
+    ~AttRehearsal();
 
     /** Reset the default values for the attribute class **/
     void ResetRehearsal();
 
     /** Read the values for the attribute class **/
-    bool ReadRehearsal(pugi::xml_node element);
+    bool ReadRehearsal(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteRehearsal(pugi::xml_node element);
@@ -1108,13 +1108,13 @@ private:
 class AttScoreDefVisCmn : public Att {
 public:
     AttScoreDefVisCmn();
-    virtual ~AttScoreDefVisCmn();
+    ~AttScoreDefVisCmn();
 
     /** Reset the default values for the attribute class **/
     void ResetScoreDefVisCmn();
 
     /** Read the values for the attribute class **/
-    bool ReadScoreDefVisCmn(pugi::xml_node element);
+    bool ReadScoreDefVisCmn(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteScoreDefVisCmn(pugi::xml_node element);
@@ -1144,13 +1144,13 @@ private:
 class AttSlurRend : public Att {
 public:
     AttSlurRend();
-    virtual ~AttSlurRend();
+    ~AttSlurRend();
 
     /** Reset the default values for the attribute class **/
     void ResetSlurRend();
 
     /** Read the values for the attribute class **/
-    bool ReadSlurRend(pugi::xml_node element);
+    bool ReadSlurRend(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSlurRend(pugi::xml_node element);
@@ -1188,13 +1188,13 @@ private:
 class AttStemsCmn : public Att {
 public:
     AttStemsCmn();
-    virtual ~AttStemsCmn();
+    ~AttStemsCmn();
 
     /** Reset the default values for the attribute class **/
     void ResetStemsCmn();
 
     /** Read the values for the attribute class **/
-    bool ReadStemsCmn(pugi::xml_node element);
+    bool ReadStemsCmn(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStemsCmn(pugi::xml_node element);
@@ -1228,13 +1228,13 @@ private:
 class AttTieRend : public Att {
 public:
     AttTieRend();
-    virtual ~AttTieRend();
+    ~AttTieRend();
 
     /** Reset the default values for the attribute class **/
     void ResetTieRend();
 
     /** Read the values for the attribute class **/
-    bool ReadTieRend(pugi::xml_node element);
+    bool ReadTieRend(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTieRend(pugi::xml_node element);
@@ -1272,13 +1272,13 @@ private:
 class AttTremMeasured : public Att {
 public:
     AttTremMeasured();
-    virtual ~AttTremMeasured();
+    ~AttTremMeasured();
 
     /** Reset the default values for the attribute class **/
     void ResetTremMeasured();
 
     /** Read the values for the attribute class **/
-    bool ReadTremMeasured(pugi::xml_node element);
+    bool ReadTremMeasured(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTremMeasured(pugi::xml_node element);
@@ -45,17 +45,17 @@ void AttMordentLog::ResetMordentLog()
     m_long = BOOLEAN_NONE;
 }
 
-bool AttMordentLog::ReadMordentLog(pugi::xml_node element)
+bool AttMordentLog::ReadMordentLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMordentLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToMordentLogForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("long")) {
-        this->SetLong(StrToBoolean(element.attribute("long").value()));
-        element.remove_attribute("long");
+    if (pugi::xml_attribute attribute = element.attribute("long")) {
+        this->SetLong(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -105,12 +105,12 @@ void AttOrnamPresent::ResetOrnamPresent()
     m_ornam = "";
 }
 
-bool AttOrnamPresent::ReadOrnamPresent(pugi::xml_node element)
+bool AttOrnamPresent::ReadOrnamPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ornam")) {
-        this->SetOrnam(StrToStr(element.attribute("ornam").value()));
-        element.remove_attribute("ornam");
+    if (pugi::xml_attribute attribute = element.attribute("ornam")) {
+        this->SetOrnam(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -152,17 +152,17 @@ void AttOrnamentAccid::ResetOrnamentAccid()
     m_accidlower = ACCIDENTAL_WRITTEN_NONE;
 }
 
-bool AttOrnamentAccid::ReadOrnamentAccid(pugi::xml_node element)
+bool AttOrnamentAccid::ReadOrnamentAccid(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accidupper")) {
-        this->SetAccidupper(StrToAccidentalWritten(element.attribute("accidupper").value()));
-        element.remove_attribute("accidupper");
+    if (pugi::xml_attribute attribute = element.attribute("accidupper")) {
+        this->SetAccidupper(StrToAccidentalWritten(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("accidlower")) {
-        this->SetAccidlower(StrToAccidentalWritten(element.attribute("accidlower").value()));
-        element.remove_attribute("accidlower");
+    if (pugi::xml_attribute attribute = element.attribute("accidlower")) {
+        this->SetAccidlower(StrToAccidentalWritten(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -213,17 +213,17 @@ void AttTurnLog::ResetTurnLog()
     m_form = turnLog_FORM_NONE;
 }
 
-bool AttTurnLog::ReadTurnLog(pugi::xml_node element)
+bool AttTurnLog::ReadTurnLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("delayed")) {
-        this->SetDelayed(StrToBoolean(element.attribute("delayed").value()));
-        element.remove_attribute("delayed");
+    if (pugi::xml_attribute attribute = element.attribute("delayed")) {
+        this->SetDelayed(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("form")) {
-        this->SetForm(StrToTurnLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToTurnLogForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
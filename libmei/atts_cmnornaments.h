@@ -32,13 +32,13 @@ namespace vrv {
 class AttMordentLog : public Att {
 public:
     AttMordentLog();
-    virtual ~AttMordentLog();
+    ~AttMordentLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMordentLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMordentLog(pugi::xml_node element);
+    bool ReadMordentLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMordentLog(pugi::xml_node element);
@@ -77,13 +77,13 @@ private:
 class AttOrnamPresent : public Att {
 public:
     AttOrnamPresent();
-    virtual ~AttOrnamPresent();
+    ~AttOrnamPresent();
 
     /** Reset the default values for the attribute class **/
     void ResetOrnamPresent();
 
     /** Read the values for the attribute class **/
-    bool ReadOrnamPresent(pugi::xml_node element);
+    bool ReadOrnamPresent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOrnamPresent(pugi::xml_node element);
@@ -117,13 +117,13 @@ private:
 class AttOrnamentAccid : public Att {
 public:
     AttOrnamentAccid();
-    virtual ~AttOrnamentAccid();
+    ~AttOrnamentAccid();
 
     /** Reset the default values for the attribute class **/
     void ResetOrnamentAccid();
 
     /** Read the values for the attribute class **/
-    bool ReadOrnamentAccid(pugi::xml_node element);
+    bool ReadOrnamentAccid(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOrnamentAccid(pugi::xml_node element);
@@ -159,13 +159,13 @@ private:
 class AttTurnLog : public Att {
 public:
     AttTurnLog();
-    virtual ~AttTurnLog();
+    ~AttTurnLog();
 
     /** Reset the default values for the attribute class **/
     void ResetTurnLog();
 
     /** Read the values for the attribute class **/
-    bool ReadTurnLog(pugi::xml_node element);
+    bool ReadTurnLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTurnLog(pugi::xml_node element);
@@ -44,12 +44,12 @@ void AttCrit::ResetCrit()
     m_cause = "";
 }
 
-bool AttCrit::ReadCrit(pugi::xml_node element)
+bool AttCrit::ReadCrit(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cause")) {
-        this->SetCause(StrToStr(element.attribute("cause").value()));
-        element.remove_attribute("cause");
+    if (pugi::xml_attribute attribute = element.attribute("cause")) {
+        this->SetCause(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
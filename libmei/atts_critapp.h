@@ -32,13 +32,13 @@ namespace vrv {
 class AttCrit : public Att {
 public:
     AttCrit();
-    virtual ~AttCrit();
+    ~AttCrit();
 
     /** Reset the default values for the attribute class **/
     void ResetCrit();
 
     /** Read the values for the attribute class **/
-    bool ReadCrit(pugi::xml_node element);
+    bool ReadCrit(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCrit(pugi::xml_node element);
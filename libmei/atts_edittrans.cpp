@@ -44,12 +44,12 @@ void AttAgentIdent::ResetAgentIdent()
     m_agent = "";
 }
 
-bool AttAgentIdent::ReadAgentIdent(pugi::xml_node element)
+bool AttAgentIdent::ReadAgentIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("agent")) {
-        this->SetAgent(StrToStr(element.attribute("agent").value()));
-        element.remove_attribute("agent");
+    if (pugi::xml_attribute attribute = element.attribute("agent")) {
+        this->SetAgent(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +90,12 @@ void AttReasonIdent::ResetReasonIdent()
     m_reason = "";
 }
 
-bool AttReasonIdent::ReadReasonIdent(pugi::xml_node element)
+bool AttReasonIdent::ReadReasonIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("reason")) {
-        this->SetReason(StrToStr(element.attribute("reason").value()));
-        element.remove_attribute("reason");
+    if (pugi::xml_attribute attribute = element.attribute("reason")) {
+        this->SetReason(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -32,13 +32,13 @@ namespace vrv {
 class AttAgentIdent : public Att {
 public:
     AttAgentIdent();
-    virtual ~AttAgentIdent();
+    ~AttAgentIdent();
 
     /** Reset the default values for the attribute class **/
     void ResetAgentIdent();
 
     /** Read the values for the attribute class **/
-    bool ReadAgentIdent(pugi::xml_node element);
+    bool ReadAgentIdent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAgentIdent(pugi::xml_node element);
@@ -71,13 +71,13 @@ private:
 class AttReasonIdent : public Att {
 public:
     AttReasonIdent();
-    virtual ~AttReasonIdent();
+    ~AttReasonIdent();
 
     /** Reset the default values for the attribute class **/
     void ResetReasonIdent();
 
     /** Read the values for the attribute class **/
-    bool ReadReasonIdent(pugi::xml_node element);
+    bool ReadReasonIdent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteReasonIdent(pugi::xml_node element);
@@ -32,13 +32,13 @@ namespace vrv {
 class AttExtSym : public Att {
 public:
     AttExtSym();
-    virtual ~AttExtSym();
+    ~AttExtSym();
 
     /** Reset the default values for the attribute class **/
     void ResetExtSym();
 
     /** Read the values for the attribute class **/
-    bool ReadExtSym(pugi::xml_node element);
+    bool ReadExtSym(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteExtSym(pugi::xml_node element);
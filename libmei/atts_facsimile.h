@@ -32,13 +32,13 @@ namespace vrv {
 class AttFacsimile : public Att {
 public:
     AttFacsimile();
-    virtual ~AttFacsimile();
+    ~AttFacsimile();
 
     /** Reset the default values for the attribute class **/
     void ResetFacsimile();
 
     /** Read the values for the attribute class **/
-    bool ReadFacsimile(pugi::xml_node element);
+    bool ReadFacsimile(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteFacsimile(pugi::xml_node element);
@@ -45,17 +45,17 @@ void AttTabular::ResetTabular()
     m_rowspan = 0;
 }
 
-bool AttTabular::ReadTabular(pugi::xml_node element)
+bool AttTabular::ReadTabular(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("colspan")) {
-        this->SetColspan(StrToInt(element.attribute("colspan").value()));
-        element.remove_attribute("colspan");
+    if (pugi::xml_attribute attribute = element.attribute("colspan")) {
+        this->SetColspan(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("rowspan")) {
-        this->SetRowspan(StrToInt(element.attribute("rowspan").value()));
-        element.remove_attribute("rowspan");
+    if (pugi::xml_attribute attribute = element.attribute("rowspan")) {
+        this->SetRowspan(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -32,13 +32,13 @@ namespace vrv {
 class AttTabular : public Att {
 public:
     AttTabular();
-    virtual ~AttTabular();
+    ~AttTabular();
 
     /** Reset the default values for the attribute class **/
     void ResetTabular();
 
     /** Read the values for the attribute class **/
-    bool ReadTabular(pugi::xml_node element);
+    bool ReadTabular(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTabular(pugi::xml_node element);
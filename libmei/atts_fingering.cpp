@@ -44,12 +44,12 @@ void AttFingGrpLog::ResetFingGrpLog()
     m_form = fingGrpLog_FORM_NONE;
 }
 
-bool AttFingGrpLog::ReadFingGrpLog(pugi::xml_node element)
+bool AttFingGrpLog::ReadFingGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFingGrpLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToFingGrpLogForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -32,13 +32,13 @@ namespace vrv {
 class AttFingGrpLog : public Att {
 public:
     AttFingGrpLog();
-    virtual ~AttFingGrpLog();
+    ~AttFingGrpLog();
 
     /** Reset the default values for the attribute class **/
     void ResetFingGrpLog();
 
     /** Read the values for the attribute class **/
-    bool ReadFingGrpLog(pugi::xml_node element);
+    bool ReadFingGrpLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteFingGrpLog(pugi::xml_node element);
@@ -44,12 +44,12 @@ void AttAccidentalGestural::ResetAccidentalGestural()
     m_accidGes = ACCIDENTAL_GESTURAL_NONE;
 }
 
-bool AttAccidentalGestural::ReadAccidentalGestural(pugi::xml_node element)
+bool AttAccidentalGestural::ReadAccidentalGestural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid.ges")) {
-        this->SetAccidGes(StrToAccidentalGestural(element.attribute("accid.ges").value()));
-        element.remove_attribute("accid.ges");
+    if (pugi::xml_attribute attribute = element.attribute("accid.ges")) {
+        this->SetAccidGes(StrToAccidentalGestural(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +90,12 @@ void AttArticulationGestural::ResetArticulationGestural()
     m_articGes = ARTICULATION_NONE;
 }
 
-bool AttArticulationGestural::ReadArticulationGestural(pugi::xml_node element)
+bool AttArticulationGestural::ReadArticulationGestural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic.ges")) {
-        this->SetArticGes(StrToArticulation(element.attribute("artic.ges").value()));
-        element.remove_attribute("artic.ges");
+    if (pugi::xml_attribute attribute = element.attribute("artic.ges")) {
+        this->SetArticGes(StrToArticulation(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -136,12 +136,12 @@ void AttBendGes::ResetBendGes()
     m_amount = 0.0;
 }
 
-bool AttBendGes::ReadBendGes(pugi::xml_node element)
+bool AttBendGes::ReadBendGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("amount")) {
-        this->SetAmount(StrToDbl(element.attribute("amount").value()));
-        element.remove_attribute("amount");
+    if (pugi::xml_attribute attribute = element.attribute("amount")) {
+        this->SetAmount(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -187,37 +187,37 @@ void AttDurationGestural::ResetDurationGestural()
     m_durRecip = "";
 }
 
-bool AttDurationGestural::ReadDurationGestural(pugi::xml_node element)
+bool AttDurationGestural::ReadDurationGestural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.ges")) {
-        this->SetDurGes(StrToDuration(element.attribute("dur.ges").value()));
-        element.remove_attribute("dur.ges");
+    if (pugi::xml_attribute attribute = element.attribute("dur.ges")) {
+        this->SetDurGes(StrToDuration(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("dots.ges")) {
-        this->SetDotsGes(StrToInt(element.attribute("dots.ges").value()));
-        element.remove_attribute("dots.ges");
+    if (pugi::xml_attribute attribute = element.attribute("dots.ges")) {
+        this->SetDotsGes(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("dur.metrical")) {
-        this->SetDurMetrical(StrToDbl(element.attribute("dur.metrical").value()));
-        element.remove_attribute("dur.metrical");
+    if (pugi::xml_attribute attribute = element.attribute("dur.metrical")) {
+        this->SetDurMetrical(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("dur.ppq")) {
-        this->SetDurPpq(StrToInt(element.attribute("dur.ppq").value()));
-        element.remove_attribute("dur.ppq");
+    if (pugi::xml_attribute attribute = element.attribute("dur.ppq")) {
+        this->SetDurPpq(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("dur.real")) {
-        this->SetDurReal(StrToDbl(element.attribute("dur.real").value()));
-        element.remove_attribute("dur.real");
+    if (pugi::xml_attribute attribute = element.attribute("dur.real")) {
+        this->SetDurReal(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("dur.recip")) {
-        this->SetDurRecip(StrToStr(element.attribute("dur.recip").value()));
-        element.remove_attribute("dur.recip");
+    if (pugi::xml_attribute attribute = element.attribute("dur.recip")) {
+        this->SetDurRecip(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -305,22 +305,22 @@ void AttNcGes::ResetNcGes()
     m_pnum = 0;
 }
 
-bool AttNcGes::ReadNcGes(pugi::xml_node element)
+bool AttNcGes::ReadNcGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToOctave(element.attribute("oct.ges").value()));
-        element.remove_attribute("oct.ges");
+    if (pugi::xml_attribute attribute = element.attribute("oct.ges")) {
+        this->SetOctGes(StrToOctave(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        element.remove_attribute("pname.ges");
+    if (pugi::xml_attribute attribute = element.attribute("pname.ges")) {
+        this->SetPnameGes(StrToPitchname(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        element.remove_attribute("pnum");
+    if (pugi::xml_attribute attribute = element.attribute("pnum")) {
+        this->SetPnum(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -382,27 +382,27 @@ void AttNoteGes::ResetNoteGes()
     m_pnum = 0;
 }
 
-bool AttNoteGes::ReadNoteGes(pugi::xml_node element)
+bool AttNoteGes::ReadNoteGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extremis")) {
-        this->SetExtremis(StrToNoteGesExtremis(element.attribute("extremis").value()));
-        element.remove_attribute("extremis");
+    if (pugi::xml_attribute attribute = element.attribute("extremis")) {
+        this->SetExtremis(StrToNoteGesExtremis(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToOctave(element.attribute("oct.ges").value()));
-        element.remove_attribute("oct.ges");
+    if (pugi::xml_attribute attribute = element.attribute("oct.ges")) {
+        this->SetOctGes(StrToOctave(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        element.remove_attribute("pname.ges");
+    if (pugi::xml_attribute attribute = element.attribute("pname.ges")) {
+        this->SetPnameGes(StrToPitchname(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        element.remove_attribute("pnum");
+    if (pugi::xml_attribute attribute = element.attribute("pnum")) {
+        this->SetPnum(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -472,22 +472,22 @@ void AttScoreDefGes::ResetScoreDefGes()
     m_tuneTemper = TEMPERAMENT_NONE;
 }
 
-bool AttScoreDefGes::ReadScoreDefGes(pugi::xml_node element)
+bool AttScoreDefGes::ReadScoreDefGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tune.pname")) {
-        this->SetTunePname(StrToPitchname(element.attribute("tune.pname").value()));
-        element.remove_attribute("tune.pname");
+    if (pugi::xml_attribute attribute = element.attribute("tune.pname")) {
+        this->SetTunePname(StrToPitchname(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tune.Hz")) {
-        this->SetTuneHz(StrToDbl(element.attribute("tune.Hz").value()));
-        element.remove_attribute("tune.Hz");
+    if (pugi::xml_attribute attribute = element.attribute("tune.Hz")) {
+        this->SetTuneHz(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tune.temper")) {
-        this->SetTuneTemper(StrToTemperament(element.attribute("tune.temper").value()));
-        element.remove_attribute("tune.temper");
+    if (pugi::xml_attribute attribute = element.attribute("tune.temper")) {
+        this->SetTuneTemper(StrToTemperament(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -546,12 +546,12 @@ void AttSectionGes::ResetSectionGes()
     m_attacca = BOOLEAN_NONE;
 }
 
-bool AttSectionGes::ReadSectionGes(pugi::xml_node element)
+bool AttSectionGes::ReadSectionGes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("attacca")) {
-        this->SetAttacca(StrToBoolean(element.attribute("attacca").value()));
-        element.remove_attribute("attacca");
+    if (pugi::xml_attribute attribute = element.attribute("attacca")) {
+        this->SetAttacca(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -593,17 +593,17 @@ void AttSoundLocation::ResetSoundLocation()
     m_elevation = 0.0;
 }
 
-bool AttSoundLocation::ReadSoundLocation(pugi::xml_node element)
+bool AttSoundLocation::ReadSoundLocation(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("azimuth")) {
-        this->SetAzimuth(StrToDbl(element.attribute("azimuth").value()));
-        element.remove_attribute("azimuth");
+    if (pugi::xml_attribute attribute = element.attribute("azimuth")) {
+        this->SetAzimuth(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("elevation")) {
-        this->SetElevation(StrToDbl(element.attribute("elevation").value()));
-        element.remove_attribute("elevation");
+    if (pugi::xml_attribute attribute = element.attribute("elevation")) {
+        this->SetElevation(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -654,17 +654,17 @@ void AttTimestampGestural::ResetTimestampGestural()
     m_tstampReal = "";
 }
 
-bool AttTimestampGestural::ReadTimestampGestural(pugi::xml_node element)
+bool AttTimestampGestural::ReadTimestampGestural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp.ges")) {
-        this->SetTstampGes(StrToDbl(element.attribute("tstamp.ges").value()));
-        element.remove_attribute("tstamp.ges");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp.ges")) {
+        this->SetTstampGes(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tstamp.real")) {
-        this->SetTstampReal(StrToStr(element.attribute("tstamp.real").value()));
-        element.remove_attribute("tstamp.real");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp.real")) {
+        this->SetTstampReal(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -715,17 +715,17 @@ void AttTimestamp2Gestural::ResetTimestamp2Gestural()
     m_tstamp2Real = "";
 }
 
-bool AttTimestamp2Gestural::ReadTimestamp2Gestural(pugi::xml_node element)
+bool AttTimestamp2Gestural::ReadTimestamp2Gestural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2.ges")) {
-        this->SetTstamp2Ges(StrToMeasurebeat(element.attribute("tstamp2.ges").value()));
-        element.remove_attribute("tstamp2.ges");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp2.ges")) {
+        this->SetTstamp2Ges(StrToMeasurebeat(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tstamp2.real")) {
-        this->SetTstamp2Real(StrToStr(element.attribute("tstamp2.real").value()));
-        element.remove_attribute("tstamp2.real");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp2.real")) {
+        this->SetTstamp2Real(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
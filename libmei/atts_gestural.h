@@ -32,13 +32,13 @@ namespace vrv {
 class AttAccidentalGestural : public Att {
 public:
     AttAccidentalGestural();
-    virtual ~AttAccidentalGestural();
+    ~AttAccidentalGestural();
 
     /** Reset the default values for the attribute class **/
     void ResetAccidentalGestural();
 
     /** Read the values for the attribute class **/
-    bool ReadAccidentalGestural(pugi::xml_node element);
+    bool ReadAccidentalGestural(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAccidentalGestural(pugi::xml_node element);
@@ -68,13 +68,13 @@ private:
 class AttArticulationGestural : public Att {
 public:
     AttArticulationGestural();
-    virtual ~AttArticulationGestural();
+    ~AttArticulationGestural();
 
     /** Reset the default values for the attribute class **/
     void ResetArticulationGestural();
 
     /** Read the values for the attribute class **/
-    bool ReadArticulationGestural(pugi::xml_node element);
+    bool ReadArticulationGestural(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteArticulationGestural(pugi::xml_node element);
@@ -104,13 +104,13 @@ private:
 class AttBendGes : public Att {
 public:
     AttBendGes();
-    virtual ~AttBendGes();
+    ~AttBendGes();
 
     /** Reset the default values for the attribute class **/
     void ResetBendGes();
 
     /** Read the values for the attribute class **/
-    bool ReadBendGes(pugi::xml_node element);
+    bool ReadBendGes(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBendGes(pugi::xml_node element);
@@ -144,13 +144,13 @@ private:
 class AttDurationGestural : public Att {
 public:
     AttDurationGestural();
-    virtual ~AttDurationGestural();
+    ~AttDurationGestural();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationGestural();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationGestural(pugi::xml_node element);
+    bool ReadDurationGestural(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteDurationGestural(pugi::xml_node element);
@@ -219,13 +219,13 @@ private:
 class AttNcGes : public Att {
 public:
     AttNcGes();
-    virtual ~AttNcGes();
+    ~AttNcGes();
 
     /** Reset the default values for the attribute class **/
     void ResetNcGes();
 
     /** Read the values for the attribute class **/
-    bool ReadNcGes(pugi::xml_node element);
+    bool ReadNcGes(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNcGes(pugi::xml_node element);
@@ -267,13 +267,13 @@ private:
 class AttNoteGes : public Att {
 public:
     AttNoteGes();
-    virtual ~AttNoteGes();
+    ~AttNoteGes();
 
     /** Reset the default values for the attribute class **/
     void ResetNoteGes();
 
     /** Read the values for the attribute class **/
-    bool ReadNoteGes(pugi::xml_node element);
+    bool ReadNoteGes(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNoteGes(pugi::xml_node element);
@@ -321,13 +321,13 @@ private:
 class AttScoreDefGes : public Att {
 public:
     AttScoreDefGes();
-    virtual ~AttScoreDefGes();
+    ~AttScoreDefGes();
 
     /** Reset the default values for the attribute class **/
     void ResetScoreDefGes();
 
     /** Read the values for the attribute class **/
-    bool ReadScoreDefGes(pugi::xml_node element);
+    bool ReadScoreDefGes(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteScoreDefGes(pugi::xml_node element);
@@ -369,13 +369,13 @@ private:
 class AttSectionGes : public Att {
 public:
     AttSectionGes();
-    virtual ~AttSectionGes();
+    ~AttSectionGes();
 
     /** Reset the default values for the attribute class **/
     void ResetSectionGes();
 
     /** Read the values for the attribute class **/
-    bool ReadSectionGes(pugi::xml_node element);
+    bool ReadSectionGes(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSectionGes(pugi::xml_node element);
@@ -408,13 +408,13 @@ private:
 class AttSoundLocation : public Att {
 public:
     AttSoundLocation();
-    virtual ~AttSoundLocation();
+    ~AttSoundLocation();
 
     /** Reset the default values for the attribute class **/
     void ResetSoundLocation();
 
     /** Read the values for the attribute class **/
-    bool ReadSoundLocation(pugi::xml_node element);
+    bool ReadSoundLocation(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSoundLocation(pugi::xml_node element);
@@ -450,13 +450,13 @@ private:
 class AttTimestampGestural : public Att {
 public:
     AttTimestampGestural();
-    virtual ~AttTimestampGestural();
+    ~AttTimestampGestural();
 
     /** Reset the default values for the attribute class **/
     void ResetTimestampGestural();
 
     /** Read the values for the attribute class **/
-    bool ReadTimestampGestural(pugi::xml_node element);
+    bool ReadTimestampGestural(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTimestampGestural(pugi::xml_node element);
@@ -495,13 +495,13 @@ private:
 class AttTimestamp2Gestural : public Att {
 public:
     AttTimestamp2Gestural();
-    virtual ~AttTimestamp2Gestural();
+    ~AttTimestamp2Gestural();
 
     /** Reset the default values for the attribute class **/
     void ResetTimestamp2Gestural();
 
     /** Read the values for the attribute class **/
-    bool ReadTimestamp2Gestural(pugi::xml_node element);
+    bool ReadTimestamp2Gestural(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTimestamp2Gestural(pugi::xml_node element);
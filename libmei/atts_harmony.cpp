@@ -44,12 +44,12 @@ void AttHarmLog::ResetHarmLog()
     m_chordref = "";
 }
 
-bool AttHarmLog::ReadHarmLog(pugi::xml_node element)
+bool AttHarmLog::ReadHarmLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("chordref")) {
-        this->SetChordref(StrToStr(element.attribute("chordref").value()));
-        element.remove_attribute("chordref");
+    if (pugi::xml_attribute attribute = element.attribute("chordref")) {
+        this->SetChordref(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -32,13 +32,13 @@ namespace vrv {
 class AttHarmLog : public Att {
 public:
     AttHarmLog();
-    virtual ~AttHarmLog();
+    ~AttHarmLog();
 
     /** Reset the default values for the attribute class **/
     void ResetHarmLog();
 
     /** Read the values for the attribute class **/
-    bool ReadHarmLog(pugi::xml_node element);
+    bool ReadHarmLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHarmLog(pugi::xml_node element);
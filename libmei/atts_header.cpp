@@ -47,27 +47,27 @@ void AttBifoliumSurfaces::ResetBifoliumSurfaces()
     m_outerVerso = "";
 }
 
-bool AttBifoliumSurfaces::ReadBifoliumSurfaces(pugi::xml_node element)
+bool AttBifoliumSurfaces::ReadBifoliumSurfaces(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("outer.recto")) {
-        this->SetOuterRecto(StrToStr(element.attribute("outer.recto").value()));
-        element.remove_attribute("outer.recto");
+    if (pugi::xml_attribute attribute = element.attribute("outer.recto")) {
+        this->SetOuterRecto(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("inner.verso")) {
-        this->SetInnerVerso(StrToStr(element.attribute("inner.verso").value()));
-        element.remove_attribute("inner.verso");
+    if (pugi::xml_attribute attribute = element.attribute("inner.verso")) {
+        this->SetInnerVerso(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("inner.recto")) {
-        this->SetInnerRecto(StrToStr(element.attribute("inner.recto").value()));
-        element.remove_attribute("inner.recto");
+    if (pugi::xml_attribute attribute = element.attribute("inner.recto")) {
+        this->SetInnerRecto(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("outer.verso")) {
-        this->SetOuterVerso(StrToStr(element.attribute("outer.verso").value()));
-        element.remove_attribute("outer.verso");
+    if (pugi::xml_attribute attribute = element.attribute("outer.verso")) {
+        this->SetOuterVerso(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -136,17 +136,17 @@ void AttFoliumSurfaces::ResetFoliumSurfaces()
     m_verso = "";
 }
 
-bool AttFoliumSurfaces::ReadFoliumSurfaces(pugi::xml_node element)
+bool AttFoliumSurfaces::ReadFoliumSurfaces(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("recto")) {
-        this->SetRecto(StrToStr(element.attribute("recto").value()));
-        element.remove_attribute("recto");
+    if (pugi::xml_attribute attribute = element.attribute("recto")) {
+        this->SetRecto(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("verso")) {
-        this->SetVerso(StrToStr(element.attribute("verso").value()));
-        element.remove_attribute("verso");
+    if (pugi::xml_attribute attribute = element.attribute("verso")) {
+        this->SetVerso(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -196,12 +196,12 @@ void AttRecordType::ResetRecordType()
     m_recordtype = recordType_RECORDTYPE_NONE;
 }
 
-bool AttRecordType::ReadRecordType(pugi::xml_node element)
+bool AttRecordType::ReadRecordType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("recordtype")) {
-        this->SetRecordtype(StrToRecordTypeRecordtype(element.attribute("recordtype").value()));
-        element.remove_attribute("recordtype");
+    if (pugi::xml_attribute attribute = element.attribute("recordtype")) {
+        this->SetRecordtype(StrToRecordTypeRecordtype(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -242,12 +242,12 @@ void AttRegularMethod::ResetRegularMethod()
     m_method = regularMethod_METHOD_NONE;
 }
 
-bool AttRegularMethod::ReadRegularMethod(pugi::xml_node element)
+bool AttRegularMethod::ReadRegularMethod(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("method")) {
-        this->SetMethod(StrToRegularMethodMethod(element.attribute("method").value()));
-        element.remove_attribute("method");
+    if (pugi::xml_attribute attribute = element.attribute("method")) {
+        this->SetMethod(StrToRegularMethodMethod(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
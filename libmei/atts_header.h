@@ -32,13 +32,13 @@ namespace vrv {
 class AttBifoliumSurfaces : public Att {
 public:
     AttBifoliumSurfaces();
-    virtual ~AttBifoliumSurfaces();
+    ~AttBifoliumSurfaces();
 
     /** Reset the default values for the attribute class **/
     void ResetBifoliumSurfaces();
 
     /** Read the values for the attribute class **/
-    bool ReadBifoliumSurfaces(pugi::xml_node element);
+    bool ReadBifoliumSurfaces(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBifoliumSurfaces(pugi::xml_node element);
@@ -86,13 +86,13 @@ private:
 class AttFoliumSurfaces : public Att {
 public:
     AttFoliumSurfaces();
-    virtual ~AttFoliumSurfaces();
+    ~AttFoliumSurfaces();
 
     /** Reset the default values for the attribute class **/
     void ResetFoliumSurfaces();
 
     /** Read the values for the attribute class **/
-    bool ReadFoliumSurfaces(pugi::xml_node element);
+    bool ReadFoliumSurfaces(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteFoliumSurfaces(pugi::xml_node element);
@@ -128,13 +128,13 @@ private:
 class AttRecordType : public Att {
 public:
     AttRecordType();
-    virtual ~AttRecordType();
+    ~AttRecordType();
 
     /** Reset the default values for the attribute class **/
     void ResetRecordType();
 
     /** Read the values for the attribute class **/
-    bool ReadRecordType(pugi::xml_node element);
+    bool ReadRecordType(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteRecordType(pugi::xml_node element);
@@ -164,13 +164,13 @@ private:
 class AttRegularMethod : public Att {
 public:
     AttRegularMethod();
-    virtual ~AttRegularMethod();
+    ~AttRegularMethod();
 
     /** Reset the default values for the attribute class **/
     void ResetRegularMethod();
 
     /** Read the values for the attribute class **/
-    bool ReadRegularMethod(pugi::xml_node element);
+    bool ReadRegularMethod(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteRegularMethod(pugi::xml_node element);
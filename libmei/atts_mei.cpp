@@ -45,17 +45,17 @@ void AttNotationType::ResetNotationType()
     m_notationsubtype = "";
 }
 
-bool AttNotationType::ReadNotationType(pugi::xml_node element)
+bool AttNotationType::ReadNotationType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("notationtype")) {
-        this->SetNotationtype(StrToNotationtype(element.attribute("notationtype").value()));
-        element.remove_attribute("notationtype");
+    if (pugi::xml_attribute attribute = element.attribute("notationtype")) {
+        this->SetNotationtype(StrToNotationtype(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("notationsubtype")) {
-        this->SetNotationsubtype(StrToStr(element.attribute("notationsubtype").value()));
-        element.remove_attribute("notationsubtype");
+    if (pugi::xml_attribute attribute = element.attribute("notationsubtype")) {
+        this->SetNotationsubtype(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
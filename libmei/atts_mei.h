@@ -32,13 +32,13 @@ namespace vrv {
 class AttNotationType : public Att {
 public:
     AttNotationType();
-    virtual ~AttNotationType();
+    ~AttNotationType();
 
     /** Reset the default values for the attribute class **/
     void ResetNotationType();
 
     /** Read the values for the attribute class **/
-    bool ReadNotationType(pugi::xml_node element);
+    bool ReadNotationType(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNotationType(pugi::xml_node element);
@@ -44,12 +44,12 @@ void AttLigatureLog::ResetLigatureLog()
     m_form = LIGATUREFORM_NONE;
 }
 
-bool AttLigatureLog::ReadLigatureLog(pugi::xml_node element)
+bool AttLigatureLog::ReadLigatureLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLigatureform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToLigatureform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -94,32 +94,32 @@ void AttMensuralLog::ResetMensuralLog()
     m_proportNumbase = -1;
 }
 
-bool AttMensuralLog::ReadMensuralLog(pugi::xml_node element)
+bool AttMensuralLog::ReadMensuralLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mensur.dot")) {
-        this->SetMensurDot(StrToBoolean(element.attribute("mensur.dot").value()));
-        element.remove_attribute("mensur.dot");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.dot")) {
+        this->SetMensurDot(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.sign")) {
-        this->SetMensurSign(StrToMensurationsign(element.attribute("mensur.sign").value()));
-        element.remove_attribute("mensur.sign");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.sign")) {
+        this->SetMensurSign(StrToMensurationsign(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.slash")) {
-        this->SetMensurSlash(StrToInt(element.attribute("mensur.slash").value()));
-        element.remove_attribute("mensur.slash");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.slash")) {
+        this->SetMensurSlash(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("proport.num")) {
-        this->SetProportNum(StrToInt(element.attribute("proport.num").value()));
-        element.remove_attribute("proport.num");
+    if (pugi::xml_attribute attribute = element.attribute("proport.num")) {
+        this->SetProportNum(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("proport.numbase")) {
-        this->SetProportNumbase(StrToInt(element.attribute("proport.numbase").value()));
-        element.remove_attribute("proport.numbase");
+    if (pugi::xml_attribute attribute = element.attribute("proport.numbase")) {
+        this->SetProportNumbase(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -199,27 +199,27 @@ void AttMensuralShared::ResetMensuralShared()
     m_tempus = TEMPUS_NONE;
 }
 
-bool AttMensuralShared::ReadMensuralShared(pugi::xml_node element)
+bool AttMensuralShared::ReadMensuralShared(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("modusmaior")) {
-        this->SetModusmaior(StrToModusmaior(element.attribute("modusmaior").value()));
-        element.remove_attribute("modusmaior");
+    if (pugi::xml_attribute attribute = element.attribute("modusmaior")) {
+        this->SetModusmaior(StrToModusmaior(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("modusminor")) {
-        this->SetModusminor(StrToModusminor(element.attribute("modusminor").value()));
-        element.remove_attribute("modusminor");
+    if (pugi::xml_attribute attribute = element.attribute("modusminor")) {
+        this->SetModusminor(StrToModusminor(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("prolatio")) {
-        this->SetProlatio(StrToProlatio(element.attribute("prolatio").value()));
-        element.remove_attribute("prolatio");
+    if (pugi::xml_attribute attribute = element.attribute("prolatio")) {
+        this->SetProlatio(StrToProlatio(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tempus")) {
-        this->SetTempus(StrToTempus(element.attribute("tempus").value()));
-        element.remove_attribute("tempus");
+    if (pugi::xml_attribute attribute = element.attribute("tempus")) {
+        this->SetTempus(StrToTempus(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -287,12 +287,12 @@ void AttNoteAnlMensural::ResetNoteAnlMensural()
     m_lig = noteAnlMensural_LIG_NONE;
 }
 
-bool AttNoteAnlMensural::ReadNoteAnlMensural(pugi::xml_node element)
+bool AttNoteAnlMensural::ReadNoteAnlMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lig")) {
-        this->SetLig(StrToNoteAnlMensuralLig(element.attribute("lig").value()));
-        element.remove_attribute("lig");
+    if (pugi::xml_attribute attribute = element.attribute("lig")) {
+        this->SetLig(StrToNoteAnlMensuralLig(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -333,12 +333,12 @@ void AttRestVisMensural::ResetRestVisMensural()
     m_spaces = 0;
 }
 
-bool AttRestVisMensural::ReadRestVisMensural(pugi::xml_node element)
+bool AttRestVisMensural::ReadRestVisMensural(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("spaces")) {
-        this->SetSpaces(StrToInt(element.attribute("spaces").value()));
-        element.remove_attribute("spaces");
+    if (pugi::xml_attribute attribute = element.attribute("spaces")) {
+        this->SetSpaces(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
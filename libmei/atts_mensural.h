@@ -32,13 +32,13 @@ namespace vrv {
 class AttLigatureLog : public Att {
 public:
     AttLigatureLog();
-    virtual ~AttLigatureLog();
+    ~AttLigatureLog();
 
     /** Reset the default values for the attribute class **/
     void ResetLigatureLog();
 
     /** Read the values for the attribute class **/
-    bool ReadLigatureLog(pugi::xml_node element);
+    bool ReadLigatureLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLigatureLog(pugi::xml_node element);
@@ -68,13 +68,13 @@ private:
 class AttMensuralLog : public Att {
 public:
     AttMensuralLog();
-    virtual ~AttMensuralLog();
+    ~AttMensuralLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMensuralLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMensuralLog(pugi::xml_node element);
+    bool ReadMensuralLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMensuralLog(pugi::xml_node element);
@@ -139,13 +139,13 @@ private:
 class AttMensuralShared : public Att {
 public:
     AttMensuralShared();
-    virtual ~AttMensuralShared();
+    ~AttMensuralShared();
 
     /** Reset the default values for the attribute class **/
     void ResetMensuralShared();
 
     /** Read the values for the attribute class **/
-    bool ReadMensuralShared(pugi::xml_node element);
+    bool ReadMensuralShared(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMensuralShared(pugi::xml_node element);
@@ -193,13 +193,13 @@ private:
 class AttNoteAnlMensural : public Att {
 public:
     AttNoteAnlMensural();
-    virtual ~AttNoteAnlMensural();
+    ~AttNoteAnlMensural();
 
     /** Reset the default values for the attribute class **/
     void ResetNoteAnlMensural();
 
     /** Read the values for the attribute class **/
-    bool ReadNoteAnlMensural(pugi::xml_node element);
+    bool ReadNoteAnlMensural(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNoteAnlMensural(pugi::xml_node element);
@@ -229,13 +229,13 @@ private:
 class AttRestVisMensural : public Att {
 public:
     AttRestVisMensural();
-    virtual ~AttRestVisMensural();
+    ~AttRestVisMensural();
 
     /** Reset the default values for the attribute class **/
     void ResetRestVisMensural();
 
     /** Read the values for the attribute class **/
-    bool ReadRestVisMensural(pugi::xml_node element);
+    bool ReadRestVisMensural(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteRestVisMensural(pugi::xml_node element);
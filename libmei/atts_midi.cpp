@@ -47,27 +47,27 @@ void AttChannelized::ResetChannelized()
     m_midiTrack = 0;
 }
 
-bool AttChannelized::ReadChannelized(pugi::xml_node element)
+bool AttChannelized::ReadChannelized(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.channel")) {
-        this->SetMidiChannel(StrToMidichannel(element.attribute("midi.channel").value()));
-        element.remove_attribute("midi.channel");
+    if (pugi::xml_attribute attribute = element.attribute("midi.channel")) {
+        this->SetMidiChannel(StrToMidichannel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.duty")) {
-        this->SetMidiDuty(StrToPercentLimited(element.attribute("midi.duty").value()));
-        element.remove_attribute("midi.duty");
+    if (pugi::xml_attribute attribute = element.attribute("midi.duty")) {
+        this->SetMidiDuty(StrToPercentLimited(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.port")) {
-        this->SetMidiPort(StrToMidivalueName(element.attribute("midi.port").value()));
-        element.remove_attribute("midi.port");
+    if (pugi::xml_attribute attribute = element.attribute("midi.port")) {
+        this->SetMidiPort(StrToMidivalueName(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.track")) {
-        this->SetMidiTrack(StrToInt(element.attribute("midi.track").value()));
-        element.remove_attribute("midi.track");
+    if (pugi::xml_attribute attribute = element.attribute("midi.track")) {
+        this->SetMidiTrack(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -135,12 +135,12 @@ void AttInstrumentIdent::ResetInstrumentIdent()
     m_instr = "";
 }
 
-bool AttInstrumentIdent::ReadInstrumentIdent(pugi::xml_node element)
+bool AttInstrumentIdent::ReadInstrumentIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("instr")) {
-        this->SetInstr(StrToStr(element.attribute("instr").value()));
-        element.remove_attribute("instr");
+    if (pugi::xml_attribute attribute = element.attribute("instr")) {
+        this->SetInstr(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -186,37 +186,37 @@ void AttMidiInstrument::ResetMidiInstrument()
     m_midiVolume = -1.0;
 }
 
-bool AttMidiInstrument::ReadMidiInstrument(pugi::xml_node element)
+bool AttMidiInstrument::ReadMidiInstrument(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.instrnum")) {
-        this->SetMidiInstrnum(StrToMidivalue(element.attribute("midi.instrnum").value()));
-        element.remove_attribute("midi.instrnum");
+    if (pugi::xml_attribute attribute = element.attribute("midi.instrnum")) {
+        this->SetMidiInstrnum(StrToMidivalue(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.instrname")) {
-        this->SetMidiInstrname(StrToMidinames(element.attribute("midi.instrname").value()));
-        element.remove_attribute("midi.instrname");
+    if (pugi::xml_attribute attribute = element.attribute("midi.instrname")) {
+        this->SetMidiInstrname(StrToMidinames(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.pan")) {
-        this->SetMidiPan(StrToMidivaluePan(element.attribute("midi.pan").value()));
-        element.remove_attribute("midi.pan");
+    if (pugi::xml_attribute attribute = element.attribute("midi.pan")) {
+        this->SetMidiPan(StrToMidivaluePan(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.patchname")) {
-        this->SetMidiPatchname(StrToStr(element.attribute("midi.patchname").value()));
-        element.remove_attribute("midi.patchname");
+    if (pugi::xml_attribute attribute = element.attribute("midi.patchname")) {
+        this->SetMidiPatchname(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.patchnum")) {
-        this->SetMidiPatchnum(StrToMidivalue(element.attribute("midi.patchnum").value()));
-        element.remove_attribute("midi.patchnum");
+    if (pugi::xml_attribute attribute = element.attribute("midi.patchnum")) {
+        this->SetMidiPatchnum(StrToMidivalue(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.volume")) {
-        this->SetMidiVolume(StrToPercent(element.attribute("midi.volume").value()));
-        element.remove_attribute("midi.volume");
+    if (pugi::xml_attribute attribute = element.attribute("midi.volume")) {
+        this->SetMidiVolume(StrToPercent(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -302,12 +302,12 @@ void AttMidiNumber::ResetMidiNumber()
     m_num = 0;
 }
 
-bool AttMidiNumber::ReadMidiNumber(pugi::xml_node element)
+bool AttMidiNumber::ReadMidiNumber(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    if (pugi::xml_attribute attribute = element.attribute("num")) {
+        this->SetNum(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -349,17 +349,17 @@ void AttMidiTempo::ResetMidiTempo()
     m_midiMspb = -1;
 }
 
-bool AttMidiTempo::ReadMidiTempo(pugi::xml_node element)
+bool AttMidiTempo::ReadMidiTempo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.bpm")) {
-        this->SetMidiBpm(StrToMidibpm(element.attribute("midi.bpm").value()));
-        element.remove_attribute("midi.bpm");
+    if (pugi::xml_attribute attribute = element.attribute("midi.bpm")) {
+        this->SetMidiBpm(StrToMidibpm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("midi.mspb")) {
-        this->SetMidiMspb(StrToMidimspb(element.attribute("midi.mspb").value()));
-        element.remove_attribute("midi.mspb");
+    if (pugi::xml_attribute attribute = element.attribute("midi.mspb")) {
+        this->SetMidiMspb(StrToMidimspb(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -409,12 +409,12 @@ void AttMidiValue::ResetMidiValue()
     m_val = -1;
 }
 
-bool AttMidiValue::ReadMidiValue(pugi::xml_node element)
+bool AttMidiValue::ReadMidiValue(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("val")) {
-        this->SetVal(StrToMidivalue(element.attribute("val").value()));
-        element.remove_attribute("val");
+    if (pugi::xml_attribute attribute = element.attribute("val")) {
+        this->SetVal(StrToMidivalue(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -455,12 +455,12 @@ void AttMidiValue2::ResetMidiValue2()
     m_val2 = -1;
 }
 
-bool AttMidiValue2::ReadMidiValue2(pugi::xml_node element)
+bool AttMidiValue2::ReadMidiValue2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("val2")) {
-        this->SetVal2(StrToMidivalue(element.attribute("val2").value()));
-        element.remove_attribute("val2");
+    if (pugi::xml_attribute attribute = element.attribute("val2")) {
+        this->SetVal2(StrToMidivalue(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -501,12 +501,12 @@ void AttMidiVelocity::ResetMidiVelocity()
     m_vel = -1;
 }
 
-bool AttMidiVelocity::ReadMidiVelocity(pugi::xml_node element)
+bool AttMidiVelocity::ReadMidiVelocity(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vel")) {
-        this->SetVel(StrToMidivalue(element.attribute("vel").value()));
-        element.remove_attribute("vel");
+    if (pugi::xml_attribute attribute = element.attribute("vel")) {
+        this->SetVel(StrToMidivalue(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -547,12 +547,12 @@ void AttTimeBase::ResetTimeBase()
     m_ppq = 0;
 }
 
-bool AttTimeBase::ReadTimeBase(pugi::xml_node element)
+bool AttTimeBase::ReadTimeBase(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ppq")) {
-        this->SetPpq(StrToInt(element.attribute("ppq").value()));
-        element.remove_attribute("ppq");
+    if (pugi::xml_attribute attribute = element.attribute("ppq")) {
+        this->SetPpq(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
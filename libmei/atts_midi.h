@@ -32,13 +32,13 @@ namespace vrv {
 class AttChannelized : public Att {
 public:
     AttChannelized();
-    virtual ~AttChannelized();
+    ~AttChannelized();
 
     /** Reset the default values for the attribute class **/
     void ResetChannelized();
 
     /** Read the values for the attribute class **/
-    bool ReadChannelized(pugi::xml_node element);
+    bool ReadChannelized(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteChannelized(pugi::xml_node element);
@@ -86,13 +86,13 @@ private:
 class AttInstrumentIdent : public Att {
 public:
     AttInstrumentIdent();
-    virtual ~AttInstrumentIdent();
+    ~AttInstrumentIdent();
 
     /** Reset the default values for the attribute class **/
     void ResetInstrumentIdent();
 
     /** Read the values for the attribute class **/
-    bool ReadInstrumentIdent(pugi::xml_node element);
+    bool ReadInstrumentIdent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteInstrumentIdent(pugi::xml_node element);
@@ -125,13 +125,13 @@ private:
 class AttMidiInstrument : public Att {
 public:
     AttMidiInstrument();
-    virtual ~AttMidiInstrument();
+    ~AttMidiInstrument();
 
     /** Reset the default values for the attribute class **/
     void ResetMidiInstrument();
 
     /** Read the values for the attribute class **/
-    bool ReadMidiInstrument(pugi::xml_node element);
+    bool ReadMidiInstrument(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMidiInstrument(pugi::xml_node element);
@@ -200,13 +200,13 @@ private:
 class AttMidiNumber : public Att {
 public:
     AttMidiNumber();
-    virtual ~AttMidiNumber();
+    ~AttMidiNumber();
 
     /** Reset the default values for the attribute class **/
     void ResetMidiNumber();
 
     /** Read the values for the attribute class **/
-    bool ReadMidiNumber(pugi::xml_node element);
+    bool ReadMidiNumber(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMidiNumber(pugi::xml_node element);
@@ -236,13 +236,13 @@ private:
 class AttMidiTempo : public Att {
 public:
     AttMidiTempo();
-    virtual ~AttMidiTempo();
+    ~AttMidiTempo();
 
     /** Reset the default values for the attribute class **/
     void ResetMidiTempo();
 
     /** Read the values for the attribute class **/
-    bool ReadMidiTempo(pugi::xml_node element);
+    bool ReadMidiTempo(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMidiTempo(pugi::xml_node element);
@@ -287,13 +287,13 @@ private:
 class AttMidiValue : public Att {
 public:
     AttMidiValue();
-    virtual ~AttMidiValue();
+    ~AttMidiValue();
 
     /** Reset the default values for the attribute class **/
     void ResetMidiValue();
 
     /** Read the values for the attribute class **/
-    bool ReadMidiValue(pugi::xml_node element);
+    bool ReadMidiValue(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMidiValue(pugi::xml_node element);
@@ -323,13 +323,13 @@ private:
 class AttMidiValue2 : public Att {
 public:
     AttMidiValue2();
-    virtual ~AttMidiValue2();
+    ~AttMidiValue2();
 
     /** Reset the default values for the attribute class **/
     void ResetMidiValue2();
 
     /** Read the values for the attribute class **/
-    bool ReadMidiValue2(pugi::xml_node element);
+    bool ReadMidiValue2(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMidiValue2(pugi::xml_node element);
@@ -359,13 +359,13 @@ private:
 class AttMidiVelocity : public Att {
 public:
     AttMidiVelocity();
-    virtual ~AttMidiVelocity();
+    ~AttMidiVelocity();
 
     /** Reset the default values for the attribute class **/
     void ResetMidiVelocity();
 
     /** Read the values for the attribute class **/
-    bool ReadMidiVelocity(pugi::xml_node element);
+    bool ReadMidiVelocity(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMidiVelocity(pugi::xml_node element);
@@ -395,13 +395,13 @@ private:
 class AttTimeBase : public Att {
 public:
     AttTimeBase();
-    virtual ~AttTimeBase();
+    ~AttTimeBase();
 
     /** Reset the default values for the attribute class **/
     void ResetTimeBase();
 
     /** Read the values for the attribute class **/
-    bool ReadTimeBase(pugi::xml_node element);
+    bool ReadTimeBase(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTimeBase(pugi::xml_node element);
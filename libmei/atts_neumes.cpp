@@ -45,17 +45,17 @@ void AttNcLog::ResetNcLog()
     m_pname = "";
 }
 
-bool AttNcLog::ReadNcLog(pugi::xml_node element)
+bool AttNcLog::ReadNcLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToStr(element.attribute("oct").value()));
-        element.remove_attribute("oct");
+    if (pugi::xml_attribute attribute = element.attribute("oct")) {
+        this->SetOct(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("pname")) {
-        this->SetPname(StrToStr(element.attribute("pname").value()));
-        element.remove_attribute("pname");
+    if (pugi::xml_attribute attribute = element.attribute("pname")) {
+        this->SetPname(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -112,47 +112,47 @@ void AttNcForm::ResetNcForm()
     m_tilt = data_COMPASSDIRECTION();
 }
 
-bool AttNcForm::ReadNcForm(pugi::xml_node element)
+bool AttNcForm::ReadNcForm(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("angled")) {
-        this->SetAngled(StrToBoolean(element.attribute("angled").value()));
-        element.remove_attribute("angled");
+    if (pugi::xml_attribute attribute = element.attribute("angled")) {
+        this->SetAngled(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("con")) {
-        this->SetCon(StrToNcFormCon(element.attribute("con").value()));
-        element.remove_attribute("con");
+    if (pugi::xml_attribute attribute = element.attribute("con")) {
+        this->SetCon(StrToNcFormCon(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("curve")) {
-        this->SetCurve(StrToNcFormCurve(element.attribute("curve").value()));
-        element.remove_attribute("curve");
+    if (pugi::xml_attribute attribute = element.attribute("curve")) {
+        this->SetCurve(StrToNcFormCurve(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("hooked")) {
-        this->SetHooked(StrToBoolean(element.attribute("hooked").value()));
-        element.remove_attribute("hooked");
+    if (pugi::xml_attribute attribute = element.attribute("hooked")) {
+        this->SetHooked(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("ligated")) {
-        this->SetLigated(StrToBoolean(element.attribute("ligated").value()));
-        element.remove_attribute("ligated");
+    if (pugi::xml_attribute attribute = element.attribute("ligated")) {
+        this->SetLigated(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("rellen")) {
-        this->SetRellen(StrToNcFormRellen(element.attribute("rellen").value()));
-        element.remove_attribute("rellen");
+    if (pugi::xml_attribute attribute = element.attribute("rellen")) {
+        this->SetRellen(StrToNcFormRellen(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("sShape")) {
-        this->SetSShape(StrToStr(element.attribute("sShape").value()));
-        element.remove_attribute("sShape");
+    if (pugi::xml_attribute attribute = element.attribute("sShape")) {
+        this->SetSShape(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        element.remove_attribute("tilt");
+    if (pugi::xml_attribute attribute = element.attribute("tilt")) {
+        this->SetTilt(StrToCompassdirection(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -32,13 +32,13 @@ namespace vrv {
 class AttNcLog : public Att {
 public:
     AttNcLog();
-    virtual ~AttNcLog();
+    ~AttNcLog();
 
     /** Reset the default values for the attribute class **/
     void ResetNcLog();
 
     /** Read the values for the attribute class **/
-    bool ReadNcLog(pugi::xml_node element);
+    bool ReadNcLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNcLog(pugi::xml_node element);
@@ -74,13 +74,13 @@ private:
 class AttNcForm : public Att {
 public:
     AttNcForm();
-    virtual ~AttNcForm();
+    ~AttNcForm();
 
     /** Reset the default values for the attribute class **/
     void ResetNcForm();
 
     /** Read the values for the attribute class **/
-    bool ReadNcForm(pugi::xml_node element);
+    bool ReadNcForm(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNcForm(pugi::xml_node element);
@@ -44,12 +44,12 @@ void AttSurface::ResetSurface()
     m_surface = "";
 }
 
-bool AttSurface::ReadSurface(pugi::xml_node element)
+bool AttSurface::ReadSurface(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("surface")) {
-        this->SetSurface(StrToStr(element.attribute("surface").value()));
-        element.remove_attribute("surface");
+    if (pugi::xml_attribute attribute = element.attribute("surface")) {
+        this->SetSurface(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
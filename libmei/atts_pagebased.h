@@ -32,13 +32,13 @@ namespace vrv {
 class AttSurface : public Att {
 public:
     AttSurface();
-    virtual ~AttSurface();
+    ~AttSurface();
 
     /** Reset the default values for the attribute class **/
     void ResetSurface();
 
     /** Read the values for the attribute class **/
-    bool ReadSurface(pugi::xml_node element);
+    bool ReadSurface(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSurface(pugi::xml_node element);
@@ -44,12 +44,12 @@ void AttAlignment::ResetAlignment()
     m_when = "";
 }
 
-bool AttAlignment::ReadAlignment(pugi::xml_node element)
+bool AttAlignment::ReadAlignment(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("when")) {
-        this->SetWhen(StrToStr(element.attribute("when").value()));
-        element.remove_attribute("when");
+    if (pugi::xml_attribute attribute = element.attribute("when")) {
+        this->SetWhen(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -32,13 +32,13 @@ namespace vrv {
 class AttAlignment : public Att {
 public:
     AttAlignment();
-    virtual ~AttAlignment();
+    ~AttAlignment();
 
     /** Reset the default values for the attribute class **/
     void ResetAlignment();
 
     /** Read the values for the attribute class **/
-    bool ReadAlignment(pugi::xml_node element);
+    bool ReadAlignment(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAlignment(pugi::xml_node element);
@@ -44,12 +44,12 @@ void AttAccidLog::ResetAccidLog()
     m_func = accidLog_FUNC_NONE;
 }
 
-bool AttAccidLog::ReadAccidLog(pugi::xml_node element)
+bool AttAccidLog::ReadAccidLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToAccidLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToAccidLogFunc(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +90,12 @@ void AttAccidental::ResetAccidental()
     m_accid = ACCIDENTAL_WRITTEN_NONE;
 }
 
-bool AttAccidental::ReadAccidental(pugi::xml_node element)
+bool AttAccidental::ReadAccidental(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid")) {
-        this->SetAccid(StrToAccidentalWritten(element.attribute("accid").value()));
-        element.remove_attribute("accid");
+    if (pugi::xml_attribute attribute = element.attribute("accid")) {
+        this->SetAccid(StrToAccidentalWritten(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -136,12 +136,12 @@ void AttArticulation::ResetArticulation()
     m_artic = std::vector<data_ARTICULATION>();
 }
 
-bool AttArticulation::ReadArticulation(pugi::xml_node element)
+bool AttArticulation::ReadArticulation(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic")) {
-        this->SetArtic(StrToArticulationList(element.attribute("artic").value()));
-        element.remove_attribute("artic");
+    if (pugi::xml_attribute attribute = element.attribute("artic")) {
+        this->SetArtic(StrToArticulationList(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -182,12 +182,12 @@ void AttAttaccaLog::ResetAttaccaLog()
     m_target = "";
 }
 
-bool AttAttaccaLog::ReadAttaccaLog(pugi::xml_node element)
+bool AttAttaccaLog::ReadAttaccaLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        element.remove_attribute("target");
+    if (pugi::xml_attribute attribute = element.attribute("target")) {
+        this->SetTarget(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -228,12 +228,12 @@ void AttAudience::ResetAudience()
     m_audience = audience_AUDIENCE_NONE;
 }
 
-bool AttAudience::ReadAudience(pugi::xml_node element)
+bool AttAudience::ReadAudience(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("audience")) {
-        this->SetAudience(StrToAudienceAudience(element.attribute("audience").value()));
-        element.remove_attribute("audience");
+    if (pugi::xml_attribute attribute = element.attribute("audience")) {
+        this->SetAudience(StrToAudienceAudience(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -274,12 +274,12 @@ void AttAugmentDots::ResetAugmentDots()
     m_dots = -1;
 }
 
-bool AttAugmentDots::ReadAugmentDots(pugi::xml_node element)
+bool AttAugmentDots::ReadAugmentDots(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dots")) {
-        this->SetDots(StrToInt(element.attribute("dots").value()));
-        element.remove_attribute("dots");
+    if (pugi::xml_attribute attribute = element.attribute("dots")) {
+        this->SetDots(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -321,17 +321,17 @@ void AttAuthorized::ResetAuthorized()
     m_authUri = "";
 }
 
-bool AttAuthorized::ReadAuthorized(pugi::xml_node element)
+bool AttAuthorized::ReadAuthorized(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("auth")) {
-        this->SetAuth(StrToStr(element.attribute("auth").value()));
-        element.remove_attribute("auth");
+    if (pugi::xml_attribute attribute = element.attribute("auth")) {
+        this->SetAuth(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("auth.uri")) {
-        this->SetAuthUri(StrToStr(element.attribute("auth.uri").value()));
-        element.remove_attribute("auth.uri");
+    if (pugi::xml_attribute attribute = element.attribute("auth.uri")) {
+        this->SetAuthUri(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -381,12 +381,12 @@ void AttBarLineLog::ResetBarLineLog()
     m_form = BARRENDITION_single;
 }
 
-bool AttBarLineLog::ReadBarLineLog(pugi::xml_node element)
+bool AttBarLineLog::ReadBarLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBarrendition(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToBarrendition(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -429,22 +429,22 @@ void AttBarring::ResetBarring()
     m_barPlace = 0;
 }
 
-bool AttBarring::ReadBarring(pugi::xml_node element)
+bool AttBarring::ReadBarring(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bar.len")) {
-        this->SetBarLen(StrToDbl(element.attribute("bar.len").value()));
-        element.remove_attribute("bar.len");
+    if (pugi::xml_attribute attribute = element.attribute("bar.len")) {
+        this->SetBarLen(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("bar.method")) {
-        this->SetBarMethod(StrToBarmethod(element.attribute("bar.method").value()));
-        element.remove_attribute("bar.method");
+    if (pugi::xml_attribute attribute = element.attribute("bar.method")) {
+        this->SetBarMethod(StrToBarmethod(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("bar.place")) {
-        this->SetBarPlace(StrToInt(element.attribute("bar.place").value()));
-        element.remove_attribute("bar.place");
+    if (pugi::xml_attribute attribute = element.attribute("bar.place")) {
+        this->SetBarPlace(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -503,12 +503,12 @@ void AttBasic::ResetBasic()
     m_base = "";
 }
 
-bool AttBasic::ReadBasic(pugi::xml_node element)
+bool AttBasic::ReadBasic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:base")) {
-        this->SetBase(StrToStr(element.attribute("xml:base").value()));
-        element.remove_attribute("xml:base");
+    if (pugi::xml_attribute attribute = element.attribute("xml:base")) {
+        this->SetBase(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -549,12 +549,12 @@ void AttBibl::ResetBibl()
     m_analog = "";
 }
 
-bool AttBibl::ReadBibl(pugi::xml_node element)
+bool AttBibl::ReadBibl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("analog")) {
-        this->SetAnalog(StrToStr(element.attribute("analog").value()));
-        element.remove_attribute("analog");
+    if (pugi::xml_attribute attribute = element.attribute("analog")) {
+        this->SetAnalog(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -595,12 +595,12 @@ void AttCalendared::ResetCalendared()
     m_calendar = "";
 }
 
-bool AttCalendared::ReadCalendared(pugi::xml_node element)
+bool AttCalendared::ReadCalendared(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("calendar")) {
-        this->SetCalendar(StrToStr(element.attribute("calendar").value()));
-        element.remove_attribute("calendar");
+    if (pugi::xml_attribute attribute = element.attribute("calendar")) {
+        this->SetCalendar(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -641,12 +641,12 @@ void AttCanonical::ResetCanonical()
     m_codedval = "";
 }
 
-bool AttCanonical::ReadCanonical(pugi::xml_node element)
+bool AttCanonical::ReadCanonical(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("codedval")) {
-        this->SetCodedval(StrToStr(element.attribute("codedval").value()));
-        element.remove_attribute("codedval");
+    if (pugi::xml_attribute attribute = element.attribute("codedval")) {
+        this->SetCodedval(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -687,12 +687,12 @@ void AttClassed::ResetClassed()
     m_class = "";
 }
 
-bool AttClassed::ReadClassed(pugi::xml_node element)
+bool AttClassed::ReadClassed(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("class")) {
-        this->SetClass(StrToStr(element.attribute("class").value()));
-        element.remove_attribute("class");
+    if (pugi::xml_attribute attribute = element.attribute("class")) {
+        this->SetClass(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -733,12 +733,12 @@ void AttClefLog::ResetClefLog()
     m_cautionary = BOOLEAN_NONE;
 }
 
-bool AttClefLog::ReadClefLog(pugi::xml_node element)
+bool AttClefLog::ReadClefLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cautionary")) {
-        this->SetCautionary(StrToBoolean(element.attribute("cautionary").value()));
-        element.remove_attribute("cautionary");
+    if (pugi::xml_attribute attribute = element.attribute("cautionary")) {
+        this->SetCautionary(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -779,12 +779,12 @@ void AttClefShape::ResetClefShape()
     m_shape = CLEFSHAPE_NONE;
 }
 
-bool AttClefShape::ReadClefShape(pugi::xml_node element)
+bool AttClefShape::ReadClefShape(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("shape")) {
-        this->SetShape(StrToClefshape(element.attribute("shape").value()));
-        element.remove_attribute("shape");
+    if (pugi::xml_attribute attribute = element.attribute("shape")) {
+        this->SetShape(StrToClefshape(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -828,27 +828,27 @@ void AttCleffingLog::ResetCleffingLog()
     m_clefDisPlace = STAFFREL_basic_NONE;
 }
 
-bool AttCleffingLog::ReadCleffingLog(pugi::xml_node element)
+bool AttCleffingLog::ReadCleffingLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.shape")) {
-        this->SetClefShape(StrToClefshape(element.attribute("clef.shape").value()));
-        element.remove_attribute("clef.shape");
+    if (pugi::xml_attribute attribute = element.attribute("clef.shape")) {
+        this->SetClefShape(StrToClefshape(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("clef.line")) {
-        this->SetClefLine(StrToInt(element.attribute("clef.line").value()));
-        element.remove_attribute("clef.line");
+    if (pugi::xml_attribute attribute = element.attribute("clef.line")) {
+        this->SetClefLine(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("clef.dis")) {
-        this->SetClefDis(StrToOctaveDis(element.attribute("clef.dis").value()));
-        element.remove_attribute("clef.dis");
+    if (pugi::xml_attribute attribute = element.attribute("clef.dis")) {
+        this->SetClefDis(StrToOctaveDis(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("clef.dis.place")) {
-        this->SetClefDisPlace(StrToStaffrelBasic(element.attribute("clef.dis.place").value()));
-        element.remove_attribute("clef.dis.place");
+    if (pugi::xml_attribute attribute = element.attribute("clef.dis.place")) {
+        this->SetClefDisPlace(StrToStaffrelBasic(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -916,12 +916,12 @@ void AttColor::ResetColor()
     m_color = "";
 }
 
-bool AttColor::ReadColor(pugi::xml_node element)
+bool AttColor::ReadColor(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("color")) {
-        this->SetColor(StrToStr(element.attribute("color").value()));
-        element.remove_attribute("color");
+    if (pugi::xml_attribute attribute = element.attribute("color")) {
+        this->SetColor(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -962,12 +962,12 @@ void AttColoration::ResetColoration()
     m_colored = BOOLEAN_NONE;
 }
 
-bool AttColoration::ReadColoration(pugi::xml_node element)
+bool AttColoration::ReadColoration(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("colored")) {
-        this->SetColored(StrToBoolean(element.attribute("colored").value()));
-        element.remove_attribute("colored");
+    if (pugi::xml_attribute attribute = element.attribute("colored")) {
+        this->SetColored(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1011,27 +1011,27 @@ void AttCoordinated::ResetCoordinated()
     m_lry = 0;
 }
 
-bool AttCoordinated::ReadCoordinated(pugi::xml_node element)
+bool AttCoordinated::ReadCoordinated(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ulx")) {
-        this->SetUlx(StrToInt(element.attribute("ulx").value()));
-        element.remove_attribute("ulx");
+    if (pugi::xml_attribute attribute = element.attribute("ulx")) {
+        this->SetUlx(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("uly")) {
-        this->SetUly(StrToInt(element.attribute("uly").value()));
-        element.remove_attribute("uly");
+    if (pugi::xml_attribute attribute = element.attribute("uly")) {
+        this->SetUly(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lrx")) {
-        this->SetLrx(StrToInt(element.attribute("lrx").value()));
-        element.remove_attribute("lrx");
+    if (pugi::xml_attribute attribute = element.attribute("lrx")) {
+        this->SetLrx(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lry")) {
-        this->SetLry(StrToInt(element.attribute("lry").value()));
-        element.remove_attribute("lry");
+    if (pugi::xml_attribute attribute = element.attribute("lry")) {
+        this->SetLry(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1099,12 +1099,12 @@ void AttCue::ResetCue()
     m_cue = BOOLEAN_NONE;
 }
 
-bool AttCue::ReadCue(pugi::xml_node element)
+bool AttCue::ReadCue(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cue")) {
-        this->SetCue(StrToBoolean(element.attribute("cue").value()));
-        element.remove_attribute("cue");
+    if (pugi::xml_attribute attribute = element.attribute("cue")) {
+        this->SetCue(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1147,22 +1147,22 @@ void AttCurvature::ResetCurvature()
     m_curvedir = curvature_CURVEDIR_NONE;
 }
 
-bool AttCurvature::ReadCurvature(pugi::xml_node element)
+bool AttCurvature::ReadCurvature(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bezier")) {
-        this->SetBezier(StrToStr(element.attribute("bezier").value()));
-        element.remove_attribute("bezier");
+    if (pugi::xml_attribute attribute = element.attribute("bezier")) {
+        this->SetBezier(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("bulge")) {
-        this->SetBulge(StrToDbl(element.attribute("bulge").value()));
-        element.remove_attribute("bulge");
+    if (pugi::xml_attribute attribute = element.attribute("bulge")) {
+        this->SetBulge(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("curvedir")) {
-        this->SetCurvedir(StrToCurvatureCurvedir(element.attribute("curvedir").value()));
-        element.remove_attribute("curvedir");
+    if (pugi::xml_attribute attribute = element.attribute("curvedir")) {
+        this->SetCurvedir(StrToCurvatureCurvedir(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1222,17 +1222,17 @@ void AttCurveRend::ResetCurveRend()
     m_lwidth = data_LINEWIDTH();
 }
 
-bool AttCurveRend::ReadCurveRend(pugi::xml_node element)
+bool AttCurveRend::ReadCurveRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        element.remove_attribute("lform");
+    if (pugi::xml_attribute attribute = element.attribute("lform")) {
+        this->SetLform(StrToLineform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToLinewidth(element.attribute("lwidth").value()));
-        element.remove_attribute("lwidth");
+    if (pugi::xml_attribute attribute = element.attribute("lwidth")) {
+        this->SetLwidth(StrToLinewidth(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1282,12 +1282,12 @@ void AttCustosLog::ResetCustosLog()
     m_target = "";
 }
 
-bool AttCustosLog::ReadCustosLog(pugi::xml_node element)
+bool AttCustosLog::ReadCustosLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        element.remove_attribute("target");
+    if (pugi::xml_attribute attribute = element.attribute("target")) {
+        this->SetTarget(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1328,12 +1328,12 @@ void AttDataPointing::ResetDataPointing()
     m_data = "";
 }
 
-bool AttDataPointing::ReadDataPointing(pugi::xml_node element)
+bool AttDataPointing::ReadDataPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("data")) {
-        this->SetData(StrToStr(element.attribute("data").value()));
-        element.remove_attribute("data");
+    if (pugi::xml_attribute attribute = element.attribute("data")) {
+        this->SetData(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1378,32 +1378,32 @@ void AttDatable::ResetDatable()
     m_startdate = "";
 }
 
-bool AttDatable::ReadDatable(pugi::xml_node element)
+bool AttDatable::ReadDatable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("enddate")) {
-        this->SetEnddate(StrToStr(element.attribute("enddate").value()));
-        element.remove_attribute("enddate");
+    if (pugi::xml_attribute attribute = element.attribute("enddate")) {
+        this->SetEnddate(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("isodate")) {
-        this->SetIsodate(StrToStr(element.attribute("isodate").value()));
-        element.remove_attribute("isodate");
+    if (pugi::xml_attribute attribute = element.attribute("isodate")) {
+        this->SetIsodate(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("notafter")) {
-        this->SetNotafter(StrToStr(element.attribute("notafter").value()));
-        element.remove_attribute("notafter");
+    if (pugi::xml_attribute attribute = element.attribute("notafter")) {
+        this->SetNotafter(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("notbefore")) {
-        this->SetNotbefore(StrToStr(element.attribute("notbefore").value()));
-        element.remove_attribute("notbefore");
+    if (pugi::xml_attribute attribute = element.attribute("notbefore")) {
+        this->SetNotbefore(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("startdate")) {
-        this->SetStartdate(StrToStr(element.attribute("startdate").value()));
-        element.remove_attribute("startdate");
+    if (pugi::xml_attribute attribute = element.attribute("startdate")) {
+        this->SetStartdate(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1482,22 +1482,22 @@ void AttDistances::ResetDistances()
     m_textDist = VRV_UNSET;
 }
 
-bool AttDistances::ReadDistances(pugi::xml_node element)
+bool AttDistances::ReadDistances(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dynam.dist")) {
-        this->SetDynamDist(StrToMeasurementrel(element.attribute("dynam.dist").value()));
-        element.remove_attribute("dynam.dist");
+    if (pugi::xml_attribute attribute = element.attribute("dynam.dist")) {
+        this->SetDynamDist(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("harm.dist")) {
-        this->SetHarmDist(StrToMeasurementrel(element.attribute("harm.dist").value()));
-        element.remove_attribute("harm.dist");
+    if (pugi::xml_attribute attribute = element.attribute("harm.dist")) {
+        this->SetHarmDist(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.dist")) {
-        this->SetTextDist(StrToMeasurementrel(element.attribute("text.dist").value()));
-        element.remove_attribute("text.dist");
+    if (pugi::xml_attribute attribute = element.attribute("text.dist")) {
+        this->SetTextDist(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1556,12 +1556,12 @@ void AttDotLog::ResetDotLog()
     m_form = dotLog_FORM_NONE;
 }
 
-bool AttDotLog::ReadDotLog(pugi::xml_node element)
+bool AttDotLog::ReadDotLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToDotLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToDotLogForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1602,12 +1602,12 @@ void AttDurationAdditive::ResetDurationAdditive()
     m_dur = DURATION_NONE;
 }
 
-bool AttDurationAdditive::ReadDurationAdditive(pugi::xml_node element)
+bool AttDurationAdditive::ReadDurationAdditive(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        element.remove_attribute("dur");
+    if (pugi::xml_attribute attribute = element.attribute("dur")) {
+        this->SetDur(StrToDuration(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1650,22 +1650,22 @@ void AttDurationDefault::ResetDurationDefault()
     m_numbaseDefault = 0;
 }
 
-bool AttDurationDefault::ReadDurationDefault(pugi::xml_node element)
+bool AttDurationDefault::ReadDurationDefault(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.default")) {
-        this->SetDurDefault(StrToDuration(element.attribute("dur.default").value()));
-        element.remove_attribute("dur.default");
+    if (pugi::xml_attribute attribute = element.attribute("dur.default")) {
+        this->SetDurDefault(StrToDuration(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("num.default")) {
-        this->SetNumDefault(StrToInt(element.attribute("num.default").value()));
-        element.remove_attribute("num.default");
+    if (pugi::xml_attribute attribute = element.attribute("num.default")) {
+        this->SetNumDefault(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("numbase.default")) {
-        this->SetNumbaseDefault(StrToInt(element.attribute("numbase.default").value()));
-        element.remove_attribute("numbase.default");
+    if (pugi::xml_attribute attribute = element.attribute("numbase.default")) {
+        this->SetNumbaseDefault(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1724,12 +1724,12 @@ void AttDurationLogical::ResetDurationLogical()
     m_dur = DURATION_NONE;
 }
 
-bool AttDurationLogical::ReadDurationLogical(pugi::xml_node element)
+bool AttDurationLogical::ReadDurationLogical(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        element.remove_attribute("dur");
+    if (pugi::xml_attribute attribute = element.attribute("dur")) {
+        this->SetDur(StrToDuration(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1771,17 +1771,17 @@ void AttDurationRatio::ResetDurationRatio()
     m_numbase = -1;
 }
 
-bool AttDurationRatio::ReadDurationRatio(pugi::xml_node element)
+bool AttDurationRatio::ReadDurationRatio(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    if (pugi::xml_attribute attribute = element.attribute("num")) {
+        this->SetNum(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("numbase")) {
-        this->SetNumbase(StrToInt(element.attribute("numbase").value()));
-        element.remove_attribute("numbase");
+    if (pugi::xml_attribute attribute = element.attribute("numbase")) {
+        this->SetNumbase(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1831,12 +1831,12 @@ void AttEnclosingChars::ResetEnclosingChars()
     m_enclose = ENCLOSURE_NONE;
 }
 
-bool AttEnclosingChars::ReadEnclosingChars(pugi::xml_node element)
+bool AttEnclosingChars::ReadEnclosingChars(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("enclose")) {
-        this->SetEnclose(StrToEnclosure(element.attribute("enclose").value()));
-        element.remove_attribute("enclose");
+    if (pugi::xml_attribute attribute = element.attribute("enclose")) {
+        this->SetEnclose(StrToEnclosure(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1877,12 +1877,12 @@ void AttEndings::ResetEndings()
     m_endingRend = endings_ENDINGREND_NONE;
 }
 
-bool AttEndings::ReadEndings(pugi::xml_node element)
+bool AttEndings::ReadEndings(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ending.rend")) {
-        this->SetEndingRend(StrToEndingsEndingrend(element.attribute("ending.rend").value()));
-        element.remove_attribute("ending.rend");
+    if (pugi::xml_attribute attribute = element.attribute("ending.rend")) {
+        this->SetEndingRend(StrToEndingsEndingrend(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1924,17 +1924,17 @@ void AttEvidence::ResetEvidence()
     m_evidence = "";
 }
 
-bool AttEvidence::ReadEvidence(pugi::xml_node element)
+bool AttEvidence::ReadEvidence(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cert")) {
-        this->SetCert(StrToCertainty(element.attribute("cert").value()));
-        element.remove_attribute("cert");
+    if (pugi::xml_attribute attribute = element.attribute("cert")) {
+        this->SetCert(StrToCertainty(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("evidence")) {
-        this->SetEvidence(StrToStr(element.attribute("evidence").value()));
-        element.remove_attribute("evidence");
+    if (pugi::xml_attribute attribute = element.attribute("evidence")) {
+        this->SetEvidence(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1984,12 +1984,12 @@ void AttExtender::ResetExtender()
     m_extender = BOOLEAN_NONE;
 }
 
-bool AttExtender::ReadExtender(pugi::xml_node element)
+bool AttExtender::ReadExtender(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extender")) {
-        this->SetExtender(StrToBoolean(element.attribute("extender").value()));
-        element.remove_attribute("extender");
+    if (pugi::xml_attribute attribute = element.attribute("extender")) {
+        this->SetExtender(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2030,12 +2030,12 @@ void AttExtent::ResetExtent()
     m_extent = "";
 }
 
-bool AttExtent::ReadExtent(pugi::xml_node element)
+bool AttExtent::ReadExtent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("extent")) {
-        this->SetExtent(StrToStr(element.attribute("extent").value()));
-        element.remove_attribute("extent");
+    if (pugi::xml_attribute attribute = element.attribute("extent")) {
+        this->SetExtent(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2076,12 +2076,12 @@ void AttFermataPresent::ResetFermataPresent()
     m_fermata = STAFFREL_basic_NONE;
 }
 
-bool AttFermataPresent::ReadFermataPresent(pugi::xml_node element)
+bool AttFermataPresent::ReadFermataPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("fermata")) {
-        this->SetFermata(StrToStaffrelBasic(element.attribute("fermata").value()));
-        element.remove_attribute("fermata");
+    if (pugi::xml_attribute attribute = element.attribute("fermata")) {
+        this->SetFermata(StrToStaffrelBasic(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2122,12 +2122,12 @@ void AttFiling::ResetFiling()
     m_nonfiling = 0;
 }
 
-bool AttFiling::ReadFiling(pugi::xml_node element)
+bool AttFiling::ReadFiling(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("nonfiling")) {
-        this->SetNonfiling(StrToInt(element.attribute("nonfiling").value()));
-        element.remove_attribute("nonfiling");
+    if (pugi::xml_attribute attribute = element.attribute("nonfiling")) {
+        this->SetNonfiling(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2168,12 +2168,12 @@ void AttGrpSymLog::ResetGrpSymLog()
     m_level = 0;
 }
 
-bool AttGrpSymLog::ReadGrpSymLog(pugi::xml_node element)
+bool AttGrpSymLog::ReadGrpSymLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("level")) {
-        this->SetLevel(StrToInt(element.attribute("level").value()));
-        element.remove_attribute("level");
+    if (pugi::xml_attribute attribute = element.attribute("level")) {
+        this->SetLevel(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2214,12 +2214,12 @@ void AttHandIdent::ResetHandIdent()
     m_hand = "";
 }
 
-bool AttHandIdent::ReadHandIdent(pugi::xml_node element)
+bool AttHandIdent::ReadHandIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("hand")) {
-        this->SetHand(StrToStr(element.attribute("hand").value()));
-        element.remove_attribute("hand");
+    if (pugi::xml_attribute attribute = element.attribute("hand")) {
+        this->SetHand(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2260,12 +2260,12 @@ void AttHeight::ResetHeight()
     m_height = VRV_UNSET;
 }
 
-bool AttHeight::ReadHeight(pugi::xml_node element)
+bool AttHeight::ReadHeight(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("height")) {
-        this->SetHeight(StrToMeasurementabs(element.attribute("height").value()));
-        element.remove_attribute("height");
+    if (pugi::xml_attribute attribute = element.attribute("height")) {
+        this->SetHeight(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2306,12 +2306,12 @@ void AttHorizontalAlign::ResetHorizontalAlign()
     m_halign = HORIZONTALALIGNMENT_NONE;
 }
 
-bool AttHorizontalAlign::ReadHorizontalAlign(pugi::xml_node element)
+bool AttHorizontalAlign::ReadHorizontalAlign(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("halign")) {
-        this->SetHalign(StrToHorizontalalignment(element.attribute("halign").value()));
-        element.remove_attribute("halign");
+    if (pugi::xml_attribute attribute = element.attribute("halign")) {
+        this->SetHalign(StrToHorizontalalignment(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2352,12 +2352,12 @@ void AttInternetMedia::ResetInternetMedia()
     m_mimetype = "";
 }
 
-bool AttInternetMedia::ReadInternetMedia(pugi::xml_node element)
+bool AttInternetMedia::ReadInternetMedia(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mimetype")) {
-        this->SetMimetype(StrToStr(element.attribute("mimetype").value()));
-        element.remove_attribute("mimetype");
+    if (pugi::xml_attribute attribute = element.attribute("mimetype")) {
+        this->SetMimetype(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2398,12 +2398,12 @@ void AttJoined::ResetJoined()
     m_join = "";
 }
 
-bool AttJoined::ReadJoined(pugi::xml_node element)
+bool AttJoined::ReadJoined(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("join")) {
-        this->SetJoin(StrToStr(element.attribute("join").value()));
-        element.remove_attribute("join");
+    if (pugi::xml_attribute attribute = element.attribute("join")) {
+        this->SetJoin(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2444,12 +2444,12 @@ void AttKeySigLog::ResetKeySigLog()
     m_sig = std::make_pair(-1, ACCIDENTAL_WRITTEN_NONE);
 }
 
-bool AttKeySigLog::ReadKeySigLog(pugi::xml_node element)
+bool AttKeySigLog::ReadKeySigLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig")) {
-        this->SetSig(StrToKeysignature(element.attribute("sig").value()));
-        element.remove_attribute("sig");
+    if (pugi::xml_attribute attribute = element.attribute("sig")) {
+        this->SetSig(StrToKeysignature(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2490,12 +2490,12 @@ void AttKeySigDefaultLog::ResetKeySigDefaultLog()
     m_keySig = std::make_pair(-1, ACCIDENTAL_WRITTEN_NONE);
 }
 
-bool AttKeySigDefaultLog::ReadKeySigDefaultLog(pugi::xml_node element)
+bool AttKeySigDefaultLog::ReadKeySigDefaultLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.sig")) {
-        this->SetKeySig(StrToKeysignature(element.attribute("key.sig").value()));
-        element.remove_attribute("key.sig");
+    if (pugi::xml_attribute attribute = element.attribute("key.sig")) {
+        this->SetKeySig(StrToKeysignature(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2536,12 +2536,12 @@ void AttLabelled::ResetLabelled()
     m_label = "";
 }
 
-bool AttLabelled::ReadLabelled(pugi::xml_node element)
+bool AttLabelled::ReadLabelled(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("label")) {
-        this->SetLabel(StrToStr(element.attribute("label").value()));
-        element.remove_attribute("label");
+    if (pugi::xml_attribute attribute = element.attribute("label")) {
+        this->SetLabel(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2583,17 +2583,17 @@ void AttLang::ResetLang()
     m_translit = "";
 }
 
-bool AttLang::ReadLang(pugi::xml_node element)
+bool AttLang::ReadLang(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:lang")) {
-        this->SetLang(StrToStr(element.attribute("xml:lang").value()));
-        element.remove_attribute("xml:lang");
+    if (pugi::xml_attribute attribute = element.attribute("xml:lang")) {
+        this->SetLang(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xml:translit")) {
-        this->SetTranslit(StrToStr(element.attribute("xml:translit").value()));
-        element.remove_attribute("xml:translit");
+    if (pugi::xml_attribute attribute = element.attribute("xml:translit")) {
+        this->SetTranslit(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2643,12 +2643,12 @@ void AttLayerLog::ResetLayerLog()
     m_def = "";
 }
 
-bool AttLayerLog::ReadLayerLog(pugi::xml_node element)
+bool AttLayerLog::ReadLayerLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        element.remove_attribute("def");
+    if (pugi::xml_attribute attribute = element.attribute("def")) {
+        this->SetDef(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2689,12 +2689,12 @@ void AttLayerIdent::ResetLayerIdent()
     m_layer = 0;
 }
 
-bool AttLayerIdent::ReadLayerIdent(pugi::xml_node element)
+bool AttLayerIdent::ReadLayerIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("layer")) {
-        this->SetLayer(StrToInt(element.attribute("layer").value()));
-        element.remove_attribute("layer");
+    if (pugi::xml_attribute attribute = element.attribute("layer")) {
+        this->SetLayer(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2735,12 +2735,12 @@ void AttLineLoc::ResetLineLoc()
     m_line = 0;
 }
 
-bool AttLineLoc::ReadLineLoc(pugi::xml_node element)
+bool AttLineLoc::ReadLineLoc(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("line")) {
-        this->SetLine(StrToInt(element.attribute("line").value()));
-        element.remove_attribute("line");
+    if (pugi::xml_attribute attribute = element.attribute("line")) {
+        this->SetLine(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2784,27 +2784,27 @@ void AttLineRend::ResetLineRend()
     m_lstartsymSize = 0;
 }
 
-bool AttLineRend::ReadLineRend(pugi::xml_node element)
+bool AttLineRend::ReadLineRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lendsym")) {
-        this->SetLendsym(StrToLinestartendsymbol(element.attribute("lendsym").value()));
-        element.remove_attribute("lendsym");
+    if (pugi::xml_attribute attribute = element.attribute("lendsym")) {
+        this->SetLendsym(StrToLinestartendsymbol(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lendsym.size")) {
-        this->SetLendsymSize(StrToInt(element.attribute("lendsym.size").value()));
-        element.remove_attribute("lendsym.size");
+    if (pugi::xml_attribute attribute = element.attribute("lendsym.size")) {
+        this->SetLendsymSize(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lstartsym")) {
-        this->SetLstartsym(StrToLinestartendsymbol(element.attribute("lstartsym").value()));
-        element.remove_attribute("lstartsym");
+    if (pugi::xml_attribute attribute = element.attribute("lstartsym")) {
+        this->SetLstartsym(StrToLinestartendsymbol(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lstartsym.size")) {
-        this->SetLstartsymSize(StrToInt(element.attribute("lstartsym.size").value()));
-        element.remove_attribute("lstartsym.size");
+    if (pugi::xml_attribute attribute = element.attribute("lstartsym.size")) {
+        this->SetLstartsymSize(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2874,22 +2874,22 @@ void AttLineRendBase::ResetLineRendBase()
     m_lwidth = data_LINEWIDTH();
 }
 
-bool AttLineRendBase::ReadLineRendBase(pugi::xml_node element)
+bool AttLineRendBase::ReadLineRendBase(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        element.remove_attribute("lform");
+    if (pugi::xml_attribute attribute = element.attribute("lform")) {
+        this->SetLform(StrToLineform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lsegs")) {
-        this->SetLsegs(StrToInt(element.attribute("lsegs").value()));
-        element.remove_attribute("lsegs");
+    if (pugi::xml_attribute attribute = element.attribute("lsegs")) {
+        this->SetLsegs(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToLinewidth(element.attribute("lwidth").value()));
-        element.remove_attribute("lwidth");
+    if (pugi::xml_attribute attribute = element.attribute("lwidth")) {
+        this->SetLwidth(StrToLinewidth(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2955,47 +2955,47 @@ void AttLinking::ResetLinking()
     m_synch = "";
 }
 
-bool AttLinking::ReadLinking(pugi::xml_node element)
+bool AttLinking::ReadLinking(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("copyof")) {
-        this->SetCopyof(StrToStr(element.attribute("copyof").value()));
-        element.remove_attribute("copyof");
+    if (pugi::xml_attribute attribute = element.attribute("copyof")) {
+        this->SetCopyof(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("corresp")) {
-        this->SetCorresp(StrToStr(element.attribute("corresp").value()));
-        element.remove_attribute("corresp");
+    if (pugi::xml_attribute attribute = element.attribute("corresp")) {
+        this->SetCorresp(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("follows")) {
-        this->SetFollows(StrToStr(element.attribute("follows").value()));
-        element.remove_attribute("follows");
+    if (pugi::xml_attribute attribute = element.attribute("follows")) {
+        this->SetFollows(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("next")) {
-        this->SetNext(StrToStr(element.attribute("next").value()));
-        element.remove_attribute("next");
+    if (pugi::xml_attribute attribute = element.attribute("next")) {
+        this->SetNext(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("precedes")) {
-        this->SetPrecedes(StrToStr(element.attribute("precedes").value()));
-        element.remove_attribute("precedes");
+    if (pugi::xml_attribute attribute = element.attribute("precedes")) {
+        this->SetPrecedes(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("prev")) {
-        this->SetPrev(StrToStr(element.attribute("prev").value()));
-        element.remove_attribute("prev");
+    if (pugi::xml_attribute attribute = element.attribute("prev")) {
+        this->SetPrev(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("sameas")) {
-        this->SetSameas(StrToStr(element.attribute("sameas").value()));
-        element.remove_attribute("sameas");
+    if (pugi::xml_attribute attribute = element.attribute("sameas")) {
+        this->SetSameas(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("synch")) {
-        this->SetSynch(StrToStr(element.attribute("synch").value()));
-        element.remove_attribute("synch");
+    if (pugi::xml_attribute attribute = element.attribute("synch")) {
+        this->SetSynch(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3104,37 +3104,37 @@ void AttLyricStyle::ResetLyricStyle()
     m_lyricWeight = FONTWEIGHT_NONE;
 }
 
-bool AttLyricStyle::ReadLyricStyle(pugi::xml_node element)
+bool AttLyricStyle::ReadLyricStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lyric.align")) {
-        this->SetLyricAlign(StrToMeasurementrel(element.attribute("lyric.align").value()));
-        element.remove_attribute("lyric.align");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.align")) {
+        this->SetLyricAlign(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.fam")) {
-        this->SetLyricFam(StrToStr(element.attribute("lyric.fam").value()));
-        element.remove_attribute("lyric.fam");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.fam")) {
+        this->SetLyricFam(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.name")) {
-        this->SetLyricName(StrToStr(element.attribute("lyric.name").value()));
-        element.remove_attribute("lyric.name");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.name")) {
+        this->SetLyricName(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.size")) {
-        this->SetLyricSize(StrToFontsize(element.attribute("lyric.size").value()));
-        element.remove_attribute("lyric.size");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.size")) {
+        this->SetLyricSize(StrToFontsize(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.style")) {
-        this->SetLyricStyle(StrToFontstyle(element.attribute("lyric.style").value()));
-        element.remove_attribute("lyric.style");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.style")) {
+        this->SetLyricStyle(StrToFontstyle(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.weight")) {
-        this->SetLyricWeight(StrToFontweight(element.attribute("lyric.weight").value()));
-        element.remove_attribute("lyric.weight");
+    if (pugi::xml_attribute attribute = element.attribute("lyric.weight")) {
+        this->SetLyricWeight(StrToFontweight(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3220,12 +3220,12 @@ void AttMeasureNumbers::ResetMeasureNumbers()
     m_mnumVisible = BOOLEAN_NONE;
 }
 
-bool AttMeasureNumbers::ReadMeasureNumbers(pugi::xml_node element)
+bool AttMeasureNumbers::ReadMeasureNumbers(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mnum.visible")) {
-        this->SetMnumVisible(StrToBoolean(element.attribute("mnum.visible").value()));
-        element.remove_attribute("mnum.visible");
+    if (pugi::xml_attribute attribute = element.attribute("mnum.visible")) {
+        this->SetMnumVisible(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3266,12 +3266,12 @@ void AttMeasurement::ResetMeasurement()
     m_unit = "";
 }
 
-bool AttMeasurement::ReadMeasurement(pugi::xml_node element)
+bool AttMeasurement::ReadMeasurement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToStr(element.attribute("unit").value()));
-        element.remove_attribute("unit");
+    if (pugi::xml_attribute attribute = element.attribute("unit")) {
+        this->SetUnit(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3314,22 +3314,22 @@ void AttMediaBounds::ResetMediaBounds()
     m_betype = BETYPE_NONE;
 }
 
-bool AttMediaBounds::ReadMediaBounds(pugi::xml_node element)
+bool AttMediaBounds::ReadMediaBounds(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("begin")) {
-        this->SetBegin(StrToStr(element.attribute("begin").value()));
-        element.remove_attribute("begin");
+    if (pugi::xml_attribute attribute = element.attribute("begin")) {
+        this->SetBegin(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("end")) {
-        this->SetEnd(StrToStr(element.attribute("end").value()));
-        element.remove_attribute("end");
+    if (pugi::xml_attribute attribute = element.attribute("end")) {
+        this->SetEnd(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("betype")) {
-        this->SetBetype(StrToBetype(element.attribute("betype").value()));
-        element.remove_attribute("betype");
+    if (pugi::xml_attribute attribute = element.attribute("betype")) {
+        this->SetBetype(StrToBetype(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3388,12 +3388,12 @@ void AttMedium::ResetMedium()
     m_medium = "";
 }
 
-bool AttMedium::ReadMedium(pugi::xml_node element)
+bool AttMedium::ReadMedium(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("medium")) {
-        this->SetMedium(StrToStr(element.attribute("medium").value()));
-        element.remove_attribute("medium");
+    if (pugi::xml_attribute attribute = element.attribute("medium")) {
+        this->SetMedium(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3434,12 +3434,12 @@ void AttMeiVersion::ResetMeiVersion()
     m_meiversion = meiVersion_MEIVERSION_NONE;
 }
 
-bool AttMeiVersion::ReadMeiVersion(pugi::xml_node element)
+bool AttMeiVersion::ReadMeiVersion(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meiversion")) {
-        this->SetMeiversion(StrToMeiVersionMeiversion(element.attribute("meiversion").value()));
-        element.remove_attribute("meiversion");
+    if (pugi::xml_attribute attribute = element.attribute("meiversion")) {
+        this->SetMeiversion(StrToMeiVersionMeiversion(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3481,17 +3481,17 @@ void AttMensurLog::ResetMensurLog()
     m_sign = MENSURATIONSIGN_NONE;
 }
 
-bool AttMensurLog::ReadMensurLog(pugi::xml_node element)
+bool AttMensurLog::ReadMensurLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dot")) {
-        this->SetDot(StrToBoolean(element.attribute("dot").value()));
-        element.remove_attribute("dot");
+    if (pugi::xml_attribute attribute = element.attribute("dot")) {
+        this->SetDot(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("sign")) {
-        this->SetSign(StrToMensurationsign(element.attribute("sign").value()));
-        element.remove_attribute("sign");
+    if (pugi::xml_attribute attribute = element.attribute("sign")) {
+        this->SetSign(StrToMensurationsign(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3541,12 +3541,12 @@ void AttMetadataPointing::ResetMetadataPointing()
     m_decls = "";
 }
 
-bool AttMetadataPointing::ReadMetadataPointing(pugi::xml_node element)
+bool AttMetadataPointing::ReadMetadataPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("decls")) {
-        this->SetDecls(StrToStr(element.attribute("decls").value()));
-        element.remove_attribute("decls");
+    if (pugi::xml_attribute attribute = element.attribute("decls")) {
+        this->SetDecls(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3587,12 +3587,12 @@ void AttMeterConformance::ResetMeterConformance()
     m_metcon = meterConformance_METCON_NONE;
 }
 
-bool AttMeterConformance::ReadMeterConformance(pugi::xml_node element)
+bool AttMeterConformance::ReadMeterConformance(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToMeterConformanceMetcon(element.attribute("metcon").value()));
-        element.remove_attribute("metcon");
+    if (pugi::xml_attribute attribute = element.attribute("metcon")) {
+        this->SetMetcon(StrToMeterConformanceMetcon(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3634,17 +3634,17 @@ void AttMeterConformanceBar::ResetMeterConformanceBar()
     m_control = BOOLEAN_NONE;
 }
 
-bool AttMeterConformanceBar::ReadMeterConformanceBar(pugi::xml_node element)
+bool AttMeterConformanceBar::ReadMeterConformanceBar(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToBoolean(element.attribute("metcon").value()));
-        element.remove_attribute("metcon");
+    if (pugi::xml_attribute attribute = element.attribute("metcon")) {
+        this->SetMetcon(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("control")) {
-        this->SetControl(StrToBoolean(element.attribute("control").value()));
-        element.remove_attribute("control");
+    if (pugi::xml_attribute attribute = element.attribute("control")) {
+        this->SetControl(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3696,22 +3696,22 @@ void AttMeterSigLog::ResetMeterSigLog()
     m_unit = 0;
 }
 
-bool AttMeterSigLog::ReadMeterSigLog(pugi::xml_node element)
+bool AttMeterSigLog::ReadMeterSigLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToInt(element.attribute("count").value()));
-        element.remove_attribute("count");
+    if (pugi::xml_attribute attribute = element.attribute("count")) {
+        this->SetCount(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("sym")) {
-        this->SetSym(StrToMetersign(element.attribute("sym").value()));
-        element.remove_attribute("sym");
+    if (pugi::xml_attribute attribute = element.attribute("sym")) {
+        this->SetSym(StrToMetersign(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToInt(element.attribute("unit").value()));
-        element.remove_attribute("unit");
+    if (pugi::xml_attribute attribute = element.attribute("unit")) {
+        this->SetUnit(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3772,22 +3772,22 @@ void AttMeterSigDefaultLog::ResetMeterSigDefaultLog()
     m_meterSym = METERSIGN_NONE;
 }
 
-bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(pugi::xml_node element)
+bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.count")) {
-        this->SetMeterCount(StrToInt(element.attribute("meter.count").value()));
-        element.remove_attribute("meter.count");
+    if (pugi::xml_attribute attribute = element.attribute("meter.count")) {
+        this->SetMeterCount(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("meter.unit")) {
-        this->SetMeterUnit(StrToInt(element.attribute("meter.unit").value()));
-        element.remove_attribute("meter.unit");
+    if (pugi::xml_attribute attribute = element.attribute("meter.unit")) {
+        this->SetMeterUnit(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("meter.sym")) {
-        this->SetMeterSym(StrToMetersign(element.attribute("meter.sym").value()));
-        element.remove_attribute("meter.sym");
+    if (pugi::xml_attribute attribute = element.attribute("meter.sym")) {
+        this->SetMeterSym(StrToMetersign(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3848,22 +3848,22 @@ void AttMmTempo::ResetMmTempo()
     m_mmDots = 0;
 }
 
-bool AttMmTempo::ReadMmTempo(pugi::xml_node element)
+bool AttMmTempo::ReadMmTempo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mm")) {
-        this->SetMm(StrToInt(element.attribute("mm").value()));
-        element.remove_attribute("mm");
+    if (pugi::xml_attribute attribute = element.attribute("mm")) {
+        this->SetMm(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mm.unit")) {
-        this->SetMmUnit(StrToDuration(element.attribute("mm.unit").value()));
-        element.remove_attribute("mm.unit");
+    if (pugi::xml_attribute attribute = element.attribute("mm.unit")) {
+        this->SetMmUnit(StrToDuration(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mm.dots")) {
-        this->SetMmDots(StrToInt(element.attribute("mm.dots").value()));
-        element.remove_attribute("mm.dots");
+    if (pugi::xml_attribute attribute = element.attribute("mm.dots")) {
+        this->SetMmDots(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3922,12 +3922,12 @@ void AttMultinumMeasures::ResetMultinumMeasures()
     m_multiNumber = BOOLEAN_NONE;
 }
 
-bool AttMultinumMeasures::ReadMultinumMeasures(pugi::xml_node element)
+bool AttMultinumMeasures::ReadMultinumMeasures(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("multi.number")) {
-        this->SetMultiNumber(StrToBoolean(element.attribute("multi.number").value()));
-        element.remove_attribute("multi.number");
+    if (pugi::xml_attribute attribute = element.attribute("multi.number")) {
+        this->SetMultiNumber(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3968,12 +3968,12 @@ void AttNInteger::ResetNInteger()
     m_n = -1;
 }
 
-bool AttNInteger::ReadNInteger(pugi::xml_node element)
+bool AttNInteger::ReadNInteger(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToInt(element.attribute("n").value()));
-        element.remove_attribute("n");
+    if (pugi::xml_attribute attribute = element.attribute("n")) {
+        this->SetN(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4014,12 +4014,12 @@ void AttNNumberLike::ResetNNumberLike()
     m_n = "";
 }
 
-bool AttNNumberLike::ReadNNumberLike(pugi::xml_node element)
+bool AttNNumberLike::ReadNNumberLike(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToStr(element.attribute("n").value()));
-        element.remove_attribute("n");
+    if (pugi::xml_attribute attribute = element.attribute("n")) {
+        this->SetN(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4061,17 +4061,17 @@ void AttName::ResetName()
     m_role = "";
 }
 
-bool AttName::ReadName(pugi::xml_node element)
+bool AttName::ReadName(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("nymref")) {
-        this->SetNymref(StrToStr(element.attribute("nymref").value()));
-        element.remove_attribute("nymref");
+    if (pugi::xml_attribute attribute = element.attribute("nymref")) {
+        this->SetNymref(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("role")) {
-        this->SetRole(StrToStr(element.attribute("role").value()));
-        element.remove_attribute("role");
+    if (pugi::xml_attribute attribute = element.attribute("role")) {
+        this->SetRole(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4122,17 +4122,17 @@ void AttNotationStyle::ResetNotationStyle()
     m_musicSize = data_FONTSIZE();
 }
 
-bool AttNotationStyle::ReadNotationStyle(pugi::xml_node element)
+bool AttNotationStyle::ReadNotationStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("music.name")) {
-        this->SetMusicName(StrToStr(element.attribute("music.name").value()));
-        element.remove_attribute("music.name");
+    if (pugi::xml_attribute attribute = element.attribute("music.name")) {
+        this->SetMusicName(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("music.size")) {
-        this->SetMusicSize(StrToFontsize(element.attribute("music.size").value()));
-        element.remove_attribute("music.size");
+    if (pugi::xml_attribute attribute = element.attribute("music.size")) {
+        this->SetMusicSize(StrToFontsize(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4190,52 +4190,52 @@ void AttNoteHeads::ResetNoteHeads()
     m_headVisible = BOOLEAN_NONE;
 }
 
-bool AttNoteHeads::ReadNoteHeads(pugi::xml_node element)
+bool AttNoteHeads::ReadNoteHeads(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("head.altsym")) {
-        this->SetHeadAltsym(StrToStr(element.attribute("head.altsym").value()));
-        element.remove_attribute("head.altsym");
+    if (pugi::xml_attribute attribute = element.attribute("head.altsym")) {
+        this->SetHeadAltsym(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.auth")) {
-        this->SetHeadAuth(StrToStr(element.attribute("head.auth").value()));
-        element.remove_attribute("head.auth");
+    if (pugi::xml_attribute attribute = element.attribute("head.auth")) {
+        this->SetHeadAuth(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.color")) {
-        this->SetHeadColor(StrToStr(element.attribute("head.color").value()));
-        element.remove_attribute("head.color");
+    if (pugi::xml_attribute attribute = element.attribute("head.color")) {
+        this->SetHeadColor(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.fill")) {
-        this->SetHeadFill(StrToFill(element.attribute("head.fill").value()));
-        element.remove_attribute("head.fill");
+    if (pugi::xml_attribute attribute = element.attribute("head.fill")) {
+        this->SetHeadFill(StrToFill(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.fillcolor")) {
-        this->SetHeadFillcolor(StrToStr(element.attribute("head.fillcolor").value()));
-        element.remove_attribute("head.fillcolor");
+    if (pugi::xml_attribute attribute = element.attribute("head.fillcolor")) {
+        this->SetHeadFillcolor(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.mod")) {
-        this->SetHeadMod(StrToNoteheadmodifier(element.attribute("head.mod").value()));
-        element.remove_attribute("head.mod");
+    if (pugi::xml_attribute attribute = element.attribute("head.mod")) {
+        this->SetHeadMod(StrToNoteheadmodifier(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.rotation")) {
-        this->SetHeadRotation(StrToRotation(element.attribute("head.rotation").value()));
-        element.remove_attribute("head.rotation");
+    if (pugi::xml_attribute attribute = element.attribute("head.rotation")) {
+        this->SetHeadRotation(StrToRotation(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.shape")) {
-        this->SetHeadShape(StrToHeadshape(element.attribute("head.shape").value()));
-        element.remove_attribute("head.shape");
+    if (pugi::xml_attribute attribute = element.attribute("head.shape")) {
+        this->SetHeadShape(StrToHeadshape(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("head.visible")) {
-        this->SetHeadVisible(StrToBoolean(element.attribute("head.visible").value()));
-        element.remove_attribute("head.visible");
+    if (pugi::xml_attribute attribute = element.attribute("head.visible")) {
+        this->SetHeadVisible(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4348,12 +4348,12 @@ void AttOctave::ResetOctave()
     m_oct = -127;
 }
 
-bool AttOctave::ReadOctave(pugi::xml_node element)
+bool AttOctave::ReadOctave(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToOctave(element.attribute("oct").value()));
-        element.remove_attribute("oct");
+    if (pugi::xml_attribute attribute = element.attribute("oct")) {
+        this->SetOct(StrToOctave(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4394,12 +4394,12 @@ void AttOctaveDefault::ResetOctaveDefault()
     m_octDefault = -127;
 }
 
-bool AttOctaveDefault::ReadOctaveDefault(pugi::xml_node element)
+bool AttOctaveDefault::ReadOctaveDefault(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.default")) {
-        this->SetOctDefault(StrToOctave(element.attribute("oct.default").value()));
-        element.remove_attribute("oct.default");
+    if (pugi::xml_attribute attribute = element.attribute("oct.default")) {
+        this->SetOctDefault(StrToOctave(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4441,17 +4441,17 @@ void AttOctaveDisplacement::ResetOctaveDisplacement()
     m_disPlace = STAFFREL_basic_NONE;
 }
 
-bool AttOctaveDisplacement::ReadOctaveDisplacement(pugi::xml_node element)
+bool AttOctaveDisplacement::ReadOctaveDisplacement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dis")) {
-        this->SetDis(StrToOctaveDis(element.attribute("dis").value()));
-        element.remove_attribute("dis");
+    if (pugi::xml_attribute attribute = element.attribute("dis")) {
+        this->SetDis(StrToOctaveDis(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("dis.place")) {
-        this->SetDisPlace(StrToStaffrelBasic(element.attribute("dis.place").value()));
-        element.remove_attribute("dis.place");
+    if (pugi::xml_attribute attribute = element.attribute("dis.place")) {
+        this->SetDisPlace(StrToStaffrelBasic(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4501,12 +4501,12 @@ void AttOneLineStaff::ResetOneLineStaff()
     m_ontheline = BOOLEAN_NONE;
 }
 
-bool AttOneLineStaff::ReadOneLineStaff(pugi::xml_node element)
+bool AttOneLineStaff::ReadOneLineStaff(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ontheline")) {
-        this->SetOntheline(StrToBoolean(element.attribute("ontheline").value()));
-        element.remove_attribute("ontheline");
+    if (pugi::xml_attribute attribute = element.attribute("ontheline")) {
+        this->SetOntheline(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4547,12 +4547,12 @@ void AttOptimization::ResetOptimization()
     m_optimize = BOOLEAN_NONE;
 }
 
-bool AttOptimization::ReadOptimization(pugi::xml_node element)
+bool AttOptimization::ReadOptimization(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("optimize")) {
-        this->SetOptimize(StrToBoolean(element.attribute("optimize").value()));
-        element.remove_attribute("optimize");
+    if (pugi::xml_attribute attribute = element.attribute("optimize")) {
+        this->SetOptimize(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4593,12 +4593,12 @@ void AttOriginLayerIdent::ResetOriginLayerIdent()
     m_originLayer = "";
 }
 
-bool AttOriginLayerIdent::ReadOriginLayerIdent(pugi::xml_node element)
+bool AttOriginLayerIdent::ReadOriginLayerIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.layer")) {
-        this->SetOriginLayer(StrToStr(element.attribute("origin.layer").value()));
-        element.remove_attribute("origin.layer");
+    if (pugi::xml_attribute attribute = element.attribute("origin.layer")) {
+        this->SetOriginLayer(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4639,12 +4639,12 @@ void AttOriginStaffIdent::ResetOriginStaffIdent()
     m_originStaff = "";
 }
 
-bool AttOriginStaffIdent::ReadOriginStaffIdent(pugi::xml_node element)
+bool AttOriginStaffIdent::ReadOriginStaffIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.staff")) {
-        this->SetOriginStaff(StrToStr(element.attribute("origin.staff").value()));
-        element.remove_attribute("origin.staff");
+    if (pugi::xml_attribute attribute = element.attribute("origin.staff")) {
+        this->SetOriginStaff(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4686,17 +4686,17 @@ void AttOriginStartEndId::ResetOriginStartEndId()
     m_originEndid = "";
 }
 
-bool AttOriginStartEndId::ReadOriginStartEndId(pugi::xml_node element)
+bool AttOriginStartEndId::ReadOriginStartEndId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.startid")) {
-        this->SetOriginStartid(StrToStr(element.attribute("origin.startid").value()));
-        element.remove_attribute("origin.startid");
+    if (pugi::xml_attribute attribute = element.attribute("origin.startid")) {
+        this->SetOriginStartid(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("origin.endid")) {
-        this->SetOriginEndid(StrToStr(element.attribute("origin.endid").value()));
-        element.remove_attribute("origin.endid");
+    if (pugi::xml_attribute attribute = element.attribute("origin.endid")) {
+        this->SetOriginEndid(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4747,17 +4747,17 @@ void AttOriginTimestampLogical::ResetOriginTimestampLogical()
     m_originTstamp2 = std::make_pair(-1, -1.0);
 }
 
-bool AttOriginTimestampLogical::ReadOriginTimestampLogical(pugi::xml_node element)
+bool AttOriginTimestampLogical::ReadOriginTimestampLogical(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.tstamp")) {
-        this->SetOriginTstamp(StrToMeasurebeat(element.attribute("origin.tstamp").value()));
-        element.remove_attribute("origin.tstamp");
+    if (pugi::xml_attribute attribute = element.attribute("origin.tstamp")) {
+        this->SetOriginTstamp(StrToMeasurebeat(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("origin.tstamp2")) {
-        this->SetOriginTstamp2(StrToMeasurebeat(element.attribute("origin.tstamp2").value()));
-        element.remove_attribute("origin.tstamp2");
+    if (pugi::xml_attribute attribute = element.attribute("origin.tstamp2")) {
+        this->SetOriginTstamp2(StrToMeasurebeat(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4814,47 +4814,47 @@ void AttPages::ResetPages()
     m_pageScale = "";
 }
 
-bool AttPages::ReadPages(pugi::xml_node element)
+bool AttPages::ReadPages(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("page.height")) {
-        this->SetPageHeight(StrToMeasurementabs(element.attribute("page.height").value()));
-        element.remove_attribute("page.height");
+    if (pugi::xml_attribute attribute = element.attribute("page.height")) {
+        this->SetPageHeight(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.width")) {
-        this->SetPageWidth(StrToMeasurementabs(element.attribute("page.width").value()));
-        element.remove_attribute("page.width");
+    if (pugi::xml_attribute attribute = element.attribute("page.width")) {
+        this->SetPageWidth(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.topmar")) {
-        this->SetPageTopmar(StrToMeasurementabs(element.attribute("page.topmar").value()));
-        element.remove_attribute("page.topmar");
+    if (pugi::xml_attribute attribute = element.attribute("page.topmar")) {
+        this->SetPageTopmar(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.botmar")) {
-        this->SetPageBotmar(StrToMeasurementabs(element.attribute("page.botmar").value()));
-        element.remove_attribute("page.botmar");
+    if (pugi::xml_attribute attribute = element.attribute("page.botmar")) {
+        this->SetPageBotmar(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.leftmar")) {
-        this->SetPageLeftmar(StrToMeasurementabs(element.attribute("page.leftmar").value()));
-        element.remove_attribute("page.leftmar");
+    if (pugi::xml_attribute attribute = element.attribute("page.leftmar")) {
+        this->SetPageLeftmar(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.rightmar")) {
-        this->SetPageRightmar(StrToMeasurementabs(element.attribute("page.rightmar").value()));
-        element.remove_attribute("page.rightmar");
+    if (pugi::xml_attribute attribute = element.attribute("page.rightmar")) {
+        this->SetPageRightmar(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.panels")) {
-        this->SetPagePanels(StrToStr(element.attribute("page.panels").value()));
-        element.remove_attribute("page.panels");
+    if (pugi::xml_attribute attribute = element.attribute("page.panels")) {
+        this->SetPagePanels(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("page.scale")) {
-        this->SetPageScale(StrToStr(element.attribute("page.scale").value()));
-        element.remove_attribute("page.scale");
+    if (pugi::xml_attribute attribute = element.attribute("page.scale")) {
+        this->SetPageScale(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4959,17 +4959,17 @@ void AttPartIdent::ResetPartIdent()
     m_partstaff = "";
 }
 
-bool AttPartIdent::ReadPartIdent(pugi::xml_node element)
+bool AttPartIdent::ReadPartIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("part")) {
-        this->SetPart(StrToStr(element.attribute("part").value()));
-        element.remove_attribute("part");
+    if (pugi::xml_attribute attribute = element.attribute("part")) {
+        this->SetPart(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("partstaff")) {
-        this->SetPartstaff(StrToStr(element.attribute("partstaff").value()));
-        element.remove_attribute("partstaff");
+    if (pugi::xml_attribute attribute = element.attribute("partstaff")) {
+        this->SetPartstaff(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5019,12 +5019,12 @@ void AttPitch::ResetPitch()
     m_pname = PITCHNAME_NONE;
 }
 
-bool AttPitch::ReadPitch(pugi::xml_node element)
+bool AttPitch::ReadPitch(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pname")) {
-        this->SetPname(StrToPitchname(element.attribute("pname").value()));
-        element.remove_attribute("pname");
+    if (pugi::xml_attribute attribute = element.attribute("pname")) {
+        this->SetPname(StrToPitchname(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5065,12 +5065,12 @@ void AttPlacement::ResetPlacement()
     m_place = data_STAFFREL();
 }
 
-bool AttPlacement::ReadPlacement(pugi::xml_node element)
+bool AttPlacement::ReadPlacement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        element.remove_attribute("place");
+    if (pugi::xml_attribute attribute = element.attribute("place")) {
+        this->SetPlace(StrToStaffrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5111,12 +5111,12 @@ void AttPlist::ResetPlist()
     m_plist = std::vector<std::string>();
 }
 
-bool AttPlist::ReadPlist(pugi::xml_node element)
+bool AttPlist::ReadPlist(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("plist")) {
-        this->SetPlist(StrToXsdAnyURIList(element.attribute("plist").value()));
-        element.remove_attribute("plist");
+    if (pugi::xml_attribute attribute = element.attribute("plist")) {
+        this->SetPlist(StrToXsdAnyURIList(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5161,32 +5161,32 @@ void AttPointing::ResetPointing()
     m_targettype = "";
 }
 
-bool AttPointing::ReadPointing(pugi::xml_node element)
+bool AttPointing::ReadPointing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xlink:actuate")) {
-        this->SetActuate(StrToStr(element.attribute("xlink:actuate").value()));
-        element.remove_attribute("xlink:actuate");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:actuate")) {
+        this->SetActuate(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:role")) {
-        this->SetRole(StrToStr(element.attribute("xlink:role").value()));
-        element.remove_attribute("xlink:role");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:role")) {
+        this->SetRole(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:show")) {
-        this->SetShow(StrToStr(element.attribute("xlink:show").value()));
-        element.remove_attribute("xlink:show");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:show")) {
+        this->SetShow(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:target")) {
-        this->SetTarget(StrToStr(element.attribute("xlink:target").value()));
-        element.remove_attribute("xlink:target");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:target")) {
+        this->SetTarget(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:targettype")) {
-        this->SetTargettype(StrToStr(element.attribute("xlink:targettype").value()));
-        element.remove_attribute("xlink:targettype");
+    if (pugi::xml_attribute attribute = element.attribute("xlink:targettype")) {
+        this->SetTargettype(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5263,12 +5263,12 @@ void AttQuantity::ResetQuantity()
     m_quantity = 0.0;
 }
 
-bool AttQuantity::ReadQuantity(pugi::xml_node element)
+bool AttQuantity::ReadQuantity(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("quantity")) {
-        this->SetQuantity(StrToDbl(element.attribute("quantity").value()));
-        element.remove_attribute("quantity");
+    if (pugi::xml_attribute attribute = element.attribute("quantity")) {
+        this->SetQuantity(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5313,32 +5313,32 @@ void AttRanging::ResetRanging()
     m_confidence = 0.0;
 }
 
-bool AttRanging::ReadRanging(pugi::xml_node element)
+bool AttRanging::ReadRanging(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("atleast")) {
-        this->SetAtleast(StrToDbl(element.attribute("atleast").value()));
-        element.remove_attribute("atleast");
+    if (pugi::xml_attribute attribute = element.attribute("atleast")) {
+        this->SetAtleast(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("atmost")) {
-        this->SetAtmost(StrToDbl(element.attribute("atmost").value()));
-        element.remove_attribute("atmost");
+    if (pugi::xml_attribute attribute = element.attribute("atmost")) {
+        this->SetAtmost(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("min")) {
-        this->SetMin(StrToDbl(element.attribute("min").value()));
-        element.remove_attribute("min");
+    if (pugi::xml_attribute attribute = element.attribute("min")) {
+        this->SetMin(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("max")) {
-        this->SetMax(StrToDbl(element.attribute("max").value()));
-        element.remove_attribute("max");
+    if (pugi::xml_attribute attribute = element.attribute("max")) {
+        this->SetMax(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("confidence")) {
-        this->SetConfidence(StrToDbl(element.attribute("confidence").value()));
-        element.remove_attribute("confidence");
+    if (pugi::xml_attribute attribute = element.attribute("confidence")) {
+        this->SetConfidence(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5415,12 +5415,12 @@ void AttResponsibility::ResetResponsibility()
     m_resp = "";
 }
 
-bool AttResponsibility::ReadResponsibility(pugi::xml_node element)
+bool AttResponsibility::ReadResponsibility(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("resp")) {
-        this->SetResp(StrToStr(element.attribute("resp").value()));
-        element.remove_attribute("resp");
+    if (pugi::xml_attribute attribute = element.attribute("resp")) {
+        this->SetResp(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5461,12 +5461,12 @@ void AttScalable::ResetScalable()
     m_scale = -1.0;
 }
 
-bool AttScalable::ReadScalable(pugi::xml_node element)
+bool AttScalable::ReadScalable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("scale")) {
-        this->SetScale(StrToPercent(element.attribute("scale").value()));
-        element.remove_attribute("scale");
+    if (pugi::xml_attribute attribute = element.attribute("scale")) {
+        this->SetScale(StrToPercent(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5507,12 +5507,12 @@ void AttSequence::ResetSequence()
     m_seq = 0;
 }
 
-bool AttSequence::ReadSequence(pugi::xml_node element)
+bool AttSequence::ReadSequence(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("seq")) {
-        this->SetSeq(StrToInt(element.attribute("seq").value()));
-        element.remove_attribute("seq");
+    if (pugi::xml_attribute attribute = element.attribute("seq")) {
+        this->SetSeq(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5553,12 +5553,12 @@ void AttSlashCount::ResetSlashCount()
     m_slash = 0;
 }
 
-bool AttSlashCount::ReadSlashCount(pugi::xml_node element)
+bool AttSlashCount::ReadSlashCount(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToInt(element.attribute("slash").value()));
-        element.remove_attribute("slash");
+    if (pugi::xml_attribute attribute = element.attribute("slash")) {
+        this->SetSlash(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5599,12 +5599,12 @@ void AttSlurPresent::ResetSlurPresent()
     m_slur = "";
 }
 
-bool AttSlurPresent::ReadSlurPresent(pugi::xml_node element)
+bool AttSlurPresent::ReadSlurPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur")) {
-        this->SetSlur(StrToStr(element.attribute("slur").value()));
-        element.remove_attribute("slur");
+    if (pugi::xml_attribute attribute = element.attribute("slur")) {
+        this->SetSlur(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5645,12 +5645,12 @@ void AttSource::ResetSource()
     m_source = "";
 }
 
-bool AttSource::ReadSource(pugi::xml_node element)
+bool AttSource::ReadSource(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("source")) {
-        this->SetSource(StrToStr(element.attribute("source").value()));
-        element.remove_attribute("source");
+    if (pugi::xml_attribute attribute = element.attribute("source")) {
+        this->SetSource(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5694,27 +5694,27 @@ void AttSpacing::ResetSpacing()
     m_spacingSystem = VRV_UNSET;
 }
 
-bool AttSpacing::ReadSpacing(pugi::xml_node element)
+bool AttSpacing::ReadSpacing(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("spacing.packexp")) {
-        this->SetSpacingPackexp(StrToDbl(element.attribute("spacing.packexp").value()));
-        element.remove_attribute("spacing.packexp");
+    if (pugi::xml_attribute attribute = element.attribute("spacing.packexp")) {
+        this->SetSpacingPackexp(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.packfact")) {
-        this->SetSpacingPackfact(StrToDbl(element.attribute("spacing.packfact").value()));
-        element.remove_attribute("spacing.packfact");
+    if (pugi::xml_attribute attribute = element.attribute("spacing.packfact")) {
+        this->SetSpacingPackfact(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.staff")) {
-        this->SetSpacingStaff(StrToMeasurementrel(element.attribute("spacing.staff").value()));
-        element.remove_attribute("spacing.staff");
+    if (pugi::xml_attribute attribute = element.attribute("spacing.staff")) {
+        this->SetSpacingStaff(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.system")) {
-        this->SetSpacingSystem(StrToMeasurementrel(element.attribute("spacing.system").value()));
-        element.remove_attribute("spacing.system");
+    if (pugi::xml_attribute attribute = element.attribute("spacing.system")) {
+        this->SetSpacingSystem(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5782,12 +5782,12 @@ void AttStaffLog::ResetStaffLog()
     m_def = "";
 }
 
-bool AttStaffLog::ReadStaffLog(pugi::xml_node element)
+bool AttStaffLog::ReadStaffLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        element.remove_attribute("def");
+    if (pugi::xml_attribute attribute = element.attribute("def")) {
+        this->SetDef(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5828,12 +5828,12 @@ void AttStaffDefLog::ResetStaffDefLog()
     m_lines = 0;
 }
 
-bool AttStaffDefLog::ReadStaffDefLog(pugi::xml_node element)
+bool AttStaffDefLog::ReadStaffDefLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lines")) {
-        this->SetLines(StrToInt(element.attribute("lines").value()));
-        element.remove_attribute("lines");
+    if (pugi::xml_attribute attribute = element.attribute("lines")) {
+        this->SetLines(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5874,12 +5874,12 @@ void AttStaffGroupingSym::ResetStaffGroupingSym()
     m_symbol = staffGroupingSym_SYMBOL_NONE;
 }
 
-bool AttStaffGroupingSym::ReadStaffGroupingSym(pugi::xml_node element)
+bool AttStaffGroupingSym::ReadStaffGroupingSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("symbol")) {
-        this->SetSymbol(StrToStaffGroupingSymSymbol(element.attribute("symbol").value()));
-        element.remove_attribute("symbol");
+    if (pugi::xml_attribute attribute = element.attribute("symbol")) {
+        this->SetSymbol(StrToStaffGroupingSymSymbol(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5920,12 +5920,12 @@ void AttStaffIdent::ResetStaffIdent()
     m_staff = std::vector<int>();
 }
 
-bool AttStaffIdent::ReadStaffIdent(pugi::xml_node element)
+bool AttStaffIdent::ReadStaffIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("staff")) {
-        this->SetStaff(StrToXsdPositiveIntegerList(element.attribute("staff").value()));
-        element.remove_attribute("staff");
+    if (pugi::xml_attribute attribute = element.attribute("staff")) {
+        this->SetStaff(StrToXsdPositiveIntegerList(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5968,22 +5968,22 @@ void AttStaffItems::ResetStaffItems()
     m_betweenorder = data_STAFFITEM();
 }
 
-bool AttStaffItems::ReadStaffItems(pugi::xml_node element)
+bool AttStaffItems::ReadStaffItems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("aboveorder")) {
-        this->SetAboveorder(StrToStaffitem(element.attribute("aboveorder").value()));
-        element.remove_attribute("aboveorder");
+    if (pugi::xml_attribute attribute = element.attribute("aboveorder")) {
+        this->SetAboveorder(StrToStaffitem(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("beloworder")) {
-        this->SetBeloworder(StrToStaffitem(element.attribute("beloworder").value()));
-        element.remove_attribute("beloworder");
+    if (pugi::xml_attribute attribute = element.attribute("beloworder")) {
+        this->SetBeloworder(StrToStaffitem(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("betweenorder")) {
-        this->SetBetweenorder(StrToStaffitem(element.attribute("betweenorder").value()));
-        element.remove_attribute("betweenorder");
+    if (pugi::xml_attribute attribute = element.attribute("betweenorder")) {
+        this->SetBetweenorder(StrToStaffitem(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6042,12 +6042,12 @@ void AttStaffLoc::ResetStaffLoc()
     m_loc = VRV_UNSET;
 }
 
-bool AttStaffLoc::ReadStaffLoc(pugi::xml_node element)
+bool AttStaffLoc::ReadStaffLoc(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("loc")) {
-        this->SetLoc(StrToInt(element.attribute("loc").value()));
-        element.remove_attribute("loc");
+    if (pugi::xml_attribute attribute = element.attribute("loc")) {
+        this->SetLoc(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6089,17 +6089,17 @@ void AttStaffLocPitched::ResetStaffLocPitched()
     m_oloc = -127;
 }
 
-bool AttStaffLocPitched::ReadStaffLocPitched(pugi::xml_node element)
+bool AttStaffLocPitched::ReadStaffLocPitched(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ploc")) {
-        this->SetPloc(StrToPitchname(element.attribute("ploc").value()));
-        element.remove_attribute("ploc");
+    if (pugi::xml_attribute attribute = element.attribute("ploc")) {
+        this->SetPloc(StrToPitchname(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("oloc")) {
-        this->SetOloc(StrToOctave(element.attribute("oloc").value()));
-        element.remove_attribute("oloc");
+    if (pugi::xml_attribute attribute = element.attribute("oloc")) {
+        this->SetOloc(StrToOctave(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6149,12 +6149,12 @@ void AttStartEndId::ResetStartEndId()
     m_endid = "";
 }
 
-bool AttStartEndId::ReadStartEndId(pugi::xml_node element)
+bool AttStartEndId::ReadStartEndId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("endid")) {
-        this->SetEndid(StrToStr(element.attribute("endid").value()));
-        element.remove_attribute("endid");
+    if (pugi::xml_attribute attribute = element.attribute("endid")) {
+        this->SetEndid(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6195,12 +6195,12 @@ void AttStartId::ResetStartId()
     m_startid = "";
 }
 
-bool AttStartId::ReadStartId(pugi::xml_node element)
+bool AttStartId::ReadStartId(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startid")) {
-        this->SetStartid(StrToStr(element.attribute("startid").value()));
-        element.remove_attribute("startid");
+    if (pugi::xml_attribute attribute = element.attribute("startid")) {
+        this->SetStartid(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6247,42 +6247,42 @@ void AttStems::ResetStems()
     m_stemY = 0.0;
 }
 
-bool AttStems::ReadStems(pugi::xml_node element)
+bool AttStems::ReadStems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.dir")) {
-        this->SetStemDir(StrToStemdirection(element.attribute("stem.dir").value()));
-        element.remove_attribute("stem.dir");
+    if (pugi::xml_attribute attribute = element.attribute("stem.dir")) {
+        this->SetStemDir(StrToStemdirection(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.len")) {
-        this->SetStemLen(StrToDbl(element.attribute("stem.len").value()));
-        element.remove_attribute("stem.len");
+    if (pugi::xml_attribute attribute = element.attribute("stem.len")) {
+        this->SetStemLen(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.mod")) {
-        this->SetStemMod(StrToStemmodifier(element.attribute("stem.mod").value()));
-        element.remove_attribute("stem.mod");
+    if (pugi::xml_attribute attribute = element.attribute("stem.mod")) {
+        this->SetStemMod(StrToStemmodifier(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.pos")) {
-        this->SetStemPos(StrToStemposition(element.attribute("stem.pos").value()));
-        element.remove_attribute("stem.pos");
+    if (pugi::xml_attribute attribute = element.attribute("stem.pos")) {
+        this->SetStemPos(StrToStemposition(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.visible")) {
-        this->SetStemVisible(StrToBoolean(element.attribute("stem.visible").value()));
-        element.remove_attribute("stem.visible");
+    if (pugi::xml_attribute attribute = element.attribute("stem.visible")) {
+        this->SetStemVisible(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.x")) {
-        this->SetStemX(StrToDbl(element.attribute("stem.x").value()));
-        element.remove_attribute("stem.x");
+    if (pugi::xml_attribute attribute = element.attribute("stem.x")) {
+        this->SetStemX(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("stem.y")) {
-        this->SetStemY(StrToDbl(element.attribute("stem.y").value()));
-        element.remove_attribute("stem.y");
+    if (pugi::xml_attribute attribute = element.attribute("stem.y")) {
+        this->SetStemY(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6378,17 +6378,17 @@ void AttSylLog::ResetSylLog()
     m_wordpos = sylLog_WORDPOS_NONE;
 }
 
-bool AttSylLog::ReadSylLog(pugi::xml_node element)
+bool AttSylLog::ReadSylLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("con")) {
-        this->SetCon(StrToSylLogCon(element.attribute("con").value()));
-        element.remove_attribute("con");
+    if (pugi::xml_attribute attribute = element.attribute("con")) {
+        this->SetCon(StrToSylLogCon(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("wordpos")) {
-        this->SetWordpos(StrToSylLogWordpos(element.attribute("wordpos").value()));
-        element.remove_attribute("wordpos");
+    if (pugi::xml_attribute attribute = element.attribute("wordpos")) {
+        this->SetWordpos(StrToSylLogWordpos(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6438,12 +6438,12 @@ void AttSylText::ResetSylText()
     m_syl = "";
 }
 
-bool AttSylText::ReadSylText(pugi::xml_node element)
+bool AttSylText::ReadSylText(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("syl")) {
-        this->SetSyl(StrToStr(element.attribute("syl").value()));
-        element.remove_attribute("syl");
+    if (pugi::xml_attribute attribute = element.attribute("syl")) {
+        this->SetSyl(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6487,27 +6487,27 @@ void AttSystems::ResetSystems()
     m_systemTopmar = VRV_UNSET;
 }
 
-bool AttSystems::ReadSystems(pugi::xml_node element)
+bool AttSystems::ReadSystems(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("system.leftline")) {
-        this->SetSystemLeftline(StrToBoolean(element.attribute("system.leftline").value()));
-        element.remove_attribute("system.leftline");
+    if (pugi::xml_attribute attribute = element.attribute("system.leftline")) {
+        this->SetSystemLeftline(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("system.leftmar")) {
-        this->SetSystemLeftmar(StrToMeasurementabs(element.attribute("system.leftmar").value()));
-        element.remove_attribute("system.leftmar");
+    if (pugi::xml_attribute attribute = element.attribute("system.leftmar")) {
+        this->SetSystemLeftmar(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("system.rightmar")) {
-        this->SetSystemRightmar(StrToMeasurementabs(element.attribute("system.rightmar").value()));
-        element.remove_attribute("system.rightmar");
+    if (pugi::xml_attribute attribute = element.attribute("system.rightmar")) {
+        this->SetSystemRightmar(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("system.topmar")) {
-        this->SetSystemTopmar(StrToMeasurementabs(element.attribute("system.topmar").value()));
-        element.remove_attribute("system.topmar");
+    if (pugi::xml_attribute attribute = element.attribute("system.topmar")) {
+        this->SetSystemTopmar(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6575,12 +6575,12 @@ void AttTargetEval::ResetTargetEval()
     m_evaluate = targetEval_EVALUATE_NONE;
 }
 
-bool AttTargetEval::ReadTargetEval(pugi::xml_node element)
+bool AttTargetEval::ReadTargetEval(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("evaluate")) {
-        this->SetEvaluate(StrToTargetEvalEvaluate(element.attribute("evaluate").value()));
-        element.remove_attribute("evaluate");
+    if (pugi::xml_attribute attribute = element.attribute("evaluate")) {
+        this->SetEvaluate(StrToTargetEvalEvaluate(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6621,12 +6621,12 @@ void AttTempoLog::ResetTempoLog()
     m_func = tempoLog_FUNC_NONE;
 }
 
-bool AttTempoLog::ReadTempoLog(pugi::xml_node element)
+bool AttTempoLog::ReadTempoLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToTempoLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToTempoLogFunc(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6668,17 +6668,17 @@ void AttTextRendition::ResetTextRendition()
     m_rend = TEXTRENDITION_NONE;
 }
 
-bool AttTextRendition::ReadTextRendition(pugi::xml_node element)
+bool AttTextRendition::ReadTextRendition(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("altrend")) {
-        this->SetAltrend(StrToStr(element.attribute("altrend").value()));
-        element.remove_attribute("altrend");
+    if (pugi::xml_attribute attribute = element.attribute("altrend")) {
+        this->SetAltrend(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("rend")) {
-        this->SetRend(StrToTextrendition(element.attribute("rend").value()));
-        element.remove_attribute("rend");
+    if (pugi::xml_attribute attribute = element.attribute("rend")) {
+        this->SetRend(StrToTextrendition(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6732,32 +6732,32 @@ void AttTextStyle::ResetTextStyle()
     m_textWeight = FONTWEIGHT_NONE;
 }
 
-bool AttTextStyle::ReadTextStyle(pugi::xml_node element)
+bool AttTextStyle::ReadTextStyle(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("text.fam")) {
-        this->SetTextFam(StrToStr(element.attribute("text.fam").value()));
-        element.remove_attribute("text.fam");
+    if (pugi::xml_attribute attribute = element.attribute("text.fam")) {
+        this->SetTextFam(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.name")) {
-        this->SetTextName(StrToStr(element.attribute("text.name").value()));
-        element.remove_attribute("text.name");
+    if (pugi::xml_attribute attribute = element.attribute("text.name")) {
+        this->SetTextName(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.size")) {
-        this->SetTextSize(StrToFontsize(element.attribute("text.size").value()));
-        element.remove_attribute("text.size");
+    if (pugi::xml_attribute attribute = element.attribute("text.size")) {
+        this->SetTextSize(StrToFontsize(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.style")) {
-        this->SetTextStyle(StrToFontstyle(element.attribute("text.style").value()));
-        element.remove_attribute("text.style");
+    if (pugi::xml_attribute attribute = element.attribute("text.style")) {
+        this->SetTextStyle(StrToFontstyle(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("text.weight")) {
-        this->SetTextWeight(StrToFontweight(element.attribute("text.weight").value()));
-        element.remove_attribute("text.weight");
+    if (pugi::xml_attribute attribute = element.attribute("text.weight")) {
+        this->SetTextWeight(StrToFontweight(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6834,12 +6834,12 @@ void AttTiePresent::ResetTiePresent()
     m_tie = TIE_NONE;
 }
 
-bool AttTiePresent::ReadTiePresent(pugi::xml_node element)
+bool AttTiePresent::ReadTiePresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie")) {
-        this->SetTie(StrToTie(element.attribute("tie").value()));
-        element.remove_attribute("tie");
+    if (pugi::xml_attribute attribute = element.attribute("tie")) {
+        this->SetTie(StrToTie(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6880,12 +6880,12 @@ void AttTimestampLogical::ResetTimestampLogical()
     m_tstamp = -1.0;
 }
 
-bool AttTimestampLogical::ReadTimestampLogical(pugi::xml_node element)
+bool AttTimestampLogical::ReadTimestampLogical(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp")) {
-        this->SetTstamp(StrToDbl(element.attribute("tstamp").value()));
-        element.remove_attribute("tstamp");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp")) {
+        this->SetTstamp(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6926,12 +6926,12 @@ void AttTimestamp2Logical::ResetTimestamp2Logical()
     m_tstamp2 = std::make_pair(-1, -1.0);
 }
 
-bool AttTimestamp2Logical::ReadTimestamp2Logical(pugi::xml_node element)
+bool AttTimestamp2Logical::ReadTimestamp2Logical(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2")) {
-        this->SetTstamp2(StrToMeasurebeat(element.attribute("tstamp2").value()));
-        element.remove_attribute("tstamp2");
+    if (pugi::xml_attribute attribute = element.attribute("tstamp2")) {
+        this->SetTstamp2(StrToMeasurebeat(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6973,17 +6973,17 @@ void AttTransposition::ResetTransposition()
     m_transSemi = 0.0;
 }
 
-bool AttTransposition::ReadTransposition(pugi::xml_node element)
+bool AttTransposition::ReadTransposition(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("trans.diat")) {
-        this->SetTransDiat(StrToDbl(element.attribute("trans.diat").value()));
-        element.remove_attribute("trans.diat");
+    if (pugi::xml_attribute attribute = element.attribute("trans.diat")) {
+        this->SetTransDiat(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("trans.semi")) {
-        this->SetTransSemi(StrToDbl(element.attribute("trans.semi").value()));
-        element.remove_attribute("trans.semi");
+    if (pugi::xml_attribute attribute = element.attribute("trans.semi")) {
+        this->SetTransSemi(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7033,12 +7033,12 @@ void AttTupletPresent::ResetTupletPresent()
     m_tuplet = "";
 }
 
-bool AttTupletPresent::ReadTupletPresent(pugi::xml_node element)
+bool AttTupletPresent::ReadTupletPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tuplet")) {
-        this->SetTuplet(StrToStr(element.attribute("tuplet").value()));
-        element.remove_attribute("tuplet");
+    if (pugi::xml_attribute attribute = element.attribute("tuplet")) {
+        this->SetTuplet(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7079,12 +7079,12 @@ void AttTyped::ResetTyped()
     m_type = "";
 }
 
-bool AttTyped::ReadTyped(pugi::xml_node element)
+bool AttTyped::ReadTyped(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("type")) {
-        this->SetType(StrToStr(element.attribute("type").value()));
-        element.remove_attribute("type");
+    if (pugi::xml_attribute attribute = element.attribute("type")) {
+        this->SetType(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7129,32 +7129,32 @@ void AttTypography::ResetTypography()
     m_fontweight = FONTWEIGHT_NONE;
 }
 
-bool AttTypography::ReadTypography(pugi::xml_node element)
+bool AttTypography::ReadTypography(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("fontfam")) {
-        this->SetFontfam(StrToStr(element.attribute("fontfam").value()));
-        element.remove_attribute("fontfam");
+    if (pugi::xml_attribute attribute = element.attribute("fontfam")) {
+        this->SetFontfam(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("fontname")) {
-        this->SetFontname(StrToStr(element.attribute("fontname").value()));
-        element.remove_attribute("fontname");
+    if (pugi::xml_attribute attribute = element.attribute("fontname")) {
+        this->SetFontname(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("fontsize")) {
-        this->SetFontsize(StrToFontsize(element.attribute("fontsize").value()));
-        element.remove_attribute("fontsize");
+    if (pugi::xml_attribute attribute = element.attribute("fontsize")) {
+        this->SetFontsize(StrToFontsize(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("fontstyle")) {
-        this->SetFontstyle(StrToFontstyle(element.attribute("fontstyle").value()));
-        element.remove_attribute("fontstyle");
+    if (pugi::xml_attribute attribute = element.attribute("fontstyle")) {
+        this->SetFontstyle(StrToFontstyle(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("fontweight")) {
-        this->SetFontweight(StrToFontweight(element.attribute("fontweight").value()));
-        element.remove_attribute("fontweight");
+    if (pugi::xml_attribute attribute = element.attribute("fontweight")) {
+        this->SetFontweight(StrToFontweight(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7231,12 +7231,12 @@ void AttVerticalAlign::ResetVerticalAlign()
     m_valign = VERTICALALIGNMENT_NONE;
 }
 
-bool AttVerticalAlign::ReadVerticalAlign(pugi::xml_node element)
+bool AttVerticalAlign::ReadVerticalAlign(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("valign")) {
-        this->SetValign(StrToVerticalalignment(element.attribute("valign").value()));
-        element.remove_attribute("valign");
+    if (pugi::xml_attribute attribute = element.attribute("valign")) {
+        this->SetValign(StrToVerticalalignment(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7277,12 +7277,12 @@ void AttVerticalGroup::ResetVerticalGroup()
     m_vgrp = 0;
 }
 
-bool AttVerticalGroup::ReadVerticalGroup(pugi::xml_node element)
+bool AttVerticalGroup::ReadVerticalGroup(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vgrp")) {
-        this->SetVgrp(StrToInt(element.attribute("vgrp").value()));
-        element.remove_attribute("vgrp");
+    if (pugi::xml_attribute attribute = element.attribute("vgrp")) {
+        this->SetVgrp(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7323,12 +7323,12 @@ void AttVisibility::ResetVisibility()
     m_visible = BOOLEAN_NONE;
 }
 
-bool AttVisibility::ReadVisibility(pugi::xml_node element)
+bool AttVisibility::ReadVisibility(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("visible")) {
-        this->SetVisible(StrToBoolean(element.attribute("visible").value()));
-        element.remove_attribute("visible");
+    if (pugi::xml_attribute attribute = element.attribute("visible")) {
+        this->SetVisible(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7369,12 +7369,12 @@ void AttVisualOffsetHo::ResetVisualOffsetHo()
     m_ho = VRV_UNSET;
 }
 
-bool AttVisualOffsetHo::ReadVisualOffsetHo(pugi::xml_node element)
+bool AttVisualOffsetHo::ReadVisualOffsetHo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ho")) {
-        this->SetHo(StrToMeasurementrel(element.attribute("ho").value()));
-        element.remove_attribute("ho");
+    if (pugi::xml_attribute attribute = element.attribute("ho")) {
+        this->SetHo(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7415,12 +7415,12 @@ void AttVisualOffsetTo::ResetVisualOffsetTo()
     m_to = 0.0;
 }
 
-bool AttVisualOffsetTo::ReadVisualOffsetTo(pugi::xml_node element)
+bool AttVisualOffsetTo::ReadVisualOffsetTo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("to")) {
-        this->SetTo(StrToDbl(element.attribute("to").value()));
-        element.remove_attribute("to");
+    if (pugi::xml_attribute attribute = element.attribute("to")) {
+        this->SetTo(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7461,12 +7461,12 @@ void AttVisualOffsetVo::ResetVisualOffsetVo()
     m_vo = VRV_UNSET;
 }
 
-bool AttVisualOffsetVo::ReadVisualOffsetVo(pugi::xml_node element)
+bool AttVisualOffsetVo::ReadVisualOffsetVo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vo")) {
-        this->SetVo(StrToMeasurementrel(element.attribute("vo").value()));
-        element.remove_attribute("vo");
+    if (pugi::xml_attribute attribute = element.attribute("vo")) {
+        this->SetVo(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7508,17 +7508,17 @@ void AttVisualOffset2Ho::ResetVisualOffset2Ho()
     m_endho = VRV_UNSET;
 }
 
-bool AttVisualOffset2Ho::ReadVisualOffset2Ho(pugi::xml_node element)
+bool AttVisualOffset2Ho::ReadVisualOffset2Ho(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startho")) {
-        this->SetStartho(StrToMeasurementrel(element.attribute("startho").value()));
-        element.remove_attribute("startho");
+    if (pugi::xml_attribute attribute = element.attribute("startho")) {
+        this->SetStartho(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endho")) {
-        this->SetEndho(StrToMeasurementrel(element.attribute("endho").value()));
-        element.remove_attribute("endho");
+    if (pugi::xml_attribute attribute = element.attribute("endho")) {
+        this->SetEndho(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7569,17 +7569,17 @@ void AttVisualOffset2To::ResetVisualOffset2To()
     m_endto = 0.0;
 }
 
-bool AttVisualOffset2To::ReadVisualOffset2To(pugi::xml_node element)
+bool AttVisualOffset2To::ReadVisualOffset2To(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startto")) {
-        this->SetStartto(StrToDbl(element.attribute("startto").value()));
-        element.remove_attribute("startto");
+    if (pugi::xml_attribute attribute = element.attribute("startto")) {
+        this->SetStartto(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endto")) {
-        this->SetEndto(StrToDbl(element.attribute("endto").value()));
-        element.remove_attribute("endto");
+    if (pugi::xml_attribute attribute = element.attribute("endto")) {
+        this->SetEndto(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7630,17 +7630,17 @@ void AttVisualOffset2Vo::ResetVisualOffset2Vo()
     m_endvo = VRV_UNSET;
 }
 
-bool AttVisualOffset2Vo::ReadVisualOffset2Vo(pugi::xml_node element)
+bool AttVisualOffset2Vo::ReadVisualOffset2Vo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("startvo")) {
-        this->SetStartvo(StrToMeasurementrel(element.attribute("startvo").value()));
-        element.remove_attribute("startvo");
+    if (pugi::xml_attribute attribute = element.attribute("startvo")) {
+        this->SetStartvo(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endvo")) {
-        this->SetEndvo(StrToMeasurementrel(element.attribute("endvo").value()));
-        element.remove_attribute("endvo");
+    if (pugi::xml_attribute attribute = element.attribute("endvo")) {
+        this->SetEndvo(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7690,12 +7690,12 @@ void AttVoltaGroupingSym::ResetVoltaGroupingSym()
     m_voltasym = voltaGroupingSym_VOLTASYM_NONE;
 }
 
-bool AttVoltaGroupingSym::ReadVoltaGroupingSym(pugi::xml_node element)
+bool AttVoltaGroupingSym::ReadVoltaGroupingSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("voltasym")) {
-        this->SetVoltasym(StrToVoltaGroupingSymVoltasym(element.attribute("voltasym").value()));
-        element.remove_attribute("voltasym");
+    if (pugi::xml_attribute attribute = element.attribute("voltasym")) {
+        this->SetVoltasym(StrToVoltaGroupingSymVoltasym(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7736,12 +7736,12 @@ void AttWhitespace::ResetWhitespace()
     m_space = "";
 }
 
-bool AttWhitespace::ReadWhitespace(pugi::xml_node element)
+bool AttWhitespace::ReadWhitespace(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:space")) {
-        this->SetSpace(StrToStr(element.attribute("xml:space").value()));
-        element.remove_attribute("xml:space");
+    if (pugi::xml_attribute attribute = element.attribute("xml:space")) {
+        this->SetSpace(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7782,12 +7782,12 @@ void AttWidth::ResetWidth()
     m_width = VRV_UNSET;
 }
 
-bool AttWidth::ReadWidth(pugi::xml_node element)
+bool AttWidth::ReadWidth(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("width")) {
-        this->SetWidth(StrToMeasurementabs(element.attribute("width").value()));
-        element.remove_attribute("width");
+    if (pugi::xml_attribute attribute = element.attribute("width")) {
+        this->SetWidth(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7829,17 +7829,17 @@ void AttXy::ResetXy()
     m_y = 0.0;
 }
 
-bool AttXy::ReadXy(pugi::xml_node element)
+bool AttXy::ReadXy(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("x")) {
-        this->SetX(StrToDbl(element.attribute("x").value()));
-        element.remove_attribute("x");
+    if (pugi::xml_attribute attribute = element.attribute("x")) {
+        this->SetX(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("y")) {
-        this->SetY(StrToDbl(element.attribute("y").value()));
-        element.remove_attribute("y");
+    if (pugi::xml_attribute attribute = element.attribute("y")) {
+        this->SetY(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7890,17 +7890,17 @@ void AttXy2::ResetXy2()
     m_y2 = 0.0;
 }
 
-bool AttXy2::ReadXy2(pugi::xml_node element)
+bool AttXy2::ReadXy2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("x2")) {
-        this->SetX2(StrToDbl(element.attribute("x2").value()));
-        element.remove_attribute("x2");
+    if (pugi::xml_attribute attribute = element.attribute("x2")) {
+        this->SetX2(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("y2")) {
-        this->SetY2(StrToDbl(element.attribute("y2").value()));
-        element.remove_attribute("y2");
+    if (pugi::xml_attribute attribute = element.attribute("y2")) {
+        this->SetY2(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -32,13 +32,13 @@ namespace vrv {
 class AttAccidLog : public Att {
 public:
     AttAccidLog();
-    virtual ~AttAccidLog();
+    ~AttAccidLog();
 
     /** Reset the default values for the attribute class **/
     void ResetAccidLog();
 
     /** Read the values for the attribute class **/
-    bool ReadAccidLog(pugi::xml_node element);
+    bool ReadAccidLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAccidLog(pugi::xml_node element);
@@ -68,13 +68,13 @@ private:
 class AttAccidental : public Att {
 public:
     AttAccidental();
-    virtual ~AttAccidental();
+    ~AttAccidental();
 
     /** Reset the default values for the attribute class **/
     void ResetAccidental();
 
     /** Read the values for the attribute class **/
-    bool ReadAccidental(pugi::xml_node element);
+    bool ReadAccidental(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAccidental(pugi::xml_node element);
@@ -104,13 +104,13 @@ private:
 class AttArticulation : public Att {
 public:
     AttArticulation();
-    virtual ~AttArticulation();
+    ~AttArticulation();
 
     /** Reset the default values for the attribute class **/
     void ResetArticulation();
 
     /** Read the values for the attribute class **/
-    bool ReadArticulation(pugi::xml_node element);
+    bool ReadArticulation(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteArticulation(pugi::xml_node element);
@@ -146,13 +146,13 @@ private:
 class AttAttaccaLog : public Att {
 public:
     AttAttaccaLog();
-    virtual ~AttAttaccaLog();
+    ~AttAttaccaLog();
 
     /** Reset the default values for the attribute class **/
     void ResetAttaccaLog();
 
     /** Read the values for the attribute class **/
-    bool ReadAttaccaLog(pugi::xml_node element);
+    bool ReadAttaccaLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAttaccaLog(pugi::xml_node element);
@@ -182,13 +182,13 @@ private:
 class AttAudience : public Att {
 public:
     AttAudience();
-    virtual ~AttAudience();
+    ~AttAudience();
 
     /** Reset the default values for the attribute class **/
     void ResetAudience();
 
     /** Read the values for the attribute class **/
-    bool ReadAudience(pugi::xml_node element);
+    bool ReadAudience(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAudience(pugi::xml_node element);
@@ -218,13 +218,13 @@ private:
 class AttAugmentDots : public Att {
 public:
     AttAugmentDots();
-    virtual ~AttAugmentDots();
+    ~AttAugmentDots();
 
     /** Reset the default values for the attribute class **/
     void ResetAugmentDots();
 
     /** Read the values for the attribute class **/
-    bool ReadAugmentDots(pugi::xml_node element);
+    bool ReadAugmentDots(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAugmentDots(pugi::xml_node element);
@@ -254,13 +254,13 @@ private:
 class AttAuthorized : public Att {
 public:
     AttAuthorized();
-    virtual ~AttAuthorized();
+    ~AttAuthorized();
 
     /** Reset the default values for the attribute class **/
     void ResetAuthorized();
 
     /** Read the values for the attribute class **/
-    bool ReadAuthorized(pugi::xml_node element);
+    bool ReadAuthorized(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAuthorized(pugi::xml_node element);
@@ -304,13 +304,13 @@ private:
 class AttBarLineLog : public Att {
 public:
     AttBarLineLog();
-    virtual ~AttBarLineLog();
+    ~AttBarLineLog();
 
     /** Reset the default values for the attribute class **/
     void ResetBarLineLog();
 
     /** Read the values for the attribute class **/
-    bool ReadBarLineLog(pugi::xml_node element);
+    bool ReadBarLineLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBarLineLog(pugi::xml_node element);
@@ -340,13 +340,13 @@ private:
 class AttBarring : public Att {
 public:
     AttBarring();
-    virtual ~AttBarring();
+    ~AttBarring();
 
     /** Reset the default values for the attribute class **/
     void ResetBarring();
 
     /** Read the values for the attribute class **/
-    bool ReadBarring(pugi::xml_node element);
+    bool ReadBarring(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBarring(pugi::xml_node element);
@@ -395,13 +395,13 @@ private:
 class AttBasic : public Att {
 public:
     AttBasic();
-    virtual ~AttBasic();
+    ~AttBasic();
 
     /** Reset the default values for the attribute class **/
     void ResetBasic();
 
     /** Read the values for the attribute class **/
-    bool ReadBasic(pugi::xml_node element);
+    bool ReadBasic(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBasic(pugi::xml_node element);
@@ -431,13 +431,13 @@ private:
 class AttBibl : public Att {
 public:
     AttBibl();
-    virtual ~AttBibl();
+    ~AttBibl();
 
     /** Reset the default values for the attribute class **/
     void ResetBibl();
 
     /** Read the values for the attribute class **/
-    bool ReadBibl(pugi::xml_node element);
+    bool ReadBibl(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBibl(pugi::xml_node element);
@@ -470,13 +470,13 @@ private:
 class AttCalendared : public Att {
 public:
     AttCalendared();
-    virtual ~AttCalendared();
+    ~AttCalendared();
 
     /** Reset the default values for the attribute class **/
     void ResetCalendared();
 
     /** Read the values for the attribute class **/
-    bool ReadCalendared(pugi::xml_node element);
+    bool ReadCalendared(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCalendared(pugi::xml_node element);
@@ -509,13 +509,13 @@ private:
 class AttCanonical : public Att {
 public:
     AttCanonical();
-    virtual ~AttCanonical();
+    ~AttCanonical();
 
     /** Reset the default values for the attribute class **/
     void ResetCanonical();
 
     /** Read the values for the attribute class **/
-    bool ReadCanonical(pugi::xml_node element);
+    bool ReadCanonical(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCanonical(pugi::xml_node element);
@@ -549,13 +549,13 @@ private:
 class AttClassed : public Att {
 public:
     AttClassed();
-    virtual ~AttClassed();
+    ~AttClassed();
 
     /** Reset the default values for the attribute class **/
     void ResetClassed();
 
     /** Read the values for the attribute class **/
-    bool ReadClassed(pugi::xml_node element);
+    bool ReadClassed(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteClassed(pugi::xml_node element);
@@ -588,13 +588,13 @@ private:
 class AttClefLog : public Att {
 public:
     AttClefLog();
-    virtual ~AttClefLog();
+    ~AttClefLog();
 
     /** Reset the default values for the attribute class **/
     void ResetClefLog();
 
     /** Read the values for the attribute class **/
-    bool ReadClefLog(pugi::xml_node element);
+    bool ReadClefLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteClefLog(pugi::xml_node element);
@@ -627,13 +627,13 @@ private:
 class AttClefShape : public Att {
 public:
     AttClefShape();
-    virtual ~AttClefShape();
+    ~AttClefShape();
 
     /** Reset the default values for the attribute class **/
     void ResetClefShape();
 
     /** Read the values for the attribute class **/
-    bool ReadClefShape(pugi::xml_node element);
+    bool ReadClefShape(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteClefShape(pugi::xml_node element);
@@ -663,13 +663,13 @@ private:
 class AttCleffingLog : public Att {
 public:
     AttCleffingLog();
-    virtual ~AttCleffingLog();
+    ~AttCleffingLog();
 
     /** Reset the default values for the attribute class **/
     void ResetCleffingLog();
 
     /** Read the values for the attribute class **/
-    bool ReadCleffingLog(pugi::xml_node element);
+    bool ReadCleffingLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCleffingLog(pugi::xml_node element);
@@ -721,13 +721,13 @@ private:
 class AttColor : public Att {
 public:
     AttColor();
-    virtual ~AttColor();
+    ~AttColor();
 
     /** Reset the default values for the attribute class **/
     void ResetColor();
 
     /** Read the values for the attribute class **/
-    bool ReadColor(pugi::xml_node element);
+    bool ReadColor(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteColor(pugi::xml_node element);
@@ -760,13 +760,13 @@ private:
 class AttColoration : public Att {
 public:
     AttColoration();
-    virtual ~AttColoration();
+    ~AttColoration();
 
     /** Reset the default values for the attribute class **/
     void ResetColoration();
 
     /** Read the values for the attribute class **/
-    bool ReadColoration(pugi::xml_node element);
+    bool ReadColoration(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteColoration(pugi::xml_node element);
@@ -803,13 +803,13 @@ private:
 class AttCoordinated : public Att {
 public:
     AttCoordinated();
-    virtual ~AttCoordinated();
+    ~AttCoordinated();
 
     /** Reset the default values for the attribute class **/
     void ResetCoordinated();
 
     /** Read the values for the attribute class **/
-    bool ReadCoordinated(pugi::xml_node element);
+    bool ReadCoordinated(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCoordinated(pugi::xml_node element);
@@ -857,13 +857,13 @@ private:
 class AttCue : public Att {
 public:
     AttCue();
-    virtual ~AttCue();
+    ~AttCue();
 
     /** Reset the default values for the attribute class **/
     void ResetCue();
 
     /** Read the values for the attribute class **/
-    bool ReadCue(pugi::xml_node element);
+    bool ReadCue(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCue(pugi::xml_node element);
@@ -893,13 +893,13 @@ private:
 class AttCurvature : public Att {
 public:
     AttCurvature();
-    virtual ~AttCurvature();
+    ~AttCurvature();
 
     /** Reset the default values for the attribute class **/
     void ResetCurvature();
 
     /** Read the values for the attribute class **/
-    bool ReadCurvature(pugi::xml_node element);
+    bool ReadCurvature(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCurvature(pugi::xml_node element);
@@ -952,13 +952,13 @@ private:
 class AttCurveRend : public Att {
 public:
     AttCurveRend();
-    virtual ~AttCurveRend();
+    ~AttCurveRend();
 
     /** Reset the default values for the attribute class **/
     void ResetCurveRend();
 
     /** Read the values for the attribute class **/
-    bool ReadCurveRend(pugi::xml_node element);
+    bool ReadCurveRend(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCurveRend(pugi::xml_node element);
@@ -996,13 +996,13 @@ private:
 class AttCustosLog : public Att {
 public:
     AttCustosLog();
-    virtual ~AttCustosLog();
+    ~AttCustosLog();
 
     /** Reset the default values for the attribute class **/
     void ResetCustosLog();
 
     /** Read the values for the attribute class **/
-    bool ReadCustosLog(pugi::xml_node element);
+    bool ReadCustosLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCustosLog(pugi::xml_node element);
@@ -1032,13 +1032,13 @@ private:
 class AttDataPointing : public Att {
 public:
     AttDataPointing();
-    virtual ~AttDataPointing();
+    ~AttDataPointing();
 
     /** Reset the default values for the attribute class **/
     void ResetDataPointing();
 
     /** Read the values for the attribute class **/
-    bool ReadDataPointing(pugi::xml_node element);
+    bool ReadDataPointing(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteDataPointing(pugi::xml_node element);
@@ -1068,13 +1068,13 @@ private:
 class AttDatable : public Att {
 public:
     AttDatable();
-    virtual ~AttDatable();
+    ~AttDatable();
 
     /** Reset the default values for the attribute class **/
     void ResetDatable();
 
     /** Read the values for the attribute class **/
-    bool ReadDatable(pugi::xml_node element);
+    bool ReadDatable(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteDatable(pugi::xml_node element);
@@ -1128,13 +1128,13 @@ private:
 class AttDistances : public Att {
 public:
     AttDistances();
-    virtual ~AttDistances();
+    ~AttDistances();
 
     /** Reset the default values for the attribute class **/
     void ResetDistances();
 
     /** Read the values for the attribute class **/
-    bool ReadDistances(pugi::xml_node element);
+    bool ReadDistances(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteDistances(pugi::xml_node element);
@@ -1179,13 +1179,13 @@ private:
 class AttDotLog : public Att {
 public:
     AttDotLog();
-    virtual ~AttDotLog();
+    ~AttDotLog();
 
     /** Reset the default values for the attribute class **/
     void ResetDotLog();
 
     /** Read the values for the attribute class **/
-    bool ReadDotLog(pugi::xml_node element);
+    bool ReadDotLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteDotLog(pugi::xml_node element);
@@ -1215,13 +1215,13 @@ private:
 class AttDurationAdditive : public Att {
 public:
     AttDurationAdditive();
-    virtual ~AttDurationAdditive();
+    ~AttDurationAdditive();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationAdditive();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationAdditive(pugi::xml_node element);
+    bool ReadDurationAdditive(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteDurationAdditive(pugi::xml_node element);
@@ -1254,13 +1254,13 @@ private:
 class AttDurationDefault : public Att {
 public:
     AttDurationDefault();
-    virtual ~AttDurationDefault();
+    ~AttDurationDefault();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationDefault();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationDefault(pugi::xml_node element);
+    bool ReadDurationDefault(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteDurationDefault(pugi::xml_node element);
@@ -1312,13 +1312,13 @@ private:
 class AttDurationLogical : public Att {
 public:
     AttDurationLogical();
-    virtual ~AttDurationLogical();
+    ~AttDurationLogical();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationLogical();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationLogical(pugi::xml_node element);
+    bool ReadDurationLogical(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteDurationLogical(pugi::xml_node element);
@@ -1351,13 +1351,13 @@ private:
 class AttDurationRatio : public Att {
 public:
     AttDurationRatio();
-    virtual ~AttDurationRatio();
+    ~AttDurationRatio();
 
     /** Reset the default values for the attribute class **/
     void ResetDurationRatio();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationRatio(pugi::xml_node element);
+    bool ReadDurationRatio(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteDurationRatio(pugi::xml_node element);
@@ -1396,13 +1396,13 @@ private:
 class AttEnclosingChars : public Att {
 public:
     AttEnclosingChars();
-    virtual ~AttEnclosingChars();
+    ~AttEnclosingChars();
 
     /** Reset the default values for the attribute class **/
     void ResetEnclosingChars();
 
     /** Read the values for the attribute class **/
-    bool ReadEnclosingChars(pugi::xml_node element);
+    bool ReadEnclosingChars(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteEnclosingChars(pugi::xml_node element);
@@ -1437,13 +1437,13 @@ private:
 class AttEndings : public Att {
 public:
     AttEndings();
-    virtual ~AttEndings();
+    ~AttEndings();
 
     /** Reset the default values for the attribute class **/
     void ResetEndings();
 
     /** Read the values for the attribute class **/
-    bool ReadEndings(pugi::xml_node element);
+    bool ReadEndings(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteEndings(pugi::xml_node element);
@@ -1473,13 +1473,13 @@ private:
 class AttEvidence : public Att {
 public:
     AttEvidence();
-    virtual ~AttEvidence();
+    ~AttEvidence();
 
     /** Reset the default values for the attribute class **/
     void ResetEvidence();
 
     /** Read the values for the attribute class **/
-    bool ReadEvidence(pugi::xml_node element);
+    bool ReadEvidence(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteEvidence(pugi::xml_node element);
@@ -1518,13 +1518,13 @@ private:
 class AttExtender : public Att {
 public:
     AttExtender();
-    virtual ~AttExtender();
+    ~AttExtender();
 
     /** Reset the default values for the attribute class **/
     void ResetExtender();
 
     /** Read the values for the attribute class **/
-    bool ReadExtender(pugi::xml_node element);
+    bool ReadExtender(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteExtender(pugi::xml_node element);
@@ -1554,13 +1554,13 @@ private:
 class AttExtent : public Att {
 public:
     AttExtent();
-    virtual ~AttExtent();
+    ~AttExtent();
 
     /** Reset the default values for the attribute class **/
     void ResetExtent();
 
     /** Read the values for the attribute class **/
-    bool ReadExtent(pugi::xml_node element);
+    bool ReadExtent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteExtent(pugi::xml_node element);
@@ -1594,13 +1594,13 @@ private:
 class AttFermataPresent : public Att {
 public:
     AttFermataPresent();
-    virtual ~AttFermataPresent();
+    ~AttFermataPresent();
 
     /** Reset the default values for the attribute class **/
     void ResetFermataPresent();
 
     /** Read the values for the attribute class **/
-    bool ReadFermataPresent(pugi::xml_node element);
+    bool ReadFermataPresent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteFermataPresent(pugi::xml_node element);
@@ -1633,13 +1633,13 @@ private:
 class AttFiling : public Att {
 public:
     AttFiling();
-    virtual ~AttFiling();
+    ~AttFiling();
 
     /** Reset the default values for the attribute class **/
     void ResetFiling();
 
     /** Read the values for the attribute class **/
-    bool ReadFiling(pugi::xml_node element);
+    bool ReadFiling(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteFiling(pugi::xml_node element);
@@ -1672,13 +1672,13 @@ private:
 class AttGrpSymLog : public Att {
 public:
     AttGrpSymLog();
-    virtual ~AttGrpSymLog();
+    ~AttGrpSymLog();
 
     /** Reset the default values for the attribute class **/
     void ResetGrpSymLog();
 
     /** Read the values for the attribute class **/
-    bool ReadGrpSymLog(pugi::xml_node element);
+    bool ReadGrpSymLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteGrpSymLog(pugi::xml_node element);
@@ -1708,13 +1708,13 @@ private:
 class AttHandIdent : public Att {
 public:
     AttHandIdent();
-    virtual ~AttHandIdent();
+    ~AttHandIdent();
 
     /** Reset the default values for the attribute class **/
     void ResetHandIdent();
 
     /** Read the values for the attribute class **/
-    bool ReadHandIdent(pugi::xml_node element);
+    bool ReadHandIdent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHandIdent(pugi::xml_node element);
@@ -1747,13 +1747,13 @@ private:
 class AttHeight : public Att {
 public:
     AttHeight();
-    virtual ~AttHeight();
+    ~AttHeight();
 
     /** Reset the default values for the attribute class **/
     void ResetHeight();
 
     /** Read the values for the attribute class **/
-    bool ReadHeight(pugi::xml_node element);
+    bool ReadHeight(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHeight(pugi::xml_node element);
@@ -1783,13 +1783,13 @@ private:
 class AttHorizontalAlign : public Att {
 public:
     AttHorizontalAlign();
-    virtual ~AttHorizontalAlign();
+    ~AttHorizontalAlign();
 
     /** Reset the default values for the attribute class **/
     void ResetHorizontalAlign();
 
     /** Read the values for the attribute class **/
-    bool ReadHorizontalAlign(pugi::xml_node element);
+    bool ReadHorizontalAlign(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHorizontalAlign(pugi::xml_node element);
@@ -1819,13 +1819,13 @@ private:
 class AttInternetMedia : public Att {
 public:
     AttInternetMedia();
-    virtual ~AttInternetMedia();
+    ~AttInternetMedia();
 
     /** Reset the default values for the attribute class **/
     void ResetInternetMedia();
 
     /** Read the values for the attribute class **/
-    bool ReadInternetMedia(pugi::xml_node element);
+    bool ReadInternetMedia(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteInternetMedia(pugi::xml_node element);
@@ -1859,13 +1859,13 @@ private:
 class AttJoined : public Att {
 public:
     AttJoined();
-    virtual ~AttJoined();
+    ~AttJoined();
 
     /** Reset the default values for the attribute class **/
     void ResetJoined();
 
     /** Read the values for the attribute class **/
-    bool ReadJoined(pugi::xml_node element);
+    bool ReadJoined(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteJoined(pugi::xml_node element);
@@ -1902,13 +1902,13 @@ private:
 class AttKeySigLog : public Att {
 public:
     AttKeySigLog();
-    virtual ~AttKeySigLog();
+    ~AttKeySigLog();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigLog();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigLog(pugi::xml_node element);
+    bool ReadKeySigLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigLog(pugi::xml_node element);
@@ -1938,13 +1938,13 @@ private:
 class AttKeySigDefaultLog : public Att {
 public:
     AttKeySigDefaultLog();
-    virtual ~AttKeySigDefaultLog();
+    ~AttKeySigDefaultLog();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigDefaultLog();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigDefaultLog(pugi::xml_node element);
+    bool ReadKeySigDefaultLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultLog(pugi::xml_node element);
@@ -1974,13 +1974,13 @@ private:
 class AttLabelled : public Att {
 public:
     AttLabelled();
-    virtual ~AttLabelled();
+    ~AttLabelled();
 
     /** Reset the default values for the attribute class **/
     void ResetLabelled();
 
     /** Read the values for the attribute class **/
-    bool ReadLabelled(pugi::xml_node element);
+    bool ReadLabelled(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLabelled(pugi::xml_node element);
@@ -2014,13 +2014,13 @@ private:
 class AttLang : public Att {
 public:
     AttLang();
-    virtual ~AttLang();
+    ~AttLang();
 
     /** Reset the default values for the attribute class **/
     void ResetLang();
 
     /** Read the values for the attribute class **/
-    bool ReadLang(pugi::xml_node element);
+    bool ReadLang(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLang(pugi::xml_node element);
@@ -2056,13 +2056,13 @@ private:
 class AttLayerLog : public Att {
 public:
     AttLayerLog();
-    virtual ~AttLayerLog();
+    ~AttLayerLog();
 
     /** Reset the default values for the attribute class **/
     void ResetLayerLog();
 
     /** Read the values for the attribute class **/
-    bool ReadLayerLog(pugi::xml_node element);
+    bool ReadLayerLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLayerLog(pugi::xml_node element);
@@ -2092,13 +2092,13 @@ private:
 class AttLayerIdent : public Att {
 public:
     AttLayerIdent();
-    virtual ~AttLayerIdent();
+    ~AttLayerIdent();
 
     /** Reset the default values for the attribute class **/
     void ResetLayerIdent();
 
     /** Read the values for the attribute class **/
-    bool ReadLayerIdent(pugi::xml_node element);
+    bool ReadLayerIdent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLayerIdent(pugi::xml_node element);
@@ -2128,13 +2128,13 @@ private:
 class AttLineLoc : public Att {
 public:
     AttLineLoc();
-    virtual ~AttLineLoc();
+    ~AttLineLoc();
 
     /** Reset the default values for the attribute class **/
     void ResetLineLoc();
 
     /** Read the values for the attribute class **/
-    bool ReadLineLoc(pugi::xml_node element);
+    bool ReadLineLoc(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLineLoc(pugi::xml_node element);
@@ -2168,13 +2168,13 @@ private:
 class AttLineRend : public Att {
 public:
     AttLineRend();
-    virtual ~AttLineRend();
+    ~AttLineRend();
 
     /** Reset the default values for the attribute class **/
     void ResetLineRend();
 
     /** Read the values for the attribute class **/
-    bool ReadLineRend(pugi::xml_node element);
+    bool ReadLineRend(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLineRend(pugi::xml_node element);
@@ -2222,13 +2222,13 @@ private:
 class AttLineRendBase : public Att {
 public:
     AttLineRendBase();
-    virtual ~AttLineRendBase();
+    ~AttLineRendBase();
 
     /** Reset the default values for the attribute class **/
     void ResetLineRendBase();
 
     /** Read the values for the attribute class **/
-    bool ReadLineRendBase(pugi::xml_node element);
+    bool ReadLineRendBase(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLineRendBase(pugi::xml_node element);
@@ -2278,13 +2278,13 @@ private:
 class AttLinking : public Att {
 public:
     AttLinking();
-    virtual ~AttLinking();
+    ~AttLinking();
 
     /** Reset the default values for the attribute class **/
     void ResetLinking();
 
     /** Read the values for the attribute class **/
-    bool ReadLinking(pugi::xml_node element);
+    bool ReadLinking(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLinking(pugi::xml_node element);
@@ -2368,13 +2368,13 @@ private:
 class AttLyricStyle : public Att {
 public:
     AttLyricStyle();
-    virtual ~AttLyricStyle();
+    ~AttLyricStyle();
 
     /** Reset the default values for the attribute class **/
     void ResetLyricStyle();
 
     /** Read the values for the attribute class **/
-    bool ReadLyricStyle(pugi::xml_node element);
+    bool ReadLyricStyle(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLyricStyle(pugi::xml_node element);
@@ -2436,13 +2436,13 @@ private:
 class AttMeasureNumbers : public Att {
 public:
     AttMeasureNumbers();
-    virtual ~AttMeasureNumbers();
+    ~AttMeasureNumbers();
 
     /** Reset the default values for the attribute class **/
     void ResetMeasureNumbers();
 
     /** Read the values for the attribute class **/
-    bool ReadMeasureNumbers(pugi::xml_node element);
+    bool ReadMeasureNumbers(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeasureNumbers(pugi::xml_node element);
@@ -2472,13 +2472,13 @@ private:
 class AttMeasurement : public Att {
 public:
     AttMeasurement();
-    virtual ~AttMeasurement();
+    ~AttMeasurement();
 
     /** Reset the default values for the attribute class **/
     void ResetMeasurement();
 
     /** Read the values for the attribute class **/
-    bool ReadMeasurement(pugi::xml_node element);
+    bool ReadMeasurement(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeasurement(pugi::xml_node element);
@@ -2508,13 +2508,13 @@ private:
 class AttMediaBounds : public Att {
 public:
     AttMediaBounds();
-    virtual ~AttMediaBounds();
+    ~AttMediaBounds();
 
     /** Reset the default values for the attribute class **/
     void ResetMediaBounds();
 
     /** Read the values for the attribute class **/
-    bool ReadMediaBounds(pugi::xml_node element);
+    bool ReadMediaBounds(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMediaBounds(pugi::xml_node element);
@@ -2569,13 +2569,13 @@ private:
 class AttMedium : public Att {
 public:
     AttMedium();
-    virtual ~AttMedium();
+    ~AttMedium();
 
     /** Reset the default values for the attribute class **/
     void ResetMedium();
 
     /** Read the values for the attribute class **/
-    bool ReadMedium(pugi::xml_node element);
+    bool ReadMedium(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMedium(pugi::xml_node element);
@@ -2605,13 +2605,13 @@ private:
 class AttMeiVersion : public Att {
 public:
     AttMeiVersion();
-    virtual ~AttMeiVersion();
+    ~AttMeiVersion();
 
     /** Reset the default values for the attribute class **/
     void ResetMeiVersion();
 
     /** Read the values for the attribute class **/
-    bool ReadMeiVersion(pugi::xml_node element);
+    bool ReadMeiVersion(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeiVersion(pugi::xml_node element);
@@ -2641,13 +2641,13 @@ private:
 class AttMensurLog : public Att {
 public:
     AttMensurLog();
-    virtual ~AttMensurLog();
+    ~AttMensurLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMensurLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMensurLog(pugi::xml_node element);
+    bool ReadMensurLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMensurLog(pugi::xml_node element);
@@ -2683,13 +2683,13 @@ private:
 class AttMetadataPointing : public Att {
 public:
     AttMetadataPointing();
-    virtual ~AttMetadataPointing();
+    ~AttMetadataPointing();
 
     /** Reset the default values for the attribute class **/
     void ResetMetadataPointing();
 
     /** Read the values for the attribute class **/
-    bool ReadMetadataPointing(pugi::xml_node element);
+    bool ReadMetadataPointing(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMetadataPointing(pugi::xml_node element);
@@ -2723,13 +2723,13 @@ private:
 class AttMeterConformance : public Att {
 public:
     AttMeterConformance();
-    virtual ~AttMeterConformance();
+    ~AttMeterConformance();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterConformance();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterConformance(pugi::xml_node element);
+    bool ReadMeterConformance(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeterConformance(pugi::xml_node element);
@@ -2762,13 +2762,13 @@ private:
 class AttMeterConformanceBar : public Att {
 public:
     AttMeterConformanceBar();
-    virtual ~AttMeterConformanceBar();
+    ~AttMeterConformanceBar();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterConformanceBar();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterConformanceBar(pugi::xml_node element);
+    bool ReadMeterConformanceBar(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeterConformanceBar(pugi::xml_node element);
@@ -2812,13 +2812,13 @@ private:
 class AttMeterSigLog : public Att {
 public:
     AttMeterSigLog();
-    virtual ~AttMeterSigLog();
+    ~AttMeterSigLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigLog(pugi::xml_node element);
+    bool ReadMeterSigLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigLog(pugi::xml_node element);
@@ -2863,13 +2863,13 @@ private:
 class AttMeterSigDefaultLog : public Att {
 public:
     AttMeterSigDefaultLog();
-    virtual ~AttMeterSigDefaultLog();
+    ~AttMeterSigDefaultLog();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigDefaultLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigDefaultLog(pugi::xml_node element);
+    bool ReadMeterSigDefaultLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigDefaultLog(pugi::xml_node element);
@@ -2922,13 +2922,13 @@ private:
 class AttMmTempo : public Att {
 public:
     AttMmTempo();
-    virtual ~AttMmTempo();
+    ~AttMmTempo();
 
     /** Reset the default values for the attribute class **/
     void ResetMmTempo();
 
     /** Read the values for the attribute class **/
-    bool ReadMmTempo(pugi::xml_node element);
+    bool ReadMmTempo(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMmTempo(pugi::xml_node element);
@@ -2976,13 +2976,13 @@ private:
 class AttMultinumMeasures : public Att {
 public:
     AttMultinumMeasures();
-    virtual ~AttMultinumMeasures();
+    ~AttMultinumMeasures();
 
     /** Reset the default values for the attribute class **/
     void ResetMultinumMeasures();
 
     /** Read the values for the attribute class **/
-    bool ReadMultinumMeasures(pugi::xml_node element);
+    bool ReadMultinumMeasures(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMultinumMeasures(pugi::xml_node element);
@@ -3015,13 +3015,13 @@ private:
 class AttNInteger : public Att {
 public:
     AttNInteger();
-    virtual ~AttNInteger();
+    ~AttNInteger();
 
     /** Reset the default values for the attribute class **/
     void ResetNInteger();
 
     /** Read the values for the attribute class **/
-    bool ReadNInteger(pugi::xml_node element);
+    bool ReadNInteger(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNInteger(pugi::xml_node element);
@@ -3055,13 +3055,13 @@ private:
 class AttNNumberLike : public Att {
 public:
     AttNNumberLike();
-    virtual ~AttNNumberLike();
+    ~AttNNumberLike();
 
     /** Reset the default values for the attribute class **/
     void ResetNNumberLike();
 
     /** Read the values for the attribute class **/
-    bool ReadNNumberLike(pugi::xml_node element);
+    bool ReadNNumberLike(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNNumberLike(pugi::xml_node element);
@@ -3095,13 +3095,13 @@ private:
 class AttName : public Att {
 public:
     AttName();
-    virtual ~AttName();
+    ~AttName();
 
     /** Reset the default values for the attribute class **/
     void ResetName();
 
     /** Read the values for the attribute class **/
-    bool ReadName(pugi::xml_node element);
+    bool ReadName(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteName(pugi::xml_node element);
@@ -3143,13 +3143,13 @@ private:
 class AttNotationStyle : public Att {
 public:
     AttNotationStyle();
-    virtual ~AttNotationStyle();
+    ~AttNotationStyle();
 
     /** Reset the default values for the attribute class **/
     void ResetNotationStyle();
 
     /** Read the values for the attribute class **/
-    bool ReadNotationStyle(pugi::xml_node element);
+    bool ReadNotationStyle(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNotationStyle(pugi::xml_node element);
@@ -3187,13 +3187,13 @@ private:
 class AttNoteHeads : public Att {
 public:
     AttNoteHeads();
-    virtual ~AttNoteHeads();
+    ~AttNoteHeads();
 
     /** Reset the default values for the attribute class **/
     void ResetNoteHeads();
 
     /** Read the values for the attribute class **/
-    bool ReadNoteHeads(pugi::xml_node element);
+    bool ReadNoteHeads(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteNoteHeads(pugi::xml_node element);
@@ -3284,13 +3284,13 @@ private:
 class AttOctave : public Att {
 public:
     AttOctave();
-    virtual ~AttOctave();
+    ~AttOctave();
 
     /** Reset the default values for the attribute class **/
     void ResetOctave();
 
     /** Read the values for the attribute class **/
-    bool ReadOctave(pugi::xml_node element);
+    bool ReadOctave(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOctave(pugi::xml_node element);
@@ -3320,13 +3320,13 @@ private:
 class AttOctaveDefault : public Att {
 public:
     AttOctaveDefault();
-    virtual ~AttOctaveDefault();
+    ~AttOctaveDefault();
 
     /** Reset the default values for the attribute class **/
     void ResetOctaveDefault();
 
     /** Read the values for the attribute class **/
-    bool ReadOctaveDefault(pugi::xml_node element);
+    bool ReadOctaveDefault(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOctaveDefault(pugi::xml_node element);
@@ -3360,13 +3360,13 @@ private:
 class AttOctaveDisplacement : public Att {
 public:
     AttOctaveDisplacement();
-    virtual ~AttOctaveDisplacement();
+    ~AttOctaveDisplacement();
 
     /** Reset the default values for the attribute class **/
     void ResetOctaveDisplacement();
 
     /** Read the values for the attribute class **/
-    bool ReadOctaveDisplacement(pugi::xml_node element);
+    bool ReadOctaveDisplacement(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOctaveDisplacement(pugi::xml_node element);
@@ -3402,13 +3402,13 @@ private:
 class AttOneLineStaff : public Att {
 public:
     AttOneLineStaff();
-    virtual ~AttOneLineStaff();
+    ~AttOneLineStaff();
 
     /** Reset the default values for the attribute class **/
     void ResetOneLineStaff();
 
     /** Read the values for the attribute class **/
-    bool ReadOneLineStaff(pugi::xml_node element);
+    bool ReadOneLineStaff(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOneLineStaff(pugi::xml_node element);
@@ -3442,13 +3442,13 @@ private:
 class AttOptimization : public Att {
 public:
     AttOptimization();
-    virtual ~AttOptimization();
+    ~AttOptimization();
 
     /** Reset the default values for the attribute class **/
     void ResetOptimization();
 
     /** Read the values for the attribute class **/
-    bool ReadOptimization(pugi::xml_node element);
+    bool ReadOptimization(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOptimization(pugi::xml_node element);
@@ -3481,13 +3481,13 @@ private:
 class AttOriginLayerIdent : public Att {
 public:
     AttOriginLayerIdent();
-    virtual ~AttOriginLayerIdent();
+    ~AttOriginLayerIdent();
 
     /** Reset the default values for the attribute class **/
     void ResetOriginLayerIdent();
 
     /** Read the values for the attribute class **/
-    bool ReadOriginLayerIdent(pugi::xml_node element);
+    bool ReadOriginLayerIdent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOriginLayerIdent(pugi::xml_node element);
@@ -3517,13 +3517,13 @@ private:
 class AttOriginStaffIdent : public Att {
 public:
     AttOriginStaffIdent();
-    virtual ~AttOriginStaffIdent();
+    ~AttOriginStaffIdent();
 
     /** Reset the default values for the attribute class **/
     void ResetOriginStaffIdent();
 
     /** Read the values for the attribute class **/
-    bool ReadOriginStaffIdent(pugi::xml_node element);
+    bool ReadOriginStaffIdent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOriginStaffIdent(pugi::xml_node element);
@@ -3556,13 +3556,13 @@ private:
 class AttOriginStartEndId : public Att {
 public:
     AttOriginStartEndId();
-    virtual ~AttOriginStartEndId();
+    ~AttOriginStartEndId();
 
     /** Reset the default values for the attribute class **/
     void ResetOriginStartEndId();
 
     /** Read the values for the attribute class **/
-    bool ReadOriginStartEndId(pugi::xml_node element);
+    bool ReadOriginStartEndId(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOriginStartEndId(pugi::xml_node element);
@@ -3598,13 +3598,13 @@ private:
 class AttOriginTimestampLogical : public Att {
 public:
     AttOriginTimestampLogical();
-    virtual ~AttOriginTimestampLogical();
+    ~AttOriginTimestampLogical();
 
     /** Reset the default values for the attribute class **/
     void ResetOriginTimestampLogical();
 
     /** Read the values for the attribute class **/
-    bool ReadOriginTimestampLogical(pugi::xml_node element);
+    bool ReadOriginTimestampLogical(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteOriginTimestampLogical(pugi::xml_node element);
@@ -3647,13 +3647,13 @@ private:
 class AttPages : public Att {
 public:
     AttPages();
-    virtual ~AttPages();
+    ~AttPages();
 
     /** Reset the default values for the attribute class **/
     void ResetPages();
 
     /** Read the values for the attribute class **/
-    bool ReadPages(pugi::xml_node element);
+    bool ReadPages(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePages(pugi::xml_node element);
@@ -3731,13 +3731,13 @@ private:
 class AttPartIdent : public Att {
 public:
     AttPartIdent();
-    virtual ~AttPartIdent();
+    ~AttPartIdent();
 
     /** Reset the default values for the attribute class **/
     void ResetPartIdent();
 
     /** Read the values for the attribute class **/
-    bool ReadPartIdent(pugi::xml_node element);
+    bool ReadPartIdent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePartIdent(pugi::xml_node element);
@@ -3779,13 +3779,13 @@ private:
 class AttPitch : public Att {
 public:
     AttPitch();
-    virtual ~AttPitch();
+    ~AttPitch();
 
     /** Reset the default values for the attribute class **/
     void ResetPitch();
 
     /** Read the values for the attribute class **/
-    bool ReadPitch(pugi::xml_node element);
+    bool ReadPitch(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePitch(pugi::xml_node element);
@@ -3815,13 +3815,13 @@ private:
 class AttPlacement : public Att {
 public:
     AttPlacement();
-    virtual ~AttPlacement();
+    ~AttPlacement();
 
     /** Reset the default values for the attribute class **/
     void ResetPlacement();
 
     /** Read the values for the attribute class **/
-    bool ReadPlacement(pugi::xml_node element);
+    bool ReadPlacement(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePlacement(pugi::xml_node element);
@@ -3851,13 +3851,13 @@ private:
 class AttPlist : public Att {
 public:
     AttPlist();
-    virtual ~AttPlist();
+    ~AttPlist();
 
     /** Reset the default values for the attribute class **/
     void ResetPlist();
 
     /** Read the values for the attribute class **/
-    bool ReadPlist(pugi::xml_node element);
+    bool ReadPlist(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePlist(pugi::xml_node element);
@@ -3893,13 +3893,13 @@ private:
 class AttPointing : public Att {
 public:
     AttPointing();
-    virtual ~AttPointing();
+    ~AttPointing();
 
     /** Reset the default values for the attribute class **/
     void ResetPointing();
 
     /** Read the values for the attribute class **/
-    bool ReadPointing(pugi::xml_node element);
+    bool ReadPointing(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePointing(pugi::xml_node element);
@@ -3959,13 +3959,13 @@ private:
 class AttQuantity : public Att {
 public:
     AttQuantity();
-    virtual ~AttQuantity();
+    ~AttQuantity();
 
     /** Reset the default values for the attribute class **/
     void ResetQuantity();
 
     /** Read the values for the attribute class **/
-    bool ReadQuantity(pugi::xml_node element);
+    bool ReadQuantity(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteQuantity(pugi::xml_node element);
@@ -3998,13 +3998,13 @@ private:
 class AttRanging : public Att {
 public:
     AttRanging();
-    virtual ~AttRanging();
+    ~AttRanging();
 
     /** Reset the default values for the attribute class **/
     void ResetRanging();
 
     /** Read the values for the attribute class **/
-    bool ReadRanging(pugi::xml_node element);
+    bool ReadRanging(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteRanging(pugi::xml_node element);
@@ -4068,13 +4068,13 @@ private:
 class AttResponsibility : public Att {
 public:
     AttResponsibility();
-    virtual ~AttResponsibility();
+    ~AttResponsibility();
 
     /** Reset the default values for the attribute class **/
     void ResetResponsibility();
 
     /** Read the values for the attribute class **/
-    bool ReadResponsibility(pugi::xml_node element);
+    bool ReadResponsibility(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteResponsibility(pugi::xml_node element);
@@ -4108,13 +4108,13 @@ private:
 class AttScalable : public Att {
 public:
     AttScalable();
-    virtual ~AttScalable();
+    ~AttScalable();
 
     /** Reset the default values for the attribute class **/
     void ResetScalable();
 
     /** Read the values for the attribute class **/
-    bool ReadScalable(pugi::xml_node element);
+    bool ReadScalable(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteScalable(pugi::xml_node element);
@@ -4144,13 +4144,13 @@ private:
 class AttSequence : public Att {
 public:
     AttSequence();
-    virtual ~AttSequence();
+    ~AttSequence();
 
     /** Reset the default values for the attribute class **/
     void ResetSequence();
 
     /** Read the values for the attribute class **/
-    bool ReadSequence(pugi::xml_node element);
+    bool ReadSequence(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSequence(pugi::xml_node element);
@@ -4183,13 +4183,13 @@ private:
 class AttSlashCount : public Att {
 public:
     AttSlashCount();
-    virtual ~AttSlashCount();
+    ~AttSlashCount();
 
     /** Reset the default values for the attribute class **/
     void ResetSlashCount();
 
     /** Read the values for the attribute class **/
-    bool ReadSlashCount(pugi::xml_node element);
+    bool ReadSlashCount(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSlashCount(pugi::xml_node element);
@@ -4219,13 +4219,13 @@ private:
 class AttSlurPresent : public Att {
 public:
     AttSlurPresent();
-    virtual ~AttSlurPresent();
+    ~AttSlurPresent();
 
     /** Reset the default values for the attribute class **/
     void ResetSlurPresent();
 
     /** Read the values for the attribute class **/
-    bool ReadSlurPresent(pugi::xml_node element);
+    bool ReadSlurPresent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSlurPresent(pugi::xml_node element);
@@ -4258,13 +4258,13 @@ private:
 class AttSource : public Att {
 public:
     AttSource();
-    virtual ~AttSource();
+    ~AttSource();
 
     /** Reset the default values for the attribute class **/
     void ResetSource();
 
     /** Read the values for the attribute class **/
-    bool ReadSource(pugi::xml_node element);
+    bool ReadSource(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSource(pugi::xml_node element);
@@ -4298,13 +4298,13 @@ private:
 class AttSpacing : public Att {
 public:
     AttSpacing();
-    virtual ~AttSpacing();
+    ~AttSpacing();
 
     /** Reset the default values for the attribute class **/
     void ResetSpacing();
 
     /** Read the values for the attribute class **/
-    bool ReadSpacing(pugi::xml_node element);
+    bool ReadSpacing(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSpacing(pugi::xml_node element);
@@ -4361,13 +4361,13 @@ private:
 class AttStaffLog : public Att {
 public:
     AttStaffLog();
-    virtual ~AttStaffLog();
+    ~AttStaffLog();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffLog();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffLog(pugi::xml_node element);
+    bool ReadStaffLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStaffLog(pugi::xml_node element);
@@ -4397,13 +4397,13 @@ private:
 class AttStaffDefLog : public Att {
 public:
     AttStaffDefLog();
-    virtual ~AttStaffDefLog();
+    ~AttStaffDefLog();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffDefLog();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffDefLog(pugi::xml_node element);
+    bool ReadStaffDefLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStaffDefLog(pugi::xml_node element);
@@ -4433,13 +4433,13 @@ private:
 class AttStaffGroupingSym : public Att {
 public:
     AttStaffGroupingSym();
-    virtual ~AttStaffGroupingSym();
+    ~AttStaffGroupingSym();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffGroupingSym();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffGroupingSym(pugi::xml_node element);
+    bool ReadStaffGroupingSym(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStaffGroupingSym(pugi::xml_node element);
@@ -4469,13 +4469,13 @@ private:
 class AttStaffIdent : public Att {
 public:
     AttStaffIdent();
-    virtual ~AttStaffIdent();
+    ~AttStaffIdent();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffIdent();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffIdent(pugi::xml_node element);
+    bool ReadStaffIdent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStaffIdent(pugi::xml_node element);
@@ -4509,13 +4509,13 @@ private:
 class AttStaffItems : public Att {
 public:
     AttStaffItems();
-    virtual ~AttStaffItems();
+    ~AttStaffItems();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffItems();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffItems(pugi::xml_node element);
+    bool ReadStaffItems(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStaffItems(pugi::xml_node element);
@@ -4563,13 +4563,13 @@ private:
 class AttStaffLoc : public Att {
 public:
     AttStaffLoc();
-    virtual ~AttStaffLoc();
+    ~AttStaffLoc();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffLoc();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffLoc(pugi::xml_node element);
+    bool ReadStaffLoc(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStaffLoc(pugi::xml_node element);
@@ -4599,13 +4599,13 @@ private:
 class AttStaffLocPitched : public Att {
 public:
     AttStaffLocPitched();
-    virtual ~AttStaffLocPitched();
+    ~AttStaffLocPitched();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffLocPitched();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffLocPitched(pugi::xml_node element);
+    bool ReadStaffLocPitched(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStaffLocPitched(pugi::xml_node element);
@@ -4641,13 +4641,13 @@ private:
 class AttStartEndId : public Att {
 public:
     AttStartEndId();
-    virtual ~AttStartEndId();
+    ~AttStartEndId();
 
     /** Reset the default values for the attribute class **/
     void ResetStartEndId();
 
     /** Read the values for the attribute class **/
-    bool ReadStartEndId(pugi::xml_node element);
+    bool ReadStartEndId(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStartEndId(pugi::xml_node element);
@@ -4680,13 +4680,13 @@ private:
 class AttStartId : public Att {
 public:
     AttStartId();
-    virtual ~AttStartId();
+    ~AttStartId();
 
     /** Reset the default values for the attribute class **/
     void ResetStartId();
 
     /** Read the values for the attribute class **/
-    bool ReadStartId(pugi::xml_node element);
+    bool ReadStartId(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStartId(pugi::xml_node element);
@@ -4719,13 +4719,13 @@ private:
 class AttStems : public Att {
 public:
     AttStems();
-    virtual ~AttStems();
+    ~AttStems();
 
     /** Reset the default values for the attribute class **/
     void ResetStems();
 
     /** Read the values for the attribute class **/
-    bool ReadStems(pugi::xml_node element);
+    bool ReadStems(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStems(pugi::xml_node element);
@@ -4794,13 +4794,13 @@ private:
 class AttSylLog : public Att {
 public:
     AttSylLog();
-    virtual ~AttSylLog();
+    ~AttSylLog();
 
     /** Reset the default values for the attribute class **/
     void ResetSylLog();
 
     /** Read the values for the attribute class **/
-    bool ReadSylLog(pugi::xml_node element);
+    bool ReadSylLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSylLog(pugi::xml_node element);
@@ -4839,13 +4839,13 @@ private:
 class AttSylText : public Att {
 public:
     AttSylText();
-    virtual ~AttSylText();
+    ~AttSylText();
 
     /** Reset the default values for the attribute class **/
     void ResetSylText();
 
     /** Read the values for the attribute class **/
-    bool ReadSylText(pugi::xml_node element);
+    bool ReadSylText(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSylText(pugi::xml_node element);
@@ -4875,13 +4875,13 @@ private:
 class AttSystems : public Att {
 public:
     AttSystems();
-    virtual ~AttSystems();
+    ~AttSystems();
 
     /** Reset the default values for the attribute class **/
     void ResetSystems();
 
     /** Read the values for the attribute class **/
-    bool ReadSystems(pugi::xml_node element);
+    bool ReadSystems(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSystems(pugi::xml_node element);
@@ -4942,13 +4942,13 @@ private:
 class AttTargetEval : public Att {
 public:
     AttTargetEval();
-    virtual ~AttTargetEval();
+    ~AttTargetEval();
 
     /** Reset the default values for the attribute class **/
     void ResetTargetEval();
 
     /** Read the values for the attribute class **/
-    bool ReadTargetEval(pugi::xml_node element);
+    bool ReadTargetEval(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTargetEval(pugi::xml_node element);
@@ -4981,13 +4981,13 @@ private:
 class AttTempoLog : public Att {
 public:
     AttTempoLog();
-    virtual ~AttTempoLog();
+    ~AttTempoLog();
 
     /** Reset the default values for the attribute class **/
     void ResetTempoLog();
 
     /** Read the values for the attribute class **/
-    bool ReadTempoLog(pugi::xml_node element);
+    bool ReadTempoLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTempoLog(pugi::xml_node element);
@@ -5017,13 +5017,13 @@ private:
 class AttTextRendition : public Att {
 public:
     AttTextRendition();
-    virtual ~AttTextRendition();
+    ~AttTextRendition();
 
     /** Reset the default values for the attribute class **/
     void ResetTextRendition();
 
     /** Read the values for the attribute class **/
-    bool ReadTextRendition(pugi::xml_node element);
+    bool ReadTextRendition(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTextRendition(pugi::xml_node element);
@@ -5059,13 +5059,13 @@ private:
 class AttTextStyle : public Att {
 public:
     AttTextStyle();
-    virtual ~AttTextStyle();
+    ~AttTextStyle();
 
     /** Reset the default values for the attribute class **/
     void ResetTextStyle();
 
     /** Read the values for the attribute class **/
-    bool ReadTextStyle(pugi::xml_node element);
+    bool ReadTextStyle(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTextStyle(pugi::xml_node element);
@@ -5136,13 +5136,13 @@ private:
 class AttTiePresent : public Att {
 public:
     AttTiePresent();
-    virtual ~AttTiePresent();
+    ~AttTiePresent();
 
     /** Reset the default values for the attribute class **/
     void ResetTiePresent();
 
     /** Read the values for the attribute class **/
-    bool ReadTiePresent(pugi::xml_node element);
+    bool ReadTiePresent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTiePresent(pugi::xml_node element);
@@ -5175,13 +5175,13 @@ private:
 class AttTimestampLogical : public Att {
 public:
     AttTimestampLogical();
-    virtual ~AttTimestampLogical();
+    ~AttTimestampLogical();
 
     /** Reset the default values for the attribute class **/
     void ResetTimestampLogical();
 
     /** Read the values for the attribute class **/
-    bool ReadTimestampLogical(pugi::xml_node element);
+    bool ReadTimestampLogical(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTimestampLogical(pugi::xml_node element);
@@ -5214,13 +5214,13 @@ private:
 class AttTimestamp2Logical : public Att {
 public:
     AttTimestamp2Logical();
-    virtual ~AttTimestamp2Logical();
+    ~AttTimestamp2Logical();
 
     /** Reset the default values for the attribute class **/
     void ResetTimestamp2Logical();
 
     /** Read the values for the attribute class **/
-    bool ReadTimestamp2Logical(pugi::xml_node element);
+    bool ReadTimestamp2Logical(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTimestamp2Logical(pugi::xml_node element);
@@ -5253,13 +5253,13 @@ private:
 class AttTransposition : public Att {
 public:
     AttTransposition();
-    virtual ~AttTransposition();
+    ~AttTransposition();
 
     /** Reset the default values for the attribute class **/
     void ResetTransposition();
 
     /** Read the values for the attribute class **/
-    bool ReadTransposition(pugi::xml_node element);
+    bool ReadTransposition(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTransposition(pugi::xml_node element);
@@ -5301,13 +5301,13 @@ private:
 class AttTupletPresent : public Att {
 public:
     AttTupletPresent();
-    virtual ~AttTupletPresent();
+    ~AttTupletPresent();
 
     /** Reset the default values for the attribute class **/
     void ResetTupletPresent();
 
     /** Read the values for the attribute class **/
-    bool ReadTupletPresent(pugi::xml_node element);
+    bool ReadTupletPresent(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTupletPresent(pugi::xml_node element);
@@ -5340,13 +5340,13 @@ private:
 class AttTyped : public Att {
 public:
     AttTyped();
-    virtual ~AttTyped();
+    ~AttTyped();
 
     /** Reset the default values for the attribute class **/
     void ResetTyped();
 
     /** Read the values for the attribute class **/
-    bool ReadTyped(pugi::xml_node element);
+    bool ReadTyped(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTyped(pugi::xml_node element);
@@ -5379,13 +5379,13 @@ private:
 class AttTypography : public Att {
 public:
     AttTypography();
-    virtual ~AttTypography();
+    ~AttTypography();
 
     /** Reset the default values for the attribute class **/
     void ResetTypography();
 
     /** Read the values for the attribute class **/
-    bool ReadTypography(pugi::xml_node element);
+    bool ReadTypography(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTypography(pugi::xml_node element);
@@ -5445,13 +5445,13 @@ private:
 class AttVerticalAlign : public Att {
 public:
     AttVerticalAlign();
-    virtual ~AttVerticalAlign();
+    ~AttVerticalAlign();
 
     /** Reset the default values for the attribute class **/
     void ResetVerticalAlign();
 
     /** Read the values for the attribute class **/
-    bool ReadVerticalAlign(pugi::xml_node element);
+    bool ReadVerticalAlign(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVerticalAlign(pugi::xml_node element);
@@ -5481,13 +5481,13 @@ private:
 class AttVerticalGroup : public Att {
 public:
     AttVerticalGroup();
-    virtual ~AttVerticalGroup();
+    ~AttVerticalGroup();
 
     /** Reset the default values for the attribute class **/
     void ResetVerticalGroup();
 
     /** Read the values for the attribute class **/
-    bool ReadVerticalGroup(pugi::xml_node element);
+    bool ReadVerticalGroup(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVerticalGroup(pugi::xml_node element);
@@ -5517,13 +5517,13 @@ private:
 class AttVisibility : public Att {
 public:
     AttVisibility();
-    virtual ~AttVisibility();
+    ~AttVisibility();
 
     /** Reset the default values for the attribute class **/
     void ResetVisibility();
 
     /** Read the values for the attribute class **/
-    bool ReadVisibility(pugi::xml_node element);
+    bool ReadVisibility(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVisibility(pugi::xml_node element);
@@ -5556,13 +5556,13 @@ private:
 class AttVisualOffsetHo : public Att {
 public:
     AttVisualOffsetHo();
-    virtual ~AttVisualOffsetHo();
+    ~AttVisualOffsetHo();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualOffsetHo();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualOffsetHo(pugi::xml_node element);
+    bool ReadVisualOffsetHo(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffsetHo(pugi::xml_node element);
@@ -5596,13 +5596,13 @@ private:
 class AttVisualOffsetTo : public Att {
 public:
     AttVisualOffsetTo();
-    virtual ~AttVisualOffsetTo();
+    ~AttVisualOffsetTo();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualOffsetTo();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualOffsetTo(pugi::xml_node element);
+    bool ReadVisualOffsetTo(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffsetTo(pugi::xml_node element);
@@ -5635,13 +5635,13 @@ private:
 class AttVisualOffsetVo : public Att {
 public:
     AttVisualOffsetVo();
-    virtual ~AttVisualOffsetVo();
+    ~AttVisualOffsetVo();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualOffsetVo();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualOffsetVo(pugi::xml_node element);
+    bool ReadVisualOffsetVo(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffsetVo(pugi::xml_node element);
@@ -5675,13 +5675,13 @@ private:
 class AttVisualOffset2Ho : public Att {
 public:
     AttVisualOffset2Ho();
-    virtual ~AttVisualOffset2Ho();
+    ~AttVisualOffset2Ho();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualOffset2Ho();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualOffset2Ho(pugi::xml_node element);
+    bool ReadVisualOffset2Ho(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffset2Ho(pugi::xml_node element);
@@ -5723,13 +5723,13 @@ private:
 class AttVisualOffset2To : public Att {
 public:
     AttVisualOffset2To();
-    virtual ~AttVisualOffset2To();
+    ~AttVisualOffset2To();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualOffset2To();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualOffset2To(pugi::xml_node element);
+    bool ReadVisualOffset2To(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffset2To(pugi::xml_node element);
@@ -5771,13 +5771,13 @@ private:
 class AttVisualOffset2Vo : public Att {
 public:
     AttVisualOffset2Vo();
-    virtual ~AttVisualOffset2Vo();
+    ~AttVisualOffset2Vo();
 
     /** Reset the default values for the attribute class **/
     void ResetVisualOffset2Vo();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualOffset2Vo(pugi::xml_node element);
+    bool ReadVisualOffset2Vo(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVisualOffset2Vo(pugi::xml_node element);
@@ -5819,13 +5819,13 @@ private:
 class AttVoltaGroupingSym : public Att {
 public:
     AttVoltaGroupingSym();
-    virtual ~AttVoltaGroupingSym();
+    ~AttVoltaGroupingSym();
 
     /** Reset the default values for the attribute class **/
     void ResetVoltaGroupingSym();
 
     /** Read the values for the attribute class **/
-    bool ReadVoltaGroupingSym(pugi::xml_node element);
+    bool ReadVoltaGroupingSym(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteVoltaGroupingSym(pugi::xml_node element);
@@ -5855,13 +5855,13 @@ private:
 class AttWhitespace : public Att {
 public:
     AttWhitespace();
-    virtual ~AttWhitespace();
+    ~AttWhitespace();
 
     /** Reset the default values for the attribute class **/
     void ResetWhitespace();
 
     /** Read the values for the attribute class **/
-    bool ReadWhitespace(pugi::xml_node element);
+    bool ReadWhitespace(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteWhitespace(pugi::xml_node element);
@@ -5891,13 +5891,13 @@ private:
 class AttWidth : public Att {
 public:
     AttWidth();
-    virtual ~AttWidth();
+    ~AttWidth();
 
     /** Reset the default values for the attribute class **/
     void ResetWidth();
 
     /** Read the values for the attribute class **/
-    bool ReadWidth(pugi::xml_node element);
+    bool ReadWidth(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteWidth(pugi::xml_node element);
@@ -5927,13 +5927,13 @@ private:
 class AttXy : public Att {
 public:
     AttXy();
-    virtual ~AttXy();
+    ~AttXy();
 
     /** Reset the default values for the attribute class **/
     void ResetXy();
 
     /** Read the values for the attribute class **/
-    bool ReadXy(pugi::xml_node element);
+    bool ReadXy(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteXy(pugi::xml_node element);
@@ -5977,13 +5977,13 @@ private:
 class AttXy2 : public Att {
 public:
     AttXy2();
-    virtual ~AttXy2();
+    ~AttXy2();
 
     /** Reset the default values for the attribute class **/
     void ResetXy2();
 
     /** Read the values for the attribute class **/
-    bool ReadXy2(pugi::xml_node element);
+    bool ReadXy2(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteXy2(pugi::xml_node element);
@@ -44,12 +44,12 @@ void AttAltSym::ResetAltSym()
     m_altsym = "";
 }
 
-bool AttAltSym::ReadAltSym(pugi::xml_node element)
+bool AttAltSym::ReadAltSym(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("altsym")) {
-        this->SetAltsym(StrToStr(element.attribute("altsym").value()));
-        element.remove_attribute("altsym");
+    if (pugi::xml_attribute attribute = element.attribute("altsym")) {
+        this->SetAltsym(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +90,12 @@ void AttAnchoredTextLog::ResetAnchoredTextLog()
     m_func = "";
 }
 
-bool AttAnchoredTextLog::ReadAnchoredTextLog(pugi::xml_node element)
+bool AttAnchoredTextLog::ReadAnchoredTextLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -136,12 +136,12 @@ void AttCurveLog::ResetCurveLog()
     m_func = "";
 }
 
-bool AttCurveLog::ReadCurveLog(pugi::xml_node element)
+bool AttCurveLog::ReadCurveLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -182,12 +182,12 @@ void AttLineLog::ResetLineLog()
     m_func = "";
 }
 
-bool AttLineLog::ReadLineLog(pugi::xml_node element)
+bool AttLineLog::ReadLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        element.remove_attribute("func");
+    if (pugi::xml_attribute attribute = element.attribute("func")) {
+        this->SetFunc(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
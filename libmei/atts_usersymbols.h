@@ -32,13 +32,13 @@ namespace vrv {
 class AttAltSym : public Att {
 public:
     AttAltSym();
-    virtual ~AttAltSym();
+    ~AttAltSym();
 
     /** Reset the default values for the attribute class **/
     void ResetAltSym();
 
     /** Read the values for the attribute class **/
-    bool ReadAltSym(pugi::xml_node element);
+    bool ReadAltSym(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAltSym(pugi::xml_node element);
@@ -71,13 +71,13 @@ private:
 class AttAnchoredTextLog : public Att {
 public:
     AttAnchoredTextLog();
-    virtual ~AttAnchoredTextLog();
+    ~AttAnchoredTextLog();
 
     /** Reset the default values for the attribute class **/
     void ResetAnchoredTextLog();
 
     /** Read the values for the attribute class **/
-    bool ReadAnchoredTextLog(pugi::xml_node element);
+    bool ReadAnchoredTextLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAnchoredTextLog(pugi::xml_node element);
@@ -107,13 +107,13 @@ private:
 class AttCurveLog : public Att {
 public:
     AttCurveLog();
-    virtual ~AttCurveLog();
+    ~AttCurveLog();
 
     /** Reset the default values for the attribute class **/
     void ResetCurveLog();
 
     /** Read the values for the attribute class **/
-    bool ReadCurveLog(pugi::xml_node element);
+    bool ReadCurveLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCurveLog(pugi::xml_node element);
@@ -143,13 +143,13 @@ private:
 class AttLineLog : public Att {
 public:
     AttLineLog();
-    virtual ~AttLineLog();
+    ~AttLineLog();
 
     /** Reset the default values for the attribute class **/
     void ResetLineLog();
 
     /** Read the values for the attribute class **/
-    bool ReadLineLog(pugi::xml_node element);
+    bool ReadLineLog(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLineLog(pugi::xml_node element);
@@ -44,12 +44,12 @@ void AttAnnotVis::ResetAnnotVis()
     m_place = data_PLACEMENT();
 }
 
-bool AttAnnotVis::ReadAnnotVis(pugi::xml_node element)
+bool AttAnnotVis::ReadAnnotVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToPlacement(element.attribute("place").value()));
-        element.remove_attribute("place");
+    if (pugi::xml_attribute attribute = element.attribute("place")) {
+        this->SetPlace(StrToPlacement(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -96,42 +96,42 @@ void AttArpegVis::ResetArpegVis()
     m_lineWidth = data_LINEWIDTH();
 }
 
-bool AttArpegVis::ReadArpegVis(pugi::xml_node element)
+bool AttArpegVis::ReadArpegVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("arrow")) {
-        this->SetArrow(StrToBoolean(element.attribute("arrow").value()));
-        element.remove_attribute("arrow");
+    if (pugi::xml_attribute attribute = element.attribute("arrow")) {
+        this->SetArrow(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("arrow.shape")) {
-        this->SetArrowShape(StrToLinestartendsymbol(element.attribute("arrow.shape").value()));
-        element.remove_attribute("arrow.shape");
+    if (pugi::xml_attribute attribute = element.attribute("arrow.shape")) {
+        this->SetArrowShape(StrToLinestartendsymbol(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("arrow.size")) {
-        this->SetArrowSize(StrToInt(element.attribute("arrow.size").value()));
-        element.remove_attribute("arrow.size");
+    if (pugi::xml_attribute attribute = element.attribute("arrow.size")) {
+        this->SetArrowSize(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("arrow.color")) {
-        this->SetArrowColor(StrToStr(element.attribute("arrow.color").value()));
-        element.remove_attribute("arrow.color");
+    if (pugi::xml_attribute attribute = element.attribute("arrow.color")) {
+        this->SetArrowColor(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("arrow.fillcolor")) {
-        this->SetArrowFillcolor(StrToStr(element.attribute("arrow.fillcolor").value()));
-        element.remove_attribute("arrow.fillcolor");
+    if (pugi::xml_attribute attribute = element.attribute("arrow.fillcolor")) {
+        this->SetArrowFillcolor(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("line.form")) {
-        this->SetLineForm(StrToLineform(element.attribute("line.form").value()));
-        element.remove_attribute("line.form");
+    if (pugi::xml_attribute attribute = element.attribute("line.form")) {
+        this->SetLineForm(StrToLineform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("line.width")) {
-        this->SetLineWidth(StrToLinewidth(element.attribute("line.width").value()));
-        element.remove_attribute("line.width");
+    if (pugi::xml_attribute attribute = element.attribute("line.width")) {
+        this->SetLineWidth(StrToLinewidth(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -228,22 +228,22 @@ void AttBarLineVis::ResetBarLineVis()
     m_place = 0;
 }
 
-bool AttBarLineVis::ReadBarLineVis(pugi::xml_node element)
+bool AttBarLineVis::ReadBarLineVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("len")) {
-        this->SetLen(StrToDbl(element.attribute("len").value()));
-        element.remove_attribute("len");
+    if (pugi::xml_attribute attribute = element.attribute("len")) {
+        this->SetLen(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("method")) {
-        this->SetMethod(StrToBarmethod(element.attribute("method").value()));
-        element.remove_attribute("method");
+    if (pugi::xml_attribute attribute = element.attribute("method")) {
+        this->SetMethod(StrToBarmethod(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToInt(element.attribute("place").value()));
-        element.remove_attribute("place");
+    if (pugi::xml_attribute attribute = element.attribute("place")) {
+        this->SetPlace(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -304,22 +304,22 @@ void AttBeamingVis::ResetBeamingVis()
     m_beamSlope = 0.0;
 }
 
-bool AttBeamingVis::ReadBeamingVis(pugi::xml_node element)
+bool AttBeamingVis::ReadBeamingVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.color")) {
-        this->SetBeamColor(StrToStr(element.attribute("beam.color").value()));
-        element.remove_attribute("beam.color");
+    if (pugi::xml_attribute attribute = element.attribute("beam.color")) {
+        this->SetBeamColor(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("beam.rend")) {
-        this->SetBeamRend(StrToBeamingVisBeamrend(element.attribute("beam.rend").value()));
-        element.remove_attribute("beam.rend");
+    if (pugi::xml_attribute attribute = element.attribute("beam.rend")) {
+        this->SetBeamRend(StrToBeamingVisBeamrend(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("beam.slope")) {
-        this->SetBeamSlope(StrToDbl(element.attribute("beam.slope").value()));
-        element.remove_attribute("beam.slope");
+    if (pugi::xml_attribute attribute = element.attribute("beam.slope")) {
+        this->SetBeamSlope(StrToDbl(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -378,12 +378,12 @@ void AttBeatRptVis::ResetBeatRptVis()
     m_slash = BEATRPT_REND_NONE;
 }
 
-bool AttBeatRptVis::ReadBeatRptVis(pugi::xml_node element)
+bool AttBeatRptVis::ReadBeatRptVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBeatrptRend(element.attribute("slash").value()));
-        element.remove_attribute("slash");
+    if (pugi::xml_attribute attribute = element.attribute("slash")) {
+        this->SetSlash(StrToBeatrptRend(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -424,12 +424,12 @@ void AttChordVis::ResetChordVis()
     m_cluster = CLUSTER_NONE;
 }
 
-bool AttChordVis::ReadChordVis(pugi::xml_node element)
+bool AttChordVis::ReadChordVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cluster")) {
-        this->SetCluster(StrToCluster(element.attribute("cluster").value()));
-        element.remove_attribute("cluster");
+    if (pugi::xml_attribute attribute = element.attribute("cluster")) {
+        this->SetCluster(StrToCluster(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -471,17 +471,17 @@ void AttCleffingVis::ResetCleffingVis()
     m_clefVisible = BOOLEAN_NONE;
 }
 
-bool AttCleffingVis::ReadCleffingVis(pugi::xml_node element)
+bool AttCleffingVis::ReadCleffingVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.color")) {
-        this->SetClefColor(StrToStr(element.attribute("clef.color").value()));
-        element.remove_attribute("clef.color");
+    if (pugi::xml_attribute attribute = element.attribute("clef.color")) {
+        this->SetClefColor(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("clef.visible")) {
-        this->SetClefVisible(StrToBoolean(element.attribute("clef.visible").value()));
-        element.remove_attribute("clef.visible");
+    if (pugi::xml_attribute attribute = element.attribute("clef.visible")) {
+        this->SetClefVisible(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -532,17 +532,17 @@ void AttEpisemaVis::ResetEpisemaVis()
     m_place = data_EVENTREL();
 }
 
-bool AttEpisemaVis::ReadEpisemaVis(pugi::xml_node element)
+bool AttEpisemaVis::ReadEpisemaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToEpisemaVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToEpisemaVisForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        element.remove_attribute("place");
+    if (pugi::xml_attribute attribute = element.attribute("place")) {
+        this->SetPlace(StrToEventrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -594,22 +594,22 @@ void AttFTremVis::ResetFTremVis()
     m_floatGap = VRV_UNSET;
 }
 
-bool AttFTremVis::ReadFTremVis(pugi::xml_node element)
+bool AttFTremVis::ReadFTremVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beams")) {
-        this->SetBeams(StrToInt(element.attribute("beams").value()));
-        element.remove_attribute("beams");
+    if (pugi::xml_attribute attribute = element.attribute("beams")) {
+        this->SetBeams(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("beams.float")) {
-        this->SetBeamsFloat(StrToInt(element.attribute("beams.float").value()));
-        element.remove_attribute("beams.float");
+    if (pugi::xml_attribute attribute = element.attribute("beams.float")) {
+        this->SetBeamsFloat(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("float.gap")) {
-        this->SetFloatGap(StrToMeasurementabs(element.attribute("float.gap").value()));
-        element.remove_attribute("float.gap");
+    if (pugi::xml_attribute attribute = element.attribute("float.gap")) {
+        this->SetFloatGap(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -669,17 +669,17 @@ void AttFermataVis::ResetFermataVis()
     m_shape = fermataVis_SHAPE_NONE;
 }
 
-bool AttFermataVis::ReadFermataVis(pugi::xml_node element)
+bool AttFermataVis::ReadFermataVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFermataVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToFermataVisForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("shape")) {
-        this->SetShape(StrToFermataVisShape(element.attribute("shape").value()));
-        element.remove_attribute("shape");
+    if (pugi::xml_attribute attribute = element.attribute("shape")) {
+        this->SetShape(StrToFermataVisShape(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -729,12 +729,12 @@ void AttFingGrpVis::ResetFingGrpVis()
     m_orient = fingGrpVis_ORIENT_NONE;
 }
 
-bool AttFingGrpVis::ReadFingGrpVis(pugi::xml_node element)
+bool AttFingGrpVis::ReadFingGrpVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToFingGrpVisOrient(element.attribute("orient").value()));
-        element.remove_attribute("orient");
+    if (pugi::xml_attribute attribute = element.attribute("orient")) {
+        this->SetOrient(StrToFingGrpVisOrient(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -775,12 +775,12 @@ void AttHairpinVis::ResetHairpinVis()
     m_opening = VRV_UNSET;
 }
 
-bool AttHairpinVis::ReadHairpinVis(pugi::xml_node element)
+bool AttHairpinVis::ReadHairpinVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("opening")) {
-        this->SetOpening(StrToMeasurementabs(element.attribute("opening").value()));
-        element.remove_attribute("opening");
+    if (pugi::xml_attribute attribute = element.attribute("opening")) {
+        this->SetOpening(StrToMeasurementabs(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -821,12 +821,12 @@ void AttHarmVis::ResetHarmVis()
     m_rendgrid = harmVis_RENDGRID_NONE;
 }
 
-bool AttHarmVis::ReadHarmVis(pugi::xml_node element)
+bool AttHarmVis::ReadHarmVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("rendgrid")) {
-        this->SetRendgrid(StrToHarmVisRendgrid(element.attribute("rendgrid").value()));
-        element.remove_attribute("rendgrid");
+    if (pugi::xml_attribute attribute = element.attribute("rendgrid")) {
+        this->SetRendgrid(StrToHarmVisRendgrid(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -868,17 +868,17 @@ void AttHispanTickVis::ResetHispanTickVis()
     m_tilt = data_COMPASSDIRECTION();
 }
 
-bool AttHispanTickVis::ReadHispanTickVis(pugi::xml_node element)
+bool AttHispanTickVis::ReadHispanTickVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        element.remove_attribute("place");
+    if (pugi::xml_attribute attribute = element.attribute("place")) {
+        this->SetPlace(StrToEventrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        element.remove_attribute("tilt");
+    if (pugi::xml_attribute attribute = element.attribute("tilt")) {
+        this->SetTilt(StrToCompassdirection(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -928,12 +928,12 @@ void AttKeySigVis::ResetKeySigVis()
     m_sigShowchange = BOOLEAN_NONE;
 }
 
-bool AttKeySigVis::ReadKeySigVis(pugi::xml_node element)
+bool AttKeySigVis::ReadKeySigVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig.showchange")) {
-        this->SetSigShowchange(StrToBoolean(element.attribute("sig.showchange").value()));
-        element.remove_attribute("sig.showchange");
+    if (pugi::xml_attribute attribute = element.attribute("sig.showchange")) {
+        this->SetSigShowchange(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -975,17 +975,17 @@ void AttKeySigDefaultVis::ResetKeySigDefaultVis()
     m_keysigShowchange = BOOLEAN_NONE;
 }
 
-bool AttKeySigDefaultVis::ReadKeySigDefaultVis(pugi::xml_node element)
+bool AttKeySigDefaultVis::ReadKeySigDefaultVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("keysig.show")) {
-        this->SetKeysigShow(StrToBoolean(element.attribute("keysig.show").value()));
-        element.remove_attribute("keysig.show");
+    if (pugi::xml_attribute attribute = element.attribute("keysig.show")) {
+        this->SetKeysigShow(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("keysig.showchange")) {
-        this->SetKeysigShowchange(StrToBoolean(element.attribute("keysig.showchange").value()));
-        element.remove_attribute("keysig.showchange");
+    if (pugi::xml_attribute attribute = element.attribute("keysig.showchange")) {
+        this->SetKeysigShowchange(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1040,37 +1040,37 @@ void AttLineVis::ResetLineVis()
     m_startsymSize = 0;
 }
 
-bool AttLineVis::ReadLineVis(pugi::xml_node element)
+bool AttLineVis::ReadLineVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLineform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToLineform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("width")) {
-        this->SetWidth(StrToLinewidth(element.attribute("width").value()));
-        element.remove_attribute("width");
+    if (pugi::xml_attribute attribute = element.attribute("width")) {
+        this->SetWidth(StrToLinewidth(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endsym")) {
-        this->SetEndsym(StrToLinestartendsymbol(element.attribute("endsym").value()));
-        element.remove_attribute("endsym");
+    if (pugi::xml_attribute attribute = element.attribute("endsym")) {
+        this->SetEndsym(StrToLinestartendsymbol(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("endsym.size")) {
-        this->SetEndsymSize(StrToInt(element.attribute("endsym.size").value()));
-        element.remove_attribute("endsym.size");
+    if (pugi::xml_attribute attribute = element.attribute("endsym.size")) {
+        this->SetEndsymSize(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("startsym")) {
-        this->SetStartsym(StrToLinestartendsymbol(element.attribute("startsym").value()));
-        element.remove_attribute("startsym");
+    if (pugi::xml_attribute attribute = element.attribute("startsym")) {
+        this->SetStartsym(StrToLinestartendsymbol(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("startsym.size")) {
-        this->SetStartsymSize(StrToInt(element.attribute("startsym.size").value()));
-        element.remove_attribute("startsym.size");
+    if (pugi::xml_attribute attribute = element.attribute("startsym.size")) {
+        this->SetStartsymSize(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1157,17 +1157,17 @@ void AttLiquescentVis::ResetLiquescentVis()
     m_looped = BOOLEAN_NONE;
 }
 
-bool AttLiquescentVis::ReadLiquescentVis(pugi::xml_node element)
+bool AttLiquescentVis::ReadLiquescentVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("curve")) {
-        this->SetCurve(StrToLiquescentVisCurve(element.attribute("curve").value()));
-        element.remove_attribute("curve");
+    if (pugi::xml_attribute attribute = element.attribute("curve")) {
+        this->SetCurve(StrToLiquescentVisCurve(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("looped")) {
-        this->SetLooped(StrToBoolean(element.attribute("looped").value()));
-        element.remove_attribute("looped");
+    if (pugi::xml_attribute attribute = element.attribute("looped")) {
+        this->SetLooped(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1218,17 +1218,17 @@ void AttMensurVis::ResetMensurVis()
     m_orient = ORIENTATION_NONE;
 }
 
-bool AttMensurVis::ReadMensurVis(pugi::xml_node element)
+bool AttMensurVis::ReadMensurVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMensurVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToMensurVisForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToOrientation(element.attribute("orient").value()));
-        element.remove_attribute("orient");
+    if (pugi::xml_attribute attribute = element.attribute("orient")) {
+        this->SetOrient(StrToOrientation(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1282,32 +1282,32 @@ void AttMensuralVis::ResetMensuralVis()
     m_mensurSize = data_FONTSIZE();
 }
 
-bool AttMensuralVis::ReadMensuralVis(pugi::xml_node element)
+bool AttMensuralVis::ReadMensuralVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mensur.color")) {
-        this->SetMensurColor(StrToStr(element.attribute("mensur.color").value()));
-        element.remove_attribute("mensur.color");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.color")) {
+        this->SetMensurColor(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.form")) {
-        this->SetMensurForm(StrToMensuralVisMensurform(element.attribute("mensur.form").value()));
-        element.remove_attribute("mensur.form");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.form")) {
+        this->SetMensurForm(StrToMensuralVisMensurform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.loc")) {
-        this->SetMensurLoc(StrToInt(element.attribute("mensur.loc").value()));
-        element.remove_attribute("mensur.loc");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.loc")) {
+        this->SetMensurLoc(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.orient")) {
-        this->SetMensurOrient(StrToOrientation(element.attribute("mensur.orient").value()));
-        element.remove_attribute("mensur.orient");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.orient")) {
+        this->SetMensurOrient(StrToOrientation(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.size")) {
-        this->SetMensurSize(StrToFontsize(element.attribute("mensur.size").value()));
-        element.remove_attribute("mensur.size");
+    if (pugi::xml_attribute attribute = element.attribute("mensur.size")) {
+        this->SetMensurSize(StrToFontsize(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1384,12 +1384,12 @@ void AttMeterSigVis::ResetMeterSigVis()
     m_form = METERFORM_NONE;
 }
 
-bool AttMeterSigVis::ReadMeterSigVis(pugi::xml_node element)
+bool AttMeterSigVis::ReadMeterSigVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMeterform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToMeterform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1431,17 +1431,17 @@ void AttMeterSigDefaultVis::ResetMeterSigDefaultVis()
     m_meterShowchange = BOOLEAN_NONE;
 }
 
-bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(pugi::xml_node element)
+bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.form")) {
-        this->SetMeterForm(StrToMeterform(element.attribute("meter.form").value()));
-        element.remove_attribute("meter.form");
+    if (pugi::xml_attribute attribute = element.attribute("meter.form")) {
+        this->SetMeterForm(StrToMeterform(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("meter.showchange")) {
-        this->SetMeterShowchange(StrToBoolean(element.attribute("meter.showchange").value()));
-        element.remove_attribute("meter.showchange");
+    if (pugi::xml_attribute attribute = element.attribute("meter.showchange")) {
+        this->SetMeterShowchange(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1491,12 +1491,12 @@ void AttMultiRestVis::ResetMultiRestVis()
     m_block = BOOLEAN_NONE;
 }
 
-bool AttMultiRestVis::ReadMultiRestVis(pugi::xml_node element)
+bool AttMultiRestVis::ReadMultiRestVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("block")) {
-        this->SetBlock(StrToBoolean(element.attribute("block").value()));
-        element.remove_attribute("block");
+    if (pugi::xml_attribute attribute = element.attribute("block")) {
+        this->SetBlock(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1537,12 +1537,12 @@ void AttPbVis::ResetPbVis()
     m_folium = pbVis_FOLIUM_NONE;
 }
 
-bool AttPbVis::ReadPbVis(pugi::xml_node element)
+bool AttPbVis::ReadPbVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("folium")) {
-        this->SetFolium(StrToPbVisFolium(element.attribute("folium").value()));
-        element.remove_attribute("folium");
+    if (pugi::xml_attribute attribute = element.attribute("folium")) {
+        this->SetFolium(StrToPbVisFolium(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1583,12 +1583,12 @@ void AttPedalVis::ResetPedalVis()
     m_form = pedalVis_FORM_NONE;
 }
 
-bool AttPedalVis::ReadPedalVis(pugi::xml_node element)
+bool AttPedalVis::ReadPedalVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToPedalVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToPedalVisForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1629,12 +1629,12 @@ void AttQuilismaVis::ResetQuilismaVis()
     m_waves = 0;
 }
 
-bool AttQuilismaVis::ReadQuilismaVis(pugi::xml_node element)
+bool AttQuilismaVis::ReadQuilismaVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("waves")) {
-        this->SetWaves(StrToInt(element.attribute("waves").value()));
-        element.remove_attribute("waves");
+    if (pugi::xml_attribute attribute = element.attribute("waves")) {
+        this->SetWaves(StrToInt(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1675,12 +1675,12 @@ void AttSbVis::ResetSbVis()
     m_form = sbVis_FORM_NONE;
 }
 
-bool AttSbVis::ReadSbVis(pugi::xml_node element)
+bool AttSbVis::ReadSbVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToSbVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    if (pugi::xml_attribute attribute = element.attribute("form")) {
+        this->SetForm(StrToSbVisForm(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1721,12 +1721,12 @@ void AttScoreDefVis::ResetScoreDefVis()
     m_vuHeight = "";
 }
 
-bool AttScoreDefVis::ReadScoreDefVis(pugi::xml_node element)
+bool AttScoreDefVis::ReadScoreDefVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vu.height")) {
-        this->SetVuHeight(StrToStr(element.attribute("vu.height").value()));
-        element.remove_attribute("vu.height");
+    if (pugi::xml_attribute attribute = element.attribute("vu.height")) {
+        this->SetVuHeight(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1767,12 +1767,12 @@ void AttSectionVis::ResetSectionVis()
     m_restart = BOOLEAN_NONE;
 }
 
-bool AttSectionVis::ReadSectionVis(pugi::xml_node element)
+bool AttSectionVis::ReadSectionVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("restart")) {
-        this->SetRestart(StrToBoolean(element.attribute("restart").value()));
-        element.remove_attribute("restart");
+    if (pugi::xml_attribute attribute = element.attribute("restart")) {
+        this->SetRestart(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1813,12 +1813,12 @@ void AttSignifLetVis::ResetSignifLetVis()
     m_place = data_EVENTREL();
 }
 
-bool AttSignifLetVis::ReadSignifLetVis(pugi::xml_node element)
+bool AttSignifLetVis::ReadSignifLetVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToEventrel(element.attribute("place").value()));
-        element.remove_attribute("place");
+    if (pugi::xml_attribute attribute = element.attribute("place")) {
+        this->SetPlace(StrToEventrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1859,12 +1859,12 @@ void AttSpaceVis::ResetSpaceVis()
     m_compressable = BOOLEAN_NONE;
 }
 
-bool AttSpaceVis::ReadSpaceVis(pugi::xml_node element)
+bool AttSpaceVis::ReadSpaceVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("compressable")) {
-        this->SetCompressable(StrToBoolean(element.attribute("compressable").value()));
-        element.remove_attribute("compressable");
+    if (pugi::xml_attribute attribute = element.attribute("compressable")) {
+        this->SetCompressable(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1909,32 +1909,32 @@ void AttStaffDefVis::ResetStaffDefVis()
     m_spacing = VRV_UNSET;
 }
 
-bool AttStaffDefVis::ReadStaffDefVis(pugi::xml_node element)
+bool AttStaffDefVis::ReadStaffDefVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        element.remove_attribute("grid.show");
+    if (pugi::xml_attribute attribute = element.attribute("grid.show")) {
+        this->SetGridShow(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("layerscheme")) {
-        this->SetLayerscheme(StrToLayerscheme(element.attribute("layerscheme").value()));
-        element.remove_attribute("layerscheme");
+    if (pugi::xml_attribute attribute = element.attribute("layerscheme")) {
+        this->SetLayerscheme(StrToLayerscheme(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lines.color")) {
-        this->SetLinesColor(StrToStr(element.attribute("lines.color").value()));
-        element.remove_attribute("lines.color");
+    if (pugi::xml_attribute attribute = element.attribute("lines.color")) {
+        this->SetLinesColor(StrToStr(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("lines.visible")) {
-        this->SetLinesVisible(StrToBoolean(element.attribute("lines.visible").value()));
-        element.remove_attribute("lines.visible");
+    if (pugi::xml_attribute attribute = element.attribute("lines.visible")) {
+        this->SetLinesVisible(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("spacing")) {
-        this->SetSpacing(StrToMeasurementrel(element.attribute("spacing").value()));
-        element.remove_attribute("spacing");
+    if (pugi::xml_attribute attribute = element.attribute("spacing")) {
+        this->SetSpacing(StrToMeasurementrel(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2011,12 +2011,12 @@ void AttStaffGrpVis::ResetStaffGrpVis()
     m_barThru = BOOLEAN_NONE;
 }
 
-bool AttStaffGrpVis::ReadStaffGrpVis(pugi::xml_node element)
+bool AttStaffGrpVis::ReadStaffGrpVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bar.thru")) {
-        this->SetBarThru(StrToBoolean(element.attribute("bar.thru").value()));
-        element.remove_attribute("bar.thru");
+    if (pugi::xml_attribute attribute = element.attribute("bar.thru")) {
+        this->SetBarThru(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2060,27 +2060,27 @@ void AttTupletVis::ResetTupletVis()
     m_numFormat = tupletVis_NUMFORMAT_NONE;
 }
 
-bool AttTupletVis::ReadTupletVis(pugi::xml_node element)
+bool AttTupletVis::ReadTupletVis(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("bracket.place")) {
-        this->SetBracketPlace(StrToStaffrelBasic(element.attribute("bracket.place").value()));
-        element.remove_attribute("bracket.place");
+    if (pugi::xml_attribute attribute = element.attribute("bracket.place")) {
+        this->SetBracketPlace(StrToStaffrelBasic(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("bracket.visible")) {
-        this->SetBracketVisible(StrToBoolean(element.attribute("bracket.visible").value()));
-        element.remove_attribute("bracket.visible");
+    if (pugi::xml_attribute attribute = element.attribute("bracket.visible")) {
+        this->SetBracketVisible(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("dur.visible")) {
-        this->SetDurVisible(StrToBoolean(element.attribute("dur.visible").value()));
-        element.remove_attribute("dur.visible");
+    if (pugi::xml_attribute attribute = element.attribute("dur.visible")) {
+        this->SetDurVisible(StrToBoolean(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
-    if (element.attribute("num.format")) {
-        this->SetNumFormat(StrToTupletVisNumformat(element.attribute("num.format").value()));
-        element.remove_attribute("num.format");
+    if (pugi::xml_attribute attribute = element.attribute("num.format")) {
+        this->SetNumFormat(StrToTupletVisNumformat(attribute.value()));
+        if (removeAttr) element.remove_attribute(attribute);
         hasAttribute = true;
     }
     return hasAttribute;
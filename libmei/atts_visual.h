@@ -32,13 +32,13 @@ namespace vrv {
 class AttAnnotVis : public Att {
 public:
     AttAnnotVis();
-    virtual ~AttAnnotVis();
+    ~AttAnnotVis();
 
     /** Reset the default values for the attribute class **/
     void ResetAnnotVis();
 
     /** Read the values for the attribute class **/
-    bool ReadAnnotVis(pugi::xml_node element);
+    bool ReadAnnotVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteAnnotVis(pugi::xml_node element);
@@ -70,13 +70,13 @@ private:
 class AttArpegVis : public Att {
 public:
     AttArpegVis();
-    virtual ~AttArpegVis();
+    ~AttArpegVis();
 
     /** Reset the default values for the attribute class **/
     void ResetArpegVis();
 
     /** Read the values for the attribute class **/
-    bool ReadArpegVis(pugi::xml_node element);
+    bool ReadArpegVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteArpegVis(pugi::xml_node element);
@@ -144,13 +144,13 @@ private:
 class AttBarLineVis : public Att {
 public:
     AttBarLineVis();
-    virtual ~AttBarLineVis();
+    ~AttBarLineVis();
 
     /** Reset the default values for the attribute class **/
     void ResetBarLineVis();
 
     /** Read the values for the attribute class **/
-    bool ReadBarLineVis(pugi::xml_node element);
+    bool ReadBarLineVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBarLineVis(pugi::xml_node element);
@@ -196,13 +196,13 @@ private:
 class AttBeamingVis : public Att {
 public:
     AttBeamingVis();
-    virtual ~AttBeamingVis();
+    ~AttBeamingVis();
 
     /** Reset the default values for the attribute class **/
     void ResetBeamingVis();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamingVis(pugi::xml_node element);
+    bool ReadBeamingVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBeamingVis(pugi::xml_node element);
@@ -244,13 +244,13 @@ private:
 class AttBeatRptVis : public Att {
 public:
     AttBeatRptVis();
-    virtual ~AttBeatRptVis();
+    ~AttBeatRptVis();
 
     /** Reset the default values for the attribute class **/
     void ResetBeatRptVis();
 
     /** Read the values for the attribute class **/
-    bool ReadBeatRptVis(pugi::xml_node element);
+    bool ReadBeatRptVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteBeatRptVis(pugi::xml_node element);
@@ -280,13 +280,13 @@ private:
 class AttChordVis : public Att {
 public:
     AttChordVis();
-    virtual ~AttChordVis();
+    ~AttChordVis();
 
     /** Reset the default values for the attribute class **/
     void ResetChordVis();
 
     /** Read the values for the attribute class **/
-    bool ReadChordVis(pugi::xml_node element);
+    bool ReadChordVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteChordVis(pugi::xml_node element);
@@ -321,13 +321,13 @@ private:
 class AttCleffingVis : public Att {
 public:
     AttCleffingVis();
-    virtual ~AttCleffingVis();
+    ~AttCleffingVis();
 
     /** Reset the default values for the attribute class **/
     void ResetCleffingVis();
 
     /** Read the values for the attribute class **/
-    bool ReadCleffingVis(pugi::xml_node element);
+    bool ReadCleffingVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteCleffingVis(pugi::xml_node element);
@@ -363,13 +363,13 @@ private:
 class AttEpisemaVis : public Att {
 public:
     AttEpisemaVis();
-    virtual ~AttEpisemaVis();
+    ~AttEpisemaVis();
 
     /** Reset the default values for the attribute class **/
     void ResetEpisemaVis();
 
     /** Read the values for the attribute class **/
-    bool ReadEpisemaVis(pugi::xml_node element);
+    bool ReadEpisemaVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteEpisemaVis(pugi::xml_node element);
@@ -405,13 +405,13 @@ private:
 class AttFTremVis : public Att {
 public:
     AttFTremVis();
-    virtual ~AttFTremVis();
+    ~AttFTremVis();
 
     /** Reset the default values for the attribute class **/
     void ResetFTremVis();
 
     /** Read the values for the attribute class **/
-    bool ReadFTremVis(pugi::xml_node element);
+    bool ReadFTremVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteFTremVis(pugi::xml_node element);
@@ -453,13 +453,13 @@ private:
 class AttFermataVis : public Att {
 public:
     AttFermataVis();
-    virtual ~AttFermataVis();
+    ~AttFermataVis();
 
     /** Reset the default values for the attribute class **/
     void ResetFermataVis();
 
     /** Read the values for the attribute class **/
-    bool ReadFermataVis(pugi::xml_node element);
+    bool ReadFermataVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteFermataVis(pugi::xml_node element);
@@ -495,13 +495,13 @@ private:
 class AttFingGrpVis : public Att {
 public:
     AttFingGrpVis();
-    virtual ~AttFingGrpVis();
+    ~AttFingGrpVis();
 
     /** Reset the default values for the attribute class **/
     void ResetFingGrpVis();
 
     /** Read the values for the attribute class **/
-    bool ReadFingGrpVis(pugi::xml_node element);
+    bool ReadFingGrpVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteFingGrpVis(pugi::xml_node element);
@@ -531,13 +531,13 @@ private:
 class AttHairpinVis : public Att {
 public:
     AttHairpinVis();
-    virtual ~AttHairpinVis();
+    ~AttHairpinVis();
 
     /** Reset the default values for the attribute class **/
     void ResetHairpinVis();
 
     /** Read the values for the attribute class **/
-    bool ReadHairpinVis(pugi::xml_node element);
+    bool ReadHairpinVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHairpinVis(pugi::xml_node element);
@@ -570,13 +570,13 @@ private:
 class AttHarmVis : public Att {
 public:
     AttHarmVis();
-    virtual ~AttHarmVis();
+    ~AttHarmVis();
 
     /** Reset the default values for the attribute class **/
     void ResetHarmVis();
 
     /** Read the values for the attribute class **/
-    bool ReadHarmVis(pugi::xml_node element);
+    bool ReadHarmVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHarmVis(pugi::xml_node element);
@@ -606,13 +606,13 @@ private:
 class AttHispanTickVis : public Att {
 public:
     AttHispanTickVis();
-    virtual ~AttHispanTickVis();
+    ~AttHispanTickVis();
 
     /** Reset the default values for the attribute class **/
     void ResetHispanTickVis();
 
     /** Read the values for the attribute class **/
-    bool ReadHispanTickVis(pugi::xml_node element);
+    bool ReadHispanTickVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteHispanTickVis(pugi::xml_node element);
@@ -648,13 +648,13 @@ private:
 class AttKeySigVis : public Att {
 public:
     AttKeySigVis();
-    virtual ~AttKeySigVis();
+    ~AttKeySigVis();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigVis();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigVis(pugi::xml_node element);
+    bool ReadKeySigVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigVis(pugi::xml_node element);
@@ -684,13 +684,13 @@ private:
 class AttKeySigDefaultVis : public Att {
 public:
     AttKeySigDefaultVis();
-    virtual ~AttKeySigDefaultVis();
+    ~AttKeySigDefaultVis();
 
     /** Reset the default values for the attribute class **/
     void ResetKeySigDefaultVis();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigDefaultVis(pugi::xml_node element);
+    bool ReadKeySigDefaultVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultVis(pugi::xml_node element);
@@ -726,13 +726,13 @@ private:
 class AttLineVis : public Att {
 public:
     AttLineVis();
-    virtual ~AttLineVis();
+    ~AttLineVis();
 
     /** Reset the default values for the attribute class **/
     void ResetLineVis();
 
     /** Read the values for the attribute class **/
-    bool ReadLineVis(pugi::xml_node element);
+    bool ReadLineVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLineVis(pugi::xml_node element);
@@ -794,13 +794,13 @@ private:
 class AttLiquescentVis : public Att {
 public:
     AttLiquescentVis();
-    virtual ~AttLiquescentVis();
+    ~AttLiquescentVis();
 
     /** Reset the default values for the attribute class **/
     void ResetLiquescentVis();
 
     /** Read the values for the attribute class **/
-    bool ReadLiquescentVis(pugi::xml_node element);
+    bool ReadLiquescentVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteLiquescentVis(pugi::xml_node element);
@@ -836,13 +836,13 @@ private:
 class AttMensurVis : public Att {
 public:
     AttMensurVis();
-    virtual ~AttMensurVis();
+    ~AttMensurVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMensurVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMensurVis(pugi::xml_node element);
+    bool ReadMensurVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMensurVis(pugi::xml_node element);
@@ -878,13 +878,13 @@ private:
 class AttMensuralVis : public Att {
 public:
     AttMensuralVis();
-    virtual ~AttMensuralVis();
+    ~AttMensuralVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMensuralVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMensuralVis(pugi::xml_node element);
+    bool ReadMensuralVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMensuralVis(pugi::xml_node element);
@@ -943,13 +943,13 @@ private:
 class AttMeterSigVis : public Att {
 public:
     AttMeterSigVis();
-    virtual ~AttMeterSigVis();
+    ~AttMeterSigVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigVis(pugi::xml_node element);
+    bool ReadMeterSigVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigVis(pugi::xml_node element);
@@ -979,13 +979,13 @@ private:
 class AttMeterSigDefaultVis : public Att {
 public:
     AttMeterSigDefaultVis();
-    virtual ~AttMeterSigDefaultVis();
+    ~AttMeterSigDefaultVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMeterSigDefaultVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigDefaultVis(pugi::xml_node element);
+    bool ReadMeterSigDefaultVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigDefaultVis(pugi::xml_node element);
@@ -1024,13 +1024,13 @@ private:
 class AttMultiRestVis : public Att {
 public:
     AttMultiRestVis();
-    virtual ~AttMultiRestVis();
+    ~AttMultiRestVis();
 
     /** Reset the default values for the attribute class **/
     void ResetMultiRestVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMultiRestVis(pugi::xml_node element);
+    bool ReadMultiRestVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteMultiRestVis(pugi::xml_node element);
@@ -1064,13 +1064,13 @@ private:
 class AttPbVis : public Att {
 public:
     AttPbVis();
-    virtual ~AttPbVis();
+    ~AttPbVis();
 
     /** Reset the default values for the attribute class **/
     void ResetPbVis();
 
     /** Read the values for the attribute class **/
-    bool ReadPbVis(pugi::xml_node element);
+    bool ReadPbVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePbVis(pugi::xml_node element);
@@ -1103,13 +1103,13 @@ private:
 class AttPedalVis : public Att {
 public:
     AttPedalVis();
-    virtual ~AttPedalVis();
+    ~AttPedalVis();
 
     /** Reset the default values for the attribute class **/
     void ResetPedalVis();
 
     /** Read the values for the attribute class **/
-    bool ReadPedalVis(pugi::xml_node element);
+    bool ReadPedalVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WritePedalVis(pugi::xml_node element);
@@ -1139,13 +1139,13 @@ private:
 class AttQuilismaVis : public Att {
 public:
     AttQuilismaVis();
-    virtual ~AttQuilismaVis();
+    ~AttQuilismaVis();
 
     /** Reset the default values for the attribute class **/
     void ResetQuilismaVis();
 
     /** Read the values for the attribute class **/
-    bool ReadQuilismaVis(pugi::xml_node element);
+    bool ReadQuilismaVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteQuilismaVis(pugi::xml_node element);
@@ -1175,13 +1175,13 @@ private:
 class AttSbVis : public Att {
 public:
     AttSbVis();
-    virtual ~AttSbVis();
+    ~AttSbVis();
 
     /** Reset the default values for the attribute class **/
     void ResetSbVis();
 
     /** Read the values for the attribute class **/
-    bool ReadSbVis(pugi::xml_node element);
+    bool ReadSbVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSbVis(pugi::xml_node element);
@@ -1211,13 +1211,13 @@ private:
 class AttScoreDefVis : public Att {
 public:
     AttScoreDefVis();
-    virtual ~AttScoreDefVis();
+    ~AttScoreDefVis();
 
     /** Reset the default values for the attribute class **/
     void ResetScoreDefVis();
 
     /** Read the values for the attribute class **/
-    bool ReadScoreDefVis(pugi::xml_node element);
+    bool ReadScoreDefVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteScoreDefVis(pugi::xml_node element);
@@ -1251,13 +1251,13 @@ private:
 class AttSectionVis : public Att {
 public:
     AttSectionVis();
-    virtual ~AttSectionVis();
+    ~AttSectionVis();
 
     /** Reset the default values for the attribute class **/
     void ResetSectionVis();
 
     /** Read the values for the attribute class **/
-    bool ReadSectionVis(pugi::xml_node element);
+    bool ReadSectionVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSectionVis(pugi::xml_node element);
@@ -1287,13 +1287,13 @@ private:
 class AttSignifLetVis : public Att {
 public:
     AttSignifLetVis();
-    virtual ~AttSignifLetVis();
+    ~AttSignifLetVis();
 
     /** Reset the default values for the attribute class **/
     void ResetSignifLetVis();
 
     /** Read the values for the attribute class **/
-    bool ReadSignifLetVis(pugi::xml_node element);
+    bool ReadSignifLetVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSignifLetVis(pugi::xml_node element);
@@ -1323,13 +1323,13 @@ private:
 class AttSpaceVis : public Att {
 public:
     AttSpaceVis();
-    virtual ~AttSpaceVis();
+    ~AttSpaceVis();
 
     /** Reset the default values for the attribute class **/
     void ResetSpaceVis();
 
     /** Read the values for the attribute class **/
-    bool ReadSpaceVis(pugi::xml_node element);
+    bool ReadSpaceVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteSpaceVis(pugi::xml_node element);
@@ -1362,13 +1362,13 @@ private:
 class AttStaffDefVis : public Att {
 public:
     AttStaffDefVis();
-    virtual ~AttStaffDefVis();
+    ~AttStaffDefVis();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffDefVis();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffDefVis(pugi::xml_node element);
+    bool ReadStaffDefVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStaffDefVis(pugi::xml_node element);
@@ -1428,13 +1428,13 @@ private:
 class AttStaffGrpVis : public Att {
 public:
     AttStaffGrpVis();
-    virtual ~AttStaffGrpVis();
+    ~AttStaffGrpVis();
 
     /** Reset the default values for the attribute class **/
     void ResetStaffGrpVis();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffGrpVis(pugi::xml_node element);
+    bool ReadStaffGrpVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteStaffGrpVis(pugi::xml_node element);
@@ -1467,13 +1467,13 @@ private:
 class AttTupletVis : public Att {
 public:
     AttTupletVis();
-    virtual ~AttTupletVis();
+    ~AttTupletVis();
 
     /** Reset the default values for the attribute class **/
     void ResetTupletVis();
 
     /** Read the values for the attribute class **/
-    bool ReadTupletVis(pugi::xml_node element);
+    bool ReadTupletVis(pugi::xml_node element, bool removeAttr = true);
 
     /** Write the values for the attribute class **/
     bool WriteTupletVis(pugi::xml_node element);
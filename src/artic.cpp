@@ -252,19 +252,19 @@ void ArticPart::AddSlurPositioner(FloatingCurvePositioner *positioner, bool star
 
 int Artic::CalcArtic(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     /************** Get the parent and the stem direction **************/
 
     LayerElement *parent = NULL;
     Note *parentNote = NULL;
-    Chord *parentChord = dynamic_cast<Chord *>(this->GetFirstAncestor(CHORD, 2));
+    Chord *parentChord = vrv_cast<Chord *>(this->GetFirstAncestor(CHORD, 2));
     data_STEMDIRECTION stemDir = STEMDIRECTION_NONE;
     data_STAFFREL place = STAFFREL_NONE;
 
     if (!parentChord) {
-        parentNote = dynamic_cast<Note *>(this->GetFirstAncestor(NOTE));
+        parentNote = vrv_cast<Note *>(this->GetFirstAncestor(NOTE));
         parent = parentNote;
     }
     else {
@@ -276,9 +276,9 @@ int Artic::CalcArtic(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
     assert(layer);
 
     stemDir = parentNote ? parentNote->GetDrawingStemDir() : parentChord->GetDrawingStemDir();
@@ -435,7 +435,7 @@ int Artic::PrepareLayerElementParts(FunctorParams *functorParams)
 
     /************ Prepare the drawing cue size ************/
 
-    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize);
+    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize, "PrepareDrawingCueSize");
     this->Process(&prepareDrawingCueSize, NULL);
 
     return FUNCTOR_CONTINUE;
@@ -462,7 +462,7 @@ int ArticPart::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int ArticPart::AdjustArticWithSlurs(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     if (m_startSlurPositioners.empty() && m_endSlurPositioners.empty()) return FUNCTOR_CONTINUE;
@@ -9,6 +9,8 @@
 
 //----------------------------------------------------------------------------
 
+#include <assert.h>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <stdlib.h>
@@ -20,6 +22,64 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// AttClassTable
+//----------------------------------------------------------------------------
+
+/** The mutex for creating the tables - lookups go through a cache per thread */
+static std::mutex s_attClassTableMutex;
+
+const AttClassTable *AttClassTable::GetEmpty()
+{
+    static const AttClassTable *empty = new AttClassTable();
+    return empty;
+}
+
+const AttClassTable *AttClassTable::WithAttClass(AttClassId attClassId) const
+{
+    return this->GetNext((int)attClassId + 1, NULL, INTERFACE);
+}
+
+const AttClassTable *AttClassTable::WithInterface(
+    const std::vector<AttClassId> *attClasses, InterfaceId interfaceId) const
+{
+    assert(attClasses);
+    return this->GetNext(-(int)interfaceId - 1, attClasses, interfaceId);
+}
+
+const AttClassTable *AttClassTable::GetNext(
+    int key, const std::vector<AttClassId> *attClasses, InterfaceId interfaceId) const
+{
+    // A direct-mapped cache of the transitions already looked up by the thread
+    struct Transition {
+        const AttClassTable *m_from = NULL;
+        int m_key = 0;
+        const AttClassTable *m_to = NULL;
+    };
+    static thread_local Transition cache[256];
+    Transition &cached = cache[((uintptr_t)this / sizeof(AttClassTable) + key * 31) & 255];
+    if ((cached.m_from == this) && (cached.m_key == key)) return cached.m_to;
+
+    std::lock_guard<std::mutex> lock(s_attClassTableMutex);
+    const AttClassTable *&next = m_next[key];
+    if (!next) {
+        AttClassTable *table = new AttClassTable(*this);
+        table->m_next.clear();
+        if (key > 0) {
+            table->m_attClasses.push_back((AttClassId)(key - 1));
+        }
+        else {
+            table->m_attClasses.insert(table->m_attClasses.end(), attClasses->begin(), attClasses->end());
+            table->m_interfaces.push_back(interfaceId);
+        }
+        next = table;
+    }
+    cached.m_from = this;
+    cached.m_key = key;
+    cached.m_to = next;
+    return next;
+}
+
 //----------------------------------------------------------------------------
 // Att
 //----------------------------------------------------------------------------
@@ -158,35 +218,54 @@ std::string Att::DurationToStr(data_DURATION data) const
     return value;
 }
 
-data_DURATION Att::StrToDuration(std::string value, bool logWarning) const
-{
-    if (value == "maxima") return DURATION_maxima;
-    if (value == "longa") return DURATION_longa;
-    if (value == "brevis") return DURATION_brevis;
-    if (value == "semibrevis") return DURATION_semibrevis;
-    if (value == "minima") return DURATION_minima;
-    if (value == "semiminima") return DURATION_semiminima;
-    if (value == "fusa") return DURATION_fusa;
-    if (value == "semifusa") return DURATION_semifusa;
-    if (value == "long") return DURATION_long;
-    if (value == "breve") return DURATION_breve;
-    if (value == "1") return DURATION_1;
-    if (value == "2") return DURATION_2;
-    if (value == "4") return DURATION_4;
-    if (value == "8") return DURATION_8;
-    if (value == "16") return DURATION_16;
-    if (value == "32") return DURATION_32;
-    if (value == "64") return DURATION_64;
-    if (value == "128") return DURATION_128;
-    if (value == "256") return DURATION_256;
-    if (value == "512") return DURATION_512;
-    if (value == "1024") return DURATION_1024;
-    if ((value.length() > 0) && (value[value.length() - 1] == 'p')) {
+data_DURATION Att::StrToDuration(std::string_view value, bool logWarning) const
+{
+    switch (value.size()) {
+        case 1:
+            if (value == "1") return DURATION_1;
+            if (value == "2") return DURATION_2;
+            if (value == "4") return DURATION_4;
+            if (value == "8") return DURATION_8;
+            break;
+        case 2:
+            if (value == "16") return DURATION_16;
+            if (value == "32") return DURATION_32;
+            if (value == "64") return DURATION_64;
+            break;
+        case 3:
+            if (value == "128") return DURATION_128;
+            if (value == "256") return DURATION_256;
+            if (value == "512") return DURATION_512;
+            break;
+        case 4:
+            if (value == "long") return DURATION_long;
+            if (value == "fusa") return DURATION_fusa;
+            if (value == "1024") return DURATION_1024;
+            break;
+        case 5:
+            if (value == "longa") return DURATION_longa;
+            if (value == "breve") return DURATION_breve;
+            break;
+        case 6:
+            if (value == "maxima") return DURATION_maxima;
+            if (value == "brevis") return DURATION_brevis;
+            if (value == "minima") return DURATION_minima;
+            break;
+        case 8:
+            if (value == "semifusa") return DURATION_semifusa;
+            break;
+        case 10:
+            if (value == "semibrevis") return DURATION_semibrevis;
+            if (value == "semiminima") return DURATION_semiminima;
+            break;
+        default: break;
+    }
+    if ((value.length() > 0) && (value.back() == 'p')) {
         // if (logWarning)
         // LogWarning("PPQ duration dur_s are not supported"); // remove it for now
     }
     else {
-        LogWarning("Unknown dur '%s'", value.c_str());
+        LogWarning("Unknown dur '%s'", std::string(value).c_str());
     }
     return DURATION_NONE;
 }
@@ -563,16 +642,21 @@ std::string Att::PitchnameToStr(data_PITCHNAME data) const
     return value;
 }
 
-data_PITCHNAME Att::StrToPitchname(std::string value, bool logWarning) const
+data_PITCHNAME Att::StrToPitchname(std::string_view value, bool logWarning) const
 {
-    if (value == "c") return PITCHNAME_c;
-    if (value == "d") return PITCHNAME_d;
-    if (value == "e") return PITCHNAME_e;
-    if (value == "f") return PITCHNAME_f;
-    if (value == "g") return PITCHNAME_g;
-    if (value == "a") return PITCHNAME_a;
-    if (value == "b") return PITCHNAME_b;
-    if (logWarning && !value.empty()) LogWarning("Unsupported pitch name '%s'", value.c_str());
+    if (value.size() == 1) {
+        switch (value[0]) {
+            case 'c': return PITCHNAME_c;
+            case 'd': return PITCHNAME_d;
+            case 'e': return PITCHNAME_e;
+            case 'f': return PITCHNAME_f;
+            case 'g': return PITCHNAME_g;
+            case 'a': return PITCHNAME_a;
+            case 'b': return PITCHNAME_b;
+            default: break;
+        }
+    }
+    if (logWarning && !value.empty()) LogWarning("Unsupported pitch name '%s'", std::string(value).c_str());
     return PITCHNAME_NONE;
 }
 
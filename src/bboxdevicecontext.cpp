@@ -39,6 +39,7 @@ BBoxDeviceContext::BBoxDeviceContext(View *view, int width, int height, unsigned
     SetPen(AxNONE, 1, AxSOLID);
 
     m_update = update;
+    m_graphicCount = 0;
 
     ResetGraphicRotation();
 }
@@ -50,6 +51,7 @@ void BBoxDeviceContext::StartGraphic(Object *object, std::string gClass, std::st
     // add the object object
     object->BoundingBox::ResetBoundingBox();
     m_objects.push_back(object);
+    ++m_graphicCount;
 
     ResetGraphicRotation();
 }
@@ -323,7 +325,7 @@ void BBoxDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, bo
 
     for (unsigned int i = 0; i < text.length(); i++) {
         wchar_t c = text.at(i);
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = m_resources->GetGlyph(c);
         if (!glyph) {
             continue;
         }
@@ -369,21 +371,25 @@ void BBoxDeviceContext::UpdateBB(int x1, int y1, int x2, int y2, wchar_t glyph)
     assert(!m_objects.empty());
 
     // we need to store logical coordinates in the objects, we need to convert them back (this is why we need a View
-    // object)
+    // object) - this is done once for the object and all the ones containing it
+    const int logicalX1 = m_view->ToLogicalX(x1);
+    const int logicalX2 = m_view->ToLogicalX(x2);
+    const int logicalY1 = m_view->ToLogicalY(y1);
+    const int logicalY2 = m_view->ToLogicalY(y2);
+
     if (!m_isDeactivatedX) {
-        (m_objects.back())->UpdateSelfBBoxX(m_view->ToLogicalX(x1), m_view->ToLogicalX(x2));
+        (m_objects.back())->UpdateSelfBBoxX(logicalX1, logicalX2);
         if (glyph != 0) (m_objects.back())->SetBoundingBoxGlyph(glyph, m_fontStack.top()->GetPointSize());
     }
     if (!m_isDeactivatedY) {
-        (m_objects.back())->UpdateSelfBBoxY(m_view->ToLogicalY(y1), m_view->ToLogicalY(y2));
+        (m_objects.back())->UpdateSelfBBoxY(logicalY1, logicalY2);
         if (glyph != 0) (m_objects.back())->SetBoundingBoxGlyph(glyph, m_fontStack.top()->GetPointSize());
     }
 
-    int i;
     // Stretch the content BB of the other objects
-    for (i = 0; i < (int)m_objects.size(); i++) {
-        if (!m_isDeactivatedX) (m_objects.at(i))->UpdateContentBBoxX(m_view->ToLogicalX(x1), m_view->ToLogicalX(x2));
-        if (!m_isDeactivatedY) (m_objects.at(i))->UpdateContentBBoxY(m_view->ToLogicalY(y1), m_view->ToLogicalY(y2));
+    for (Object *object : m_objects) {
+        if (!m_isDeactivatedX) object->UpdateContentBBoxX(logicalX1, logicalX2);
+        if (!m_isDeactivatedY) object->UpdateContentBBoxY(logicalY1, logicalY2);
     }
 }
 
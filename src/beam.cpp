@@ -113,7 +113,7 @@ void BeamDrawingParams::CalcBeam(
     for (i = 0; i < elementCount; ++i) {
 
         if ((*beamElementCoords).at(i)->m_element->Is(CHORD)) {
-            Chord *chord = dynamic_cast<Chord *>((*beamElementCoords).at(i)->m_element);
+            Chord *chord = vrv_cast<Chord *>((*beamElementCoords).at(i)->m_element);
             assert(chord);
             chord->GetYExtremes(yMax, yMin);
             (*beamElementCoords).at(i)->m_yTop = yMax;
@@ -425,7 +425,7 @@ void Beam::FilterList(ArrayOfObjects *childList)
             continue;
         }
         else {
-            LayerElement *element = dynamic_cast<LayerElement *>(*iter);
+            LayerElement *element = vrv_cast<LayerElement *>(*iter);
             assert(element);
             // if we are at the beginning of the beam
             // and the note is cueSize
@@ -442,7 +442,7 @@ void Beam::FilterList(ArrayOfObjects *childList)
             }
             // also remove notes within chords
             if (element->Is(NOTE)) {
-                Note *note = dynamic_cast<Note *>(element);
+                Note *note = vrv_cast<Note *>(element);
                 assert(note);
                 if (note->IsChordTone()) {
                     iter = childList->erase(iter);
@@ -462,7 +462,7 @@ int Beam::GetPosition(LayerElement *element)
     int position = this->GetListIndex(element);
     // Check if this is a note in the chord
     if ((position == -1) && (element->Is(NOTE))) {
-        Note *note = dynamic_cast<Note *>(element);
+        Note *note = vrv_cast<Note *>(element);
         assert(note);
         Chord *chord = note->IsChordTone();
         if (chord) position = this->GetListIndex(chord);
@@ -640,7 +640,7 @@ BeamElementCoord::~BeamElementCoord()
 
 int Beam::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
+    CalcStemParams *params = vrv_cast<CalcStemParams *>(functorParams);
     assert(params);
 
     const ArrayOfObjects *beamChildren = this->GetList(this);
@@ -653,9 +653,9 @@ int Beam::CalcStem(FunctorParams *functorParams)
 
     int elementCount = (int)beamChildren->size();
 
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
     assert(layer);
-    Staff *staff = dynamic_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
     assert(staff);
 
     this->m_drawingParams.CalcBeam(layer, staff, params->m_doc, beamElementCoords, elementCount);
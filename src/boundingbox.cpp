@@ -317,12 +317,12 @@ int BoundingBox::VerticalBottomOverlap(const BoundingBox *other, Doc *doc, int m
 int BoundingBox::GetRectangles(
     const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2, Point rect[3][2], Doc *doc) const
 {
-    Glyph *glyph = NULL;
+    const Glyph *glyph = NULL;
 
     bool glyphRect = true;
 
     if (m_smuflGlyph != 0) {
-        glyph = Resources::GetGlyph(m_smuflGlyph);
+        glyph = doc->GetResources().GetGlyph(m_smuflGlyph);
         assert(glyph);
 
         if (glyph->HasAnchor(anchor1) && glyph->HasAnchor(anchor2)) {
@@ -348,8 +348,8 @@ int BoundingBox::GetRectangles(
     return 1;
 }
 
-bool BoundingBox::GetGlyph2PointRectangles(
-    const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2, Glyph *glyph, Point rect[3][2], Doc *doc) const
+bool BoundingBox::GetGlyph2PointRectangles(const SMuFLGlyphAnchor &anchor1, const SMuFLGlyphAnchor &anchor2,
+    const Glyph *glyph, Point rect[3][2], Doc *doc) const
 {
     assert(glyph);
 
@@ -437,7 +437,7 @@ bool BoundingBox::GetGlyph2PointRectangles(
 }
 
 bool BoundingBox::GetGlyph1PointRectangles(
-    const SMuFLGlyphAnchor &anchor, Glyph *glyph, Point rect[2][2], Doc *doc) const
+    const SMuFLGlyphAnchor &anchor, const Glyph *glyph, Point rect[2][2], Doc *doc) const
 {
     assert(glyph);
 
@@ -528,7 +528,9 @@ int BoundingBox::Intersects(FloatingCurvePositioner *curve, Accessor type, int m
     if (p1.x > this->GetRightBy(type)) return 0;
 
     Point topBezier[4], bottomBezier[4];
-    BoundingBox::CalcThickBezier(points, curve->GetThickness(), curve->GetAngle(), topBezier, bottomBezier);
+    curve->GetThickBezier(topBezier, bottomBezier);
+    const BezierCurve &topCurve = curve->GetTopCurve();
+    const BezierCurve &bottomCurve = curve->GetBottomCurve();
 
     // The curve overflows on both sides
     if ((p1.x < this->GetLeftBy(type)) && p2.x > this->GetRightBy(type)) {
@@ -537,13 +539,13 @@ int BoundingBox::Intersects(FloatingCurvePositioner *curve, Accessor type, int m
             // The curve is already below the content
             if ((curve->GetTopBy(type) + margin) < this->GetBottomBy(type)) return 0;
             int xMaxY = curve->CalcMinMaxY(topBezier);
-            int leftY = BoundingBox::CalcBezierAtPosition(bottomBezier, this->GetLeftBy(type)) + margin;
-            int rightY = BoundingBox::CalcBezierAtPosition(bottomBezier, this->GetRightBy(type)) + margin;
+            int leftY = bottomCurve.CalcYAtPosition(this->GetLeftBy(type)) + margin;
+            int rightY = bottomCurve.CalcYAtPosition(this->GetRightBy(type)) + margin;
             // Everything is underneath
             if ((leftY >= this->GetTopBy(type)) && (rightY >= this->GetTopBy(type))) return 0;
             // Recalculate for above
-            leftY = BoundingBox::CalcBezierAtPosition(topBezier, this->GetLeftBy(type)) + margin;
-            rightY = BoundingBox::CalcBezierAtPosition(topBezier, this->GetRightBy(type)) + margin;
+            leftY = topCurve.CalcYAtPosition(this->GetLeftBy(type)) + margin;
+            rightY = topCurve.CalcYAtPosition(this->GetRightBy(type)) + margin;
             // The box is above the summit of the curve
             if ((this->GetLeftBy(type) < (p1.x + xMaxY)) && (this->GetRightBy(type) > (p1.x + xMaxY)))
                 return (curve->GetTopBy(type) - this->GetBottomBy(type) + margin);
@@ -558,12 +560,12 @@ int BoundingBox::Intersects(FloatingCurvePositioner *curve, Accessor type, int m
             if ((curve->GetBottomBy(type) - margin) > this->GetTopBy(type)) return 0;
             int xMinY = curve->CalcMinMaxY(bottomBezier);
             // Check if the box is above
-            int leftY = BoundingBox::CalcBezierAtPosition(topBezier, this->GetLeftBy(type)) - margin;
-            int rightY = BoundingBox::CalcBezierAtPosition(topBezier, this->GetRightBy(type)) - margin;
+            int leftY = topCurve.CalcYAtPosition(this->GetLeftBy(type)) - margin;
+            int rightY = topCurve.CalcYAtPosition(this->GetRightBy(type)) - margin;
             if ((leftY <= this->GetBottomBy(type)) && (rightY <= this->GetBottomBy(type))) return 0;
             // Recalculate for below
-            leftY = BoundingBox::CalcBezierAtPosition(bottomBezier, this->GetLeftBy(type)) - margin;
-            rightY = BoundingBox::CalcBezierAtPosition(bottomBezier, this->GetRightBy(type)) - margin;
+            leftY = bottomCurve.CalcYAtPosition(this->GetLeftBy(type)) - margin;
+            rightY = bottomCurve.CalcYAtPosition(this->GetRightBy(type)) - margin;
             // The box is above the summit of the curve
             if ((this->GetLeftBy(type) < (p1.x + xMinY)) && (this->GetRightBy(type) > (p1.x + xMinY)))
                 return (curve->GetBottomBy(type) - this->GetTopBy(type) - margin);
@@ -586,7 +588,7 @@ int BoundingBox::Intersects(FloatingCurvePositioner *curve, Accessor type, int m
             if (this->GetLeftBy(type) < (p1.x + xMaxY))
                 return (curve->GetTopBy(type) - this->GetBottomBy(type) + margin);
             // Calcultate the Y position of the curve one the left
-            int leftY = BoundingBox::CalcBezierAtPosition(topBezier, this->GetLeftBy(type)) + margin;
+            int leftY = topCurve.CalcYAtPosition(this->GetLeftBy(type)) + margin;
             // LogDebug("leftY %d, %d, %d", leftY, this->GetBottomBy(type), this->GetTopBy(type));
             // The content left is below the bottom
             if (leftY < this->GetBottomBy(type)) return 0;
@@ -601,7 +603,7 @@ int BoundingBox::Intersects(FloatingCurvePositioner *curve, Accessor type, int m
             if (this->GetLeftBy(type) < (p1.x + xMinY))
                 return (curve->GetBottomBy(type) - this->GetTopBy(type) - margin);
             // Calcultate the Y position of the curve one the left
-            int leftY = BoundingBox::CalcBezierAtPosition(bottomBezier, this->GetLeftBy(type)) - margin;
+            int leftY = bottomCurve.CalcYAtPosition(this->GetLeftBy(type)) - margin;
             // LogDebug("leftY %d, %d, %d", leftY, this->GetBottomBy(type), this->GetTopBy(type));
             // The content left is above the top
             if (leftY > this->GetTopBy(type)) return 0;
@@ -621,7 +623,7 @@ int BoundingBox::Intersects(FloatingCurvePositioner *curve, Accessor type, int m
             if (this->GetRightBy(type) > (p1.x + xMaxY))
                 return (curve->GetTopBy(type) - this->GetBottomBy(type) + margin);
             // Calcultate the Y position of the curve one the right
-            int rightY = BoundingBox::CalcBezierAtPosition(topBezier, this->GetRightBy(type)) + margin;
+            int rightY = topCurve.CalcYAtPosition(this->GetRightBy(type)) + margin;
             // LogDebug("rightY %d, %d, %d", rightY, this->GetBottomBy(type), this->GetTopBy(type));
             // The content right is below the bottom
             if (rightY < this->GetBottomBy(type)) return 0;
@@ -636,7 +638,7 @@ int BoundingBox::Intersects(FloatingCurvePositioner *curve, Accessor type, int m
             if (this->GetRightBy(type) > (p1.x + xMinY))
                 return (curve->GetBottomBy(type) - this->GetTopBy(type) - margin);
             // Calcultate the Y position of the curve one the right
-            int rightY = BoundingBox::CalcBezierAtPosition(bottomBezier, this->GetRightBy(type)) - margin;
+            int rightY = bottomCurve.CalcYAtPosition(this->GetRightBy(type)) - margin;
             // LogDebug("rightY %d, %d, %d", rightY, this->GetBottomBy(type), this->GetTopBy(type));
             // The content right is above the top
             if (rightY > this->GetTopBy(type)) return 0;
@@ -698,44 +700,16 @@ Point BoundingBox::CalcPositionAfterRotation(Point point, float alpha, Point cen
     return point;
 }
 
-/*
-int BoundingBox::CalcBezierAtPosition(const Point bezier[4], int x) {
-
-    Point P;
-    double t = 0.0;
-    // avoid division by 0
-    if (bezier[3].x != bezier[0].x) t = (double)(x - bezier[0].x) / (double)(bezier[3].x - bezier[0].x);
-    t = std::min(1.0, std::max(0.0, t));
-
-    P.y = pow((1 - t), 3) * bezier[0].y + 3 * t * pow((1 -t), 2) * bezier[1].y + 3 * (1-t) * pow(t, 2)* bezier[2].y +
-pow (t, 3)* bezier[3].y;
-    LogDebug("%f - %d - %d", t, x, P.y);
-    return P.y;
-}
-*/
-
 int BoundingBox::CalcBezierAtPosition(const Point bezier[4], int x)
 {
-    double t = 0.0;
-    // avoid division by 0
-    if (bezier[3].x != bezier[0].x) t = (double)(x - bezier[0].x) / (double)(bezier[3].x - bezier[0].x);
-    t = std::min(1.0, std::max(0.0, t));
-
-    Point p = BoundingBox::CalcDeCasteljau(bezier, t);
-
-    return p.y;
+    BezierCurve curve(bezier);
+    return curve.CalcYAtPosition(x);
 }
 
 Point BoundingBox::CalcDeCasteljau(const Point bezier[4], double t)
 {
-    Point p;
-
-    p.x = pow((1 - t), 3) * bezier[0].x + 3 * t * pow((1 - t), 2) * bezier[1].x + 3 * (1 - t) * pow(t, 2) * bezier[2].x
-        + pow(t, 3) * bezier[3].x;
-    p.y = pow((1 - t), 3) * bezier[0].y + 3 * t * pow((1 - t), 2) * bezier[1].y + 3 * (1 - t) * pow(t, 2) * bezier[2].y
-        + pow(t, 3) * bezier[3].y;
-
-    return p;
+    BezierCurve curve(bezier);
+    return curve.CalcPointAt(t);
 }
 
 void BoundingBox::CalcThickBezier(
@@ -924,4 +898,132 @@ void SegmentedLine::AddGap(int start, int end)
     }
 }
 
+//----------------------------------------------------------------------------
+// BezierCurve
+//----------------------------------------------------------------------------
+
+BezierCurve::BezierCurve()
+{
+    Point bezier[4];
+    this->SetPoints(bezier);
+}
+
+BezierCurve::BezierCurve(const Point bezier[4])
+{
+    this->SetPoints(bezier);
+}
+
+void BezierCurve::SetPoints(const Point bezier[4])
+{
+    m_x0 = bezier[0].x;
+    m_width = (double)(bezier[3].x - bezier[0].x);
+    for (int i = 0; i < 4; ++i) {
+        m_x[i] = bezier[i].x;
+        m_y[i] = bezier[i].y;
+    }
+}
+
+int BezierCurve::CalcYAtPosition(int x) const
+{
+    int y;
+    this->CalcYAtPositions(&x, &y, 1);
+    return y;
+}
+
+void BezierCurve::CalcYAtPositions(const int *x, int *y, int count) const
+{
+    // The terms of the Bernstein polynomials are calculated and added in the same order as in CalcPointAt.
+    // For a vertical curve t is 0.0 - avoid division by 0 without branching in the loop
+    const double width = (m_width != 0.0) ? m_width : 1.0;
+    const double factor = (m_width != 0.0) ? 1.0 : 0.0;
+    for (int i = 0; i < count; ++i) {
+        double t = factor * ((double)(x[i] - m_x0) / width);
+        t = std::min(1.0, std::max(0.0, t));
+        const double mt = 1.0 - t;
+        y[i] = mt * mt * mt * m_y[0] + 3 * t * (mt * mt) * m_y[1] + 3 * mt * (t * t) * m_y[2] + t * t * t * m_y[3];
+    }
+}
+
+Point BezierCurve::CalcPointAt(double t) const
+{
+    const double mt = 1.0 - t;
+    Point p;
+    p.x = mt * mt * mt * m_x[0] + 3 * t * (mt * mt) * m_x[1] + 3 * mt * (t * t) * m_x[2] + t * t * t * m_x[3];
+    p.y = mt * mt * mt * m_y[0] + 3 * t * (mt * mt) * m_y[1] + 3 * mt * (t * t) * m_y[2] + t * t * t * m_y[3];
+    return p;
+}
+
+//----------------------------------------------------------------------------
+// HorizontalBBoxIndex
+//----------------------------------------------------------------------------
+
+// 64 units, i.e., about 7 drawing units with the default unit
+const int HorizontalBBoxIndex::s_bucketShift = 6;
+
+void HorizontalBBoxIndex::Reset()
+{
+    m_boxes.clear();
+    m_firstBuckets.clear();
+    m_buckets.clear();
+    m_unindexed.clear();
+}
+
+int HorizontalBBoxIndex::GetBucket(int x)
+{
+    // Round towards negative infinity
+    return (x >= 0) ? (x >> s_bucketShift) : -((-x - 1) >> s_bucketShift) - 1;
+}
+
+void HorizontalBBoxIndex::Add(BoundingBox *box)
+{
+    assert(box);
+
+    int pos = (int)m_boxes.size();
+    m_boxes.push_back(box);
+
+    // The box cannot be located, it will be checked for every query
+    if (!box->HasContentHorizontalBB()) {
+        m_firstBuckets.push_back(0);
+        m_unindexed.push_back(pos);
+        return;
+    }
+
+    int first = GetBucket(box->GetContentLeft());
+    int last = GetBucket(box->GetContentRight());
+    m_firstBuckets.push_back(first);
+    for (int bucket = first; bucket <= last; ++bucket) {
+        m_buckets[bucket].push_back(pos);
+    }
+}
+
+void HorizontalBBoxIndex::FindHorizontalContentOverlaps(const BoundingBox *box, ArrayOfBoundingBoxes &overlaps) const
+{
+    assert(box);
+
+    overlaps.clear();
+
+    if (!box->HasContentBB()) return;
+
+    std::vector<int> positions;
+    for (auto pos : m_unindexed) {
+        if (box->HorizontalContentOverlap(m_boxes.at(pos))) positions.push_back(pos);
+    }
+    int first = GetBucket(box->GetContentLeft());
+    auto iter = m_buckets.lower_bound(first);
+    auto end = m_buckets.upper_bound(GetBucket(box->GetContentRight()));
+    for (; iter != end; ++iter) {
+        for (auto pos : iter->second) {
+            // A box in several buckets is checked only in the first one looked up
+            if (std::max(m_firstBuckets.at(pos), first) != iter->first) continue;
+            if (box->HorizontalContentOverlap(m_boxes.at(pos))) positions.push_back(pos);
+        }
+    }
+
+    // In insertion order
+    std::sort(positions.begin(), positions.end());
+    for (auto pos : positions) {
+        overlaps.push_back(m_boxes.at(pos));
+    }
+}
+
 } // namespace vrv
@@ -166,7 +166,7 @@ void Chord::FilterList(ArrayOfObjects *childList)
     Layer *layer2 = NULL;
 
     while (iter != childList->end()) {
-        curNote = dynamic_cast<Note *>(*iter);
+        curNote = vrv_cast<Note *>(*iter);
         assert(curNote);
         curPitch = curNote->GetDiatonicPitch();
 
@@ -234,7 +234,7 @@ Note *Chord::GetTopNote()
     const ArrayOfObjects *childList = this->GetList(this); // make sure it's initialized
     assert(childList->size() > 0);
 
-    Note *topNote = dynamic_cast<Note *>(childList->back());
+    Note *topNote = vrv_cast<Note *>(childList->back());
     assert(topNote);
     return topNote;
 }
@@ -245,7 +245,7 @@ Note *Chord::GetBottomNote()
     assert(childList->size() > 0);
 
     // The first note is the bottom
-    Note *bottomNote = dynamic_cast<Note *>(childList->front());
+    Note *bottomNote = vrv_cast<Note *>(childList->front());
     assert(bottomNote);
     return bottomNote;
 }
@@ -363,7 +363,7 @@ bool Chord::IsVisible()
     assert(notes);
 
     for (auto &iter : *notes) {
-        Note *note = dynamic_cast<Note *>(iter);
+        Note *note = vrv_cast<Note *>(iter);
         assert(note);
         if (!note->HasVisible() || note->GetVisible() == BOOLEAN_true) {
             return true;
@@ -379,7 +379,7 @@ bool Chord::HasNoteWithDots()
     assert(notes);
 
     for (auto &iter : *notes) {
-        Note *note = dynamic_cast<Note *>(iter);
+        Note *note = vrv_cast<Note *>(iter);
         assert(note);
         if (note->GetDots() > 0) {
             return true;
@@ -395,18 +395,18 @@ bool Chord::HasNoteWithDots()
 
 int Chord::AdjustCrossStaffYPos(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     if (!this->HasCrossStaff()) return FUNCTOR_SIBLINGS;
 
     // For cross staff chords we need to re-calculate the stem because the staff position might have changed
     SetAlignmentPitchPosParams setAlignmentPitchPosParams(params->m_doc);
-    Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos);
+    Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos, "SetAlignmentPitchPos");
     this->Process(&setAlignmentPitchPos, &setAlignmentPitchPosParams);
 
     CalcStemParams calcStemParams(params->m_doc);
-    Functor calcStem(&Object::CalcStem);
+    Functor calcStem(&Object::CalcStem, "CalcStem");
     this->Process(&calcStem, &calcStemParams);
 
     return FUNCTOR_SIBLINGS;
@@ -414,7 +414,7 @@ int Chord::AdjustCrossStaffYPos(FunctorParams *functorParams)
 
 int Chord::ConvertAnalyticalMarkup(FunctorParams *functorParams)
 {
-    ConvertAnalyticalMarkupParams *params = dynamic_cast<ConvertAnalyticalMarkupParams *>(functorParams);
+    ConvertAnalyticalMarkupParams *params = vrv_cast<ConvertAnalyticalMarkupParams *>(functorParams);
     assert(params);
 
     assert(!params->m_currentChord);
@@ -432,7 +432,7 @@ int Chord::ConvertAnalyticalMarkup(FunctorParams *functorParams)
 
 int Chord::ConvertAnalyticalMarkupEnd(FunctorParams *functorParams)
 {
-    ConvertAnalyticalMarkupParams *params = dynamic_cast<ConvertAnalyticalMarkupParams *>(functorParams);
+    ConvertAnalyticalMarkupParams *params = vrv_cast<ConvertAnalyticalMarkupParams *>(functorParams);
     assert(params);
 
     if (params->m_permanent) {
@@ -447,7 +447,7 @@ int Chord::ConvertAnalyticalMarkupEnd(FunctorParams *functorParams)
 
 int Chord::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
+    CalcStemParams *params = vrv_cast<CalcStemParams *>(functorParams);
     assert(params);
 
     // Set them to NULL in any case
@@ -466,9 +466,9 @@ int Chord::CalcStem(FunctorParams *functorParams)
 
     Stem *stem = this->GetDrawingStem();
     assert(stem);
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
     assert(layer);
 
     if (this->m_crossStaff) staff = this->m_crossStaff;
@@ -517,7 +517,7 @@ int Chord::CalcStem(FunctorParams *functorParams)
 
 int Chord::CalcDots(FunctorParams *functorParams)
 {
-    CalcDotsParams *params = dynamic_cast<CalcDotsParams *>(functorParams);
+    CalcDotsParams *params = vrv_cast<CalcDotsParams *>(functorParams);
     assert(params);
 
     // if the chord isn't visible, stop here
@@ -534,7 +534,7 @@ int Chord::CalcDots(FunctorParams *functorParams)
         }
     }
 
-    Dots *dots = dynamic_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
+    Dots *dots = vrv_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
     assert(dots);
 
     params->m_chordDots = dots;
@@ -549,7 +549,7 @@ int Chord::CalcDots(FunctorParams *functorParams)
     assert(this->GetBottomNote());
 
     for (rit = notes->rbegin(); rit != notes->rend(); ++rit) {
-        Note *note = dynamic_cast<Note *>(*rit);
+        Note *note = vrv_cast<Note *>(*rit);
         assert(note);
 
         if (note->GetDots() == 0) {
@@ -614,9 +614,9 @@ int Chord::CalcDots(FunctorParams *functorParams)
 
 int Chord::PrepareLayerElementParts(FunctorParams *functorParams)
 {
-    Stem *currentStem = dynamic_cast<Stem *>(this->FindDescendantByType(STEM, 1));
+    Stem *currentStem = vrv_cast<Stem *>(this->FindDescendantByType(STEM, 1));
     Flag *currentFlag = NULL;
-    if (currentStem) currentFlag = dynamic_cast<Flag *>(currentStem->FindDescendantByType(FLAG, 1));
+    if (currentStem) currentFlag = vrv_cast<Flag *>(currentStem->FindDescendantByType(FLAG, 1));
 
     if (!currentStem) {
         currentStem = new Stem();
@@ -649,14 +649,14 @@ int Chord::PrepareLayerElementParts(FunctorParams *functorParams)
     const ArrayOfObjects *childList = this->GetList(this); // make sure it's initialized
     for (ArrayOfObjects::const_iterator it = childList->begin(); it != childList->end(); ++it) {
         assert((*it)->Is(NOTE));
-        Note *note = dynamic_cast<Note *>(*it);
+        Note *note = vrv_cast<Note *>(*it);
         assert(note);
         note->SetDrawingStem(currentStem);
     }
 
     /************ dots ***********/
 
-    Dots *currentDots = dynamic_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
+    Dots *currentDots = vrv_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
 
     if (this->GetDots() > 0) {
         if (!currentDots) {
@@ -674,7 +674,7 @@ int Chord::PrepareLayerElementParts(FunctorParams *functorParams)
 
     /************ Prepare the drawing cue size ************/
 
-    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize);
+    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize, "PrepareDrawingCueSize");
     this->Process(&prepareDrawingCueSize, NULL);
 
     return FUNCTOR_CONTINUE;
@@ -682,7 +682,7 @@ int Chord::PrepareLayerElementParts(FunctorParams *functorParams)
 
 int Chord::CalcOnsetOffsetEnd(FunctorParams *functorParams)
 {
-    CalcOnsetOffsetParams *params = dynamic_cast<CalcOnsetOffsetParams *>(functorParams);
+    CalcOnsetOffsetParams *params = vrv_cast<CalcOnsetOffsetParams *>(functorParams);
     assert(params);
 
     LayerElement *element = this->ThisOrSameasAsLink();
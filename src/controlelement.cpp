@@ -56,7 +56,7 @@ void ControlElement::Reset()
 
 data_HORIZONTALALIGNMENT ControlElement::GetChildRendAlignment()
 {
-    Rend *rend = dynamic_cast<Rend *>(this->FindDescendantByType(REND));
+    Rend *rend = vrv_cast<Rend *>(this->FindDescendantByType(REND));
     if (!rend || !rend->HasHalign()) return HORIZONTALALIGNMENT_NONE;
 
     return rend->GetHalign();
@@ -68,7 +68,7 @@ data_HORIZONTALALIGNMENT ControlElement::GetChildRendAlignment()
 
 int ControlElement::AdjustXOverflow(FunctorParams *functorParams)
 {
-    AdjustXOverflowParams *params = dynamic_cast<AdjustXOverflowParams *>(functorParams);
+    AdjustXOverflowParams *params = vrv_cast<AdjustXOverflowParams *>(functorParams);
     assert(params);
 
     if (!this->Is({ DIR, DYNAM, TEMPO })) {
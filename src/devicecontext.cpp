@@ -135,24 +135,25 @@ void DeviceContext::GetTextExtent(const std::string &string, TextExtend *extend,
 void DeviceContext::GetTextExtent(const std::wstring &string, TextExtend *extend, bool typeSize)
 {
     assert(m_fontStack.top());
+    assert(m_resources);
     assert(extend);
 
     extend->m_width = 0;
     extend->m_height = 0;
 
     if (typeSize) {
-        AddGlyphToTextExtend(Resources::GetTextGlyph(L'p'), extend);
-        AddGlyphToTextExtend(Resources::GetTextGlyph(L'M'), extend);
+        AddGlyphToTextExtend(m_resources->GetTextGlyph(L'p'), extend);
+        AddGlyphToTextExtend(m_resources->GetTextGlyph(L'M'), extend);
         extend->m_width = 0;
     }
 
-    Glyph *unkown = Resources::GetTextGlyph(L'o');
+    const Glyph *unkown = m_resources->GetTextGlyph(L'o');
 
     for (unsigned int i = 0; i < string.length(); ++i) {
         wchar_t c = string[i];
-        Glyph *glyph = Resources::GetTextGlyph(c);
+        const Glyph *glyph = m_resources->GetTextGlyph(c);
         if (!glyph) {
-            glyph = Resources::GetGlyph(c);
+            glyph = m_resources->GetGlyph(c);
         }
         if (!glyph) {
             glyph = unkown;
@@ -164,6 +165,7 @@ void DeviceContext::GetTextExtent(const std::wstring &string, TextExtend *extend
 void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *extend)
 {
     assert(m_fontStack.top());
+    assert(m_resources);
     assert(extend);
 
     extend->m_width = 0;
@@ -171,7 +173,7 @@ void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *e
 
     for (unsigned int i = 0; i < string.length(); ++i) {
         wchar_t c = string[i];
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = m_resources->GetGlyph(c);
         if (!glyph) {
             continue;
         }
@@ -179,7 +181,7 @@ void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *e
     }
 }
 
-void DeviceContext::AddGlyphToTextExtend(Glyph *glyph, TextExtend *extend)
+void DeviceContext::AddGlyphToTextExtend(const Glyph *glyph, TextExtend *extend)
 {
     assert(glyph);
     assert(extend);
@@ -10,7 +10,9 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <list>
 #include <math.h>
+#include <sstream>
 
 //----------------------------------------------------------------------------
 
@@ -43,6 +45,7 @@
 #include "pgfoot2.h"
 #include "pghead.h"
 #include "pghead2.h"
+#include "rest.h"
 #include "runningelement.h"
 #include "score.h"
 #include "slur.h"
@@ -77,6 +80,10 @@ Doc::Doc() : Object("doc-")
 
 Doc::~Doc()
 {
+    // Delete the content while the Doc and its uuid index are still there
+    m_uuidIndex.clear();
+    this->ClearChildren();
+
     delete m_options;
 }
 
@@ -95,6 +102,11 @@ void Doc::Reset()
 
     m_drawingPage = NULL;
     m_currentScoreDefDone = false;
+    m_castOffPgHeadHeight = VRV_UNSET;
+    m_castOffPgFootHeight = VRV_UNSET;
+    m_castOffPgHead2Height = VRV_UNSET;
+    m_castOffPgFoot2Height = VRV_UNSET;
+    m_castOffStamp.clear();
     m_drawingPreparationDone = false;
     m_MIDITimemapTempo = 0.0;
     m_hasAnalyticalMarkup = false;
@@ -105,9 +117,19 @@ void Doc::Reset()
     m_drawingSmuflFontSize = 0;
     m_drawingLyricFontSize = 0;
 
+    m_glyphMetrics.clear();
+    m_glyphMetricsFontVersion = -1;
+    m_glyphMetricsFontSize = 0;
+    m_glyphMetricsGraceFactor = 0.0;
+
     m_header.reset();
     m_front.reset();
     m_back.reset();
+
+    m_uuidIndex.clear();
+    m_uuidIndexDuplicates.clear();
+    m_uuidIndexComplete = false;
+    this->ClearTimeIndex();
 }
 
 void Doc::SetType(DocType type)
@@ -137,7 +159,7 @@ void Doc::Refresh()
 
 bool Doc::GenerateDocumentScoreDef()
 {
-    Measure *measure = dynamic_cast<Measure *>(this->FindDescendantByType(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(this->FindDescendantByType(MEASURE));
     if (!measure) {
         LogError("No measure found for generating a scoreDef");
         return false;
@@ -156,7 +178,7 @@ bool Doc::GenerateDocumentScoreDef()
     StaffGrp *staffGrp = new StaffGrp();
     ArrayOfObjects::iterator iter;
     for (iter = staves.begin(); iter != staves.end(); ++iter) {
-        Staff *staff = dynamic_cast<Staff *>(*iter);
+        Staff *staff = vrv_cast<Staff *>(*iter);
         assert(staff);
         StaffDef *staffDef = new StaffDef();
         staffDef->SetN(staff->GetN());
@@ -180,13 +202,13 @@ bool Doc::GenerateFooter()
     PgFoot *pgFoot = new PgFoot();
     // We mark it as generated for not having it written in the output
     pgFoot->IsGenerated(true);
-    pgFoot->LoadFooter();
+    pgFoot->LoadFooter(this);
     pgFoot->SetType("autogenerated");
     m_scoreDef.AddChild(pgFoot);
 
     PgFoot2 *pgFoot2 = new PgFoot2();
     pgFoot2->IsGenerated(true);
-    pgFoot2->LoadFooter();
+    pgFoot2->LoadFooter(this);
     pgFoot2->SetType("autogenerated");
     m_scoreDef.AddChild(pgFoot2);
 
@@ -246,14 +268,15 @@ void Doc::CalculateMidiTimemap()
 {
     m_MIDITimemapTempo = 0.0;
 
-    // This happens if the document was never cast off (no-layout option in the toolkit)
+    // This happens if the document was never cast off (no-layout option in the toolkit or MIDI / timemap output)
+    // Only the times of the alignments are needed, so we do not do the graphical layout
     if (!m_drawingPage && GetPageCount() == 1) {
         Page *page = this->SetDrawingPage(0);
         if (!page) {
             return;
         }
         this->SetCurrentScoreDefDoc();
-        page->LayOutHorizontally();
+        page->LayOutTimes();
     }
 
     int tempo = MIDI_TEMPO;
@@ -267,20 +290,174 @@ void Doc::CalculateMidiTimemap()
     CalcMaxMeasureDurationParams calcMaxMeasureDurationParams;
     calcMaxMeasureDurationParams.m_currentTempo = tempo;
     calcMaxMeasureDurationParams.m_tempoAdjustment = m_options->m_midiTempoAdjustment.GetValue();
-    Functor calcMaxMeasureDuration(&Object::CalcMaxMeasureDuration);
+    Functor calcMaxMeasureDuration(&Object::CalcMaxMeasureDuration, "CalcMaxMeasureDuration");
     this->Process(&calcMaxMeasureDuration, &calcMaxMeasureDurationParams);
 
     // Then calculate the onset and offset times (w.r.t. the measure) for every note
     CalcOnsetOffsetParams calcOnsetOffsetParams;
-    Functor calcOnsetOffset(&Object::CalcOnsetOffset);
-    Functor calcOnsetOffsetEnd(&Object::CalcOnsetOffsetEnd);
+    Functor calcOnsetOffset(&Object::CalcOnsetOffset, "CalcOnsetOffset");
+    Functor calcOnsetOffsetEnd(&Object::CalcOnsetOffsetEnd, "CalcOnsetOffsetEnd");
     this->Process(&calcOnsetOffset, &calcOnsetOffsetParams, &calcOnsetOffsetEnd);
 
     // Adjust the duration of tied notes
-    Functor resolveMIDITies(&Object::ResolveMIDITies);
+    Functor resolveMIDITies(&Object::ResolveMIDITies, "ResolveMIDITies");
     this->Process(&resolveMIDITies, NULL, NULL, NULL, UNLIMITED_DEPTH, BACKWARD);
 
     m_MIDITimemapTempo = m_options->m_midiTempoAdjustment.GetValue();
+
+    // The real time index for FindElementsAtTime
+    this->BuildTimeIndex();
+}
+
+Measure *Doc::FindElementsAtTime(int millisec, ArrayOfObjects *notes, ArrayOfObjects *rests)
+{
+    assert(notes);
+    assert(rests);
+
+    if (!this->HasMidiTimemap()) {
+        // generate MIDI timemap (and the real time index) before progressing
+        this->CalculateMidiTimemap();
+    }
+    // Measures, notes or rests were removed since the timemap was calculated
+    else if (!m_timeIndexDone) {
+        this->BuildTimeIndex();
+    }
+
+    auto compareOnset = [](double time, const TimeIndexEntry &entry) { return time < entry.m_onset; };
+
+    // Look at all the measures starting before the time as long as one of them might still be playing
+    // and keep the first one in the document (and its first repeat), as MeasureOnsetOffsetComparison does
+    const TimeIndexEntry *measureEntry = NULL;
+    auto it = std::upper_bound(m_timeIndexMeasures.begin(), m_timeIndexMeasures.end(), millisec, compareOnset);
+    while ((it != m_timeIndexMeasures.begin()) && ((it - 1)->m_maxOffset >= millisec)) {
+        --it;
+        if (millisec > it->m_offset) continue;
+        if (!measureEntry || (it->m_order < measureEntry->m_order)
+            || ((it->m_order == measureEntry->m_order) && (it->m_repeat < measureEntry->m_repeat))) {
+            measureEntry = &(*it);
+        }
+    }
+
+    if (!measureEntry) {
+        return NULL;
+    }
+
+    Measure *measure = vrv_cast<Measure *>(measureEntry->m_object);
+    assert(measure);
+
+    // The offset is truncated as in Toolkit::GetElementsAtTime
+    int measureTimeOffset = measure->GetRealTimeOffsetMilliseconds(measureEntry->m_repeat);
+    int time = millisec - measureTimeOffset;
+
+    // Look at the entries of the measure starting before the time and return the ones still playing in document order
+    auto findEntries = [&compareOnset, time](const ArrayOfTimeIndexEntries &entries, ArrayOfObjects *objects) {
+        std::vector<const TimeIndexEntry *> matches;
+        auto entryIt = std::upper_bound(entries.begin(), entries.end(), time, compareOnset);
+        while ((entryIt != entries.begin()) && ((entryIt - 1)->m_maxOffset >= time)) {
+            --entryIt;
+            if (time <= entryIt->m_offset) matches.push_back(&(*entryIt));
+        }
+        std::sort(matches.begin(), matches.end(), [](const TimeIndexEntry *entry1, const TimeIndexEntry *entry2) {
+            return entry1->m_order < entry2->m_order;
+        });
+        for (auto &match : matches) {
+            objects->push_back(match->m_object);
+        }
+    };
+    findEntries(m_timeIndexNotes.at(measureEntry->m_order), notes);
+    findEntries(m_timeIndexRests.at(measureEntry->m_order), rests);
+
+    return measure;
+}
+
+void Doc::BuildTimeIndex()
+{
+    this->ClearTimeIndex();
+
+    auto compareOnset = [](const TimeIndexEntry &entry1, const TimeIndexEntry &entry2) {
+        return entry1.m_onset < entry2.m_onset;
+    };
+    auto setMaxOffset = [](ArrayOfTimeIndexEntries &entries) {
+        for (int i = 0; i < (int)entries.size(); ++i) {
+            entries.at(i).m_maxOffset = entries.at(i).m_offset;
+            if (i > 0) entries.at(i).m_maxOffset = std::max(entries.at(i).m_maxOffset, entries.at(i - 1).m_maxOffset);
+        }
+    };
+
+    ArrayOfObjects measures;
+    ClassIdComparison matchMeasure(MEASURE);
+    this->FindAllDescendantByComparison(&measures, &matchMeasure);
+
+    ClassIdComparison matchNote(NOTE);
+    ClassIdComparison matchRest(REST);
+    int order = 0;
+    for (auto &object : measures) {
+        Measure *measure = vrv_cast<Measure *>(object);
+        assert(measure);
+
+        int timeDuration = measure->GetRealTimeDurationMilliseconds();
+        for (int repeat = 1; repeat <= measure->GetRepeatCount(); ++repeat) {
+            TimeIndexEntry entry;
+            entry.m_onset = measure->GetRealTimeOffsetMilliseconds(repeat);
+            entry.m_offset = entry.m_onset + timeDuration;
+            entry.m_order = order;
+            entry.m_repeat = repeat;
+            entry.m_object = measure;
+            m_timeIndexMeasures.push_back(entry);
+        }
+
+        ArrayOfObjects notes;
+        measure->FindAllDescendantByComparison(&notes, &matchNote);
+        ArrayOfTimeIndexEntries noteEntries;
+        int noteOrder = 0;
+        for (auto &noteObject : notes) {
+            Note *note = vrv_cast<Note *>(noteObject);
+            assert(note);
+            TimeIndexEntry entry;
+            entry.m_onset = note->GetRealTimeOnsetMilliseconds();
+            entry.m_offset = note->GetRealTimeOffsetMilliseconds();
+            entry.m_order = noteOrder++;
+            entry.m_repeat = 0;
+            entry.m_object = note;
+            noteEntries.push_back(entry);
+        }
+        std::stable_sort(noteEntries.begin(), noteEntries.end(), compareOnset);
+        setMaxOffset(noteEntries);
+        m_timeIndexNotes.push_back(noteEntries);
+
+        ArrayOfObjects rests;
+        measure->FindAllDescendantByComparison(&rests, &matchRest);
+        ArrayOfTimeIndexEntries restEntries;
+        int restOrder = 0;
+        for (auto &restObject : rests) {
+            Rest *rest = vrv_cast<Rest *>(restObject);
+            assert(rest);
+            TimeIndexEntry entry;
+            entry.m_onset = rest->GetRealTimeOnsetMilliseconds();
+            entry.m_offset = rest->GetRealTimeOffsetMilliseconds();
+            entry.m_order = restOrder++;
+            entry.m_repeat = 0;
+            entry.m_object = rest;
+            restEntries.push_back(entry);
+        }
+        std::stable_sort(restEntries.begin(), restEntries.end(), compareOnset);
+        setMaxOffset(restEntries);
+        m_timeIndexRests.push_back(restEntries);
+        ++order;
+    }
+
+    std::stable_sort(m_timeIndexMeasures.begin(), m_timeIndexMeasures.end(), compareOnset);
+    setMaxOffset(m_timeIndexMeasures);
+
+    m_timeIndexDone = true;
+}
+
+void Doc::ClearTimeIndex()
+{
+    m_timeIndexMeasures.clear();
+    m_timeIndexNotes.clear();
+    m_timeIndexRests.clear();
+    m_timeIndexDone = false;
 }
 
 void Doc::ExportMIDI(smf::MidiFile *midiFile)
@@ -309,7 +486,7 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
     // params.push_back(&staffLayerVerseTree);
 
     // We first fill a tree of int with [staff/layer] and [staff/layer/verse] numbers (@n) to be process
-    Functor prepareProcessingLists(&Object::PrepareProcessingLists);
+    Functor prepareProcessingLists(&Object::PrepareProcessingLists, "PrepareProcessingLists");
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
     // The tree is used to process each staff/layer/verse separatly
@@ -319,11 +496,18 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
     IntTree_t::iterator staves;
     IntTree_t::iterator layers;
 
-    // Process notes and chords, rests, spaces layer by layer
+    // Process notes and chords, rests, spaces layer by layer, all the layers in a single traversal
+    // Each layer is written to its own MidiFile that is merged afterwards, so that the events of the layers of a track
+    // are in the same order as when the layers are processed one after the other
     // track 0 (included by default) is reserved for meta messages common to all tracks
     int midiChannel = 0;
     int midiTrack = 1;
-    ArrayOfComparisons filters;
+    std::list<AttNIntegerComparison> comparisons;
+    std::list<smf::MidiFile> layerMidiFiles;
+    std::list<GenerateMIDIParams> generateMIDIParams;
+    std::list<FunctorPass> passes;
+    ArrayOfFunctorPasses generateMIDIPasses;
+    Functor generateMIDI(&Object::GenerateMIDI, "GenerateMIDI");
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
 
@@ -338,11 +522,11 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
                 midiFile->addTracks(addCount);
             }
             // set MIDI channel and instrument
-            InstrDef *instrdef = dynamic_cast<InstrDef *>(staffDef->FindDescendantByType(INSTRDEF, 1));
+            InstrDef *instrdef = vrv_cast<InstrDef *>(staffDef->FindDescendantByType(INSTRDEF, 1));
             if (!instrdef) {
-                StaffGrp *staffGrp = dynamic_cast<StaffGrp *>(staffDef->GetFirstAncestor(STAFFGRP));
+                StaffGrp *staffGrp = vrv_cast<StaffGrp *>(staffDef->GetFirstAncestor(STAFFGRP));
                 assert(staffGrp);
-                instrdef = dynamic_cast<InstrDef *>(staffGrp->FindDescendantByType(INSTRDEF, 1));
+                instrdef = vrv_cast<InstrDef *>(staffGrp->FindDescendantByType(INSTRDEF, 1));
             }
             if (instrdef) {
                 if (instrdef->HasMidiChannel()) midiChannel = instrdef->GetMidiChannel();
@@ -350,40 +534,64 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
                     midiFile->addPatchChange(midiTrack, 0, midiChannel, instrdef->GetMidiInstrnum());
             }
             // set MIDI track name
-            Label *label = dynamic_cast<Label *>(staffDef->FindDescendantByType(LABEL, 1));
+            Label *label = vrv_cast<Label *>(staffDef->FindDescendantByType(LABEL, 1));
             if (!label) {
-                StaffGrp *staffGrp = dynamic_cast<StaffGrp *>(staffDef->GetFirstAncestor(STAFFGRP));
+                StaffGrp *staffGrp = vrv_cast<StaffGrp *>(staffDef->GetFirstAncestor(STAFFGRP));
                 assert(staffGrp);
-                label = dynamic_cast<Label *>(staffGrp->FindDescendantByType(LABEL, 1));
+                label = vrv_cast<Label *>(staffGrp->FindDescendantByType(LABEL, 1));
             }
             if (label) {
                 std::string trackName = UTF16to8(label->GetText(label)).c_str();
                 if (!trackName.empty()) midiFile->addTrackName(midiTrack, 0, trackName);
             }
             // set MIDI time signature
-            MeterSig *meterSig = dynamic_cast<MeterSig *>(this->m_scoreDef.FindDescendantByType(METERSIG));
+            MeterSig *meterSig = vrv_cast<MeterSig *>(this->m_scoreDef.FindDescendantByType(METERSIG));
             if (meterSig && meterSig->HasCount()) {
                 midiFile->addTimeSignature(midiTrack, 0, meterSig->GetCount(), meterSig->GetUnit());
             }
         }
 
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
             // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves->first);
-            AttNIntegerComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
+            comparisons.emplace_back(STAFF, staves->first);
+            AttNIntegerComparison *matchStaff = &comparisons.back();
+            comparisons.emplace_back(LAYER, layers->first);
+            AttNIntegerComparison *matchLayer = &comparisons.back();
+
+            layerMidiFiles.emplace_back();
+            smf::MidiFile *layerMidiFile = &layerMidiFiles.back();
+            layerMidiFile->absoluteTicks();
+            layerMidiFile->setTPQ(midiFile->getTPQ());
+            if (midiTrack + 1 > layerMidiFile->getTrackCount()) {
+                layerMidiFile->addTracks(midiTrack + 1 - layerMidiFile->getTrackCount());
+            }
+
+            generateMIDIParams.emplace_back(layerMidiFile, &generateMIDI);
+            GenerateMIDIParams *params = &generateMIDIParams.back();
+            params->m_midiChannel = midiChannel;
+            params->m_midiTrack = midiTrack;
+            params->m_transSemi = transSemi;
+            params->m_currentTempo = tempo;
+
+            passes.emplace_back(generateMIDI, params);
+            passes.back().m_filters = { matchStaff, matchLayer };
+            // The functor of the pass is the one to use for processing @sameas links
+            params->m_functor = &passes.back().m_functor;
+            generateMIDIPasses.push_back(&passes.back());
+        }
+    }
 
-            Functor generateMIDI(&Object::GenerateMIDI);
-            GenerateMIDIParams generateMIDIParams(midiFile, &generateMIDI);
-            generateMIDIParams.m_midiChannel = midiChannel;
-            generateMIDIParams.m_midiTrack = midiTrack;
-            generateMIDIParams.m_transSemi = transSemi;
-            generateMIDIParams.m_currentTempo = tempo;
+    this->ProcessPasses(generateMIDIPasses);
 
-            // LogDebug("Exporting track %d ----------------", midiTrack);
-            this->Process(&generateMIDI, &generateMIDIParams, NULL, &filters);
+    // Merge the layers in the order they would have been processed one after the other
+    for (smf::MidiFile &layerMidiFile : layerMidiFiles) {
+        if (layerMidiFile.getTrackCount() > midiFile->getTrackCount()) {
+            midiFile->addTracks(layerMidiFile.getTrackCount() - midiFile->getTrackCount());
+        }
+        for (int track = 0; track < layerMidiFile.getTrackCount(); ++track) {
+            for (int i = 0; i < layerMidiFile.getEventCount(track); ++i) {
+                midiFile->addEvent(track, layerMidiFile[track][i]);
+            }
         }
     }
 }
@@ -399,7 +607,7 @@ bool Doc::ExportTimemap(std::string &output)
         output = "";
         return false;
     }
-    Functor generateTimemap(&Object::GenerateTimemap);
+    Functor generateTimemap(&Object::GenerateTimemap, "GenerateTimemap");
     GenerateTimemapParams generateTimemapParams(&generateTimemap);
     this->Process(&generateTimemap, &generateTimemapParams);
 
@@ -482,7 +690,7 @@ void Doc::PrepareJsonTimemap(std::string &output, std::map<double, double> &real
 void Doc::PrepareDrawing()
 {
     if (m_drawingPreparationDone) {
-        Functor resetDrawing(&Object::ResetDrawing);
+        Functor resetDrawing(&Object::ResetDrawing, "ResetDrawing");
         this->Process(&resetDrawing, NULL);
     }
 
@@ -490,8 +698,8 @@ void Doc::PrepareDrawing()
 
     // Try to match all spanning elements (slur, tie, etc) by processing backwards
     PrepareTimeSpanningParams prepareTimeSpanningParams;
-    Functor prepareTimeSpanning(&Object::PrepareTimeSpanning);
-    Functor prepareTimeSpanningEnd(&Object::PrepareTimeSpanningEnd);
+    Functor prepareTimeSpanning(&Object::PrepareTimeSpanning, "PrepareTimeSpanning");
+    Functor prepareTimeSpanningEnd(&Object::PrepareTimeSpanningEnd, "PrepareTimeSpanningEnd");
     this->Process(
         &prepareTimeSpanning, &prepareTimeSpanningParams, &prepareTimeSpanningEnd, NULL, UNLIMITED_DEPTH, BACKWARD);
 
@@ -509,8 +717,8 @@ void Doc::PrepareDrawing()
 
     // Try to match all time pointing elements (tempo, fermata, etc) by processing backwards
     PrepareTimePointingParams prepareTimePointingParams;
-    Functor prepareTimePointing(&Object::PrepareTimePointing);
-    Functor prepareTimePointingEnd(&Object::PrepareTimePointingEnd);
+    Functor prepareTimePointing(&Object::PrepareTimePointing, "PrepareTimePointing");
+    Functor prepareTimePointingEnd(&Object::PrepareTimePointingEnd, "PrepareTimePointingEnd");
     this->Process(
         &prepareTimePointing, &prepareTimePointingParams, &prepareTimePointingEnd, NULL, UNLIMITED_DEPTH, BACKWARD);
 
@@ -518,8 +726,8 @@ void Doc::PrepareDrawing()
 
     // Now try to match the @tstamp and @tstamp2 attributes.
     PrepareTimestampsParams prepareTimestampsParams;
-    Functor prepareTimestamps(&Object::PrepareTimestamps);
-    Functor prepareTimestampsEnd(&Object::PrepareTimestampsEnd);
+    Functor prepareTimestamps(&Object::PrepareTimestamps, "PrepareTimestamps");
+    Functor prepareTimestampsEnd(&Object::PrepareTimestampsEnd, "PrepareTimestampsEnd");
     this->Process(&prepareTimestamps, &prepareTimestampsParams, &prepareTimestampsEnd);
 
     // If some are still there, then it is probably an issue in the encoding
@@ -532,7 +740,7 @@ void Doc::PrepareDrawing()
 
     // Try to match all pointing elements using @next and @sameas
     PrepareLinkingParams prepareLinkingParams;
-    Functor prepareLinking(&Object::PrepareLinking);
+    Functor prepareLinking(&Object::PrepareLinking, "PrepareLinking");
     this->Process(&prepareLinking, &prepareLinkingParams);
 
     // If we have some left process again backward
@@ -554,7 +762,7 @@ void Doc::PrepareDrawing()
 
     // Try to match all pointing elements using @plist
     PreparePlistParams preparePlistParams;
-    Functor preparePlist(&Object::PreparePlist);
+    Functor preparePlist(&Object::PreparePlist, "PreparePlist");
     this->Process(&preparePlist, &preparePlistParams);
 
     // If we have some left process again backward.
@@ -573,8 +781,8 @@ void Doc::PrepareDrawing()
 
     // Prepare the cross-staff pointers
     PrepareCrossStaffParams prepareCrossStaffParams;
-    Functor prepareCrossStaff(&Object::PrepareCrossStaff);
-    Functor prepareCrossStaffEnd(&Object::PrepareCrossStaffEnd);
+    Functor prepareCrossStaff(&Object::PrepareCrossStaff, "PrepareCrossStaff");
+    Functor prepareCrossStaffEnd(&Object::PrepareCrossStaffEnd, "PrepareCrossStaffEnd");
     this->Process(&prepareCrossStaff, &prepareCrossStaffParams, &prepareCrossStaffEnd);
 
     /************ Prepare processing by staff/layer/verse ************/
@@ -588,7 +796,7 @@ void Doc::PrepareDrawing()
 
     // We first fill a tree of ints with [staff/layer] and [staff/layer/verse] numbers (@n) to be processed
     // LogElapsedTimeStart();
-    Functor prepareProcessingLists(&Object::PrepareProcessingLists);
+    Functor prepareProcessingLists(&Object::PrepareProcessingLists, "PrepareProcessingLists");
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
     // The tree is used to process each staff/layer/verse separately
@@ -601,49 +809,60 @@ void Doc::PrepareDrawing()
 
     /************ Resolve some pointers by layer ************/
 
-    ArrayOfComparisons filters;
+    // All the layers are processed in a single traversal with one pass for each of them
+    std::list<AttNIntegerComparison> comparisons;
+    std::list<FunctorPass> passes;
+
+    std::list<PreparePointersByLayerParams> preparePointersByLayerParams;
+    ArrayOfFunctorPasses preparePointersByLayerPasses;
+    Functor preparePointersByLayer(&Object::PreparePointersByLayer, "PreparePointersByLayer");
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
             // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves->first);
-            AttNIntegerComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            PreparePointersByLayerParams preparePointersByLayerParams;
-            Functor preparePointersByLayer(&Object::PreparePointersByLayer);
-            this->Process(&preparePointersByLayer, &preparePointersByLayerParams, NULL, &filters);
+            comparisons.emplace_back(STAFF, staves->first);
+            AttNIntegerComparison *matchStaff = &comparisons.back();
+            comparisons.emplace_back(LAYER, layers->first);
+            AttNIntegerComparison *matchLayer = &comparisons.back();
+
+            preparePointersByLayerParams.emplace_back();
+            passes.emplace_back(preparePointersByLayer, &preparePointersByLayerParams.back());
+            passes.back().m_filters = { matchStaff, matchLayer };
+            preparePointersByLayerPasses.push_back(&passes.back());
         }
     }
+    this->ProcessPasses(preparePointersByLayerPasses);
 
     /************ Resolve lyric connectors ************/
 
     // Same for the lyrics, but Verse by Verse since Syl are TimeSpanningInterface elements for handling connectors
+    // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
+    // m_drawingLastNote is set only if the syl has a forward connector
+    std::list<PrepareLyricsParams> prepareLyricsParams;
+    ArrayOfFunctorPasses prepareLyricsPasses;
+    Functor prepareLyrics(&Object::PrepareLyrics, "PrepareLyrics");
+    Functor prepareLyricsEnd(&Object::PrepareLyricsEnd, "PrepareLyricsEnd");
     for (staves = prepareProcessingListsParams.m_verseTree.child.begin();
          staves != prepareProcessingListsParams.m_verseTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             for (verses = layers->second.child.begin(); verses != layers->second.child.end(); ++verses) {
                 // std::cout << staves->first << " => " << layers->first << " => " << verses->first << '\n';
-                filters.clear();
                 // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves->first);
-                AttNIntegerComparison matchLayer(LAYER, layers->first);
-                AttNIntegerComparison matchVerse(VERSE, verses->first);
-                filters.push_back(&matchStaff);
-                filters.push_back(&matchLayer);
-                filters.push_back(&matchVerse);
-
-                // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
-                // m_drawingLastNote is set only if the syl has a forward connector
-                PrepareLyricsParams prepareLyricsParams;
-                Functor prepareLyrics(&Object::PrepareLyrics);
-                Functor prepareLyricsEnd(&Object::PrepareLyricsEnd);
-                this->Process(&prepareLyrics, &prepareLyricsParams, &prepareLyricsEnd, &filters);
+                comparisons.emplace_back(STAFF, staves->first);
+                AttNIntegerComparison *matchStaff = &comparisons.back();
+                comparisons.emplace_back(LAYER, layers->first);
+                AttNIntegerComparison *matchLayer = &comparisons.back();
+                comparisons.emplace_back(VERSE, verses->first);
+                AttNIntegerComparison *matchVerse = &comparisons.back();
+
+                prepareLyricsParams.emplace_back();
+                passes.emplace_back(prepareLyrics, &prepareLyricsParams.back(), &prepareLyricsEnd);
+                passes.back().m_filters = { matchStaff, matchLayer, matchVerse };
+                prepareLyricsPasses.push_back(&passes.back());
             }
         }
     }
+    this->ProcessPasses(prepareLyricsPasses);
 
     /************ Fill control event spanning ************/
 
@@ -651,8 +870,9 @@ void Doc::PrepareDrawing()
     // TimeSpanningInterface to each staff they are extended. This does not need to be done staff by staff because we
     // can just check the staff->GetN to see where we are (see Staff::FillStaffCurrentTimeSpanning)
     FillStaffCurrentTimeSpanningParams fillStaffCurrentTimeSpanningParams;
-    Functor fillStaffCurrentTimeSpanning(&Object::FillStaffCurrentTimeSpanning);
-    Functor fillStaffCurrentTimeSpanningEnd(&Object::FillStaffCurrentTimeSpanningEnd);
+    Functor fillStaffCurrentTimeSpanning(&Object::FillStaffCurrentTimeSpanning, "FillStaffCurrentTimeSpanning");
+    Functor fillStaffCurrentTimeSpanningEnd(
+        &Object::FillStaffCurrentTimeSpanningEnd, "FillStaffCurrentTimeSpanningEnd");
     this->Process(&fillStaffCurrentTimeSpanning, &fillStaffCurrentTimeSpanningParams, &fillStaffCurrentTimeSpanningEnd);
 
     // Something must be wrong in the encoding because a TimeSpanningInterface was left open
@@ -664,47 +884,51 @@ void Doc::PrepareDrawing()
     /************ Resolve mRpt ************/
 
     // Process by staff for matching mRpt elements and setting the drawing number
+    std::list<PrepareRptParams> prepareRptParams;
+    ArrayOfFunctorPasses prepareRptPasses;
+    Functor prepareRpt(&Object::PrepareRpt, "PrepareRpt");
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
             // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves->first);
-            AttNIntegerComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
+            comparisons.emplace_back(STAFF, staves->first);
+            AttNIntegerComparison *matchStaff = &comparisons.back();
+            comparisons.emplace_back(LAYER, layers->first);
+            AttNIntegerComparison *matchLayer = &comparisons.back();
 
             // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first staff
-            PrepareRptParams prepareRptParams(&m_scoreDef);
-            Functor prepareRpt(&Object::PrepareRpt);
-            this->Process(&prepareRpt, &prepareRptParams, NULL, &filters);
+            prepareRptParams.emplace_back(&m_scoreDef);
+            passes.emplace_back(prepareRpt, &prepareRptParams.back());
+            passes.back().m_filters = { matchStaff, matchLayer };
+            prepareRptPasses.push_back(&passes.back());
         }
     }
+    this->ProcessPasses(prepareRptPasses);
 
     /************ Resolve endings ************/
 
     // Prepare the endings (pointers to the measure after and before the boundaries
     PrepareBoundariesParams prepareEndingsParams;
-    Functor prepareEndings(&Object::PrepareBoundaries);
+    Functor prepareEndings(&Object::PrepareBoundaries, "PrepareBoundaries");
     this->Process(&prepareEndings, &prepareEndingsParams);
 
     /************ Resolve floating groups for vertical alignment ************/
 
     // Prepare the floating drawing groups
     PrepareFloatingGrpsParams prepareFloatingGrpsParams;
-    Functor prepareFloatingGrps(&Object::PrepareFloatingGrps);
-    Functor prepareFloatingGrpsEnd(&Object::PrepareFloatingGrpsEnd);
+    Functor prepareFloatingGrps(&Object::PrepareFloatingGrps, "PrepareFloatingGrps");
+    Functor prepareFloatingGrpsEnd(&Object::PrepareFloatingGrpsEnd, "PrepareFloatingGrpsEnd");
     this->Process(&prepareFloatingGrps, &prepareFloatingGrpsParams, &prepareFloatingGrpsEnd);
 
     /************ Resolve cue size ************/
 
     // Prepare the drawing cue size
-    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize);
+    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize, "PrepareDrawingCueSize");
     this->Process(&prepareDrawingCueSize, NULL);
 
     /************ Instanciate LayerElement parts (stemp, flag, dots, etc) ************/
 
-    Functor prepareLayerElementParts(&Object::PrepareLayerElementParts);
+    Functor prepareLayerElementParts(&Object::PrepareLayerElementParts, "PrepareLayerElementParts");
     this->Process(&prepareLayerElementParts, NULL);
 
     /*
@@ -726,7 +950,7 @@ void Doc::PrepareDrawing()
                 filters.push_back(&matchVerse);
 
                 FunctorParams paramsLyrics;
-                Functor prepareLyrics(&Object::PrepareLyrics);
+                Functor prepareLyrics(&Object::PrepareLyrics, "PrepareLyrics");
                 this->Process(&prepareLyrics, paramsLyrics, NULL, &filters);
             }
         }
@@ -745,14 +969,14 @@ void Doc::SetCurrentScoreDefDoc(bool force)
     }
 
     if (m_currentScoreDefDone) {
-        Functor unsetCurrentScoreDef(&Object::UnsetCurrentScoreDef);
+        Functor unsetCurrentScoreDef(&Object::UnsetCurrentScoreDef, "UnsetCurrentScoreDef");
         UnsetCurrentScoreDefParams unsetCurrentScoreDefParams(&unsetCurrentScoreDef);
         this->Process(&unsetCurrentScoreDef, &unsetCurrentScoreDefParams);
     }
 
     ScoreDef upcomingScoreDef = m_scoreDef;
     SetCurrentScoreDefParams setCurrentScoreDefParams(this, &upcomingScoreDef);
-    Functor setCurrentScoreDef(&Object::SetCurrentScoreDef);
+    Functor setCurrentScoreDef(&Object::SetCurrentScoreDef, "SetCurrentScoreDef");
 
     // First process the current scoreDef in order to fill the staffDef with
     // the appropriate drawing values
@@ -765,8 +989,8 @@ void Doc::SetCurrentScoreDefDoc(bool force)
 
 void Doc::OptimizeScoreDefDoc()
 {
-    Functor optimizeScoreDef(&Object::OptimizeScoreDef);
-    Functor optimizeScoreDefEnd(&Object::OptimizeScoreDefEnd);
+    Functor optimizeScoreDef(&Object::OptimizeScoreDef, "OptimizeScoreDef");
+    Functor optimizeScoreDefEnd(&Object::OptimizeScoreDefEnd, "OptimizeScoreDefEnd");
     OptimizeScoreDefParams optimizeScoreDefParams(this, &optimizeScoreDef, &optimizeScoreDefEnd);
 
     this->Process(&optimizeScoreDef, &optimizeScoreDefParams, &optimizeScoreDefEnd);
@@ -782,20 +1006,15 @@ void Doc::CastOffDoc()
         return;
     }
 
-    // By default, optimize scores
-    bool optimize = (m_scoreDef.GetOptimize() != BOOLEAN_false);
-    // However, if nothing specified, do not if there is only one staffGrp
-    if ((m_scoreDef.GetOptimize() == BOOLEAN_NONE) && (m_scoreDef.GetChildCount(STAFFGRP, UNLIMITED_DEPTH) < 2)) {
-        optimize = false;
-    }
+    bool optimize = this->IsCastOffOptimized();
 
     this->SetCurrentScoreDefDoc();
 
     Page *contentPage = this->SetDrawingPage(0);
     assert(contentPage);
-    contentPage->LayOutHorizontally();
+    contentPage->LayOutHorizontally(true);
 
-    System *contentSystem = dynamic_cast<System *>(contentPage->DetachChild(0));
+    System *contentSystem = vrv_cast<System *>(contentPage->DetachChild(0));
     assert(contentSystem);
 
     System *currentSystem = new System();
@@ -807,8 +1026,8 @@ void Doc::CastOffDoc()
     castOffSystemsParams.m_currentScoreDefWidth
         = contentPage->m_drawingScoreDef.GetDrawingWidth() + contentSystem->GetDrawingAbbrLabelsWidth();
 
-    Functor castOffSystems(&Object::CastOffSystems);
-    Functor castOffSystemsEnd(&Object::CastOffSystemsEnd);
+    Functor castOffSystems(&Object::CastOffSystems, "CastOffSystems");
+    Functor castOffSystemsEnd(&Object::CastOffSystemsEnd, "CastOffSystemsEnd");
     contentSystem->Process(&castOffSystems, &castOffSystemsParams, &castOffSystemsEnd);
     delete contentSystem;
 
@@ -819,8 +1038,8 @@ void Doc::CastOffDoc()
     }
 
     // Here we redo the alignment because of the new scoreDefs
-    // We can actually optimise this and have a custom version that does not redo all the calculation
-    contentPage->LayOutVertically();
+    // With lazy layout, we only estimate it and each page will be laid out when drawn
+    contentPage->LayOutVertically(!m_options->m_lazyLayout.GetValue());
 
     // Detach the contentPage
     pages->DetachChild(0);
@@ -830,8 +1049,14 @@ void Doc::CastOffDoc()
     Page *currentPage = new Page();
     CastOffPagesParams castOffPagesParams(contentPage, this, currentPage);
     CastOffRunningElements(&castOffPagesParams);
+    // Keep them for CastOffDocIncremental
+    m_castOffPgHeadHeight = castOffPagesParams.m_pgHeadHeight;
+    m_castOffPgFootHeight = castOffPagesParams.m_pgFootHeight;
+    m_castOffPgHead2Height = castOffPagesParams.m_pgHead2Height;
+    m_castOffPgFoot2Height = castOffPagesParams.m_pgFoot2Height;
+    m_castOffStamp = this->CalcCastOffStamp();
     castOffPagesParams.m_pageHeight = this->m_drawingPageHeight - this->m_drawingPageMarginBot;
-    Functor castOffPages(&Object::CastOffPages);
+    Functor castOffPages(&Object::CastOffPages, "CastOffPages");
     pages->AddChild(currentPage);
     contentPage->Process(&castOffPages, &castOffPagesParams);
     delete contentPage;
@@ -840,6 +1065,276 @@ void Doc::CastOffDoc()
     if (optimize) {
         this->OptimizeScoreDefDoc();
     }
+
+    this->ClearStoredHorizontalLayout(true);
+}
+
+std::string Doc::CalcCastOffStamp() const
+{
+    std::stringstream stamp;
+    for (auto &item : *m_options->GetItems()) {
+        stamp << item.first << "=" << item.second->GetStrValue() << ";";
+    }
+    stamp << "fontVersion=" << m_resources.GetFontVersion();
+    return stamp.str();
+}
+
+bool Doc::IsCastOffOptimized()
+{
+    // By default, optimize scores
+    bool optimize = (m_scoreDef.GetOptimize() != BOOLEAN_false);
+    // However, if nothing specified, do not if there is only one staffGrp
+    if ((m_scoreDef.GetOptimize() == BOOLEAN_NONE) && (m_scoreDef.GetChildCount(STAFFGRP, UNLIMITED_DEPTH) < 2)) {
+        optimize = false;
+    }
+    return optimize;
+}
+
+void Doc::CastOffDocIncremental()
+{
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    // We need a previous cast off by CastOffDoc with the same options and fonts
+    if ((m_castOffPgHeadHeight == VRV_UNSET) || (m_castOffStamp != this->CalcCastOffStamp())) {
+        this->UnCastOffDoc();
+        this->CastOffDoc();
+        return;
+    }
+
+    bool optimize = this->IsCastOffOptimized();
+
+    ArrayOfObjects systemList;
+    ClassIdComparison matchType(SYSTEM);
+    pages->FindAllDescendantByComparison(&systemList, &matchType, 2);
+    std::vector<System *> systems;
+    for (auto &object : systemList) {
+        systems.push_back(dynamic_cast<System *>(object));
+    }
+
+    // Look for the first and last systems with an edited measure and keep the first measure of each system with the
+    // width of the scoreDef drawn at its beginning
+    int firstEdited = VRV_UNSET;
+    int lastEdited = VRV_UNSET;
+    std::map<Measure *, int> systemStarts;
+    std::map<Measure *, int> systemStartWidths;
+    int i;
+    for (i = 0; i < (int)systems.size(); ++i) {
+        assert(systems.at(i));
+        Measure *firstMeasure = NULL;
+        for (auto &child : *systems.at(i)->GetChildren()) {
+            if (!child->Is(MEASURE)) continue;
+            Measure *measure = vrv_cast<Measure *>(child);
+            assert(measure);
+            if (!firstMeasure) firstMeasure = measure;
+            if (measure->IsEdited()) {
+                if (firstEdited == VRV_UNSET) firstEdited = i;
+                lastEdited = i;
+            }
+        }
+        if (firstMeasure) {
+            systemStarts[firstMeasure] = i;
+            ScoreDef *drawingScoreDef = systems.at(i)->GetDrawingScoreDef();
+            systemStartWidths[firstMeasure] = (drawingScoreDef) ? drawingScoreDef->CalcDrawingWidth(this) : VRV_UNSET;
+        }
+    }
+
+    if (firstEdited == VRV_UNSET) {
+        LogDebug("No edited measure, nothing to re-lay out");
+        return;
+    }
+
+    // Start from the previous system because the edited measure can now fit in it
+    int start = std::max(0, firstEdited - 1);
+    // The system before is used as an anchor: it is kept as is but laid out with the others, so the first measure to
+    // cast off does not start the content system and its width does not include the scoreDef at the beginning of it
+    int first = std::max(0, start - 1);
+    Page *startPage = vrv_cast<Page *>(systems.at(first)->GetParent());
+    assert(startPage);
+    int startPageIdx = startPage->GetIdx();
+
+    // Detach all the systems from the first one - the ones before it remain on the start page
+    for (i = first; i < (int)systems.size(); ++i) {
+        Object *page = systems.at(i)->GetParent();
+        assert(page);
+        page->DetachChild(systems.at(i)->GetIdx());
+    }
+    // The following pages are now empty
+    while (pages->GetChildCount() > startPageIdx + 1) {
+        pages->DeleteChild(pages->GetLast());
+    }
+    this->ResetDrawingPage();
+
+    Page *contentPage = new Page();
+    pages->AddChild(contentPage);
+
+    UnCastOffParams unCastOffParams(NULL);
+    Functor unCastOff(&Object::UnCastOff, "UnCastOff");
+
+    // The systems are re-laid out by chunks going at least to the one following the last edited system, until the
+    // system breaks line up with the previous ones. Each chunk starts with the last system of the previous one because
+    // the measures it ends with are not settled. The other systems are moved to the start page.
+    System *anchor = (start > 0) ? systems.at(first) : NULL;
+    int next = start;
+    int chunk = std::max(1, lastEdited + 2 - start);
+    bool aligned = false;
+    while (true) {
+        System *contentSystem = new System();
+        unCastOffParams.m_currentSystem = contentSystem;
+        int anchorSize = 0;
+        if (anchor) {
+            anchorSize = anchor->GetChildCount();
+            anchor->Process(&unCastOff, &unCastOffParams);
+            delete anchor;
+        }
+        for (auto &child : *contentPage->GetChildren()) {
+            child->Process(&unCastOff, &unCastOffParams);
+        }
+        contentPage->ClearChildren();
+        int end = std::min((int)systems.size(), next + chunk);
+        for (; next < end; ++next) {
+            systems.at(next)->Process(&unCastOff, &unCastOffParams);
+            delete systems.at(next);
+        }
+        contentPage->AddChild(contentSystem);
+
+        this->SetCurrentScoreDefDoc(true);
+        this->SetDrawingPage(contentPage->GetIdx());
+        contentPage->LayOutHorizontally(true);
+
+        contentSystem = vrv_cast<System *>(contentPage->DetachChild(0));
+        assert(contentSystem);
+
+        System *currentSystem = new System();
+        contentPage->AddChild(currentSystem);
+        // Move the content of the anchor as is
+        for (i = 0; i < anchorSize; ++i) {
+            currentSystem->AddChild(contentSystem->DetachChild(0));
+        }
+        CastOffSystemsParams castOffSystemsParams(contentSystem, contentPage, currentSystem, this);
+        castOffSystemsParams.m_systemWidth = this->m_drawingPageWidth - this->m_drawingPageMarginLeft
+            - this->m_drawingPageMarginRight - currentSystem->m_systemLeftMar - currentSystem->m_systemRightMar;
+        // Without anchor, this is the first system of the document
+        castOffSystemsParams.m_shift = (anchorSize > 0) ? 0 : -contentSystem->GetDrawingLabelsWidth();
+        castOffSystemsParams.m_currentScoreDefWidth
+            = contentPage->m_drawingScoreDef.GetDrawingWidth() + contentSystem->GetDrawingAbbrLabelsWidth();
+
+        Functor castOffSystems(&Object::CastOffSystems, "CastOffSystems");
+        Functor castOffSystemsEnd(&Object::CastOffSystemsEnd, "CastOffSystemsEnd");
+        contentSystem->Process(&castOffSystems, &castOffSystemsParams, &castOffSystemsEnd);
+        delete contentSystem;
+
+        // Reset the scoreDef at the beginning of each system
+        this->SetCurrentScoreDefDoc(true);
+        if (optimize) {
+            this->OptimizeScoreDefDoc();
+        }
+
+        // Check if a new system starts where a system after the last edited one was starting, with the same scoreDef
+        // width since a key signature changed in an edited measure changes the beginning of all the following systems
+        for (i = 1; i < contentPage->GetChildCount(); ++i) {
+            System *system = vrv_cast<System *>(contentPage->GetChild(i));
+            assert(system);
+            Measure *measure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1));
+            if (!measure || (systemStarts.count(measure) == 0)) continue;
+            if (systemStarts.at(measure) <= lastEdited) continue;
+            if (!system->GetDrawingScoreDef()) continue;
+            if (system->GetDrawingScoreDef()->CalcDrawingWidth(this) == systemStartWidths.at(measure)) {
+                aligned = true;
+                break;
+            }
+        }
+
+        // Calculate the height of the new systems
+        contentPage->LayOutVertically(!m_options->m_lazyLayout.GetValue());
+        for (auto &child : *contentPage->GetChildren()) {
+            System *system = vrv_cast<System *>(child);
+            assert(system);
+            system->SetCastOffHeight(system->GetHeight());
+        }
+
+        if (aligned || (next == (int)systems.size())) break;
+
+        // Keep the last system for the next chunk with the one before as anchor
+        while (contentPage->GetChildCount() > 1) {
+            startPage->AddChild(contentPage->DetachChild(0));
+        }
+        anchor = NULL;
+        if (startPage->GetChildCount() > 0) {
+            anchor = dynamic_cast<System *>(startPage->DetachChild(startPage->GetChildCount() - 1));
+        }
+        chunk *= 2;
+    }
+    this->ResetDrawingPage();
+
+    // Gather all the systems from the start page for re-filling the pages
+    Page *castOffPage = new Page();
+    castOffPage->MoveChildrenFrom(startPage);
+    castOffPage->MoveChildrenFrom(contentPage);
+    for (i = next; i < (int)systems.size(); ++i) {
+        castOffPage->AddChild(systems.at(i));
+    }
+    pages->DeleteChild(contentPage);
+    pages->DeleteChild(startPage);
+
+    // Since the systems are not aligned together, set their position from the heights of the previous cast off
+    // in the same way as System::AlignSystems does on the content page
+    int systemMargin = (this->GetOptions()->m_spacingSystem.GetValue()) * this->GetDrawingUnit(100);
+    int shift = this->m_drawingPageHeight;
+    if (startPageIdx == 0) shift -= m_castOffPgHeadHeight;
+    for (auto &child : *castOffPage->GetChildren()) {
+        System *system = dynamic_cast<System *>(child);
+        assert(system && (system->GetCastOffHeight() != VRV_UNSET));
+        system->SetDrawingYRel(shift);
+        shift -= system->GetCastOffHeight() + systemMargin;
+    }
+
+    Page *currentPage = new Page();
+    CastOffPagesParams castOffPagesParams(castOffPage, this, currentPage);
+    castOffPagesParams.m_pgHeadHeight = m_castOffPgHeadHeight;
+    castOffPagesParams.m_pgFootHeight = m_castOffPgFootHeight;
+    castOffPagesParams.m_pgHead2Height = m_castOffPgHead2Height;
+    castOffPagesParams.m_pgFoot2Height = m_castOffPgFoot2Height;
+    castOffPagesParams.m_pageHeight = this->m_drawingPageHeight - this->m_drawingPageMarginBot;
+    // Not on the first page, do as if a new page was started
+    if (startPageIdx != 0) {
+        castOffPagesParams.m_pgHeadHeight = VRV_UNSET;
+        castOffPagesParams.m_shift = this->m_drawingPageHeight - castOffPagesParams.m_pageHeight;
+    }
+    Functor castOffPages(&Object::CastOffPages, "CastOffPages");
+    pages->AddChild(currentPage);
+    castOffPage->Process(&castOffPages, &castOffPagesParams);
+    delete castOffPage;
+
+    this->SetCurrentScoreDefDoc(true);
+    if (optimize) {
+        this->OptimizeScoreDefDoc();
+    }
+
+    // The pages before are kept but their drawing scoreDefs were set again and they have to be laid out again
+    for (i = 0; i < startPageIdx; ++i) {
+        Page *page = vrv_cast<Page *>(pages->GetChild(i));
+        assert(page);
+        page->ResetLayoutDone();
+    }
+
+    this->ClearStoredHorizontalLayout(true);
+}
+
+void Doc::ClearStoredHorizontalLayout(bool systemBoundariesOnly)
+{
+    ClassIdComparison matchSystem(SYSTEM);
+    ClassIdComparison matchMeasure(MEASURE);
+    ArrayOfObjects systems;
+    this->FindAllDescendantByComparison(&systems, &matchSystem);
+    for (auto system : systems) {
+        ArrayOfObjects measures;
+        system->FindAllDescendantByComparison(&measures, &matchMeasure, 1);
+        for (int i = 0; i < (int)measures.size(); ++i) {
+            if (systemBoundariesOnly && (i > 0) && (i < (int)measures.size() - 1)) continue;
+            vrv_cast<Measure *>(measures.at(i))->ClearStoredHorizontalLayout();
+        }
+    }
 }
 
 void Doc::CastOffRunningElements(CastOffPagesParams *params)
@@ -889,7 +1384,7 @@ void Doc::UnCastOffDoc()
 
     UnCastOffParams unCastOffParams(contentSystem);
 
-    Functor unCastOff(&Object::UnCastOff);
+    Functor unCastOff(&Object::UnCastOff, "UnCastOff");
     this->Process(&unCastOff, &unCastOffParams);
 
     pages->ClearChildren();
@@ -902,6 +1397,9 @@ void Doc::UnCastOffDoc()
     // because idx will still be 0 but contentPage is dead!
     this->ResetDrawingPage();
     this->SetCurrentScoreDefDoc(true);
+
+    // The document is no longer cast off
+    m_castOffPgHeadHeight = VRV_UNSET;
 }
 
 void Doc::CastOffEncodingDoc()
@@ -916,7 +1414,7 @@ void Doc::CastOffEncodingDoc()
 
     contentPage->LayOutHorizontally();
 
-    System *contentSystem = dynamic_cast<System *>(contentPage->FindDescendantByType(SYSTEM));
+    System *contentSystem = vrv_cast<System *>(contentPage->FindDescendantByType(SYSTEM));
     assert(contentSystem);
 
     // Detach the contentPage
@@ -930,7 +1428,7 @@ void Doc::CastOffEncodingDoc()
 
     CastOffEncodingParams castOffEncodingParams(this, page, system, contentSystem);
 
-    Functor castOffEncoding(&Object::CastOffEncoding);
+    Functor castOffEncoding(&Object::CastOffEncoding, "CastOffEncoding");
     contentSystem->Process(&castOffEncoding, &castOffEncodingParams);
     delete contentPage;
 
@@ -957,14 +1455,14 @@ void Doc::ConvertToPageBasedDoc()
     page->AddChild(system);
 
     ConvertToPageBasedParams convertToPageBasedParams(system);
-    Functor convertToPageBased(&Object::ConvertToPageBased);
-    Functor convertToPageBasedEnd(&Object::ConvertToPageBasedEnd);
+    Functor convertToPageBased(&Object::ConvertToPageBased, "ConvertToPageBased");
+    Functor convertToPageBasedEnd(&Object::ConvertToPageBasedEnd, "ConvertToPageBasedEnd");
     score->Process(&convertToPageBased, &convertToPageBasedParams, &convertToPageBasedEnd);
 
     score->ClearRelinquishedChildren();
     assert(score->GetChildCount() == 0);
 
-    Mdiv *mdiv = dynamic_cast<Mdiv *>(score->GetParent());
+    Mdiv *mdiv = vrv_cast<Mdiv *>(score->GetParent());
     assert(mdiv);
 
     mdiv->ReplaceChild(score, pages);
@@ -995,7 +1493,7 @@ void Doc::ConvertToCastOffMensuralDoc()
 
     // We need to populate processing lists for processing the document by Layer
     PrepareProcessingListsParams prepareProcessingListsParams;
-    Functor prepareProcessingLists(&Object::PrepareProcessingLists);
+    Functor prepareProcessingLists(&Object::PrepareProcessingLists, "PrepareProcessingLists");
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
     // The means no content? Checking just in case
@@ -1018,7 +1516,7 @@ void Doc::ConvertToCastOffMensuralDoc()
         convertToCastOffMensuralParams.m_staffNs.push_back(staves.first);
     }
 
-    Functor convertToCastOffMensural(&Object::ConvertToCastOffMensural);
+    Functor convertToCastOffMensural(&Object::ConvertToCastOffMensural, "ConvertToCastOffMensural");
     contentPage->Process(&convertToCastOffMensural, &convertToCastOffMensuralParams);
 
     // Detach the contentPage
@@ -1050,7 +1548,7 @@ void Doc::ConvertToUnCastOffMensuralDoc()
 
     // We need to populate processing lists for processing the document by Layer
     PrepareProcessingListsParams prepareProcessingListsParams;
-    Functor prepareProcessingLists(&Object::PrepareProcessingLists);
+    Functor prepareProcessingLists(&Object::PrepareProcessingLists, "PrepareProcessingLists");
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
     // The means no content? Checking just in case
@@ -1070,7 +1568,7 @@ void Doc::ConvertToUnCastOffMensuralDoc()
             convertToUnCastOffMensuralParams.m_contentMeasure = NULL;
             convertToUnCastOffMensuralParams.m_contentLayer = NULL;
 
-            Functor convertToUnCastOffMensural(&Object::ConvertToUnCastOffMensural);
+            Functor convertToUnCastOffMensural(&Object::ConvertToUnCastOffMensural, "ConvertToUnCastOffMensural");
             this->Process(&convertToUnCastOffMensural, &convertToUnCastOffMensuralParams, NULL, &filters);
 
             convertToUnCastOffMensuralParams.m_addSegmentsToDelete = false;
@@ -1079,7 +1577,7 @@ void Doc::ConvertToUnCastOffMensuralDoc()
 
     Page *contentPage = this->SetDrawingPage(0);
     assert(contentPage);
-    System *contentSystem = dynamic_cast<System *>(contentPage->FindDescendantByType(SYSTEM));
+    System *contentSystem = vrv_cast<System *>(contentPage->FindDescendantByType(SYSTEM));
     assert(contentSystem);
 
     // Detach the contentPage
@@ -1098,7 +1596,7 @@ void Doc::ConvertToUnCastOffMensuralDoc()
 void Doc::ConvertScoreDefMarkupDoc(bool permanent)
 {
     ConvertScoreDefMarkupParams convertScoreDefMarkupParams(permanent);
-    Functor convertScoreDefMarkup(&Object::ConvertScoreDefMarkup);
+    Functor convertScoreDefMarkup(&Object::ConvertScoreDefMarkup, "ConvertScoreDefMarkup");
 
     m_scoreDef.Process(&convertScoreDefMarkup, &convertScoreDefMarkupParams);
     this->Process(&convertScoreDefMarkup, &convertScoreDefMarkupParams);
@@ -1117,7 +1615,7 @@ void Doc::ConvertAnalyticalMarkupDoc(bool permanent)
     PrepareProcessingListsParams prepareProcessingListsParams;
 
     // We first fill a tree of ints with [staff/layer] and [staff/layer/verse] numbers (@n) to be processed
-    Functor prepareProcessingLists(&Object::PrepareProcessingLists);
+    Functor prepareProcessingLists(&Object::PrepareProcessingLists, "PrepareProcessingLists");
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
     IntTree_t::iterator staves;
@@ -1139,8 +1637,8 @@ void Doc::ConvertAnalyticalMarkupDoc(bool permanent)
             filters.push_back(&matchLayer);
 
             ConvertAnalyticalMarkupParams convertAnalyticalMarkupParams(permanent);
-            Functor convertAnalyticalMarkup(&Object::ConvertAnalyticalMarkup);
-            Functor convertAnalyticalMarkupEnd(&Object::ConvertAnalyticalMarkupEnd);
+            Functor convertAnalyticalMarkup(&Object::ConvertAnalyticalMarkup, "ConvertAnalyticalMarkup");
+            Functor convertAnalyticalMarkupEnd(&Object::ConvertAnalyticalMarkupEnd, "ConvertAnalyticalMarkupEnd");
             this->Process(
                 &convertAnalyticalMarkup, &convertAnalyticalMarkupParams, &convertAnalyticalMarkupEnd, &filters);
 
@@ -1170,7 +1668,7 @@ void Doc::TransposeDoc()
         // Find the starting key tonic of the data to use in calculating the tranposition interval:
         // Set transposition by key tonic.
         // Detect the current key from the keysignature.
-        KeySig *keysig = dynamic_cast<KeySig *>(this->m_scoreDef.FindDescendantByType(KEYSIG, 3));
+        KeySig *keysig = vrv_cast<KeySig *>(this->m_scoreDef.FindDescendantByType(KEYSIG, 3));
         // If there is no keysignature, assume it is C.
         TransPitch currentKey = TransPitch(0, 0, 0);
         if (keysig && keysig->HasPname()) {
@@ -1187,7 +1685,7 @@ void Doc::TransposeDoc()
     }
 
     else if (transposer.IsValidSemitones(transpositionOption)) {
-        KeySig *keysig = dynamic_cast<KeySig *>(this->m_scoreDef.FindDescendantByType(KEYSIG, 3));
+        KeySig *keysig = vrv_cast<KeySig *>(this->m_scoreDef.FindDescendantByType(KEYSIG, 3));
         int fifths = 0;
         if (keysig) {
             fifths = keysig->GetFifthsInt();
@@ -1207,7 +1705,7 @@ void Doc::TransposeDoc()
         return;
     }
 
-    Functor transpose(&Object::Transpose);
+    Functor transpose(&Object::Transpose, "Transpose");
     TransposeParams transposeParams(this, &transposer);
 
     if (this->m_options->m_transposeSelectedOnly.GetValue() == false) {
@@ -1266,12 +1764,12 @@ bool Doc::HasPage(int pageIdx)
 
 Score *Doc::GetScore()
 {
-    return dynamic_cast<Score *>(this->FindDescendantByType(SCORE));
+    return vrv_cast<Score *>(this->FindDescendantByType(SCORE));
 }
 
 Pages *Doc::GetPages()
 {
-    return dynamic_cast<Pages *>(this->FindDescendantByType(PAGES));
+    return vrv_cast<Pages *>(this->FindDescendantByType(PAGES));
 }
 
 int Doc::GetPageCount()
@@ -1280,39 +1778,87 @@ int Doc::GetPageCount()
     return ((pages) ? pages->GetChildCount() : 0);
 }
 
-int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
+const GlyphMetrics &Doc::GetGlyphMetrics(wchar_t code, bool graceSize) const
+{
+    const double graceFactor = this->m_options->m_graceFactor.GetValue();
+    if ((m_glyphMetricsFontVersion != m_resources.GetFontVersion())
+        || (m_glyphMetricsFontSize != m_drawingSmuflFontSize) || (m_glyphMetricsGraceFactor != graceFactor)) {
+        const int count = m_resources.GetSmuflCodeCount();
+        m_glyphMetrics.assign(2 * count, GlyphMetrics());
+        for (int i = 0; i < count; ++i) {
+            const Glyph *glyph = m_resources.GetGlyph(SMUFL_FIRST_CODE + i);
+            if (!glyph) continue;
+            m_glyphMetrics.at(2 * i) = this->CalcGlyphMetrics(glyph, false);
+            m_glyphMetrics.at(2 * i + 1) = this->CalcGlyphMetrics(glyph, true);
+        }
+        m_glyphMetricsFontVersion = m_resources.GetFontVersion();
+        m_glyphMetricsFontSize = m_drawingSmuflFontSize;
+        m_glyphMetricsGraceFactor = graceFactor;
+    }
+
+    const unsigned int index = (unsigned int)code - SMUFL_FIRST_CODE;
+    if (index < m_glyphMetrics.size() / 2) {
+        const GlyphMetrics &metrics = m_glyphMetrics[2 * index + graceSize];
+        if (!metrics.m_exists) {
+            // The metrics of a missing glyph are zero
+            LogError("Glyph U+%04X is missing from the music font", (int)code);
+            assert(false);
+        }
+        return metrics;
+    }
+
+    // Outside the SMuFL range
+    const Glyph *glyph = m_resources.GetGlyph(code);
+    if (!glyph) {
+        LogError("Glyph U+%04X is missing from the music font", (int)code);
+        assert(false);
+        m_glyphMetricsOutside = GlyphMetrics();
+        return m_glyphMetricsOutside;
+    }
+    m_glyphMetricsOutside = this->CalcGlyphMetrics(glyph, graceSize);
+    return m_glyphMetricsOutside;
+}
+
+GlyphMetrics Doc::CalcGlyphMetrics(const Glyph *glyph, bool graceSize) const
 {
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
     assert(glyph);
+
+    int x, y, w, h;
     glyph->GetBoundingBox(x, y, w, h);
+    int advX = glyph->GetHorizAdvX();
+    y = y * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
+    w = w * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
     h = h * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) h = h * this->m_options->m_graceFactor.GetValue();
-    h = h * staffSize / 100;
-    return h;
+    advX = advX * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
+    if (graceSize) {
+        y = y * this->m_options->m_graceFactor.GetValue();
+        w = w * this->m_options->m_graceFactor.GetValue();
+        h = h * this->m_options->m_graceFactor.GetValue();
+        advX = advX * this->m_options->m_graceFactor.GetValue();
+    }
+
+    GlyphMetrics metrics;
+    metrics.m_descender = y;
+    metrics.m_width = w;
+    metrics.m_height = h;
+    metrics.m_advX = advX;
+    metrics.m_exists = true;
+    return metrics;
+}
+
+int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
+{
+    return this->GetGlyphMetrics(code, graceSize).m_height * staffSize / 100;
 }
 
 int Doc::GetGlyphWidth(wchar_t code, int staffSize, bool graceSize) const
 {
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(x, y, w, h);
-    w = w * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) w = w * this->m_options->m_graceFactor.GetValue();
-    w = w * staffSize / 100;
-    return w;
+    return this->GetGlyphMetrics(code, graceSize).m_width * staffSize / 100;
 }
 
 int Doc::GetGlyphAdvX(wchar_t code, int staffSize, bool graceSize) const
 {
-    Glyph *glyph = Resources::GetGlyph(code);
-    assert(glyph);
-    int advX = glyph->GetHorizAdvX();
-    advX = advX * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) advX = advX * this->m_options->m_graceFactor.GetValue();
-    advX = advX * staffSize / 100;
-    return advX;
+    return this->GetGlyphMetrics(code, graceSize).m_advX * staffSize / 100;
 }
 
 Point Doc::ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staffSize, bool graceSize) const
@@ -1335,14 +1881,7 @@ Point Doc::ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staf
 
 int Doc::GetGlyphDescender(wchar_t code, int staffSize, bool graceSize) const
 {
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(x, y, w, h);
-    y = y * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) y = y * this->m_options->m_graceFactor.GetValue();
-    y = y * staffSize / 100;
-    return y;
+    return this->GetGlyphMetrics(code, graceSize).m_descender * staffSize / 100;
 }
 
 int Doc::GetTextGlyphHeight(wchar_t code, FontInfo *font, bool graceSize) const
@@ -1350,7 +1889,7 @@ int Doc::GetTextGlyphHeight(wchar_t code, FontInfo *font, bool graceSize) const
     assert(font);
 
     int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = m_resources.GetTextGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     h = h * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -1363,7 +1902,7 @@ int Doc::GetTextGlyphWidth(wchar_t code, FontInfo *font, bool graceSize) const
     assert(font);
 
     int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = m_resources.GetTextGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     w = w * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -1375,7 +1914,7 @@ int Doc::GetTextGlyphAdvX(wchar_t code, FontInfo *font, bool graceSize) const
 {
     assert(font);
 
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = m_resources.GetTextGlyph(code);
     assert(glyph);
     int advX = glyph->GetHorizAdvX();
     advX = advX * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -1388,7 +1927,7 @@ int Doc::GetTextGlyphDescender(wchar_t code, FontInfo *font, bool graceSize) con
     assert(font);
 
     int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = m_resources.GetTextGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     y = y * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -1558,6 +2097,80 @@ double Doc::GetTopMargin(const ClassId classId) const
     return m_options->m_defaultTopMargin.GetValue();
 }
 
+void Doc::ResetUuidIndexIfModified()
+{
+    // Anything was added, removed or changed in the tree
+    if (!this->IsModified()) return;
+
+    m_uuidIndexComplete = false;
+
+    this->Modify(false);
+}
+
+Object *Doc::FindElementByUuid(const std::string &uuid, Object *ancestor)
+{
+    this->ResetUuidIndexIfModified();
+
+    const UuidKey key = Object::UuidToKey(uuid);
+    auto it = m_uuidIndex.find(key);
+    // The uuid of the object was changed
+    if ((it != m_uuidIndex.end()) && (it->second->GetUuidKey() != key)) {
+        m_uuidIndex.erase(it);
+        it = m_uuidIndex.end();
+    }
+    // Objects might have been added since the index was built
+    if ((it == m_uuidIndex.end()) && !m_uuidIndexComplete) {
+        m_uuidIndex.clear();
+        m_uuidIndexDuplicates.clear();
+        AddToUuidIndexParams addToUuidIndexParams(&m_uuidIndex, &m_uuidIndexDuplicates);
+        Functor addToUuidIndex(&Object::AddToUuidIndex, "AddToUuidIndex");
+        this->Process(&addToUuidIndex, &addToUuidIndexParams);
+        m_uuidIndexComplete = true;
+        it = m_uuidIndex.find(key);
+    }
+
+    if (it == m_uuidIndex.end()) {
+        return NULL;
+    }
+
+    Object *element = it->second;
+    if (ancestor) {
+        Object *current = element;
+        while (current && (current != ancestor)) {
+            current = current->GetParent();
+        }
+        if (!current) {
+            // Another object with the same uuid can be a descendant of the ancestor
+            if (m_uuidIndexDuplicates.count(key)) return ancestor->FindDescendantByUuid(uuid);
+            return NULL;
+        }
+    }
+    return element;
+}
+
+void Doc::RemoveFromIndexes(Object *object)
+{
+    assert(object);
+
+    if (m_uuidIndex.empty() && !m_timeIndexDone) return;
+
+    // The real time index has to be built again from the timemap
+    if (m_timeIndexDone && object->Is({ MEASURE, NOTE, REST })) this->ClearTimeIndex();
+
+    const UuidKey key = object->GetUuidKey();
+    auto it = m_uuidIndex.find(key);
+    if ((it != m_uuidIndex.end()) && (it->second == object)) {
+        m_uuidIndex.erase(it);
+        // Another object with the same uuid is not in the index anymore
+        if (m_uuidIndexDuplicates.count(key)) m_uuidIndexComplete = false;
+    }
+    // The children of a reference object are owned elsewhere and can already be deleted
+    if (object->IsReferenceObject()) return;
+    for (auto child : *object->GetChildren()) {
+        this->RemoveFromIndexes(child);
+    }
+}
+
 Page *Doc::SetDrawingPage(int pageIdx)
 {
     // out of range
@@ -1570,7 +2183,7 @@ Page *Doc::SetDrawingPage(int pageIdx)
     }
     Pages *pages = this->GetPages();
     assert(pages);
-    m_drawingPage = dynamic_cast<Page *>(pages->GetChild(pageIdx));
+    m_drawingPage = vrv_cast<Page *>(pages->GetChild(pageIdx));
     assert(m_drawingPage);
 
     int glyph_size;
@@ -1670,7 +2283,7 @@ int Doc::GetAdjustedDrawingPageWidth() const
 
 int Doc::PrepareLyricsEnd(FunctorParams *functorParams)
 {
-    PrepareLyricsParams *params = dynamic_cast<PrepareLyricsParams *>(functorParams);
+    PrepareLyricsParams *params = vrv_cast<PrepareLyricsParams *>(functorParams);
     assert(params);
     if (!params->m_currentSyl) {
         return FUNCTOR_STOP; // early return
@@ -1693,7 +2306,7 @@ int Doc::PrepareLyricsEnd(FunctorParams *functorParams)
 
 int Doc::PrepareTimestampsEnd(FunctorParams *functorParams)
 {
-    PrepareTimestampsParams *params = dynamic_cast<PrepareTimestampsParams *>(functorParams);
+    PrepareTimestampsParams *params = vrv_cast<PrepareTimestampsParams *>(functorParams);
     assert(params);
 
     if (!m_options->m_openControlEvents.GetValue() || params->m_timeSpanningInterfaces.empty()) {
@@ -216,7 +216,11 @@ bool EditorToolkitCMN::Delete(std::string &elementId)
     if (!element) return false;
 
     if (element->Is(NOTE)) {
-        return this->DeleteNote(dynamic_cast<Note *>(element));
+        // The layer is kept for flagging the measure since the note can be deleted with its chord or beam
+        Object *layer = element->GetFirstAncestor(LAYER);
+        if (!this->DeleteNote(dynamic_cast<Note *>(element))) return false;
+        this->SetMeasureEdited((layer) ? layer : m_doc);
+        return true;
     }
     return false;
 }
@@ -228,13 +232,14 @@ bool EditorToolkitCMN::Drag(std::string &elementId, int x, int y)
 
     // For elements whose y-position corresponds to a certain pitch
     if (element->HasInterface(INTERFACE_PITCH)) {
-        Layer *layer = dynamic_cast<Layer *>(element->GetFirstAncestor(LAYER));
+        Layer *layer = vrv_cast<Layer *>(element->GetFirstAncestor(LAYER));
         if (!layer) return false;
         int oct;
         data_PITCHNAME pname
             = (data_PITCHNAME)m_view->CalculatePitchCode(layer, m_view->ToLogicalY(y), element->GetDrawingX(), &oct);
         element->GetPitchInterface()->SetPname(pname);
         element->GetPitchInterface()->SetOct(oct);
+        this->SetMeasureEdited(element);
 
         return true;
     }
@@ -257,6 +262,7 @@ bool EditorToolkitCMN::KeyDown(std::string &elementId, int key, bool shiftKey, b
             default: step = 0;
         }
         interface->AdjustPitchByOffset(step);
+        this->SetMeasureEdited(element);
         return true;
     }
     return false;
@@ -266,8 +272,8 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
 {
     if (!m_doc->GetDrawingPage()) return false;
 
-    Object *start = m_doc->GetDrawingPage()->FindDescendantByUuid(startid);
-    Object *end = m_doc->GetDrawingPage()->FindDescendantByUuid(endid);
+    Object *start = m_doc->FindElementByUuid(startid, m_doc->GetDrawingPage());
+    Object *end = m_doc->FindElementByUuid(endid, m_doc->GetDrawingPage());
     // Check if both start and end elements exist
     if (!start || !end) {
         LogMessage("Elements start and end ids '%s' and '%s' could not be found", startid.c_str(), endid.c_str());
@@ -283,7 +289,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
         return false;
     }
 
-    Measure *measure = dynamic_cast<Measure *>(start->GetFirstAncestor(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(start->GetFirstAncestor(MEASURE));
     assert(measure);
 
     ControlElement *element = NULL;
@@ -304,6 +310,8 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     measure->AddChild(element);
     interface->SetStartid(startid);
     interface->SetEndid(endid);
+    this->SetMeasureEdited(start);
+    this->SetMeasureEdited(end);
 
     this->m_chainedId = element->GetUuid();
 
@@ -314,14 +322,18 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
 {
     if (!m_doc->GetDrawingPage()) return false;
 
-    Object *start = m_doc->GetDrawingPage()->FindDescendantByUuid(startid);
+    Object *start = m_doc->FindElementByUuid(startid, m_doc->GetDrawingPage());
     // Check if both start and end elements exist
     if (!start) {
         LogMessage("Element start id '%s' could not be found", startid.c_str());
         return false;
     }
     if (elementType == "note") {
-        return this->InsertNote(start);
+        // The layer is kept for flagging the measure since a rest is replaced by the note
+        Object *layer = start->GetFirstAncestor(LAYER);
+        if (!this->InsertNote(start)) return false;
+        this->SetMeasureEdited((layer) ? layer : m_doc);
+        return true;
     }
     // Check if it is a LayerElement
     if (!dynamic_cast<LayerElement *>(start)) {
@@ -330,7 +342,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     }
 
     /*
-    Measure *measure = dynamic_cast<Measure *>(start->GetFirstAncestor(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(start->GetFirstAncestor(MEASURE));
     assert(measure);
 
     ControlElement *element = NULL;
@@ -393,6 +405,7 @@ bool EditorToolkitCMN::Set(std::string &elementId, std::string const &attribute,
     else if (Att::SetVisual(element, attribute, value))
         success = true;
     if (success) {
+        this->SetMeasureEdited(element);
         return true;
     }
     return false;
@@ -411,16 +424,37 @@ Object *EditorToolkitCMN::GetElement(std::string &elementId)
 
     // Try to get the element on the current drawing page
     if (m_doc->GetDrawingPage()) {
-        element = m_doc->GetDrawingPage()->FindDescendantByUuid(elementId);
+        element = m_doc->FindElementByUuid(elementId, m_doc->GetDrawingPage());
     }
     // If it wasn't there, try on the whole doc
     if (!element) {
-        element = m_doc->FindDescendantByUuid(elementId);
+        element = m_doc->FindElementByUuid(elementId);
     }
 
     return element;
 }
 
+void EditorToolkitCMN::SetMeasureEdited(Object *element)
+{
+    assert(element);
+
+    Measure *measure = NULL;
+    if (element->Is(MEASURE)) {
+        measure = dynamic_cast<Measure *>(element);
+    }
+    else {
+        measure = vrv_cast<Measure *>(element->GetFirstAncestor(MEASURE));
+    }
+
+    if (measure) {
+        measure->SetEdited(true);
+    }
+    // The element is not in a measure (e.g., a scoreDef) and the whole document has to be cast off again
+    else {
+        m_doc->SetCastOffOutdated();
+    }
+}
+
 bool EditorToolkitCMN::InsertNote(Object *object)
 {
     assert(object);
@@ -431,7 +465,7 @@ bool EditorToolkitCMN::InsertNote(Object *object)
     }
 
     if (object->Is(CHORD)) {
-        Chord *currentChord = dynamic_cast<Chord *>(object);
+        Chord *currentChord = vrv_cast<Chord *>(object);
         assert(currentChord);
         Note *note = new Note();
         currentChord->AddChild(note);
@@ -439,7 +473,7 @@ bool EditorToolkitCMN::InsertNote(Object *object)
         return true;
     }
     else if (object->Is(NOTE)) {
-        Note *currentNote = dynamic_cast<Note *>(object);
+        Note *currentNote = vrv_cast<Note *>(object);
         assert(currentNote);
 
         Chord *currentChord = currentNote->IsChordTone();
@@ -493,7 +527,7 @@ bool EditorToolkitCMN::InsertNote(Object *object)
         return true;
     }
     else if (object->Is(REST)) {
-        Rest *rest = dynamic_cast<Rest *>(object);
+        Rest *rest = vrv_cast<Rest *>(object);
         assert(rest);
         Note *note = new Note();
         note->DurationInterface::operator=(*rest);
@@ -195,14 +195,14 @@ bool EditorToolkitNeume::Chain(jsonxx::Array actions)
     info += "]";
     m_editInfo = info;
     if (status && runReorder) {
-        Object *obj = m_doc->GetDrawingPage()->FindDescendantByUuid(id);
+        Object *obj = m_doc->FindElementByUuid(id, m_doc->GetDrawingPage());
         Layer *layer = NULL;
         assert(obj);
         if (obj->Is(STAFF)) {
-            layer = dynamic_cast<Layer *>(obj->GetFirst(LAYER));
+            layer = vrv_cast<Layer *>(obj->GetFirst(LAYER));
         }
         else {
-            layer = dynamic_cast<Layer *>(obj->GetFirstAncestor(LAYER));
+            layer = vrv_cast<Layer *>(obj->GetFirstAncestor(LAYER));
         }
         assert(layer);
         layer->ReorderByXPos();
@@ -218,22 +218,16 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y, bool isChain)
         return false;
     }
 
-    // Try to get the element on the current drawing page
-    Object *element = m_doc->GetDrawingPage()->FindDescendantByUuid(elementId);
-
-    // If it wasn't there, go back up to the whole doc
-    if (!element) {
-        element = m_doc->FindDescendantByUuid(elementId);
-    }
+    Object *element = m_doc->FindElementByUuid(elementId);
     // Use relative x and y for now on
     // For elements whose y-position corresponds to a certain pitch
     if (element->HasInterface(INTERFACE_PITCH)) {
-        Layer *layer = dynamic_cast<Layer *>(element->GetFirstAncestor(LAYER));
+        Layer *layer = vrv_cast<Layer *>(element->GetFirstAncestor(LAYER));
         if (!layer) {
             LogError("Element does not have Layer parent. This should not happen.");
             return false;
         }
-        Staff *staff = dynamic_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+        Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
         assert(staff);
         // Calculate pitch difference based on y difference
         int pitchDifference = round((double)y / (double)m_doc->GetDrawingUnit(staff->m_drawingStaffSize));
@@ -245,7 +239,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y, bool isChain)
             if (element->Is(NC)) {
                 Nc *nc = dynamic_cast<Nc *>(element);
                 if (nc->GetLigated() == BOOLEAN_true) {
-                    Neume *neume = dynamic_cast<Neume *>(nc->GetFirstAncestor(NEUME));
+                    Neume *neume = vrv_cast<Neume *>(nc->GetFirstAncestor(NEUME));
                     Nc *nextNc = dynamic_cast<Nc *>(neume->GetChild(1 + neume->GetChildIndex(element)));
                     if (nextNc != NULL && nextNc->GetLigated() == BOOLEAN_true && nextNc->GetZone() == nc->GetZone())
                         ignoreFacs = true;
@@ -262,14 +256,14 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y, bool isChain)
     }
     // TODO Make more generic
     else if (element->Is(NEUME)) {
-        Neume *neume = dynamic_cast<Neume *>(element);
+        Neume *neume = vrv_cast<Neume *>(element);
         assert(neume);
-        Layer *layer = dynamic_cast<Layer *>(neume->GetFirstAncestor(LAYER));
+        Layer *layer = vrv_cast<Layer *>(neume->GetFirstAncestor(LAYER));
         if (!layer) {
             LogError("Element does not have Layer parent. This should not occur.");
             return false;
         }
-        Staff *staff = dynamic_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+        Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
         assert(staff);
         // Calculate difference in pitch based on y difference
         int pitchDifference = round((double)y / (double)m_doc->GetDrawingUnit(staff->m_drawingStaffSize));
@@ -289,7 +283,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y, bool isChain)
             assert(zone);
             zone->ShiftByXY(x, pitchDifference * staff->m_drawingStaffSize);
         }
-        else if (dynamic_cast<Nc *>(neume->FindDescendantByType(NC))->HasFacs()) {
+        else if (vrv_cast<Nc *>(neume->FindDescendantByType(NC))->HasFacs()) {
             std::set<Zone *> childZones; // Sets do not contain duplicate entries
             for (Object *child = neume->GetFirst(); child != NULL; child = neume->Object::GetNext()) {
                 FacsimileInterface *fi = child->GetFacsimileInterface();
@@ -303,12 +297,12 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y, bool isChain)
         }
     }
     else if (element->Is(SYLLABLE)) {
-        Syllable *syllable = dynamic_cast<Syllable *>(element);
+        Syllable *syllable = vrv_cast<Syllable *>(element);
         assert(syllable);
-        Layer *layer = dynamic_cast<Layer *>(syllable->GetFirstAncestor(LAYER));
+        Layer *layer = vrv_cast<Layer *>(syllable->GetFirstAncestor(LAYER));
         if (!layer) return false;
 
-        Staff *staff = dynamic_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+        Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
         assert(staff);
 
         int pitchDifference = round((double)y / (double)m_doc->GetDrawingUnit(staff->m_drawingStaffSize));
@@ -318,7 +312,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y, bool isChain)
         ArrayOfObjects neumes;
         syllable->FindAllDescendantByComparison(&neumes, &ac);
         for (auto it = neumes.begin(); it != neumes.end(); ++it) {
-            Neume *neume = dynamic_cast<Neume *>(*it);
+            Neume *neume = vrv_cast<Neume *>(*it);
             assert(neume);
             ClassIdComparison ac(NC);
             ArrayOfObjects ncs;
@@ -333,7 +327,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y, bool isChain)
                 assert(zone);
                 zone->ShiftByXY(x, pitchDifference * staff->m_drawingStaffSize);
             }
-            else if (dynamic_cast<Nc *>(neume->FindDescendantByType(NC))->HasFacs()) {
+            else if (vrv_cast<Nc *>(neume->FindDescendantByType(NC))->HasFacs()) {
                 std::set<Zone *> childZones;
                 for (Object *child = neume->GetFirst(); child != NULL; child = neume->Object::GetNext()) {
                     FacsimileInterface *fi = child->GetFacsimileInterface();
@@ -348,12 +342,12 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y, bool isChain)
         }
     }
     else if (element->Is(CLEF)) {
-        Clef *clef = dynamic_cast<Clef *>(element);
+        Clef *clef = vrv_cast<Clef *>(element);
         assert(clef);
-        Layer *layer = dynamic_cast<Layer *>(clef->GetFirstAncestor(LAYER));
+        Layer *layer = vrv_cast<Layer *>(clef->GetFirstAncestor(LAYER));
         if (!layer) return false;
 
-        Staff *staff = dynamic_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+        Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
         assert(staff);
         // Note that y param is relative to initial position for clefs
         int initialClefLine = clef->GetLine();
@@ -418,7 +412,7 @@ bool EditorToolkitNeume::Drag(std::string elementId, int x, int y, bool isChain)
         return false;
     }
     if (!isChain) {
-        Layer *layer = dynamic_cast<Layer *>(element->GetFirstAncestor(LAYER));
+        Layer *layer = vrv_cast<Layer *>(element->GetFirstAncestor(LAYER));
         layer->ReorderByXPos(); // Reflect position order of elements internally (and in the resulting output file)
     }
     return true;
@@ -452,11 +446,11 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
         staff = dynamic_cast<Staff *>(staves.at(0));
     }
     else {
-        staff = dynamic_cast<Staff *>(m_doc->FindDescendantByUuid(staffId));
+        staff = dynamic_cast<Staff *>(m_doc->FindElementByUuid(staffId));
     }
 
     assert(staff);
-    Layer *layer = dynamic_cast<Layer *>(staff->FindDescendantByType(LAYER));
+    Layer *layer = vrv_cast<Layer *>(staff->FindDescendantByType(LAYER));
     assert(layer);
     Facsimile *facsimile = m_doc->GetFacsimile();
     Zone *zone = new Zone();
@@ -474,7 +468,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
         zone->SetUly(uly);
         zone->SetLrx(lrx);
         zone->SetLry(lry);
-        Surface *surface = dynamic_cast<Surface *>(m_doc->GetFacsimile()->FindDescendantByType(SURFACE));
+        Surface *surface = vrv_cast<Surface *>(m_doc->GetFacsimile()->FindDescendantByType(SURFACE));
         assert(surface);
         surface->AddChild(zone);
         newStaff->SetZone(zone);
@@ -512,7 +506,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
         std::string contour = "";
         nc->SetZone(zone);
         nc->SetFacs(zone->GetUuid());
-        Surface *surface = dynamic_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
+        Surface *surface = vrv_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
         surface->AddChild(zone);
         zone->SetUlx(ulx);
 
@@ -660,7 +654,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
         zone->SetLry(uly + staffSize / 2);
         clef->SetZone(zone);
         clef->SetFacs(zone->GetUuid());
-        Surface *surface = dynamic_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
+        Surface *surface = vrv_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
         assert(surface);
         surface->AddChild(zone);
         layer->AddChild(clef);
@@ -722,7 +716,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
     else if (elementType == "custos") {
         Custos *custos = new Custos();
         zone->SetUlx(ulx);
-        Surface *surface = dynamic_cast<Surface *>(facsimile->GetFirst(SURFACE));
+        Surface *surface = vrv_cast<Surface *>(facsimile->GetFirst(SURFACE));
         surface->AddChild(zone);
         custos->SetZone(zone);
         custos->SetFacs(zone->GetUuid());
@@ -776,7 +770,7 @@ bool EditorToolkitNeume::Merge(std::vector<std::string> elementIds)
 
     // Get the staves by element ID and fail if a staff does not exist.
     for (auto it = elementIds.begin(); it != elementIds.end(); ++it) {
-        Object *obj = m_doc->GetDrawingPage()->FindDescendantByUuid(*it);
+        Object *obj = m_doc->FindElementByUuid(*it, m_doc->GetDrawingPage());
         if (obj != NULL && obj->Is(STAFF)) {
             staves.push_back(obj);
             Zone *zone = obj->GetFacsimileInterface()->GetZone();
@@ -803,12 +797,12 @@ bool EditorToolkitNeume::Merge(std::vector<std::string> elementIds)
     // Move children to the first staff (in order)
     auto stavesIt = staves.begin();
     Staff *fillStaff = dynamic_cast<Staff *>(*stavesIt);
-    Layer *fillLayer = dynamic_cast<Layer *>(fillStaff->GetFirst(LAYER));
+    Layer *fillLayer = vrv_cast<Layer *>(fillStaff->GetFirst(LAYER));
     assert(fillLayer);
     stavesIt++;
     for (; stavesIt != staves.end(); ++stavesIt) {
         Staff *sourceStaff = dynamic_cast<Staff *>(*stavesIt);
-        Layer *sourceLayer = dynamic_cast<Layer *>(sourceStaff->GetFirst(LAYER));
+        Layer *sourceLayer = vrv_cast<Layer *>(sourceStaff->GetFirst(LAYER));
         fillLayer->MoveChildrenFrom(sourceLayer);
         assert(sourceLayer->GetChildCount() == 0);
         Object *parent = sourceStaff->GetParent();
@@ -833,7 +827,7 @@ bool EditorToolkitNeume::Merge(std::vector<std::string> elementIds)
 bool EditorToolkitNeume::Set(std::string elementId, std::string attrType, std::string attrValue)
 {
     if (!m_doc->GetDrawingPage()) return false;
-    Object *element = m_doc->GetDrawingPage()->FindDescendantByUuid(elementId);
+    Object *element = m_doc->FindElementByUuid(elementId, m_doc->GetDrawingPage());
     bool success = false;
     if (Att::SetAnalytical(element, attrType, attrValue))
         success = true;
@@ -876,7 +870,7 @@ bool EditorToolkitNeume::SetText(std::string elementId, std::string text)
     std::wstring_convert<std::codecvt_utf8_utf16<wchar_t> > conv;
     wtext = conv.from_bytes(text);
     if (!m_doc->GetDrawingPage()) return false;
-    Object *element = m_doc->GetDrawingPage()->FindDescendantByUuid(elementId);
+    Object *element = m_doc->FindElementByUuid(elementId, m_doc->GetDrawingPage());
     if (element == NULL) {
         LogWarning("No element with ID '%s' exists", elementId.c_str());
         return false;
@@ -884,7 +878,7 @@ bool EditorToolkitNeume::SetText(std::string elementId, std::string text)
 
     bool success = false;
     if (element->Is(SYL)) {
-        Syl *syl = dynamic_cast<Syl *>(element);
+        Syl *syl = vrv_cast<Syl *>(element);
         assert(syl);
         Object *child = syl->GetFirst();
         if (child == NULL) {
@@ -915,7 +909,7 @@ bool EditorToolkitNeume::SetText(std::string elementId, std::string text)
         }
     }
     else if (element->Is(SYLLABLE)) {
-        Syllable *syllable = dynamic_cast<Syllable *>(element);
+        Syllable *syllable = vrv_cast<Syllable *>(element);
         assert(syllable);
         Object *syl = syllable->GetFirst(SYL);
         if (syl == NULL) {
@@ -947,7 +941,7 @@ bool EditorToolkitNeume::SetClef(std::string elementId, std::string shape)
     bool success = false;
     data_CLEFSHAPE clefShape = CLEFSHAPE_NONE;
     int shift = 0;
-    Clef *clef = dynamic_cast<Clef *>(m_doc->GetDrawingPage()->FindDescendantByUuid(elementId));
+    Clef *clef = vrv_cast<Clef *>(m_doc->FindElementByUuid(elementId, m_doc->GetDrawingPage()));
     assert(clef);
 
     if (shape == "C") {
@@ -966,7 +960,7 @@ bool EditorToolkitNeume::SetClef(std::string elementId, std::string shape)
             return false;
         }
 
-        Layer *layer = dynamic_cast<Layer *>(clef->GetFirstAncestor(LAYER));
+        Layer *layer = vrv_cast<Layer *>(clef->GetFirstAncestor(LAYER));
         assert(layer);
 
         Object *nextClef = m_doc->GetDrawingPage()->GetNext(clef, CLEF);
@@ -998,7 +992,7 @@ bool EditorToolkitNeume::Split(std::string elementId, int x)
         LogError("Could not get the drawing page");
         return false;
     }
-    Staff *staff = dynamic_cast<Staff *>(m_doc->GetDrawingPage()->FindDescendantByUuid(elementId));
+    Staff *staff = dynamic_cast<Staff *>(m_doc->FindElementByUuid(elementId, m_doc->GetDrawingPage()));
     // Validate parameters
     if (staff == NULL) {
         LogError("Either no element exists with ID '%s' or it is not a staff.", elementId.c_str());
@@ -1019,15 +1013,15 @@ bool EditorToolkitNeume::Split(std::string elementId, int x)
         LogError("Failed to create a second staff.");
         return false;
     }
-    Staff *splitStaff = dynamic_cast<Staff *>(m_doc->GetDrawingPage()->FindDescendantByUuid(m_editInfo));
+    Staff *splitStaff = dynamic_cast<Staff *>(m_doc->FindElementByUuid(m_editInfo, m_doc->GetDrawingPage()));
     assert(splitStaff);
     if (splitStaff == NULL) {
         LogMessage("Split staff is null");
     }
 
     staff->GetZone()->SetLrx(x);
-    Layer *layer = dynamic_cast<Layer *>(staff->GetFirst(LAYER));
-    Layer *splitLayer = dynamic_cast<Layer *>(splitStaff->GetFirst(LAYER));
+    Layer *layer = vrv_cast<Layer *>(staff->GetFirst(LAYER));
+    Layer *splitLayer = vrv_cast<Layer *>(splitStaff->GetFirst(LAYER));
 
     // Move any elements that should be on the second staff there.
     for (Object *child = layer->GetFirst(); child != NULL; child = layer->GetNext()) {
@@ -1040,7 +1034,7 @@ bool EditorToolkitNeume::Split(std::string elementId, int x)
             child->FindAllDescendantByComparison(&facsimileInterfaces, &ic);
 
             for (auto it = facsimileInterfaces.begin(); it != facsimileInterfaces.end(); ++it) {
-                FacsimileInterface *temp = dynamic_cast<FacsimileInterface *>(*it);
+                FacsimileInterface *temp = vrv_cross_cast<FacsimileInterface *>(*it);
                 assert(temp);
                 if (temp->HasFacs() && (fi == NULL || temp->GetZone()->GetUlx() < fi->GetZone()->GetUlx())) {
                     fi = temp;
@@ -1066,7 +1060,7 @@ bool EditorToolkitNeume::Remove(std::string elementId)
         LogError("Could not get the drawing page.");
         return false;
     }
-    Object *obj = m_doc->GetDrawingPage()->FindDescendantByUuid(elementId);
+    Object *obj = m_doc->FindElementByUuid(elementId, m_doc->GetDrawingPage());
     assert(obj);
     bool result, isNeume;
     isNeume = (obj->Is(NC) || obj->Is(NEUME) || obj->Is(SYLLABLE));
@@ -1126,13 +1120,13 @@ bool EditorToolkitNeume::Resize(std::string elementId, int ulx, int uly, int lrx
         return false;
     }
 
-    Object *obj = m_doc->GetDrawingPage()->FindDescendantByUuid(elementId);
+    Object *obj = m_doc->FindElementByUuid(elementId, m_doc->GetDrawingPage());
     if (obj == NULL) {
         LogError("Object with ID '%s' not found.", elementId.c_str());
         return false;
     }
     if (obj->Is(STAFF)) {
-        Staff *staff = dynamic_cast<Staff *>(obj);
+        Staff *staff = vrv_cast<Staff *>(obj);
         assert(staff);
         if (!staff->HasFacs()) {
             LogError("This staff does not have a facsimile.");
@@ -1184,7 +1178,7 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
     // Determine what the parents are
     for (auto it = elementIds.begin(); it != elementIds.end(); ++it) {
         // Verify that the children are of the same type
-        Object *el = m_doc->GetDrawingPage()->FindDescendantByUuid(*it);
+        Object *el = m_doc->FindElementByUuid(*it, m_doc->GetDrawingPage());
         if (el == NULL) {
             LogError("Could not get element with ID %s", it->c_str());
             return false;
@@ -1263,7 +1257,7 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
         }
         doubleParent->AddChild(parent);
 
-        Layer *layer = dynamic_cast<Layer *>(parent->GetFirstAncestor(LAYER));
+        Layer *layer = vrv_cast<Layer *>(parent->GetFirstAncestor(LAYER));
         assert(layer);
         layer->ReorderByXPos();
     }
@@ -1303,7 +1297,7 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
             // construct concatenated string of all the syls
             std::wstring fullString = L"";
             for (auto it = fullParents.begin(); it != fullParents.end(); ++it) {
-                Text *text = dynamic_cast<Text *>((*it)->FindDescendantByType(SYL)->FindDescendantByType(TEXT));
+                Text *text = vrv_cast<Text *>((*it)->FindDescendantByType(SYL)->FindDescendantByType(TEXT));
                 if (text != NULL) {
                     std::wstring currentString = text->GetText();
                     fullString = fullString + currentString;
@@ -1324,7 +1318,7 @@ bool EditorToolkitNeume::Group(std::string groupType, std::vector<std::string> e
                 return false;
             }
             doubleParent->AddChild(fullSyllable);
-            Layer *layer = dynamic_cast<Layer *>(fullSyllable->GetFirstAncestor(LAYER));
+            Layer *layer = vrv_cast<Layer *>(fullSyllable->GetFirstAncestor(LAYER));
             assert(layer);
             layer->ReorderByXPos();
             parent = fullSyllable;
@@ -1379,7 +1373,7 @@ bool EditorToolkitNeume::Ungroup(std::string groupType, std::vector<std::string>
         return false;
     }
     for (auto it = elementIds.begin(); it != elementIds.end(); ++it) {
-        Object *el = m_doc->GetDrawingPage()->FindDescendantByUuid(*it);
+        Object *el = m_doc->FindElementByUuid(*it, m_doc->GetDrawingPage());
         // Check for ligatures and toggle them before ungrouping
         // only if the ligature is the entire selection
         if (groupType == "nc" && elementIds.size() == 2) {
@@ -1396,11 +1390,11 @@ bool EditorToolkitNeume::Ungroup(std::string groupType, std::vector<std::string>
                     assert(secondNc);
                     Zone *zone = new Zone();
 
-                    Staff *staff = dynamic_cast<Staff *>(firstNc->GetFirstAncestor(STAFF));
+                    Staff *staff = vrv_cast<Staff *>(firstNc->GetFirstAncestor(STAFF));
                     assert(staff);
                     Facsimile *facsimile = m_doc->GetFacsimile();
                     assert(facsimile);
-                    Surface *surface = dynamic_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
+                    Surface *surface = vrv_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
                     assert(surface);
 
                     const int noteHeight = (int)(m_doc->GetDrawingDoubleUnit(staff->m_drawingStaffSize) / 2);
@@ -1451,7 +1445,7 @@ bool EditorToolkitNeume::Ungroup(std::string groupType, std::vector<std::string>
                 m_editInfo = m_editInfo + fparent->GetUuid();
                 sparent = fparent->GetFirstAncestor(SYLLABLE);
                 assert(sparent);
-                currentParent = dynamic_cast<Neume *>(fparent);
+                currentParent = vrv_cast<Neume *>(fparent);
                 assert(currentParent);
                 firstIsSyl = false;
             }
@@ -1461,7 +1455,7 @@ bool EditorToolkitNeume::Ungroup(std::string groupType, std::vector<std::string>
                 m_editInfo = m_editInfo + fparent->GetUuid();
                 sparent = fparent->GetFirstAncestor(LAYER);
                 assert(sparent);
-                currentParent = dynamic_cast<Syllable *>(fparent);
+                currentParent = vrv_cast<Syllable *>(fparent);
                 assert(currentParent);
                 firstIsSyl = false;
             }
@@ -1473,7 +1467,7 @@ bool EditorToolkitNeume::Ungroup(std::string groupType, std::vector<std::string>
         }
         else if (currentParent) {
             if (groupType == "nc") {
-                Nc *nc = dynamic_cast<Nc *>(el);
+                Nc *nc = vrv_cast<Nc *>(el);
                 assert(nc);
                 if (nc->HasLigated()) continue;
             }
@@ -1511,7 +1505,7 @@ bool EditorToolkitNeume::ChangeGroup(std::string elementId, std::string contour)
         LogError("Could not get the drawing page.");
         return false;
     }
-    Neume *el = dynamic_cast<Neume *>(m_doc->GetDrawingPage()->FindDescendantByUuid(elementId));
+    Neume *el = dynamic_cast<Neume *>(m_doc->FindElementByUuid(elementId, m_doc->GetDrawingPage()));
     if (el == NULL) {
         LogError("Unable to find neume with id %s", elementId.c_str());
         return false;
@@ -1541,7 +1535,7 @@ bool EditorToolkitNeume::ChangeGroup(std::string elementId, std::string contour)
     int initialLrx = firstChild->GetZone()->GetLrx();
     int initialLry = firstChild->GetZone()->GetLry();
 
-    Staff *staff = dynamic_cast<Staff *>(el->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(el->GetFirstAncestor(STAFF));
     assert(staff);
     Facsimile *facsimile = m_doc->GetFacsimile();
 
@@ -1589,7 +1583,7 @@ bool EditorToolkitNeume::ChangeGroup(std::string elementId, std::string contour)
         newNc->SetZone(zone);
         newNc->SetFacs(zone->GetUuid());
 
-        Surface *surface = dynamic_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
+        Surface *surface = vrv_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
         assert(surface);
         surface->AddChild(zone);
 
@@ -1612,7 +1606,7 @@ bool EditorToolkitNeume::ToggleLigature(std::vector<std::string> elementIds, std
     bool success2 = false;
     Facsimile *facsimile = m_doc->GetFacsimile();
     assert(facsimile);
-    Surface *surface = dynamic_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
+    Surface *surface = vrv_cast<Surface *>(facsimile->FindDescendantByType(SURFACE));
     assert(surface);
     std::string firstNcId = elementIds[0];
     std::string secondNcId = elementIds[1];
@@ -1622,9 +1616,9 @@ bool EditorToolkitNeume::ToggleLigature(std::vector<std::string> elementIds, std
         return false;
     }
 
-    Nc *firstNc = dynamic_cast<Nc *>(m_doc->GetDrawingPage()->FindDescendantByUuid(firstNcId));
+    Nc *firstNc = vrv_cast<Nc *>(m_doc->FindElementByUuid(firstNcId, m_doc->GetDrawingPage()));
     assert(firstNc);
-    Nc *secondNc = dynamic_cast<Nc *>(m_doc->GetDrawingPage()->FindDescendantByUuid(secondNcId));
+    Nc *secondNc = vrv_cast<Nc *>(m_doc->FindElementByUuid(secondNcId, m_doc->GetDrawingPage()));
     assert(secondNc);
     Zone *zone = new Zone();
     // set ligature to false and update zone of second Nc
@@ -1636,7 +1630,7 @@ bool EditorToolkitNeume::ToggleLigature(std::vector<std::string> elementIds, std
         int ligLrx = firstNc->GetZone()->GetLrx();
         int ligLry = firstNc->GetZone()->GetLry();
 
-        Staff *staff = dynamic_cast<Staff *>(firstNc->GetFirstAncestor(STAFF));
+        Staff *staff = vrv_cast<Staff *>(firstNc->GetFirstAncestor(STAFF));
         assert(staff);
 
         const int noteHeight = (int)(m_doc->GetDrawingDoubleUnit(staff->m_drawingStaffSize) / 2);
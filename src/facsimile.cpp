@@ -54,7 +54,7 @@ int Facsimile::GetMaxX()
 
     int max = 0;
     for (auto iter = surfaces.begin(); iter != surfaces.end(); iter++) {
-        Surface *surface = dynamic_cast<Surface *>(*iter);
+        Surface *surface = vrv_cast<Surface *>(*iter);
         assert(surface);
         max = (surface->GetMaxX() > max) ? surface->GetMaxX() : max;
     }
@@ -69,7 +69,7 @@ int Facsimile::GetMaxY()
 
     int max = 0;
     for (auto iter = surfaces.begin(); iter != surfaces.end(); iter++) {
-        Surface *surface = dynamic_cast<Surface *>(*iter);
+        Surface *surface = vrv_cast<Surface *>(*iter);
         assert(surface);
         max = (surface->GetMaxY() > max) ? surface->GetMaxY() : max;
     }
@@ -57,7 +57,7 @@ int FacsimileInterface::GetWidth() const
 int FacsimileInterface::GetSurfaceY() const
 {
     assert(m_zone);
-    Surface *surface = dynamic_cast<Surface *>(m_zone->GetFirstAncestor(SURFACE));
+    Surface *surface = vrv_cast<Surface *>(m_zone->GetFirstAncestor(SURFACE));
     assert(surface);
     if (surface->HasLry()) {
         return surface->GetLry();
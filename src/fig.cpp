@@ -59,10 +59,10 @@ void Fig::AddChild(Object *child)
 
 int Fig::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
-    Svg *svg = dynamic_cast<Svg *>(this->FindDescendantByType(SVG));
+    Svg *svg = vrv_cast<Svg *>(this->FindDescendantByType(SVG));
     int width = (svg) ? svg->GetWidth() : 0;
 
     if (this->GetHalign() == HORIZONTALALIGNMENT_right) {
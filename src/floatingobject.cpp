@@ -42,7 +42,7 @@ namespace vrv {
 // Static members
 //----------------------------------------------------------------------------
 
-std::vector<void *> FloatingObject::s_drawingObjectIds;
+thread_local std::vector<void *> FloatingObject::s_drawingObjectIds;
 
 //----------------------------------------------------------------------------
 // FloatingObject
@@ -155,19 +155,19 @@ FloatingPositioner::FloatingPositioner(FloatingObject *object, StaffAlignment *a
         m_place = STAFFREL_above;
     }
     else if (object->Is(BREATH)) {
-        Breath *breath = dynamic_cast<Breath *>(object);
+        Breath *breath = vrv_cast<Breath *>(object);
         assert(breath);
         // breath above by default
         m_place = (breath->GetPlace() != STAFFREL_NONE) ? breath->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(DIR)) {
-        Dir *dir = dynamic_cast<Dir *>(object);
+        Dir *dir = vrv_cast<Dir *>(object);
         assert(dir);
         // dir below by default
         m_place = (dir->GetPlace() != STAFFREL_NONE) ? dir->GetPlace() : STAFFREL_below;
     }
     else if (object->Is(DYNAM)) {
-        Dynam *dynam = dynamic_cast<Dynam *>(object);
+        Dynam *dynam = vrv_cast<Dynam *>(object);
         assert(dynam);
         // dynam below by default
         m_place = (dynam->GetPlace() != STAFFREL_NONE) ? dynam->GetPlace() : STAFFREL_below;
@@ -177,62 +177,62 @@ FloatingPositioner::FloatingPositioner(FloatingObject *object, StaffAlignment *a
         m_place = STAFFREL_above;
     }
     else if (object->Is(FERMATA)) {
-        Fermata *fermata = dynamic_cast<Fermata *>(object);
+        Fermata *fermata = vrv_cast<Fermata *>(object);
         assert(fermata);
         // fermata above by default
         m_place = (fermata->GetPlace() != STAFFREL_NONE) ? fermata->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(HAIRPIN)) {
-        Hairpin *hairpin = dynamic_cast<Hairpin *>(object);
+        Hairpin *hairpin = vrv_cast<Hairpin *>(object);
         assert(hairpin);
         // haripin below by default;
         m_place = (hairpin->GetPlace() != STAFFREL_NONE) ? hairpin->GetPlace() : STAFFREL_below;
     }
     else if (object->Is(HARM)) {
-        Harm *harm = dynamic_cast<Harm *>(object);
+        Harm *harm = vrv_cast<Harm *>(object);
         assert(harm);
         // harm above by default
         m_place = (harm->GetPlace() != STAFFREL_NONE) ? harm->GetPlace() : STAFFREL_above;
         if ((harm->GetPlace() == STAFFREL_NONE) && object->GetFirst()->Is(FB)) m_place = STAFFREL_below;
     }
     else if (object->Is(MORDENT)) {
-        Mordent *mordent = dynamic_cast<Mordent *>(object);
+        Mordent *mordent = vrv_cast<Mordent *>(object);
         assert(mordent);
         // mordent above by default;
         m_place = (mordent->GetPlace() != STAFFREL_NONE) ? mordent->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(OCTAVE)) {
-        Octave *octave = dynamic_cast<Octave *>(object);
+        Octave *octave = vrv_cast<Octave *>(object);
         assert(octave);
         // octave below by default (won't draw without @dis.place anyway);
         m_place = (octave->GetDisPlace() == STAFFREL_basic_above) ? STAFFREL_above : STAFFREL_below;
     }
     else if (object->Is(PEDAL)) {
-        Pedal *pedal = dynamic_cast<Pedal *>(object);
+        Pedal *pedal = vrv_cast<Pedal *>(object);
         assert(pedal);
         // pedal below by default
         m_place = (pedal->GetPlace() != STAFFREL_NONE) ? pedal->GetPlace() : STAFFREL_below;
     }
     else if (object->Is(REH)) {
-        Reh *reh = dynamic_cast<Reh *>(object);
+        Reh *reh = vrv_cast<Reh *>(object);
         assert(reh);
         // reh above by default
         m_place = (reh->GetPlace() != STAFFREL_NONE) ? reh->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(TEMPO)) {
-        Tempo *tempo = dynamic_cast<Tempo *>(object);
+        Tempo *tempo = vrv_cast<Tempo *>(object);
         assert(tempo);
         // tempo above by default;
         m_place = (tempo->GetPlace() != STAFFREL_NONE) ? tempo->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(TRILL)) {
-        Trill *trill = dynamic_cast<Trill *>(object);
+        Trill *trill = vrv_cast<Trill *>(object);
         assert(trill);
         // trill above by default;
         m_place = (trill->GetPlace() != STAFFREL_NONE) ? trill->GetPlace() : STAFFREL_above;
     }
     else if (object->Is(TURN)) {
-        Turn *turn = dynamic_cast<Turn *>(object);
+        Turn *turn = vrv_cast<Turn *>(object);
         assert(turn);
         // turn above by default;
         m_place = (turn->GetPlace() != STAFFREL_NONE) ? turn->GetPlace() : STAFFREL_above;
@@ -415,6 +415,7 @@ void FloatingCurvePositioner::ResetCurveParams()
     m_thickness = 0;
     m_dir = curvature_CURVEDIR_NONE;
     m_cachedMinMaxY = VRV_UNSET;
+    m_cachedThickBezierY = VRV_UNSET;
     ClearSpannedElements();
 }
 
@@ -434,6 +435,7 @@ void FloatingCurvePositioner::UpdateCurveParams(
     m_thickness = thickness;
     m_dir = curveDir;
     m_cachedMinMaxY = VRV_UNSET;
+    m_cachedThickBezierY = VRV_UNSET;
 }
 
 int FloatingCurvePositioner::CalcMinMaxY(const Point points[4])
@@ -453,10 +455,16 @@ int FloatingCurvePositioner::CalcMinMaxY(const Point points[4])
     return m_cachedMinMaxY;
 }
 
-int FloatingCurvePositioner::CalcAdjustment(BoundingBox *boundingBox, bool &discard, int margin)
+void FloatingCurvePositioner::CalcAdjustments(
+    const ArrayOfCurveSpannedElements *spannedElements, std::vector<int> &adjustments, int margin)
 {
-    assert(boundingBox);
-    assert(boundingBox->HasSelfBB());
+    assert(spannedElements);
+    assert(this->GetObject());
+    assert(this->GetObject()->Is({ SLUR, TIE }));
+
+    const int count = (int)spannedElements->size();
+    adjustments.assign(count, 0);
+    if (count == 0) return;
 
     Point points[4];
     // We need to get the points because then stored points are relative
@@ -466,99 +474,156 @@ int FloatingCurvePositioner::CalcAdjustment(BoundingBox *boundingBox, bool &disc
     Point p1 = points[0];
     Point p2 = points[3];
 
-    Accessor type = SELF;
     // bool keepInside = element->Is({ARTIC, ARTIC_PART, NOTE, STEM}));
     // The idea is to force only some of the elements to be inside a slur.
     // However, this currently does work because skipping an adjustment can cause collision later depending on how
     // the slur is eventually adjusted. Keeping erverything inside now.
     bool keepInside = true;
-    discard = false;
 
-    // first check if they overlap at all
-    if (p2.x < boundingBox->GetLeftBy(type) + margin) return 0;
-    if (p1.x > boundingBox->GetRightBy(type) + margin) return 0;
-
-    Point topBezier[4], bottomBezier[4];
-    BoundingBox::CalcThickBezier(points, this->GetThickness(), this->GetAngle(), topBezier, bottomBezier);
-
-    if (this->GetDir() == curvature_CURVEDIR_above) {
-        // The curve is below the content - if the element needs to be kept inside (e.g. a note), then do not return.
-        if (((this->GetTopBy(type) + margin) < boundingBox->GetBottomBy(type)) && !keepInside) {
-            return 0;
+    // First evaluate the curves on the left and on the right of all the elements in one pass
+    // The curve below is used only when the curve is above
+    const bool isAbove = (this->GetDir() == curvature_CURVEDIR_above);
+    std::vector<int> lefts(count), rights(count);
+    for (int i = 0; i < count; ++i) {
+        BoundingBox *boundingBox = spannedElements->at(i)->m_boundingBox;
+        assert(boundingBox);
+        assert(boundingBox->HasSelfBB());
+        lefts.at(i) = boundingBox->GetSelfLeft();
+        rights.at(i) = boundingBox->GetSelfRight();
+    }
+    std::vector<int> topLefts(count), topRights(count);
+    this->GetTopCurve().CalcYAtPositions(lefts.data(), topLefts.data(), count);
+    this->GetTopCurve().CalcYAtPositions(rights.data(), topRights.data(), count);
+    std::vector<int> bottomLefts, bottomRights;
+    if (isAbove) {
+        bottomLefts.resize(count);
+        bottomRights.resize(count);
+        this->GetBottomCurve().CalcYAtPositions(lefts.data(), bottomLefts.data(), count);
+        this->GetBottomCurve().CalcYAtPositions(rights.data(), bottomRights.data(), count);
+    }
+
+    for (int i = 0; i < count; ++i) {
+        CurveSpannedElement *spannedElement = spannedElements->at(i);
+        if (spannedElement->m_discarded) continue;
+
+        BoundingBox *boundingBox = spannedElement->m_boundingBox;
+        const int left = lefts.at(i);
+        const int right = rights.at(i);
+
+        // first check if they overlap at all
+        if (p2.x < left + margin) continue;
+        if (p1.x > right + margin) continue;
+
+        // The curve is below the content - if the element needs to be kept inside (e.g. a note), then do not
+        // return.
+        if (((this->GetSelfTop() + margin) < boundingBox->GetSelfBottom()) && !keepInside) {
+            continue;
         }
+
         int leftY = 0;
         int rightY = 0;
-        // The curve overflows on both sides
-        if ((p1.x < boundingBox->GetLeftBy(type)) && p2.x > boundingBox->GetRightBy(type)) {
-            // Calcuate the y positions
-            leftY = BoundingBox::CalcBezierAtPosition(bottomBezier, boundingBox->GetLeftBy(type)) - margin;
-            rightY = BoundingBox::CalcBezierAtPosition(bottomBezier, boundingBox->GetRightBy(type)) - margin;
-        }
-        // The curve overflows on the left
-        else if ((p1.x < boundingBox->GetLeftBy(type)) && p2.x <= boundingBox->GetRightBy(type)) {
-            leftY = BoundingBox::CalcBezierAtPosition(topBezier, boundingBox->GetLeftBy(type)) - margin;
-            rightY = p2.y - margin;
-        }
-        // The curve overflows on the right
-        else if ((p1.x >= boundingBox->GetLeftBy(type)) && p2.x > boundingBox->GetRightBy(type)) {
-            leftY = p1.y - margin;
-            rightY = BoundingBox::CalcBezierAtPosition(topBezier, boundingBox->GetRightBy(type)) - margin;
+        if (isAbove) {
+            // The curve overflows on both sides
+            if ((p1.x < left) && p2.x > right) {
+                leftY = bottomLefts.at(i) - margin;
+                rightY = bottomRights.at(i) - margin;
+            }
+            // The curve overflows on the left
+            else if ((p1.x < left) && p2.x <= right) {
+                leftY = topLefts.at(i) - margin;
+                rightY = p2.y - margin;
+            }
+            // The curve overflows on the right
+            else if ((p1.x >= left) && p2.x > right) {
+                leftY = p1.y - margin;
+                rightY = topRights.at(i) - margin;
+            }
+            // The curve is inside the left and right side of the content
+            else {
+                leftY = p1.y - margin;
+                rightY = p2.y - margin;
+            }
+
+            // Now check what to do
+            // Everything is underneath - we can discard the element
+            if ((leftY >= boundingBox->GetSelfTop()) && (rightY >= boundingBox->GetSelfTop())) {
+                spannedElement->m_discarded = true;
+                continue;
+            }
+            // The maximum adjustment required
+            adjustments.at(i)
+                = std::max(boundingBox->GetSelfTop() - leftY, boundingBox->GetSelfBottom() - rightY);
         }
-        // The curve is inside the left and right side of the content
         else {
-            leftY = p1.y - margin;
-            rightY = p2.y - margin;
-        }
+            // The curve overflows on both sides
+            if ((p1.x < left) && p2.x > right) {
+                leftY = topLefts.at(i) + margin;
+                rightY = topRights.at(i) + margin;
+            }
+            // The curve overflows on the left
+            else if ((p1.x < left) && p2.x <= right) {
+                leftY = topLefts.at(i) + margin;
+                rightY = p2.y + margin;
+            }
+            // The curve overflows on the right
+            else if ((p1.x >= left) && p2.x > right) {
+                leftY = p1.y + margin;
+                rightY = topRights.at(i) + margin;
+            }
+            // The curve is inside the left and right side of the content
+            else {
+                leftY = p1.y + margin;
+                rightY = p2.y + margin;
+            }
 
-        // Now check what to do
-        // Everything is underneath - we can discard the element
-        if ((leftY >= boundingBox->GetTopBy(type)) && (rightY >= boundingBox->GetTopBy(type))) {
-            discard = true;
-            return 0;
+            // Now check what to do
+            // Everything is above - we can discard the element
+            if ((leftY <= boundingBox->GetSelfBottom()) && (rightY <= boundingBox->GetSelfBottom())) {
+                spannedElement->m_discarded = true;
+                continue;
+            }
+            // The maximum adjustment required
+            adjustments.at(i)
+                = std::max(leftY - boundingBox->GetSelfBottom(), rightY - boundingBox->GetSelfBottom());
         }
-        // Return the maximum adjustment required
-        return std::max(boundingBox->GetTopBy(type) - leftY, boundingBox->GetBottomBy(type) - rightY);
     }
-    else {
-        // The curve is below the content - if the element needs to be kept inside (e.g. a note), then do not return.
-        if (((this->GetTopBy(type) + margin) < boundingBox->GetBottomBy(type)) && !keepInside) {
-            return 0;
-        }
-        int leftY = 0;
-        int rightY = 0;
-        // The curve overflows on both sides
-        if ((p1.x < boundingBox->GetLeftBy(type)) && p2.x > boundingBox->GetRightBy(type)) {
-            // Calcuate the y positions
-            leftY = BoundingBox::CalcBezierAtPosition(topBezier, boundingBox->GetLeftBy(type)) + margin;
-            rightY = BoundingBox::CalcBezierAtPosition(topBezier, boundingBox->GetRightBy(type)) + margin;
-        }
-        // The curve overflows on the left
-        else if ((p1.x < boundingBox->GetLeftBy(type)) && p2.x <= boundingBox->GetRightBy(type)) {
-            leftY = BoundingBox::CalcBezierAtPosition(topBezier, boundingBox->GetLeftBy(type)) + margin;
-            rightY = p2.y + margin;
-        }
-        // The curve overflows on the right
-        else if ((p1.x >= boundingBox->GetLeftBy(type)) && p2.x > boundingBox->GetRightBy(type)) {
-            leftY = p1.y + margin;
-            rightY = BoundingBox::CalcBezierAtPosition(topBezier, boundingBox->GetRightBy(type)) + margin;
-        }
-        // The curve is inside the left and right side of the content
-        else {
-            leftY = p1.y + margin;
-            rightY = p2.y + margin;
-        }
+}
 
-        // Now check what to do
-        // Everything is above - we can discard the element
-        if ((leftY <= boundingBox->GetBottomBy(type)) && (rightY <= boundingBox->GetBottomBy(type))) {
-            discard = true;
-            return 0;
-        }
-        // Return the maximum adjustment required
-        return std::max(leftY - boundingBox->GetBottomBy(type), rightY - boundingBox->GetBottomBy(type));
+void FloatingCurvePositioner::GetThickBezier(Point topBezier[4], Point bottomBezier[4])
+{
+    this->UpdateThickBezier();
+    for (int i = 0; i < 4; ++i) {
+        topBezier[i] = m_cachedTopBezier[i];
+        bottomBezier[i] = m_cachedBottomBezier[i];
     }
 }
 
+const BezierCurve &FloatingCurvePositioner::GetTopCurve()
+{
+    this->UpdateThickBezier();
+    return m_cachedTopCurve;
+}
+
+const BezierCurve &FloatingCurvePositioner::GetBottomCurve()
+{
+    this->UpdateThickBezier();
+    return m_cachedBottomCurve;
+}
+
+void FloatingCurvePositioner::UpdateThickBezier()
+{
+    int currentY = this->GetDrawingY();
+    if ((m_cachedThickBezierY != VRV_UNSET) && (m_cachedThickBezierY == currentY)) return;
+
+    Point points[4];
+    this->GetPoints(points);
+    BoundingBox::CalcThickBezier(
+        points, this->GetThickness(), this->GetAngle(), m_cachedTopBezier, m_cachedBottomBezier);
+    m_cachedTopCurve.SetPoints(m_cachedTopBezier);
+    m_cachedBottomCurve.SetPoints(m_cachedBottomBezier);
+    m_cachedThickBezierY = currentY;
+}
+
 void FloatingCurvePositioner::GetPoints(Point points[4])
 {
     points[0] = m_points[0];
@@ -84,7 +84,7 @@ void FTrem::FilterList(ArrayOfObjects *childList)
         }
         // also remove notes within chords
         if ((*iter)->Is(NOTE)) {
-            Note *note = dynamic_cast<Note *>(*iter);
+            Note *note = vrv_cast<Note *>(*iter);
             assert(note);
             if (note->IsChordTone()) {
                 iter = childList->erase(iter);
@@ -162,7 +162,7 @@ void FTrem::ClearCoords()
 
 int FTrem::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
+    CalcStemParams *params = vrv_cast<CalcStemParams *>(functorParams);
     assert(params);
 
     const ArrayOfObjects *fTremChildren = this->GetList(this);
@@ -177,9 +177,9 @@ int FTrem::CalcStem(FunctorParams *functorParams)
 
     int elementCount = 2;
 
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
     assert(layer);
-    Staff *staff = dynamic_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
     assert(staff);
 
     this->m_drawingParams.CalcBeam(layer, staff, params->m_doc, beamElementCoords, elementCount);
@@ -10,7 +10,10 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <mutex>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 //----------------------------------------------------------------------------
 
@@ -22,12 +25,17 @@
 
 namespace vrv {
 
+/** The glyphs are shared between threads, so parsing their XML content on demand has to be protected */
+static std::mutex s_xmlDocumentMutex;
+
 //----------------------------------------------------------------------------
 // Glyph
 //----------------------------------------------------------------------------
 
 Glyph::Glyph()
 {
+    m_xmlOffset = 0;
+    m_xmlLength = 0;
     m_x = 0;
     m_y = 0;
     m_width = 0;
@@ -40,6 +48,8 @@ Glyph::Glyph()
 
 Glyph::Glyph(std::string path, std::string codeStr)
 {
+    m_xmlOffset = 0;
+    m_xmlLength = 0;
     m_x = 0;
     m_y = 0;
     m_width = 0;
@@ -76,6 +86,8 @@ Glyph::Glyph(std::string path, std::string codeStr)
 
 Glyph::Glyph(int unitsPerEm)
 {
+    m_xmlOffset = 0;
+    m_xmlLength = 0;
     m_x = 0;
     m_y = 0;
     m_width = 0;
@@ -96,7 +108,7 @@ void Glyph::SetBoundingBox(double x, double y, double w, double h)
     m_height = (int)(10.0 * h);
 }
 
-void Glyph::GetBoundingBox(int &x, int &y, int &w, int &h)
+void Glyph::GetBoundingBox(int &x, int &y, int &w, int &h) const
 {
     x = m_x;
     y = m_y;
@@ -126,14 +138,133 @@ void Glyph::SetAnchor(std::string anchorStr, double x, double y)
     m_anchors[anchorId] = Point(x * this->GetUnitsPerEm() / 4, y * this->GetUnitsPerEm() / 4);
 }
 
-bool Glyph::HasAnchor(SMuFLGlyphAnchor anchor)
+bool Glyph::HasAnchor(SMuFLGlyphAnchor anchor) const
 {
     return (m_anchors.count(anchor) == 1);
 }
 
-const Point *Glyph::GetAnchor(SMuFLGlyphAnchor anchor)
+const Point *Glyph::GetAnchor(SMuFLGlyphAnchor anchor) const
+{
+    std::map<SMuFLGlyphAnchor, Point>::const_iterator it = m_anchors.find(anchor);
+    if (it == m_anchors.end()) return NULL;
+    return &it->second;
+}
+
+const char *Glyph::GetXML(size_t &length) const
+{
+    if (!m_bundle) return NULL;
+    length = m_xmlLength;
+    return m_bundle->data() + m_xmlOffset;
+}
+
+std::shared_ptr<const pugi::xml_document> Glyph::GetXMLDocument() const
+{
+    std::lock_guard<std::mutex> lock(s_xmlDocumentMutex);
+    if (m_xmlDocument) return m_xmlDocument;
+
+    std::shared_ptr<pugi::xml_document> xmlDocument = std::make_shared<pugi::xml_document>();
+    pugi::xml_parse_result result;
+    size_t length = 0;
+    const char *xml = this->GetXML(length);
+    if (xml) {
+        result = xmlDocument->load_buffer(xml, length);
+    }
+    else {
+        result = xmlDocument->load_file(m_path.c_str());
+    }
+    if (!result) {
+        LogError("Glyph '%s' could not be loaded", m_codeStr.c_str());
+        return NULL;
+    }
+
+    m_xmlDocument = xmlDocument;
+    return m_xmlDocument;
+}
+
+//----------------------------------------------------------------------------
+// Binary serialization helpers
+//----------------------------------------------------------------------------
+
+static void WriteInt(std::string &buffer, int value)
+{
+    int32_t v = (int32_t)value;
+    buffer.append((const char *)&v, sizeof(v));
+}
+
+static void WriteString(std::string &buffer, const std::string &value)
+{
+    WriteInt(buffer, (int)value.size());
+    buffer.append(value);
+}
+
+static bool ReadInt(const std::string &buffer, size_t &pos, int &value)
 {
-    return &m_anchors[anchor];
+    int32_t v;
+    if (pos + sizeof(v) > buffer.size()) return false;
+    memcpy(&v, buffer.data() + pos, sizeof(v));
+    pos += sizeof(v);
+    value = (int)v;
+    return true;
+}
+
+static bool ReadString(const std::string &buffer, size_t &pos, size_t &offset, size_t &length)
+{
+    int size;
+    if (!ReadInt(buffer, pos, size) || (size < 0) || (pos + size > buffer.size())) return false;
+    offset = pos;
+    length = (size_t)size;
+    pos += size;
+    return true;
+}
+
+void Glyph::WriteBinary(std::string &buffer, const std::string &filename, const std::string &xml) const
+{
+    WriteInt(buffer, m_x);
+    WriteInt(buffer, m_y);
+    WriteInt(buffer, m_width);
+    WriteInt(buffer, m_height);
+    WriteInt(buffer, m_horizAdvX);
+    WriteInt(buffer, m_unitsPerEm);
+    WriteString(buffer, m_codeStr);
+    WriteString(buffer, filename);
+    WriteInt(buffer, (int)m_anchors.size());
+    for (auto const &anchor : m_anchors) {
+        WriteInt(buffer, anchor.first);
+        WriteInt(buffer, anchor.second.x);
+        WriteInt(buffer, anchor.second.y);
+    }
+    WriteString(buffer, xml);
+}
+
+bool Glyph::ReadBinary(const std::shared_ptr<const std::string> &bundle, size_t &pos, const std::string &dirname)
+{
+    assert(bundle);
+
+    const std::string &buffer = *bundle;
+    size_t offset, length;
+    int anchorCount;
+
+    if (!ReadInt(buffer, pos, m_x) || !ReadInt(buffer, pos, m_y) || !ReadInt(buffer, pos, m_width)
+        || !ReadInt(buffer, pos, m_height) || !ReadInt(buffer, pos, m_horizAdvX)
+        || !ReadInt(buffer, pos, m_unitsPerEm)) {
+        return false;
+    }
+    if (!ReadString(buffer, pos, offset, length)) return false;
+    m_codeStr = buffer.substr(offset, length);
+    if (!ReadString(buffer, pos, offset, length)) return false;
+    m_path = dirname + "/" + buffer.substr(offset, length);
+
+    if (!ReadInt(buffer, pos, anchorCount)) return false;
+    for (int i = 0; i < anchorCount; ++i) {
+        int anchorId, x, y;
+        if (!ReadInt(buffer, pos, anchorId) || !ReadInt(buffer, pos, x) || !ReadInt(buffer, pos, y)) return false;
+        m_anchors[(SMuFLGlyphAnchor)anchorId] = Point(x, y);
+    }
+
+    if (!ReadString(buffer, pos, m_xmlOffset, m_xmlLength)) return false;
+    m_bundle = bundle;
+
+    return true;
 }
 
 } // namespace vrv
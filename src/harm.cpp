@@ -81,7 +81,7 @@ void Harm::AddChild(Object *child)
 
 bool Harm::GetRootPitch(TransPitch &pitch, unsigned int &pos)
 {
-    Text *textObject = dynamic_cast<Text *>(this->FindDescendantByType(TEXT, 1));
+    Text *textObject = vrv_cast<Text *>(this->FindDescendantByType(TEXT, 1));
     if (!textObject) return false;
     std::wstring text = textObject->GetText();
 
@@ -109,7 +109,7 @@ bool Harm::GetRootPitch(TransPitch &pitch, unsigned int &pos)
 
 void Harm::SetRootPitch(const TransPitch &pitch, unsigned int endPos)
 {
-    Text *textObject = dynamic_cast<Text *>(this->FindDescendantByType(TEXT, 1));
+    Text *textObject = vrv_cast<Text *>(this->FindDescendantByType(TEXT, 1));
     if (!textObject) return;
     std::wstring text = textObject->GetText();
 
@@ -123,7 +123,7 @@ void Harm::SetRootPitch(const TransPitch &pitch, unsigned int endPos)
 
 bool Harm::GetBassPitch(TransPitch &pitch)
 {
-    Text *textObject = dynamic_cast<Text *>(this->FindDescendantByType(TEXT, 1));
+    Text *textObject = vrv_cast<Text *>(this->FindDescendantByType(TEXT, 1));
     if (!textObject) return false;
     std::wstring text = textObject->GetText();
     if (!text.length()) return false;
@@ -139,7 +139,7 @@ bool Harm::GetBassPitch(TransPitch &pitch)
 
 void Harm::SetBassPitch(const TransPitch &pitch)
 {
-    Text *textObject = dynamic_cast<Text *>(this->FindDescendantByType(TEXT, 1));
+    Text *textObject = vrv_cast<Text *>(this->FindDescendantByType(TEXT, 1));
     if (!textObject) return;
     std::wstring text = textObject->GetText();
     unsigned int pos;
@@ -159,7 +159,7 @@ void Harm::SetBassPitch(const TransPitch &pitch)
 
 int Harm::PrepareFloatingGrps(FunctorParams *functorParams)
 {
-    PrepareFloatingGrpsParams *params = dynamic_cast<PrepareFloatingGrpsParams *>(functorParams);
+    PrepareFloatingGrpsParams *params = vrv_cast<PrepareFloatingGrpsParams *>(functorParams);
     assert(params);
 
     std::string n = this->GetN();
@@ -180,7 +180,7 @@ int Harm::PrepareFloatingGrps(FunctorParams *functorParams)
 
 int Harm::AdjustHarmGrpsSpacing(FunctorParams *functorParams)
 {
-    AdjustHarmGrpsSpacingParams *params = dynamic_cast<AdjustHarmGrpsSpacingParams *>(functorParams);
+    AdjustHarmGrpsSpacingParams *params = vrv_cast<AdjustHarmGrpsSpacingParams *>(functorParams);
     assert(params);
 
     // If the harm is empty, do not adjust spacing
@@ -286,7 +286,7 @@ int Harm::AdjustHarmGrpsSpacing(FunctorParams *functorParams)
 
 int Harm::Transpose(FunctorParams *functorParams)
 {
-    TransposeParams *params = dynamic_cast<TransposeParams *>(functorParams);
+    TransposeParams *params = vrv_cast<TransposeParams *>(functorParams);
     assert(params);
 
     LogDebug("Transposing harm");
@@ -48,6 +48,7 @@
 #include "breath.h"
 #include "btrem.h"
 #include "chord.h"
+#include "comparison.h"
 #include "dir.h"
 #include "dot.h"
 #include "dynam.h"
@@ -632,6 +633,7 @@ bool HumdrumInput::convertHumdrum()
             hum::HTp token = infile.token(line + 1, 0);
             if (token->compare(0, 12, "!!linebreak:") == 0) {
                 Sb *sb = new Sb;
+                m_hasLayoutInformation = true;
                 m_sections.back()->AddChild(sb);
                 if (token->find("original")) {
                     // maybe allow other types of system breaks here
@@ -640,6 +642,7 @@ bool HumdrumInput::convertHumdrum()
             }
             else if (token->compare(0, 12, "!!pagebreak:") == 0) {
                 Sb *sb = new Sb;
+                m_hasLayoutInformation = true;
                 m_sections.back()->AddChild(sb);
                 if (token->find("original")) {
                     // maybe allow other types of page breaks here
@@ -653,7 +656,15 @@ bool HumdrumInput::convertHumdrum()
 
     // calculateLayout();
 
+    // Read embedded options from input Humdrum file:
+    parseEmbeddedOptions(*m_doc);
+
+    // Same post-processing as MEIInput::ReadDoc for score-based MEI
+    m_doc->ConvertScoreDefMarkupDoc();
+    m_doc->ExpandExpansions();
     m_doc->ConvertToPageBasedDoc();
+    m_doc->ConvertAnalyticalMarkupDoc();
+    resetAttributeUuids();
     promoteInstrumentAbbreviationsToGroup();
     promoteInstrumentNamesToGroup();
 
@@ -1679,6 +1690,26 @@ void HumdrumInput::promoteInstrumentsForStaffGroup(StaffGrp *group)
     }
 }
 
+//////////////////////////////
+//
+// HumdrumInput::resetAttributeUuids -- Give a new id to the elements
+//     encoded as attributes (such as note@accid), as they got one when
+//     the data was converted to MEI and read back.
+//
+
+void HumdrumInput::resetAttributeUuids()
+{
+    const std::vector<ClassId> classIds = { ACCID, ARTIC, CLEF, KEYSIG, MENSUR, METERSIG };
+    for (int i = 0; i < (int)classIds.size(); i++) {
+        IsAttributeComparison matchAttribute(classIds[i]);
+        ArrayOfObjects attributes;
+        m_doc->FindAllDescendantByComparison(&attributes, &matchAttribute);
+        for (int j = 0; j < (int)attributes.size(); j++) {
+            attributes[j]->ResetUuid();
+        }
+    }
+}
+
 //////////////////////////////
 //
 // HumdrumInput::promoteInstrumentAbbreviationsToGroup --
@@ -3817,6 +3848,7 @@ void HumdrumInput::checkForLayoutBreak(int line)
     if (!group.empty()) {
         std::string tstring = removeCommas(group);
         Sb *sb = new Sb;
+        m_hasLayoutInformation = true;
         m_sections.back()->AddChild(sb);
         sb->SetType(tstring);
         return;
@@ -3826,6 +3858,7 @@ void HumdrumInput::checkForLayoutBreak(int line)
     if (!group.empty()) {
         std::string tstring = removeCommas(group);
         Sb *sb = new Sb;
+        m_hasLayoutInformation = true;
         m_sections.back()->AddChild(sb);
         sb->SetType(tstring);
         return;
@@ -11809,6 +11842,8 @@ void HumdrumInput::convertMRest(MRest *rest, hum::HTp token, int subtoken, int s
                 // has a fermata (so you would not want to overwrite them).
                 rest->SetFermata(STAFFREL_basic_above);
             }
+            // @fermata is converted to <fermata> as when reading MEI
+            m_doc->SetAnalyticalMarkup(true);
         }
     }
 
@@ -11918,6 +11953,8 @@ void HumdrumInput::convertRest(Rest *rest, hum::HTp token, int subtoken)
                 // has a fermata (so you would not want to overwrite them).
                 rest->SetFermata(STAFFREL_basic_above);
             }
+            // @fermata is converted to <fermata> as when reading MEI
+            m_doc->SetAnalyticalMarkup(true);
         }
     }
 
@@ -14830,6 +14867,7 @@ void HumdrumInput::setupMeiDocument()
         // breaks encoded in the file to be activated, so adding a
         // dummy page break here:
         Pb *pb = new Pb;
+        m_hasLayoutInformation = true;
         section->AddChild(pb);
     }
 }
@@ -14975,7 +15013,22 @@ static const EntityNameEntry StaticEntityNames[] = {
 
 typedef std::map<std::string, unsigned int> EntityNameMap;
 typedef std::pair<std::string, unsigned int> EntityNamePair;
-static EntityNameMap EntityNames;
+
+static EntityNameMap LoadEntityNames()
+{
+    EntityNameMap entityNames;
+    const EntityNameEntry *ThisEntry;
+    ThisEntry = StaticEntityNames;
+    for (;;) {
+        if (ThisEntry->Name == NULL) break;
+        entityNames.insert(EntityNamePair(std::string(ThisEntry->Name), ThisEntry->Value));
+        ++ThisEntry;
+    }
+    return entityNames;
+}
+
+/* Loaded once from StaticEntityNames at static initialization time (read-only afterwards) */
+static const EntityNameMap EntityNames = LoadEntityNames();
 
 //////////////////////////////
 //
@@ -15061,16 +15114,6 @@ void HumdrumInput::UnquoteHTML(std::istream &In, std::ostream &Out)
                     ProcessedChar = true;
                 }
                 else if (ThisCh == ';') {
-                    if (EntityNames.empty()) {
-                        /* first use, load EntityNames from StaticEntityNames */
-                        const EntityNameEntry *ThisEntry;
-                        ThisEntry = StaticEntityNames;
-                        for (;;) {
-                            if (ThisEntry->Name == NULL) break;
-                            EntityNames.insert(EntityNamePair(std::string(ThisEntry->Name), ThisEntry->Value));
-                            ++ThisEntry;
-                        }
-                    }
                     const EntityNameMap::const_iterator NameEntry = EntityNames.find(MatchingName);
                     if (NameEntry != EntityNames.end()) {
                         CharCode = NameEntry->second;
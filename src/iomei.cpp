@@ -189,7 +189,7 @@ bool MEIOutput::Export()
             }
             Pages *pages = m_doc->GetPages();
             assert(pages);
-            Page *page = dynamic_cast<Page *>(pages->GetChild(m_page));
+            Page *page = vrv_cast<Page *>(pages->GetChild(m_page));
             assert(page);
             if (m_scoreBasedMEI) {
                 m_currentNode = meiDoc.append_child("score");
@@ -2006,7 +2006,7 @@ void MEIOutput::WriteTimeSpanningInterface(pugi::xml_node element, TimeSpanningI
 
 void MEIOutput::WriteUnsupportedAttr(pugi::xml_node element, Object *object)
 {
-    for (auto &pair : object->m_unsupported) {
+    for (auto &pair : object->GetUnsupportedAttrs()) {
         if (element.attribute(pair.first.c_str())) {
             LogDebug("Attribute '%s' for '%s' is supported", pair.first.c_str(), object->GetClassName().c_str());
         }
@@ -2240,6 +2240,7 @@ MEIInput::MEIInput(Doc *doc) : Input(doc)
     m_useScoreDefForDoc = false;
     m_readingScoreBased = false;
     m_version = MEI_UNDEFINED;
+    m_readUnsupportedAttr = true;
 }
 
 MEIInput::~MEIInput() {}
@@ -2765,7 +2766,7 @@ bool MEIInput::ReadDoc(pugi::xml_node root)
     }
 
     if (success && m_doc->GetType() == Facs) {
-        Functor setChildZones(&Object::SetChildZones);
+        Functor setChildZones(&Object::SetChildZones, "SetChildZones");
         SetChildZonesParams setChildZonesParams(m_doc);
         m_doc->Process(&setChildZones, &setChildZonesParams);
     }
@@ -2778,8 +2779,8 @@ bool MEIInput::ReadMdiv(Object *parent, pugi::xml_node mdiv, bool isVisible)
     Mdiv *vrvMdiv = new Mdiv();
     SetMeiUuid(mdiv, vrvMdiv);
 
-    vrvMdiv->ReadLabelled(mdiv);
-    vrvMdiv->ReadNNumberLike(mdiv);
+    vrvMdiv->ReadLabelled(mdiv, m_readUnsupportedAttr);
+    vrvMdiv->ReadNNumberLike(mdiv, m_readUnsupportedAttr);
 
     parent->AddChild(vrvMdiv);
 
@@ -2832,8 +2833,8 @@ bool MEIInput::ReadPages(Object *parent, pugi::xml_node pages)
     Pages *vrvPages = new Pages();
     SetMeiUuid(pages, vrvPages);
 
-    vrvPages->ReadLabelled(pages);
-    vrvPages->ReadNNumberLike(pages);
+    vrvPages->ReadLabelled(pages, m_readUnsupportedAttr);
+    vrvPages->ReadNNumberLike(pages, m_readUnsupportedAttr);
 
     parent->AddChild(vrvPages);
 
@@ -2887,8 +2888,8 @@ bool MEIInput::ReadScore(Object *parent, pugi::xml_node score)
     Score *vrvScore = new Score();
     SetMeiUuid(score, vrvScore);
 
-    vrvScore->ReadLabelled(score);
-    vrvScore->ReadNNumberLike(score);
+    vrvScore->ReadLabelled(score, m_readUnsupportedAttr);
+    vrvScore->ReadNNumberLike(score, m_readUnsupportedAttr);
 
     parent->AddChild(vrvScore);
 
@@ -2936,7 +2937,7 @@ bool MEIInput::ReadSection(Object *parent, pugi::xml_node section)
     Section *vrvSection = new Section();
     SetMeiUuid(section, vrvSection);
 
-    vrvSection->ReadNNumberLike(section);
+    vrvSection->ReadNNumberLike(section, m_readUnsupportedAttr);
 
     parent->AddChild(vrvSection);
     ReadUnsupportedAttr(section, vrvSection);
@@ -3015,7 +3016,7 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
 bool MEIInput::ReadSystemElement(pugi::xml_node element, SystemElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadTyped(element);
+    object->ReadTyped(element, m_readUnsupportedAttr);
 
     return true;
 }
@@ -3025,8 +3026,8 @@ bool MEIInput::ReadEnding(Object *parent, pugi::xml_node ending)
     Ending *vrvEnding = new Ending();
     ReadSystemElement(ending, vrvEnding);
 
-    vrvEnding->ReadLineRend(ending);
-    vrvEnding->ReadNNumberLike(ending);
+    vrvEnding->ReadLineRend(ending, m_readUnsupportedAttr);
+    vrvEnding->ReadNNumberLike(ending, m_readUnsupportedAttr);
 
     parent->AddChild(vrvEnding);
     ReadUnsupportedAttr(ending, vrvEnding);
@@ -3057,7 +3058,7 @@ bool MEIInput::ReadPb(Object *parent, pugi::xml_node pb)
     Pb *vrvPb = new Pb();
     ReadSystemElement(pb, vrvPb);
 
-    vrvPb->ReadNNumberLike(pb);
+    vrvPb->ReadNNumberLike(pb, m_readUnsupportedAttr);
 
     parent->AddChild(vrvPb);
     ReadUnsupportedAttr(pb, vrvPb);
@@ -3069,7 +3070,7 @@ bool MEIInput::ReadSb(Object *parent, pugi::xml_node sb)
     Sb *vrvSb = new Sb();
     ReadSystemElement(sb, vrvSb);
 
-    vrvSb->ReadNNumberLike(sb);
+    vrvSb->ReadNNumberLike(sb, m_readUnsupportedAttr);
 
     parent->AddChild(vrvSb);
     ReadUnsupportedAttr(sb, vrvSb);
@@ -3122,7 +3123,7 @@ bool MEIInput::ReadPage(Object *parent, pugi::xml_node page)
 
     if (success && (m_doc->GetType() == Transcription) && (vrvPage->GetPPUFactor() != 1.0)) {
         ApplyPPUFactorParams applyPPUFactorParams;
-        Functor applyPPUFactor(&Object::ApplyPPUFactor);
+        Functor applyPPUFactor(&Object::ApplyPPUFactor, "ApplyPPUFactor");
         vrvPage->Process(&applyPPUFactor, &applyPPUFactorParams);
     }
 
@@ -3168,7 +3169,7 @@ bool MEIInput::ReadSystem(Object *parent, pugi::xml_node system)
 
     System *vrvSystem = new System();
     SetMeiUuid(system, vrvSystem);
-    vrvSystem->ReadTyped(system);
+    vrvSystem->ReadTyped(system, m_readUnsupportedAttr);
 
     if (system.attribute("system.leftmar")) {
         vrvSystem->m_systemLeftMar = atoi(system.attribute("system.leftmar").value());
@@ -3215,7 +3216,7 @@ bool MEIInput::ReadSystemChildren(Object *parent, pugi::xml_node parentNode)
         else if (std::string(current.name()) == "staff") {
             if (!unmeasured) {
                 if (parent->Is(SYSTEM)) {
-                    System *system = dynamic_cast<System *>(parent);
+                    System *system = vrv_cast<System *>(parent);
                     assert(system);
                     unmeasured = new Measure(false);
                     m_doc->SetMensuralMusicOnly(true);
@@ -3268,9 +3269,9 @@ bool MEIInput::ReadBoundaryEnd(Object *parent, pugi::xml_node boundaryEnd)
 bool MEIInput::ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadMeasureNumbers(element);
-    object->ReadSystems(element);
-    object->ReadTyped(element);
+    object->ReadMeasureNumbers(element, m_readUnsupportedAttr);
+    object->ReadSystems(element, m_readUnsupportedAttr);
+    object->ReadTyped(element, m_readUnsupportedAttr);
 
     AttCleffingLog cleffingLog;
     cleffingLog.ReadCleffingLog(element);
@@ -3373,8 +3374,8 @@ bool MEIInput::ReadScoreDef(Object *parent, pugi::xml_node scoreDef)
     }
 
     ReadScoreDefInterface(scoreDef, vrvScoreDef);
-    vrvScoreDef->ReadEndings(scoreDef);
-    vrvScoreDef->ReadOptimization(scoreDef);
+    vrvScoreDef->ReadEndings(scoreDef, m_readUnsupportedAttr);
+    vrvScoreDef->ReadOptimization(scoreDef, m_readUnsupportedAttr);
 
     if (!m_hasScoreDef && m_useScoreDefForDoc) {
         m_hasScoreDef = true;
@@ -3446,11 +3447,11 @@ bool MEIInput::ReadStaffGrp(Object *parent, pugi::xml_node staffGrp)
         UpgradeStaffGrpTo_4_0_0(staffGrp, vrvStaffGrp);
     }
 
-    vrvStaffGrp->ReadBasic(staffGrp);
-    vrvStaffGrp->ReadLabelled(staffGrp);
-    vrvStaffGrp->ReadStaffGroupingSym(staffGrp);
-    vrvStaffGrp->ReadStaffGrpVis(staffGrp);
-    vrvStaffGrp->ReadTyped(staffGrp);
+    vrvStaffGrp->ReadBasic(staffGrp, m_readUnsupportedAttr);
+    vrvStaffGrp->ReadLabelled(staffGrp, m_readUnsupportedAttr);
+    vrvStaffGrp->ReadStaffGroupingSym(staffGrp, m_readUnsupportedAttr);
+    vrvStaffGrp->ReadStaffGrpVis(staffGrp, m_readUnsupportedAttr);
+    vrvStaffGrp->ReadTyped(staffGrp, m_readUnsupportedAttr);
 
     parent->AddChild(vrvStaffGrp);
     ReadUnsupportedAttr(staffGrp, vrvStaffGrp);
@@ -3495,8 +3496,8 @@ bool MEIInput::ReadStaffGrpChildren(Object *parent, pugi::xml_node parentNode)
 bool MEIInput::ReadRunningElement(pugi::xml_node element, RunningElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadHorizontalAlign(element);
-    object->ReadTyped(element);
+    object->ReadHorizontalAlign(element, m_readUnsupportedAttr);
+    object->ReadTyped(element, m_readUnsupportedAttr);
 
     return true;
 }
@@ -3591,15 +3592,15 @@ bool MEIInput::ReadStaffDef(Object *parent, pugi::xml_node staffDef)
         UpgradeStaffDefTo_4_0_0(staffDef, vrvStaffDef);
     }
 
-    vrvStaffDef->ReadDistances(staffDef);
-    vrvStaffDef->ReadLabelled(staffDef);
-    vrvStaffDef->ReadNInteger(staffDef);
-    vrvStaffDef->ReadNotationType(staffDef);
-    vrvStaffDef->ReadScalable(staffDef);
-    vrvStaffDef->ReadStaffDefLog(staffDef);
-    vrvStaffDef->ReadStaffDefVis(staffDef);
-    vrvStaffDef->ReadTimeBase(staffDef);
-    vrvStaffDef->ReadTransposition(staffDef);
+    vrvStaffDef->ReadDistances(staffDef, m_readUnsupportedAttr);
+    vrvStaffDef->ReadLabelled(staffDef, m_readUnsupportedAttr);
+    vrvStaffDef->ReadNInteger(staffDef, m_readUnsupportedAttr);
+    vrvStaffDef->ReadNotationType(staffDef, m_readUnsupportedAttr);
+    vrvStaffDef->ReadScalable(staffDef, m_readUnsupportedAttr);
+    vrvStaffDef->ReadStaffDefLog(staffDef, m_readUnsupportedAttr);
+    vrvStaffDef->ReadStaffDefVis(staffDef, m_readUnsupportedAttr);
+    vrvStaffDef->ReadTimeBase(staffDef, m_readUnsupportedAttr);
+    vrvStaffDef->ReadTransposition(staffDef, m_readUnsupportedAttr);
 
     if (!vrvStaffDef->HasN()) {
         LogWarning("No @n on <staffDef> might yield unpredictable results");
@@ -3658,10 +3659,10 @@ bool MEIInput::ReadInstrDef(Object *parent, pugi::xml_node instrDef)
     SetMeiUuid(instrDef, vrvInstrDef);
 
     parent->AddChild(vrvInstrDef);
-    vrvInstrDef->ReadChannelized(instrDef);
-    vrvInstrDef->ReadLabelled(instrDef);
-    vrvInstrDef->ReadMidiInstrument(instrDef);
-    vrvInstrDef->ReadNNumberLike(instrDef);
+    vrvInstrDef->ReadChannelized(instrDef, m_readUnsupportedAttr);
+    vrvInstrDef->ReadLabelled(instrDef, m_readUnsupportedAttr);
+    vrvInstrDef->ReadMidiInstrument(instrDef, m_readUnsupportedAttr);
+    vrvInstrDef->ReadNNumberLike(instrDef, m_readUnsupportedAttr);
 
     return true;
 }
@@ -3695,12 +3696,12 @@ bool MEIInput::ReadMeasure(Object *parent, pugi::xml_node measure)
     }
     SetMeiUuid(measure, vrvMeasure);
 
-    vrvMeasure->ReadBarring(measure);
-    vrvMeasure->ReadMeasureLog(measure);
-    vrvMeasure->ReadMeterConformanceBar(measure);
-    vrvMeasure->ReadNNumberLike(measure);
-    vrvMeasure->ReadPointing(measure);
-    vrvMeasure->ReadTyped(measure);
+    vrvMeasure->ReadBarring(measure, m_readUnsupportedAttr);
+    vrvMeasure->ReadMeasureLog(measure, m_readUnsupportedAttr);
+    vrvMeasure->ReadMeterConformanceBar(measure, m_readUnsupportedAttr);
+    vrvMeasure->ReadNNumberLike(measure, m_readUnsupportedAttr);
+    vrvMeasure->ReadPointing(measure, m_readUnsupportedAttr);
+    vrvMeasure->ReadTyped(measure, m_readUnsupportedAttr);
 
     if (measure.attribute("ulx") && measure.attribute("lrx") && (this->m_doc->GetType() == Transcription)) {
         vrvMeasure->m_xAbs = atoi(measure.attribute("ulx").value()) * DEFINITION_FACTOR;
@@ -3803,8 +3804,8 @@ bool MEIInput::ReadControlElement(pugi::xml_node element, ControlElement *object
 {
     SetMeiUuid(element, object);
     ReadLinkingInterface(element, object);
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    object->ReadLabelled(element, m_readUnsupportedAttr);
+    object->ReadTyped(element, m_readUnsupportedAttr);
 
     return true;
 }
@@ -3828,9 +3829,9 @@ bool MEIInput::ReadArpeg(Object *parent, pugi::xml_node arpeg)
 
     ReadPlistInterface(arpeg, vrvArpeg);
     ReadTimePointInterface(arpeg, vrvArpeg);
-    vrvArpeg->ReadArpegLog(arpeg);
-    vrvArpeg->ReadArpegVis(arpeg);
-    vrvArpeg->ReadColor(arpeg);
+    vrvArpeg->ReadArpegLog(arpeg, m_readUnsupportedAttr);
+    vrvArpeg->ReadArpegVis(arpeg, m_readUnsupportedAttr);
+    vrvArpeg->ReadColor(arpeg, m_readUnsupportedAttr);
 
     parent->AddChild(vrvArpeg);
     ReadUnsupportedAttr(arpeg, vrvArpeg);
@@ -3843,10 +3844,10 @@ bool MEIInput::ReadBracketSpan(Object *parent, pugi::xml_node bracketSpan)
     ReadControlElement(bracketSpan, vrvBracketSpan);
 
     ReadTimeSpanningInterface(bracketSpan, vrvBracketSpan);
-    vrvBracketSpan->ReadBracketSpanLog(bracketSpan);
-    vrvBracketSpan->ReadColor(bracketSpan);
-    vrvBracketSpan->ReadLineRend(bracketSpan);
-    vrvBracketSpan->ReadLineRendBase(bracketSpan);
+    vrvBracketSpan->ReadBracketSpanLog(bracketSpan, m_readUnsupportedAttr);
+    vrvBracketSpan->ReadColor(bracketSpan, m_readUnsupportedAttr);
+    vrvBracketSpan->ReadLineRend(bracketSpan, m_readUnsupportedAttr);
+    vrvBracketSpan->ReadLineRendBase(bracketSpan, m_readUnsupportedAttr);
 
     parent->AddChild(vrvBracketSpan);
     ReadUnsupportedAttr(bracketSpan, vrvBracketSpan);
@@ -3859,8 +3860,8 @@ bool MEIInput::ReadBreath(Object *parent, pugi::xml_node breath)
     ReadControlElement(breath, vrvBreath);
 
     ReadTimePointInterface(breath, vrvBreath);
-    vrvBreath->ReadColor(breath);
-    vrvBreath->ReadPlacement(breath);
+    vrvBreath->ReadColor(breath, m_readUnsupportedAttr);
+    vrvBreath->ReadPlacement(breath, m_readUnsupportedAttr);
 
     parent->AddChild(vrvBreath);
     ReadUnsupportedAttr(breath, vrvBreath);
@@ -3874,10 +3875,10 @@ bool MEIInput::ReadDir(Object *parent, pugi::xml_node dir)
 
     ReadTextDirInterface(dir, vrvDir);
     ReadTimeSpanningInterface(dir, vrvDir);
-    vrvDir->ReadLang(dir);
-    vrvDir->ReadLineRendBase(dir);
-    vrvDir->ReadExtender(dir);
-    vrvDir->ReadVerticalGroup(dir);
+    vrvDir->ReadLang(dir, m_readUnsupportedAttr);
+    vrvDir->ReadLineRendBase(dir, m_readUnsupportedAttr);
+    vrvDir->ReadExtender(dir, m_readUnsupportedAttr);
+    vrvDir->ReadVerticalGroup(dir, m_readUnsupportedAttr);
 
     parent->AddChild(vrvDir);
     ReadUnsupportedAttr(dir, vrvDir);
@@ -3891,9 +3892,9 @@ bool MEIInput::ReadDynam(Object *parent, pugi::xml_node dynam)
 
     ReadTextDirInterface(dynam, vrvDynam);
     ReadTimeSpanningInterface(dynam, vrvDynam);
-    vrvDynam->ReadExtender(dynam);
-    vrvDynam->ReadLineRendBase(dynam);
-    vrvDynam->ReadVerticalGroup(dynam);
+    vrvDynam->ReadExtender(dynam, m_readUnsupportedAttr);
+    vrvDynam->ReadLineRendBase(dynam, m_readUnsupportedAttr);
+    vrvDynam->ReadVerticalGroup(dynam, m_readUnsupportedAttr);
 
     parent->AddChild(vrvDynam);
     ReadUnsupportedAttr(dynam, vrvDynam);
@@ -3906,9 +3907,9 @@ bool MEIInput::ReadFermata(Object *parent, pugi::xml_node fermata)
     ReadControlElement(fermata, vrvFermata);
 
     ReadTimePointInterface(fermata, vrvFermata);
-    vrvFermata->ReadColor(fermata);
-    vrvFermata->ReadFermataVis(fermata);
-    vrvFermata->ReadPlacement(fermata);
+    vrvFermata->ReadColor(fermata, m_readUnsupportedAttr);
+    vrvFermata->ReadFermataVis(fermata, m_readUnsupportedAttr);
+    vrvFermata->ReadPlacement(fermata, m_readUnsupportedAttr);
 
     parent->AddChild(vrvFermata);
     ReadUnsupportedAttr(fermata, vrvFermata);
@@ -3921,10 +3922,10 @@ bool MEIInput::ReadHairpin(Object *parent, pugi::xml_node hairpin)
     ReadControlElement(hairpin, vrvHairpin);
 
     ReadTimeSpanningInterface(hairpin, vrvHairpin);
-    vrvHairpin->ReadColor(hairpin);
-    vrvHairpin->ReadHairpinLog(hairpin);
-    vrvHairpin->ReadPlacement(hairpin);
-    vrvHairpin->ReadVerticalGroup(hairpin);
+    vrvHairpin->ReadColor(hairpin, m_readUnsupportedAttr);
+    vrvHairpin->ReadHairpinLog(hairpin, m_readUnsupportedAttr);
+    vrvHairpin->ReadPlacement(hairpin, m_readUnsupportedAttr);
+    vrvHairpin->ReadVerticalGroup(hairpin, m_readUnsupportedAttr);
 
     parent->AddChild(vrvHairpin);
     ReadUnsupportedAttr(hairpin, vrvHairpin);
@@ -3938,8 +3939,8 @@ bool MEIInput::ReadHarm(Object *parent, pugi::xml_node harm)
 
     ReadTextDirInterface(harm, vrvHarm);
     ReadTimeSpanningInterface(harm, vrvHarm);
-    vrvHarm->ReadLang(harm);
-    vrvHarm->ReadNNumberLike(harm);
+    vrvHarm->ReadLang(harm, m_readUnsupportedAttr);
+    vrvHarm->ReadNNumberLike(harm, m_readUnsupportedAttr);
 
     parent->AddChild(vrvHarm);
     ReadUnsupportedAttr(harm, vrvHarm);
@@ -3953,9 +3954,9 @@ bool MEIInput::ReadMNum(Object *parent, pugi::xml_node mNum)
 
     ReadTextDirInterface(mNum, vrvMNum);
     ReadTimePointInterface(mNum, vrvMNum);
-    vrvMNum->ReadColor(mNum);
-    vrvMNum->ReadLang(mNum);
-    vrvMNum->ReadTypography(mNum);
+    vrvMNum->ReadColor(mNum, m_readUnsupportedAttr);
+    vrvMNum->ReadLang(mNum, m_readUnsupportedAttr);
+    vrvMNum->ReadTypography(mNum, m_readUnsupportedAttr);
 
     parent->AddChild(vrvMNum);
     return ReadTextChildren(vrvMNum, mNum, vrvMNum);
@@ -3971,10 +3972,10 @@ bool MEIInput::ReadMordent(Object *parent, pugi::xml_node mordent)
     }
 
     ReadTimePointInterface(mordent, vrvMordent);
-    vrvMordent->ReadColor(mordent);
-    vrvMordent->ReadOrnamentAccid(mordent);
-    vrvMordent->ReadPlacement(mordent);
-    vrvMordent->ReadMordentLog(mordent);
+    vrvMordent->ReadColor(mordent, m_readUnsupportedAttr);
+    vrvMordent->ReadOrnamentAccid(mordent, m_readUnsupportedAttr);
+    vrvMordent->ReadPlacement(mordent, m_readUnsupportedAttr);
+    vrvMordent->ReadMordentLog(mordent, m_readUnsupportedAttr);
 
     parent->AddChild(vrvMordent);
     ReadUnsupportedAttr(mordent, vrvMordent);
@@ -3987,11 +3988,11 @@ bool MEIInput::ReadOctave(Object *parent, pugi::xml_node octave)
     ReadControlElement(octave, vrvOctave);
 
     ReadTimeSpanningInterface(octave, vrvOctave);
-    vrvOctave->ReadColor(octave);
-    vrvOctave->ReadExtender(octave);
-    vrvOctave->ReadLineRend(octave);
-    vrvOctave->ReadLineRendBase(octave);
-    vrvOctave->ReadOctaveDisplacement(octave);
+    vrvOctave->ReadColor(octave, m_readUnsupportedAttr);
+    vrvOctave->ReadExtender(octave, m_readUnsupportedAttr);
+    vrvOctave->ReadLineRend(octave, m_readUnsupportedAttr);
+    vrvOctave->ReadLineRendBase(octave, m_readUnsupportedAttr);
+    vrvOctave->ReadOctaveDisplacement(octave, m_readUnsupportedAttr);
 
     parent->AddChild(vrvOctave);
     ReadUnsupportedAttr(octave, vrvOctave);
@@ -4004,10 +4005,10 @@ bool MEIInput::ReadPedal(Object *parent, pugi::xml_node pedal)
     ReadControlElement(pedal, vrvPedal);
 
     ReadTimePointInterface(pedal, vrvPedal);
-    vrvPedal->ReadColor(pedal);
-    vrvPedal->ReadPedalLog(pedal);
-    vrvPedal->ReadPlacement(pedal);
-    vrvPedal->ReadVerticalGroup(pedal);
+    vrvPedal->ReadColor(pedal, m_readUnsupportedAttr);
+    vrvPedal->ReadPedalLog(pedal, m_readUnsupportedAttr);
+    vrvPedal->ReadPlacement(pedal, m_readUnsupportedAttr);
+    vrvPedal->ReadVerticalGroup(pedal, m_readUnsupportedAttr);
 
     parent->AddChild(vrvPedal);
     ReadUnsupportedAttr(pedal, vrvPedal);
@@ -4021,9 +4022,9 @@ bool MEIInput::ReadReh(Object *parent, pugi::xml_node reh)
 
     ReadTextDirInterface(reh, vrvReh);
     ReadTimePointInterface(reh, vrvReh);
-    vrvReh->ReadColor(reh);
-    vrvReh->ReadLang(reh);
-    vrvReh->ReadVerticalGroup(reh);
+    vrvReh->ReadColor(reh, m_readUnsupportedAttr);
+    vrvReh->ReadLang(reh, m_readUnsupportedAttr);
+    vrvReh->ReadVerticalGroup(reh, m_readUnsupportedAttr);
 
     parent->AddChild(vrvReh);
     ReadUnsupportedAttr(reh, vrvReh);
@@ -4036,9 +4037,9 @@ bool MEIInput::ReadSlur(Object *parent, pugi::xml_node slur)
     ReadControlElement(slur, vrvSlur);
 
     ReadTimeSpanningInterface(slur, vrvSlur);
-    vrvSlur->ReadColor(slur);
-    vrvSlur->ReadCurvature(slur);
-    vrvSlur->ReadCurveRend(slur);
+    vrvSlur->ReadColor(slur, m_readUnsupportedAttr);
+    vrvSlur->ReadCurvature(slur, m_readUnsupportedAttr);
+    vrvSlur->ReadCurveRend(slur, m_readUnsupportedAttr);
 
     parent->AddChild(vrvSlur);
     ReadUnsupportedAttr(slur, vrvSlur);
@@ -4052,9 +4053,9 @@ bool MEIInput::ReadTempo(Object *parent, pugi::xml_node tempo)
 
     ReadTextDirInterface(tempo, vrvTempo);
     ReadTimePointInterface(tempo, vrvTempo);
-    vrvTempo->ReadLang(tempo);
-    vrvTempo->ReadMidiTempo(tempo);
-    vrvTempo->ReadMmTempo(tempo);
+    vrvTempo->ReadLang(tempo, m_readUnsupportedAttr);
+    vrvTempo->ReadMidiTempo(tempo, m_readUnsupportedAttr);
+    vrvTempo->ReadMmTempo(tempo, m_readUnsupportedAttr);
 
     parent->AddChild(vrvTempo);
     ReadUnsupportedAttr(tempo, vrvTempo);
@@ -4067,9 +4068,9 @@ bool MEIInput::ReadTie(Object *parent, pugi::xml_node tie)
     ReadControlElement(tie, vrvTie);
 
     ReadTimeSpanningInterface(tie, vrvTie);
-    vrvTie->ReadColor(tie);
-    vrvTie->ReadCurvature(tie);
-    vrvTie->ReadCurveRend(tie);
+    vrvTie->ReadColor(tie, m_readUnsupportedAttr);
+    vrvTie->ReadCurvature(tie, m_readUnsupportedAttr);
+    vrvTie->ReadCurveRend(tie, m_readUnsupportedAttr);
 
     parent->AddChild(vrvTie);
     ReadUnsupportedAttr(tie, vrvTie);
@@ -4082,9 +4083,9 @@ bool MEIInput::ReadTrill(Object *parent, pugi::xml_node trill)
     ReadControlElement(trill, vrvTrill);
 
     ReadTimeSpanningInterface(trill, vrvTrill);
-    vrvTrill->ReadColor(trill);
-    vrvTrill->ReadOrnamentAccid(trill);
-    vrvTrill->ReadPlacement(trill);
+    vrvTrill->ReadColor(trill, m_readUnsupportedAttr);
+    vrvTrill->ReadOrnamentAccid(trill, m_readUnsupportedAttr);
+    vrvTrill->ReadPlacement(trill, m_readUnsupportedAttr);
 
     parent->AddChild(vrvTrill);
     ReadUnsupportedAttr(trill, vrvTrill);
@@ -4101,10 +4102,10 @@ bool MEIInput::ReadTurn(Object *parent, pugi::xml_node turn)
     }
 
     ReadTimePointInterface(turn, vrvTurn);
-    vrvTurn->ReadColor(turn);
-    vrvTurn->ReadOrnamentAccid(turn);
-    vrvTurn->ReadPlacement(turn);
-    vrvTurn->ReadTurnLog(turn);
+    vrvTurn->ReadColor(turn, m_readUnsupportedAttr);
+    vrvTurn->ReadOrnamentAccid(turn, m_readUnsupportedAttr);
+    vrvTurn->ReadPlacement(turn, m_readUnsupportedAttr);
+    vrvTurn->ReadTurnLog(turn, m_readUnsupportedAttr);
 
     parent->AddChild(vrvTurn);
     ReadUnsupportedAttr(turn, vrvTurn);
@@ -4149,10 +4150,10 @@ bool MEIInput::ReadStaff(Object *parent, pugi::xml_node staff)
     Staff *vrvStaff = new Staff();
     SetMeiUuid(staff, vrvStaff);
 
-    vrvStaff->ReadFacsimile(staff);
-    vrvStaff->ReadNInteger(staff);
-    vrvStaff->ReadTyped(staff);
-    vrvStaff->ReadVisibility(staff);
+    vrvStaff->ReadFacsimile(staff, m_readUnsupportedAttr);
+    vrvStaff->ReadNInteger(staff, m_readUnsupportedAttr);
+    vrvStaff->ReadTyped(staff, m_readUnsupportedAttr);
+    vrvStaff->ReadVisibility(staff, m_readUnsupportedAttr);
 
     if (staff.attribute("uly") && (this->m_doc->GetType() == Transcription)) {
         vrvStaff->m_yAbs = atoi(staff.attribute("uly").value()) * DEFINITION_FACTOR;
@@ -4196,9 +4197,9 @@ bool MEIInput::ReadLayer(Object *parent, pugi::xml_node layer)
     Layer *vrvLayer = new Layer();
     SetMeiUuid(layer, vrvLayer);
 
-    vrvLayer->ReadNInteger(layer);
-    vrvLayer->ReadTyped(layer);
-    vrvLayer->ReadVisibility(layer);
+    vrvLayer->ReadNInteger(layer, m_readUnsupportedAttr);
+    vrvLayer->ReadTyped(layer, m_readUnsupportedAttr);
+    vrvLayer->ReadVisibility(layer, m_readUnsupportedAttr);
 
     if (!vrvLayer->HasN()) {
         LogWarning("No @n on <layer>, 1 is set");
@@ -4359,7 +4360,7 @@ bool MEIInput::ReadLayerElement(pugi::xml_node element, LayerElement *object)
         element.remove_attribute("ulx");
     } /*else if (element.attribute("facs") && this->m_doc->HasZones() && object->HasAttClass(ATT_COORDINATED)) {
         Zone zone = this->m_doc->GetZone(element.attribute("facs").value());
-        AttCoordinated *att = dynamic_cast<AttCoordinated *>(object);
+        AttCoordinated *att = vrv_cross_cast<AttCoordinated *>(object);
         assert(att);
         LogMessage("%d, %d, %d, %d", zone.ulx, zone.uly, zone.lrx, zone.lry);
         if (zone.ulx > 0) {
@@ -4379,8 +4380,8 @@ bool MEIInput::ReadLayerElement(pugi::xml_node element, LayerElement *object)
 
     SetMeiUuid(element, object);
     ReadLinkingInterface(element, object);
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    object->ReadLabelled(element, m_readUnsupportedAttr);
+    object->ReadTyped(element, m_readUnsupportedAttr);
 
     return true;
 }
@@ -4391,11 +4392,11 @@ bool MEIInput::ReadAccid(Object *parent, pugi::xml_node accid)
     ReadLayerElement(accid, vrvAccid);
 
     ReadPositionInterface(accid, vrvAccid);
-    vrvAccid->ReadAccidental(accid);
-    vrvAccid->ReadAccidentalGestural(accid);
-    vrvAccid->ReadAccidLog(accid);
-    vrvAccid->ReadColor(accid);
-    vrvAccid->ReadEnclosingChars(accid);
+    vrvAccid->ReadAccidental(accid, m_readUnsupportedAttr);
+    vrvAccid->ReadAccidentalGestural(accid, m_readUnsupportedAttr);
+    vrvAccid->ReadAccidLog(accid, m_readUnsupportedAttr);
+    vrvAccid->ReadColor(accid, m_readUnsupportedAttr);
+    vrvAccid->ReadEnclosingChars(accid, m_readUnsupportedAttr);
 
     parent->AddChild(vrvAccid);
     ReadUnsupportedAttr(accid, vrvAccid);
@@ -4407,9 +4408,9 @@ bool MEIInput::ReadArtic(Object *parent, pugi::xml_node artic)
     Artic *vrvArtic = new Artic();
     ReadLayerElement(artic, vrvArtic);
 
-    vrvArtic->ReadArticulation(artic);
-    vrvArtic->ReadColor(artic);
-    vrvArtic->ReadPlacement(artic);
+    vrvArtic->ReadArticulation(artic, m_readUnsupportedAttr);
+    vrvArtic->ReadColor(artic, m_readUnsupportedAttr);
+    vrvArtic->ReadPlacement(artic, m_readUnsupportedAttr);
 
     parent->AddChild(vrvArtic);
     ReadUnsupportedAttr(artic, vrvArtic);
@@ -4421,9 +4422,9 @@ bool MEIInput::ReadBarLine(Object *parent, pugi::xml_node barLine)
     BarLine *vrvBarLine = new BarLine();
     ReadLayerElement(barLine, vrvBarLine);
 
-    vrvBarLine->ReadBarLineLog(barLine);
-    vrvBarLine->ReadColor(barLine);
-    vrvBarLine->ReadVisibility(barLine);
+    vrvBarLine->ReadBarLineLog(barLine, m_readUnsupportedAttr);
+    vrvBarLine->ReadColor(barLine, m_readUnsupportedAttr);
+    vrvBarLine->ReadVisibility(barLine, m_readUnsupportedAttr);
 
     parent->AddChild(vrvBarLine);
     ReadUnsupportedAttr(barLine, vrvBarLine);
@@ -4435,9 +4436,9 @@ bool MEIInput::ReadBeam(Object *parent, pugi::xml_node beam)
     Beam *vrvBeam = new Beam();
     ReadLayerElement(beam, vrvBeam);
 
-    vrvBeam->ReadColor(beam);
-    vrvBeam->ReadBeamedWith(beam);
-    vrvBeam->ReadBeamRend(beam);
+    vrvBeam->ReadColor(beam, m_readUnsupportedAttr);
+    vrvBeam->ReadBeamedWith(beam, m_readUnsupportedAttr);
+    vrvBeam->ReadBeamRend(beam, m_readUnsupportedAttr);
 
     parent->AddChild(vrvBeam);
     ReadUnsupportedAttr(beam, vrvBeam);
@@ -4449,8 +4450,8 @@ bool MEIInput::ReadBeatRpt(Object *parent, pugi::xml_node beatRpt)
     BeatRpt *vrvBeatRpt = new BeatRpt();
     ReadLayerElement(beatRpt, vrvBeatRpt);
 
-    vrvBeatRpt->ReadColor(beatRpt);
-    vrvBeatRpt->ReadBeatRptVis(beatRpt);
+    vrvBeatRpt->ReadColor(beatRpt, m_readUnsupportedAttr);
+    vrvBeatRpt->ReadBeatRptVis(beatRpt, m_readUnsupportedAttr);
 
     if (m_version < MEI_4_0_0) {
         UpgradeBeatRptTo_4_0_0(beatRpt, vrvBeatRpt);
@@ -4466,7 +4467,7 @@ bool MEIInput::ReadBTrem(Object *parent, pugi::xml_node bTrem)
     BTrem *vrvBTrem = new BTrem();
     ReadLayerElement(bTrem, vrvBTrem);
 
-    vrvBTrem->ReadTremMeasured(bTrem);
+    vrvBTrem->ReadTremMeasured(bTrem, m_readUnsupportedAttr);
 
     parent->AddChild(vrvBTrem);
     ReadUnsupportedAttr(bTrem, vrvBTrem);
@@ -4479,13 +4480,13 @@ bool MEIInput::ReadChord(Object *parent, pugi::xml_node chord)
     ReadLayerElement(chord, vrvChord);
 
     ReadDurationInterface(chord, vrvChord);
-    vrvChord->ReadColor(chord);
-    vrvChord->ReadCue(chord);
-    vrvChord->ReadGraced(chord);
-    vrvChord->ReadStems(chord);
-    vrvChord->ReadStemsCmn(chord);
-    vrvChord->ReadTiePresent(chord);
-    vrvChord->ReadVisibility(chord);
+    vrvChord->ReadColor(chord, m_readUnsupportedAttr);
+    vrvChord->ReadCue(chord, m_readUnsupportedAttr);
+    vrvChord->ReadGraced(chord, m_readUnsupportedAttr);
+    vrvChord->ReadStems(chord, m_readUnsupportedAttr);
+    vrvChord->ReadStemsCmn(chord, m_readUnsupportedAttr);
+    vrvChord->ReadTiePresent(chord, m_readUnsupportedAttr);
+    vrvChord->ReadVisibility(chord, m_readUnsupportedAttr);
 
     AttArticulation artic;
     artic.ReadArticulation(chord);
@@ -4511,10 +4512,10 @@ bool MEIInput::ReadClef(Object *parent, pugi::xml_node clef)
     ReadLayerElement(clef, vrvClef);
     ReadFacsimileInterface(clef, vrvClef);
 
-    vrvClef->ReadClefShape(clef);
-    vrvClef->ReadColor(clef);
-    vrvClef->ReadLineLoc(clef);
-    vrvClef->ReadOctaveDisplacement(clef);
+    vrvClef->ReadClefShape(clef, m_readUnsupportedAttr);
+    vrvClef->ReadColor(clef, m_readUnsupportedAttr);
+    vrvClef->ReadLineLoc(clef, m_readUnsupportedAttr);
+    vrvClef->ReadOctaveDisplacement(clef, m_readUnsupportedAttr);
 
     parent->AddChild(vrvClef);
     ReadUnsupportedAttr(clef, vrvClef);
@@ -4529,7 +4530,7 @@ bool MEIInput::ReadCustos(Object *parent, pugi::xml_node custos)
     ReadFacsimileInterface(custos, vrvCustos);
     ReadPitchInterface(custos, vrvCustos);
     ReadPositionInterface(custos, vrvCustos);
-    vrvCustos->ReadColor(custos);
+    vrvCustos->ReadColor(custos, m_readUnsupportedAttr);
 
     parent->AddChild(vrvCustos);
     ReadUnsupportedAttr(custos, vrvCustos);
@@ -4542,8 +4543,8 @@ bool MEIInput::ReadDot(Object *parent, pugi::xml_node dot)
     ReadLayerElement(dot, vrvDot);
 
     ReadPositionInterface(dot, vrvDot);
-    vrvDot->ReadColor(dot);
-    vrvDot->ReadDotLog(dot);
+    vrvDot->ReadColor(dot, m_readUnsupportedAttr);
+    vrvDot->ReadDotLog(dot, m_readUnsupportedAttr);
 
     parent->AddChild(vrvDot);
     ReadUnsupportedAttr(dot, vrvDot);
@@ -4559,8 +4560,8 @@ bool MEIInput::ReadFTrem(Object *parent, pugi::xml_node fTrem)
         UpgradeFTremTo_4_0_0(fTrem, vrvFTrem);
     }
 
-    vrvFTrem->ReadFTremVis(fTrem);
-    vrvFTrem->ReadTremMeasured(fTrem);
+    vrvFTrem->ReadFTremVis(fTrem, m_readUnsupportedAttr);
+    vrvFTrem->ReadTremMeasured(fTrem, m_readUnsupportedAttr);
 
     parent->AddChild(vrvFTrem);
     ReadUnsupportedAttr(fTrem, vrvFTrem);
@@ -4572,9 +4573,9 @@ bool MEIInput::ReadGraceGrp(Object *parent, pugi::xml_node graceGrp)
     GraceGrp *vrvGraceGrp = new GraceGrp();
     ReadLayerElement(graceGrp, vrvGraceGrp);
 
-    vrvGraceGrp->ReadColor(graceGrp);
-    vrvGraceGrp->ReadGraced(graceGrp);
-    vrvGraceGrp->ReadGraceGrpLog(graceGrp);
+    vrvGraceGrp->ReadColor(graceGrp, m_readUnsupportedAttr);
+    vrvGraceGrp->ReadGraced(graceGrp, m_readUnsupportedAttr);
+    vrvGraceGrp->ReadGraceGrpLog(graceGrp, m_readUnsupportedAttr);
 
     parent->AddChild(vrvGraceGrp);
     ReadUnsupportedAttr(graceGrp, vrvGraceGrp);
@@ -4597,9 +4598,9 @@ bool MEIInput::ReadKeyAccid(Object *parent, pugi::xml_node keyAccid)
     ReadLayerElement(keyAccid, vrvKeyAccid);
 
     ReadPitchInterface(keyAccid, vrvKeyAccid);
-    vrvKeyAccid->ReadAccidental(keyAccid);
-    vrvKeyAccid->ReadColor(keyAccid);
-    vrvKeyAccid->ReadEnclosingChars(keyAccid);
+    vrvKeyAccid->ReadAccidental(keyAccid, m_readUnsupportedAttr);
+    vrvKeyAccid->ReadColor(keyAccid, m_readUnsupportedAttr);
+    vrvKeyAccid->ReadEnclosingChars(keyAccid, m_readUnsupportedAttr);
 
     parent->AddChild(vrvKeyAccid);
     ReadUnsupportedAttr(keyAccid, vrvKeyAccid);
@@ -4611,12 +4612,12 @@ bool MEIInput::ReadKeySig(Object *parent, pugi::xml_node keySig)
     KeySig *vrvKeySig = new KeySig();
     ReadLayerElement(keySig, vrvKeySig);
 
-    vrvKeySig->ReadAccidental(keySig);
-    vrvKeySig->ReadPitch(keySig);
-    vrvKeySig->ReadKeySigAnl(keySig);
-    vrvKeySig->ReadKeySigLog(keySig);
-    vrvKeySig->ReadKeySigVis(keySig);
-    vrvKeySig->ReadVisibility(keySig);
+    vrvKeySig->ReadAccidental(keySig, m_readUnsupportedAttr);
+    vrvKeySig->ReadPitch(keySig, m_readUnsupportedAttr);
+    vrvKeySig->ReadKeySigAnl(keySig, m_readUnsupportedAttr);
+    vrvKeySig->ReadKeySigLog(keySig, m_readUnsupportedAttr);
+    vrvKeySig->ReadKeySigVis(keySig, m_readUnsupportedAttr);
+    vrvKeySig->ReadVisibility(keySig, m_readUnsupportedAttr);
 
     parent->AddChild(vrvKeySig);
     ReadUnsupportedAttr(keySig, vrvKeySig);
@@ -4628,7 +4629,7 @@ bool MEIInput::ReadLigature(Object *parent, pugi::xml_node ligature)
     Ligature *vrvLigature = new Ligature();
     SetMeiUuid(ligature, vrvLigature);
 
-    vrvLigature->ReadLigatureLog(ligature);
+    vrvLigature->ReadLigatureLog(ligature, m_readUnsupportedAttr);
 
     parent->AddChild(vrvLigature);
     ReadUnsupportedAttr(ligature, vrvLigature);
@@ -4640,14 +4641,14 @@ bool MEIInput::ReadMensur(Object *parent, pugi::xml_node mensur)
     Mensur *vrvMensur = new Mensur();
     ReadLayerElement(mensur, vrvMensur);
 
-    vrvMensur->ReadColor(mensur);
-    vrvMensur->ReadCue(mensur);
-    vrvMensur->ReadDurationRatio(mensur);
-    vrvMensur->ReadMensuralShared(mensur);
-    vrvMensur->ReadMensurLog(mensur);
-    vrvMensur->ReadMensurVis(mensur);
-    vrvMensur->ReadSlashCount(mensur);
-    vrvMensur->ReadStaffLoc(mensur);
+    vrvMensur->ReadColor(mensur, m_readUnsupportedAttr);
+    vrvMensur->ReadCue(mensur, m_readUnsupportedAttr);
+    vrvMensur->ReadDurationRatio(mensur, m_readUnsupportedAttr);
+    vrvMensur->ReadMensuralShared(mensur, m_readUnsupportedAttr);
+    vrvMensur->ReadMensurLog(mensur, m_readUnsupportedAttr);
+    vrvMensur->ReadMensurVis(mensur, m_readUnsupportedAttr);
+    vrvMensur->ReadSlashCount(mensur, m_readUnsupportedAttr);
+    vrvMensur->ReadStaffLoc(mensur, m_readUnsupportedAttr);
 
     parent->AddChild(vrvMensur);
     ReadUnsupportedAttr(mensur, vrvMensur);
@@ -4659,8 +4660,8 @@ bool MEIInput::ReadMeterSig(Object *parent, pugi::xml_node meterSig)
     MeterSig *vrvMeterSig = new MeterSig();
     ReadLayerElement(meterSig, vrvMeterSig);
 
-    vrvMeterSig->ReadMeterSigLog(meterSig);
-    vrvMeterSig->ReadMeterSigVis(meterSig);
+    vrvMeterSig->ReadMeterSigLog(meterSig, m_readUnsupportedAttr);
+    vrvMeterSig->ReadMeterSigVis(meterSig, m_readUnsupportedAttr);
 
     parent->AddChild(vrvMeterSig);
     ReadUnsupportedAttr(meterSig, vrvMeterSig);
@@ -4673,9 +4674,9 @@ bool MEIInput::ReadMRest(Object *parent, pugi::xml_node mRest)
     ReadLayerElement(mRest, vrvMRest);
     ReadPositionInterface(mRest, vrvMRest);
 
-    vrvMRest->ReadCue(mRest);
-    vrvMRest->ReadFermataPresent(mRest);
-    vrvMRest->ReadVisibility(mRest);
+    vrvMRest->ReadCue(mRest, m_readUnsupportedAttr);
+    vrvMRest->ReadFermataPresent(mRest, m_readUnsupportedAttr);
+    vrvMRest->ReadVisibility(mRest, m_readUnsupportedAttr);
 
     if (vrvMRest->HasFermata()) {
         m_doc->SetAnalyticalMarkup(true);
@@ -4711,8 +4712,8 @@ bool MEIInput::ReadMultiRest(Object *parent, pugi::xml_node multiRest)
     MultiRest *vrvMultiRest = new MultiRest();
     ReadLayerElement(multiRest, vrvMultiRest);
 
-    vrvMultiRest->ReadMultiRestVis(multiRest);
-    vrvMultiRest->ReadNumbered(multiRest);
+    vrvMultiRest->ReadMultiRestVis(multiRest, m_readUnsupportedAttr);
+    vrvMultiRest->ReadNumbered(multiRest, m_readUnsupportedAttr);
 
     parent->AddChild(vrvMultiRest);
     ReadUnsupportedAttr(multiRest, vrvMultiRest);
@@ -4724,7 +4725,7 @@ bool MEIInput::ReadMultiRpt(Object *parent, pugi::xml_node multiRpt)
     MultiRpt *vrvMultiRpt = new MultiRpt();
     ReadLayerElement(multiRpt, vrvMultiRpt);
 
-    vrvMultiRpt->ReadNumbered(multiRpt);
+    vrvMultiRpt->ReadNumbered(multiRpt, m_readUnsupportedAttr);
 
     parent->AddChild(vrvMultiRpt);
     ReadUnsupportedAttr(multiRpt, vrvMultiRpt);
@@ -4740,9 +4741,9 @@ bool MEIInput::ReadNc(Object *parent, pugi::xml_node nc)
     ReadFacsimileInterface(nc, vrvNc);
     ReadPitchInterface(nc, vrvNc);
     ReadPositionInterface(nc, vrvNc);
-    vrvNc->ReadColor(nc);
-    vrvNc->ReadIntervalMelodic(nc);
-    vrvNc->ReadNcForm(nc);
+    vrvNc->ReadColor(nc, m_readUnsupportedAttr);
+    vrvNc->ReadIntervalMelodic(nc, m_readUnsupportedAttr);
+    vrvNc->ReadNcForm(nc, m_readUnsupportedAttr);
 
     parent->AddChild(vrvNc);
     return ReadLayerChildren(vrvNc, nc, vrvNc);
@@ -4754,7 +4755,7 @@ bool MEIInput::ReadNeume(Object *parent, pugi::xml_node neume)
     ReadLayerElement(neume, vrvNeume);
     ReadFacsimileInterface(neume, vrvNeume);
 
-    vrvNeume->ReadColor(neume);
+    vrvNeume->ReadColor(neume, m_readUnsupportedAttr);
 
     parent->AddChild(vrvNeume);
     return ReadLayerChildren(vrvNeume, neume, vrvNeume);
@@ -4768,16 +4769,16 @@ bool MEIInput::ReadNote(Object *parent, pugi::xml_node note)
     ReadDurationInterface(note, vrvNote);
     ReadPitchInterface(note, vrvNote);
     ReadPositionInterface(note, vrvNote);
-    vrvNote->ReadColor(note);
-    vrvNote->ReadColoration(note);
-    vrvNote->ReadCue(note);
-    vrvNote->ReadGraced(note);
-    vrvNote->ReadMidiVelocity(note);
-    vrvNote->ReadNoteAnlMensural(note);
-    vrvNote->ReadStems(note);
-    vrvNote->ReadStemsCmn(note);
-    vrvNote->ReadTiePresent(note);
-    vrvNote->ReadVisibility(note);
+    vrvNote->ReadColor(note, m_readUnsupportedAttr);
+    vrvNote->ReadColoration(note, m_readUnsupportedAttr);
+    vrvNote->ReadCue(note, m_readUnsupportedAttr);
+    vrvNote->ReadGraced(note, m_readUnsupportedAttr);
+    vrvNote->ReadMidiVelocity(note, m_readUnsupportedAttr);
+    vrvNote->ReadNoteAnlMensural(note, m_readUnsupportedAttr);
+    vrvNote->ReadStems(note, m_readUnsupportedAttr);
+    vrvNote->ReadStemsCmn(note, m_readUnsupportedAttr);
+    vrvNote->ReadTiePresent(note, m_readUnsupportedAttr);
+    vrvNote->ReadVisibility(note, m_readUnsupportedAttr);
 
     AttArticulation artic;
     artic.ReadArticulation(note);
@@ -4816,9 +4817,9 @@ bool MEIInput::ReadRest(Object *parent, pugi::xml_node rest)
 
     ReadDurationInterface(rest, vrvRest);
     ReadPositionInterface(rest, vrvRest);
-    vrvRest->ReadColor(rest);
-    vrvRest->ReadCue(rest);
-    vrvRest->ReadRestVisMensural(rest);
+    vrvRest->ReadColor(rest, m_readUnsupportedAttr);
+    vrvRest->ReadCue(rest, m_readUnsupportedAttr);
+    vrvRest->ReadRestVisMensural(rest, m_readUnsupportedAttr);
 
     parent->AddChild(vrvRest);
     ReadUnsupportedAttr(rest, vrvRest);
@@ -4830,7 +4831,7 @@ bool MEIInput::ReadProport(Object *parent, pugi::xml_node proport)
     Proport *vrvProport = new Proport();
     ReadLayerElement(proport, vrvProport);
 
-    vrvProport->ReadDurationRatio(proport);
+    vrvProport->ReadDurationRatio(proport, m_readUnsupportedAttr);
 
     parent->AddChild(vrvProport);
     ReadUnsupportedAttr(proport, vrvProport);
@@ -4854,9 +4855,9 @@ bool MEIInput::ReadSyl(Object *parent, pugi::xml_node syl)
     Syl *vrvSyl = new Syl();
     ReadLayerElement(syl, vrvSyl);
 
-    vrvSyl->ReadLang(syl);
-    vrvSyl->ReadTypography(syl);
-    vrvSyl->ReadSylLog(syl);
+    vrvSyl->ReadLang(syl, m_readUnsupportedAttr);
+    vrvSyl->ReadTypography(syl, m_readUnsupportedAttr);
+    vrvSyl->ReadSylLog(syl, m_readUnsupportedAttr);
 
     parent->AddChild(vrvSyl);
     ReadUnsupportedAttr(syl, vrvSyl);
@@ -4869,8 +4870,8 @@ bool MEIInput::ReadSyllable(Object *parent, pugi::xml_node syllable)
     Syllable *vrvSyllable = new Syllable();
     ReadLayerElement(syllable, vrvSyllable);
 
-    vrvSyllable->ReadColor(syllable);
-    vrvSyllable->ReadSlashCount(syllable);
+    vrvSyllable->ReadColor(syllable, m_readUnsupportedAttr);
+    vrvSyllable->ReadSlashCount(syllable, m_readUnsupportedAttr);
 
     parent->AddChild(vrvSyllable);
 
@@ -4894,10 +4895,10 @@ bool MEIInput::ReadTuplet(Object *parent, pugi::xml_node tuplet)
     Tuplet *vrvTuplet = new Tuplet();
     ReadLayerElement(tuplet, vrvTuplet);
 
-    vrvTuplet->ReadColor(tuplet);
-    vrvTuplet->ReadDurationRatio(tuplet);
-    vrvTuplet->ReadNumberPlacement(tuplet);
-    vrvTuplet->ReadTupletVis(tuplet);
+    vrvTuplet->ReadColor(tuplet, m_readUnsupportedAttr);
+    vrvTuplet->ReadDurationRatio(tuplet, m_readUnsupportedAttr);
+    vrvTuplet->ReadNumberPlacement(tuplet, m_readUnsupportedAttr);
+    vrvTuplet->ReadTupletVis(tuplet, m_readUnsupportedAttr);
 
     parent->AddChild(vrvTuplet);
     ReadUnsupportedAttr(tuplet, vrvTuplet);
@@ -4909,10 +4910,10 @@ bool MEIInput::ReadVerse(Object *parent, pugi::xml_node verse)
     Verse *vrvVerse = new Verse();
     ReadLayerElement(verse, vrvVerse);
 
-    vrvVerse->ReadColor(verse);
-    vrvVerse->ReadLang(verse);
-    vrvVerse->ReadNInteger(verse);
-    vrvVerse->ReadTypography(verse);
+    vrvVerse->ReadColor(verse, m_readUnsupportedAttr);
+    vrvVerse->ReadLang(verse, m_readUnsupportedAttr);
+    vrvVerse->ReadNInteger(verse, m_readUnsupportedAttr);
+    vrvVerse->ReadTypography(verse, m_readUnsupportedAttr);
 
     parent->AddChild(vrvVerse);
     ReadUnsupportedAttr(verse, vrvVerse);
@@ -4978,8 +4979,8 @@ bool MEIInput::ReadTextChildren(Object *parent, pugi::xml_node parentNode, Objec
 bool MEIInput::ReadTextElement(pugi::xml_node element, TextElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    object->ReadLabelled(element, m_readUnsupportedAttr);
+    object->ReadTyped(element, m_readUnsupportedAttr);
 
     return true;
 }
@@ -5035,11 +5036,11 @@ bool MEIInput::ReadRend(Object *parent, pugi::xml_node rend)
 
     ReadAreaPosInterface(rend, vrvRend);
 
-    vrvRend->ReadColor(rend);
-    vrvRend->ReadLang(rend);
-    vrvRend->ReadTextRendition(rend);
-    vrvRend->ReadTypography(rend);
-    vrvRend->ReadWhitespace(rend);
+    vrvRend->ReadColor(rend, m_readUnsupportedAttr);
+    vrvRend->ReadLang(rend, m_readUnsupportedAttr);
+    vrvRend->ReadTextRendition(rend, m_readUnsupportedAttr);
+    vrvRend->ReadTypography(rend, m_readUnsupportedAttr);
+    vrvRend->ReadWhitespace(rend, m_readUnsupportedAttr);
 
     if (vrvRend->GetFirstAncestor(REND) && (vrvRend->HasHalign() || vrvRend->HasValign())) {
         LogWarning("@halign or @valign in nested <rend> element <rend> %s will be ignored", vrvRend->GetUuid().c_str());
@@ -5087,20 +5088,20 @@ bool MEIInput::ReadText(Object *parent, pugi::xml_node text, bool trimLeft, bool
 
 bool MEIInput::ReadAreaPosInterface(pugi::xml_node element, AreaPosInterface *interface)
 {
-    interface->ReadHorizontalAlign(element);
-    interface->ReadVerticalAlign(element);
+    interface->ReadHorizontalAlign(element, m_readUnsupportedAttr);
+    interface->ReadVerticalAlign(element, m_readUnsupportedAttr);
     return true;
 }
 
 bool MEIInput::ReadDurationInterface(pugi::xml_node element, DurationInterface *interface)
 {
-    interface->ReadAugmentDots(element);
-    interface->ReadBeamSecondary(element);
-    interface->ReadDurationGestural(element);
-    interface->ReadDurationLogical(element);
-    interface->ReadDurationRatio(element);
-    interface->ReadFermataPresent(element);
-    interface->ReadStaffIdent(element);
+    interface->ReadAugmentDots(element, m_readUnsupportedAttr);
+    interface->ReadBeamSecondary(element, m_readUnsupportedAttr);
+    interface->ReadDurationGestural(element, m_readUnsupportedAttr);
+    interface->ReadDurationLogical(element, m_readUnsupportedAttr);
+    interface->ReadDurationRatio(element, m_readUnsupportedAttr);
+    interface->ReadFermataPresent(element, m_readUnsupportedAttr);
+    interface->ReadStaffIdent(element, m_readUnsupportedAttr);
 
     if (interface->HasFermata()) {
         m_doc->SetAnalyticalMarkup(true);
@@ -5111,71 +5112,73 @@ bool MEIInput::ReadDurationInterface(pugi::xml_node element, DurationInterface *
 
 bool MEIInput::ReadLinkingInterface(pugi::xml_node element, LinkingInterface *interface)
 {
-    interface->ReadLinking(element);
+    interface->ReadLinking(element, m_readUnsupportedAttr);
     return true;
 }
 
 bool MEIInput::ReadFacsimileInterface(pugi::xml_node element, FacsimileInterface *interface)
 {
-    interface->ReadFacsimile(element);
+    interface->ReadFacsimile(element, m_readUnsupportedAttr);
     return true;
 }
 
 bool MEIInput::ReadPitchInterface(pugi::xml_node element, PitchInterface *interface)
 {
-    interface->ReadNoteGes(element);
-    interface->ReadOctave(element);
-    interface->ReadPitch(element);
+    interface->ReadNoteGes(element, m_readUnsupportedAttr);
+    interface->ReadOctave(element, m_readUnsupportedAttr);
+    interface->ReadPitch(element, m_readUnsupportedAttr);
     return true;
 }
 
 bool MEIInput::ReadPlistInterface(pugi::xml_node element, PlistInterface *interface)
 {
-    interface->ReadPlist(element);
+    interface->ReadPlist(element, m_readUnsupportedAttr);
     return true;
 }
 
 bool MEIInput::ReadPositionInterface(pugi::xml_node element, PositionInterface *interface)
 {
-    interface->ReadStaffLoc(element);
-    interface->ReadStaffLocPitched(element);
+    interface->ReadStaffLoc(element, m_readUnsupportedAttr);
+    interface->ReadStaffLocPitched(element, m_readUnsupportedAttr);
     return true;
 }
 
 bool MEIInput::ReadScoreDefInterface(pugi::xml_node element, ScoreDefInterface *interface)
 {
-    interface->ReadLyricStyle(element);
-    interface->ReadMidiTempo(element);
-    interface->ReadMultinumMeasures(element);
+    interface->ReadLyricStyle(element, m_readUnsupportedAttr);
+    interface->ReadMidiTempo(element, m_readUnsupportedAttr);
+    interface->ReadMultinumMeasures(element, m_readUnsupportedAttr);
     return true;
 }
 
 bool MEIInput::ReadTextDirInterface(pugi::xml_node element, TextDirInterface *interface)
 {
-    interface->ReadPlacement(element);
+    interface->ReadPlacement(element, m_readUnsupportedAttr);
     return true;
 }
 
 bool MEIInput::ReadTimePointInterface(pugi::xml_node element, TimePointInterface *interface)
 {
-    interface->ReadStaffIdent(element);
-    interface->ReadStartId(element);
-    interface->ReadTimestampLogical(element);
+    interface->ReadStaffIdent(element, m_readUnsupportedAttr);
+    interface->ReadStartId(element, m_readUnsupportedAttr);
+    interface->ReadTimestampLogical(element, m_readUnsupportedAttr);
     return true;
 }
 
 bool MEIInput::ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInterface *interface)
 {
     ReadTimePointInterface(element, interface);
-    interface->ReadStartEndId(element);
-    interface->ReadTimestamp2Logical(element);
+    interface->ReadStartEndId(element, m_readUnsupportedAttr);
+    interface->ReadTimestamp2Logical(element, m_readUnsupportedAttr);
     return true;
 }
 
 void MEIInput::ReadUnsupportedAttr(pugi::xml_node element, Object *object)
 {
+    if (!m_readUnsupportedAttr) return;
+
     for (pugi::xml_attribute_iterator ait = element.attributes_begin(); ait != element.attributes_end(); ++ait) {
-        object->m_unsupported.push_back(std::make_pair(ait->name(), ait->value()));
+        object->AddUnsupportedAttr(ait->name(), ait->value());
     }
 }
 
@@ -5242,8 +5245,8 @@ bool MEIInput::ReadEditorialElement(pugi::xml_node element, EditorialElement *ob
 {
     SetMeiUuid(element, object);
 
-    object->ReadLabelled(element);
-    object->ReadTyped(element);
+    object->ReadLabelled(element, m_readUnsupportedAttr);
+    object->ReadTyped(element, m_readUnsupportedAttr);
 
     return true;
 }
@@ -5253,7 +5256,7 @@ bool MEIInput::ReadAbbr(Object *parent, pugi::xml_node abbr, EditorialLevel leve
     Abbr *vrvAbbr = new Abbr();
     ReadEditorialElement(abbr, vrvAbbr);
 
-    vrvAbbr->ReadSource(abbr);
+    vrvAbbr->ReadSource(abbr, m_readUnsupportedAttr);
 
     parent->AddChild(vrvAbbr);
     ReadUnsupportedAttr(abbr, vrvAbbr);
@@ -5265,7 +5268,7 @@ bool MEIInput::ReadAdd(Object *parent, pugi::xml_node add, EditorialLevel level,
     Add *vrvAdd = new Add();
     ReadEditorialElement(add, vrvAdd);
 
-    vrvAdd->ReadSource(add);
+    vrvAdd->ReadSource(add, m_readUnsupportedAttr);
 
     parent->AddChild(vrvAdd);
     ReadUnsupportedAttr(add, vrvAdd);
@@ -5277,8 +5280,8 @@ bool MEIInput::ReadAnnot(Object *parent, pugi::xml_node annot)
     Annot *vrvAnnot = new Annot();
     ReadEditorialElement(annot, vrvAnnot);
 
-    vrvAnnot->ReadPlist(annot);
-    vrvAnnot->ReadSource(annot);
+    vrvAnnot->ReadPlist(annot, m_readUnsupportedAttr);
+    vrvAnnot->ReadSource(annot, m_readUnsupportedAttr);
 
     vrvAnnot->m_content.reset();
     // copy all the nodes inside into the document
@@ -5453,7 +5456,7 @@ bool MEIInput::ReadCorr(Object *parent, pugi::xml_node corr, EditorialLevel leve
     Corr *vrvCorr = new Corr();
     ReadEditorialElement(corr, vrvCorr);
 
-    vrvCorr->ReadSource(corr);
+    vrvCorr->ReadSource(corr, m_readUnsupportedAttr);
 
     parent->AddChild(vrvCorr);
     ReadUnsupportedAttr(corr, vrvCorr);
@@ -5465,7 +5468,7 @@ bool MEIInput::ReadDamage(Object *parent, pugi::xml_node damage, EditorialLevel
     Damage *vrvDamage = new Damage();
     ReadEditorialElement(damage, vrvDamage);
 
-    vrvDamage->ReadSource(damage);
+    vrvDamage->ReadSource(damage, m_readUnsupportedAttr);
 
     parent->AddChild(vrvDamage);
     ReadUnsupportedAttr(damage, vrvDamage);
@@ -5477,7 +5480,7 @@ bool MEIInput::ReadDel(Object *parent, pugi::xml_node del, EditorialLevel level,
     Del *vrvDel = new Del();
     ReadEditorialElement(del, vrvDel);
 
-    vrvDel->ReadSource(del);
+    vrvDel->ReadSource(del, m_readUnsupportedAttr);
 
     parent->AddChild(vrvDel);
     ReadUnsupportedAttr(del, vrvDel);
@@ -5489,7 +5492,7 @@ bool MEIInput::ReadExpan(Object *parent, pugi::xml_node expan, EditorialLevel le
     Expan *vrvExpan = new Expan();
     ReadEditorialElement(expan, vrvExpan);
 
-    vrvExpan->ReadSource(expan);
+    vrvExpan->ReadSource(expan, m_readUnsupportedAttr);
 
     parent->AddChild(vrvExpan);
     ReadUnsupportedAttr(expan, vrvExpan);
@@ -5505,7 +5508,7 @@ bool MEIInput::ReadLem(Object *parent, pugi::xml_node lem, EditorialLevel level,
     vrvLem->m_visibility = Hidden;
     ReadEditorialElement(lem, vrvLem);
 
-    vrvLem->ReadSource(lem);
+    vrvLem->ReadSource(lem, m_readUnsupportedAttr);
 
     parent->AddChild(vrvLem);
     ReadUnsupportedAttr(lem, vrvLem);
@@ -5517,7 +5520,7 @@ bool MEIInput::ReadOrig(Object *parent, pugi::xml_node orig, EditorialLevel leve
     Orig *vrvOrig = new Orig();
     ReadEditorialElement(orig, vrvOrig);
 
-    vrvOrig->ReadSource(orig);
+    vrvOrig->ReadSource(orig, m_readUnsupportedAttr);
 
     parent->AddChild(vrvOrig);
     ReadUnsupportedAttr(orig, vrvOrig);
@@ -5533,7 +5536,7 @@ bool MEIInput::ReadRdg(Object *parent, pugi::xml_node rdg, EditorialLevel level,
     vrvRdg->m_visibility = Hidden;
     ReadEditorialElement(rdg, vrvRdg);
 
-    vrvRdg->ReadSource(rdg);
+    vrvRdg->ReadSource(rdg, m_readUnsupportedAttr);
 
     parent->AddChild(vrvRdg);
     ReadUnsupportedAttr(rdg, vrvRdg);
@@ -5555,7 +5558,7 @@ bool MEIInput::ReadReg(Object *parent, pugi::xml_node reg, EditorialLevel level,
     Reg *vrvReg = new Reg();
     ReadEditorialElement(reg, vrvReg);
 
-    vrvReg->ReadSource(reg);
+    vrvReg->ReadSource(reg, m_readUnsupportedAttr);
 
     parent->AddChild(vrvReg);
     ReadUnsupportedAttr(reg, vrvReg);
@@ -5567,7 +5570,7 @@ bool MEIInput::ReadRestore(Object *parent, pugi::xml_node restore, EditorialLeve
     Restore *vrvRestore = new Restore();
     ReadEditorialElement(restore, vrvRestore);
 
-    vrvRestore->ReadSource(restore);
+    vrvRestore->ReadSource(restore, m_readUnsupportedAttr);
 
     parent->AddChild(vrvRestore);
     ReadUnsupportedAttr(restore, vrvRestore);
@@ -5579,7 +5582,7 @@ bool MEIInput::ReadSic(Object *parent, pugi::xml_node sic, EditorialLevel level,
     Sic *vrvSic = new Sic();
     ReadEditorialElement(sic, vrvSic);
 
-    vrvSic->ReadSource(sic);
+    vrvSic->ReadSource(sic, m_readUnsupportedAttr);
 
     parent->AddChild(vrvSic);
     ReadUnsupportedAttr(sic, vrvSic);
@@ -5664,7 +5667,7 @@ bool MEIInput::ReadSupplied(Object *parent, pugi::xml_node supplied, EditorialLe
     Supplied *vrvSupplied = new Supplied();
     ReadEditorialElement(supplied, vrvSupplied);
 
-    vrvSupplied->ReadSource(supplied);
+    vrvSupplied->ReadSource(supplied, m_readUnsupportedAttr);
 
     parent->AddChild(vrvSupplied);
     ReadUnsupportedAttr(supplied, vrvSupplied);
@@ -5676,7 +5679,7 @@ bool MEIInput::ReadUnclear(Object *parent, pugi::xml_node unclear, EditorialLeve
     Unclear *vrvUnclear = new Unclear();
     ReadEditorialElement(unclear, vrvUnclear);
 
-    vrvUnclear->ReadSource(unclear);
+    vrvUnclear->ReadSource(unclear, m_readUnsupportedAttr);
 
     parent->AddChild(vrvUnclear);
     ReadUnsupportedAttr(unclear, vrvUnclear);
@@ -5791,7 +5794,7 @@ bool MEIInput::ReadTupletSpanAsTuplet(Measure *measure, pugi::xml_node tupletSpa
         return false;
     }
 
-    Layer *parentLayer = dynamic_cast<Layer *>(startChild->GetParent());
+    Layer *parentLayer = vrv_cast<Layer *>(startChild->GetParent());
     assert(parentLayer);
 
     int startIdx = startChild->GetIdx();
@@ -5910,8 +5913,8 @@ void MEIInput::UpgradeMordentTo_4_0_0(pugi::xml_node mordent, Mordent *vrvMorden
 
 void MEIInput::UpgradeScoreDefElementTo_4_0_0(pugi::xml_node scoreDefElement, ScoreDefElement *vrvScoreDefElement)
 {
-    KeySig *keySig = dynamic_cast<KeySig *>(vrvScoreDefElement->FindDescendantByType(KEYSIG));
-    MeterSig *meterSig = dynamic_cast<MeterSig *>(vrvScoreDefElement->FindDescendantByType(METERSIG));
+    KeySig *keySig = vrv_cast<KeySig *>(vrvScoreDefElement->FindDescendantByType(KEYSIG));
+    MeterSig *meterSig = vrv_cast<MeterSig *>(vrvScoreDefElement->FindDescendantByType(METERSIG));
 
     if (scoreDefElement.attribute("key.sig.show")) {
         if (keySig) {
@@ -6012,7 +6015,7 @@ void MEIInput::UpgradeMeasureTo_3_0_0(Measure *measure, System *system)
     if (system->m_systemRightMar == VRV_UNSET) return;
     if (system->m_systemRightMar == VRV_UNSET) return;
 
-    Page *page = dynamic_cast<Page *>(system->GetFirstAncestor(PAGE));
+    Page *page = vrv_cast<Page *>(system->GetFirstAncestor(PAGE));
     assert(page);
     measure->m_xAbs = system->m_systemLeftMar;
     measure->m_xAbs2 = page->m_pageWidth - system->m_systemRightMar;
@@ -6035,8 +6038,8 @@ bool MEIInput::ReadSurface(Facsimile *parent, pugi::xml_node surface)
     assert(parent);
     Surface *vrvSurface = new Surface();
     SetMeiUuid(surface, vrvSurface);
-    vrvSurface->ReadCoordinated(surface);
-    vrvSurface->ReadTyped(surface);
+    vrvSurface->ReadCoordinated(surface, m_readUnsupportedAttr);
+    vrvSurface->ReadTyped(surface, m_readUnsupportedAttr);
 
     for (pugi::xml_node child = surface.first_child(); child; child = child.next_sibling()) {
         if (strcmp(child.name(), "zone") == 0) {
@@ -6055,8 +6058,8 @@ bool MEIInput::ReadZone(Surface *parent, pugi::xml_node zone)
     assert(parent);
     Zone *vrvZone = new Zone();
     SetMeiUuid(zone, vrvZone);
-    vrvZone->ReadCoordinated(zone);
-    vrvZone->ReadTyped(zone);
+    vrvZone->ReadCoordinated(zone, m_readUnsupportedAttr);
+    vrvZone->ReadTyped(zone, m_readUnsupportedAttr);
     parent->AddChild(vrvZone);
     return true;
 }
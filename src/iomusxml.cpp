@@ -141,15 +141,42 @@ std::string MusicXmlInput::GetContent(pugi::xml_node node)
     return "";
 }
 
-std::string MusicXmlInput::GetContentOfChild(pugi::xml_node node, std::string child)
+std::string MusicXmlInput::GetContentOfChild(pugi::xml_node node, const std::string &child)
 {
-    pugi::xpath_node childNode = node.select_node(child.c_str());
-    if (childNode.node()) {
-        return GetContent(childNode.node());
+    pugi::xml_node childNode;
+    // A plain element name does not need to be evaluated as an XPath query
+    if (child.find_first_of("/[@(|:*.") == std::string::npos) {
+        childNode = node.child(child.c_str());
+    }
+    else {
+        childNode = node.select_node(GetXPathQuery(child)).node();
+    }
+    if (childNode) {
+        return GetContent(childNode);
     }
     return "";
 }
 
+const pugi::xpath_query &MusicXmlInput::GetXPathQuery(const std::string &query)
+{
+    // The query is compiled only when it is not in the map yet
+    return m_xpathQueries.try_emplace(query, query.c_str()).first->second;
+}
+
+Measure *MusicXmlInput::GetMeasureByN(const std::string &measureN)
+{
+    auto iter = m_measuresByN.find(measureN);
+    return (iter != m_measuresByN.end()) ? iter->second : NULL;
+}
+
+bool MusicXmlInput::IsInFirstPart(pugi::xml_node node)
+{
+    for (pugi::xml_node ancestor = node.parent(); ancestor; ancestor = ancestor.parent()) {
+        if (IsElement(ancestor, "part") && !ancestor.previous_sibling("part")) return true;
+    }
+    return false;
+}
+
 void MusicXmlInput::AddMeasure(Section *section, Measure *measure, int i)
 {
     assert(section);
@@ -158,17 +185,18 @@ void MusicXmlInput::AddMeasure(Section *section, Measure *measure, int i)
     // we just need to add a measure
     if (section->GetChildCount(MEASURE) <= i) {
         section->AddChild(measure);
+        // keep only the first measure with a given @n, as a search in the section would return
+        m_measuresByN.emplace(measure->GetN(), measure);
     }
     // otherwise copy the content to the corresponding existing measure
     else {
-        AttNNumberLikeComparison comparisonMeasure(MEASURE, measure->GetN());
-        Measure *existingMeasure = dynamic_cast<Measure *>(section->FindDescendantByComparison(&comparisonMeasure, 1));
+        Measure *existingMeasure = this->GetMeasureByN(measure->GetN());
         assert(existingMeasure);
         for (auto current : *measure->GetChildren()) {
             if (!current->Is(STAFF)) {
                 continue;
             }
-            Staff *staff = dynamic_cast<Staff *>(measure->Relinquish(current->GetIdx()));
+            Staff *staff = vrv_cast<Staff *>(measure->Relinquish(current->GetIdx()));
             assert(staff);
             existingMeasure->AddChild(staff);
         }
@@ -225,7 +253,7 @@ Layer *MusicXmlInput::SelectLayer(pugi::xml_node node, Measure *measure)
         if (!item->Is(STAFF)) {
             continue;
         }
-        Staff *staff = dynamic_cast<Staff *>(item);
+        Staff *staff = vrv_cast<Staff *>(item);
         assert(staff);
         for (auto layer : *staff->GetChildren()) {
             assert(layer);
@@ -246,7 +274,7 @@ Layer *MusicXmlInput::SelectLayer(pugi::xml_node node, Measure *measure)
         staffNum = 1;
     }
     staffNum--;
-    Staff *staff = dynamic_cast<Staff *>(measure->GetChild(staffNum, STAFF));
+    Staff *staff = vrv_cast<Staff *>(measure->GetChild(staffNum, STAFF));
     assert(staff);
     return SelectLayer(layerNum, staff);
 }
@@ -254,7 +282,7 @@ Layer *MusicXmlInput::SelectLayer(pugi::xml_node node, Measure *measure)
 Layer *MusicXmlInput::SelectLayer(int staffNum, Measure *measure)
 {
     staffNum--;
-    Staff *staff = dynamic_cast<Staff *>(measure->GetChild(staffNum, STAFF));
+    Staff *staff = vrv_cast<Staff *>(measure->GetChild(staffNum, STAFF));
     assert(staff);
     // layer -1 means the first one
     return SelectLayer(-1, staff);
@@ -446,12 +474,12 @@ void MusicXmlInput::PrintMetronome(pugi::xml_node metronome, Tempo *tempo)
         tempo->AddChild(text);
     }
 
-    int dotCount = (int)metronome.select_nodes("beat-unit-dot").size();
+    int dotCount = (int)metronome.select_nodes(GetXPathQuery("beat-unit-dot")).size();
     if (dotCount) {
         tempo->SetMmDots(dotCount);
     }
 
-    pugi::xml_node beatunit = metronome.select_node("beat-unit").node();
+    pugi::xml_node beatunit = metronome.child("beat-unit");
     if (beatunit) {
         std::wstring verovioText;
         std::string content = GetContent(beatunit);
@@ -471,7 +499,7 @@ void MusicXmlInput::PrintMetronome(pugi::xml_node metronome, Tempo *tempo)
     }
 
     rawText = "";
-    pugi::xml_node perminute = metronome.select_node("per-minute").node();
+    pugi::xml_node perminute = metronome.child("per-minute");
     if (perminute) {
         std::string mm = GetContent(perminute);
         double mmval = 0.0;
@@ -542,6 +570,12 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
     pugi::xpath_node scoreMidiBpm = root.select_node("/score-partwise/part[1]/measure[1]/sound[@tempo][1]");
     if (scoreMidiBpm) m_doc->m_scoreDef.SetMidiBpm(scoreMidiBpm.node().attribute("tempo").as_int());
 
+    // map the parts by id in a single pass instead of looking for each of them in the document
+    std::map<std::string, pugi::xml_node> parts;
+    for (pugi::xml_node part : root.root().child("score-partwise").children("part")) {
+        parts.emplace(part.attribute("id").as_string(), part);
+    }
+
     pugi::xpath_node_set partListChildren = root.select_nodes("/score-partwise/part-list/*");
     for (pugi::xpath_node_set::const_iterator it = partListChildren.begin(); it != partListChildren.end(); ++it) {
         pugi::xpath_node xpathNode = *it;
@@ -574,27 +608,27 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
         else if (IsElement(xpathNode.node(), "score-part")) {
             // get the attributes element of the first measure of the part
             std::string partId = xpathNode.node().attribute("id").as_string();
-            std::string xpath = StringFormat("/score-partwise/part[@id='%s']/measure[1]", partId.c_str());
-            pugi::xpath_node partFirstMeasure = root.select_node(xpath.c_str());
-            if (!partFirstMeasure.node().select_node("attributes")) {
+            pugi::xml_node part = (parts.count(partId) > 0) ? parts.at(partId) : pugi::xml_node();
+            pugi::xpath_node partFirstMeasure = part.child("measure");
+            if (!partFirstMeasure.node().child("attributes")) {
                 LogWarning("MusicXML import: Could not find the 'attributes' element in the first "
                            "measure of part '%s'",
                     partId.c_str());
                 continue;
             }
-            int staves = partFirstMeasure.node().select_node("attributes/staves").node().text().as_int();
+            int staves = partFirstMeasure.node().select_node(GetXPathQuery("attributes/staves")).node().text().as_int();
             Label *label = NULL;
             LabelAbbr *labelAbbr = NULL;
             InstrDef *instrdef = NULL;
             // part-name should be revised, as soon MEI can suppress labels
             std::string partName = GetContentOfChild(xpathNode.node(), "part-name[not(@print-object='no')]");
             std::string partAbbr = GetContentOfChild(xpathNode.node(), "part-abbreviation[not(@print-object='no')]");
-            pugi::xpath_node midiInstrument = xpathNode.node().select_node("midi-instrument");
-            pugi::xpath_node midiChannel = midiInstrument.node().select_node("midi-channel");
-            pugi::xpath_node midiName = midiInstrument.node().select_node("midi-name");
-            // pugi::xpath_node midiPan = midiInstrument.node().select_node("pan");
-            pugi::xpath_node midiProgram = midiInstrument.node().select_node("midi-program");
-            pugi::xpath_node midiVolume = midiInstrument.node().select_node("volume");
+            pugi::xpath_node midiInstrument = xpathNode.node().child("midi-instrument");
+            pugi::xpath_node midiChannel = midiInstrument.node().child("midi-channel");
+            pugi::xpath_node midiName = midiInstrument.node().child("midi-name");
+            // pugi::xpath_node midiPan = midiInstrument.node().child("pan");
+            pugi::xpath_node midiProgram = midiInstrument.node().child("midi-program");
+            pugi::xpath_node midiVolume = midiInstrument.node().child("volume");
             if (!partName.empty()) {
                 label = new Label();
                 Text *text = new Text();
@@ -631,7 +665,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
                 m_staffGrpStack.back()->AddChild(partStaffGrp);
             }
             else {
-                StaffDef *staffDef = dynamic_cast<StaffDef *>(partStaffGrp->FindDescendantByType(STAFFDEF));
+                StaffDef *staffDef = vrv_cast<StaffDef *>(partStaffGrp->FindDescendantByType(STAFFDEF));
                 if (staffDef) {
                     if (label) staffDef->AddChild(label);
                     if (labelAbbr) staffDef->AddChild(labelAbbr);
@@ -641,14 +675,12 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
                 delete partStaffGrp;
             }
 
-            // find the part and read it
-            xpath = StringFormat("/score-partwise/part[@id='%s']", partId.c_str());
-            pugi::xpath_node part = root.select_node(xpath.c_str());
+            // read the part
             if (!part) {
                 LogWarning("MusicXML import: Could not find the part '%s'", partId.c_str());
                 continue;
             }
-            ReadMusicXmlPart(part.node(), section, nbStaves, staffOffset);
+            ReadMusicXmlPart(part, section, nbStaves, staffOffset);
             // increment the staffOffset for reading the next part
             staffOffset += nbStaves;
         }
@@ -662,8 +694,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
     std::vector<std::pair<std::string, ControlElement *> >::iterator iter;
     for (iter = m_controlElements.begin(); iter != m_controlElements.end(); ++iter) {
         if (!measure || (measure->GetN() != iter->first)) {
-            AttNNumberLikeComparison comparisonMeasure(MEASURE, iter->first);
-            measure = dynamic_cast<Measure *>(section->FindDescendantByComparison(&comparisonMeasure, 1));
+            measure = this->GetMeasureByN(iter->first);
         }
         if (!measure) {
             LogWarning("MusicXML import: Element '%s' could not be added to measure '%s'",
@@ -803,7 +834,7 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
         if (IsElement(*it, "attributes")) it->set_name("mei-read");
 
         // First get the number of staves in the part
-        pugi::xpath_node staves = it->select_node("staves");
+        pugi::xpath_node staves = it->child("staves");
         if (staves) {
             nbStaves = staves.node().text().as_int();
         }
@@ -827,10 +858,10 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
             Clef *clef = NULL;
             pugi::xpath_node clefSign;
             xpath = StringFormat("clef[@number='%d']/sign", i + 1);
-            clefSign = it->select_node(xpath.c_str());
+            clefSign = it->select_node(GetXPathQuery(xpath));
             // if not, look at a common one
             if (!clefSign) {
-                clefSign = it->select_node("clef/sign");
+                clefSign = it->select_node(GetXPathQuery("clef/sign"));
             }
             if (clefSign.node().text()) {
                 if (!clef) clef = new Clef();
@@ -839,9 +870,9 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
             // clef line
             pugi::xpath_node clefLine;
             xpath = StringFormat("clef[@number='%d']/line", i + 1);
-            clefLine = it->select_node(xpath.c_str());
+            clefLine = it->select_node(GetXPathQuery(xpath));
             if (!clefLine) {
-                clefLine = it->select_node("clef/line");
+                clefLine = it->select_node(GetXPathQuery("clef/line"));
             }
             if (clefLine.node().text()) {
                 if (!clef) clef = new Clef();
@@ -850,9 +881,9 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
             // clef octave change
             pugi::xpath_node clefOctaveChange;
             xpath = StringFormat("clef[@number='%d']/clef-octave-change", i + 1);
-            clefOctaveChange = it->select_node(xpath.c_str());
+            clefOctaveChange = it->select_node(GetXPathQuery(xpath));
             if (!clefOctaveChange) {
-                clefOctaveChange = it->select_node("clef/clef-octave-change");
+                clefOctaveChange = it->select_node(GetXPathQuery("clef/clef-octave-change"));
             }
             if (clefOctaveChange.node().text()) {
                 int change = clefOctaveChange.node().text().as_int();
@@ -876,14 +907,14 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
             // key sig
             KeySig *keySig = NULL;
             xpath = StringFormat("key[@number='%d']", i + 1);
-            pugi::xpath_node key = it->select_node(xpath.c_str());
+            pugi::xpath_node key = it->select_node(GetXPathQuery(xpath));
             if (!key) {
-                key = it->select_node("key");
+                key = it->child("key");
             }
             if (key) {
                 if (!keySig) keySig = new KeySig();
-                if (key.node().select_node("fifths")) {
-                    int fifths = atoi(key.node().select_node("fifths").node().text().as_string());
+                if (key.node().child("fifths")) {
+                    int fifths = atoi(key.node().child("fifths").text().as_string());
                     std::string keySigStr;
                     if (fifths < 0)
                         keySigStr = StringFormat("%df", abs(fifths));
@@ -911,9 +942,9 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
                         keySig->AddChild(keyAccid);
                     }
                 }
-                if (key.node().select_node("mode")) {
+                if (key.node().child("mode")) {
                     keySig->SetMode(
-                        keySig->AttKeySigLog::StrToMode(key.node().select_node("mode").node().text().as_string()));
+                        keySig->AttKeySigLog::StrToMode(key.node().child("mode").text().as_string()));
                 }
             }
             // add it if necessary
@@ -924,22 +955,22 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
             // staff details
             pugi::xpath_node staffDetails;
             xpath = StringFormat("staff-details[@number='%d']", i + 1);
-            staffDetails = it->select_node(xpath.c_str());
+            staffDetails = it->select_node(GetXPathQuery(xpath));
             if (!staffDetails) {
-                staffDetails = it->select_node("staff-details");
+                staffDetails = it->child("staff-details");
             }
-            int staffLines = staffDetails.node().select_node("staff-lines").node().text().as_int();
+            int staffLines = staffDetails.node().child("staff-lines").text().as_int();
             if (staffLines) {
                 staffDef->SetLines(staffLines);
             }
             else if (!staffDef->HasLines()) {
                 staffDef->SetLines(5);
             }
-            std::string scaleStr = staffDetails.node().select_node("staff-size").node().text().as_string();
+            std::string scaleStr = staffDetails.node().child("staff-size").text().as_string();
             if (!scaleStr.empty()) {
                 staffDef->SetScale(staffDef->AttScalable::StrToPercent(scaleStr + "%"));
             }
-            pugi::xpath_node staffTuning = staffDetails.node().select_node("staff-tuning");
+            pugi::xpath_node staffTuning = staffDetails.node().child("staff-tuning");
             if (staffTuning) {
                 staffDef->SetNotationtype(NOTATIONTYPE_tab);
             }
@@ -948,9 +979,9 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
             MeterSig *meterSig = NULL;
             pugi::xpath_node time;
             xpath = StringFormat("time[@number='%d']", i + 1);
-            time = it->select_node(xpath.c_str());
+            time = it->select_node(GetXPathQuery(xpath));
             if (!time) {
-                time = it->select_node("time");
+                time = it->child("time");
             }
             if (time) {
                 if (!meterSig) meterSig = new MeterSig();
@@ -963,10 +994,10 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
                     else
                         meterSig->SetForm(METERFORM_norm);
                 }
-                if (time.node().select_nodes("beats").size() > 1) {
+                if (time.node().select_nodes(GetXPathQuery("beats")).size() > 1) {
                     LogWarning("MusicXML import: Compound meter signatures are not supported");
                 }
-                pugi::xpath_node beats = time.node().select_node("beats");
+                pugi::xpath_node beats = time.node().child("beats");
                 if (beats.node().text()) {
                     m_meterCount = beats.node().text().as_int();
                     // staffDef->AttMeterSigDefaultLog::StrToInt(beats.node().text().as_string());
@@ -978,7 +1009,7 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
                     }
                     meterSig->SetCount(m_meterCount);
                 }
-                pugi::xpath_node beatType = time.node().select_node("beat-type");
+                pugi::xpath_node beatType = time.node().child("beat-type");
                 if (beatType.node().text()) {
                     m_meterUnit = beatType.node().text().as_int();
                     meterSig->SetUnit(m_meterUnit);
@@ -994,22 +1025,22 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
             // transpose
             pugi::xpath_node transpose;
             xpath = StringFormat("transpose[@number='%d']", i + 1);
-            transpose = it->select_node(xpath.c_str());
+            transpose = it->select_node(GetXPathQuery(xpath));
             if (!transpose) {
-                transpose = it->select_node("transpose");
+                transpose = it->child("transpose");
             }
             if (transpose) {
                 staffDef->SetTransDiat(atoi(GetContentOfChild(transpose.node(), "diatonic").c_str()));
                 staffDef->SetTransSemi(atoi(GetContentOfChild(transpose.node(), "chromatic").c_str()));
             }
             // ppq
-            pugi::xpath_node divisions = it->select_node("divisions");
+            pugi::xpath_node divisions = it->child("divisions");
             if (divisions) {
                 m_ppq = divisions.node().text().as_int();
                 staffDef->SetPpq(m_ppq);
             }
             // measure style
-            pugi::xpath_node measureSlash = it->select_node("measure-style/slash");
+            pugi::xpath_node measureSlash = it->select_node(GetXPathQuery("measure-style/slash"));
             if (measureSlash) {
                 if (HasAttributeWithValue(measureSlash.node(), "type", "start"))
                     m_slash = true;
@@ -1027,22 +1058,20 @@ bool MusicXmlInput::ReadMusicXmlPart(pugi::xml_node node, Section *section, int
     assert(node);
     assert(section);
 
-    pugi::xpath_node_set measures = node.select_nodes("measure");
-    if (measures.size() == 0) {
+    if (!node.child("measure")) {
         LogWarning("MusicXML import: No measure to load");
         return false;
     }
 
     int i = 0;
-    for (pugi::xpath_node_set::const_iterator it = measures.begin(); it != measures.end(); ++it) {
-        pugi::xpath_node xmlMeasure = *it;
+    for (pugi::xml_node xmlMeasure : node.children("measure")) {
         if (m_multiRest != 0) {
             m_multiRest--;
         }
         else {
             Measure *measure = new Measure();
             m_measureCounts[measure] = i;
-            ReadMusicXmlMeasure(xmlMeasure.node(), section, measure, nbStaves, staffOffset);
+            ReadMusicXmlMeasure(xmlMeasure, section, measure, nbStaves, staffOffset);
             // Add the measure to the system - if already there from a previous part we'll just merge the content
             AddMeasure(section, measure, i);
         }
@@ -1134,8 +1163,9 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
     // read the content of the measure
     for (pugi::xml_node::iterator it = node.begin(); it != node.end(); ++it) {
         // first check if there is a multi measure rest
-        if (it->select_node(".//multiple-rest")) {
-            m_multiRest = it->select_node(".//multiple-rest").node().text().as_int();
+        pugi::xpath_node multipleRest = it->select_node(GetXPathQuery(".//multiple-rest"));
+        if (multipleRest) {
+            m_multiRest = multipleRest.node().text().as_int();
             MultiRest *multiRest = new MultiRest;
             multiRest->SetNum(m_multiRest);
             Layer *layer = SelectLayer(1, measure);
@@ -1168,7 +1198,7 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
             ReadMusicXmlNote(*it, measure, measureNum, staffOffset, section);
         }
         // for now only check first part
-        else if (IsElement(*it, "print") && node.select_node("parent::part[not(preceding-sibling::part)]")) {
+        else if (IsElement(*it, "print") && IsInFirstPart(*it)) {
             ReadMusicXmlPrint(*it, section);
         }
     }
@@ -1246,21 +1276,21 @@ void MusicXmlInput::ReadMusicXmlAttributes(
     assert(measure);
 
     // read clef changes as MEI clef and add them to the stack
-    pugi::xpath_node clef = node.select_node("clef");
+    pugi::xpath_node clef = node.child("clef");
     if (clef) {
         // check if we have a staff number
         int staffNum = clef.node().attribute("number").as_int();
         staffNum = (staffNum < 1) ? 1 : staffNum;
-        Staff *staff = dynamic_cast<Staff *>(measure->GetChild(staffNum - 1));
+        Staff *staff = vrv_cast<Staff *>(measure->GetChild(staffNum - 1));
         assert(staff);
-        pugi::xpath_node clefSign = clef.node().select_node("sign");
-        pugi::xpath_node clefLine = clef.node().select_node("line");
+        pugi::xpath_node clefSign = clef.node().child("sign");
+        pugi::xpath_node clefLine = clef.node().child("line");
         if (clefSign && clefLine) {
             Clef *meiClef = new Clef();
             meiClef->SetShape(meiClef->AttClefShape::StrToClefshape(clefSign.node().text().as_string()));
             meiClef->SetLine(meiClef->AttClefShape::StrToInt(clefLine.node().text().as_string()));
             // clef octave change
-            pugi::xpath_node clefOctaveChange = clef.node().select_node("clef-octave-change");
+            pugi::xpath_node clefOctaveChange = clef.node().child("clef-octave-change");
             if (clefOctaveChange.node().text()) {
                 int change = clefOctaveChange.node().text().as_int();
                 if (abs(change) == 1)
@@ -1280,15 +1310,15 @@ void MusicXmlInput::ReadMusicXmlAttributes(
     }
 
     // key and time change
-    pugi::xpath_node key = node.select_node("key");
-    pugi::xpath_node time = node.select_node("time");
+    pugi::xpath_node key = node.child("key");
+    pugi::xpath_node time = node.child("time");
     // for now only read first part and make it change in scoreDef
-    if ((key || time) && node.select_node("ancestor::part[not(preceding-sibling::part)]")) {
+    if ((key || time) && IsInFirstPart(node)) {
         ScoreDef *scoreDef = new ScoreDef();
         KeySig *keySig = NULL;
-        if (key.node().select_node("fifths")) {
+        if (key.node().child("fifths")) {
             if (!keySig) keySig = new KeySig();
-            int fifths = key.node().select_node("fifths").node().text().as_int();
+            int fifths = key.node().child("fifths").text().as_int();
             std::string keySigStr;
             if (fifths < 0)
                 keySigStr = StringFormat("%df", abs(fifths));
@@ -1317,9 +1347,9 @@ void MusicXmlInput::ReadMusicXmlAttributes(
                 keySig->AddChild(keyAccid);
             }
         }
-        if (key.node().select_node("mode")) {
+        if (key.node().child("mode")) {
             if (!keySig) keySig = new KeySig();
-            keySig->SetMode(keySig->AttKeySigLog::StrToMode(key.node().select_node("mode").node().text().as_string()));
+            keySig->SetMode(keySig->AttKeySigLog::StrToMode(key.node().child("mode").text().as_string()));
         }
         // Add it if necessary
         if (keySig) {
@@ -1340,10 +1370,10 @@ void MusicXmlInput::ReadMusicXmlAttributes(
                 else
                     meterSig->SetForm(METERFORM_norm);
             }
-            if (time.node().select_nodes("beats").size() > 1) {
+            if (time.node().select_nodes(GetXPathQuery("beats")).size() > 1) {
                 LogWarning("MusicXML import: Compound meter signatures are not supported");
             }
-            pugi::xpath_node beats = time.node().select_node("beats");
+            pugi::xpath_node beats = time.node().child("beats");
             if (beats.node().text()) {
                 if (!meterSig) meterSig = new MeterSig();
                 m_meterCount = beats.node().text().as_int();
@@ -1356,7 +1386,7 @@ void MusicXmlInput::ReadMusicXmlAttributes(
                 }
                 meterSig->SetCount(m_meterCount);
             }
-            pugi::xpath_node beatType = time.node().select_node("beat-type");
+            pugi::xpath_node beatType = time.node().child("beat-type");
             if (beatType.node().text()) {
                 if (!meterSig) meterSig = new MeterSig();
                 m_meterUnit = beatType.node().text().as_int();
@@ -1373,8 +1403,8 @@ void MusicXmlInput::ReadMusicXmlAttributes(
         section->AddChild(scoreDef);
     }
 
-    pugi::xpath_node measureRepeat = node.select_node("measure-style/measure-repeat");
-    pugi::xpath_node measureSlash = node.select_node("measure-style/slash");
+    pugi::xpath_node measureRepeat = node.select_node(GetXPathQuery("measure-style/measure-repeat"));
+    pugi::xpath_node measureSlash = node.select_node(GetXPathQuery("measure-style/slash"));
     if (measureRepeat) {
         if (HasAttributeWithValue(measureRepeat.node(), "type", "start"))
             m_mRpt = true;
@@ -1402,11 +1432,11 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, s
     assert(node);
     assert(measure);
 
-    Staff *staff = dynamic_cast<Staff *>(measure->GetFirst(STAFF));
+    Staff *staff = vrv_cast<Staff *>(measure->GetFirst(STAFF));
     assert(staff);
 
     std::string barStyle = GetContentOfChild(node, "bar-style");
-    pugi::xpath_node repeat = node.select_node("repeat");
+    pugi::xpath_node repeat = node.child("repeat");
     if (!barStyle.empty()) {
         data_BARRENDITION barRendition = ConvertStyleToRend(barStyle, repeat);
         if (HasAttributeWithValue(node, "location", "left")) {
@@ -1440,7 +1470,7 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, s
     }
 
     // parse endings (prima volta, seconda volta...)
-    pugi::xpath_node ending = node.select_node("ending");
+    pugi::xpath_node ending = node.child("ending");
     if (ending) {
         std::string endingNumber = ending.node().attribute("number").as_string();
         std::string endingType = ending.node().attribute("type").as_string();
@@ -1464,7 +1494,7 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, s
     }
 
     // fermatas
-    pugi::xpath_node xmlFermata = node.select_node("fermata");
+    pugi::xpath_node xmlFermata = node.child("fermata");
     if (xmlFermata) {
         Fermata *fermata = new Fermata();
         m_controlElements.push_back(std::make_pair(measureNum, fermata));
@@ -1500,16 +1530,16 @@ void MusicXmlInput::ReadMusicXmlDirection(
     assert(node);
     assert(measure);
 
-    pugi::xpath_node type = node.select_node("direction-type");
+    pugi::xpath_node type = node.child("direction-type");
     pugi::xpath_node extender = type.node().next_sibling("direction-type").first_child();
     std::string placeStr = node.attribute("placement").as_string();
-    int offset = node.select_node("offset").node().text().as_int();
+    int offset = node.child("offset").text().as_int();
     double timeStamp = (double)(m_durTotal + offset) * (double)m_meterUnit / (double)(4 * m_ppq) + 1.0;
-    pugi::xpath_node voice = node.select_node("voice");
+    pugi::xpath_node voice = node.child("voice");
     if (voice) m_prevLayer = SelectLayer(node, measure);
 
     // Bracket
-    pugi::xpath_node bracket = type.node().select_node("bracket");
+    pugi::xpath_node bracket = type.node().child("bracket");
     if (bracket) {
         int voiceNumber = bracket.node().attribute("number").as_int();
         voiceNumber = (voiceNumber < 1) ? 1 : voiceNumber;
@@ -1545,8 +1575,8 @@ void MusicXmlInput::ReadMusicXmlDirection(
     // Directive
     std::string dynamStr = ""; // string containing dynamics information
     int defaultY = 0; // y position attribute, only for directives and dynamics
-    pugi::xpath_node_set words = type.node().select_nodes("words");
-    if (words.size() != 0 && !node.select_node("sound[@tempo]")) {
+    pugi::xpath_node_set words = type.node().select_nodes(GetXPathQuery("words"));
+    if (words.size() != 0 && !node.select_node(GetXPathQuery("sound[@tempo]"))) {
         defaultY = words.first().node().attribute("default-y").as_int();
         std::string wordStr = words.first().node().text().as_string();
         if (wordStr.rfind("cresc", 0) == 0 || wordStr.rfind("dim", 0) == 0 || wordStr.rfind("decresc", 0) == 0) {
@@ -1559,7 +1589,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
             }
             dir->SetPlace(dir->AttPlacement::StrToStaffrel(placeStr.c_str()));
             dir->SetTstamp(timeStamp);
-            pugi::xpath_node staffNode = node.select_node("staff");
+            pugi::xpath_node staffNode = node.child("staff");
             if (staffNode) {
                 dir->SetStaff(dir->AttStaffIdent::StrToXsdPositiveIntegerList(
                     std::to_string(staffNode.node().text().as_int() + staffOffset)));
@@ -1589,7 +1619,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Dynamics
-    pugi::xpath_node dynamics = type.node().select_node("dynamics");
+    pugi::xpath_node dynamics = type.node().child("dynamics");
     if (dynamics || !dynamStr.empty()) {
         if (dynamStr.empty()) dynamStr = GetContentOfChild(dynamics.node(), "other-dynamics");
         if (dynamStr.empty()) dynamStr = dynamics.node().first_child().name();
@@ -1599,7 +1629,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
         text->SetText(UTF8to16(dynamStr));
         dynam->AddChild(text);
         dynam->SetTstamp(timeStamp);
-        pugi::xpath_node staffNode = node.select_node("staff");
+        pugi::xpath_node staffNode = node.child("staff");
         if (staffNode) {
             dynam->SetStaff(dynam->AttStaffIdent::StrToXsdPositiveIntegerList(
                 std::to_string(staffNode.node().text().as_int() + staffOffset)));
@@ -1629,12 +1659,12 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Dashes (to be connected with previous <dir> or <dynam> as @extender and @tstamp2 attribute
-    pugi::xpath_node dashes = type.node().select_node("bracket|dashes");
+    pugi::xpath_node dashes = type.node().select_node(GetXPathQuery("bracket|dashes"));
     if (dashes) {
         int dashesNumber = dashes.node().attribute("number").as_int();
         dashesNumber = (dashesNumber < 1) ? 1 : dashesNumber;
         int staffNum = 1;
-        pugi::xpath_node staffNode = node.select_node("staff");
+        pugi::xpath_node staffNode = node.child("staff");
         if (staffNode) staffNum = staffNode.node().text().as_int() + staffOffset;
         if (HasAttributeWithValue(dashes.node(), "type", "stop")) {
             std::vector<std::pair<ControlElement *, musicxml::OpenDashes> >::iterator iter;
@@ -1692,7 +1722,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Hairpins
-    pugi::xpath_node wedge = type.node().select_node("wedge");
+    pugi::xpath_node wedge = type.node().child("wedge");
     if (wedge) {
         int hairpinNumber = wedge.node().attribute("number").as_int();
         hairpinNumber = (hairpinNumber < 1) ? 1 : hairpinNumber;
@@ -1723,7 +1753,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
             hairpin->SetColor(wedge.node().attribute("color").as_string());
             hairpin->SetPlace(hairpin->AttPlacement::StrToStaffrel(placeStr.c_str()));
             hairpin->SetTstamp(timeStamp);
-            pugi::xpath_node staffNode = node.select_node("staff");
+            pugi::xpath_node staffNode = node.child("staff");
             if (staffNode) {
                 hairpin->SetStaff(hairpin->AttStaffIdent::StrToXsdPositiveIntegerList(
                     std::to_string(staffNode.node().text().as_int() + staffOffset)));
@@ -1738,7 +1768,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
                 if (std::get<2>(*iter).m_dirN == hairpinNumber) {
                     int measureDifference = std::get<2>(*iter).m_lastMeasureCount - m_measureCounts.at(measure);
                     hairpin->SetTstamp2(std::pair<int, double>(measureDifference, std::get<1>(*iter)));
-                    Staff *staff = dynamic_cast<Staff *>(measure->FindDescendantByType(STAFF));
+                    Staff *staff = vrv_cast<Staff *>(measure->FindDescendantByType(STAFF));
                     assert(staff);
                     hairpin->SetStaff(
                         staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(std::get<0>(*iter))));
@@ -1754,9 +1784,9 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Ottava
-    pugi::xpath_node xmlShift = type.node().select_node("octave-shift");
+    pugi::xpath_node xmlShift = type.node().child("octave-shift");
     if (xmlShift) {
-        pugi::xpath_node staffNode = node.select_node("staff");
+        pugi::xpath_node staffNode = node.child("staff");
         int staffN = (!staffNode) ? 1 : staffNode.node().text().as_int() + staffOffset;
         if (HasAttributeWithValue(xmlShift.node(), "type", "stop")) {
             m_octDis[staffN] = 0;
@@ -1792,7 +1822,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Pedal
-    pugi::xpath_node xmlPedal = type.node().select_node("pedal");
+    pugi::xpath_node xmlPedal = type.node().child("pedal");
     if (xmlPedal) {
         std::string pedalType = xmlPedal.node().attribute("type").as_string();
         std::string pedalLine = xmlPedal.node().attribute("line").as_string();
@@ -1802,7 +1832,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
             pedal->SetTstamp(timeStamp);
             if (!placeStr.empty()) pedal->SetPlace(pedal->AttPlacement::StrToStaffrel(placeStr.c_str()));
             if (!pedalType.empty()) pedal->SetDir(ConvertPedalTypeToDir(pedalType));
-            pugi::xpath_node staffNode = node.select_node("staff");
+            pugi::xpath_node staffNode = node.child("staff");
             if (staffNode) {
                 pedal->SetStaff(pedal->AttStaffIdent::StrToXsdPositiveIntegerList(
                     std::to_string(staffNode.node().text().as_int() + staffOffset)));
@@ -1820,7 +1850,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Principal voice
-    pugi::xpath_node lead = type.node().select_node("principal-voice");
+    pugi::xpath_node lead = type.node().child("principal-voice");
     if (lead) {
         int voiceNumber = lead.node().attribute("number").as_int();
         voiceNumber = (voiceNumber < 1) ? 1 : voiceNumber;
@@ -1845,7 +1875,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Rehearsal
-    pugi::xpath_node rehearsal = type.node().select_node("rehearsal");
+    pugi::xpath_node rehearsal = type.node().child("rehearsal");
     if (rehearsal) {
         Reh *reh = new Reh();
         reh->SetPlace(reh->AttPlacement::StrToStaffrel(placeStr.c_str()));
@@ -1855,7 +1885,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
         std::string textStr = GetContent(rehearsal.node());
         reh->SetColor(rehearsal.node().attribute("color").as_string());
         reh->SetTstamp(timeStamp);
-        pugi::xpath_node staffNode = node.select_node("staff");
+        pugi::xpath_node staffNode = node.child("staff");
         int staffNum = staffNode.node().text().as_int() + staffOffset;
         staffNum = (staffNum < 1) ? 1 : staffNum;
         reh->SetStaff(reh->AttStaffIdent::StrToXsdPositiveIntegerList(std::to_string(staffNum)));
@@ -1867,8 +1897,8 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Tempo
-    pugi::xpath_node metronome = type.node().select_node("metronome");
-    if (node.select_node("sound[@tempo]") || metronome) {
+    pugi::xpath_node metronome = type.node().child("metronome");
+    if (node.select_node(GetXPathQuery("sound[@tempo]")) || metronome) {
         Tempo *tempo = new Tempo();
         if (words.size() == 1) {
             tempo->SetLang(words.first().node().attribute("xml:lang").as_string());
@@ -1878,10 +1908,10 @@ void MusicXmlInput::ReadMusicXmlDirection(
         if (metronome)
             PrintMetronome(metronome.node(), tempo);
         else {
-            tempo->SetMidiBpm(node.select_node("sound").node().attribute("tempo").as_int());
+            tempo->SetMidiBpm(node.child("sound").attribute("tempo").as_int());
         }
         tempo->SetTstamp(timeStamp);
-        pugi::xpath_node staffNode = node.select_node("staff");
+        pugi::xpath_node staffNode = node.child("staff");
         if (staffNode) {
             tempo->SetStaff(tempo->AttStaffIdent::StrToXsdPositiveIntegerList(
                 std::to_string(staffNode.node().text().as_int() + staffOffset)));
@@ -1912,7 +1942,7 @@ void MusicXmlInput::ReadMusicXmlFigures(pugi::xml_node node, Measure *measure, s
         // std::string textStyle = node.attribute("font-style").as_string();
         // std::string textWeight = node.attribute("font-weight").as_string();
         for (pugi::xml_node figure = node.child("figure"); figure; figure = figure.next_sibling("figure")) {
-            std::string textStr = GetContent(figure.select_node("figure-number").node());
+            std::string textStr = GetContent(figure.child("figure-number"));
             F *f = new F();
             Text *text = new Text();
             text->SetText(UTF8to16(textStr));
@@ -1942,9 +1972,9 @@ void MusicXmlInput::ReadMusicXmlHarmony(pugi::xml_node node, Measure *measure, s
     int durOffset = 0;
 
     std::string harmText = GetContentOfChild(node, "root/root-step");
-    pugi::xpath_node alter = node.select_node("root/root-alter");
+    pugi::xpath_node alter = node.select_node(GetXPathQuery("root/root-alter"));
     harmText += ConvertAlterToSymbol(GetContent(alter.node()));
-    pugi::xpath_node kind = node.select_node("kind");
+    pugi::xpath_node kind = node.child("kind");
     if (kind) {
         if (HasAttributeWithValue(kind.node(), "use-symbols", "yes")) {
             harmText = harmText + ConvertKindToSymbol(GetContent(kind.node()));
@@ -1956,15 +1986,15 @@ void MusicXmlInput::ReadMusicXmlHarmony(pugi::xml_node node, Measure *measure, s
             harmText = harmText + ConvertKindToText(GetContent(kind.node()));
         }
     }
-    pugi::xpath_node degree = node.select_node("degree");
+    pugi::xpath_node degree = node.child("degree");
     if (degree) {
-        pugi::xpath_node alter = node.select_node("degree/degree-alter");
+        pugi::xpath_node alter = node.select_node(GetXPathQuery("degree/degree-alter"));
         harmText += ConvertAlterToSymbol(GetContent(alter.node())) + GetContentOfChild(node, "degree/degree-value");
     }
-    pugi::xpath_node bass = node.select_node("bass");
+    pugi::xpath_node bass = node.child("bass");
     if (bass) {
         harmText += "/" + GetContentOfChild(node, "bass/bass-step");
-        pugi::xpath_node alter = node.select_node("bass/bass-alter");
+        pugi::xpath_node alter = node.select_node(GetXPathQuery("bass/bass-alter"));
         harmText += ConvertAlterToSymbol(GetContent(alter.node()));
     }
     Harm *harm = new Harm();
@@ -1973,7 +2003,7 @@ void MusicXmlInput::ReadMusicXmlHarmony(pugi::xml_node node, Measure *measure, s
     harm->SetPlace(harm->AttPlacement::StrToStaffrel(node.attribute("placement").as_string()));
     harm->SetType(node.attribute("type").as_string());
     harm->AddChild(text);
-    pugi::xpath_node offset = node.select_node("offset");
+    pugi::xpath_node offset = node.child("offset");
     if (offset) durOffset = offset.node().text().as_int();
     harm->SetTstamp((double)(m_durTotal + durOffset) * (double)m_meterUnit / (double)(4 * m_ppq) + 1.0);
     m_controlElements.push_back(std::make_pair(measureNum, harm));
@@ -1987,7 +2017,8 @@ void MusicXmlInput::ReadMusicXmlNote(
     assert(measure);
 
     Layer *layer;
-    if (!node.select_node("voice")) { // if no layer info, stay at previous layer
+    // if no layer info, stay at previous layer (if it is in this measure)
+    if (!node.child("voice") && m_prevLayer && (m_prevLayer->GetFirstAncestor(MEASURE) == measure)) {
         layer = m_prevLayer;
     }
     else {
@@ -1996,10 +2027,10 @@ void MusicXmlInput::ReadMusicXmlNote(
     assert(layer);
     m_prevLayer = layer;
 
-    Staff *staff = dynamic_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
     assert(staff);
 
-    pugi::xpath_node isChord = node.select_node("chord");
+    pugi::xpath_node isChord = node.child("chord");
 
     // add clef changes to all layers of a given measure, staff, and time stamp
     if (!m_ClefChangeStack.empty()) {
@@ -2064,7 +2095,7 @@ void MusicXmlInput::ReadMusicXmlNote(
 
     // for measure repeats add a single <mRpt> and return
     if (m_mRpt) {
-        MRpt *mRpt = dynamic_cast<MRpt *>((*layer).GetFirst(MRPT));
+        MRpt *mRpt = vrv_cast<MRpt *>((*layer).GetFirst(MRPT));
         if (!mRpt) {
             mRpt = new MRpt();
             AddLayerElement(layer, mRpt);
@@ -2072,17 +2103,17 @@ void MusicXmlInput::ReadMusicXmlNote(
         return;
     }
 
-    pugi::xpath_node notations = node.select_node("notations[not(@print-object='no')]");
+    pugi::xpath_node notations = node.select_node(GetXPathQuery("notations[not(@print-object='no')]"));
 
     bool cue = false;
-    if (node.select_node("cue") || node.select_node("type[@size='cue']")) cue = true;
+    if (node.child("cue") || node.select_node(GetXPathQuery("type[@size='cue']"))) cue = true;
 
     // duration string and dots
     std::string typeStr = GetContentOfChild(node, "type");
-    int dots = (int)node.select_nodes("dot").size();
+    int dots = (int)node.select_nodes(GetXPathQuery("dot")).size();
 
     // beam start
-    bool beamStart = node.select_node("beam[@number='1'][text()='begin']");
+    bool beamStart = node.select_node(GetXPathQuery("beam[@number='1'][text()='begin']"));
     if (beamStart) {
         Beam *beam = new Beam();
         AddLayerElement(layer, beam);
@@ -2090,7 +2121,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // tremolos
-    pugi::xpath_node tremolo = notations.node().select_node("ornaments/tremolo");
+    pugi::xpath_node tremolo = notations.node().select_node(GetXPathQuery("ornaments/tremolo"));
     int tremSlashNum = 0;
     if (tremolo) {
         if (HasAttributeWithValue(tremolo.node(), "type", "single")) {
@@ -2112,13 +2143,13 @@ void MusicXmlInput::ReadMusicXmlNote(
     // quite likely not work if we have a tuplet over serveral beams. We would need to check which
     // one is ending first in order to determine which one is on top of the hierarchy.
     // Also, it is not 100% sure that we can represent them as tuplet and beam elements.
-    pugi::xpath_node tupletStart = notations.node().select_node("tuplet[@type='start']");
+    pugi::xpath_node tupletStart = notations.node().select_node(GetXPathQuery("tuplet[@type='start']"));
     if (tupletStart && !isChord) {
         Tuplet *tuplet = new Tuplet();
         AddLayerElement(layer, tuplet);
         m_elementStackMap.at(layer).push_back(tuplet);
-        pugi::xpath_node actualNotes = node.select_node("time-modification/actual-notes");
-        pugi::xpath_node normalNotes = node.select_node("time-modification/normal-notes");
+        pugi::xpath_node actualNotes = node.select_node(GetXPathQuery("time-modification/actual-notes"));
+        pugi::xpath_node normalNotes = node.select_node(GetXPathQuery("time-modification/normal-notes"));
         if (actualNotes && normalNotes) {
             tuplet->SetNum(actualNotes.node().text().as_int());
             tuplet->SetNumbase(normalNotes.node().text().as_int());
@@ -2133,7 +2164,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     int duration = atoi(GetContentOfChild(node, "duration").c_str());
-    pugi::xpath_node rest = node.select_node("rest");
+    pugi::xpath_node rest = node.child("rest");
     if (rest) {
         std::string stepStr = GetContentOfChild(rest.node(), "display-step");
         std::string octaveStr = GetContentOfChild(rest.node(), "display-octave");
@@ -2198,7 +2229,7 @@ void MusicXmlInput::ReadMusicXmlNote(
                 note->AttStaffIdent::StrToXsdPositiveIntegerList(std::to_string(noteStaffNum + staffOffset)));
 
         // accidental
-        pugi::xpath_node accidental = node.select_node("accidental");
+        pugi::xpath_node accidental = node.child("accidental");
         if (accidental) {
             Accid *accid = new Accid();
             accid->SetAccid(ConvertAccidentalToAccid(accidental.node().text().as_string()));
@@ -2221,7 +2252,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // pitch and octave
-        pugi::xpath_node pitch = node.select_node("pitch");
+        pugi::xpath_node pitch = node.child("pitch");
         if (pitch) {
             std::string stepStr = GetContentOfChild(pitch.node(), "step");
             if (!stepStr.empty()) note->SetPname(ConvertStepToPitchName(stepStr));
@@ -2237,7 +2268,7 @@ void MusicXmlInput::ReadMusicXmlNote(
             }
             std::string alterStr = GetContentOfChild(pitch.node(), "alter");
             if (!alterStr.empty()) {
-                Accid *accid = dynamic_cast<Accid *>(note->GetFirst(ACCID));
+                Accid *accid = vrv_cast<Accid *>(note->GetFirst(ACCID));
                 if (!accid) {
                     accid = new Accid();
                     note->AddChild(accid);
@@ -2248,14 +2279,14 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // notehead
-        pugi::xpath_node notehead = node.select_node("notehead");
+        pugi::xpath_node notehead = node.child("notehead");
         if (notehead) {
             // if (HasAttributeWithValue(notehead.node(), "parentheses", "yes")) note->SetEnclose(ENCLOSURE_paren);
         }
 
         // look at the next note to see if we are starting or ending a chord
-        pugi::xpath_node nextNote = node.select_node("./following-sibling::note");
-        if (nextNote.node().select_node("chord")) nextIsChord = true;
+        pugi::xml_node nextNote = node.next_sibling("note");
+        if (nextNote.child("chord")) nextIsChord = true;
         Chord *chord = NULL;
         if (nextIsChord) {
             // create the chord if we are starting a new chord
@@ -2273,7 +2304,7 @@ void MusicXmlInput::ReadMusicXmlNote(
             }
         }
         // If the current note is part of a chord.
-        if (nextIsChord || node.select_node("chord")) {
+        if (nextIsChord || node.child("chord")) {
             if (chord == NULL && m_elementStackMap.at(layer).size() > 0
                 && m_elementStackMap.at(layer).back()->Is(CHORD)) {
                 chord = dynamic_cast<Chord *>(m_elementStackMap.at(layer).back());
@@ -2290,7 +2321,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // grace notes
-        pugi::xpath_node grace = node.select_node("grace");
+        pugi::xpath_node grace = node.child("grace");
         if (grace) {
             std::string slashStr = grace.node().attribute("slash").as_string();
             if (slashStr == "no") {
@@ -2317,7 +2348,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // verse / syl
-        pugi::xpath_node_set lyrics = node.select_nodes("lyric");
+        pugi::xpath_node_set lyrics = node.select_nodes(GetXPathQuery("lyric"));
         for (pugi::xpath_node_set::const_iterator it = lyrics.begin(); it != lyrics.end(); ++it) {
             pugi::xml_node lyric = it->node();
             int lyricNumber = lyric.attribute("number").as_int();
@@ -2335,7 +2366,7 @@ void MusicXmlInput::ReadMusicXmlNote(
                     std::string textStr = textNode.text().as_string();
                     Syl *syl = new Syl();
                     syl->SetLang(lang.c_str());
-                    if (lyric.select_node("extend")) {
+                    if (lyric.child("extend")) {
                         syl->SetCon(sylLog_CON_u);
                     }
                     else if (textNode.next_sibling("elision")) {
@@ -2373,8 +2404,8 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // ties
-        pugi::xpath_node startTie = notations.node().select_node("tied[@type='start']");
-        pugi::xpath_node endTie = notations.node().select_node("tied[@type='stop']");
+        pugi::xpath_node startTie = notations.node().select_node(GetXPathQuery("tied[@type='start']"));
+        pugi::xpath_node endTie = notations.node().select_node(GetXPathQuery("tied[@type='stop']"));
         if (endTie) { // add to stack if (endTie) or if pitch/oct match to open tie on m_tieStack
             m_tieStopStack.push_back(note);
         }
@@ -2403,12 +2434,12 @@ void MusicXmlInput::ReadMusicXmlNote(
         for (pugi::xml_node articulations = notations.node().child("articulations"); articulations;
              articulations = articulations.next_sibling("articulations")) {
             Artic *artic = new Artic();
-            if (articulations.select_node("accent")) artics.push_back(ARTICULATION_acc);
-            if (articulations.select_node("spiccato")) artics.push_back(ARTICULATION_spicc);
-            if (articulations.select_node("staccatissimo")) artics.push_back(ARTICULATION_stacciss);
-            if (articulations.select_node("staccato")) artics.push_back(ARTICULATION_stacc);
-            if (articulations.select_node("strong-accent")) artics.push_back(ARTICULATION_marc);
-            if (articulations.select_node("tenuto")) artics.push_back(ARTICULATION_ten);
+            if (articulations.child("accent")) artics.push_back(ARTICULATION_acc);
+            if (articulations.child("spiccato")) artics.push_back(ARTICULATION_spicc);
+            if (articulations.child("staccatissimo")) artics.push_back(ARTICULATION_stacciss);
+            if (articulations.child("staccato")) artics.push_back(ARTICULATION_stacc);
+            if (articulations.child("strong-accent")) artics.push_back(ARTICULATION_marc);
+            if (articulations.child("tenuto")) artics.push_back(ARTICULATION_ten);
             artic->SetArtic(artics);
             element->AddChild(artic);
             artics.clear();
@@ -2416,12 +2447,12 @@ void MusicXmlInput::ReadMusicXmlNote(
         for (pugi::xml_node technical = notations.node().child("technical"); technical;
              technical = technical.next_sibling("technical")) {
             Artic *artic = new Artic();
-            if (technical.select_node("down-bow")) artics.push_back(ARTICULATION_dnbow);
-            if (technical.select_node("harmonic")) artics.push_back(ARTICULATION_harm);
-            if (technical.select_node("open-string")) artics.push_back(ARTICULATION_open);
-            if (technical.select_node("snap-pizzicato")) artics.push_back(ARTICULATION_snap);
-            if (technical.select_node("stopped")) artics.push_back(ARTICULATION_stop);
-            if (technical.select_node("up-bow")) artics.push_back(ARTICULATION_upbow);
+            if (technical.child("down-bow")) artics.push_back(ARTICULATION_dnbow);
+            if (technical.child("harmonic")) artics.push_back(ARTICULATION_harm);
+            if (technical.child("open-string")) artics.push_back(ARTICULATION_open);
+            if (technical.child("snap-pizzicato")) artics.push_back(ARTICULATION_snap);
+            if (technical.child("stopped")) artics.push_back(ARTICULATION_stop);
+            if (technical.child("up-bow")) artics.push_back(ARTICULATION_upbow);
             artic->SetArtic(artics);
             artic->SetType("technical");
             element->AddChild(artic);
@@ -2444,7 +2475,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     m_ID = "#" + element->GetUuid();
 
     // breath marks
-    pugi::xpath_node xmlBreath = notations.node().select_node("articulations/breath-mark");
+    pugi::xpath_node xmlBreath = notations.node().select_node(GetXPathQuery("articulations/breath-mark"));
     if (xmlBreath) {
         Breath *breath = new Breath();
         m_controlElements.push_back(std::make_pair(measureNum, breath));
@@ -2455,7 +2486,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // Dynamics
-    pugi::xpath_node xmlDynam = notations.node().select_node("dynamics");
+    pugi::xpath_node xmlDynam = notations.node().child("dynamics");
     if (xmlDynam) {
         Dynam *dynam = new Dynam();
         m_controlElements.push_back(std::make_pair(measureNum, dynam));
@@ -2471,7 +2502,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // fermatas
-    pugi::xpath_node xmlFermata = notations.node().select_node("fermata");
+    pugi::xpath_node xmlFermata = notations.node().child("fermata");
     if (xmlFermata) {
         Fermata *fermata = new Fermata();
         m_controlElements.push_back(std::make_pair(measureNum, fermata));
@@ -2493,7 +2524,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // mordent
-    pugi::xpath_node xmlMordent = notations.node().select_node("ornaments/mordent");
+    pugi::xpath_node xmlMordent = notations.node().select_node(GetXPathQuery("ornaments/mordent"));
     if (xmlMordent) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back(std::make_pair(measureNum, mordent));
@@ -2508,7 +2539,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         // place
         mordent->SetPlace(mordent->AttPlacement::StrToStaffrel(xmlMordent.node().attribute("placement").as_string()));
     }
-    pugi::xpath_node xmlMordentInv = notations.node().select_node("ornaments/inverted-mordent");
+    pugi::xpath_node xmlMordentInv = notations.node().select_node(GetXPathQuery("ornaments/inverted-mordent"));
     if (xmlMordentInv) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back(std::make_pair(measureNum, mordent));
@@ -2526,7 +2557,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // trill
-    pugi::xpath_node xmlTrill = notations.node().select_node("ornaments/trill-mark");
+    pugi::xpath_node xmlTrill = notations.node().select_node(GetXPathQuery("ornaments/trill-mark"));
     if (xmlTrill) {
         Trill *trill = new Trill();
         m_controlElements.push_back(std::make_pair(measureNum, trill));
@@ -2539,7 +2570,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // turn
-    pugi::xpath_node xmlTurn = notations.node().select_node("ornaments/turn");
+    pugi::xpath_node xmlTurn = notations.node().select_node(GetXPathQuery("ornaments/turn"));
     if (xmlTurn) {
         Turn *turn = new Turn();
         m_controlElements.push_back(std::make_pair(measureNum, turn));
@@ -2552,7 +2583,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         // place
         turn->SetPlace(turn->AttPlacement::StrToStaffrel(xmlTurn.node().attribute("placement").as_string()));
     }
-    pugi::xpath_node xmlTurnInv = notations.node().select_node("ornaments/inverted-turn");
+    pugi::xpath_node xmlTurnInv = notations.node().select_node(GetXPathQuery("ornaments/inverted-turn"));
     if (xmlTurnInv) {
         Turn *turn = new Turn();
         m_controlElements.push_back(std::make_pair(measureNum, turn));
@@ -2565,7 +2596,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         // place
         turn->SetPlace(turn->AttPlacement::StrToStaffrel(xmlTurnInv.node().attribute("placement").as_string()));
     }
-    pugi::xpath_node xmlDelayedTurn = notations.node().select_node("ornaments/delayed-turn");
+    pugi::xpath_node xmlDelayedTurn = notations.node().select_node(GetXPathQuery("ornaments/delayed-turn"));
     if (xmlDelayedTurn) {
         Turn *turn = new Turn();
         m_controlElements.push_back(std::make_pair(measureNum, turn));
@@ -2580,7 +2611,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         // place
         turn->SetPlace(turn->AttPlacement::StrToStaffrel(xmlTurn.node().attribute("placement").as_string()));
     }
-    pugi::xpath_node xmlDelayedTurnInv = notations.node().select_node("ornaments/delayed-inverted-turn");
+    pugi::xpath_node xmlDelayedTurnInv = notations.node().select_node(GetXPathQuery("ornaments/delayed-inverted-turn"));
     if (xmlDelayedTurnInv) {
         Turn *turn = new Turn();
         m_controlElements.push_back(std::make_pair(measureNum, turn));
@@ -2597,7 +2628,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // arpeggio
-    pugi::xpath_node xmlArpeggiate = notations.node().select_node("arpeggiate");
+    pugi::xpath_node xmlArpeggiate = notations.node().child("arpeggiate");
     if (xmlArpeggiate) {
         int arpegN = xmlArpeggiate.node().attribute("number").as_int();
         arpegN = (arpegN < 1) ? 1 : arpegN;
@@ -2636,7 +2667,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // slur
-    pugi::xpath_node_set slurs = notations.node().select_nodes("slur");
+    pugi::xpath_node_set slurs = notations.node().select_nodes(GetXPathQuery("slur"));
     for (pugi::xpath_node_set::const_iterator it = slurs.begin(); it != slurs.end(); ++it) {
         pugi::xml_node slur = it->node();
         int slurNumber = slur.attribute("number").as_int();
@@ -2672,13 +2703,13 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // tuplet end
-    pugi::xpath_node tupletEnd = notations.node().select_node("tuplet[@type='stop']");
+    pugi::xpath_node tupletEnd = notations.node().select_node(GetXPathQuery("tuplet[@type='stop']"));
     if (tupletEnd) {
         RemoveLastFromStack(TUPLET, layer);
     }
 
     // beam end
-    bool beamEnd = node.select_node("beam[@number='1'][text()='end']");
+    bool beamEnd = node.select_node(GetXPathQuery("beam[@number='1'][text()='end']"));
     if (beamEnd) {
         RemoveLastFromStack(BEAM, layer);
     }
@@ -440,7 +440,7 @@ void PAEOutput::WriteNote(Note *note)
         m_streamStringOutput << std::string(signCount, octSign);
     }
 
-    Accid *noteAccid = dynamic_cast<Accid *>(note->FindDescendantByType(ACCID));
+    Accid *noteAccid = vrv_cast<Accid *>(note->FindDescendantByType(ACCID));
     if (noteAccid) {
         std::string accid;
         switch (noteAccid->GetAccid()) {
@@ -500,7 +500,7 @@ void PAEOutput::WriteTuplet(Tuplet *tuplet)
 {
     assert(tuplet);
 
-    Staff *staff = dynamic_cast<Staff *>(tuplet->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(tuplet->GetFirstAncestor(STAFF));
     assert(staff);
 
     double content = tuplet->GetContentAlignmentDuration(NULL, NULL, true, staff->m_drawingNotationType);
@@ -1968,7 +1968,7 @@ void PAEInput::parseNote(pae::Note *note)
     // this case is simpler. NOTE a note can not be acciacctura AND appoggiatura
     // Acciaccatura rests do not exist
     if (note->acciaccatura && (element->Is(NOTE))) {
-        Note *mnote = dynamic_cast<Note *>(element);
+        Note *mnote = vrv_cast<Note *>(element);
         assert(mnote);
         mnote->SetDur(DURATION_8);
         mnote->SetGrace(GRACE_unacc);
@@ -1976,7 +1976,7 @@ void PAEInput::parseNote(pae::Note *note)
     }
 
     if ((note->appoggiatura > 0) && (element->Is(NOTE))) {
-        Note *mnote = dynamic_cast<Note *>(element);
+        Note *mnote = vrv_cast<Note *>(element);
         assert(mnote);
         mnote->SetGrace(GRACE_acc);
         mnote->SetStemDir(STEMDIRECTION_up);
@@ -2001,7 +2001,7 @@ void PAEInput::parseNote(pae::Note *note)
 
     // note in a chord
     if (note->chord) {
-        Note *mnote = dynamic_cast<Note *>(element);
+        Note *mnote = vrv_cast<Note *>(element);
         assert(mnote);
         // first note?
         if (!m_is_in_chord) {
@@ -2037,7 +2037,7 @@ void PAEInput::parseNote(pae::Note *note)
 
     // last note of a chord
     if (!note->chord && m_is_in_chord) {
-        Note *mnote = dynamic_cast<Note *>(element);
+        Note *mnote = vrv_cast<Note *>(element);
         assert(mnote);
         mnote->ResetAugmentDots();
         mnote->ResetDurationLogical();
@@ -121,7 +121,7 @@ void KeySig::FilterList(ArrayOfObjects *childList)
     m_mixedChildrenAccidType = false;
 
     for (auto &child : *childList) {
-        KeyAccid *keyAccid = dynamic_cast<KeyAccid *>(child);
+        KeyAccid *keyAccid = vrv_cast<KeyAccid *>(child);
         assert(keyAccid);
         if (type == ACCIDENTAL_WRITTEN_NONE) {
             type = keyAccid->GetAccid();
@@ -151,7 +151,7 @@ data_ACCIDENTAL_WRITTEN KeySig::GetAccidType()
     const ArrayOfObjects *childList = this->GetList(this); // make sure it's initialized
     if (childList->size() > 0) {
         if (m_mixedChildrenAccidType) return ACCIDENTAL_WRITTEN_NONE;
-        KeyAccid *keyAccid = dynamic_cast<KeyAccid *>(childList->at(0));
+        KeyAccid *keyAccid = vrv_cast<KeyAccid *>(childList->at(0));
         assert(keyAccid);
         return keyAccid->GetAccid();
     }
@@ -168,7 +168,7 @@ void KeySig::FillMap(MapOfPitchAccid &mapOfPitchAccid)
     const ArrayOfObjects *childList = this->GetList(this); // make sure it's initialized
     if (childList->size() > 0) {
         for (auto &child : *childList) {
-            KeyAccid *keyAccid = dynamic_cast<KeyAccid *>(child);
+            KeyAccid *keyAccid = vrv_cast<KeyAccid *>(child);
             assert(keyAccid);
             mapOfPitchAccid[keyAccid->GetPname()] = keyAccid->GetAccid();
         }
@@ -191,7 +191,7 @@ std::wstring KeySig::GetKeyAccidStrAt(int pos, data_ACCIDENTAL_WRITTEN &accid, d
     const ArrayOfObjects *childList = this->GetList(this); // make sure it's initialized
     if (childList->size() > 0) {
         if ((int)childList->size() <= pos) return symbolStr;
-        KeyAccid *keyAccid = dynamic_cast<KeyAccid *>(childList->at(pos));
+        KeyAccid *keyAccid = vrv_cast<KeyAccid *>(childList->at(pos));
         assert(keyAccid);
         accid = keyAccid->GetAccid();
         pname = keyAccid->GetPname();
@@ -304,7 +304,7 @@ int KeySig::GetFifthsInt()
 
 int KeySig::Transpose(FunctorParams *functorParams)
 {
-    TransposeParams *params = dynamic_cast<TransposeParams *>(functorParams);
+    TransposeParams *params = vrv_cast<TransposeParams *>(functorParams);
     assert(params);
 
     LogDebug("Transposing keySig");
@@ -166,14 +166,14 @@ LayerElement *Layer::GetAtPos(int x)
     Object *first = this->GetFirst();
     if (!first || !first->IsLayerElement()) return NULL;
 
-    LayerElement *element = dynamic_cast<LayerElement *>(first);
+    LayerElement *element = vrv_cast<LayerElement *>(first);
     assert(element);
     if (element->GetDrawingX() > x) return NULL;
 
     Object *next;
     while ((next = this->GetNext())) {
         if (!next->IsLayerElement()) continue;
-        LayerElement *nextLayerElement = dynamic_cast<LayerElement *>(next);
+        LayerElement *nextLayerElement = vrv_cast<LayerElement *>(next);
         assert(nextLayerElement);
         if (nextLayerElement->GetDrawingX() > x) return element;
         element = nextLayerElement;
@@ -197,7 +197,7 @@ Clef *Layer::GetClef(LayerElement *test)
     }
 
     if (testObject && testObject->Is(CLEF)) {
-        Clef *clef = dynamic_cast<Clef *>(testObject);
+        Clef *clef = vrv_cast<Clef *>(testObject);
         assert(clef);
         return clef;
     }
@@ -210,7 +210,7 @@ Clef *Layer::GetClef(LayerElement *test)
 
 Clef *Layer::GetClefFacs(LayerElement *test)
 {
-    Doc *doc = dynamic_cast<Doc *>(this->GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
     if (doc->GetType() == Facs) {
         ArrayOfObjects clefs;
@@ -254,7 +254,7 @@ data_STEMDIRECTION Layer::GetDrawingStemDir(const ArrayOfBeamElementCoords *coor
         return m_drawingStemDir;
     }
 
-    Measure *measure = dynamic_cast<Measure *>(this->GetFirstAncestor(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(this->GetFirstAncestor(MEASURE));
     assert(measure);
 
     Alignment *alignmentFirst = first->GetAlignment();
@@ -263,7 +263,7 @@ data_STEMDIRECTION Layer::GetDrawingStemDir(const ArrayOfBeamElementCoords *coor
     assert(alignmentLast);
 
     // We are ignoring cross-staff situation here because this should not be called if we have one
-    Staff *staff = dynamic_cast<Staff *>(first->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(first->GetFirstAncestor(STAFF));
     assert(staff);
 
     double time = alignmentFirst->GetTime();
@@ -282,7 +282,7 @@ int Layer::GetLayerCountForTimeSpanOf(LayerElement *element)
 {
     assert(element);
 
-    Measure *measure = dynamic_cast<Measure *>(this->GetFirstAncestor(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(this->GetFirstAncestor(MEASURE));
     assert(measure);
 
     Alignment *alignment = element->GetAlignment();
@@ -291,7 +291,7 @@ int Layer::GetLayerCountForTimeSpanOf(LayerElement *element)
     Layer *layer = NULL;
     Staff *staff = element->GetCrossStaff(layer);
     if (!staff) {
-        staff = dynamic_cast<Staff *>(element->GetFirstAncestor(STAFF));
+        staff = vrv_cast<Staff *>(element->GetFirstAncestor(STAFF));
     }
     // At this stage we have the parent or the cross-staff
     assert(staff);
@@ -303,7 +303,7 @@ int Layer::GetLayerCountInTimeSpan(double time, double duration, Measure *measur
 {
     assert(measure);
 
-    Functor layerCountInTimeSpan(&Object::LayerCountInTimeSpan);
+    Functor layerCountInTimeSpan(&Object::LayerCountInTimeSpan, "LayerCountInTimeSpan");
     LayerCountInTimeSpanParams layerCountInTimeSpanParams(
         GetCurrentMeterSig(), GetCurrentMensur(), &layerCountInTimeSpan);
     layerCountInTimeSpanParams.m_time = time;
@@ -320,28 +320,28 @@ int Layer::GetLayerCountInTimeSpan(double time, double duration, Measure *measur
 
 Clef *Layer::GetCurrentClef() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff && staff->m_drawingStaffDef && staff->m_drawingStaffDef->GetCurrentClef());
     return staff->m_drawingStaffDef->GetCurrentClef();
 }
 
 KeySig *Layer::GetCurrentKeySig() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff && staff->m_drawingStaffDef);
     return staff->m_drawingStaffDef->GetCurrentKeySig();
 }
 
 Mensur *Layer::GetCurrentMensur() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff && staff->m_drawingStaffDef);
     return staff->m_drawingStaffDef->GetCurrentMensur();
 }
 
 MeterSig *Layer::GetCurrentMeterSig() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff && staff->m_drawingStaffDef);
     return staff->m_drawingStaffDef->GetCurrentMeterSig();
 }
@@ -418,7 +418,7 @@ void Layer::SetDrawingCautionValues(StaffDef *currentStaffDef)
 
 int Layer::ConvertToCastOffMensural(FunctorParams *functorParams)
 {
-    ConvertToCastOffMensuralParams *params = dynamic_cast<ConvertToCastOffMensuralParams *>(functorParams);
+    ConvertToCastOffMensuralParams *params = vrv_cast<ConvertToCastOffMensuralParams *>(functorParams);
     assert(params);
 
     params->m_contentLayer = this;
@@ -436,7 +436,7 @@ int Layer::ConvertToCastOffMensural(FunctorParams *functorParams)
 
 int Layer::ConvertToUnCastOffMensural(FunctorParams *functorParams)
 {
-    ConvertToUnCastOffMensuralParams *params = dynamic_cast<ConvertToUnCastOffMensuralParams *>(functorParams);
+    ConvertToUnCastOffMensuralParams *params = vrv_cast<ConvertToUnCastOffMensuralParams *>(functorParams);
     assert(params);
 
     if (params->m_contentLayer == NULL) {
@@ -489,7 +489,7 @@ int Layer::ResetHorizontalAlignment(FunctorParams *functorParams)
 
 int Layer::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     params->m_currentMensur = GetCurrentMensur();
@@ -527,7 +527,7 @@ int Layer::AlignHorizontally(FunctorParams *functorParams)
 
 int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     params->m_scoreDefRole = SCOREDEF_CAUTIONARY;
@@ -548,13 +548,13 @@ int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 
     params->m_scoreDefRole = SCOREDEF_NONE;
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
     int graceAlignerId = params->m_doc->GetOptions()->m_graceRhythmAlign.GetValue() ? 0 : staff->GetN();
 
     int i;
     for (i = 0; i < params->m_measureAligner->GetChildCount(); ++i) {
-        Alignment *alignment = dynamic_cast<Alignment *>(params->m_measureAligner->GetChild(i));
+        Alignment *alignment = vrv_cast<Alignment *>(params->m_measureAligner->GetChild(i));
         assert(alignment);
         if (alignment->HasGraceAligner(graceAlignerId)) {
             alignment->GetGraceAligner(graceAlignerId)->AlignStack();
@@ -566,13 +566,13 @@ int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 
 int Layer::PrepareProcessingLists(FunctorParams *functorParams)
 {
-    PrepareProcessingListsParams *params = dynamic_cast<PrepareProcessingListsParams *>(functorParams);
+    PrepareProcessingListsParams *params = vrv_cast<PrepareProcessingListsParams *>(functorParams);
     assert(params);
 
     // Alternate solution with StaffN_LayerN_VerseN_t
     // StaffN_LayerN_VerseN_t *tree = static_cast<StaffN_LayerN_VerseN_t*>((*params).at(0));
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
     params->m_layerTree.child[staff->GetN()].child[this->GetN()];
 
@@ -581,7 +581,7 @@ int Layer::PrepareProcessingLists(FunctorParams *functorParams)
 
 int Layer::PrepareRpt(FunctorParams *functorParams)
 {
-    PrepareRptParams *params = dynamic_cast<PrepareRptParams *>(functorParams);
+    PrepareRptParams *params = vrv_cast<PrepareRptParams *>(functorParams);
     assert(params);
 
     // If we have encountered a mRpt before and there is none is this layer, reset it to NULL
@@ -593,7 +593,7 @@ int Layer::PrepareRpt(FunctorParams *functorParams)
 
 int Layer::CalcOnsetOffset(FunctorParams *functorParams)
 {
-    CalcOnsetOffsetParams *params = dynamic_cast<CalcOnsetOffsetParams *>(functorParams);
+    CalcOnsetOffsetParams *params = vrv_cast<CalcOnsetOffsetParams *>(functorParams);
     assert(params);
 
     params->m_currentScoreTime = 0.0;
@@ -608,7 +608,7 @@ int Layer::CalcOnsetOffset(FunctorParams *functorParams)
 /*
 int Layer::GenerateMIDI(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
     if (this->HasSameasLink()) {
@@ -621,7 +621,7 @@ int Layer::GenerateMIDI(FunctorParams *functorParams)
 
 int Layer::GenerateTimemap(FunctorParams *functorParams)
 {
-    GenerateTimemapParams *params = dynamic_cast<GenerateTimemapParams *>(functorParams);
+    GenerateTimemapParams *params = vrv_cast<GenerateTimemapParams *>(functorParams);
     assert(params);
 
     if (this->HasSameasLink()) {
@@ -140,7 +140,7 @@ bool LayerElement::IsGraceNote()
 {
     // For note, we need to look at it or at the parent chord
     if (this->Is(NOTE)) {
-        Note const *note = dynamic_cast<Note const *>(this);
+        Note const *note = vrv_cast<Note const *>(this);
         assert(note);
         Chord *chord = note->IsChordTone();
         if (chord)
@@ -149,7 +149,7 @@ bool LayerElement::IsGraceNote()
             return (note->HasGrace());
     }
     else if (this->Is(CHORD)) {
-        Chord const *chord = dynamic_cast<Chord const *>(this);
+        Chord const *chord = vrv_cast<Chord const *>(this);
         assert(chord);
         return (chord->HasGrace());
     }
@@ -162,10 +162,10 @@ bool LayerElement::IsGraceNote()
     // For accid, artic, etc.. look at the parent note / chord
     else {
         // For an accid we expect to be the child of a note - the note will lookup at the chord parent in necessary
-        Note *note = dynamic_cast<Note *>(this->GetFirstAncestor(NOTE, MAX_ACCID_DEPTH));
+        Note *note = vrv_cast<Note *>(this->GetFirstAncestor(NOTE, MAX_ACCID_DEPTH));
         if (note) return note->IsGraceNote();
         // For an artic we can be direct child of a chord
-        Chord *chord = dynamic_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_ACCID_DEPTH));
+        Chord *chord = vrv_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_ACCID_DEPTH));
         if (chord) return chord->IsGraceNote();
     }
     return false;
@@ -191,7 +191,7 @@ bool LayerElement::IsInFTrem()
 Beam *LayerElement::IsInBeam()
 {
     if (!this->Is({ CHORD, NOTE, STEM })) return NULL;
-    Beam *beamParent = dynamic_cast<Beam *>(this->GetFirstAncestor(BEAM, MAX_BEAM_DEPTH));
+    Beam *beamParent = vrv_cast<Beam *>(this->GetFirstAncestor(BEAM, MAX_BEAM_DEPTH));
     if (beamParent != NULL) {
         // This note is beamed and cue-sized - we will be able to get rid of this once MEI has a better modeling for
         // beamed grace notes
@@ -225,7 +225,7 @@ Staff *LayerElement::GetCrossStaff(Layer *&layer) const
     }
 
     LayerElement *parent
-        = dynamic_cast<LayerElement *>(this->GetFirstAncestorInRange(LAYER_ELEMENT, LAYER_ELEMENT_max));
+        = vrv_cast<LayerElement *>(this->GetFirstAncestorInRange(LAYER_ELEMENT, LAYER_ELEMENT_max));
 
     if (parent) return parent->GetCrossStaff(layer);
 
@@ -246,9 +246,13 @@ void LayerElement::SetGraceAlignment(Alignment *graceAlignment)
 
 int LayerElement::GetDrawingX() const
 {
+    // The cached value is never set for an element positioned with its facsimile, so check it first because this is
+    // called for every primitive drawn in the bounding box passes
+    if ((m_xAbs == VRV_UNSET) && (m_cachedDrawingX != VRV_UNSET)) return m_cachedDrawingX;
+
     // If this element has a facsimile and we are in facsimile mode, use Facsimile::GetDrawingX
     if (this->HasFacs()) {
-        Doc *doc = dynamic_cast<Doc *>(this->GetFirstAncestor(DOC));
+        Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
         assert(doc);
         if (doc->GetType() == Facs) {
             return FacsimileInterface::GetDrawingX();
@@ -271,7 +275,7 @@ int LayerElement::GetDrawingX() const
 
     // First get the first layerElement parent (if any) and use its position if they share the same alignment
     LayerElement *parent
-        = dynamic_cast<LayerElement *>(this->GetFirstAncestorInRange(LAYER_ELEMENT, LAYER_ELEMENT_max));
+        = vrv_cast<LayerElement *>(this->GetFirstAncestorInRange(LAYER_ELEMENT, LAYER_ELEMENT_max));
     if (parent && (parent->GetAlignment() == this->GetAlignment())) {
         m_cachedDrawingX = (parent->GetDrawingX() + this->GetDrawingXRel());
         return m_cachedDrawingX;
@@ -294,17 +298,18 @@ int LayerElement::GetDrawingX() const
 
 int LayerElement::GetDrawingY() const
 {
+    // As in GetDrawingX, the cached value is never set for an element positioned with its facsimile
+    if (m_cachedDrawingY != VRV_UNSET) return m_cachedDrawingY;
+
     // If this element has a facsimile and we are in facsimile mode, use Facsimile::GetDrawingY
     if (this->HasFacs()) {
-        Doc *doc = dynamic_cast<Doc *>(this->GetFirstAncestor(DOC));
+        Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
         assert(doc);
         if (doc->GetType() == Facs) {
             return FacsimileInterface::GetDrawingY();
         }
     }
 
-    if (m_cachedDrawingY != VRV_UNSET) return m_cachedDrawingY;
-
     // Look if we have a crossStaff situation
     Object *object = this->m_crossStaff; // GetCrossStaff();
     // First get the first layerElement parent (if any) but only if the element is not directly relative to staff (e.g.,
@@ -330,7 +335,7 @@ int LayerElement::GetDrawingArticulationTopOrBottom(data_STAFFREL place, ArticPa
     ArticPart *lastArticPart = NULL;
 
     // We limit support to two artic elements, get them by searching in both directions
-    Artic *firstArtic = dynamic_cast<Artic *>(this->FindDescendantByType(ARTIC));
+    Artic *firstArtic = vrv_cast<Artic *>(this->FindDescendantByType(ARTIC));
     Artic *lastArtic = dynamic_cast<Artic *>(this->FindDescendantByType(ARTIC, MAX_ACCID_DEPTH, BACKWARD));
     // If they are the same (we have only one artic child), then ignore the second one
     if (firstArtic == lastArtic) lastArtic = NULL;
@@ -382,7 +387,7 @@ void LayerElement::CenterDrawingX()
 
     SetDrawingXRel(0);
 
-    Measure *measure = dynamic_cast<Measure *>(this->GetFirstAncestor(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(this->GetFirstAncestor(MEASURE));
     assert(measure);
 
     SetDrawingXRel(measure->GetInnerCenterX() - this->GetDrawingX());
@@ -400,7 +405,7 @@ int LayerElement::GetDrawingTop(Doc *doc, int staffSize, bool withArtic, ArticPa
         if (durationInterface->GetNoteOrChordDur(this) < DUR_2) {
             if (this->Is(CHORD)) {
                 int yChordMax = 0, yChordMin = 0;
-                Chord *chord = dynamic_cast<Chord *>(this);
+                Chord *chord = vrv_cast<Chord *>(this);
                 assert(chord);
                 chord->GetYExtremes(yChordMax, yChordMin);
                 return yChordMax + doc->GetDrawingUnit(staffSize);
@@ -433,7 +438,7 @@ int LayerElement::GetDrawingBottom(Doc *doc, int staffSize, bool withArtic, Arti
         if (durationInterface->GetNoteOrChordDur(this) < DUR_2) {
             if (this->Is(CHORD)) {
                 int yChordMax = 0, yChordMin = 0;
-                Chord *chord = dynamic_cast<Chord *>(this);
+                Chord *chord = vrv_cast<Chord *>(this);
                 assert(chord);
                 chord->GetYExtremes(yChordMax, yChordMin);
                 return yChordMin - doc->GetDrawingUnit(staffSize);
@@ -464,7 +469,7 @@ int LayerElement::GetDrawingRadius(Doc *doc)
 
     int dur = DUR_4;
     if (this->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(this);
+        Note *note = vrv_cast<Note *>(this);
         assert(note);
         dur = note->GetDrawingDur();
         if (note->IsMensural()) {
@@ -472,12 +477,12 @@ int LayerElement::GetDrawingRadius(Doc *doc)
         }
     }
     else if (this->Is(CHORD)) {
-        Chord *chord = dynamic_cast<Chord *>(this);
+        Chord *chord = vrv_cast<Chord *>(this);
         assert(chord);
         dur = chord->GetActualDur();
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
     // Mensural note shorter than DUR_BR
     if (code) {
@@ -510,14 +515,14 @@ double LayerElement::GetAlignmentDuration(
     }
 
     if (this->HasSameasLink() && this->GetSameasLink()->IsLayerElement()) {
-        LayerElement *sameas = dynamic_cast<LayerElement *>(this->GetSameasLink());
+        LayerElement *sameas = vrv_cast<LayerElement *>(this->GetSameasLink());
         assert(sameas);
         return sameas->GetAlignmentDuration(mensur, meterSig, notGraceOnly, notationType);
     }
     else if (this->HasInterface(INTERFACE_DURATION)) {
         int num = 1;
         int numbase = 1;
-        Tuplet *tuplet = dynamic_cast<Tuplet *>(this->GetFirstAncestor(TUPLET, MAX_TUPLET_DEPTH));
+        Tuplet *tuplet = vrv_cast<Tuplet *>(this->GetFirstAncestor(TUPLET, MAX_TUPLET_DEPTH));
         if (tuplet) {
             num = tuplet->GetNum();
             numbase = tuplet->GetNumbase();
@@ -531,7 +536,7 @@ double LayerElement::GetAlignmentDuration(
             return duration->GetInterfaceAlignmentMensuralDuration(num, numbase, mensur);
         }
         if (this->Is(NC)) {
-            Neume *neume = dynamic_cast<Neume *>(this->GetFirstAncestor(NEUME));
+            Neume *neume = vrv_cast<Neume *>(this->GetFirstAncestor(NEUME));
             if (neume->IsLastInNeume(this)) {
                 return 128;
             }
@@ -541,21 +546,21 @@ double LayerElement::GetAlignmentDuration(
         }
         double durationValue = duration->GetInterfaceAlignmentDuration(num, numbase);
         // With fTrem we need to divide the duration by two
-        FTrem *fTrem = dynamic_cast<FTrem *>(this->GetFirstAncestor(FTREM, MAX_FTREM_DEPTH));
+        FTrem *fTrem = vrv_cast<FTrem *>(this->GetFirstAncestor(FTREM, MAX_FTREM_DEPTH));
         if (fTrem) {
             durationValue /= 2.0;
         }
         return durationValue;
     }
     else if (this->Is(BEATRPT)) {
-        BeatRpt *beatRpt = dynamic_cast<BeatRpt *>(this);
+        BeatRpt *beatRpt = vrv_cast<BeatRpt *>(this);
         assert(beatRpt);
         int meterUnit = 4;
         if (meterSig && meterSig->HasUnit()) meterUnit = meterSig->GetUnit();
         return beatRpt->GetBeatRptAlignmentDuration(meterUnit);
     }
     else if (this->Is(TIMESTAMP_ATTR)) {
-        TimestampAttr *timestampAttr = dynamic_cast<TimestampAttr *>(this);
+        TimestampAttr *timestampAttr = vrv_cast<TimestampAttr *>(this);
         assert(timestampAttr);
         int meterUnit = 4;
         if (meterSig && meterSig->HasUnit()) meterUnit = meterSig->GetUnit();
@@ -587,7 +592,7 @@ double LayerElement::GetSameAsContentAlignmentDuration(
         return 0.0;
     }
 
-    LayerElement *sameas = dynamic_cast<LayerElement *>(this->GetSameasLink());
+    LayerElement *sameas = vrv_cast<LayerElement *>(this->GetSameasLink());
     assert(sameas);
 
     return sameas->GetContentAlignmentDuration(mensur, meterSig, notGraceOnly, notationType);
@@ -607,7 +612,7 @@ double LayerElement::GetContentAlignmentDuration(
         if (!child->HasInterface(INTERFACE_DURATION) || (child->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH) != NULL)) {
             continue;
         }
-        LayerElement *element = dynamic_cast<LayerElement *>(child);
+        LayerElement *element = vrv_cast<LayerElement *>(child);
         assert(element);
         duration += element->GetAlignmentDuration(mensur, meterSig, notGraceOnly, notationType);
     }
@@ -642,7 +647,7 @@ int LayerElement::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int LayerElement::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -654,7 +659,7 @@ int LayerElement::ApplyPPUFactor(FunctorParams *functorParams)
 
 int LayerElement::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     // if (m_alignment) LogDebug("Element %s %s", this->GetUuid().c_str(), this->GetClassName().c_str());
@@ -666,9 +671,9 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
 
     AlignmentType type = ALIGNMENT_DEFAULT;
 
-    Chord *chordParent = dynamic_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
-    Note *noteParent = dynamic_cast<Note *>(this->GetFirstAncestor(NOTE, MAX_NOTE_DEPTH));
-    Rest *restParent = dynamic_cast<Rest *>(this->GetFirstAncestor(REST, MAX_NOTE_DEPTH));
+    Chord *chordParent = vrv_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
+    Note *noteParent = vrv_cast<Note *>(this->GetFirstAncestor(NOTE, MAX_NOTE_DEPTH));
+    Rest *restParent = vrv_cast<Rest *>(this->GetFirstAncestor(REST, MAX_NOTE_DEPTH));
 
     if (chordParent) {
         m_alignment = chordParent->GetAlignment();
@@ -720,7 +725,7 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
             type = ALIGNMENT_SCOREDEF_CAUTION_MENSUR;
         else {
             // replace the current mensur
-            params->m_currentMensur = dynamic_cast<Mensur *>(this);
+            params->m_currentMensur = vrv_cast<Mensur *>(this);
             assert(params->m_currentMensur);
             type = ALIGNMENT_MENSUR;
         }
@@ -732,7 +737,7 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
             type = ALIGNMENT_SCOREDEF_CAUTION_METERSIG;
         else {
             // replace the current meter signature
-            params->m_currentMeterSig = dynamic_cast<MeterSig *>(this);
+            params->m_currentMeterSig = vrv_cast<MeterSig *>(this);
             assert(params->m_currentMeterSig);
             // type = ALIGNMENT_METERSIG
             // We force this because they should appear only at the beginning of a measure and should be non-justifiable
@@ -747,7 +752,7 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
         type = ALIGNMENT_FULLMEASURE2;
     }
     else if (this->Is(DOT)) {
-        Dot *dot = dynamic_cast<Dot *>(this);
+        Dot *dot = vrv_cast<Dot *>(this);
         assert(dot);
         if (dot->m_drawingNote) {
             m_alignment = dot->m_drawingNote->GetAlignment();
@@ -763,26 +768,26 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
     }
     else if (this->Is({ ARTIC, ARTIC_PART })) {
         // Refer to the note parent
-        Note *note = dynamic_cast<Note *>(this->GetFirstAncestor(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstAncestor(NOTE));
         assert(note);
         m_alignment = note->GetAlignment();
     }
     else if (this->Is(SYL)) {
-        Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+        Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
         assert(staff);
 
         if (staff->m_drawingNotationType == NOTATIONTYPE_neume) {
             type = ALIGNMENT_DEFAULT;
         }
         else {
-            Note *note = dynamic_cast<Note *>(this->GetFirstAncestor(NOTE));
+            Note *note = vrv_cast<Note *>(this->GetFirstAncestor(NOTE));
             assert(note);
             m_alignment = note->GetAlignment();
         }
     }
     else if (this->Is(VERSE)) {
         // Idem
-        Note *note = dynamic_cast<Note *>(this->GetFirstAncestor(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstAncestor(NOTE));
         assert(note);
         m_alignment = note->GetAlignment();
     }
@@ -817,7 +822,7 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
     else {
         assert(this->IsGraceNote());
         if (this->Is(CHORD) || (this->Is(NOTE) && !chordParent)) {
-            Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+            Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
             assert(staff);
             int graceAlignerId = params->m_doc->GetOptions()->m_graceRhythmAlign.GetValue() ? 0 : staff->GetN();
             GraceAligner *graceAligner = m_alignment->GetGraceAligner(graceAlignerId);
@@ -839,15 +844,15 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
 
 int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
 {
-    SetAlignmentPitchPosParams *params = dynamic_cast<SetAlignmentPitchPosParams *>(functorParams);
+    SetAlignmentPitchPosParams *params = vrv_cast<SetAlignmentPitchPosParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
 
     LayerElement *layerElementY = this;
-    Staff *staffY = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staffY = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staffY);
-    Layer *layerY = dynamic_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *layerY = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
     assert(layerY);
 
     if (m_crossStaff && m_crossLayer) {
@@ -858,9 +863,9 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
 
     // Adjust m_drawingYRel for notes and rests, etc.
     if (this->Is(ACCID)) {
-        Accid *accid = dynamic_cast<Accid *>(this);
+        Accid *accid = vrv_cast<Accid *>(this);
         assert(accid);
-        Note *note = dynamic_cast<Note *>(this->GetFirstAncestor(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstAncestor(NOTE));
         // We should probably also avoid to add editorial accidentals to the accid space
         // However, since they are placed above by View::DrawNote it works without avoiding it
         if (note) {
@@ -880,12 +885,12 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         this->SetDrawingYRel(staffY->CalcPitchPosYRel(params->m_doc, loc));
     }
     else if (this->Is({ CUSTOS, DOT })) {
-        PositionInterface *interface = dynamic_cast<PositionInterface *>(this);
+        PositionInterface *interface = vrv_cross_cast<PositionInterface *>(this);
         assert(interface);
         this->SetDrawingYRel(staffY->CalcPitchPosYRel(params->m_doc, interface->CalcDrawingLoc(layerY, layerElementY)));
     }
     else if (this->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(this);
+        Note *note = vrv_cast<Note *>(this);
         assert(note);
         Chord *chord = note->IsChordTone();
         int loc = 0;
@@ -901,7 +906,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         this->SetDrawingYRel(yRel);
     }
     else if (this->Is(MREST)) {
-        MRest *mRest = dynamic_cast<MRest *>(this);
+        MRest *mRest = vrv_cast<MRest *>(this);
         assert(mRest);
         int loc = 0;
         if (mRest->HasPloc() && mRest->HasOloc()) {
@@ -913,14 +918,14 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         // Automatically calculate rest position
         else {
             // set default location to the middle of the staff
-            Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+            Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
             assert(staff);
             loc = staff->m_drawingLines - 1;
             // Limitation: GetLayerCount does not take into account editorial markup
             // should be refined later
             bool hasMultipleLayer = (staffY->GetChildCount(LAYER) > 1);
             if (hasMultipleLayer) {
-                Layer *firstLayer = dynamic_cast<Layer *>(staffY->FindDescendantByType(LAYER));
+                Layer *firstLayer = vrv_cast<Layer *>(staffY->FindDescendantByType(LAYER));
                 assert(firstLayer);
                 if (firstLayer->GetN() == layerY->GetN())
                     loc += 2;
@@ -938,7 +943,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
     }
 
     else if (this->Is(REST)) {
-        Rest *rest = dynamic_cast<Rest *>(this);
+        Rest *rest = vrv_cast<Rest *>(this);
         assert(rest);
         int loc = 0;
         if (rest->HasPloc() && rest->HasOloc()) {
@@ -950,11 +955,11 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         // Automatically calculate rest position
         else {
             // set default location to the middle of the staff
-            Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+            Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
             assert(staff);
             loc = staff->m_drawingLines - 1;
 
-            Beam *beam = dynamic_cast<Beam *>(this->GetFirstAncestor(BEAM, 1));
+            Beam *beam = vrv_cast<Beam *>(this->GetFirstAncestor(BEAM, 1));
             // Limitation: GetLayerCount does not take into account editorial markup
             // should be refined later
             bool hasMultipleLayer = (staffY->GetChildCount(LAYER) > 1);
@@ -973,7 +978,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
                 // iterate through the elements from the rest to the beginning of the beam
                 // until we hit a note or chord, which we will use to determine where the rest should be placed
                 for (; rit != beamList->rend(); ++rit) {
-                    LayerElement *layerElement = dynamic_cast<LayerElement *>(*rit);
+                    LayerElement *layerElement = vrv_cast<LayerElement *>(*rit);
                     assert(layerElement);
                     if (layerElement->Is(NOTE)) {
                         leftLoc = PitchInterface::CalcLoc(layerElement, layerY, layerElementY);
@@ -994,7 +999,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
                 // iterate through the elements from the rest to the end of the beam
                 // until we hit a note or chord, which we will use to determine where the rest should be placed
                 for (; it != beamList->end(); ++it) {
-                    LayerElement *layerElement = dynamic_cast<LayerElement *>(*it);
+                    LayerElement *layerElement = vrv_cast<LayerElement *>(*it);
                     assert(layerElement);
                     if (layerElement->Is(NOTE)) {
                         rightLoc = PitchInterface::CalcLoc(layerElement, layerY, layerElementY);
@@ -1067,11 +1072,11 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
                 }
             }
             else if (hasMultipleLayer) {
-                Layer *parentLayer = dynamic_cast<Layer *>(this->GetFirstAncestor(LAYER));
+                Layer *parentLayer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
                 assert(parentLayer);
                 int layerCount = parentLayer->GetLayerCountForTimeSpanOf(this);
                 if (layerCount > 1) {
-                    Layer *firstLayer = dynamic_cast<Layer *>(staffY->FindDescendantByType(LAYER));
+                    Layer *firstLayer = vrv_cast<Layer *>(staffY->FindDescendantByType(LAYER));
                     assert(firstLayer);
                     if (firstLayer->GetN() == layerY->GetN())
                         loc += 2;
@@ -1090,7 +1095,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
 
 int LayerElement::AdjustLayers(FunctorParams *functorParams)
 {
-    AdjustLayersParams *params = dynamic_cast<AdjustLayersParams *>(functorParams);
+    AdjustLayersParams *params = vrv_cast<AdjustLayersParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1114,19 +1119,19 @@ int LayerElement::AdjustLayers(FunctorParams *functorParams)
     if (params->m_previous.empty()) return FUNCTOR_SIBLINGS;
 
     if (this->Is(NOTE)) {
-        params->m_currentNote = dynamic_cast<Note *>(this);
+        params->m_currentNote = vrv_cast<Note *>(this);
         assert(params->m_currentNote);
         if (!params->m_currentNote->IsChordTone()) params->m_currentChord = NULL;
     }
     else if (this->Is(CHORD)) {
-        params->m_currentChord = dynamic_cast<Chord *>(this);
+        params->m_currentChord = vrv_cast<Chord *>(this);
         assert(params->m_currentChord);
     }
 
     // Eventually we also want to have stem for overlapping voices
     if (this->Is({ NOTE, DOTS })) {
 
-        Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+        Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
         assert(staff);
 
         std::vector<LayerElement *>::iterator iter;
@@ -1137,7 +1142,7 @@ int LayerElement::AdjustLayers(FunctorParams *functorParams)
 
             if (this->Is(NOTE) && (*iter)->Is(NOTE)) {
                 assert(params->m_currentNote);
-                Note *previousNote = dynamic_cast<Note *>(*iter);
+                Note *previousNote = vrv_cast<Note *>(*iter);
                 assert(previousNote);
                 // Unisson, look at the duration for the note heads
                 if (params->m_currentNote->IsUnissonWith(previousNote, false)) {
@@ -1182,7 +1187,7 @@ int LayerElement::AdjustLayers(FunctorParams *functorParams)
 
 int LayerElement::AdjustGraceXPos(FunctorParams *functorParams)
 {
-    AdjustGraceXPosParams *params = dynamic_cast<AdjustGraceXPosParams *>(functorParams);
+    AdjustGraceXPosParams *params = vrv_cast<AdjustGraceXPosParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1221,7 +1226,7 @@ int LayerElement::AdjustGraceXPos(FunctorParams *functorParams)
 
 int LayerElement::AdjustXPos(FunctorParams *functorParams)
 {
-    AdjustXPosParams *params = dynamic_cast<AdjustXPosParams *>(functorParams);
+    AdjustXPosParams *params = vrv_cast<AdjustXPosParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1302,13 +1307,13 @@ int LayerElement::PrepareDrawingCueSize(FunctorParams *functorParams)
     }
     // This cover the case when the @size is given on the element
     else if (this->HasAttClass(ATT_CUE)) {
-        AttCue *att = dynamic_cast<AttCue *>(this);
+        AttCue *att = vrv_cross_cast<AttCue *>(this);
         assert(att);
         if (att->HasCue()) m_drawingCueSize = (att->GetCue() == BOOLEAN_true);
     }
     // For note, we also need to look at the parent chord
     else if (this->Is(NOTE)) {
-        Note const *note = dynamic_cast<Note const *>(this);
+        Note const *note = vrv_cast<Note const *>(this);
         assert(note);
         Chord *chord = note->IsChordTone();
         if (chord) m_drawingCueSize = chord->GetDrawingCueSize();
@@ -1322,21 +1327,21 @@ int LayerElement::PrepareDrawingCueSize(FunctorParams *functorParams)
     }
     // For accid, look at the parent if @func="edit" or otherwise to the parent note
     else if (this->Is(ACCID)) {
-        Accid const *accid = dynamic_cast<Accid *>(this);
+        Accid const *accid = vrv_cast<Accid *>(this);
         assert(accid);
         if ((accid->GetFunc() == accidLog_FUNC_edit) && !accid->HasEnclose())
             m_drawingCueSize = true;
         else {
-            Note *note = dynamic_cast<Note *>(this->GetFirstAncestor(NOTE, MAX_ACCID_DEPTH));
+            Note *note = vrv_cast<Note *>(this->GetFirstAncestor(NOTE, MAX_ACCID_DEPTH));
             if (note) m_drawingCueSize = note->GetDrawingCueSize();
         }
     }
     else if (this->Is({ DOTS, FLAG, STEM })) {
-        Note *note = dynamic_cast<Note *>(this->GetFirstAncestor(NOTE, MAX_NOTE_DEPTH));
+        Note *note = vrv_cast<Note *>(this->GetFirstAncestor(NOTE, MAX_NOTE_DEPTH));
         if (note)
             m_drawingCueSize = note->GetDrawingCueSize();
         else {
-            Chord *chord = dynamic_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
+            Chord *chord = vrv_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
             if (chord) m_drawingCueSize = chord->GetDrawingCueSize();
         }
     }
@@ -1346,7 +1351,7 @@ int LayerElement::PrepareDrawingCueSize(FunctorParams *functorParams)
 
 int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
 {
-    PrepareCrossStaffParams *params = dynamic_cast<PrepareCrossStaffParams *>(functorParams);
+    PrepareCrossStaffParams *params = vrv_cast<PrepareCrossStaffParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1378,7 +1383,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Staff *parentStaff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *parentStaff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(parentStaff);
     // Check if we have a cross-staff to itself...
     if (m_crossStaff == parentStaff) {
@@ -1388,7 +1393,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Layer *parentLayer = dynamic_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *parentLayer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
     assert(parentLayer);
     // Now try to get the corresponding layer - for now look for the same layer @n
     int layerN = parentLayer->GetN();
@@ -1398,7 +1403,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
     m_crossLayer = dynamic_cast<Layer *>(m_crossStaff->FindDescendantByComparison(&comparisonFirstLayer, 1));
     if (!m_crossLayer) {
         // Just try to pick the first one...
-        m_crossLayer = dynamic_cast<Layer *>(m_crossStaff->FindDescendantByType(LAYER));
+        m_crossLayer = vrv_cast<Layer *>(m_crossStaff->FindDescendantByType(LAYER));
     }
     if (!m_crossLayer) {
         // Nothing we can do
@@ -1415,7 +1420,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
 
 int LayerElement::PrepareCrossStaffEnd(FunctorParams *functorParams)
 {
-    PrepareCrossStaffParams *params = dynamic_cast<PrepareCrossStaffParams *>(functorParams);
+    PrepareCrossStaffParams *params = vrv_cast<PrepareCrossStaffParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1436,7 +1441,7 @@ int LayerElement::PrepareCrossStaffEnd(FunctorParams *functorParams)
 
 int LayerElement::PreparePointersByLayer(FunctorParams *functorParams)
 {
-    PreparePointersByLayerParams *params = dynamic_cast<PreparePointersByLayerParams *>(functorParams);
+    PreparePointersByLayerParams *params = vrv_cast<PreparePointersByLayerParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1455,7 +1460,7 @@ int LayerElement::PreparePointersByLayer(FunctorParams *functorParams)
 
 int LayerElement::PrepareTimePointing(FunctorParams *functorParams)
 {
-    PrepareTimePointingParams *params = dynamic_cast<PrepareTimePointingParams *>(functorParams);
+    PrepareTimePointingParams *params = vrv_cast<PrepareTimePointingParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1479,7 +1484,7 @@ int LayerElement::PrepareTimePointing(FunctorParams *functorParams)
 
 int LayerElement::PrepareTimeSpanning(FunctorParams *functorParams)
 {
-    PrepareTimeSpanningParams *params = dynamic_cast<PrepareTimeSpanningParams *>(functorParams);
+    PrepareTimeSpanningParams *params = vrv_cast<PrepareTimeSpanningParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1503,7 +1508,7 @@ int LayerElement::PrepareTimeSpanning(FunctorParams *functorParams)
 
 int LayerElement::LayerCountInTimeSpan(FunctorParams *functorParams)
 {
-    LayerCountInTimeSpanParams *params = dynamic_cast<LayerCountInTimeSpanParams *>(functorParams);
+    LayerCountInTimeSpanParams *params = vrv_cast<LayerCountInTimeSpanParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1544,7 +1549,7 @@ int LayerElement::LayerCountInTimeSpan(FunctorParams *functorParams)
 
 int LayerElement::FindSpannedLayerElements(FunctorParams *functorParams)
 {
-    FindSpannedLayerElementsParams *params = dynamic_cast<FindSpannedLayerElementsParams *>(functorParams);
+    FindSpannedLayerElementsParams *params = vrv_cast<FindSpannedLayerElementsParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1579,7 +1584,7 @@ int LayerElement::FindSpannedLayerElements(FunctorParams *functorParams)
 
 int LayerElement::CalcOnsetOffset(FunctorParams *functorParams)
 {
-    CalcOnsetOffsetParams *params = dynamic_cast<CalcOnsetOffsetParams *>(functorParams);
+    CalcOnsetOffsetParams *params = vrv_cast<CalcOnsetOffsetParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1592,11 +1597,19 @@ int LayerElement::CalcOnsetOffset(FunctorParams *functorParams)
         incrementScoreTime = element->GetAlignmentDuration(
             params->m_currentMensur, params->m_currentMeterSig, true, params->m_notationType);
         incrementScoreTime = incrementScoreTime / (DUR_MAX / DURATION_4);
+        double realTimeIncrementSeconds = incrementScoreTime * 60.0 / params->m_currentTempo;
+        // Store the times of the rests for Doc::FindElementsAtTime
+        if (element->Is(REST)) {
+            Rest *rest = vrv_cast<Rest *>(element);
+            assert(rest);
+            rest->SetRealTimeOnsetSeconds(params->m_currentRealTimeSeconds);
+            rest->SetRealTimeOffsetSeconds(params->m_currentRealTimeSeconds + realTimeIncrementSeconds);
+        }
         params->m_currentScoreTime += incrementScoreTime;
-        params->m_currentRealTimeSeconds += incrementScoreTime * 60.0 / params->m_currentTempo;
+        params->m_currentRealTimeSeconds += realTimeIncrementSeconds;
     }
     else if (element->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(element);
+        Note *note = vrv_cast<Note *>(element);
         assert(note);
 
         // For now just ignore grace notes
@@ -1639,7 +1652,7 @@ int LayerElement::CalcOnsetOffset(FunctorParams *functorParams)
         }
     }
     else if (element->Is(BEATRPT)) {
-        BeatRpt *rpt = dynamic_cast<BeatRpt *>(element);
+        BeatRpt *rpt = vrv_cast<BeatRpt *>(element);
         assert(rpt);
 
         incrementScoreTime = rpt->GetAlignmentDuration(
@@ -1666,7 +1679,7 @@ int LayerElement::ResolveMIDITies(FunctorParams *)
 
 int LayerElement::GenerateMIDI(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
@@ -1681,7 +1694,7 @@ int LayerElement::GenerateMIDI(FunctorParams *functorParams)
 
 int LayerElement::GenerateTimemap(FunctorParams *functorParams)
 {
-    GenerateTimemapParams *params = dynamic_cast<GenerateTimemapParams *>(functorParams);
+    GenerateTimemapParams *params = vrv_cast<GenerateTimemapParams *>(functorParams);
     assert(params);
 
     if (this->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
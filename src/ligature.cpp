@@ -76,7 +76,7 @@ void Ligature::FilterList(ArrayOfObjects *childList)
             iter = childList->erase(iter);
             continue;
         }
-        LayerElement *currentElement = dynamic_cast<LayerElement *>(*iter);
+        LayerElement *currentElement = vrv_cast<LayerElement *>(*iter);
         assert(currentElement);
         if (!currentElement->HasInterface(INTERFACE_DURATION)) {
             iter = childList->erase(iter);
@@ -67,7 +67,7 @@ void LinkingInterface::SetUuidStr()
 Measure *LinkingInterface::GetNextMeasure()
 {
     if (!m_next) return NULL;
-    return dynamic_cast<Measure *>(this->m_next->GetFirstAncestor(MEASURE));
+    return vrv_cast<Measure *>(this->m_next->GetFirstAncestor(MEASURE));
 }
 
 //----------------------------------------------------------------------------
@@ -76,7 +76,7 @@ Measure *LinkingInterface::GetNextMeasure()
 
 int LinkingInterface::InterfacePrepareLinking(FunctorParams *functorParams, Object *object)
 {
-    PrepareLinkingParams *params = dynamic_cast<PrepareLinkingParams *>(functorParams);
+    PrepareLinkingParams *params = vrv_cast<PrepareLinkingParams *>(functorParams);
     assert(params);
 
     // This should not happen?
@@ -98,7 +98,7 @@ int LinkingInterface::InterfacePrepareLinking(FunctorParams *functorParams, Obje
 
 int LinkingInterface::InterfaceFillStaffCurrentTimeSpanning(FunctorParams *functorParams, Object *object)
 {
-    FillStaffCurrentTimeSpanningParams *params = dynamic_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
+    FillStaffCurrentTimeSpanningParams *params = vrv_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
     assert(params);
 
     // Only Dir and Dynam can be spanning with @next (extender)
@@ -113,7 +113,7 @@ int LinkingInterface::InterfaceFillStaffCurrentTimeSpanning(FunctorParams *funct
 
     // if @extender is available, the explicit "true" is required
     if (object->HasAttClass(ATT_EXTENDER)) {
-        AttExtender *att = dynamic_cast<AttExtender *>(object);
+        AttExtender *att = vrv_cross_cast<AttExtender *>(object);
         assert(att);
         if (att->GetExtender() != BOOLEAN_true) return FUNCTOR_CONTINUE;
     }
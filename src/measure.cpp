@@ -23,6 +23,8 @@
 #include "ending.h"
 #include "functorparams.h"
 #include "hairpin.h"
+#include "layer.h"
+#include "layerelement.h"
 #include "page.h"
 #include "staff.h"
 #include "staffdef.h"
@@ -91,6 +93,7 @@ void Measure::CloneReset()
 
     m_measureAligner.Reset();
     m_measureAligner.SetParent(this);
+    this->ClearStoredHorizontalLayout();
     // Idem for timestamps
     m_timestampAligner.SetParent(this);
     // Idem for barlines
@@ -131,6 +134,8 @@ void Measure::Reset()
 
     m_drawingEnding = NULL;
     m_hasAlignmentRefWithMultipleLayers = false;
+    m_isEdited = false;
+    this->ClearStoredHorizontalLayout();
 
     m_scoreTimeOffset.clear();
     m_realTimeOffsetMilliseconds.clear();
@@ -207,7 +212,7 @@ void Measure::AddChildBack(Object *child)
 int Measure::GetDrawingX() const
 {
     if (!this->IsMeasuredMusic()) {
-        System *system = dynamic_cast<System *>(this->GetFirstAncestor(SYSTEM));
+        System *system = vrv_cast<System *>(this->GetFirstAncestor(SYSTEM));
         assert(system);
         if (system->m_yAbs != VRV_UNSET) {
             return (system->m_systemLeftMar);
@@ -218,7 +223,7 @@ int Measure::GetDrawingX() const
 
     if (m_cachedDrawingX != VRV_UNSET) return m_cachedDrawingX;
 
-    System *system = dynamic_cast<System *>(this->GetFirstAncestor(SYSTEM));
+    System *system = vrv_cast<System *>(this->GetFirstAncestor(SYSTEM));
     assert(system);
     m_cachedDrawingX = system->GetDrawingX() + this->GetDrawingXRel();
     return m_cachedDrawingX;
@@ -286,9 +291,9 @@ int Measure::GetRightBarLineRight() const
 int Measure::GetWidth() const
 {
     if (!this->IsMeasuredMusic()) {
-        System *system = dynamic_cast<System *>(this->GetFirstAncestor(SYSTEM));
+        System *system = vrv_cast<System *>(this->GetFirstAncestor(SYSTEM));
         assert(system);
-        Page *page = dynamic_cast<Page *>(system->GetFirstAncestor(PAGE));
+        Page *page = vrv_cast<Page *>(system->GetFirstAncestor(PAGE));
         assert(page);
         if (system->m_yAbs != VRV_UNSET) {
             // xAbs2 =  page->m_pageWidth - system->m_systemRightMar;
@@ -314,10 +319,10 @@ int Measure::GetInnerCenterX() const
 
 int Measure::GetDrawingOverflow()
 {
-    Functor adjustXOverlfow(&Object::AdjustXOverflow);
-    Functor adjustXOverlfowEnd(&Object::AdjustXOverflowEnd);
+    Functor adjustXOverlfow(&Object::AdjustXOverflow, "AdjustXOverflow");
+    Functor adjustXOverlfowEnd(&Object::AdjustXOverflowEnd, "AdjustXOverflowEnd");
     AdjustXOverflowParams adjustXOverflowParams(0);
-    adjustXOverflowParams.m_currentSystem = dynamic_cast<System *>(this->GetFirstAncestor(SYSTEM));
+    adjustXOverflowParams.m_currentSystem = vrv_cast<System *>(this->GetFirstAncestor(SYSTEM));
     assert(adjustXOverflowParams.m_currentSystem);
     adjustXOverflowParams.m_lastMeasure = this;
     this->Process(&adjustXOverlfow, &adjustXOverflowParams, &adjustXOverlfowEnd);
@@ -336,6 +341,145 @@ void Measure::SetDrawingScoreDef(ScoreDef *drawingScoreDef)
     *m_drawingScoreDef = *drawingScoreDef;
 }
 
+void Measure::StoreHorizontalLayout(LayoutStep step)
+{
+    std::vector<int> xRels;
+    for (auto child : *m_measureAligner.GetChildren()) {
+        Alignment *alignment = vrv_cast<Alignment *>(child);
+        assert(alignment);
+        xRels.push_back(alignment->GetXRel());
+    }
+
+    // The relative positions of the layer elements are stored too because some are cumulated by the vertical layout
+    ArrayOfObjects elements;
+    IsLayerElementComparison isLayerElement;
+    this->FindAllDescendantByComparison(&elements, &isLayerElement);
+    std::vector<std::pair<int, int>> elementRels;
+    for (auto object : elements) {
+        LayerElement *element = vrv_cast<LayerElement *>(object);
+        assert(element);
+        elementRels.push_back(std::make_pair(element->GetDrawingXRel(), element->GetDrawingYRel()));
+    }
+
+    switch (step) {
+        case LAYOUT_ALIGNED:
+            m_storedAlignmentXRels.swap(xRels);
+            m_storedElementRels.swap(elementRels);
+            m_storedAdjustedAlignmentXRels.clear();
+            m_storedElementOffsets.clear();
+            break;
+        case LAYOUT_DRAWN: m_storedElementOffsets.swap(elementRels); break;
+        case LAYOUT_ADJUSTED:
+            m_storedAdjustedAlignmentXRels.swap(xRels);
+            assert(m_storedElementOffsets.size() == elementRels.size());
+            for (int i = 0; i < (int)elementRels.size(); ++i) {
+                m_storedElementOffsets.at(i).first = elementRels.at(i).first - m_storedElementOffsets.at(i).first;
+                m_storedElementOffsets.at(i).second = elementRels.at(i).second - m_storedElementOffsets.at(i).second;
+            }
+            break;
+    }
+}
+
+bool Measure::RestoreHorizontalLayout()
+{
+    // The stored layout can be restored only once
+    std::vector<int> xRels;
+    xRels.swap(m_storedAlignmentXRels);
+    std::vector<std::pair<int, int>> elementRels;
+    elementRels.swap(m_storedElementRels);
+
+    bool restore = true;
+    if (xRels.empty() || m_isEdited || m_drawingScoreDef) restore = false;
+    if ((int)xRels.size() != m_measureAligner.GetChildCount()) restore = false;
+    if (m_storedAdjustedAlignmentXRels.size() != xRels.size()) restore = false;
+
+    // Staves hidden by the optimization and scoreDef or cautionary elements depend on the system breaks
+    ArrayOfObjects layers;
+    ClassIdComparison matchLayer(LAYER);
+    if (restore) this->FindAllDescendantByComparison(&layers, &matchLayer, 2);
+    for (auto object : layers) {
+        Layer *layer = vrv_cast<Layer *>(object);
+        assert(layer);
+        if (layer->HasStaffDef() || layer->HasCautionStaffDef()) restore = false;
+        Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+        assert(staff);
+        if (!staff->DrawingIsVisible()) restore = false;
+    }
+
+    // The placement of the articulations is only known after the vertical layout and changes their bounding boxes
+    if (restore && this->FindDescendantByType(ARTIC)) restore = false;
+
+    ArrayOfObjects elements;
+    IsLayerElementComparison isLayerElement;
+    if (restore) this->FindAllDescendantByComparison(&elements, &isLayerElement);
+    if ((elements.size() != elementRels.size()) || (elements.size() != m_storedElementOffsets.size())) {
+        restore = false;
+    }
+
+    if (!restore) {
+        this->ClearStoredHorizontalLayout();
+        return false;
+    }
+
+    // As done by ResetHorizontalAlignment
+    this->SetDrawingXRel(0);
+
+    int i = 0;
+    for (auto child : *m_measureAligner.GetChildren()) {
+        Alignment *alignment = vrv_cast<Alignment *>(child);
+        assert(alignment);
+        alignment->SetXRel(xRels.at(i++));
+    }
+    i = 0;
+    for (auto object : elements) {
+        LayerElement *element = vrv_cast<LayerElement *>(object);
+        assert(element);
+        element->SetDrawingXRel(elementRels.at(i).first);
+        element->SetDrawingYRel(elementRels.at(i).second);
+        ++i;
+    }
+
+    return true;
+}
+
+void Measure::RestoreAdjustedHorizontalLayout()
+{
+    std::vector<int> xRels;
+    xRels.swap(m_storedAdjustedAlignmentXRels);
+    std::vector<std::pair<int, int>> elementOffsets;
+    elementOffsets.swap(m_storedElementOffsets);
+
+    assert((int)xRels.size() == m_measureAligner.GetChildCount());
+    int i = 0;
+    for (auto child : *m_measureAligner.GetChildren()) {
+        Alignment *alignment = vrv_cast<Alignment *>(child);
+        assert(alignment);
+        alignment->SetXRel(xRels.at(i++));
+    }
+
+    ArrayOfObjects elements;
+    IsLayerElementComparison isLayerElement;
+    this->FindAllDescendantByComparison(&elements, &isLayerElement);
+    assert(elements.size() == elementOffsets.size());
+    i = 0;
+    for (auto object : elements) {
+        LayerElement *element = vrv_cast<LayerElement *>(object);
+        assert(element);
+        element->SetDrawingXRel(element->GetDrawingXRel() + elementOffsets.at(i).first);
+        element->SetDrawingYRel(element->GetDrawingYRel() + elementOffsets.at(i).second);
+        ++i;
+    }
+}
+
+void Measure::ClearStoredHorizontalLayout()
+{
+    // Swap with empty vectors since clearing them keeps their capacity
+    std::vector<int>().swap(m_storedAlignmentXRels);
+    std::vector<std::pair<int, int>>().swap(m_storedElementRels);
+    std::vector<int>().swap(m_storedAdjustedAlignmentXRels);
+    std::vector<std::pair<int, int>>().swap(m_storedElementOffsets);
+}
+
 std::vector<Staff *> Measure::GetFirstStaffGrpStaves(ScoreDef *scoreDef)
 {
     assert(scoreDef);
@@ -352,7 +496,7 @@ std::vector<Staff *> Measure::GetFirstStaffGrpStaves(ScoreDef *scoreDef)
 
     // Then the @n of each first staffDef
     for (staffGrpIter = staffGrps.begin(); staffGrpIter != staffGrps.end(); ++staffGrpIter) {
-        StaffDef *staffDef = dynamic_cast<StaffDef *>((*staffGrpIter)->GetFirst(STAFFDEF));
+        StaffDef *staffDef = vrv_cast<StaffDef *>((*staffGrpIter)->GetFirst(STAFFDEF));
         if (staffDef) staffList.push_back(staffDef->GetN());
     }
 
@@ -377,7 +521,7 @@ Staff *Measure::GetTopVisibleStaff()
     ClassIdComparison matchType(STAFF);
     this->FindAllDescendantByComparison(&staves, &matchType, 1);
     for (auto &child : staves) {
-        staff = dynamic_cast<Staff *>(child);
+        staff = vrv_cast<Staff *>(child);
         assert(staff);
         if (staff->DrawingIsVisible()) {
             break;
@@ -390,8 +534,7 @@ Staff *Measure::GetTopVisibleStaff()
 int Measure::EnclosesTime(int time) const
 {
     int repeat = 1;
-    int timeDuration = int(
-        m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX * 60.0 / m_currentTempo * 1000.0 + 0.5);
+    int timeDuration = this->GetRealTimeDurationMilliseconds();
     std::vector<double>::const_iterator iter;
     for (iter = m_realTimeOffsetMilliseconds.begin(); iter != m_realTimeOffsetMilliseconds.end(); ++iter) {
         if ((time >= *iter) && (time <= *iter + timeDuration)) return repeat;
@@ -406,6 +549,12 @@ double Measure::GetRealTimeOffsetMilliseconds(int repeat) const
     return m_realTimeOffsetMilliseconds.at(repeat - 1);
 }
 
+int Measure::GetRealTimeDurationMilliseconds() const
+{
+    return int(
+        m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX * 60.0 / m_currentTempo * 1000.0 + 0.5);
+}
+
 void Measure::SetDrawingBarLines(Measure *previous, bool systemBreak, bool scoreDefInsert)
 {
     // First set the right barline. If none then set a single one.
@@ -466,7 +615,7 @@ void Measure::SetDrawingBarLines(Measure *previous, bool systemBreak, bool score
 
 int Measure::ConvertAnalyticalMarkupEnd(FunctorParams *functorParams)
 {
-    ConvertAnalyticalMarkupParams *params = dynamic_cast<ConvertAnalyticalMarkupParams *>(functorParams);
+    ConvertAnalyticalMarkupParams *params = vrv_cast<ConvertAnalyticalMarkupParams *>(functorParams);
     assert(params);
 
     ArrayOfObjects::iterator iter;
@@ -481,7 +630,7 @@ int Measure::ConvertAnalyticalMarkupEnd(FunctorParams *functorParams)
 
 int Measure::ConvertToPageBased(FunctorParams *functorParams)
 {
-    ConvertToPageBasedParams *params = dynamic_cast<ConvertToPageBasedParams *>(functorParams);
+    ConvertToPageBasedParams *params = vrv_cast<ConvertToPageBasedParams *>(functorParams);
     assert(params);
 
     // Move itself to the pageBasedSystem - do not process children
@@ -492,7 +641,7 @@ int Measure::ConvertToPageBased(FunctorParams *functorParams)
 
 int Measure::ConvertToCastOffMensural(FunctorParams *functorParams)
 {
-    ConvertToCastOffMensuralParams *params = dynamic_cast<ConvertToCastOffMensuralParams *>(functorParams);
+    ConvertToCastOffMensuralParams *params = vrv_cast<ConvertToCastOffMensuralParams *>(functorParams);
     assert(params);
 
     // We are processing by staff/layer from the call below - we obviously do not want to loop...
@@ -529,7 +678,7 @@ int Measure::ConvertToCastOffMensural(FunctorParams *functorParams)
             params->m_segmentIdx = 1;
             params->m_targetMeasure = measure;
 
-            Functor convertToCastOffMensural(&Object::ConvertToCastOffMensural);
+            Functor convertToCastOffMensural(&Object::ConvertToCastOffMensural, "ConvertToCastOffMensural");
             this->Process(&convertToCastOffMensural, params, NULL, &filters);
         }
     }
@@ -545,7 +694,7 @@ int Measure::ConvertToCastOffMensural(FunctorParams *functorParams)
 
 int Measure::ConvertToUnCastOffMensural(FunctorParams *functorParams)
 {
-    ConvertToUnCastOffMensuralParams *params = dynamic_cast<ConvertToUnCastOffMensuralParams *>(functorParams);
+    ConvertToUnCastOffMensuralParams *params = vrv_cast<ConvertToUnCastOffMensuralParams *>(functorParams);
     assert(params);
 
     if (params->m_contentMeasure == NULL) {
@@ -576,7 +725,7 @@ int Measure::SaveEnd(FunctorParams *functorParams)
 
 int Measure::UnsetCurrentScoreDef(FunctorParams *functorParams)
 {
-    UnsetCurrentScoreDefParams *params = dynamic_cast<UnsetCurrentScoreDefParams *>(functorParams);
+    UnsetCurrentScoreDefParams *params = vrv_cast<UnsetCurrentScoreDefParams *>(functorParams);
     assert(params);
 
     if (m_drawingScoreDef) {
@@ -592,7 +741,7 @@ int Measure::UnsetCurrentScoreDef(FunctorParams *functorParams)
 
 int Measure::OptimizeScoreDef(FunctorParams *functorParams)
 {
-    OptimizeScoreDefParams *params = dynamic_cast<OptimizeScoreDefParams *>(functorParams);
+    OptimizeScoreDefParams *params = vrv_cast<OptimizeScoreDefParams *>(functorParams);
     assert(params);
 
     if (!params->m_doc->GetOptions()->m_condenseTempoPages.GetValue()) {
@@ -615,17 +764,18 @@ int Measure::ResetHorizontalAlignment(FunctorParams *functorParams)
         m_measureAligner.GetRightAlignment()->SetXRel(0);
     }
 
-    Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
+    Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment, "ResetHorizontalAlignment");
     m_timestampAligner.Process(&resetHorizontalAlignment, NULL);
 
     m_hasAlignmentRefWithMultipleLayers = false;
+    this->ClearStoredHorizontalLayout();
 
     return FUNCTOR_CONTINUE;
 }
 
 int Measure::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     if (m_xAbs != VRV_UNSET) m_xAbs /= params->m_page->GetPPUFactor();
@@ -636,7 +786,7 @@ int Measure::ApplyPPUFactor(FunctorParams *functorParams)
 
 int Measure::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     // clear the content of the measureAligner
@@ -656,7 +806,7 @@ int Measure::AlignHorizontally(FunctorParams *functorParams)
 
 int Measure::AlignHorizontallyEnd(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     // We also need to align the timestamps - we do it at the end since we need the *meterSig to be initialized by a
@@ -674,7 +824,7 @@ int Measure::AlignHorizontallyEnd(FunctorParams *functorParams)
 
 int Measure::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     // we also need to reset the staffNb
@@ -685,7 +835,7 @@ int Measure::AlignVertically(FunctorParams *functorParams)
 
 int Measure::AdjustArpegEnd(FunctorParams *functorParams)
 {
-    AdjustArpegParams *params = dynamic_cast<AdjustArpegParams *>(functorParams);
+    AdjustArpegParams *params = vrv_cast<AdjustArpegParams *>(functorParams);
     assert(params);
 
     if (!params->m_alignmentArpegTuples.empty()) {
@@ -699,7 +849,7 @@ int Measure::AdjustArpegEnd(FunctorParams *functorParams)
 
 int Measure::AdjustLayers(FunctorParams *functorParams)
 {
-    AdjustLayersParams *params = dynamic_cast<AdjustLayersParams *>(functorParams);
+    AdjustLayersParams *params = vrv_cast<AdjustLayersParams *>(functorParams);
     assert(params);
 
     if (!m_hasAlignmentRefWithMultipleLayers) return FUNCTOR_SIBLINGS;
@@ -724,7 +874,7 @@ int Measure::AdjustLayers(FunctorParams *functorParams)
 
 int Measure::AdjustAccidX(FunctorParams *functorParams)
 {
-    AdjustAccidXParams *params = dynamic_cast<AdjustAccidXParams *>(functorParams);
+    AdjustAccidXParams *params = vrv_cast<AdjustAccidXParams *>(functorParams);
     assert(params);
 
     params->m_currentMeasure = this;
@@ -736,7 +886,7 @@ int Measure::AdjustAccidX(FunctorParams *functorParams)
 
 int Measure::AdjustGraceXPos(FunctorParams *functorParams)
 {
-    AdjustGraceXPosParams *params = dynamic_cast<AdjustGraceXPosParams *>(functorParams);
+    AdjustGraceXPosParams *params = vrv_cast<AdjustGraceXPosParams *>(functorParams);
     assert(params);
 
     m_measureAligner.PushAlignmentsRight();
@@ -765,7 +915,7 @@ int Measure::AdjustGraceXPos(FunctorParams *functorParams)
 
 int Measure::AdjustXPos(FunctorParams *functorParams)
 {
-    AdjustXPosParams *params = dynamic_cast<AdjustXPosParams *>(functorParams);
+    AdjustXPosParams *params = vrv_cast<AdjustXPosParams *>(functorParams);
     assert(params);
 
     params->m_minPos = 0;
@@ -821,7 +971,7 @@ int Measure::AdjustXPos(FunctorParams *functorParams)
 
 int Measure::AdjustHarmGrpsSpacingEnd(FunctorParams *functorParams)
 {
-    AdjustHarmGrpsSpacingParams *params = dynamic_cast<AdjustHarmGrpsSpacingParams *>(functorParams);
+    AdjustHarmGrpsSpacingParams *params = vrv_cast<AdjustHarmGrpsSpacingParams *>(functorParams);
     assert(params);
 
     // At the end of the measure - pass it along for overlapping verses
@@ -836,7 +986,7 @@ int Measure::AdjustHarmGrpsSpacingEnd(FunctorParams *functorParams)
 
 int Measure::AdjustSylSpacingEnd(FunctorParams *functorParams)
 {
-    AdjustSylSpacingParams *params = dynamic_cast<AdjustSylSpacingParams *>(functorParams);
+    AdjustSylSpacingParams *params = vrv_cast<AdjustSylSpacingParams *>(functorParams);
     assert(params);
 
     // At the end of the measure - pass it along for overlapping verses
@@ -851,7 +1001,7 @@ int Measure::AdjustSylSpacingEnd(FunctorParams *functorParams)
 
 int Measure::AdjustXOverflow(FunctorParams *functorParams)
 {
-    AdjustXOverflowParams *params = dynamic_cast<AdjustXOverflowParams *>(functorParams);
+    AdjustXOverflowParams *params = vrv_cast<AdjustXOverflowParams *>(functorParams);
     assert(params);
 
     params->m_lastMeasure = this;
@@ -866,7 +1016,7 @@ int Measure::AdjustXOverflow(FunctorParams *functorParams)
 
 int Measure::SetAlignmentXPos(FunctorParams *functorParams)
 {
-    SetAlignmentXPosParams *params = dynamic_cast<SetAlignmentXPosParams *>(functorParams);
+    SetAlignmentXPosParams *params = vrv_cast<SetAlignmentXPosParams *>(functorParams);
     assert(params);
 
     m_measureAligner.Process(params->m_functor, params);
@@ -876,7 +1026,7 @@ int Measure::SetAlignmentXPos(FunctorParams *functorParams)
 
 int Measure::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     if (params->m_measureXRel > 0) {
@@ -893,7 +1043,7 @@ int Measure::JustifyX(FunctorParams *functorParams)
 
 int Measure::AlignMeasures(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     SetDrawingXRel(params->m_shift);
@@ -908,21 +1058,25 @@ int Measure::ResetDrawing(FunctorParams *functorParams)
 {
     this->m_timestampAligner.Reset();
     m_drawingEnding = NULL;
+    this->ClearStoredHorizontalLayout();
     return FUNCTOR_CONTINUE;
 }
 
 int Measure::CastOffSystems(FunctorParams *functorParams)
 {
-    CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
+    CastOffSystemsParams *params = vrv_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
+    // The measure is being laid out again
+    m_isEdited = false;
+
     // Check if the measure has some overlfowing control elements
     int overflow = this->GetDrawingOverflow();
 
     if (params->m_currentSystem->GetChildCount() > 0) {
         // We have overflowing content (dir, dynam, tempo) larger than 5 units, keep it as pending
         if (overflow > (params->m_doc->GetDrawingUnit(100) * 5)) {
-            Measure *measure = dynamic_cast<Measure *>(params->m_contentSystem->Relinquish(this->GetIdx()));
+            Measure *measure = vrv_cast<Measure *>(params->m_contentSystem->Relinquish(this->GetIdx()));
             assert(measure);
             // move as pending since we want it not to be broken with the next measure
             params->m_pendingObjects.push_back(measure);
@@ -946,7 +1100,7 @@ int Measure::CastOffSystems(FunctorParams *functorParams)
     params->m_pendingObjects.clear();
 
     // Special case where we use the Relinquish method.
-    Measure *measure = dynamic_cast<Measure *>(params->m_contentSystem->Relinquish(this->GetIdx()));
+    Measure *measure = vrv_cast<Measure *>(params->m_contentSystem->Relinquish(this->GetIdx()));
     assert(measure);
     params->m_currentSystem->AddChild(measure);
 
@@ -955,9 +1109,11 @@ int Measure::CastOffSystems(FunctorParams *functorParams)
 
 int Measure::CastOffEncoding(FunctorParams *functorParams)
 {
-    CastOffEncodingParams *params = dynamic_cast<CastOffEncodingParams *>(functorParams);
+    CastOffEncodingParams *params = vrv_cast<CastOffEncodingParams *>(functorParams);
     assert(params);
 
+    m_isEdited = false;
+
     MoveItselfTo(params->m_currentSystem);
 
     return FUNCTOR_SIBLINGS;
@@ -965,7 +1121,7 @@ int Measure::CastOffEncoding(FunctorParams *functorParams)
 
 int Measure::FillStaffCurrentTimeSpanningEnd(FunctorParams *functorParams)
 {
-    FillStaffCurrentTimeSpanningParams *params = dynamic_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
+    FillStaffCurrentTimeSpanningParams *params = vrv_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
     assert(params);
 
     std::vector<Object *>::iterator iter = params->m_timeSpanningElements.begin();
@@ -975,7 +1131,7 @@ int Measure::FillStaffCurrentTimeSpanningEnd(FunctorParams *functorParams)
             TimeSpanningInterface *interface = (*iter)->GetTimeSpanningInterface();
             assert(interface);
             if (interface->GetEnd()) {
-                endParent = dynamic_cast<Measure *>(interface->GetEnd()->GetFirstAncestor(MEASURE));
+                endParent = vrv_cast<Measure *>(interface->GetEnd()->GetFirstAncestor(MEASURE));
             }
         }
         if (!endParent && (*iter)->HasInterface(INTERFACE_LINKING)) {
@@ -985,7 +1141,7 @@ int Measure::FillStaffCurrentTimeSpanningEnd(FunctorParams *functorParams)
                 // We should have one because we allow only control Event (dir and dynam) to be linked as target
                 TimePointInterface *nextInterface = interface->GetNextLink()->GetTimePointInterface();
                 assert(nextInterface);
-                endParent = dynamic_cast<Measure *>(nextInterface->GetStart()->GetFirstAncestor(MEASURE));
+                endParent = vrv_cast<Measure *>(nextInterface->GetStart()->GetFirstAncestor(MEASURE));
             }
         }
         assert(endParent);
@@ -1002,7 +1158,7 @@ int Measure::FillStaffCurrentTimeSpanningEnd(FunctorParams *functorParams)
 
 int Measure::PrepareBoundaries(FunctorParams *functorParams)
 {
-    PrepareBoundariesParams *params = dynamic_cast<PrepareBoundariesParams *>(functorParams);
+    PrepareBoundariesParams *params = vrv_cast<PrepareBoundariesParams *>(functorParams);
     assert(params);
 
     std::vector<BoundaryStartInterface *>::iterator iter;
@@ -1024,7 +1180,7 @@ int Measure::PrepareBoundaries(FunctorParams *functorParams)
 
 int Measure::PrepareCrossStaff(FunctorParams *functorParams)
 {
-    PrepareCrossStaffParams *params = dynamic_cast<PrepareCrossStaffParams *>(functorParams);
+    PrepareCrossStaffParams *params = vrv_cast<PrepareCrossStaffParams *>(functorParams);
     assert(params);
 
     params->m_currentMeasure = this;
@@ -1034,7 +1190,7 @@ int Measure::PrepareCrossStaff(FunctorParams *functorParams)
 
 int Measure::PrepareFloatingGrps(FunctorParams *functorParams)
 {
-    PrepareFloatingGrpsParams *params = dynamic_cast<PrepareFloatingGrpsParams *>(functorParams);
+    PrepareFloatingGrpsParams *params = vrv_cast<PrepareFloatingGrpsParams *>(functorParams);
     assert(params);
 
     if (params->m_previousEnding) {
@@ -1047,7 +1203,7 @@ int Measure::PrepareFloatingGrps(FunctorParams *functorParams)
 
 int Measure::PrepareFloatingGrpsEnd(FunctorParams *functorParams)
 {
-    PrepareFloatingGrpsParams *params = dynamic_cast<PrepareFloatingGrpsParams *>(functorParams);
+    PrepareFloatingGrpsParams *params = vrv_cast<PrepareFloatingGrpsParams *>(functorParams);
     assert(params);
 
     params->m_dynams.clear();
@@ -1055,7 +1211,7 @@ int Measure::PrepareFloatingGrpsEnd(FunctorParams *functorParams)
     std::vector<Hairpin *>::iterator iter = params->m_hairpins.begin();
     while (iter != params->m_hairpins.end()) {
         assert((*iter)->GetEnd());
-        Measure *measureEnd = dynamic_cast<Measure *>((*iter)->GetEnd()->GetFirstAncestor(MEASURE));
+        Measure *measureEnd = vrv_cast<Measure *>((*iter)->GetEnd()->GetFirstAncestor(MEASURE));
         if (measureEnd == this) {
             iter = params->m_hairpins.erase(iter);
         }
@@ -1069,7 +1225,7 @@ int Measure::PrepareFloatingGrpsEnd(FunctorParams *functorParams)
 
 int Measure::PrepareTimePointingEnd(FunctorParams *functorParams)
 {
-    PrepareTimePointingParams *params = dynamic_cast<PrepareTimePointingParams *>(functorParams);
+    PrepareTimePointingParams *params = vrv_cast<PrepareTimePointingParams *>(functorParams);
     assert(params);
 
     if (!params->m_timePointingInterfaces.empty()) {
@@ -1087,7 +1243,7 @@ int Measure::PrepareTimePointingEnd(FunctorParams *functorParams)
 
 int Measure::PrepareTimeSpanningEnd(FunctorParams *functorParams)
 {
-    PrepareTimeSpanningParams *params = dynamic_cast<PrepareTimeSpanningParams *>(functorParams);
+    PrepareTimeSpanningParams *params = vrv_cast<PrepareTimeSpanningParams *>(functorParams);
     assert(params);
 
     ArrayOfSpanningInterClassIdPairs::iterator iter = params->m_timeSpanningInterfaces.begin();
@@ -1108,7 +1264,7 @@ int Measure::PrepareTimeSpanningEnd(FunctorParams *functorParams)
 
 int Measure::PrepareTimestampsEnd(FunctorParams *functorParams)
 {
-    PrepareTimestampsParams *params = dynamic_cast<PrepareTimestampsParams *>(functorParams);
+    PrepareTimestampsParams *params = vrv_cast<PrepareTimestampsParams *>(functorParams);
     assert(params);
 
     ArrayOfObjectBeatPairs::iterator iter = params->m_tstamps.begin();
@@ -1171,7 +1327,7 @@ int Measure::PrepareTimestampsEnd(FunctorParams *functorParams)
 
 int Measure::GenerateMIDI(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
     // Here we need to update the m_totalTime from the starting time of the measure.
@@ -1187,7 +1343,7 @@ int Measure::GenerateMIDI(FunctorParams *functorParams)
 
 int Measure::GenerateTimemap(FunctorParams *functorParams)
 {
-    GenerateTimemapParams *params = dynamic_cast<GenerateTimemapParams *>(functorParams);
+    GenerateTimemapParams *params = vrv_cast<GenerateTimemapParams *>(functorParams);
     assert(params);
 
     // Deal with repeated music later, for now get the last times.
@@ -1200,7 +1356,7 @@ int Measure::GenerateTimemap(FunctorParams *functorParams)
 
 int Measure::CalcMaxMeasureDuration(FunctorParams *functorParams)
 {
-    CalcMaxMeasureDurationParams *params = dynamic_cast<CalcMaxMeasureDurationParams *>(functorParams);
+    CalcMaxMeasureDurationParams *params = vrv_cast<CalcMaxMeasureDurationParams *>(functorParams);
     assert(params);
 
     m_scoreTimeOffset.clear();
@@ -1208,7 +1364,7 @@ int Measure::CalcMaxMeasureDuration(FunctorParams *functorParams)
     params->m_maxCurrentScoreTime += m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX;
 
     // search for tempo marks in the measure
-    Tempo *tempo = dynamic_cast<Tempo *>(this->FindDescendantByType(TEMPO));
+    Tempo *tempo = vrv_cast<Tempo *>(this->FindDescendantByType(TEMPO));
     if (tempo && tempo->HasMidiBpm()) {
         params->m_currentTempo = tempo->GetMidiBpm();
     }
@@ -1236,7 +1392,7 @@ int Measure::CalcMaxMeasureDuration(FunctorParams *functorParams)
 
 int Measure::CalcOnsetOffset(FunctorParams *functorParams)
 {
-    CalcOnsetOffsetParams *params = dynamic_cast<CalcOnsetOffsetParams *>(functorParams);
+    CalcOnsetOffsetParams *params = vrv_cast<CalcOnsetOffsetParams *>(functorParams);
     assert(params);
 
     params->m_currentTempo = m_currentTempo;
@@ -49,7 +49,7 @@ void MRest::Reset()
 
 int MRest::ConvertAnalyticalMarkup(FunctorParams *functorParams)
 {
-    ConvertAnalyticalMarkupParams *params = dynamic_cast<ConvertAnalyticalMarkupParams *>(functorParams);
+    ConvertAnalyticalMarkupParams *params = vrv_cast<ConvertAnalyticalMarkupParams *>(functorParams);
     assert(params);
 
     if (this->HasFermata()) {
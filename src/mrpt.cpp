@@ -58,7 +58,7 @@ int MRpt::GenerateMIDI(FunctorParams *functorParams)
 
 int MRpt::PrepareRpt(FunctorParams *functorParams)
 {
-    PrepareRptParams *params = dynamic_cast<PrepareRptParams *>(functorParams);
+    PrepareRptParams *params = vrv_cast<PrepareRptParams *>(functorParams);
     assert(params);
 
     // If multiNumber is not true, nothing needs to be done
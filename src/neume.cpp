@@ -104,7 +104,7 @@ NeumeGroup Neume::GetNeumeGroup()
     std::string key = "";
 
     for (; iter != children.end(); iter++) {
-        Nc *current = dynamic_cast<Nc *>(*iter);
+        Nc *current = vrv_cast<Nc *>(*iter);
         assert(current);
 
         int pitchDifference = current->PitchDifferenceTo(previous);
@@ -119,7 +119,10 @@ NeumeGroup Neume::GetNeumeGroup()
         }
         previous = current;
     }
-    return s_neumes[key];
+    // Do not use operator[] since the map is shared between threads
+    std::map<std::string, NeumeGroup>::const_iterator it = s_neumes.find(key);
+    if (it == s_neumes.end()) return NEUME_ERROR;
+    return it->second;
 }
 
 std::vector<int> Neume::GetPitchDifferences()
@@ -138,7 +141,7 @@ std::vector<int> Neume::GetPitchDifferences()
     iter++;
 
     for (; iter != ncChildren.end(); iter++) {
-        Nc *current = dynamic_cast<Nc *>(*iter);
+        Nc *current = vrv_cast<Nc *>(*iter);
         assert(current);
         pitchDifferences.push_back(current->PitchDifferenceTo(previous));
         previous = current;
@@ -160,7 +163,7 @@ bool Neume::GenerateChildMelodic()
 
     // Iterate on second to last neume component and add intm value
     for (; iter != children.end(); iter++) {
-        Nc *current = dynamic_cast<Nc *>(*iter);
+        Nc *current = vrv_cast<Nc *>(*iter);
         assert(current);
         std::string intmValue;
 
@@ -116,7 +116,7 @@ bool Note::HasToBeAligned() const
 {
     if (!this->IsInLigature()) return true;
     Note *note = const_cast<Note *>(this);
-    Ligature *ligature = dynamic_cast<Ligature *>(note->GetFirstAncestor(LIGATURE));
+    Ligature *ligature = vrv_cast<Ligature *>(note->GetFirstAncestor(LIGATURE));
     assert(ligature);
     return ((note == ligature->GetFirstNote()) || (note == ligature->GetLastNote()));
 }
@@ -174,18 +174,18 @@ void Note::AddChild(Object *child)
 
 Accid *Note::GetDrawingAccid()
 {
-    Accid *accid = dynamic_cast<Accid *>(this->FindDescendantByType(ACCID));
+    Accid *accid = vrv_cast<Accid *>(this->FindDescendantByType(ACCID));
     return accid;
 }
 
 Chord *Note::IsChordTone() const
 {
-    return dynamic_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
+    return vrv_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
 }
 
 int Note::GetDrawingDur() const
 {
-    Chord *chordParent = dynamic_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
+    Chord *chordParent = vrv_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
     if (chordParent && !this->HasDur()) {
         return chordParent->GetActualDur();
     }
@@ -250,7 +250,7 @@ Point Note::GetStemUpSE(Doc *doc, int staffSize, bool isCueSize)
         return p;
     }
 
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = doc->GetResources().GetGlyph(code);
     assert(glyph);
 
     if (glyph->HasAnchor(SMUFL_stemUpSE)) {
@@ -289,7 +289,7 @@ Point Note::GetStemDownNW(Doc *doc, int staffSize, bool isCueSize)
         return p;
     }
 
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = doc->GetResources().GetGlyph(code);
     assert(glyph);
 
     if (glyph->HasAnchor(SMUFL_stemDownNW)) {
@@ -312,7 +312,7 @@ wchar_t Note::GetMensuralSmuflNoteHead()
         return 0;
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
     bool mensural_black = (staff->m_drawingNotationType == NOTATIONTYPE_mensural_black);
 
@@ -348,7 +348,7 @@ bool Note::IsVisible()
     }
     // if the chord doens't have it, see if all the children are invisible
     else if (GetParent() && GetParent()->Is(CHORD)) {
-        Chord *chord = dynamic_cast<Chord *>(GetParent());
+        Chord *chord = vrv_cast<Chord *>(GetParent());
         assert(chord);
         return chord->IsVisible();
     }
@@ -481,7 +481,7 @@ void Note::UpdateFromTransPitch(const TransPitch &tp)
 
 int Note::ConvertAnalyticalMarkup(FunctorParams *functorParams)
 {
-    ConvertAnalyticalMarkupParams *params = dynamic_cast<ConvertAnalyticalMarkupParams *>(functorParams);
+    ConvertAnalyticalMarkupParams *params = vrv_cast<ConvertAnalyticalMarkupParams *>(functorParams);
     assert(params);
 
     /****** ties ******/
@@ -537,7 +537,7 @@ int Note::ConvertAnalyticalMarkup(FunctorParams *functorParams)
 
 int Note::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
+    CalcStemParams *params = vrv_cast<CalcStemParams *>(functorParams);
     assert(params);
 
     if (!this->IsVisible() || (this->GetStemVisible() == BOOLEAN_false)) {
@@ -566,9 +566,9 @@ int Note::CalcStem(FunctorParams *functorParams)
 
     Stem *stem = this->GetDrawingStem();
     assert(stem);
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstAncestor(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstAncestor(LAYER));
     assert(layer);
 
     if (this->m_crossStaff) staff = this->m_crossStaff;
@@ -613,10 +613,10 @@ int Note::CalcStem(FunctorParams *functorParams)
 
 int Note::CalcChordNoteHeads(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
 
     // Nothing to do for notes that are not in a cluster
@@ -665,7 +665,7 @@ int Note::CalcChordNoteHeads(FunctorParams *functorParams)
 
 int Note::CalcDots(FunctorParams *functorParams)
 {
-    CalcDotsParams *params = dynamic_cast<CalcDotsParams *>(functorParams);
+    CalcDotsParams *params = vrv_cast<CalcDotsParams *>(functorParams);
     assert(params);
 
     // We currently have no dots object with mensural notes
@@ -676,7 +676,7 @@ int Note::CalcDots(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
 
     if (this->m_crossStaff) staff = this->m_crossStaff;
@@ -706,7 +706,7 @@ int Note::CalcDots(FunctorParams *functorParams)
     }
     else if (this->GetDots() > 0) {
         // For single notes we need here to set the dot loc
-        dots = dynamic_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
+        dots = vrv_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
         assert(dots);
         params->m_chordDrawingX = this->GetDrawingX();
 
@@ -738,14 +738,14 @@ int Note::CalcDots(FunctorParams *functorParams)
 
 int Note::CalcLedgerLines(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     if (this->GetVisible() == BOOLEAN_false) {
         return FUNCTOR_SIBLINGS;
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
 
     if (!this->IsVisible()) {
@@ -797,10 +797,10 @@ int Note::CalcLedgerLines(FunctorParams *functorParams)
 
 int Note::PrepareLayerElementParts(FunctorParams *functorParams)
 {
-    Stem *currentStem = dynamic_cast<Stem *>(this->FindDescendantByType(STEM, 1));
+    Stem *currentStem = vrv_cast<Stem *>(this->FindDescendantByType(STEM, 1));
     Flag *currentFlag = NULL;
     Chord *chord = this->IsChordTone();
-    if (currentStem) currentFlag = dynamic_cast<Flag *>(currentStem->FindDescendantByType(FLAG, 1));
+    if (currentStem) currentFlag = vrv_cast<Flag *>(currentStem->FindDescendantByType(FLAG, 1));
 
     if (!this->IsChordTone() && !this->IsMensural()) {
         if (!currentStem) {
@@ -842,7 +842,7 @@ int Note::PrepareLayerElementParts(FunctorParams *functorParams)
 
     /************ dots ***********/
 
-    Dots *currentDots = dynamic_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
+    Dots *currentDots = vrv_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
 
     if (this->GetDots() > 0) {
         if (chord && (chord->GetDots() == this->GetDots())) {
@@ -864,7 +864,7 @@ int Note::PrepareLayerElementParts(FunctorParams *functorParams)
 
     /************ Prepare the drawing cue size ************/
 
-    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize);
+    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize, "PrepareDrawingCueSize");
     this->Process(&prepareDrawingCueSize, NULL);
 
     return FUNCTOR_CONTINUE;
@@ -872,7 +872,7 @@ int Note::PrepareLayerElementParts(FunctorParams *functorParams)
 
 int Note::PrepareLyrics(FunctorParams *functorParams)
 {
-    PrepareLyricsParams *params = dynamic_cast<PrepareLyricsParams *>(functorParams);
+    PrepareLyricsParams *params = vrv_cast<PrepareLyricsParams *>(functorParams);
     assert(params);
 
     params->m_lastButOneNote = params->m_lastNote;
@@ -886,7 +886,7 @@ int Note::PreparePointersByLayer(FunctorParams *functorParams)
     // Call parent one too
     LayerElement::PreparePointersByLayer(functorParams);
 
-    PreparePointersByLayerParams *params = dynamic_cast<PreparePointersByLayerParams *>(functorParams);
+    PreparePointersByLayerParams *params = vrv_cast<PreparePointersByLayerParams *>(functorParams);
     assert(params);
 
     params->m_currentNote = this;
@@ -919,10 +919,10 @@ int Note::ResetHorizontalAlignment(FunctorParams *functorParams)
 
 int Note::GenerateMIDI(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
-    Note *note = dynamic_cast<Note *>(this->ThisOrSameasAsLink());
+    Note *note = vrv_cast<Note *>(this->ThisOrSameasAsLink());
     assert(note);
 
     // If the note is a secondary tied note, then ignore it
@@ -977,10 +977,10 @@ int Note::GenerateMIDI(FunctorParams *functorParams)
 
 int Note::GenerateTimemap(FunctorParams *functorParams)
 {
-    GenerateTimemapParams *params = dynamic_cast<GenerateTimemapParams *>(functorParams);
+    GenerateTimemapParams *params = vrv_cast<GenerateTimemapParams *>(functorParams);
     assert(params);
 
-    Note *note = dynamic_cast<Note *>(this->ThisOrSameasAsLink());
+    Note *note = vrv_cast<Note *>(this->ThisOrSameasAsLink());
     assert(note);
 
     double realTimeStart = params->m_realTimeOffsetMilliseconds + note->GetRealTimeOnsetMilliseconds();
@@ -1010,7 +1010,7 @@ int Note::GenerateTimemap(FunctorParams *functorParams)
 
 int Note::Transpose(FunctorParams *functorParams)
 {
-    TransposeParams *params = dynamic_cast<TransposeParams *>(functorParams);
+    TransposeParams *params = vrv_cast<TransposeParams *>(functorParams);
     assert(params);
 
     LogDebug("Transposing note");
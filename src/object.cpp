@@ -9,9 +9,14 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
+#include <climits>
 #include <iostream>
 #include <math.h>
+#include <mutex>
+#include <random>
+#include <set>
 #include <sstream>
 
 //----------------------------------------------------------------------------
@@ -51,22 +56,50 @@ namespace vrv {
 // Object
 //----------------------------------------------------------------------------
 
-unsigned long Object::s_objectCounter = 0;
+/** The uuid prefixes, shared by all the objects of a class and never deleted */
+static std::mutex s_classidsMutex;
+
+static std::set<std::string> &GetClassids()
+{
+    static std::set<std::string> *classids = new std::set<std::string>();
+    return *classids;
+}
+
+static const std::string *InternClassid(const std::string &classid)
+{
+    static thread_local std::map<std::string, const std::string *> cache;
+    auto cached = cache.find(classid);
+    if (cached != cache.end()) return cached->second;
+
+    std::lock_guard<std::mutex> lock(s_classidsMutex);
+    const std::string *interned = &(*GetClassids().insert(classid).first);
+    cache[classid] = interned;
+    return interned;
+}
+
+/** The interned uuid prefix, or NULL if it is not the one of any class */
+static const std::string *FindClassid(const std::string &classid)
+{
+    std::lock_guard<std::mutex> lock(s_classidsMutex);
+    auto interned = GetClassids().find(classid);
+    return (interned != GetClassids().end()) ? &(*interned) : NULL;
+}
+
+/** The uuid prefix of the Doc, for recognizing it without a virtual call when the objects are deleted */
+static const std::string *s_docClassid = InternClassid("doc-");
+
+/** The random number generator for the uuids - one per thread, seeded on first use or with Object::SeedUuid */
+static thread_local std::mt19937 s_uuidGenerator;
+static thread_local bool s_uuidGeneratorSeeded = false;
 
 Object::Object() : BoundingBox()
 {
     Init("m-");
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
 }
 
 Object::Object(const std::string& classid) : BoundingBox()
 {
     Init(classid);
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
 }
 
 Object *Object::Clone() const
@@ -86,12 +119,12 @@ Object::Object(const Object &object) : BoundingBox(object)
 
     // Flags
     m_isAttribute = object.m_isAttribute;
+    m_isExpansion = false;
     m_isModified = true;
     m_isReferenceObject = object.m_isReferenceObject;
 
     // Also copy attribute classes
-    m_attClasses = object.m_attClasses;
-    m_interfaces = object.m_interfaces;
+    m_attClassTable = object.m_attClassTable;
     // New uuid
     this->GenerateUuid();
     // For now do not copy them
@@ -135,8 +168,7 @@ Object &Object::operator=(const Object &object)
         m_isReferenceObject = object.m_isReferenceObject;
 
         // Also copy attribute classes
-        m_attClasses = object.m_attClasses;
-        m_interfaces = object.m_interfaces;
+        m_attClassTable = object.m_attClassTable;
         // New uuid
         this->GenerateUuid();
         // For now do now copy them
@@ -158,15 +190,18 @@ Object &Object::operator=(const Object &object)
 
 Object::~Object()
 {
-    ClearChildren();
+    // The indexes of the Doc were updated when the object or one of its ancestors was detached or deleted
+    this->DeleteChildren();
 }
 
 void Object::Init(const std::string& classid)
 {
-    m_classid = classid;
+    m_classid = InternClassid(classid);
+    m_attClassTable = AttClassTable::GetEmpty();
     m_parent = NULL;
     // Flags
     m_isAttribute = false;
+    m_isExpansion = false;
     m_isModified = true;
     m_isReferenceObject = false;
 
@@ -195,16 +230,10 @@ void Object::Reset()
     ResetBoundingBox();
 }
 
-void Object::RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId)
-{
-    m_attClasses.insert(m_attClasses.end(), attClasses->begin(), attClasses->end());
-    m_interfaces.push_back(interfaceId);
-}
-
 bool Object::IsBoundaryElement()
 {
     if (this->IsEditorialElement() || this->Is(ENDING) || this->Is(SECTION)) {
-        BoundaryStartInterface *interface = dynamic_cast<BoundaryStartInterface *>(this);
+        BoundaryStartInterface *interface = vrv_cross_cast<BoundaryStartInterface *>(this);
         assert(interface);
         return (interface->IsBoundary());
     }
@@ -240,6 +269,7 @@ void Object::ReplaceChild(Object *currentChild, Object *replacingChild)
     assert(this->GetChildIndex(replacingChild) == -1);
 
     int idx = this->GetChildIndex(currentChild);
+    this->RemoveFromDocIndexes(currentChild);
     currentChild->ResetParent();
     m_children.at(idx) = replacingChild;
     replacingChild->SetParent(this);
@@ -287,9 +317,66 @@ void Object::MoveItselfTo(Object *targetParent)
     targetParent->AddChild(relinquishedObject);
 }
 
+std::string Object::GetUuid() const
+{
+    if (m_uuidNr < 0) return m_uuid;
+
+    std::string uuid;
+    uuid.reserve(m_classid->size() + 16);
+    uuid = *m_classid;
+    char digits[16];
+    int nr = m_uuidNr;
+    for (int i = 15; i >= 0; --i) {
+        digits[i] = '0' + nr % 10;
+        nr /= 10;
+    }
+    uuid.append(digits, 16);
+    return uuid;
+}
+
+UuidKey Object::GetUuidKey() const
+{
+    if (m_uuidNr < 0) return UuidToKey(m_uuid);
+
+    UuidKey key;
+    key.m_prefix = m_classid;
+    key.m_nr = m_uuidNr;
+    return key;
+}
+
+UuidKey Object::UuidToKey(const std::string &uuid)
+{
+    UuidKey key;
+    // A prefix and 16 digits with a number stored as in SetUuid
+    if ((uuid.size() >= 16)
+        && std::all_of(uuid.end() - 16, uuid.end(), [](char c) { return (c >= '0') && (c <= '9'); })) {
+        const long long nr = std::stoll(uuid.substr(uuid.size() - 16));
+        key.m_prefix = (nr <= INT_MAX) ? FindClassid(uuid.substr(0, uuid.size() - 16)) : NULL;
+        if (key.m_prefix) {
+            key.m_nr = (int)nr;
+            return key;
+        }
+    }
+    key.m_uuid = uuid;
+    return key;
+}
+
 void Object::SetUuid(std::string uuid)
 {
+    m_uuidNr = -1;
     m_uuid = uuid;
+    // Store the uuids in the format of the generated ones as a number
+    const size_t prefixLength = m_classid->size();
+    if ((uuid.size() == prefixLength + 16) && !uuid.compare(0, prefixLength, *m_classid)
+        && std::all_of(uuid.begin() + prefixLength, uuid.end(), [](char c) { return (c >= '0') && (c <= '9'); })) {
+        const long long nr = std::stoll(uuid.substr(prefixLength));
+        if (nr <= INT_MAX) {
+            m_uuidNr = (int)nr;
+            m_uuid.clear();
+        }
+    }
+    // The uuid index of the Doc needs to be rebuilt
+    this->Modify();
 }
 
 void Object::SwapUuid(Object *other)
@@ -300,13 +387,37 @@ void Object::SwapUuid(Object *other)
     other->SetUuid(swapUuid);
 }
 
+const ArrayOfStrAttr &Object::GetUnsupportedAttrs() const
+{
+    static const ArrayOfStrAttr none;
+    return (m_extraData) ? m_extraData->m_unsupported : none;
+}
+
+Object::ExtraData *Object::GetExtraData()
+{
+    if (!m_extraData) m_extraData.reset(new ExtraData());
+    return m_extraData.get();
+}
+
 void Object::ClearChildren()
+{
+    for (auto child : m_children) {
+        if (child->GetParent() == this) this->RemoveFromDocIndexes(child);
+    }
+    this->DeleteChildren();
+}
+
+void Object::DeleteChildren()
 {
     if (m_isReferenceObject) {
         m_children.clear();
         return;
     }
 
+    if (m_children.empty()) {
+        return;
+    }
+
     ArrayOfObjects::iterator iter;
     for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
         // we need to check if this is the parent
@@ -316,6 +427,7 @@ void Object::ClearChildren()
         }
     }
     m_children.clear();
+    this->Modify();
 }
 
 int Object::GetChildCount(const ClassId classId) const
@@ -350,7 +462,7 @@ int Object::GetAttributes(ArrayOfStrAttr *attributes) const
     Att::GetShared(this, attributes);
     Att::GetVisual(this, attributes);
 
-    for (auto &pair : m_unsupported) {
+    for (auto &pair : this->GetUnsupportedAttrs()) {
         attributes->push_back(std::make_pair(pair.first, pair.second));
     }
 
@@ -439,9 +551,11 @@ Object *Object::DetachChild(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    this->RemoveFromDocIndexes(child);
     child->ResetParent();
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.erase(iter + (idx));
+    this->Modify();
     return child;
 }
 
@@ -467,7 +581,9 @@ Object *Object::Relinquish(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    this->RemoveFromDocIndexes(child);
     child->ResetParent();
+    this->Modify();
     return child;
 }
 
@@ -485,7 +601,7 @@ void Object::ClearRelinquishedChildren()
 
 Object *Object::FindDescendantByUuid(std::string uuid, int deepness, bool direction)
 {
-    Functor findByUuid(&Object::FindByUuid);
+    Functor findByUuid(&Object::FindByUuid, "FindByUuid");
     FindByUuidParams findbyUuidParams;
     findbyUuidParams.m_uuid = uuid;
     this->Process(&findByUuid, &findbyUuidParams, NULL, NULL, deepness, direction);
@@ -500,7 +616,7 @@ Object *Object::FindDescendantByType(ClassId classId, int deepness, bool directi
 
 Object *Object::FindDescendantByComparison(Comparison *comparison, int deepness, bool direction)
 {
-    Functor findByComparison(&Object::FindByComparison);
+    Functor findByComparison(&Object::FindByComparison, "FindByComparison");
     FindByComparisonParams findByComparisonParams(comparison);
     this->Process(&findByComparison, &findByComparisonParams, NULL, NULL, deepness, direction);
     return findByComparisonParams.m_element;
@@ -508,7 +624,7 @@ Object *Object::FindDescendantByComparison(Comparison *comparison, int deepness,
 
 Object *Object::FindDescendantExtremeByComparison(Comparison *comparison, int deepness, bool direction)
 {
-    Functor findExtremeByComparison(&Object::FindExtremeByComparison);
+    Functor findExtremeByComparison(&Object::FindExtremeByComparison, "FindExtremeByComparison");
     FindExtremeByComparisonParams findExtremeByComparisonParams(comparison);
     this->Process(&findExtremeByComparison, &findExtremeByComparisonParams, NULL, NULL, deepness, direction);
     return findExtremeByComparisonParams.m_element;
@@ -520,7 +636,7 @@ void Object::FindAllDescendantByComparison(
     assert(objects);
     if (clear) objects->clear();
 
-    Functor findAllByComparison(&Object::FindAllByComparison);
+    Functor findAllByComparison(&Object::FindAllByComparison, "FindAllByComparison");
     FindAllByComparisonParams findAllByComparisonParams(comparison, objects);
     this->Process(&findAllByComparison, &findAllByComparisonParams, NULL, NULL, deepness, direction);
 }
@@ -531,7 +647,7 @@ void Object::FindAllDescendantBetween(
     assert(objects);
     if (clear) objects->clear();
 
-    Functor findAllBetween(&Object::FindAllBetween);
+    Functor findAllBetween(&Object::FindAllBetween, "FindAllBetween");
     FindAllBetweenParams findAllBetweenParams(comparison, objects, start, end);
     this->Process(&findAllBetween, &findAllBetweenParams);
 }
@@ -559,6 +675,7 @@ bool Object::DeleteChild(Object *child)
 {
     auto it = std::find(m_children.begin(), m_children.end(), child);
     if (it != m_children.end()) {
+        this->RemoveFromDocIndexes(child);
         m_children.erase(it);
         if (!m_isReferenceObject) {
             delete child;
@@ -574,28 +691,31 @@ bool Object::DeleteChild(Object *child)
 
 void Object::GenerateUuid()
 {
-    int nr = std::rand();
-    char str[17];
-    // I do not want to use a stream for doing this!
-    snprintf(str, 17, "%016d", nr);
-
-    m_uuid = m_classid + std::string(str);
+    if (!s_uuidGeneratorSeeded) {
+        SeedUuid();
+    }
+    // Keep 31 bits for having positive values only
+    m_uuidNr = (int)(s_uuidGenerator() >> 1);
+    m_uuid.clear();
 }
 
 void Object::ResetUuid()
 {
     GenerateUuid();
+    this->Modify();
 }
 
 void Object::SeedUuid(unsigned int seed)
 {
-    // Init random number generator for uuids
+    // Init random number generator for uuids of the current thread
     if (seed == 0) {
-        std::srand((unsigned int)std::time(0));
+        std::random_device device;
+        s_uuidGenerator.seed(device());
     }
     else {
-        std::srand(seed);
+        s_uuidGenerator.seed(seed);
     }
+    s_uuidGeneratorSeeded = true;
 }
 
 void Object::SetParent(Object *parent)
@@ -670,6 +790,23 @@ int Object::GetDescendantIndex(const Object *child, const ClassId classId, int d
     return -1;
 }
 
+void Object::RemoveFromDocIndexes(Object *child)
+{
+    assert(child);
+
+    // The children of a reference object are not owned by it
+    if (m_isReferenceObject) return;
+
+    // The root can be an object being deleted, so its class id cannot be used
+    Object *root = this;
+    while (root->m_parent) root = root->m_parent;
+    if (root->m_classid == s_docClassid) {
+        Doc *doc = vrv_cast<Doc *>(root);
+        assert(doc);
+        doc->RemoveFromIndexes(child);
+    }
+}
+
 void Object::Modify(bool modified)
 {
     // if we have a parent and a new modification, propagate it
@@ -681,7 +818,7 @@ void Object::Modify(bool modified)
 
 void Object::FillFlatList(ArrayOfObjects *flatList)
 {
-    Functor addToFlatList(&Object::AddLayerElementToFlatList);
+    Functor addToFlatList(&Object::AddLayerElementToFlatList, "AddLayerElementToFlatList");
     AddLayerElementToFlatListParams addLayerElementToFlatListParams(flatList);
     this->Process(&addToFlatList, &addLayerElementToFlatListParams);
 }
@@ -743,29 +880,28 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
         return;
     }
 
-    bool processChildren = true;
-    if (functor->m_visibleOnly) {
-        if (this->IsEditorialElement()) {
-            EditorialElement *editorialElement = dynamic_cast<EditorialElement *>(this);
-            assert(editorialElement);
-            if (editorialElement->m_visibility == Hidden) {
-                processChildren = false;
-            }
-        }
-        else if (this->Is(MDIV)) {
-            Mdiv *mdiv = dynamic_cast<Mdiv *>(this);
-            assert(mdiv);
-            if (mdiv->m_visibility == Hidden) {
-                processChildren = false;
-            }
-        }
-        else if (this->IsSystemElement()) {
-            SystemElement *systemElement = dynamic_cast<SystemElement *>(this);
-            assert(systemElement);
-            if (systemElement->m_visibility == Hidden) {
-                processChildren = false;
-            }
+    // This is the root of the processing - record it as a pass if a profiler is running
+    if (!functor->m_isProcessing) {
+        Profiler *profiler = Profiler::GetCurrent();
+        long visitCount = functor->m_visitCount;
+        long callCount = functor->m_callCount + (endFunctor ? endFunctor->m_callCount : 0);
+        double start = (profiler) ? Profiler::GetTime() : 0.0;
+        functor->m_isProcessing = true;
+        this->Process(functor, functorParams, endFunctor, filters, deepness, direction);
+        functor->m_isProcessing = false;
+        if (profiler) {
+            callCount = functor->m_callCount + (endFunctor ? endFunctor->m_callCount : 0) - callCount;
+            profiler->AddPass(functor->GetName().empty() ? "[unnamed]" : functor->GetName(),
+                Profiler::GetTime() - start, functor->m_visitCount - visitCount, callCount);
         }
+        return;
+    }
+
+    functor->m_visitCount++;
+
+    bool processChildren = true;
+    if (functor->m_visibleOnly && this->IsHiddenForProcessing()) {
+        processChildren = false;
     }
 
     functor->Call(this, functorParams);
@@ -786,40 +922,19 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
     deepness--;
 
     if (processChildren) {
-        auto filterPredicate = [filters] (Object *iter) -> bool {
-            if (filters && !filters->empty()) {
-                // first we look if there is a comparison object for the object type (e.g., a Staff)
-                auto classId = iter->GetClassId();
-                ArrayOfComparisons::iterator comparisonIter = std::find_if (filters->begin(), filters->end(), [classId] (Comparison* iter)->bool {
-                    ClassIdComparison* attComparison = dynamic_cast<ClassIdComparison*>(iter);
-                    assert(attComparison);
-                    return classId == attComparison->GetType();
-                });
-
-                if (comparisonIter != filters->end()) {
-                    // use the operator of the Comparison object to evaluate the attribute
-                    if (!(**comparisonIter)(iter)) {
-                        // the attribute value doesn't match
-                        return false;
-                    }
-                }
-            }
-            return true;
-        };
-
         // We need a pointer to the array for the option to work on a reversed copy
         ArrayOfObjects *children = &this->m_children;
         if (direction == BACKWARD) {
             for (ArrayOfObjects::reverse_iterator iter = children->rbegin(); iter!=children->rend(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (filterPredicate(*iter)) {
+                if ((*iter)->MatchesFilters(filters)) {
                     (*iter)->Process(functor, functorParams, endFunctor, filters, deepness, direction);
                 }
             }
         } else {
             for (ArrayOfObjects::iterator iter = children->begin(); iter!=children->end(); ++iter) {
                 // we will end here if there is no filter at all or for the current child type
-                if (filterPredicate(*iter)) {
+                if ((*iter)->MatchesFilters(filters)) {
                     (*iter)->Process(functor, functorParams, endFunctor, filters, deepness, direction);
                 }
             }
@@ -831,14 +946,145 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
     }
 }
 
+void Object::ProcessPasses(ArrayOfFunctorPasses &passes, int deepness)
+{
+    if (passes.empty()) {
+        return;
+    }
+
+    // Record the passes as a single one if a profiler is running
+    Profiler *profiler = Profiler::GetCurrent();
+    long visitCount = 0;
+    long callCount = 0;
+    for (FunctorPass *pass : passes) {
+        pass->m_functor.m_isProcessing = true;
+        visitCount -= pass->m_functor.m_visitCount;
+        callCount -= pass->m_functor.m_callCount + (pass->m_endFunctor ? pass->m_endFunctor->m_callCount : 0);
+    }
+    double start = (profiler) ? Profiler::GetTime() : 0.0;
+
+    std::deque<ArrayOfFunctorPasses> buffers;
+    this->ProcessPasses(passes, deepness, buffers, 0);
+
+    for (FunctorPass *pass : passes) {
+        pass->m_functor.m_isProcessing = false;
+        visitCount += pass->m_functor.m_visitCount;
+        callCount += pass->m_functor.m_callCount + (pass->m_endFunctor ? pass->m_endFunctor->m_callCount : 0);
+    }
+    if (profiler) {
+        const std::string &name = passes.front()->m_functor.GetName();
+        profiler->AddPass(name.empty() ? "[unnamed]" : name, Profiler::GetTime() - start, visitCount, callCount);
+    }
+}
+
+void Object::ProcessPasses(
+    ArrayOfFunctorPasses &passes, int deepness, std::deque<ArrayOfFunctorPasses> &buffers, int depth)
+{
+    if ((int)buffers.size() < (depth + 1) * 2) {
+        buffers.resize((depth + 1) * 2);
+    }
+    // The passes going deeper, and the ones for the current child
+    ArrayOfFunctorPasses &descending = buffers.at(depth * 2);
+    ArrayOfFunctorPasses &childPasses = buffers.at(depth * 2 + 1);
+
+    const bool isHidden = this->IsHiddenForProcessing();
+
+    descending.clear();
+    for (FunctorPass *pass : passes) {
+        Functor *functor = &pass->m_functor;
+        if (functor->m_returnCode == FUNCTOR_STOP) {
+            continue;
+        }
+        functor->m_visitCount++;
+        functor->Call(this, pass->m_functorParams);
+        // do not go any deeper for this pass
+        if (functor->m_returnCode == FUNCTOR_SIBLINGS) {
+            functor->m_returnCode = FUNCTOR_CONTINUE;
+            continue;
+        }
+        descending.push_back(pass);
+    }
+    if (descending.empty()) {
+        return;
+    }
+
+    if (this->IsEditorialElement()) {
+        // since editorial object doesn't count, we increase the deepness limit
+        deepness++;
+    }
+    if (deepness == 0) {
+        return;
+    }
+    deepness--;
+
+    for (Object *child : m_children) {
+        childPasses.clear();
+        for (FunctorPass *pass : descending) {
+            if (isHidden && pass->m_functor.m_visibleOnly) continue;
+            if (!child->MatchesFilters(&pass->m_filters)) continue;
+            childPasses.push_back(pass);
+        }
+        if (!childPasses.empty()) {
+            child->ProcessPasses(childPasses, deepness, buffers, depth + 1);
+        }
+    }
+
+    for (FunctorPass *pass : descending) {
+        if (pass->m_endFunctor) {
+            pass->m_endFunctor->Call(this, pass->m_functorParams);
+        }
+    }
+}
+
+bool Object::IsHiddenForProcessing()
+{
+    if (this->IsEditorialElement()) {
+        EditorialElement *editorialElement = vrv_cast<EditorialElement *>(this);
+        assert(editorialElement);
+        return (editorialElement->m_visibility == Hidden);
+    }
+    else if (this->Is(MDIV)) {
+        Mdiv *mdiv = vrv_cast<Mdiv *>(this);
+        assert(mdiv);
+        return (mdiv->m_visibility == Hidden);
+    }
+    else if (this->IsSystemElement()) {
+        SystemElement *systemElement = vrv_cast<SystemElement *>(this);
+        assert(systemElement);
+        return (systemElement->m_visibility == Hidden);
+    }
+    return false;
+}
+
+bool Object::MatchesFilters(ArrayOfComparisons *filters)
+{
+    if (!filters || filters->empty()) {
+        return true;
+    }
+    // first we look if there is a comparison object for the object type (e.g., a Staff)
+    ClassId classId = this->GetClassId();
+    ArrayOfComparisons::iterator comparisonIter
+        = std::find_if(filters->begin(), filters->end(), [classId](Comparison *iter) -> bool {
+              ClassIdComparison *attComparison = vrv_cast<ClassIdComparison *>(iter);
+              assert(attComparison);
+              return classId == attComparison->GetType();
+          });
+    // use the operator of the Comparison object to evaluate the attribute
+    if ((comparisonIter != filters->end()) && !(**comparisonIter)(this)) {
+        // the attribute value doesn't match
+        return false;
+    }
+    return true;
+}
+
 int Object::Save(Output *output)
 {
     SaveParams saveParams(output);
 
-    Functor save(&Object::Save);
+    Functor save(&Object::Save, "Save");
     // Special case where we want to process all objects
     save.m_visibleOnly = false;
-    Functor saveEnd(&Object::SaveEnd);
+    Functor saveEnd(&Object::SaveEnd, "SaveEnd");
     this->Process(&save, &saveParams, &saveEnd);
 
     return true;
@@ -847,7 +1093,7 @@ int Object::Save(Output *output)
 void Object::ReorderByXPos()
 {
     ReorderByXPosParams params;
-    Functor reorder(&Object::ReorderByXPos);
+    Functor reorder(&Object::ReorderByXPos, "ReorderByXPos");
     this->Process(&reorder, &params);
 }
 
@@ -969,7 +1215,7 @@ std::wstring TextListInterface::GetText(Object *node)
         if ((*it)->Is(LB)) {
             continue;
         }
-        Text *text = dynamic_cast<Text *>(*it);
+        Text *text = vrv_cast<Text *>(*it);
         assert(text);
         concatText += text->GetText();
     }
@@ -987,7 +1233,7 @@ void TextListInterface::GetTextLines(Object *node, std::vector<std::wstring> &li
             concatText.clear();
             continue;
         }
-        Text *text = dynamic_cast<Text *>(*it);
+        Text *text = vrv_cast<Text *>(*it);
         assert(text);
         concatText += text->GetText();
     }
@@ -1017,29 +1263,53 @@ Functor::Functor()
 {
     m_returnCode = FUNCTOR_CONTINUE;
     m_visibleOnly = true;
+    m_visitCount = 0;
+    m_callCount = 0;
+    m_isProcessing = false;
     obj_fpt = NULL;
 }
 
-Functor::Functor(int (Object::*_obj_fpt)(FunctorParams *))
+Functor::Functor(int (Object::*_obj_fpt)(FunctorParams *), const std::string &name)
 {
     m_returnCode = FUNCTOR_CONTINUE;
     m_visibleOnly = true;
+    m_visitCount = 0;
+    m_callCount = 0;
+    m_isProcessing = false;
     obj_fpt = _obj_fpt;
+    m_name = name;
 }
 
 void Functor::Call(Object *ptr, FunctorParams *functorParams)
 {
+    m_callCount++;
     // we should have return codes (not just bool) for avoiding to go further down the tree in some cases
     m_returnCode = (*ptr.*obj_fpt)(functorParams);
 }
 
+//----------------------------------------------------------------------------
+// FunctorPass
+//----------------------------------------------------------------------------
+
+FunctorPass::FunctorPass(const Functor &functor, FunctorParams *functorParams, const Functor *endFunctor)
+    : m_functor(functor)
+{
+    m_endFunctor = (endFunctor) ? new Functor(*endFunctor) : NULL;
+    m_functorParams = functorParams;
+}
+
+FunctorPass::~FunctorPass()
+{
+    if (m_endFunctor) delete m_endFunctor;
+}
+
 //----------------------------------------------------------------------------
 // Object functor methods
 //----------------------------------------------------------------------------
 
 int Object::AddLayerElementToFlatList(FunctorParams *functorParams)
 {
-    AddLayerElementToFlatListParams *params = dynamic_cast<AddLayerElementToFlatListParams *>(functorParams);
+    AddLayerElementToFlatListParams *params = vrv_cast<AddLayerElementToFlatListParams *>(functorParams);
     assert(params);
 
     params->m_flatList->push_back(this);
@@ -1048,9 +1318,23 @@ int Object::AddLayerElementToFlatList(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+int Object::AddToUuidIndex(FunctorParams *functorParams)
+{
+    AddToUuidIndexParams *params = vrv_cast<AddToUuidIndexParams *>(functorParams);
+    assert(params);
+
+    // emplace does not replace it if already in the index
+    auto added = params->m_uuidIndex->emplace(this->GetUuidKey(), this);
+    if (!added.second) {
+        params->m_duplicates->insert(added.first->first);
+    }
+
+    return FUNCTOR_CONTINUE;
+}
+
 int Object::FindByUuid(FunctorParams *functorParams)
 {
-    FindByUuidParams *params = dynamic_cast<FindByUuidParams *>(functorParams);
+    FindByUuidParams *params = vrv_cast<FindByUuidParams *>(functorParams);
     assert(params);
 
     if (params->m_element) {
@@ -1069,7 +1353,7 @@ int Object::FindByUuid(FunctorParams *functorParams)
 
 int Object::FindByComparison(FunctorParams *functorParams)
 {
-    FindByComparisonParams *params = dynamic_cast<FindByComparisonParams *>(functorParams);
+    FindByComparisonParams *params = vrv_cast<FindByComparisonParams *>(functorParams);
     assert(params);
 
     if (params->m_element) {
@@ -1089,7 +1373,7 @@ int Object::FindByComparison(FunctorParams *functorParams)
 
 int Object::FindExtremeByComparison(FunctorParams *functorParams)
 {
-    FindExtremeByComparisonParams *params = dynamic_cast<FindExtremeByComparisonParams *>(functorParams);
+    FindExtremeByComparisonParams *params = vrv_cast<FindExtremeByComparisonParams *>(functorParams);
     assert(params);
 
     // evaluate by applying the Comparison operator()
@@ -1102,7 +1386,7 @@ int Object::FindExtremeByComparison(FunctorParams *functorParams)
 
 int Object::FindAllByComparison(FunctorParams *functorParams)
 {
-    FindAllByComparisonParams *params = dynamic_cast<FindAllByComparisonParams *>(functorParams);
+    FindAllByComparisonParams *params = vrv_cast<FindAllByComparisonParams *>(functorParams);
     assert(params);
 
     // evaluate by applying the Comparison operator()
@@ -1115,7 +1399,7 @@ int Object::FindAllByComparison(FunctorParams *functorParams)
 
 int Object::FindAllBetween(FunctorParams *functorParams)
 {
-    FindAllBetweenParams *params = dynamic_cast<FindAllBetweenParams *>(functorParams);
+    FindAllBetweenParams *params = vrv_cast<FindAllBetweenParams *>(functorParams);
     assert(params);
 
     // We are reaching the start of the range
@@ -1144,7 +1428,7 @@ int Object::FindAllBetween(FunctorParams *functorParams)
 
 int Object::ConvertToCastOffMensural(FunctorParams *functorParams)
 {
-    ConvertToCastOffMensuralParams *params = dynamic_cast<ConvertToCastOffMensuralParams *>(functorParams);
+    ConvertToCastOffMensuralParams *params = vrv_cast<ConvertToCastOffMensuralParams *>(functorParams);
     assert(params);
 
     assert(m_parent);
@@ -1161,7 +1445,7 @@ int Object::ConvertToCastOffMensural(FunctorParams *functorParams)
 
 int Object::PrepareLinking(FunctorParams *functorParams)
 {
-    PrepareLinkingParams *params = dynamic_cast<PrepareLinkingParams *>(functorParams);
+    PrepareLinkingParams *params = vrv_cast<PrepareLinkingParams *>(functorParams);
     assert(params);
 
     if (params->m_fillList && this->HasInterface(INTERFACE_LINKING)) {
@@ -1193,7 +1477,7 @@ int Object::PrepareLinking(FunctorParams *functorParams)
 
 int Object::PreparePlist(FunctorParams *functorParams)
 {
-    PreparePlistParams *params = dynamic_cast<PreparePlistParams *>(functorParams);
+    PreparePlistParams *params = vrv_cast<PreparePlistParams *>(functorParams);
     assert(params);
 
     if (params->m_fillList && this->HasInterface(INTERFACE_PLIST)) {
@@ -1215,14 +1499,14 @@ int Object::PreparePlist(FunctorParams *functorParams)
 
 int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 {
-    SetCautionaryScoreDefParams *params = dynamic_cast<SetCautionaryScoreDefParams *>(functorParams);
+    SetCautionaryScoreDefParams *params = vrv_cast<SetCautionaryScoreDefParams *>(functorParams);
     assert(params);
 
     assert(params->m_currentScoreDef);
 
     // starting a new staff
     if (this->Is(STAFF)) {
-        Staff *staff = dynamic_cast<Staff *>(this);
+        Staff *staff = vrv_cast<Staff *>(this);
         assert(staff);
         params->m_currentStaffDef = params->m_currentScoreDef->GetStaffDef(staff->GetN());
         return FUNCTOR_CONTINUE;
@@ -1230,7 +1514,7 @@ int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 
     // starting a new layer
     if (this->Is(LAYER)) {
-        Layer *layer = dynamic_cast<Layer *>(this);
+        Layer *layer = vrv_cast<Layer *>(this);
         assert(layer);
         layer->SetDrawingCautionValues(params->m_currentStaffDef);
         return FUNCTOR_SIBLINGS;
@@ -1241,14 +1525,14 @@ int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 
 int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 {
-    SetCurrentScoreDefParams *params = dynamic_cast<SetCurrentScoreDefParams *>(functorParams);
+    SetCurrentScoreDefParams *params = vrv_cast<SetCurrentScoreDefParams *>(functorParams);
     assert(params);
 
     assert(params->m_upcomingScoreDef);
 
     // starting a new page
     if (this->Is(PAGE)) {
-        Page *page = dynamic_cast<Page *>(this);
+        Page *page = vrv_cast<Page *>(this);
         assert(page);
         if (page->GetParent()->GetChildIndex(page) == 0) {
             params->m_upcomingScoreDef->SetRedrawFlags(true, true, true, true, false);
@@ -1260,7 +1544,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new system
     if (this->Is(SYSTEM)) {
-        System *system = dynamic_cast<System *>(this);
+        System *system = vrv_cast<System *>(this);
         assert(system);
         // This is the only thing we do for now - we need to wait until we reach the first measure
         params->m_currentSystem = system;
@@ -1269,7 +1553,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new measure
     if (this->Is(MEASURE)) {
-        Measure *measure = dynamic_cast<Measure *>(this);
+        Measure *measure = vrv_cast<Measure *>(this);
         assert(measure);
         bool systemBreak = false;
         bool scoreDefInsert = false;
@@ -1282,7 +1566,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
             if (params->m_upcomingScoreDef->m_setAsDrawing && params->m_previousMeasure) {
                 ScoreDef cautionaryScoreDef = *params->m_upcomingScoreDef;
                 SetCautionaryScoreDefParams setCautionaryScoreDefParams(&cautionaryScoreDef);
-                Functor setCautionaryScoreDef(&Object::SetCautionaryScoreDef);
+                Functor setCautionaryScoreDef(&Object::SetCautionaryScoreDef, "SetCautionaryScoreDef");
                 params->m_previousMeasure->Process(&setCautionaryScoreDef, &setCautionaryScoreDefParams);
             }
             // Set the flags we want to have. This also sets m_setAsDrawing to true so the next measure will keep it
@@ -1307,7 +1591,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new scoreDef
     if (this->Is(SCOREDEF)) {
-        ScoreDef *scoreDef = dynamic_cast<ScoreDef *>(this);
+        ScoreDef *scoreDef = vrv_cast<ScoreDef *>(this);
         assert(scoreDef);
         // Replace the current scoreDef with the new one, including its content (staffDef) - this also sets
         // m_setAsDrawing to true so it will then be taken into account at the next measure
@@ -1317,14 +1601,14 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new staffDef
     if (this->Is(STAFFDEF)) {
-        StaffDef *staffDef = dynamic_cast<StaffDef *>(this);
+        StaffDef *staffDef = vrv_cast<StaffDef *>(this);
         assert(staffDef);
         params->m_upcomingScoreDef->ReplaceDrawingValues(staffDef);
     }
 
     // starting a new staff
     if (this->Is(STAFF)) {
-        Staff *staff = dynamic_cast<Staff *>(this);
+        Staff *staff = vrv_cast<Staff *>(this);
         assert(staff);
         params->m_currentStaffDef = params->m_currentScoreDef->GetStaffDef(staff->GetN());
         assert(staff->m_drawingStaffDef == NULL);
@@ -1339,7 +1623,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new layer
     if (this->Is(LAYER)) {
-        Layer *layer = dynamic_cast<Layer *>(this);
+        Layer *layer = vrv_cast<Layer *>(this);
         assert(layer);
         if (params->m_doc->GetType() != Transcription) layer->SetDrawingStaffDefValues(params->m_currentStaffDef);
         return FUNCTOR_CONTINUE;
@@ -1347,9 +1631,9 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new clef
     if (this->Is(CLEF)) {
-        LayerElement *element = dynamic_cast<LayerElement *>(this);
+        LayerElement *element = vrv_cast<LayerElement *>(this);
         assert(element);
-        Clef *clef = dynamic_cast<Clef *>(element->ThisOrSameasAsLink());
+        Clef *clef = vrv_cast<Clef *>(element->ThisOrSameasAsLink());
         assert(clef);
         if (clef->IsScoreDefElement()) {
             return FUNCTOR_CONTINUE;
@@ -1364,7 +1648,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
     // starting a new keysig
     if (this->Is(KEYSIG)) {
-        KeySig *keySig = dynamic_cast<KeySig *>(this);
+        KeySig *keySig = vrv_cast<KeySig *>(this);
         assert(keySig);
         if (keySig->IsScoreDefElement()) {
             return FUNCTOR_CONTINUE;
@@ -1382,7 +1666,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
 int Object::GetAlignmentLeftRight(FunctorParams *functorParams)
 {
-    GetAlignmentLeftRightParams *params = dynamic_cast<GetAlignmentLeftRightParams *>(functorParams);
+    GetAlignmentLeftRightParams *params = vrv_cast<GetAlignmentLeftRightParams *>(functorParams);
     assert(params);
 
     if (!this->IsLayerElement()) return FUNCTOR_CONTINUE;
@@ -1400,12 +1684,12 @@ int Object::GetAlignmentLeftRight(FunctorParams *functorParams)
 
 int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 {
-    SetOverflowBBoxesParams *params = dynamic_cast<SetOverflowBBoxesParams *>(functorParams);
+    SetOverflowBBoxesParams *params = vrv_cast<SetOverflowBBoxesParams *>(functorParams);
     assert(params);
 
     // starting a new staff
     if (this->Is(STAFF)) {
-        Staff *currentStaff = dynamic_cast<Staff *>(this);
+        Staff *currentStaff = vrv_cast<Staff *>(this);
         assert(currentStaff);
 
         if (!currentStaff->DrawingIsVisible()) {
@@ -1418,7 +1702,7 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 
     // starting new layer
     if (this->Is(LAYER)) {
-        Layer *currentLayer = dynamic_cast<Layer *>(this);
+        Layer *currentLayer = vrv_cast<Layer *>(this);
         assert(currentLayer);
         // set scoreDef attr
         if (currentLayer->GetStaffDefClef()) {
@@ -1467,12 +1751,12 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 
     assert(params->m_staffAlignment);
 
-    LayerElement *current = dynamic_cast<LayerElement *>(this);
+    LayerElement *current = vrv_cast<LayerElement *>(this);
     assert(current);
 
     bool skipAbove = false;
     bool skipBelow = false;
-    Chord *chord = dynamic_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
+    Chord *chord = vrv_cast<Chord *>(this->GetFirstAncestor(CHORD, MAX_CHORD_DEPTH));
     if (chord && params->m_staffAlignment) {
         chord->GetCrossStaffOverflows(current, params->m_staffAlignment, skipAbove, skipBelow);
     }
@@ -1505,12 +1789,12 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 
 int Object::SetOverflowBBoxesEnd(FunctorParams *functorParams)
 {
-    SetOverflowBBoxesParams *params = dynamic_cast<SetOverflowBBoxesParams *>(functorParams);
+    SetOverflowBBoxesParams *params = vrv_cast<SetOverflowBBoxesParams *>(functorParams);
     assert(params);
 
     // starting new layer
     if (this->Is(LAYER)) {
-        Layer *currentLayer = dynamic_cast<Layer *>(this);
+        Layer *currentLayer = vrv_cast<Layer *>(this);
         assert(currentLayer);
         // set scoreDef attr
         if (currentLayer->GetCautionStaffDefClef()) {
@@ -1531,7 +1815,7 @@ int Object::SetOverflowBBoxesEnd(FunctorParams *functorParams)
 
 int Object::Save(FunctorParams *functorParams)
 {
-    SaveParams *params = dynamic_cast<SaveParams *>(functorParams);
+    SaveParams *params = vrv_cast<SaveParams *>(functorParams);
     assert(params);
 
     if (!params->m_output->WriteObject(this)) {
@@ -1542,7 +1826,7 @@ int Object::Save(FunctorParams *functorParams)
 
 int Object::SaveEnd(FunctorParams *functorParams)
 {
-    SaveParams *params = dynamic_cast<SaveParams *>(functorParams);
+    SaveParams *params = vrv_cast<SaveParams *>(functorParams);
     assert(params);
 
     if (!params->m_output->WriteObjectEnd(this)) {
@@ -1561,7 +1845,7 @@ bool Object::sortByUlx(Object *a, Object *b)
         ArrayOfObjects children;
         a->FindAllDescendantByComparison(&children, &comp);
         for (auto it = children.begin(); it != children.end(); ++it) {
-            FacsimileInterface *temp = dynamic_cast<FacsimileInterface *>(*it);
+            FacsimileInterface *temp = vrv_cross_cast<FacsimileInterface *>(*it);
             assert(temp);
             if (temp->HasFacs() && (fa == NULL || temp->GetZone()->GetUlx() < fa->GetZone()->GetUlx())) {
                 fa = temp;
@@ -1574,7 +1858,7 @@ bool Object::sortByUlx(Object *a, Object *b)
         ArrayOfObjects children;
         b->FindAllDescendantByComparison(&children, &comp);
         for (auto it = children.begin(); it != children.end(); ++it) {
-            FacsimileInterface *temp = dynamic_cast<FacsimileInterface *>(*it);
+            FacsimileInterface *temp = vrv_cross_cast<FacsimileInterface *>(*it);
             assert(temp);
             if (temp->HasFacs() && (fb == NULL || temp->GetZone()->GetUlx() < fb->GetZone()->GetUlx())) {
                 fb = temp;
@@ -1605,7 +1889,7 @@ int Object::ReorderByXPos(FunctorParams *functorParams)
 
 int Object::SetChildZones(FunctorParams *functorParams)
 {
-    SetChildZonesParams *params = dynamic_cast<SetChildZonesParams *>(functorParams);
+    SetChildZonesParams *params = vrv_cast<SetChildZonesParams *>(functorParams);
     assert(params);
 
     FacsimileInterface *fi = dynamic_cast<FacsimileInterface *>(this->GetFacsimileInterface());
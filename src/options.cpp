@@ -98,7 +98,7 @@ std::string Option::GetDefaultStrValue() const
 
 void OptionBool::CopyTo(Option *option)
 {
-    OptionBool *child = dynamic_cast<OptionBool *>(option);
+    OptionBool *child = vrv_cast<OptionBool *>(option);
     assert(child);
     *child = *this;
 }
@@ -147,7 +147,7 @@ bool OptionBool::SetValue(bool value)
 
 void OptionDbl::CopyTo(Option *option)
 {
-    OptionDbl *child = dynamic_cast<OptionDbl *>(option);
+    OptionDbl *child = vrv_cast<OptionDbl *>(option);
     assert(child);
     *child = *this;
 }
@@ -197,7 +197,7 @@ bool OptionDbl::SetValue(double value)
 
 void OptionInt::CopyTo(Option *option)
 {
-    OptionInt *child = dynamic_cast<OptionInt *>(option);
+    OptionInt *child = vrv_cast<OptionInt *>(option);
     assert(child);
     *child = *this;
 }
@@ -258,7 +258,7 @@ bool OptionInt::SetValue(int value)
 
 void OptionString::CopyTo(Option *option)
 {
-    OptionString *child = dynamic_cast<OptionString *>(option);
+    OptionString *child = vrv_cast<OptionString *>(option);
     assert(child);
     *child = *this;
 }
@@ -281,7 +281,7 @@ bool OptionString::SetValue(const std::string &value)
 
 void OptionArray::CopyTo(Option *option)
 {
-    OptionArray *child = dynamic_cast<OptionArray *>(option);
+    OptionArray *child = vrv_cast<OptionArray *>(option);
     assert(child);
     *child = *this;
 }
@@ -358,7 +358,7 @@ OptionIntMap::OptionIntMap()
 
 void OptionIntMap::CopyTo(Option *option)
 {
-    OptionIntMap *child = dynamic_cast<OptionIntMap *>(option);
+    OptionIntMap *child = vrv_cast<OptionIntMap *>(option);
     assert(child);
     *child = *this;
 }
@@ -448,7 +448,7 @@ std::string OptionIntMap::GetStrValuesAsStr(bool withoutDefault) const
 
 void OptionStaffrel::CopyTo(Option *option)
 {
-    OptionStaffrel *child = dynamic_cast<OptionStaffrel *>(option);
+    OptionStaffrel *child = vrv_cast<OptionStaffrel *>(option);
     assert(child);
     *child = *this;
 }
@@ -543,6 +543,13 @@ Options::Options()
     m_landscape.Init(false);
     this->Register(&m_landscape, "landscape", &m_general);
 
+    m_lazyLayout.SetInfo("Lazy layout",
+        "Estimate the system heights for the page breaks and lay out the pages vertically only when rendered. "
+        "Floating elements are not taken into account in the estimate, so the page breaks can differ from the "
+        "default layout and a page can overflow");
+    m_lazyLayout.Init(false);
+    this->Register(&m_lazyLayout, "lazyLayout", &m_general);
+
     m_mensuralToMeasure.SetInfo("Mensural to measure", "Convert mensural sections to measure-based MEI");
     m_mensuralToMeasure.Init(false);
     this->Register(&m_mensuralToMeasure, "mensuralToMeasure", &m_general);
@@ -605,6 +612,10 @@ Options::Options()
     m_pageWidth.Init(2100, 100, 60000, true);
     this->Register(&m_pageWidth, "pageWidth", &m_general);
 
+    m_profile.SetInfo("Profile", "Record the time spent in the toolkit methods and in the layout passes");
+    m_profile.Init(false);
+    this->Register(&m_profile, "profile", &m_general);
+
     m_expand.SetInfo("Expand expansion", "Expand all referenced elements in the expansion <xml:id>");
     m_expand.Init("");
     this->Register(&m_expand, "expand", &m_general);
@@ -613,6 +624,11 @@ Options::Options()
     m_svgBoundingBoxes.Init(false);
     this->Register(&m_svgBoundingBoxes, "svgBoundingBoxes", &m_general);
 
+    m_svgSharedDefs.SetInfo("Share the svg defs between pages",
+        "Write the glyph defs only in the first SVG using them (for SVGs inlined in the same document)");
+    m_svgSharedDefs.Init(false);
+    this->Register(&m_svgSharedDefs, "svgSharedDefs", &m_general);
+
     m_svgViewBox.SetInfo("Use viewbox on svg root", "Use viewBox on svg root element for easy scaling of document");
     m_svgViewBox.Init(false);
     this->Register(&m_svgViewBox, "svgViewBox", &m_general);
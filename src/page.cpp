@@ -79,7 +79,7 @@ void Page::AddChild(Object *child)
 
 RunningElement *Page::GetHeader() const
 {
-    Doc *doc = dynamic_cast<Doc *>(this->GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     if (!doc || (doc->GetOptions()->m_header.GetValue() == HEADER_none)) {
         return NULL;
     }
@@ -98,7 +98,7 @@ RunningElement *Page::GetHeader() const
 
 RunningElement *Page::GetFooter() const
 {
-    Doc *doc = dynamic_cast<Doc *>(this->GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     if (!doc || (doc->GetOptions()->m_footer.GetValue() == FOOTER_none)) {
         return NULL;
     }
@@ -124,20 +124,32 @@ void Page::LayOut(bool force)
         return;
     }
 
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
+    assert(doc);
+
+    // The vertical justification of the last page uses the one of the penultimate page. It has to be laid out first
+    // because the header and the footer are shared by the pages and are laid out again for each of them.
+    Pages *pages = doc->GetPages();
+    assert(pages);
+    if (doc->GetOptions()->m_justifyVertically.GetValue() && doc->GetOptions()->m_justifyIncludeLastPage.GetValue()
+        && (pages->GetLast() == this) && (this->GetIdx() > 0)) {
+        Page *penultimatePage = vrv_cast<Page *>(pages->GetPrevious(this));
+        assert(penultimatePage);
+        if (!penultimatePage->m_layoutDone) {
+            doc->SetDrawingPage(this->GetIdx() - 1);
+            penultimatePage->LayOut();
+            doc->SetDrawingPage(this->GetIdx());
+        }
+    }
+
     this->LayOutHorizontally();
     this->JustifyHorizontally();
     this->LayOutVertically();
     this->JustifyVertically();
 
-    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
-    assert(doc);
     if (doc->GetOptions()->m_svgBoundingBoxes.GetValue()) {
         View view;
-        view.SetDoc(doc);
-        BBoxDeviceContext bBoxDC(&view, 0, 0);
-        // Do not do the layout in this view - otherwise we will loop...
-        view.SetPage(this->GetIdx(), false);
-        view.DrawCurrentPage(&bBoxDC, false);
+        this->DrawBoundingBoxes(view, BBOX_BOTH);
     }
 
     m_layoutDone = true;
@@ -149,7 +161,7 @@ void Page::LayOutTranscription(bool force)
         return;
     }
 
-    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
@@ -157,94 +169,111 @@ void Page::LayOutTranscription(bool force)
     assert(this == doc->GetDrawingPage());
 
     // Reset the horizontal alignment
-    Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
+    Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment, "ResetHorizontalAlignment");
     this->Process(&resetHorizontalAlignment, NULL);
 
     // Reset the vertical alignment
-    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
+    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment, "ResetVerticalAlignment");
     this->Process(&resetVerticalAlignment, NULL);
 
     // Align the content of the page using measure aligners
     // After this:
     // - each LayerElement object will have its Alignment pointer initialized
-    Functor alignHorizontally(&Object::AlignHorizontally);
-    Functor alignHorizontallyEnd(&Object::AlignHorizontallyEnd);
+    Functor alignHorizontally(&Object::AlignHorizontally, "AlignHorizontally");
+    Functor alignHorizontallyEnd(&Object::AlignHorizontallyEnd, "AlignHorizontallyEnd");
     AlignHorizontallyParams alignHorizontallyParams(&alignHorizontally, doc);
     this->Process(&alignHorizontally, &alignHorizontallyParams, &alignHorizontallyEnd);
 
     // Align the content of the page using system aligners
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
-    Functor alignVertically(&Object::AlignVertically);
-    Functor alignVerticallyEnd(&Object::AlignVerticallyEnd);
+    Functor alignVertically(&Object::AlignVertically, "AlignVertically");
+    Functor alignVerticallyEnd(&Object::AlignVerticallyEnd, "AlignVerticallyEnd");
     AlignVerticallyParams alignVerticallyParams(doc, &alignVertically, &alignVerticallyEnd);
     this->Process(&alignVertically, &alignVerticallyParams, &alignVerticallyEnd);
 
     // Set the pitch / pos alignement
     SetAlignmentPitchPosParams setAlignmentPitchPosParams(doc);
-    Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos);
+    Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos, "SetAlignmentPitchPos");
     this->Process(&setAlignmentPitchPos, &setAlignmentPitchPosParams);
 
     CalcStemParams calcStemParams(doc);
-    Functor calcStem(&Object::CalcStem);
+    Functor calcStem(&Object::CalcStem, "CalcStem");
     this->Process(&calcStem, &calcStemParams);
 
     FunctorDocParams calcChordNoteHeadsParams(doc);
-    Functor calcChordNoteHeads(&Object::CalcChordNoteHeads);
+    Functor calcChordNoteHeads(&Object::CalcChordNoteHeads, "CalcChordNoteHeads");
     this->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams);
 
     CalcDotsParams calcDotsParams(doc);
-    Functor calcDots(&Object::CalcDots);
+    Functor calcDots(&Object::CalcDots, "CalcDots");
     this->Process(&calcDots, &calcDotsParams);
 
     // Render it for filling the bounding box
     View view;
-    view.SetDoc(doc);
-    BBoxDeviceContext bBoxDC(&view, 0, 0, BBOX_HORIZONTAL_ONLY);
-    // Do not do the layout in this view - otherwise we will loop...
-    view.SetPage(this->GetIdx(), false);
-    view.DrawCurrentPage(&bBoxDC, false);
+    this->DrawBoundingBoxes(view, BBOX_HORIZONTAL_ONLY);
 
-    Functor adjustXRelForTranscription(&Object::AdjustXRelForTranscription);
+    Functor adjustXRelForTranscription(&Object::AdjustXRelForTranscription, "AdjustXRelForTranscription");
     this->Process(&adjustXRelForTranscription, NULL);
 
     FunctorDocParams calcLegerLinesParams(doc);
-    Functor calcLedgerLines(&Object::CalcLedgerLines);
+    Functor calcLedgerLines(&Object::CalcLedgerLines, "CalcLedgerLines");
     this->Process(&calcLedgerLines, &calcLegerLinesParams);
 
     m_layoutDone = true;
 }
 
-void Page::LayOutHorizontally()
+void Page::LayOutHorizontally(bool storeLayout)
 {
-    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
+    // Restore the layout of the measures stored when casting off the document - these are not laid out again.
+    // The first and the last measure of a system are always laid out since they depend on the system breaks.
+    // This is not possible when the spacing depends on the longest duration in the page.
+    std::set<Measure *> restoredMeasures;
+    if (!storeLayout && !doc->GetOptions()->m_spacingDurDetection.GetValue()) {
+        ClassIdComparison matchMeasure(MEASURE);
+        ArrayOfObjects measures;
+        for (auto child : *this->GetChildren()) {
+            if (!child->Is(SYSTEM)) continue;
+            child->FindAllDescendantByComparison(&measures, &matchMeasure, 1);
+            for (int i = 1; i < (int)measures.size() - 1; ++i) {
+                Measure *measure = vrv_cast<Measure *>(measures.at(i));
+                assert(measure);
+                if (measure->RestoreHorizontalLayout()) restoredMeasures.insert(measure);
+            }
+        }
+    }
+    MeasureExclusionComparison excludeRestored(restoredMeasures);
+    ArrayOfComparisons filters;
+    if (!restoredMeasures.empty()) filters.push_back(&excludeRestored);
+
     // Reset the horizontal alignment
-    Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
-    this->Process(&resetHorizontalAlignment, NULL);
+    Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment, "ResetHorizontalAlignment");
+    this->Process(&resetHorizontalAlignment, NULL, NULL, &filters);
 
     // Reset the vertical alignment
-    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
+    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment, "ResetVerticalAlignment");
     this->Process(&resetVerticalAlignment, NULL);
 
     // Align the content of the page using measure aligners
     // After this:
     // - each LayerElement object will have its Alignment pointer initialized
-    Functor alignHorizontally(&Object::AlignHorizontally);
-    Functor alignHorizontallyEnd(&Object::AlignHorizontallyEnd);
+    Functor alignHorizontally(&Object::AlignHorizontally, "AlignHorizontally");
+    Functor alignHorizontallyEnd(&Object::AlignHorizontallyEnd, "AlignHorizontallyEnd");
     AlignHorizontallyParams alignHorizontallyParams(&alignHorizontally, doc);
-    this->Process(&alignHorizontally, &alignHorizontallyParams, &alignHorizontallyEnd);
+    this->Process(&alignHorizontally, &alignHorizontallyParams, &alignHorizontallyEnd, &filters);
 
     // Align the content of the page using system aligners
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
-    Functor alignVertically(&Object::AlignVertically);
-    Functor alignVerticallyEnd(&Object::AlignVerticallyEnd);
+    Functor alignVertically(&Object::AlignVertically, "AlignVertically");
+    Functor alignVerticallyEnd(&Object::AlignVerticallyEnd, "AlignVerticallyEnd");
     AlignVerticallyParams alignVerticallyParams(doc, &alignVertically, &alignVerticallyEnd);
     this->Process(&alignVertically, &alignVerticallyParams, &alignVerticallyEnd);
 
@@ -266,103 +295,120 @@ void Page::LayOutHorizontally()
             }
         }
 
-        Functor setAlignmentX(&Object::SetAlignmentXPos);
+        Functor setAlignmentX(&Object::SetAlignmentXPos, "SetAlignmentXPos");
         SetAlignmentXPosParams setAlignmentXPosParams(doc, &setAlignmentX);
         setAlignmentXPosParams.m_longestActualDur = longestActualDur;
-        this->Process(&setAlignmentX, &setAlignmentXPosParams);
+        this->Process(&setAlignmentX, &setAlignmentXPosParams, NULL, &filters);
     }
 
     // Set the pitch / pos alignement
     SetAlignmentPitchPosParams setAlignmentPitchPosParams(doc);
-    Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos);
-    this->Process(&setAlignmentPitchPos, &setAlignmentPitchPosParams);
+    Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos, "SetAlignmentPitchPos");
+    this->Process(&setAlignmentPitchPos, &setAlignmentPitchPosParams, NULL, &filters);
 
     CalcStemParams calcStemParams(doc);
-    Functor calcStem(&Object::CalcStem);
-    this->Process(&calcStem, &calcStemParams);
+    Functor calcStem(&Object::CalcStem, "CalcStem");
+    this->Process(&calcStem, &calcStemParams, NULL, &filters);
 
     FunctorDocParams calcChordNoteHeadsParams(doc);
-    Functor calcChordNoteHeads(&Object::CalcChordNoteHeads);
-    this->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams);
+    Functor calcChordNoteHeads(&Object::CalcChordNoteHeads, "CalcChordNoteHeads");
+    this->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams, NULL, &filters);
 
     CalcDotsParams calcDotsParams(doc);
-    Functor calcDots(&Object::CalcDots);
-    this->Process(&calcDots, &calcDotsParams);
+    Functor calcDots(&Object::CalcDots, "CalcDots");
+    this->Process(&calcDots, &calcDotsParams, NULL, &filters);
+
+    // Keep the layout of the measures before the drawing, which sets some positions from the alignments
+    ArrayOfObjects storedMeasures;
+    if (storeLayout) {
+        ClassIdComparison matchMeasure(MEASURE);
+        this->FindAllDescendantByComparison(&storedMeasures, &matchMeasure, 2);
+    }
+    for (auto measure : storedMeasures) {
+        vrv_cast<Measure *>(measure)->StoreHorizontalLayout(Measure::LAYOUT_ALIGNED);
+    }
 
     // Render it for filling the bounding box
     View view;
-    view.SetDoc(doc);
-    BBoxDeviceContext bBoxDC(&view, 0, 0, BBOX_HORIZONTAL_ONLY);
-    // Do not do the layout in this view - otherwise we will loop...
-    view.SetPage(this->GetIdx(), false);
-    view.DrawCurrentPage(&bBoxDC, false);
+    this->DrawBoundingBoxes(view, BBOX_HORIZONTAL_ONLY);
+
+    for (auto measure : storedMeasures) {
+        vrv_cast<Measure *>(measure)->StoreHorizontalLayout(Measure::LAYOUT_DRAWN);
+    }
+    // The restored measures are now set to their adjusted layout
+    for (auto measure : restoredMeasures) measure->RestoreAdjustedHorizontalLayout();
 
     // Adjust the x position of the LayerElement where multiple layer collide
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustLayers(&Object::AdjustLayers);
+    Functor adjustLayers(&Object::AdjustLayers, "AdjustLayers");
     AdjustLayersParams adjustLayersParams(doc, &adjustLayers, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustLayers, &adjustLayersParams);
+    this->Process(&adjustLayers, &adjustLayersParams, NULL, &filters);
 
     // Adjust the X position of the accidentals, including in chords
-    Functor adjustAccidX(&Object::AdjustAccidX);
+    Functor adjustAccidX(&Object::AdjustAccidX, "AdjustAccidX");
     AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
-    this->Process(&adjustAccidX, &adjustAccidXParams);
+    this->Process(&adjustAccidX, &adjustAccidXParams, NULL, &filters);
 
     // Adjust the X shift of the Alignment looking at the bounding boxes
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustXPos(&Object::AdjustXPos);
-    Functor adjustXPosEnd(&Object::AdjustXPosEnd);
+    Functor adjustXPos(&Object::AdjustXPos, "AdjustXPos");
+    Functor adjustXPosEnd(&Object::AdjustXPosEnd, "AdjustXPosEnd");
     AdjustXPosParams adjustXPosParams(doc, &adjustXPos, &adjustXPosEnd, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd);
+    this->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd, &filters);
 
     // Adjust the X shift of the Alignment looking at the bounding boxes
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustGraceXPos(&Object::AdjustGraceXPos);
-    Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd);
+    Functor adjustGraceXPos(&Object::AdjustGraceXPos, "AdjustGraceXPos");
+    Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd, "AdjustGraceXPosEnd");
     AdjustGraceXPosParams adjustGraceXPosParams(
         doc, &adjustGraceXPos, &adjustGraceXPosEnd, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+    this->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd, &filters);
+
+    // Keep the layout of the measures before the adjustments depending on the system they will belong to
+    for (auto measure : storedMeasures) {
+        vrv_cast<Measure *>(measure)->StoreHorizontalLayout(Measure::LAYOUT_ADJUSTED);
+    }
 
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
     // by Verse (for matching syllable connectors)
     PrepareProcessingListsParams prepareProcessingListsParams;
-    Functor prepareProcessingLists(&Object::PrepareProcessingLists);
+    Functor prepareProcessingLists(&Object::PrepareProcessingLists, "PrepareProcessingLists");
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
     this->AdjustSylSpacingByVerse(prepareProcessingListsParams, doc);
 
-    Functor adjustHarmGrpsSpacing(&Object::AdjustHarmGrpsSpacing);
-    Functor adjustHarmGrpsSpacingEnd(&Object::AdjustHarmGrpsSpacingEnd);
+    Functor adjustHarmGrpsSpacing(&Object::AdjustHarmGrpsSpacing, "AdjustHarmGrpsSpacing");
+    Functor adjustHarmGrpsSpacingEnd(&Object::AdjustHarmGrpsSpacingEnd, "AdjustHarmGrpsSpacingEnd");
     AdjustHarmGrpsSpacingParams adjustHarmGrpsSpacingParams(doc, &adjustHarmGrpsSpacing, &adjustHarmGrpsSpacingEnd);
     this->Process(&adjustHarmGrpsSpacing, &adjustHarmGrpsSpacingParams, &adjustHarmGrpsSpacingEnd);
 
     // Adjust the arpeg
-    Functor adjustArpeg(&Object::AdjustArpeg);
-    Functor adjustArpegEnd(&Object::AdjustArpegEnd);
+    Functor adjustArpeg(&Object::AdjustArpeg, "AdjustArpeg");
+    Functor adjustArpegEnd(&Object::AdjustArpegEnd, "AdjustArpegEnd");
     AdjustArpegParams adjustArpegParams(doc, &adjustArpeg);
     this->Process(&adjustArpeg, &adjustArpegParams, &adjustArpegEnd);
 
     // Adjust the position of the tuplets
     FunctorDocParams adjustTupletsXParams(doc);
-    Functor adjustTupletsX(&Object::AdjustTupletsX);
+    Functor adjustTupletsX(&Object::AdjustTupletsX, "AdjustTupletsX");
     this->Process(&adjustTupletsX, &adjustTupletsXParams);
 
     // Prevent a margin overflow
-    Functor adjustXOverlfow(&Object::AdjustXOverflow);
-    Functor adjustXOverlfowEnd(&Object::AdjustXOverflowEnd);
+    Functor adjustXOverlfow(&Object::AdjustXOverflow, "AdjustXOverflow");
+    Functor adjustXOverlfowEnd(&Object::AdjustXOverflowEnd, "AdjustXOverflowEnd");
     AdjustXOverflowParams adjustXOverflowParams(doc->GetDrawingUnit(100));
     this->Process(&adjustXOverlfow, &adjustXOverflowParams, &adjustXOverlfowEnd);
 
     // Adjust measure X position
     AlignMeasuresParams alignMeasuresParams;
-    Functor alignMeasures(&Object::AlignMeasures);
-    Functor alignMeasuresEnd(&Object::AlignMeasuresEnd);
+    Functor alignMeasures(&Object::AlignMeasures, "AlignMeasures");
+    Functor alignMeasuresEnd(&Object::AlignMeasuresEnd, "AlignMeasuresEnd");
     this->Process(&alignMeasures, &alignMeasuresParams, &alignMeasuresEnd);
 }
 
-void Page::LayOutVertically()
+void Page::LayOutVertically(bool drawing)
 {
-    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
@@ -370,102 +416,106 @@ void Page::LayOutVertically()
     assert(this == doc->GetDrawingPage());
 
     // Reset the vertical alignment
-    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
+    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment, "ResetVerticalAlignment");
     this->Process(&resetVerticalAlignment, NULL);
 
-    FunctorDocParams calcLegerLinesParams(doc);
-    Functor calcLedgerLines(&Object::CalcLedgerLines);
-    this->Process(&calcLedgerLines, &calcLegerLinesParams);
+    if (drawing) {
+        FunctorDocParams calcLegerLinesParams(doc);
+        Functor calcLedgerLines(&Object::CalcLedgerLines, "CalcLedgerLines");
+        this->Process(&calcLedgerLines, &calcLegerLinesParams);
+    }
 
     // Align the content of the page using system aligners
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
-    Functor alignVertically(&Object::AlignVertically);
-    Functor alignVerticallyEnd(&Object::AlignVerticallyEnd);
+    Functor alignVertically(&Object::AlignVertically, "AlignVertically");
+    Functor alignVerticallyEnd(&Object::AlignVerticallyEnd, "AlignVerticallyEnd");
     AlignVerticallyParams alignVerticallyParams(doc, &alignVertically, &alignVerticallyEnd);
     this->Process(&alignVertically, &alignVerticallyParams, &alignVerticallyEnd);
 
-    // Adjust the position of outside articulations
-    FunctorDocParams calcArticParams(doc);
-    Functor calcArtic(&Object::CalcArtic);
-    this->Process(&calcArtic, &calcArticParams);
-
-    // Render it for filling the bounding box
-    View view;
-    BBoxDeviceContext bBoxDC(&view, 0, 0);
-    view.SetDoc(doc);
-    // Do not do the layout in this view - otherwise we will loop...
-    view.SetPage(this->GetIdx(), false);
-    view.DrawCurrentPage(&bBoxDC, false);
-
-    // Adjust the position of outside articulations with slurs end and start positions
-    FunctorDocParams adjustArticWithSlursParams(doc);
-    Functor adjustArticWithSlurs(&Object::AdjustArticWithSlurs);
-    this->Process(&adjustArticWithSlurs, &adjustArticWithSlursParams);
-
-    // Adjust the position of the tuplets
-    FunctorDocParams adjustTupletsYParams(doc);
-    Functor adjustTupletsY(&Object::AdjustTupletsY);
-    this->Process(&adjustTupletsY, &adjustTupletsYParams);
-
-    // Adjust the position of the slurs
-    Functor adjustSlurs(&Object::AdjustSlurs);
-    AdjustSlursParams adjustSlursParams(doc, &adjustSlurs);
-    this->Process(&adjustSlurs, &adjustSlursParams);
+    if (drawing) {
+        // Adjust the position of outside articulations
+        FunctorDocParams calcArticParams(doc);
+        Functor calcArtic(&Object::CalcArtic, "CalcArtic");
+        this->Process(&calcArtic, &calcArticParams);
 
-    // If slurs were adjusted we need to redraw to adjust the bounding boxes
-    if (adjustSlursParams.m_adjusted) {
-        view.SetPage(this->GetIdx(), false);
-        view.DrawCurrentPage(&bBoxDC, false);
+        // Render it for filling the bounding box
+        View view;
+        this->DrawBoundingBoxes(view, BBOX_BOTH);
+
+        // Adjust the position of outside articulations with slurs end and start positions
+        FunctorDocParams adjustArticWithSlursParams(doc);
+        Functor adjustArticWithSlurs(&Object::AdjustArticWithSlurs, "AdjustArticWithSlurs");
+        this->Process(&adjustArticWithSlurs, &adjustArticWithSlursParams);
+
+        // Adjust the position of the tuplets
+        FunctorDocParams adjustTupletsYParams(doc);
+        Functor adjustTupletsY(&Object::AdjustTupletsY, "AdjustTupletsY");
+        this->Process(&adjustTupletsY, &adjustTupletsYParams);
+
+        // Adjust the position of the slurs
+        Functor adjustSlurs(&Object::AdjustSlurs, "AdjustSlurs");
+        AdjustSlursParams adjustSlursParams(doc, &adjustSlurs);
+        this->Process(&adjustSlurs, &adjustSlursParams);
+
+        // If slurs were adjusted we need to redraw to adjust the bounding boxes
+        if (adjustSlursParams.m_adjusted) {
+            this->DrawBoundingBoxes(view, BBOX_BOTH);
+        }
     }
 
     // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
+    // Without drawing, the bounding boxes are the ones we have from the horizontal layout
     SetOverflowBBoxesParams setOverflowBBoxesParams(doc);
-    Functor setOverflowBBoxes(&Object::SetOverflowBBoxes);
-    Functor setOverflowBBoxesEnd(&Object::SetOverflowBBoxesEnd);
+    Functor setOverflowBBoxes(&Object::SetOverflowBBoxes, "SetOverflowBBoxes");
+    Functor setOverflowBBoxesEnd(&Object::SetOverflowBBoxesEnd, "SetOverflowBBoxesEnd");
     this->Process(&setOverflowBBoxes, &setOverflowBBoxesParams, &setOverflowBBoxesEnd);
 
-    // Adjust the positioners of floationg elements (slurs, hairpin, dynam, etc)
-    Functor adjustFloatingPositioners(&Object::AdjustFloatingPositioners);
-    AdjustFloatingPositionersParams adjustFloatingPositionersParams(doc, &adjustFloatingPositioners);
-    this->Process(&adjustFloatingPositioners, &adjustFloatingPositionersParams);
+    if (drawing) {
+        // Adjust the positioners of floationg elements (slurs, hairpin, dynam, etc)
+        Functor adjustFloatingPositioners(&Object::AdjustFloatingPositioners, "AdjustFloatingPositioners");
+        AdjustFloatingPositionersParams adjustFloatingPositionersParams(doc, &adjustFloatingPositioners);
+        this->Process(&adjustFloatingPositioners, &adjustFloatingPositionersParams);
 
-    // Adjust the overlap of the staff aligmnents by looking at the overflow bounding boxes params.clear();
-    Functor adjustStaffOverlap(&Object::AdjustStaffOverlap);
-    AdjustStaffOverlapParams adjustStaffOverlapParams(&adjustStaffOverlap);
-    this->Process(&adjustStaffOverlap, &adjustStaffOverlapParams);
+        // Adjust the overlap of the staff aligmnents by looking at the overflow bounding boxes params.clear();
+        Functor adjustStaffOverlap(&Object::AdjustStaffOverlap, "AdjustStaffOverlap");
+        AdjustStaffOverlapParams adjustStaffOverlapParams(&adjustStaffOverlap);
+        this->Process(&adjustStaffOverlap, &adjustStaffOverlapParams);
+    }
 
     // Set the Y position of each StaffAlignment
     // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
-    Functor adjustYPos(&Object::AdjustYPos);
+    Functor adjustYPos(&Object::AdjustYPos, "AdjustYPos");
     AdjustYPosParams adjustYPosParams(doc, &adjustYPos);
     this->Process(&adjustYPos, &adjustYPosParams);
 
-    Functor adjustCrossStaffYPos(&Object::AdjustCrossStaffYPos);
-    Functor adjustCrossStaffYPosEnd(&Object::AdjustCrossStaffYPosEnd);
-    FunctorDocParams adjustCrossStaffYPosParams(doc);
-    this->Process(&adjustCrossStaffYPos, &adjustCrossStaffYPosParams, &adjustCrossStaffYPosEnd);
+    if (drawing) {
+        Functor adjustCrossStaffYPos(&Object::AdjustCrossStaffYPos, "AdjustCrossStaffYPos");
+        Functor adjustCrossStaffYPosEnd(&Object::AdjustCrossStaffYPosEnd, "AdjustCrossStaffYPosEnd");
+        FunctorDocParams adjustCrossStaffYPosParams(doc);
+        this->Process(&adjustCrossStaffYPos, &adjustCrossStaffYPosParams, &adjustCrossStaffYPosEnd);
 
-    if (this->GetHeader()) {
-        this->GetHeader()->AdjustRunningElementYPos();
-    }
+        if (this->GetHeader()) {
+            this->GetHeader()->AdjustRunningElementYPos();
+        }
 
-    if (this->GetFooter()) {
-        this->GetFooter()->AdjustRunningElementYPos();
+        if (this->GetFooter()) {
+            this->GetFooter()->AdjustRunningElementYPos();
+        }
     }
 
     // Adjust system Y position
     AlignSystemsParams alignSystemsParams(doc);
     alignSystemsParams.m_shift = doc->m_drawingPageHeight;
     alignSystemsParams.m_systemMargin = (doc->GetOptions()->m_spacingSystem.GetValue()) * doc->GetDrawingUnit(100);
-    Functor alignSystems(&Object::AlignSystems);
-    Functor alignSystemsEnd(&Object::AlignSystemsEnd);
+    Functor alignSystems(&Object::AlignSystems, "AlignSystems");
+    Functor alignSystemsEnd(&Object::AlignSystemsEnd, "AlignSystemsEnd");
     this->Process(&alignSystems, &alignSystemsParams, &alignSystemsEnd);
 }
 
 void Page::JustifyHorizontally()
 {
-    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
 
     if ((doc->GetOptions()->m_breaks.GetValue() == BREAKS_none) || doc->GetOptions()->m_noJustification.GetValue()) {
@@ -480,7 +530,7 @@ void Page::JustifyHorizontally()
         doc->m_drawingPageWidth = GetContentWidth() + doc->m_drawingPageMarginLeft + doc->m_drawingPageMarginRight;
 
     // Justify X position
-    Functor justifyX(&Object::JustifyX);
+    Functor justifyX(&Object::JustifyX, "JustifyX");
     JustifyXParams justifyXParams(&justifyX, doc);
     justifyXParams.m_systemFullWidth
         = doc->m_drawingPageWidth - doc->m_drawingPageMarginLeft - doc->m_drawingPageMarginRight;
@@ -489,7 +539,7 @@ void Page::JustifyHorizontally()
 
 void Page::JustifyVertically()
 {
-    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
@@ -516,15 +566,10 @@ void Page::JustifyVertically()
         if (!doc->GetOptions()->m_justifyIncludeLastPage.GetValue()) {
             return;
         }
-        int idx = this->GetIdx();
-        if (idx > 0) {
-            Page *penultimatePage = dynamic_cast<Page *>(pages->GetPrevious(this));
-            assert(penultimatePage);
-            if (!penultimatePage->m_layoutDone) {
-                doc->SetDrawingPage(idx - 1);
-                penultimatePage->LayOut();
-                doc->SetDrawingPage(idx);
-            }
+        if (this->GetIdx() > 0) {
+            // Laid out before in Page::LayOut
+            Page *penultimatePage = vrv_cast<Page *>(pages->GetPrevious(this));
+            assert(penultimatePage && penultimatePage->m_layoutDone);
             int previousStepSize = penultimatePage->CalcJustificationStepSize(systemsOnly);
             if (previousStepSize < stepSize) {
                 stepSize = previousStepSize;
@@ -533,7 +578,7 @@ void Page::JustifyVertically()
     }
 
     // Justify Y position
-    Functor justifyY(&Object::JustifyY);
+    Functor justifyY(&Object::JustifyY, "JustifyY");
     JustifyYParams justifyYParams(&justifyY, doc);
     justifyYParams.m_stepSize = stepSize;
     this->Process(&justifyY, &justifyYParams);
@@ -541,7 +586,7 @@ void Page::JustifyVertically()
 
 void Page::LayOutPitchPos()
 {
-    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
@@ -550,24 +595,46 @@ void Page::LayOutPitchPos()
 
     // Set the pitch / pos alignement
     SetAlignmentPitchPosParams setAlignmentPitchPosParams(doc);
-    Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos);
+    Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos, "SetAlignmentPitchPos");
     this->Process(&setAlignmentPitchPos, &setAlignmentPitchPosParams);
 
     CalcStemParams calcStemParams(doc);
-    Functor calcStem(&Object::CalcStem);
+    Functor calcStem(&Object::CalcStem, "CalcStem");
     this->Process(&calcStem, &calcStemParams);
 }
 
+void Page::LayOutTimes()
+{
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
+    assert(doc);
+
+    // Doc::SetDrawingPage should have been called before
+    // Make sure we have the correct page
+    assert(this == doc->GetDrawingPage());
+
+    // Reset the horizontal alignment
+    Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment, "ResetHorizontalAlignment");
+    this->Process(&resetHorizontalAlignment, NULL);
+
+    // Align the content of the page using measure aligners
+    // After this:
+    // - each LayerElement object will have its Alignment pointer initialized, with the time set
+    Functor alignHorizontally(&Object::AlignHorizontally, "AlignHorizontally");
+    Functor alignHorizontallyEnd(&Object::AlignHorizontallyEnd, "AlignHorizontallyEnd");
+    AlignHorizontallyParams alignHorizontallyParams(&alignHorizontally, doc);
+    this->Process(&alignHorizontally, &alignHorizontallyParams, &alignHorizontallyEnd);
+}
+
 int Page::GetContentHeight() const
 {
-    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
-    System *last = dynamic_cast<System *>(m_children.back());
+    System *last = vrv_cast<System *>(m_children.back());
     assert(last);
     int height = doc->m_drawingPageHeight - doc->m_drawingPageMarginTop - last->GetDrawingYRel() + last->GetHeight();
 
@@ -581,7 +648,7 @@ int Page::GetContentHeight() const
 
 int Page::GetContentWidth() const
 {
-    Doc *doc = dynamic_cast<Doc *>(GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(GetFirstAncestor(DOC));
     assert(doc);
     // in non debug
     if (!doc) return 0;
@@ -590,7 +657,7 @@ int Page::GetContentWidth() const
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
-    System *first = dynamic_cast<System *>(m_children.front());
+    System *first = vrv_cast<System *>(m_children.front());
     assert(first);
 
     // For avoiding unused variable warning in non debug mode
@@ -645,21 +712,40 @@ void Page::AdjustSylSpacingByVerse(PrepareProcessingListsParams &listsParams, Do
                 // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
                 // m_drawingLastNote is set only if the syl has a forward connector
                 AdjustSylSpacingParams adjustSylSpacingParams(doc);
-                Functor adjustSylSpacing(&Object::AdjustSylSpacing);
-                Functor adjustSylSpacingEnd(&Object::AdjustSylSpacingEnd);
+                Functor adjustSylSpacing(&Object::AdjustSylSpacing, "AdjustSylSpacing");
+                Functor adjustSylSpacingEnd(&Object::AdjustSylSpacingEnd, "AdjustSylSpacingEnd");
                 this->Process(&adjustSylSpacing, &adjustSylSpacingParams, &adjustSylSpacingEnd, &filters);
             }
         }
     }
 }
 
+void Page::DrawBoundingBoxes(View &view, unsigned char update)
+{
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
+    assert(doc);
+
+    Profiler *profiler = Profiler::GetCurrent();
+    double start = (profiler) ? Profiler::GetTime() : 0.0;
+
+    view.SetDoc(doc);
+    BBoxDeviceContext bBoxDC(&view, 0, 0, update);
+    // Do not do the layout in this view - otherwise we will loop...
+    view.SetPage(this->GetIdx(), false);
+    view.DrawCurrentPage(&bBoxDC, false);
+
+    if (profiler) {
+        profiler->AddPass("DrawBoundingBoxes", Profiler::GetTime() - start, bBoxDC.GetGraphicCount(), 0);
+    }
+}
+
 //----------------------------------------------------------------------------
 // Functor methods
 //----------------------------------------------------------------------------
 
 int Page::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     params->m_page = this;
@@ -676,7 +762,7 @@ int Page::ApplyPPUFactor(FunctorParams *functorParams)
 int Page::ResetVerticalAlignment(FunctorParams *functorParams)
 {
     // Same functor, but we have not FunctorParams so we just re-instanciate it
-    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
+    Functor resetVerticalAlignment(&Object::ResetVerticalAlignment, "ResetVerticalAlignment");
 
     RunningElement *header = this->GetHeader();
     if (header) {
@@ -696,7 +782,7 @@ int Page::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int Page::AlignVerticallyEnd(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_cumulatedShift
@@ -722,7 +808,7 @@ int Page::AlignVerticallyEnd(FunctorParams *functorParams)
 
 int Page::AlignSystems(FunctorParams *functorParams)
 {
-    AlignSystemsParams *params = dynamic_cast<AlignSystemsParams *>(functorParams);
+    AlignSystemsParams *params = vrv_cast<AlignSystemsParams *>(functorParams);
     assert(params);
 
     params->m_justifiableSystems = 0;
@@ -745,7 +831,7 @@ int Page::AlignSystems(FunctorParams *functorParams)
 
 int Page::AlignSystemsEnd(FunctorParams *functorParams)
 {
-    AlignSystemsParams *params = dynamic_cast<AlignSystemsParams *>(functorParams);
+    AlignSystemsParams *params = vrv_cast<AlignSystemsParams *>(functorParams);
     assert(params);
 
     this->m_drawingJustifiableHeight
@@ -118,13 +118,13 @@ int PitchInterface::CalcLoc(
     assert(layerElement);
 
     if (layerElement->Is(CHORD)) {
-        Chord *chord = dynamic_cast<Chord *>(layerElement);
+        Chord *chord = vrv_cast<Chord *>(layerElement);
         assert(chord);
         Note *note = (topChordNote) ? chord->GetTopNote() : chord->GetBottomNote();
         return CalcLoc(note, layer, crossStaffElement);
     }
     else if (layerElement->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(layerElement);
+        Note *note = vrv_cast<Note *>(layerElement);
         assert(note);
         if (note->HasLoc()) {
             return note->GetLoc();
@@ -91,7 +91,7 @@ void Rend::AddChild(Object *child)
 
 int Rend::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     if (this->GetHalign()) {
@@ -49,6 +49,9 @@ void Rest::Reset()
     ResetColor();
     ResetCue();
     ResetRestVisMensural();
+
+    m_realTimeOnsetMilliseconds = 0;
+    m_realTimeOffsetMilliseconds = 0;
 }
 
 void Rest::AddChild(Object *child)
@@ -113,13 +116,23 @@ int Rest::GetRestLocOffset(int loc)
     return loc;
 }
 
+void Rest::SetRealTimeOnsetSeconds(double timeInSeconds)
+{
+    m_realTimeOnsetMilliseconds = timeInSeconds * 1000.0;
+}
+
+void Rest::SetRealTimeOffsetSeconds(double timeInSeconds)
+{
+    m_realTimeOffsetMilliseconds = timeInSeconds * 1000.0;
+}
+
 //----------------------------------------------------------------------------
 // Functors methods
 //----------------------------------------------------------------------------
 
 int Rest::ConvertAnalyticalMarkup(FunctorParams *functorParams)
 {
-    ConvertAnalyticalMarkupParams *params = dynamic_cast<ConvertAnalyticalMarkupParams *>(functorParams);
+    ConvertAnalyticalMarkupParams *params = vrv_cast<ConvertAnalyticalMarkupParams *>(functorParams);
     assert(params);
 
     if (this->HasFermata()) {
@@ -132,7 +145,7 @@ int Rest::ConvertAnalyticalMarkup(FunctorParams *functorParams)
 
 int Rest::PrepareLayerElementParts(FunctorParams *functorParams)
 {
-    Dots *currentDots = dynamic_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
+    Dots *currentDots = vrv_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
 
     if ((this->GetDur() > DUR_BR) && (this->GetDots() > 0)) {
         if (!currentDots) {
@@ -150,7 +163,7 @@ int Rest::PrepareLayerElementParts(FunctorParams *functorParams)
 
     /************ Prepare the drawing cue size ************/
 
-    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize);
+    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize, "PrepareDrawingCueSize");
     this->Process(&prepareDrawingCueSize, NULL);
 
     return FUNCTOR_CONTINUE;
@@ -158,7 +171,7 @@ int Rest::PrepareLayerElementParts(FunctorParams *functorParams)
 
 int Rest::CalcDots(FunctorParams *functorParams)
 {
-    CalcDotsParams *params = dynamic_cast<CalcDotsParams *>(functorParams);
+    CalcDotsParams *params = vrv_cast<CalcDotsParams *>(functorParams);
     assert(params);
 
     // We currently have no dots object with mensural rests
@@ -171,7 +184,7 @@ int Rest::CalcDots(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
 
     if (this->m_crossStaff) staff = this->m_crossStaff;
@@ -180,7 +193,7 @@ int Rest::CalcDots(FunctorParams *functorParams)
     int staffSize = staff->m_drawingStaffSize;
 
     // For single rests we need here to set the dot loc
-    Dots *dots = dynamic_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
+    Dots *dots = vrv_cast<Dots *>(this->FindDescendantByType(DOTS, 1));
     assert(dots);
 
     std::list<int> *dotLocs = dots->GetDotLocsForStaff(staff);
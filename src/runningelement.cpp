@@ -114,10 +114,10 @@ void RunningElement::FilterList(ArrayOfObjects *childList)
 
     for (iter = childList->begin(); iter != childList->end(); ++iter) {
         int pos = 0;
-        AreaPosInterface *interface = dynamic_cast<AreaPosInterface *>(*iter);
+        AreaPosInterface *interface = vrv_cross_cast<AreaPosInterface *>(*iter);
         assert(interface);
         pos = this->GetAlignmentPos(interface->GetHalign(), interface->GetValign());
-        TextElement *text = dynamic_cast<TextElement *>(*iter);
+        TextElement *text = vrv_cast<TextElement *>(*iter);
         assert(text);
         m_cells[pos].push_back(text);
     }
@@ -158,7 +158,7 @@ int RunningElement::GetWidth() const
 {
     if (!m_drawingPage) return 0;
 
-    Doc *doc = dynamic_cast<Doc *>(m_drawingPage->GetFirstAncestor(DOC));
+    Doc *doc = vrv_cast<Doc *>(m_drawingPage->GetFirstAncestor(DOC));
     if (!doc) return 0;
 
     return (doc->m_drawingPageWidth - doc->m_drawingPageMarginLeft - doc->m_drawingPageMarginRight);
@@ -333,10 +333,10 @@ void RunningElement::SetCurrentPageNum(Page *currentPage)
 
     int currentNum = currentPage->GetIdx() + 1;
 
-    Num *num = dynamic_cast<Num *>(this->FindDescendantByType(NUM));
+    Num *num = vrv_cast<Num *>(this->FindDescendantByType(NUM));
     if (!num || (num->GetLabel() != "page")) return;
 
-    Text *text = dynamic_cast<Text *>(num->FindDescendantByType(TEXT));
+    Text *text = vrv_cast<Text *>(num->FindDescendantByType(TEXT));
     if (!text || (text->GetText() != L"#")) return;
 
     Text *currentText = num->GetCurrentText();
@@ -345,12 +345,14 @@ void RunningElement::SetCurrentPageNum(Page *currentPage)
     currentText->SetText(UTF8to16(StringFormat("%d", currentNum)));
 }
 
-void RunningElement::LoadFooter()
+void RunningElement::LoadFooter(const Doc *doc)
 {
+    assert(doc);
+
     Fig *fig = new Fig();
     Svg *svg = new Svg();
 
-    std::string footer = Resources::GetPath() + "/footer.svg";
+    std::string footer = doc->GetResources().GetPath() + "/footer.svg";
     pugi::xml_document footerDoc;
     footerDoc.load_file(footer.c_str());
     svg->Set(footerDoc.first_child());
@@ -406,7 +408,7 @@ int RunningElement::SaveEnd(FunctorParams *functorParams)
 
 int RunningElement::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_pageWidth = this->GetWidth();
@@ -14,6 +14,7 @@
 //----------------------------------------------------------------------------
 
 #include "clef.h"
+#include "doc.h"
 #include "editorial.h"
 #include "functorparams.h"
 #include "keysig.h"
@@ -24,6 +25,7 @@
 #include "pgfoot2.h"
 #include "pghead.h"
 #include "pghead2.h"
+#include "smufl.h"
 #include "staffdef.h"
 #include "staffgrp.h"
 #include "system.h"
@@ -75,7 +77,7 @@ bool ScoreDefElement::HasMeterSigInfo()
 Clef *ScoreDefElement::GetClef()
 {
     // Always check if HasClefInfo() is true before asking for it
-    Clef *clef = dynamic_cast<Clef *>(this->FindDescendantByType(CLEF, 1));
+    Clef *clef = vrv_cast<Clef *>(this->FindDescendantByType(CLEF, 1));
     assert(clef);
     return clef;
 }
@@ -92,7 +94,7 @@ Clef *ScoreDefElement::GetClefCopy()
 KeySig *ScoreDefElement::GetKeySig()
 {
     // Always check if HasKeySigInfo() is true before asking for it
-    KeySig *keySig = dynamic_cast<KeySig *>(this->FindDescendantByType(KEYSIG, 1));
+    KeySig *keySig = vrv_cast<KeySig *>(this->FindDescendantByType(KEYSIG, 1));
     assert(keySig);
     return keySig;
 }
@@ -109,7 +111,7 @@ KeySig *ScoreDefElement::GetKeySigCopy()
 Mensur *ScoreDefElement::GetMensur()
 {
     // Always check if HasMensurInfo() is true before asking for it
-    Mensur *mensur = dynamic_cast<Mensur *>(this->FindDescendantByType(MENSUR, 1));
+    Mensur *mensur = vrv_cast<Mensur *>(this->FindDescendantByType(MENSUR, 1));
     assert(mensur);
     return mensur;
 }
@@ -126,7 +128,7 @@ Mensur *ScoreDefElement::GetMensurCopy()
 MeterSig *ScoreDefElement::GetMeterSig()
 {
     // Always check if HasMeterSigInfo() is true before asking for it
-    MeterSig *meterSig = dynamic_cast<MeterSig *>(this->FindDescendantByType(METERSIG, 1));
+    MeterSig *meterSig = vrv_cast<MeterSig *>(this->FindDescendantByType(METERSIG, 1));
     assert(meterSig);
     return meterSig;
 }
@@ -231,7 +233,7 @@ void ScoreDef::ReplaceDrawingValues(ScoreDef *newScoreDef)
     }
 
     ReplaceDrawingValuesInStaffDefParams replaceDrawingValuesInStaffDefParams(clef, keySig, mensur, meterSig);
-    Functor replaceDrawingValuesInScoreDef(&Object::ReplaceDrawingValuesInStaffDef);
+    Functor replaceDrawingValuesInScoreDef(&Object::ReplaceDrawingValuesInStaffDef, "ReplaceDrawingValuesInStaffDef");
     this->Process(&replaceDrawingValuesInScoreDef, &replaceDrawingValuesInStaffDefParams);
 
     if (mensur) delete mensur;
@@ -309,7 +311,7 @@ StaffDef *ScoreDef::GetStaffDef(int n)
     StaffDef *staffDef = NULL;
     for (iter = childList->begin(); iter != childList->end(); ++iter) {
         if (!(*iter)->Is(STAFFDEF)) continue;
-        staffDef = dynamic_cast<StaffDef *>(*iter);
+        staffDef = vrv_cast<StaffDef *>(*iter);
         assert(staffDef);
         if (staffDef->GetN() == n) {
             return staffDef;
@@ -330,7 +332,7 @@ std::vector<int> ScoreDef::GetStaffNs()
     for (iter = childList->begin(); iter != childList->end(); ++iter) {
         // It should be staffDef only, but double check.
         if (!(*iter)->Is(STAFFDEF)) continue;
-        staffDef = dynamic_cast<StaffDef *>(*iter);
+        staffDef = vrv_cast<StaffDef *>(*iter);
         assert(staffDef);
         ns.push_back(staffDef->GetN());
     }
@@ -347,7 +349,7 @@ void ScoreDef::SetRedrawFlags(bool clef, bool keySig, bool mensur, bool meterSig
     setStaffDefRedrawFlagsParams.m_mensur = mensur;
     setStaffDefRedrawFlagsParams.m_meterSig = meterSig;
     setStaffDefRedrawFlagsParams.m_applyToAll = applyToAll;
-    Functor setStaffDefDraw(&Object::SetStaffDefRedrawFlags);
+    Functor setStaffDefDraw(&Object::SetStaffDefRedrawFlags, "SetStaffDefRedrawFlags");
     this->Process(&setStaffDefDraw, &setStaffDefRedrawFlagsParams);
 }
 
@@ -356,29 +358,64 @@ void ScoreDef::SetDrawingWidth(int drawingWidth)
     m_drawingWidth = drawingWidth;
 }
 
+int ScoreDef::CalcDrawingWidth(Doc *doc)
+{
+    assert(doc);
+
+    char numAlteration = 0;
+
+    // key signature of the scoreDef
+    if (this->HasKeySigInfo()) {
+        KeySig *keySig = this->GetKeySig();
+        assert(keySig);
+        numAlteration = (keySig->GetAccidCount() > numAlteration) ? keySig->GetAccidCount() : numAlteration;
+    }
+
+    // longest key signature of the staffDefs
+    const ArrayOfObjects *scoreDefList = this->GetList(this); // make sure it's initialized
+    for (ArrayOfObjects::const_iterator it = scoreDefList->begin(); it != scoreDefList->end(); ++it) {
+        StaffDef *staffDef = vrv_cast<StaffDef *>(*it);
+        assert(staffDef);
+        if (!staffDef->HasKeySigInfo()) continue;
+        KeySig *keySig = staffDef->GetKeySig();
+        assert(keySig);
+        numAlteration = (keySig->GetAccidCount() > numAlteration) ? keySig->GetAccidCount() : numAlteration;
+    }
+
+    int width = 0;
+    // G-clef as default width
+    width += doc->GetLeftMargin(CLEF) + doc->GetGlyphWidth(SMUFL_E050_gClef, 100, false) + doc->GetRightMargin(CLEF);
+    if (numAlteration > 0) {
+        width += doc->GetLeftMargin(KEYSIG) + doc->GetGlyphWidth(SMUFL_E262_accidentalSharp, 100, false) * TEMP_KEYSIG_STEP
+            + doc->GetRightMargin(KEYSIG);
+    }
+
+    return width;
+}
+
 PgFoot *ScoreDef::GetPgFoot()
 {
-    return dynamic_cast<PgFoot *>(this->FindDescendantByType(PGFOOT));
+    return vrv_cast<PgFoot *>(this->FindDescendantByType(PGFOOT));
 }
 
 PgFoot2 *ScoreDef::GetPgFoot2()
 {
-    return dynamic_cast<PgFoot2 *>(this->FindDescendantByType(PGFOOT2));
+    return vrv_cast<PgFoot2 *>(this->FindDescendantByType(PGFOOT2));
 }
 
 PgHead *ScoreDef::GetPgHead()
 {
-    return dynamic_cast<PgHead *>(this->FindDescendantByType(PGHEAD));
+    return vrv_cast<PgHead *>(this->FindDescendantByType(PGHEAD));
 }
 
 PgHead2 *ScoreDef::GetPgHead2()
 {
-    return dynamic_cast<PgHead2 *>(this->FindDescendantByType(PGHEAD2));
+    return vrv_cast<PgHead2 *>(this->FindDescendantByType(PGHEAD2));
 }
 
 int ScoreDef::GetMaxStaffSize()
 {
-    StaffGrp *staffGrp = dynamic_cast<StaffGrp *>(this->FindDescendantByType(STAFFGRP));
+    StaffGrp *staffGrp = vrv_cast<StaffGrp *>(this->FindDescendantByType(STAFFGRP));
     return (staffGrp) ? staffGrp->GetMaxStaffSize() : 100;
 }
 
@@ -388,7 +425,7 @@ int ScoreDef::GetMaxStaffSize()
 
 int ScoreDef::ConvertToPageBased(FunctorParams *functorParams)
 {
-    ConvertToPageBasedParams *params = dynamic_cast<ConvertToPageBasedParams *>(functorParams);
+    ConvertToPageBasedParams *params = vrv_cast<ConvertToPageBasedParams *>(functorParams);
     assert(params);
 
     // Move itself to the pageBasedSystem - do not process children
@@ -399,7 +436,7 @@ int ScoreDef::ConvertToPageBased(FunctorParams *functorParams)
 
 int ScoreDef::CastOffSystems(FunctorParams *functorParams)
 {
-    CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
+    CastOffSystemsParams *params = vrv_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
     // Since the functor returns FUNCTOR_SIBLINGS we should never go lower than the system children
@@ -423,7 +460,7 @@ int ScoreDef::CastOffSystems(FunctorParams *functorParams)
 
 int ScoreDef::CastOffEncoding(FunctorParams *functorParams)
 {
-    CastOffEncodingParams *params = dynamic_cast<CastOffEncodingParams *>(functorParams);
+    CastOffEncodingParams *params = vrv_cast<CastOffEncodingParams *>(functorParams);
     assert(params);
 
     MoveItselfTo(params->m_currentSystem);
@@ -64,7 +64,7 @@ void Slur::GetCrossStaffOverflows(
     // If the starting point is a chord we need to select the appropriate extreme staff
     Staff *startStaff = NULL;
     if (this->GetStart()->Is(CHORD)) {
-        Chord *chord = dynamic_cast<Chord *>(this->GetStart());
+        Chord *chord = vrv_cast<Chord *>(this->GetStart());
         assert(chord);
         Staff *staffAbove = NULL;
         Staff *staffBelow = NULL;
@@ -77,7 +77,7 @@ void Slur::GetCrossStaffOverflows(
     // Same for the end point
     Staff *endStaff = NULL;
     if (this->GetEnd()->Is(CHORD)) {
-        Chord *chord = dynamic_cast<Chord *>(this->GetEnd());
+        Chord *chord = vrv_cast<Chord *>(this->GetEnd());
         assert(chord);
         Staff *staffAbove = NULL;
         Staff *staffBelow = NULL;
@@ -90,10 +90,10 @@ void Slur::GetCrossStaffOverflows(
 
     // No cross-staff endpoints, check if the slur itself crosses staves
     if (!startStaff) {
-        startStaff = dynamic_cast<Staff *>(this->GetStart()->GetFirstAncestor(STAFF));
+        startStaff = vrv_cast<Staff *>(this->GetStart()->GetFirstAncestor(STAFF));
     }
     if (!endStaff) {
-        endStaff = dynamic_cast<Staff *>(this->GetEnd()->GetFirstAncestor(STAFF));
+        endStaff = vrv_cast<Staff *>(this->GetEnd()->GetFirstAncestor(STAFF));
     }
 
     // This happens with slurs starting or ending with a timestamp
@@ -334,19 +334,18 @@ void Slur::AdjustSlurPosition(Doc *doc, FloatingCurvePositioner *curve,
 
     int margin = 1 * doc->GetDrawingUnit(100) / 2;
 
-    for (auto &spannedElement : *spannedElements) {
+    // Calculate the adjustments for all the spanned elements at once - discarded elements are flagged
+    std::vector<int> intersections;
+    curve->CalcAdjustments(spannedElements, intersections, margin);
+
+    for (int i = 0; i < (int)spannedElements->size(); ++i) {
+        CurveSpannedElement *spannedElement = spannedElements->at(i);
 
         if (spannedElement->m_discarded) {
             continue;
         }
 
-        bool discard = false;
-        int intersection = curve->CalcAdjustment(spannedElement->m_boundingBox, discard, margin);
-
-        if (discard == true) {
-            spannedElement->m_discarded = true;
-            continue;
-        }
+        int intersection = intersections.at(i);
 
         if (intersection == 0) {
             continue;
@@ -142,20 +142,28 @@ void Staff::AddChild(Object *child)
 
 int Staff::GetDrawingX() const
 {
+    // The cached value is never set for a staff positioned with its facsimile
+    if (m_cachedDrawingX != VRV_UNSET) return m_cachedDrawingX;
+
     if (this->HasFacs()) {
-        Doc *doc = dynamic_cast<Doc *>(this->GetFirstAncestor(DOC));
+        Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
         assert(doc);
         if (doc->GetType() == Facs) {
             return FacsimileInterface::GetDrawingX();
         }
     }
-    return Object::GetDrawingX();
+
+    m_cachedDrawingX = Object::GetDrawingX();
+    return m_cachedDrawingX;
 }
 
 int Staff::GetDrawingY() const
 {
+    // The cached value is never set for a staff positioned with its facsimile
+    if ((m_yAbs == VRV_UNSET) && m_staffAlignment && (m_cachedDrawingY != VRV_UNSET)) return m_cachedDrawingY;
+
     if (this->HasFacs()) {
-        Doc *doc = dynamic_cast<Doc *>(this->GetFirstAncestor(DOC));
+        Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
         assert(DOC);
         if (doc->GetType() == Facs) {
             return FacsimileInterface::GetDrawingY();
@@ -168,7 +176,7 @@ int Staff::GetDrawingY() const
 
     if (m_cachedDrawingY != VRV_UNSET) return m_cachedDrawingY;
 
-    System *system = dynamic_cast<System *>(this->GetFirstAncestor(SYSTEM));
+    System *system = vrv_cast<System *>(this->GetFirstAncestor(SYSTEM));
     assert(system);
 
     m_cachedDrawingY = system->GetDrawingY() + m_staffAlignment->GetYRel();
@@ -177,7 +185,7 @@ int Staff::GetDrawingY() const
 
 bool Staff::DrawingIsVisible()
 {
-    System *system = dynamic_cast<System *>(this->GetFirstAncestor(SYSTEM));
+    System *system = vrv_cast<System *>(this->GetFirstAncestor(SYSTEM));
     assert(system);
     assert(system->GetDrawingScoreDef());
 
@@ -290,7 +298,7 @@ void LedgerLine::AddDash(int left, int right)
 
 int Staff::ConvertToCastOffMensural(FunctorParams *functorParams)
 {
-    ConvertToCastOffMensuralParams *params = dynamic_cast<ConvertToCastOffMensuralParams *>(functorParams);
+    ConvertToCastOffMensuralParams *params = vrv_cast<ConvertToCastOffMensuralParams *>(functorParams);
     assert(params);
 
     params->m_targetStaff = new Staff(*this);
@@ -313,7 +321,7 @@ int Staff::UnsetCurrentScoreDef(FunctorParams *functorParams)
 
 int Staff::OptimizeScoreDef(FunctorParams *functorParams)
 {
-    OptimizeScoreDefParams *params = dynamic_cast<OptimizeScoreDefParams *>(functorParams);
+    OptimizeScoreDefParams *params = vrv_cast<OptimizeScoreDefParams *>(functorParams);
     assert(params);
 
     assert(params->m_currentScoreDef);
@@ -365,7 +373,7 @@ int Staff::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int Staff::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     if (m_yAbs != VRV_UNSET) m_yAbs /= params->m_page->GetPPUFactor();
@@ -375,7 +383,7 @@ int Staff::ApplyPPUFactor(FunctorParams *functorParams)
 
 int Staff::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     assert(this->m_drawingStaffDef);
@@ -392,7 +400,7 @@ int Staff::AlignHorizontally(FunctorParams *functorParams)
 
 int Staff::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     if (!this->DrawingIsVisible()) {
@@ -412,7 +420,7 @@ int Staff::AlignVertically(FunctorParams *functorParams)
     std::vector<Object *>::iterator it;
     it = std::find_if(m_timeSpanningElements.begin(), m_timeSpanningElements.end(), ObjectComparison(VERSE));
     if (it != m_timeSpanningElements.end()) {
-        Verse *v = dynamic_cast<Verse *>(*it);
+        Verse *v = vrv_cast<Verse *>(*it);
         assert(v);
         alignment->SetVerseCount(v->GetN());
     }
@@ -425,14 +433,14 @@ int Staff::AlignVertically(FunctorParams *functorParams)
 
 int Staff::FillStaffCurrentTimeSpanning(FunctorParams *functorParams)
 {
-    FillStaffCurrentTimeSpanningParams *params = dynamic_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
+    FillStaffCurrentTimeSpanningParams *params = vrv_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
     assert(params);
 
     std::vector<Object *>::iterator iter = params->m_timeSpanningElements.begin();
     while (iter != params->m_timeSpanningElements.end()) {
         TimeSpanningInterface *interface = (*iter)->GetTimeSpanningInterface();
         assert(interface);
-        Measure *currentMeasure = dynamic_cast<Measure *>(this->GetFirstAncestor(MEASURE));
+        Measure *currentMeasure = vrv_cast<Measure *>(this->GetFirstAncestor(MEASURE));
         assert(currentMeasure);
         // We need to make sure we are in the next measure (and not just a staff below because of some cross staff
         // notation
@@ -453,7 +461,7 @@ int Staff::ResetDrawing(FunctorParams *functorParams)
 
 int Staff::PrepareRpt(FunctorParams *functorParams)
 {
-    PrepareRptParams *params = dynamic_cast<PrepareRptParams *>(functorParams);
+    PrepareRptParams *params = vrv_cast<PrepareRptParams *>(functorParams);
     assert(params);
 
     // If multiNumber is set, we already know that nothing needs to be done
@@ -476,7 +484,7 @@ int Staff::PrepareRpt(FunctorParams *functorParams)
 
 int Staff::CalcOnsetOffset(FunctorParams *functorParams)
 {
-    CalcOnsetOffsetParams *params = dynamic_cast<CalcOnsetOffsetParams *>(functorParams);
+    CalcOnsetOffsetParams *params = vrv_cast<CalcOnsetOffsetParams *>(functorParams);
     assert(params);
 
     assert(this->m_drawingStaffDef);
@@ -533,7 +541,7 @@ int Staff::CalcStem(FunctorParams *)
 
 int Staff::AdjustSylSpacing(FunctorParams *functorParams)
 {
-    AdjustSylSpacingParams *params = dynamic_cast<AdjustSylSpacingParams *>(functorParams);
+    AdjustSylSpacingParams *params = vrv_cast<AdjustSylSpacingParams *>(functorParams);
     assert(params);
 
     // Set the staff size for this pass
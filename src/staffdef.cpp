@@ -105,11 +105,11 @@ void StaffDef::AddChild(Object *child)
 
 bool StaffDef::IsInBraceAndBracket()
 {
-    StaffGrp *staffGrp1 = dynamic_cast<StaffGrp *>(this->GetFirstAncestor(STAFFGRP));
+    StaffGrp *staffGrp1 = vrv_cast<StaffGrp *>(this->GetFirstAncestor(STAFFGRP));
     if (!staffGrp1 || !staffGrp1->HasSymbol()) {
         return false;
     }
-    StaffGrp *staffGrp2 = dynamic_cast<StaffGrp *>(staffGrp1->GetFirstAncestor(STAFFGRP));
+    StaffGrp *staffGrp2 = vrv_cast<StaffGrp *>(staffGrp1->GetFirstAncestor(STAFFGRP));
     if (!staffGrp2 || !staffGrp2->HasSymbol()) {
         return false;
     }
@@ -122,7 +122,7 @@ bool StaffDef::IsInBraceAndBracket()
 
 int StaffDef::ReplaceDrawingValuesInStaffDef(FunctorParams *functorParams)
 {
-    ReplaceDrawingValuesInStaffDefParams *params = dynamic_cast<ReplaceDrawingValuesInStaffDefParams *>(functorParams);
+    ReplaceDrawingValuesInStaffDefParams *params = vrv_cast<ReplaceDrawingValuesInStaffDefParams *>(functorParams);
     assert(params);
 
     if (params->m_clef) {
@@ -143,7 +143,7 @@ int StaffDef::ReplaceDrawingValuesInStaffDef(FunctorParams *functorParams)
 
 int StaffDef::SetStaffDefRedrawFlags(FunctorParams *functorParams)
 {
-    SetStaffDefRedrawFlagsParams *params = dynamic_cast<SetStaffDefRedrawFlagsParams *>(functorParams);
+    SetStaffDefRedrawFlagsParams *params = vrv_cast<SetStaffDefRedrawFlagsParams *>(functorParams);
     assert(params);
 
     if (params->m_clef || params->m_applyToAll) {
@@ -115,7 +115,7 @@ int StaffGrp::GetMaxStaffSize()
 
     StaffDef *staffDef = NULL;
     for (auto &child : *childList) {
-        staffDef = dynamic_cast<StaffDef *>(child);
+        staffDef = vrv_cast<StaffDef *>(child);
         assert(staffDef);
         if (staffDef->HasScale() && staffDef->GetScale() >= max) {
             max = staffDef->GetScale();
@@ -141,7 +141,7 @@ int StaffGrp::OptimizeScoreDefEnd(FunctorParams *)
 
     for (auto &child : m_children) {
         if (child->Is(STAFFDEF)) {
-            StaffDef *staffDef = dynamic_cast<StaffDef *>(child);
+            StaffDef *staffDef = vrv_cast<StaffDef *>(child);
             assert(staffDef);
             if (staffDef->GetDrawingVisibility() != OPTIMIZATION_HIDDEN) {
                 this->SetDrawingVisibility(OPTIMIZATION_SHOW);
@@ -149,7 +149,7 @@ int StaffGrp::OptimizeScoreDefEnd(FunctorParams *)
             }
         }
         else if (child->Is(STAFFGRP)) {
-            StaffGrp *staffGrp = dynamic_cast<StaffGrp *>(child);
+            StaffGrp *staffGrp = vrv_cast<StaffGrp *>(child);
             assert(staffGrp);
             if (staffGrp->GetDrawingVisibility() != OPTIMIZATION_HIDDEN) {
                 this->SetDrawingVisibility(OPTIMIZATION_SHOW);
@@ -161,7 +161,7 @@ int StaffGrp::OptimizeScoreDefEnd(FunctorParams *)
     if ((this->GetSymbol() == staffGroupingSym_SYMBOL_brace) && (this->GetDrawingVisibility() != OPTIMIZATION_HIDDEN)) {
         for (auto &child : m_children) {
             if (child->Is(STAFFDEF)) {
-                StaffDef *staffDef = dynamic_cast<StaffDef *>(child);
+                StaffDef *staffDef = vrv_cast<StaffDef *>(child);
                 assert(staffDef);
                 staffDef->SetDrawingVisibility(OPTIMIZATION_SHOW);
             }
@@ -62,7 +62,7 @@ int Surface::GetMaxX()
     ArrayOfObjects zones;
     FindAllDescendantByComparison(&zones, &ac);
     for (auto iter = zones.begin(); iter != zones.end(); iter++) {
-        Zone *zone = dynamic_cast<Zone *>(*iter);
+        Zone *zone = vrv_cast<Zone *>(*iter);
         assert(zone);
         max = (zone->GetLrx() > max) ? zone->GetLrx() : max;
     }
@@ -77,7 +77,7 @@ int Surface::GetMaxY()
     ArrayOfObjects zones;
     FindAllDescendantByComparison(&zones, &ac);
     for (auto iter = zones.begin(); iter != zones.end(); iter++) {
-        Zone *zone = dynamic_cast<Zone *>(*iter);
+        Zone *zone = vrv_cast<Zone *>(*iter);
         assert(zone);
         max = (zone->GetLry() > max) ? zone->GetLry() : max;
     }
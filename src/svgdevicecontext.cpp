@@ -29,6 +29,184 @@ namespace vrv {
 #define space " "
 #define semicolon ";"
 
+//----------------------------------------------------------------------------
+// SvgMarker
+//----------------------------------------------------------------------------
+
+SvgMarker::SvgMarker()
+{
+    m_buffer = NULL;
+    m_shapesEnd = 0;
+    m_end = 0;
+    m_isEmpty = false;
+    m_depth = 0;
+}
+
+//----------------------------------------------------------------------------
+// SvgBuffer
+//----------------------------------------------------------------------------
+
+void SvgBuffer::Insert(size_t pos, SvgBuffer &buffer, size_t length)
+{
+    assert(pos + length <= m_data.size());
+
+    // Markers are always inside an element, so never at an insertion position of another element
+    size_t size = buffer.m_data.size();
+    if (pos + length < m_data.size()) {
+        for (auto &marker : m_markers) {
+            if (marker->m_shapesEnd > pos) marker->m_shapesEnd = marker->m_shapesEnd + size - length;
+            if (marker->m_end > pos) marker->m_end = marker->m_end + size - length;
+        }
+    }
+    for (auto &marker : buffer.m_markers) {
+        marker->m_buffer = this;
+        marker->m_shapesEnd += pos;
+        marker->m_end += pos;
+        m_markers.push_back(marker);
+    }
+    buffer.m_markers.clear();
+
+    if ((pos == m_data.size()) && (length == 0)) {
+        m_data.append(buffer.m_data);
+    }
+    else {
+        m_data.replace(pos, length, buffer.m_data);
+    }
+    buffer.m_data.clear();
+}
+
+//----------------------------------------------------------------------------
+// SvgElement
+//----------------------------------------------------------------------------
+
+SvgElement::SvgElement(const std::string &name, Position position)
+{
+    m_name = name;
+    m_position = position;
+    m_hasText = false;
+    m_depth = 0;
+    m_target = NULL;
+    m_resumed = NULL;
+}
+
+void SvgElement::AddAttribute(const std::string &name, const std::string &value)
+{
+    m_attributes.push_back(std::make_pair(name, value));
+}
+
+void SvgElement::AddAttribute(const std::string &name, int value)
+{
+    m_attributes.push_back(std::make_pair(name, StringFormat("%d", value)));
+}
+
+void SvgElement::AddAttribute(const std::string &name, double value)
+{
+    // Same precision as pugixml for doubles
+    m_attributes.push_back(std::make_pair(name, StringFormat("%.17g", value)));
+}
+
+const std::string *SvgElement::GetAttribute(const std::string &name) const
+{
+    for (auto &attribute : m_attributes) {
+        if (attribute.first == name) return &attribute.second;
+    }
+    return NULL;
+}
+
+void SvgElement::SetText(const std::string &text)
+{
+    m_hasText = true;
+    m_text = text;
+}
+
+void SvgElement::Write(SvgBuffer &buffer, SvgMarker *marker, bool newLine)
+{
+    std::string &data = buffer.m_data;
+    if (newLine) data.push_back('\n');
+    WriteIndent(data, m_depth);
+    data.push_back('<');
+    data.append(m_name);
+    for (auto &attribute : m_attributes) {
+        data.push_back(' ');
+        data.append(attribute.first);
+        data.append("=\"");
+        WriteEscaped(data, attribute.second, true);
+        data.push_back('"');
+    }
+
+    if (m_hasText) {
+        data.push_back('>');
+        WriteEscaped(data, m_text, false);
+        data.append("</" + m_name + ">");
+        return;
+    }
+
+    if (m_shapes.IsEmpty() && m_groups.IsEmpty()) {
+        if (marker) {
+            marker->m_isEmpty = true;
+            marker->m_end = data.size();
+        }
+        data.append(" />");
+    }
+    else {
+        data.push_back('>');
+        buffer.Append(m_shapes);
+        if (marker) marker->m_shapesEnd = data.size();
+        buffer.Append(m_groups);
+        if (marker) marker->m_end = data.size();
+        data.push_back('\n');
+        WriteIndent(data, m_depth);
+        data.append("</" + m_name + ">");
+    }
+
+    if (marker) {
+        marker->m_buffer = &buffer;
+        marker->m_depth = m_depth;
+        const std::string *fontFamily = this->GetAttribute("font-family");
+        if (fontFamily) marker->m_fontFamily = *fontFamily;
+        buffer.m_markers.push_back(marker);
+    }
+}
+
+void SvgElement::WriteIndent(std::string &data, int depth)
+{
+    data.append(depth, '\t');
+}
+
+void SvgElement::WriteEscaped(std::string &data, const std::string &value, bool isAttribute)
+{
+    // Same escaping as pugixml
+    for (char c : value) {
+        unsigned char ch = static_cast<unsigned char>(c);
+        switch (c) {
+            case '&': data.append("&amp;"); break;
+            case '<': data.append("&lt;"); break;
+            case '>':
+                if (isAttribute)
+                    data.push_back(c);
+                else
+                    data.append("&gt;");
+                break;
+            case '"':
+                if (isAttribute)
+                    data.append("&quot;");
+                else
+                    data.push_back(c);
+                break;
+            default:
+                if ((ch < 32) && (isAttribute || ((c != '\t') && (c != '\n') && (c != '\r')))) {
+                    data.append("&#");
+                    data.push_back(static_cast<char>((ch / 10) + '0'));
+                    data.push_back(static_cast<char>((ch % 10) + '0'));
+                    data.push_back(';');
+                }
+                else {
+                    data.push_back(c);
+                }
+        }
+    }
+}
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
@@ -49,19 +227,18 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext()
     m_mmOutput = false;
     m_svgBoundingBoxes = false;
     m_svgViewBox = false;
+    m_sharedDefs = NULL;
     m_facsimile = false;
+    m_pageElement = NULL;
 
     // create the initial SVG element
     // width and height need to be set later; these are taken care of in "commit"
-    m_svgNode = m_svgDoc.append_child("svg");
-    m_svgNode.append_attribute("version") = "1.1";
-    m_svgNode.append_attribute("xmlns") = "http://www.w3.org/2000/svg";
-    m_svgNode.append_attribute("xmlns:xlink") = "http://www.w3.org/1999/xlink";
-    m_svgNode.append_attribute("overflow") = "visible";
-
-    // start the stack
-    m_svgNodeStack.push_back(m_svgNode);
-    m_currentNode = m_svgNode;
+    m_elements.emplace_back("svg");
+    SvgElement &svg = m_elements.back();
+    svg.AddAttribute("version", "1.1");
+    svg.AddAttribute("xmlns", "http://www.w3.org/2000/svg");
+    svg.AddAttribute("xmlns:xlink", "http://www.w3.org/1999/xlink");
+    svg.AddAttribute("overflow", "visible");
 
     m_outdata.clear();
 }
@@ -76,6 +253,12 @@ bool SvgDeviceContext::CopyFileToStream(const std::string &filename, std::ostrea
     return true;
 }
 
+bool SvgDeviceContext::AddSharedDef(const std::string &id)
+{
+    if (!m_sharedDefs) return true;
+    return m_sharedDefs->insert(id).second;
+}
+
 void SvgDeviceContext::Commit(bool xml_declaration)
 {
 
@@ -94,59 +277,67 @@ void SvgDeviceContext::Commit(bool xml_declaration)
         format = "%gmm";
     }
 
+    // end the elements not ended yet (if any)
+    while (m_elements.size() > 1) {
+        this->EndElement();
+    }
+
+    SvgElement &svg = m_elements.front();
     if (m_svgViewBox) {
-        m_svgNode.prepend_attribute("viewBox") = StringFormat("0 0 %g %g", width, height).c_str();
+        svg.m_attributes.insert(
+            svg.m_attributes.begin(), std::make_pair("viewBox", StringFormat("0 0 %g %g", width, height)));
     }
     else {
-        m_svgNode.prepend_attribute("height") = StringFormat(format, height).c_str();
-        m_svgNode.prepend_attribute("width") = StringFormat(format, width).c_str();
+        svg.m_attributes.insert(svg.m_attributes.begin(), std::make_pair("height", StringFormat(format, height)));
+        svg.m_attributes.insert(svg.m_attributes.begin(), std::make_pair("width", StringFormat(format, width)));
     }
 
     // add the woff VerovioText font if needed
-    if (m_vrvTextFont) {
-        std::string woff = Resources::GetPath() + "/woff.xml";
-        pugi::xml_document woffDoc;
-        woffDoc.load_file(woff.c_str());
-        m_svgNode.prepend_copy(woffDoc.first_child());
+    if (m_vrvTextFont && this->AddSharedDef("VerovioText")) {
+        std::shared_ptr<const pugi::xml_document> woffDoc = m_resources->GetWoffDocument();
+        if (woffDoc) this->AppendCopy(woffDoc->first_child(), SvgElement::PREPEND);
     }
 
     // header
     if (m_smuflGlyphs.size() > 0) {
 
-        pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
+        bool hasDefs = false;
 
         // for each needed glyph
-        std::vector<std::string>::const_iterator it;
+        std::vector<const Glyph *>::const_iterator it;
         for (it = m_smuflGlyphs.begin(); it != m_smuflGlyphs.end(); ++it) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source((*it).c_str());
-            sourceDoc.load(source);
+            if (!this->AddSharedDef((*it)->GetCodeStr())) continue;
+            // the XML content is parsed only once and kept by the glyph
+            std::shared_ptr<const pugi::xml_document> sourceDoc = (*it)->GetXMLDocument();
+            if (!sourceDoc) continue;
+            // create the <defs> only when needed since all the glyphs can be shared with previous SVGs
+            if (!hasDefs) {
+                this->StartElement("defs", SvgElement::PREPEND);
+                hasDefs = true;
+            }
 
-            // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
-                defs.append_copy(child);
+            // copy all the nodes inside into the <defs>
+            for (pugi::xml_node child = sourceDoc->first_child(); child; child = child.next_sibling()) {
+                this->AppendCopy(child);
             }
         }
-    }
-
-    unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
-    if (xml_declaration) {
-        // edit the xml declaration
-        output_flags = pugi::format_default;
-        pugi::xml_node decl = m_svgDoc.prepend_child(pugi::node_declaration);
-        decl.append_attribute("version") = "1.0";
-        decl.append_attribute("encoding") = "UTF-8";
-        decl.append_attribute("standalone") = "no";
+        if (hasDefs) this->EndElement();
     }
 
     // add description statement
-    pugi::xml_node desc = m_svgNode.prepend_child("desc");
-    desc.append_child(pugi::node_pcdata)
-        .set_value(StringFormat("Engraved by Verovio %s", GetVersion().c_str()).c_str());
+    SvgElement *desc = this->StartElement("desc", SvgElement::PREPEND);
+    desc->SetText(StringFormat("Engraved by Verovio %s", GetVersion().c_str()));
+    this->EndElement();
 
-    // save the glyph data to m_outdata
-    m_svgDoc.save(m_outdata, "\t", output_flags);
+    // serialize the svg with the xml declaration if needed
+    SvgBuffer buffer;
+    if (xml_declaration) {
+        buffer.m_data = "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>";
+    }
+    svg.Write(buffer, NULL, xml_declaration);
+    buffer.m_data.push_back('\n');
+    m_outdata.swap(buffer.m_data);
+    m_markers.clear();
 
     m_committed = true;
 }
@@ -160,28 +351,22 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
     }
 
     if (object->HasAttClass(ATT_TYPED)) {
-        AttTyped *att = dynamic_cast<AttTyped *>(object);
+        AttTyped *att = vrv_cross_cast<AttTyped *>(object);
         assert(att);
         if (att->HasType()) {
             baseClass.append(" " + att->GetType());
         }
     }
 
-    if (prepend) {
-        m_currentNode = m_currentNode.prepend_child("g");
-    }
-    else {
-        m_currentNode = m_currentNode.append_child("g");
-    }
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = baseClass.c_str();
+    SvgElement *element = this->StartElement("g", (prepend) ? SvgElement::PREPEND : SvgElement::APPEND);
+    element->AddAttribute("class", baseClass);
     if (gId.length() > 0) {
-        m_currentNode.append_attribute("id") = gId.c_str();
+        element->AddAttribute("id", gId);
     }
 
     // this sets staffDef styles for lyrics
     if (object->Is(STAFF)) {
-        Staff *staff = dynamic_cast<Staff *>(object);
+        Staff *staff = vrv_cast<Staff *>(object);
         assert(staff);
 
         assert(staff->m_drawingStaffDef);
@@ -201,64 +386,63 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
             styleStr.append(
                 "font-weight:" + staff->AttTyped::FontweightToStr(staff->m_drawingStaffDef->GetLyricWeight()) + ";");
         }
-        if (!styleStr.empty()) m_currentNode.append_attribute("style") = styleStr.c_str();
+        if (!styleStr.empty()) element->AddAttribute("style", styleStr);
     }
 
     if (object->HasAttClass(ATT_COLOR)) {
-        AttColor *att = dynamic_cast<AttColor *>(object);
+        AttColor *att = vrv_cross_cast<AttColor *>(object);
         assert(att);
         if (att->HasColor()) {
             if (object->IsControlElement()) {
-                m_currentNode.append_attribute("color") = att->GetColor().c_str();
+                element->AddAttribute("color", att->GetColor());
             }
-            m_currentNode.append_attribute("fill") = att->GetColor().c_str();
+            element->AddAttribute("fill", att->GetColor());
         }
     }
 
     if (object->HasAttClass(ATT_LABELLED)) {
-        AttLabelled *att = dynamic_cast<AttLabelled *>(object);
+        AttLabelled *att = vrv_cross_cast<AttLabelled *>(object);
         assert(att);
         if (att->HasLabel()) {
-            pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
-            svgTitle.append_attribute("class") = "labelAttr";
-            svgTitle.append_child(pugi::node_pcdata).set_value(att->GetLabel().c_str());
+            SvgElement *svgTitle = this->StartElement("title", SvgElement::PREPEND);
+            svgTitle->AddAttribute("class", "labelAttr");
+            svgTitle->SetText(att->GetLabel());
+            this->EndElement();
         }
     }
 
     if (object->HasAttClass(ATT_LANG)) {
-        AttLang *att = dynamic_cast<AttLang *>(object);
+        AttLang *att = vrv_cross_cast<AttLang *>(object);
         assert(att);
         if (att->HasLang()) {
-            m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
+            element->AddAttribute("xml:lang", att->GetLang());
         }
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
-        AttTypography *att = dynamic_cast<AttTypography *>(object);
+        AttTypography *att = vrv_cross_cast<AttTypography *>(object);
         assert(att);
-        if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
+        if (att->HasFontname()) element->AddAttribute("font-family", att->GetFontname());
         if (att->HasFontstyle())
-            m_currentNode.append_attribute("font-style")
-                = att->AttConverter::FontstyleToStr(att->GetFontstyle()).c_str();
+            element->AddAttribute("font-style", att->AttConverter::FontstyleToStr(att->GetFontstyle()));
         if (att->HasFontweight())
-            m_currentNode.append_attribute("font-weight")
-                = att->AttConverter::FontweightToStr(att->GetFontweight()).c_str();
+            element->AddAttribute("font-weight", att->AttConverter::FontweightToStr(att->GetFontweight()));
     }
 
     if (object->HasAttClass(ATT_VISIBILITY)) {
-        AttVisibility *att = dynamic_cast<AttVisibility *>(object);
+        AttVisibility *att = vrv_cross_cast<AttVisibility *>(object);
         assert(att);
         if (att->HasVisible()) {
             if (att->GetVisible() == BOOLEAN_true) {
-                m_currentNode.append_attribute("visibility") = "visible";
+                element->AddAttribute("visibility", "visible");
             }
             else if (att->GetVisible() == BOOLEAN_false) {
-                m_currentNode.append_attribute("visibility") = "hidden";
+                element->AddAttribute("visibility", "hidden");
             }
         }
     }
 
-    // m_currentNode.append_attribute("style") = StringFormat("stroke: #%s; stroke-opacity: %f; fill: #%s; fill-opacity:
+    // element->AddAttribute("style", StringFormat("stroke: #%s; stroke-opacity: %f; fill: #%s; fill-opacity:
     // %f;",
     // GetColour(currentPen.GetColour()).c_str(), currentPen.GetOpacity(), GetColour(currentBrush.GetColour()).c_str(),
     // currentBrush.GetOpacity()).c_str();
@@ -270,11 +454,10 @@ void SvgDeviceContext::StartCustomGraphic(std::string name, std::string gClass,
         name.append(" " + gClass);
     }
 
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = name.c_str();
+    SvgElement *element = this->StartElement("g");
+    element->AddAttribute("class", name);
     if (gId.length() > 0) {
-        m_currentNode.append_attribute("id") = gId.c_str();
+        element->AddAttribute("id", gId);
     }
 }
 
@@ -286,100 +469,104 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
         baseClass.append(" " + gClass);
     }
 
-    m_currentNode = AppendChild("tspan");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = baseClass.c_str();
-    m_currentNode.append_attribute("id") = gId.c_str();
+    SvgElement *element = this->StartElement("tspan", SvgElement::APPEND_SHAPE);
+    element->AddAttribute("class", baseClass);
+    element->AddAttribute("id", gId);
 
     if (object->HasAttClass(ATT_COLOR)) {
-        AttColor *att = dynamic_cast<AttColor *>(object);
+        AttColor *att = vrv_cross_cast<AttColor *>(object);
         assert(att);
-        if (att->HasColor()) m_currentNode.append_attribute("fill") = att->GetColor().c_str();
+        if (att->HasColor()) element->AddAttribute("fill", att->GetColor());
     }
 
     if (object->HasAttClass(ATT_LABELLED)) {
-        AttLabelled *att = dynamic_cast<AttLabelled *>(object);
+        AttLabelled *att = vrv_cross_cast<AttLabelled *>(object);
         assert(att);
         if (att->HasLabel()) {
-            pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
-            svgTitle.append_attribute("class") = "labelAttr";
-            svgTitle.append_child(pugi::node_pcdata).set_value(att->GetLabel().c_str());
+            SvgElement *svgTitle = this->StartElement("title", SvgElement::PREPEND);
+            svgTitle->AddAttribute("class", "labelAttr");
+            svgTitle->SetText(att->GetLabel());
+            this->EndElement();
         }
     }
 
     if (object->HasAttClass(ATT_LANG)) {
-        AttLang *att = dynamic_cast<AttLang *>(object);
+        AttLang *att = vrv_cross_cast<AttLang *>(object);
         assert(att);
         if (att->HasLang()) {
-            m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
+            element->AddAttribute("xml:lang", att->GetLang());
         }
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
-        AttTypography *att = dynamic_cast<AttTypography *>(object);
+        AttTypography *att = vrv_cross_cast<AttTypography *>(object);
         assert(att);
-        if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
+        if (att->HasFontname()) element->AddAttribute("font-family", att->GetFontname());
         if (att->HasFontstyle())
-            m_currentNode.append_attribute("font-style")
-                = att->AttConverter::FontstyleToStr(att->GetFontstyle()).c_str();
+            element->AddAttribute("font-style", att->AttConverter::FontstyleToStr(att->GetFontstyle()));
         if (att->HasFontweight())
-            m_currentNode.append_attribute("font-weight")
-                = att->AttConverter::FontweightToStr(att->GetFontweight()).c_str();
+            element->AddAttribute("font-weight", att->AttConverter::FontweightToStr(att->GetFontweight()));
     }
 
     if (object->HasAttClass(ATT_WHITESPACE)) {
-        AttWhitespace *att = dynamic_cast<AttWhitespace *>(object);
+        AttWhitespace *att = vrv_cross_cast<AttWhitespace *>(object);
         assert(att);
         if (att->HasSpace()) {
-            m_currentNode.append_attribute("xml:space") = att->GetSpace().c_str();
-            ;
+            element->AddAttribute("xml:space", att->GetSpace());
         }
     }
 }
 
 void SvgDeviceContext::ResumeGraphic(Object *object, std::string gId)
 {
-    std::string xpath = "//g[@id=\"" + gId + "\"]";
-    pugi::xpath_node selection = m_currentNode.select_node(xpath.c_str());
-    if (selection) {
-        m_currentNode = selection.node();
+    SvgElement *current = this->GetCurrentElement();
+    m_elements.emplace_back("g");
+    SvgElement &element = m_elements.back();
+
+    // The element was already written - the content will be inserted in it when ended
+    // With an id drawn more than once, this is the first one in the document, as with the look up of the previous
+    // DOM-based version, since no marker is kept for an element written in one with the same id (see EndElement)
+    if (m_markers.count(gId)) {
+        element.m_resumed = &m_markers.at(gId);
+        element.m_depth = element.m_resumed->m_depth;
+        return;
     }
-    m_svgNodeStack.push_back(m_currentNode);
+
+    // Otherwise look for it in the elements not ended yet, or keep writing to the current one
+    SvgElement *open = this->GetOpenGraphic(gId);
+    element.m_target = (open) ? open : current;
 }
 
 void SvgDeviceContext::EndGraphic(Object *object, View *view)
 {
     DrawSvgBoundingBox(object, view);
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->EndElement();
 }
 
 void SvgDeviceContext::EndCustomGraphic()
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->EndElement();
 }
 
 void SvgDeviceContext::EndResumedGraphic(Object *object, View *view)
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->EndElement();
 }
 
 void SvgDeviceContext::EndTextGraphic(Object *object, View *view)
 {
     DrawSvgBoundingBox(object, view);
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->EndElement();
 }
 
 void SvgDeviceContext::RotateGraphic(Point const &orig, double angle)
 {
-    if (m_currentNode.attribute("transform")) {
+    SvgElement *element = this->GetCurrentElement();
+    if (element->GetAttribute("transform")) {
         return;
     }
 
-    m_currentNode.append_attribute("transform") = StringFormat("rotate(%f %d,%d)", angle, orig.x, orig.y).c_str();
+    element->AddAttribute("transform", StringFormat("rotate(%f %d,%d)", angle, orig.x, orig.y));
 }
 
 void SvgDeviceContext::StartPage()
@@ -389,49 +576,44 @@ void SvgDeviceContext::StartPage()
 
     // default styles
     if (this->UseGlobalStyling()) {
-        m_currentNode = m_currentNode.append_child("style");
-        m_currentNode.append_attribute("type") = "text/css";
-        m_currentNode.append_child(pugi::node_pcdata)
-            .set_value("g.page-margin{font-family:Times;} "
+        SvgElement *style = this->StartElement("style");
+        style->AddAttribute("type", "text/css");
+        style->SetText("g.page-margin{font-family:Times;} "
                        //"g.bounding-box{stroke:red; stroke-width:10} "
                        //"g.content-bounding-box{stroke:blue; stroke-width:10} "
                        "g.reh, g.tempo{font-weight:bold;} g.dir, g.dynam, "
                        "g.mNum{font-style:italic;} g.label{font-weight:normal;}");
-        m_currentNode = m_svgNodeStack.back();
+        this->EndElement();
     }
 
     // a graphic for definition scaling
-    m_currentNode = m_currentNode.append_child("svg");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = "definition-scale";
-    m_currentNode.append_attribute("color") = "black";
+    SvgElement *definitionScale = this->StartElement("svg");
+    definitionScale->AddAttribute("class", "definition-scale");
+    definitionScale->AddAttribute("color", "black");
     if (this->GetFacsimile()) {
-        m_currentNode.append_attribute("viewBox") = StringFormat("0 0 %d %d", GetWidth(), GetHeight()).c_str();
+        definitionScale->AddAttribute("viewBox", StringFormat("0 0 %d %d", GetWidth(), GetHeight()));
     }
     else {
-        m_currentNode.append_attribute("viewBox")
-            = StringFormat("0 0 %d %d", GetWidth() * DEFINITION_FACTOR, GetHeight() * DEFINITION_FACTOR).c_str();
+        definitionScale->AddAttribute(
+            "viewBox", StringFormat("0 0 %d %d", GetWidth() * DEFINITION_FACTOR, GetHeight() * DEFINITION_FACTOR));
     }
 
     // a graphic for the origin
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = "page-margin";
-    m_currentNode.append_attribute("transform")
-        = StringFormat("translate(%d, %d)", (int)((double)m_originX), (int)((double)m_originY)).c_str();
+    SvgElement *pageMargin = this->StartElement("g");
+    pageMargin->AddAttribute("class", "page-margin");
+    pageMargin->AddAttribute(
+        "transform", StringFormat("translate(%d, %d)", (int)((double)m_originX), (int)((double)m_originY)));
 
-    m_pageNode = m_currentNode;
+    m_pageElement = pageMargin;
 }
 
 void SvgDeviceContext::EndPage()
 {
+    m_pageElement = NULL;
     // end page-margin
-    m_svgNodeStack.pop_back();
+    this->EndElement();
     // end definition-scale
-    m_svgNodeStack.pop_back();
-    // end page-scale
-    // m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->EndElement();
 }
 
 void SvgDeviceContext::SetBackground(int colour, int style)
@@ -467,52 +649,198 @@ Point SvgDeviceContext::GetLogicalOrigin()
     return Point(m_originX, m_originY);
 }
 
-pugi::xml_node SvgDeviceContext::AppendChild(std::string name)
+SvgElement *SvgDeviceContext::GetCurrentElement()
 {
-    pugi::xml_node g = m_currentNode.child("g");
-    if (g)
-        return m_currentNode.insert_child_before(name.c_str(), g);
-    else
-        return m_currentNode.append_child(name.c_str());
+    assert(!m_elements.empty());
+    SvgElement *element = &m_elements.back();
+    return (element->m_target) ? element->m_target : element;
+}
+
+SvgElement *SvgDeviceContext::GetOpenGraphic(const std::string &gId)
+{
+    for (auto &open : m_elements) {
+        if (open.m_target || open.m_resumed || (open.m_name != "g")) continue;
+        const std::string *id = open.GetAttribute("id");
+        if (id && (*id == gId)) return &open;
+    }
+    return NULL;
+}
+
+SvgElement *SvgDeviceContext::StartElement(const std::string &name, SvgElement::Position position)
+{
+    int depth = this->GetCurrentElement()->m_depth + 1;
+    m_elements.emplace_back(name, position);
+    m_elements.back().m_depth = depth;
+    return &m_elements.back();
+}
+
+void SvgDeviceContext::EndElement()
+{
+    // Never end the <svg> root
+    if (m_elements.size() < 2) return;
+
+    SvgElement *element = &m_elements.back();
+
+    // A resumed element not ended yet or not found - the content was written to the target
+    if (element->m_target) {
+        m_elements.pop_back();
+        return;
+    }
+
+    // A resumed element already written - insert the new content in it
+    if (element->m_resumed) {
+        SvgMarker *marker = element->m_resumed;
+        SvgBuffer *buffer = marker->m_buffer;
+        assert(buffer);
+        if (element->m_shapes.IsEmpty() && element->m_groups.IsEmpty()) {
+            m_elements.pop_back();
+            return;
+        }
+        if (marker->m_isEmpty) {
+            // replace the " />" with the content and the end tag
+            SvgBuffer content;
+            content.m_data.push_back('>');
+            content.Append(element->m_shapes);
+            size_t shapesEnd = content.GetSize();
+            content.Append(element->m_groups);
+            size_t end = content.GetSize();
+            content.m_data.push_back('\n');
+            SvgElement::WriteIndent(content.m_data, marker->m_depth);
+            content.m_data.append("</g>");
+            size_t pos = marker->m_end;
+            buffer->Insert(pos, content, 3);
+            marker->m_shapesEnd = pos + shapesEnd;
+            marker->m_end = pos + end;
+            marker->m_isEmpty = false;
+        }
+        else {
+            size_t shapesSize = element->m_shapes.GetSize();
+            size_t groupsSize = element->m_groups.GetSize();
+            size_t shapesEnd = marker->m_shapesEnd;
+            size_t end = marker->m_end;
+            buffer->Insert(end, element->m_groups);
+            buffer->Insert(shapesEnd, element->m_shapes);
+            marker->m_shapesEnd = shapesEnd + shapesSize;
+            marker->m_end = end + shapesSize + groupsSize;
+        }
+        m_elements.pop_back();
+        return;
+    }
+
+    // Keep a marker for the <g> with an id since they can be resumed
+    // Not if it is in a <g> with the same id not ended yet, which comes first in the document
+    SvgMarker *marker = NULL;
+    const std::string *id = element->GetAttribute("id");
+    if ((element->m_name == "g") && id && (m_markers.count(*id) == 0) && (this->GetOpenGraphic(*id) == element)) {
+        marker = &m_markers[*id];
+    }
+
+    SvgBuffer buffer;
+    element->Write(buffer, marker);
+    std::string name = element->m_name;
+    SvgElement::Position position = element->m_position;
+    m_elements.pop_back();
+
+    this->AddToElement(this->GetCurrentElement(), buffer, name, position);
+}
+
+void SvgDeviceContext::AppendChild(SvgElement &element)
+{
+    SvgElement *current = this->GetCurrentElement();
+    element.m_depth = current->m_depth + 1;
+
+    SvgBuffer buffer;
+    element.Write(buffer, NULL);
+    this->AddToElement(current, buffer, element.m_name, SvgElement::APPEND_SHAPE);
+}
+
+void SvgDeviceContext::AppendCopy(pugi::xml_node node, SvgElement::Position position)
+{
+    SvgElement *current = this->GetCurrentElement();
+
+    std::ostringstream stream;
+    node.print(stream, "\t", pugi::format_default, pugi::encoding_auto, current->m_depth + 1);
+    SvgBuffer buffer;
+    buffer.m_data = stream.str();
+    // pugixml writes the indentation before and the new line after the element
+    if ((node.type() == pugi::node_element) && !buffer.IsEmpty() && (buffer.m_data.back() == '\n')) {
+        buffer.m_data.pop_back();
+        buffer.m_data.insert(buffer.m_data.begin(), '\n');
+    }
+    this->AddToElement(current, buffer, node.name(), position);
+}
+
+void SvgDeviceContext::AddToElement(
+    SvgElement *element, SvgBuffer &buffer, const std::string &name, SvgElement::Position position)
+{
+    assert(element);
+
+    if (position == SvgElement::APPEND_SHAPE) {
+        // shapes are written before the first <g> child
+        element->m_shapes.Append(buffer);
+    }
+    else if (position == SvgElement::PREPEND) {
+        if (name == "g") {
+            // the <g> becomes the first one, so the shapes are now after it
+            element->m_groups.Insert(0, element->m_shapes);
+            element->m_groups.Insert(0, buffer);
+        }
+        else {
+            element->m_shapes.Insert(0, buffer);
+        }
+    }
+    else {
+        bool hasGroups = !element->m_groups.IsEmpty();
+        if (element->m_resumed) hasGroups = hasGroups || element->m_resumed->HasGroups();
+        if ((name == "g") || hasGroups) {
+            element->m_groups.Append(buffer);
+        }
+        else {
+            element->m_shapes.Append(buffer);
+        }
+    }
 }
 
 // Drawing methods
 void SvgDeviceContext::DrawSimpleBezierPath(Point bezier[4])
 {
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d,%d C%d,%d %d,%d %d,%d", // Base string
+    SvgElement pathChild("path");
+    pathChild.AddAttribute("d", StringFormat("M%d,%d C%d,%d %d,%d %d,%d", // Base string
         bezier[0].x, bezier[0].y, // M Command
         bezier[1].x, bezier[1].y, bezier[2].x, bezier[2].y, bezier[3].x, bezier[3].y // Remaining bezier points.
-        )
-                                          .c_str();
-    pathChild.append_attribute("fill") = "none";
-    pathChild.append_attribute("stroke") = GetColour(m_penStack.top().GetColour()).c_str();
-    pathChild.append_attribute("stroke-linecap") = "round";
-    pathChild.append_attribute("stroke-linejoin") = "round";
-    pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
+        ));
+    pathChild.AddAttribute("fill", "none");
+    pathChild.AddAttribute("stroke", GetColour(m_penStack.top().GetColour()));
+    pathChild.AddAttribute("stroke-linecap", "round");
+    pathChild.AddAttribute("stroke-linejoin", "round");
+    pathChild.AddAttribute("stroke-width", m_penStack.top().GetWidth());
     if (m_penStack.top().GetDashLength() > 0) {
         // Since we have stroke-linecap=round, change the dash length to be the percieved length.
         int dashOn = std::max(m_penStack.top().GetDashLength() - m_penStack.top().GetWidth(), 0);
         int dashOff = m_penStack.top().GetDashLength() + m_penStack.top().GetWidth();
-        pathChild.append_attribute("stroke-dasharray") = StringFormat("%d, %d", dashOn, dashOff).c_str();
+        pathChild.AddAttribute("stroke-dasharray", StringFormat("%d, %d", dashOn, dashOff));
     }
+
+    this->AppendChild(pathChild);
 }
+
 void SvgDeviceContext::DrawComplexBezierPath(Point bezier1[4], Point bezier2[4])
 {
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d")
-        = StringFormat("M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d", bezier1[0].x, bezier1[0].y, // M command
+    SvgElement pathChild("path");
+    pathChild.AddAttribute("d",
+        StringFormat("M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d", bezier1[0].x, bezier1[0].y, // M command
             bezier1[1].x, bezier1[1].y, bezier1[2].x, bezier1[2].y, bezier1[3].x, bezier1[3].y, // First bezier
             bezier2[2].x, bezier2[2].y, bezier2[1].x, bezier2[1].y, bezier2[0].x, bezier2[0].y // Second Bezier
-            )
-              .c_str();
-    // pathChild.append_attribute("fill") = "currentColor";
-    // pathChild.append_attribute("fill-opacity") = "1";
-    pathChild.append_attribute("stroke") = GetColour(m_penStack.top().GetColour()).c_str();
-    pathChild.append_attribute("stroke-linecap") = "round";
-    pathChild.append_attribute("stroke-linejoin") = "round";
-    // pathChild.append_attribute("stroke-opacity") = "1";
-    pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
+            ));
+    // pathChild.AddAttribute("fill", "currentColor");
+    // pathChild.AddAttribute("fill-opacity", "1");
+    pathChild.AddAttribute("stroke", GetColour(m_penStack.top().GetColour()));
+    pathChild.AddAttribute("stroke-linecap", "round");
+    pathChild.AddAttribute("stroke-linejoin", "round");
+    // pathChild.AddAttribute("stroke-opacity", "1");
+    pathChild.AddAttribute("stroke-width", m_penStack.top().GetWidth());
+
+    this->AppendChild(pathChild);
 }
 
 void SvgDeviceContext::DrawCircle(int x, int y, int radius)
@@ -531,17 +859,19 @@ void SvgDeviceContext::DrawEllipse(int x, int y, int width, int height)
     int rh = height / 2;
     int rw = width / 2;
 
-    pugi::xml_node ellipseChild = AppendChild("ellipse");
-    ellipseChild.append_attribute("cx") = x + rw;
-    ellipseChild.append_attribute("cy") = y + rh;
-    ellipseChild.append_attribute("rx") = rw;
-    ellipseChild.append_attribute("ry") = rh;
-    if (currentBrush.GetOpacity() != 1.0) ellipseChild.append_attribute("fill-opacity") = currentBrush.GetOpacity();
-    if (currentPen.GetOpacity() != 1.0) ellipseChild.append_attribute("stroke-opacity") = currentPen.GetOpacity();
+    SvgElement ellipseChild("ellipse");
+    ellipseChild.AddAttribute("cx", x + rw);
+    ellipseChild.AddAttribute("cy", y + rh);
+    ellipseChild.AddAttribute("rx", rw);
+    ellipseChild.AddAttribute("ry", rh);
+    if (currentBrush.GetOpacity() != 1.0) ellipseChild.AddAttribute("fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) ellipseChild.AddAttribute("stroke-opacity", currentPen.GetOpacity());
     if (currentPen.GetWidth() > 0) {
-        ellipseChild.append_attribute("stroke-width") = currentPen.GetWidth();
-        ellipseChild.append_attribute("stroke") = GetColour(m_penStack.top().GetColour()).c_str();
+        ellipseChild.AddAttribute("stroke-width", currentPen.GetWidth());
+        ellipseChild.AddAttribute("stroke", GetColour(m_penStack.top().GetColour()));
     }
+
+    this->AppendChild(ellipseChild);
 }
 
 void SvgDeviceContext::DrawEllipticArc(int x, int y, int width, int height, double start, double end)
@@ -602,33 +932,35 @@ void SvgDeviceContext::DrawEllipticArc(int x, int y, int width, int height, doub
     else
         fSweep = 0;
 
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d") = StringFormat(
-        "M%d %d A%d %d 0.0 %d %d %d %d", int(xs), int(ys), abs(int(rx)), abs(int(ry)), fArc, fSweep, int(xe), int(ye))
-                                          .c_str();
-    // pathChild.append_attribute("fill") = "currentColor";
-    if (currentBrush.GetOpacity() != 1.0) pathChild.append_attribute("fill-opacity") = currentBrush.GetOpacity();
-    if (currentPen.GetOpacity() != 1.0) pathChild.append_attribute("stroke-opacity") = currentPen.GetOpacity();
+    SvgElement pathChild("path");
+    pathChild.AddAttribute("d", StringFormat(
+        "M%d %d A%d %d 0.0 %d %d %d %d", int(xs), int(ys), abs(int(rx)), abs(int(ry)), fArc, fSweep, int(xe), int(ye)));
+    // pathChild.AddAttribute("fill", "currentColor");
+    if (currentBrush.GetOpacity() != 1.0) pathChild.AddAttribute("fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) pathChild.AddAttribute("stroke-opacity", currentPen.GetOpacity());
     if (currentPen.GetWidth() > 0) {
-        pathChild.append_attribute("stroke-width") = currentPen.GetWidth();
-        pathChild.append_attribute("stroke") = GetColour(m_penStack.top().GetColour()).c_str();
+        pathChild.AddAttribute("stroke-width", currentPen.GetWidth());
+        pathChild.AddAttribute("stroke", GetColour(m_penStack.top().GetColour()));
     }
+
+    this->AppendChild(pathChild);
 }
 
 void SvgDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
 {
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d %d L%d %d", x1, y1, x2, y2).c_str();
-    pathChild.append_attribute("stroke") = GetColour(m_penStack.top().GetColour()).c_str();
+    SvgElement pathChild("path");
+    pathChild.AddAttribute("d", StringFormat("M%d %d L%d %d", x1, y1, x2, y2));
+    pathChild.AddAttribute("stroke", GetColour(m_penStack.top().GetColour()));
     if (m_penStack.top().GetLineCap() > 0) {
-        pathChild.append_attribute("stroke-linecap") = "round";
-        pathChild.append_attribute("stroke-dasharray")
-            = StringFormat("1, %d", int(2.5 * m_penStack.top().GetDashLength())).c_str();
+        pathChild.AddAttribute("stroke-linecap", "round");
+        pathChild.AddAttribute("stroke-dasharray", StringFormat("1, %d", int(2.5 * m_penStack.top().GetDashLength())));
     }
     else if (m_penStack.top().GetDashLength() > 0)
-        pathChild.append_attribute("stroke-dasharray")
-            = StringFormat("%d, %d", m_penStack.top().GetDashLength(), m_penStack.top().GetDashLength()).c_str();
-    if (m_penStack.top().GetWidth() > 1) pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
+        pathChild.AddAttribute("stroke-dasharray",
+            StringFormat("%d, %d", m_penStack.top().GetDashLength(), m_penStack.top().GetDashLength()));
+    if (m_penStack.top().GetWidth() > 1) pathChild.AddAttribute("stroke-width", m_penStack.top().GetWidth());
+
+    this->AppendChild(pathChild);
 }
 
 void SvgDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffset, int fill_style)
@@ -639,25 +971,27 @@ void SvgDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffs
     Pen currentPen = m_penStack.top();
     Brush currentBrush = m_brushStack.top();
 
-    pugi::xml_node polygonChild = AppendChild("polygon");
+    SvgElement polygonChild("polygon");
     // if (fillStyle == wxODDEVEN_RULE)
-    //    polygonChild.append_attribute("fill-rule") = "evenodd;";
+    //    polygonChild.AddAttribute("fill-rule", "evenodd;");
     // else
-    if (currentPen.GetWidth() > 0) polygonChild.append_attribute("stroke") = GetColour(currentPen.GetColour()).c_str();
+    if (currentPen.GetWidth() > 0) polygonChild.AddAttribute("stroke", GetColour(currentPen.GetColour()));
     if (currentPen.GetWidth() > 1)
-        polygonChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+        polygonChild.AddAttribute("stroke-width", StringFormat("%d", currentPen.GetWidth()));
     if (currentPen.GetOpacity() != 1.0)
-        polygonChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+        polygonChild.AddAttribute("stroke-opacity", StringFormat("%f", currentPen.GetOpacity()));
     if (currentBrush.GetColour() != AxNONE)
-        polygonChild.append_attribute("fill") = GetColour(currentBrush.GetColour()).c_str();
+        polygonChild.AddAttribute("fill", GetColour(currentBrush.GetColour()));
     if (currentBrush.GetOpacity() != 1.0)
-        polygonChild.append_attribute("fill-opacity") = StringFormat("%f", currentBrush.GetOpacity()).c_str();
+        polygonChild.AddAttribute("fill-opacity", StringFormat("%f", currentBrush.GetOpacity()));
 
     std::string pointsString;
     for (int i = 0; i < n; ++i) {
         pointsString += StringFormat("%d,%d ", points[i].x + xoffset, points[i].y + yoffset);
     }
-    polygonChild.append_attribute("points") = pointsString.c_str();
+    polygonChild.AddAttribute("points", pointsString);
+
+    this->AppendChild(polygonChild);
 }
 
 void SvgDeviceContext::DrawRectangle(int x, int y, int width, int height)
@@ -679,12 +1013,14 @@ void SvgDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height,
         x -= width;
     }
 
-    pugi::xml_node rectChild = AppendChild("rect");
-    rectChild.append_attribute("x") = x;
-    rectChild.append_attribute("y") = y;
-    rectChild.append_attribute("height") = height;
-    rectChild.append_attribute("width") = width;
-    if (radius != 0) rectChild.append_attribute("rx") = radius;
+    SvgElement rectChild("rect");
+    rectChild.AddAttribute("x", x);
+    rectChild.AddAttribute("y", y);
+    rectChild.AddAttribute("height", height);
+    rectChild.AddAttribute("width", width);
+    if (radius != 0) rectChild.AddAttribute("rx", radius);
+
+    this->AppendChild(rectChild);
 }
 
 void SvgDeviceContext::StartText(int x, int y, data_HORIZONTALALIGNMENT alignment)
@@ -699,45 +1035,45 @@ void SvgDeviceContext::StartText(int x, int y, data_HORIZONTALALIGNMENT alignmen
         anchor = "middle";
     }
 
-    m_currentNode = m_currentNode.append_child("text");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("x") = x;
-    m_currentNode.append_attribute("y") = y;
+    SvgElement *element = this->StartElement("text");
+    element->AddAttribute("x", x);
+    element->AddAttribute("y", y);
     // unless dx, dy have a value they don't need to be set
-    // m_currentNode.append_attribute("dx") = 0;
-    // m_currentNode.append_attribute("dy") = 0;
+    // element->AddAttribute("dx", 0);
+    // element->AddAttribute("dy", 0);
     if (!anchor.empty()) {
-        m_currentNode.append_attribute("text-anchor") = anchor.c_str();
+        element->AddAttribute("text-anchor", anchor);
     }
     // font-size seems to be required in <text> in FireFox and also we set it to 0px so space
     // is not added between tspan elements
-    m_currentNode.append_attribute("font-size") = "0px";
+    element->AddAttribute("font-size", "0px");
     //
     if (!m_fontStack.top()->GetFaceName().empty()) {
-        m_currentNode.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
+        element->AddAttribute("font-family", m_fontStack.top()->GetFaceName());
     }
     if (m_fontStack.top()->GetStyle() != FONTSTYLE_NONE) {
         if (m_fontStack.top()->GetStyle() == FONTSTYLE_italic) {
-            m_currentNode.append_attribute("font-style") = "italic";
+            element->AddAttribute("font-style", "italic");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_normal) {
-            m_currentNode.append_attribute("font-style") = "normal";
+            element->AddAttribute("font-style", "normal");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_oblique) {
-            m_currentNode.append_attribute("font-style") = "oblique";
+            element->AddAttribute("font-style", "oblique");
         }
     }
     if (m_fontStack.top()->GetWeight() != FONTWEIGHT_NONE) {
         if (m_fontStack.top()->GetWeight() == FONTWEIGHT_bold) {
-            m_currentNode.append_attribute("font-weight") = "bold";
+            element->AddAttribute("font-weight", "bold");
         }
     }
 }
 
 void SvgDeviceContext::MoveTextTo(int x, int y, data_HORIZONTALALIGNMENT alignment)
 {
-    m_currentNode.append_attribute("x") = x;
-    m_currentNode.append_attribute("y") = y;
+    SvgElement *element = this->GetCurrentElement();
+    element->AddAttribute("x", x);
+    element->AddAttribute("y", y);
     if (alignment != HORIZONTALALIGNMENT_NONE) {
         std::string anchor = "start";
         if (alignment == HORIZONTALALIGNMENT_right) {
@@ -746,19 +1082,18 @@ void SvgDeviceContext::MoveTextTo(int x, int y, data_HORIZONTALALIGNMENT alignme
         if (alignment == HORIZONTALALIGNMENT_center) {
             anchor = "middle";
         }
-        m_currentNode.append_attribute("text-anchor") = anchor.c_str();
+        element->AddAttribute("text-anchor", anchor);
     }
 }
 
 void SvgDeviceContext::MoveTextVerticallyTo(int y)
 {
-    m_currentNode.append_attribute("y") = y;
+    this->GetCurrentElement()->AddAttribute("y", y);
 }
 
 void SvgDeviceContext::EndText()
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->EndElement();
 }
 
 void SvgDeviceContext::DrawText(const std::string &text, const std::wstring wtext, int x, int y)
@@ -775,40 +1110,45 @@ void SvgDeviceContext::DrawText(const std::string &text, const std::wstring wtex
         svgText.replace(svgText.size() - 1, 1, "\xC2\xA0");
     }
 
-    std::string currentFaceName
-        = (m_currentNode.attribute("font-family")) ? m_currentNode.attribute("font-family").value() : "";
+    // the font-family of a resumed element is kept by its marker
+    SvgElement *current = this->GetCurrentElement();
+    const std::string *currentFontFamily = current->GetAttribute("font-family");
+    if (current->m_resumed) currentFontFamily = &current->m_resumed->m_fontFamily;
+    std::string currentFaceName = (currentFontFamily) ? *currentFontFamily : "";
     std::string fontFaceName = m_fontStack.top()->GetFaceName();
 
-    pugi::xml_node textChild = AppendChild("tspan");
+    SvgElement textChild("tspan");
     // We still add @xml::space (No: this seems to create problems with Safari)
-    // textChild.append_attribute("xml:space") = "preserve";
+    // textChild.AddAttribute("xml:space", "preserve");
     // Set the @font-family only if it is not the same as in the parent node
     if (!fontFaceName.empty() && (fontFaceName != currentFaceName)) {
-        textChild.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
+        textChild.AddAttribute("font-family", m_fontStack.top()->GetFaceName());
         // Special case where we want to specifiy if the VerovioText font (woff) needs to be included in the output
         if (fontFaceName == "VerovioText") this->VrvTextFont();
     }
     if (m_fontStack.top()->GetPointSize() != 0) {
-        textChild.append_attribute("font-size") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        textChild.AddAttribute("font-size", StringFormat("%dpx", m_fontStack.top()->GetPointSize()));
     }
     if (m_fontStack.top()->GetStyle() != FONTSIZE_NONE) {
         if (m_fontStack.top()->GetStyle() == FONTSTYLE_italic) {
-            textChild.append_attribute("font-style") = "italic";
+            textChild.AddAttribute("font-style", "italic");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_normal) {
-            textChild.append_attribute("font-style") = "normal";
+            textChild.AddAttribute("font-style", "normal");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_oblique) {
-            textChild.append_attribute("font-style") = "oblique";
+            textChild.AddAttribute("font-style", "oblique");
         }
     }
-    textChild.append_attribute("class") = "text";
-    textChild.append_child(pugi::node_pcdata).set_value(svgText.c_str());
+    textChild.AddAttribute("class", "text");
+    textChild.SetText(svgText);
 
     if ((x != VRV_UNSET) && (y != VRV_UNSET)) {
-        textChild.append_attribute("x") = StringFormat("%d", x).c_str();
-        textChild.append_attribute("y") = StringFormat("%d", y).c_str();
+        textChild.AddAttribute("x", StringFormat("%d", x));
+        textChild.AddAttribute("y", StringFormat("%d", y));
     }
+
+    this->AppendChild(textChild);
 }
 
 void SvgDeviceContext::DrawRotatedText(const std::string &text, int x, int y, double angle)
@@ -825,27 +1165,26 @@ void SvgDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, boo
     // print chars one by one
     for (unsigned int i = 0; i < text.length(); ++i) {
         wchar_t c = text.at(i);
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = m_resources->GetGlyph(c);
         if (!glyph) {
             continue;
         }
 
-        std::string path = glyph->GetPath();
-
         // Add the glyph to the array for the <defs>
-        std::vector<std::string>::const_iterator it = std::find(m_smuflGlyphs.begin(), m_smuflGlyphs.end(), path);
+        std::vector<const Glyph *>::const_iterator it = std::find(m_smuflGlyphs.begin(), m_smuflGlyphs.end(), glyph);
         if (it == m_smuflGlyphs.end()) {
-            m_smuflGlyphs.push_back(path);
+            m_smuflGlyphs.push_back(glyph);
         }
 
         // Write the char in the SVG
-        pugi::xml_node useChild = AppendChild("use");
-        useChild.append_attribute("xlink:href") = StringFormat("#%s", glyph->GetCodeStr().c_str()).c_str();
-        useChild.append_attribute("href") = StringFormat("#%s", glyph->GetCodeStr().c_str()).c_str();
-        useChild.append_attribute("x") = x;
-        useChild.append_attribute("y") = y;
-        useChild.append_attribute("height") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
-        useChild.append_attribute("width") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        SvgElement useChild("use");
+        useChild.AddAttribute("xlink:href", StringFormat("#%s", glyph->GetCodeStr().c_str()));
+        useChild.AddAttribute("href", StringFormat("#%s", glyph->GetCodeStr().c_str()));
+        useChild.AddAttribute("x", x);
+        useChild.AddAttribute("y", y);
+        useChild.AddAttribute("height", StringFormat("%dpx", m_fontStack.top()->GetPointSize()));
+        useChild.AddAttribute("width", StringFormat("%dpx", m_fontStack.top()->GetPointSize()));
+        this->AppendChild(useChild);
 
         // Get the bounds of the char
         if (glyph->GetHorizAdvX() > 0)
@@ -861,11 +1200,11 @@ void SvgDeviceContext::DrawSpline(int n, Point points[]) {}
 
 void SvgDeviceContext::DrawSvgShape(int x, int y, int width, int height, pugi::xml_node svg)
 {
-    m_currentNode.append_attribute("transform")
-        = StringFormat("translate(%d, %d) scale(%d, %d)", x, y, DEFINITION_FACTOR, DEFINITION_FACTOR).c_str();
+    this->GetCurrentElement()->AddAttribute(
+        "transform", StringFormat("translate(%d, %d) scale(%d, %d)", x, y, DEFINITION_FACTOR, DEFINITION_FACTOR));
 
     for (pugi::xml_node child : svg.children()) {
-        m_currentNode.append_copy(child);
+        this->AppendCopy(child);
     }
 }
 
@@ -873,8 +1212,9 @@ void SvgDeviceContext::DrawBackgroundImage(int x, int y) {}
 
 void SvgDeviceContext::AddDescription(const std::string &text)
 {
-    pugi::xml_node desc = m_currentNode.append_child("desc");
-    desc.append_child(pugi::node_pcdata).set_value(text.c_str());
+    SvgElement *desc = this->StartElement("desc");
+    desc->SetText(text);
+    this->EndElement();
 }
 
 std::string SvgDeviceContext::GetColour(int colour)
@@ -906,7 +1246,7 @@ std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
 {
     if (!m_committed) Commit(xml_declaration);
 
-    return m_outdata.str();
+    return m_outdata;
 }
 
 void SvgDeviceContext::DrawSvgBoundingBoxRectangle(int x, int y, int width, int height)
@@ -923,13 +1263,15 @@ void SvgDeviceContext::DrawSvgBoundingBoxRectangle(int x, int y, int width, int
         x -= width;
     }
 
-    pugi::xml_node rectChild = AppendChild("rect");
-    rectChild.append_attribute("x") = x;
-    rectChild.append_attribute("y") = y;
-    rectChild.append_attribute("height") = height;
-    rectChild.append_attribute("width") = width;
+    SvgElement rectChild("rect");
+    rectChild.AddAttribute("x", x);
+    rectChild.AddAttribute("y", y);
+    rectChild.AddAttribute("height", height);
+    rectChild.AddAttribute("width", width);
+
+    rectChild.AddAttribute("fill", "transparent");
 
-    rectChild.append_attribute("fill") = "transparent";
+    this->AppendChild(rectChild);
 }
 
 void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
@@ -942,7 +1284,7 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
         BoundingBox *box = object;
         // For floating elements, get the current bounding box set by System::SetCurrentFloatingPositioner
         if (object->IsFloatingObject()) {
-            FloatingObject *floatingObject = dynamic_cast<FloatingObject *>(object);
+            FloatingObject *floatingObject = vrv_cast<FloatingObject *>(object);
             assert(floatingObject);
             box = floatingObject->GetCurrentFloatingPositioner();
             // No bounding box found, ignore the object - this happens when the @staff is missing because the element is
@@ -950,9 +1292,10 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
             if (!box) return;
         }
 
-        pugi::xml_node currentNode = m_currentNode;
-        if (groupInPage) {
-            m_currentNode = m_pageNode;
+        // write to the page-margin element instead of the current one
+        if (groupInPage && m_pageElement) {
+            m_elements.emplace_back("g");
+            m_elements.back().m_target = m_pageElement;
         }
 
         StartGraphic(object, "bounding-box", "bbox-" + object->GetUuid(), true);
@@ -972,7 +1315,7 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
 
             for (iter = anchors.begin(); iter != anchors.end(); ++iter) {
                 if (object->GetBoundingBoxGlyph() != 0) {
-                    Glyph *glyph = Resources::GetGlyph(object->GetBoundingBoxGlyph());
+                    const Glyph *glyph = m_resources->GetGlyph(object->GetBoundingBoxGlyph());
                     assert(glyph);
 
                     if (glyph->HasAnchor(*iter)) {
@@ -1000,10 +1343,6 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
 
         EndGraphic(object, NULL);
 
-        if (groupInPage) {
-            m_currentNode = m_pageNode;
-        }
-
         if (drawContentBB) {
             if (object->HasContentBB()) {
                 StartGraphic(object, "content-bounding-box", "cbbox-" + object->GetUuid(), true);
@@ -1020,8 +1359,8 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
             }
         }
 
-        if (groupInPage) {
-            m_currentNode = currentNode;
+        if (groupInPage && m_pageElement) {
+            this->EndElement();
         }
     }
 }
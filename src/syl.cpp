@@ -115,10 +115,10 @@ int Syl::CalcConnectorSpacing(Doc *doc, int staffSize)
 
 int Syl::PrepareLyrics(FunctorParams *functorParams)
 {
-    PrepareLyricsParams *params = dynamic_cast<PrepareLyricsParams *>(functorParams);
+    PrepareLyricsParams *params = vrv_cast<PrepareLyricsParams *>(functorParams);
     assert(params);
 
-    Verse *verse = dynamic_cast<Verse *>(this->GetFirstAncestor(VERSE, MAX_NOTE_DEPTH));
+    Verse *verse = vrv_cast<Verse *>(this->GetFirstAncestor(VERSE, MAX_NOTE_DEPTH));
     if (verse) {
         m_drawingVerse = std::max(verse->GetN(), 1);
     }
@@ -79,6 +79,7 @@ void System::Reset()
     m_drawingLabelsWidth = 0;
     m_drawingAbbrLabelsWidth = 0;
     m_drawingIsOptimized = false;
+    m_castOffHeight = VRV_UNSET;
 }
 
 void System::AddChild(Object *child)
@@ -188,17 +189,17 @@ bool System::HasMixedDrawingStemDir(LayerElement *start, LayerElement *end)
     ArrayOfObjects::iterator childrenIter;
     this->FindAllDescendantBetween(&children, &matchType, start, end);
 
-    Layer *layerStart = dynamic_cast<Layer *>(start->GetFirstAncestor(LAYER));
+    Layer *layerStart = vrv_cast<Layer *>(start->GetFirstAncestor(LAYER));
     assert(layerStart);
-    Staff *staffStart = dynamic_cast<Staff *>(layerStart->GetFirstAncestor(STAFF));
+    Staff *staffStart = vrv_cast<Staff *>(layerStart->GetFirstAncestor(STAFF));
     assert(staffStart);
 
     data_STEMDIRECTION stemDir = STEMDIRECTION_NONE;
 
     for (childrenIter = children.begin(); childrenIter != children.end(); ++childrenIter) {
-        Layer *layer = dynamic_cast<Layer *>((*childrenIter)->GetFirstAncestor(LAYER));
+        Layer *layer = vrv_cast<Layer *>((*childrenIter)->GetFirstAncestor(LAYER));
         assert(layer);
-        Staff *staff = dynamic_cast<Staff *>((*childrenIter)->GetFirstAncestor(STAFF));
+        Staff *staff = vrv_cast<Staff *>((*childrenIter)->GetFirstAncestor(STAFF));
         assert(staff);
 
         // If the slur is spanning over several measure, the the children list will include note and chords
@@ -209,7 +210,7 @@ bool System::HasMixedDrawingStemDir(LayerElement *start, LayerElement *end)
             continue;
         }
 
-        StemmedDrawingInterface *interface = dynamic_cast<StemmedDrawingInterface *>(*childrenIter);
+        StemmedDrawingInterface *interface = vrv_cross_cast<StemmedDrawingInterface *>(*childrenIter);
         assert(interface);
 
         // First pass
@@ -234,21 +235,21 @@ void System::AddToDrawingListIfNeccessary(Object *object)
         this->AddToDrawingList(object);
     }
     else if (object->Is(DIR)) {
-        Dir *dir = dynamic_cast<Dir *>(object);
+        Dir *dir = vrv_cast<Dir *>(object);
         assert(dir);
         if (dir->GetEnd() || (dir->GetNextLink() && (dir->GetExtender() == BOOLEAN_true))) {
             this->AddToDrawingList(dir);
         }
     }
     else if (object->Is(DYNAM)) {
-        Dynam *dynam = dynamic_cast<Dynam *>(object);
+        Dynam *dynam = vrv_cast<Dynam *>(object);
         assert(dynam);
         if (dynam->GetEnd() || (dynam->GetNextLink() && (dynam->GetExtender() == BOOLEAN_true))) {
             this->AddToDrawingList(dynam);
         }
     }
     else if (object->Is(TRILL)) {
-        Trill *trill = dynamic_cast<Trill *>(object);
+        Trill *trill = vrv_cast<Trill *>(object);
         assert(trill);
         if (trill->GetEnd()) {
             this->AddToDrawingList(trill);
@@ -274,7 +275,7 @@ int System::UnsetCurrentScoreDef(FunctorParams *functorParams)
 
 int System::OptimizeScoreDef(FunctorParams *functorParams)
 {
-    OptimizeScoreDefParams *params = dynamic_cast<OptimizeScoreDefParams *>(functorParams);
+    OptimizeScoreDefParams *params = vrv_cast<OptimizeScoreDefParams *>(functorParams);
     assert(params);
 
     this->IsDrawingOptimized(true);
@@ -294,7 +295,7 @@ int System::OptimizeScoreDef(FunctorParams *functorParams)
 
 int System::OptimizeScoreDefEnd(FunctorParams *functorParams)
 {
-    OptimizeScoreDefParams *params = dynamic_cast<OptimizeScoreDefParams *>(functorParams);
+    OptimizeScoreDefParams *params = vrv_cast<OptimizeScoreDefParams *>(functorParams);
     assert(params);
 
     params->m_currentScoreDef->Process(params->m_functor, params, params->m_functorEnd);
@@ -322,7 +323,7 @@ int System::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int System::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     if (m_xAbs != VRV_UNSET) m_xAbs /= params->m_page->GetPPUFactor();
@@ -335,7 +336,7 @@ int System::ApplyPPUFactor(FunctorParams *functorParams)
 
 int System::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     // since we are starting a new system its first scoreDef will need to be a SYSTEM_SCOREDEF
@@ -346,7 +347,7 @@ int System::AlignHorizontally(FunctorParams *functorParams)
 
 int System::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_systemAligner = &m_systemAligner;
@@ -356,7 +357,7 @@ int System::AlignVertically(FunctorParams *functorParams)
 
 int System::AlignVerticallyEnd(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_cumulatedShift
@@ -370,7 +371,7 @@ int System::AlignVerticallyEnd(FunctorParams *functorParams)
 
 int System::AdjustXOverflow(FunctorParams *functorParams)
 {
-    AdjustXOverflowParams *params = dynamic_cast<AdjustXOverflowParams *>(functorParams);
+    AdjustXOverflowParams *params = vrv_cast<AdjustXOverflowParams *>(functorParams);
     assert(params);
 
     params->m_currentSystem = this;
@@ -382,7 +383,7 @@ int System::AdjustXOverflow(FunctorParams *functorParams)
 
 int System::AdjustXOverflowEnd(FunctorParams *functorParams)
 {
-    AdjustXOverflowParams *params = dynamic_cast<AdjustXOverflowParams *>(functorParams);
+    AdjustXOverflowParams *params = vrv_cast<AdjustXOverflowParams *>(functorParams);
     assert(params);
 
     // Continue if no measure of not widest element
@@ -402,7 +403,7 @@ int System::AdjustXOverflowEnd(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
     Alignment *left = objectX->GetAlignment();
-    Measure *objectXMeasure = dynamic_cast<Measure *>(objectX->GetFirstAncestor(MEASURE));
+    Measure *objectXMeasure = vrv_cast<Measure *>(objectX->GetFirstAncestor(MEASURE));
     if (objectXMeasure != params->m_lastMeasure) {
         left = params->m_lastMeasure->GetLeftBarLine()->GetAlignment();
     }
@@ -419,7 +420,7 @@ int System::AdjustXOverflowEnd(FunctorParams *functorParams)
 
 int System::AdjustHarmGrpsSpacing(FunctorParams *functorParams)
 {
-    AdjustHarmGrpsSpacingParams *params = dynamic_cast<AdjustHarmGrpsSpacingParams *>(functorParams);
+    AdjustHarmGrpsSpacingParams *params = vrv_cast<AdjustHarmGrpsSpacingParams *>(functorParams);
     assert(params);
 
     // reset it, but not the current grpId!
@@ -434,7 +435,7 @@ int System::AdjustHarmGrpsSpacing(FunctorParams *functorParams)
 
 int System::AdjustHarmGrpsSpacingEnd(FunctorParams *functorParams)
 {
-    AdjustHarmGrpsSpacingParams *params = dynamic_cast<AdjustHarmGrpsSpacingParams *>(functorParams);
+    AdjustHarmGrpsSpacingParams *params = vrv_cast<AdjustHarmGrpsSpacingParams *>(functorParams);
     assert(params);
 
     // End of the first pass - loop over for each group id
@@ -474,7 +475,7 @@ int System::AdjustHarmGrpsSpacingEnd(FunctorParams *functorParams)
 
 int System::AdjustSylSpacing(FunctorParams *functorParams)
 {
-    AdjustSylSpacingParams *params = dynamic_cast<AdjustSylSpacingParams *>(functorParams);
+    AdjustSylSpacingParams *params = vrv_cast<AdjustSylSpacingParams *>(functorParams);
     assert(params);
 
     // reset it
@@ -489,7 +490,7 @@ int System::AdjustSylSpacing(FunctorParams *functorParams)
 
 int System::AdjustSylSpacingEnd(FunctorParams *functorParams)
 {
-    AdjustSylSpacingParams *params = dynamic_cast<AdjustSylSpacingParams *>(functorParams);
+    AdjustSylSpacingParams *params = vrv_cast<AdjustSylSpacingParams *>(functorParams);
     assert(params);
 
     if (!params->m_previousMeasure) {
@@ -517,7 +518,7 @@ int System::AdjustSylSpacingEnd(FunctorParams *functorParams)
 
 int System::AdjustYPos(FunctorParams *functorParams)
 {
-    AdjustYPosParams *params = dynamic_cast<AdjustYPosParams *>(functorParams);
+    AdjustYPosParams *params = vrv_cast<AdjustYPosParams *>(functorParams);
     assert(params);
 
     // We need to call this explicitly because changing the YRel of the StaffAligner (below in the functor)
@@ -535,7 +536,7 @@ int System::AdjustYPos(FunctorParams *functorParams)
 
 int System::AlignMeasures(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     SetDrawingXRel(this->m_systemLeftMar + this->GetDrawingLabelsWidth());
@@ -547,7 +548,7 @@ int System::AlignMeasures(FunctorParams *functorParams)
 
 int System::AlignMeasuresEnd(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     m_drawingTotalWidth = params->m_shift + this->GetDrawingLabelsWidth();
@@ -558,7 +559,7 @@ int System::AlignMeasuresEnd(FunctorParams *functorParams)
 
 int System::AlignSystems(FunctorParams *functorParams)
 {
-    AlignSystemsParams *params = dynamic_cast<AlignSystemsParams *>(functorParams);
+    AlignSystemsParams *params = vrv_cast<AlignSystemsParams *>(functorParams);
     assert(params);
 
     SetDrawingYRel(params->m_shift);
@@ -575,7 +576,7 @@ int System::AlignSystems(FunctorParams *functorParams)
 
 int System::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     assert(GetParent());
@@ -613,7 +614,7 @@ int System::JustifyX(FunctorParams *functorParams)
 
 int System::JustifyY(FunctorParams *functorParams)
 {
-    JustifyYParams *params = dynamic_cast<JustifyYParams *>(functorParams);
+    JustifyYParams *params = vrv_cast<JustifyYParams *>(functorParams);
     assert(params);
 
     bool systemOnly = params->m_doc->GetOptions()->m_justifySystemsOnly.GetValue();
@@ -637,7 +638,7 @@ int System::JustifyY(FunctorParams *functorParams)
 
 int System::AdjustStaffOverlap(FunctorParams *functorParams)
 {
-    AdjustStaffOverlapParams *params = dynamic_cast<AdjustStaffOverlapParams *>(functorParams);
+    AdjustStaffOverlapParams *params = vrv_cast<AdjustStaffOverlapParams *>(functorParams);
     assert(params);
 
     params->m_previous = NULL;
@@ -648,11 +649,11 @@ int System::AdjustStaffOverlap(FunctorParams *functorParams)
 
 int System::AdjustFloatingPositioners(FunctorParams *functorParams)
 {
-    AdjustFloatingPositionersParams *params = dynamic_cast<AdjustFloatingPositionersParams *>(functorParams);
+    AdjustFloatingPositionersParams *params = vrv_cast<AdjustFloatingPositionersParams *>(functorParams);
     assert(params);
 
     AdjustFloatingPositionerGrpsParams adjustFloatingPositionerGrpsParams(params->m_doc);
-    Functor adjustFloatingPositionerGrps(&Object::AdjustFloatingPositionerGrps);
+    Functor adjustFloatingPositionerGrps(&Object::AdjustFloatingPositionerGrps, "AdjustFloatingPositionerGrps");
 
     params->m_classId = TIE;
     m_systemAligner.Process(params->m_functor, params);
@@ -750,7 +751,7 @@ int System::AdjustFloatingPositioners(FunctorParams *functorParams)
 
 int System::AdjustSlurs(FunctorParams *functorParams)
 {
-    AdjustSlursParams *params = dynamic_cast<AdjustSlursParams *>(functorParams);
+    AdjustSlursParams *params = vrv_cast<AdjustSlursParams *>(functorParams);
     assert(params);
 
     m_systemAligner.Process(params->m_functor, params);
@@ -760,7 +761,7 @@ int System::AdjustSlurs(FunctorParams *functorParams)
 
 int System::CastOffPages(FunctorParams *functorParams)
 {
-    CastOffPagesParams *params = dynamic_cast<CastOffPagesParams *>(functorParams);
+    CastOffPagesParams *params = vrv_cast<CastOffPagesParams *>(functorParams);
     assert(params);
 
     int currentShift = params->m_shift;
@@ -772,7 +773,11 @@ int System::CastOffPages(FunctorParams *functorParams)
         currentShift += params->m_pgHead2Height + params->m_pgFoot2Height;
     }
 
-    if ((params->m_currentPage->GetChildCount() > 0) && (this->m_drawingYRel - this->GetHeight() - currentShift < 0)) {
+    if (m_castOffHeight == VRV_UNSET) {
+        m_castOffHeight = this->GetHeight();
+    }
+
+    if ((params->m_currentPage->GetChildCount() > 0) && (this->m_drawingYRel - m_castOffHeight - currentShift < 0)) {
         params->m_currentPage = new Page();
         // Use VRV_UNSET value as a flag
         params->m_pgHeadHeight = VRV_UNSET;
@@ -785,7 +790,7 @@ int System::CastOffPages(FunctorParams *functorParams)
     // We want to move the system to the currentPage. However, we cannot use DetachChild
     // from the contentPage because this screws up the iterator. Relinquish gives up
     // the ownership of the system - the contentPage itself will be deleted afterwards.
-    System *system = dynamic_cast<System *>(params->m_contentPage->Relinquish(this->GetIdx()));
+    System *system = vrv_cast<System *>(params->m_contentPage->Relinquish(this->GetIdx()));
     assert(system);
     params->m_currentPage->AddChild(system);
 
@@ -794,7 +799,7 @@ int System::CastOffPages(FunctorParams *functorParams)
 
 int System::UnCastOff(FunctorParams *functorParams)
 {
-    UnCastOffParams *params = dynamic_cast<UnCastOffParams *>(functorParams);
+    UnCastOffParams *params = vrv_cast<UnCastOffParams *>(functorParams);
     assert(params);
 
     // Just move all the content of the system to the continous one (parameter)
@@ -807,7 +812,7 @@ int System::UnCastOff(FunctorParams *functorParams)
 
 int System::CastOffSystemsEnd(FunctorParams *functorParams)
 {
-    CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
+    CastOffSystemsParams *params = vrv_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
     if (params->m_pendingObjects.empty()) return FUNCTOR_STOP;
@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <mutex>
 
 //----------------------------------------------------------------------------
 
@@ -49,25 +50,31 @@ namespace vrv {
 const char *UTF_16_BE_BOM = "\xFE\xFF";
 const char *UTF_16_LE_BOM = "\xFF\xFE";
 
+#ifndef NO_HUMDRUM_SUPPORT
+/** A mutex for serializing the conversions relying on humlib, which is not thread-safe */
+static std::mutex s_humlibMutex;
+#endif
+
 //----------------------------------------------------------------------------
 // Toolkit
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
-
 Toolkit::Toolkit(bool initFont)
 {
     m_scale = DEFAULT_SCALE;
     m_inputFrom = AUTO;
+    m_outputTo = UNKNOWN;
 
     // default page size
     m_scoreBasedMei = false;
+    m_castOffDeferred = false;
+    m_castOffEncoding = false;
 
     m_humdrumBuffer = NULL;
     m_cString = NULL;
 
     if (initFont) {
-        Resources::InitFonts();
+        m_doc.GetResources().InitFonts();
     }
 
     m_options = m_doc.GetOptions();
@@ -93,8 +100,15 @@ Toolkit::~Toolkit()
 
 bool Toolkit::SetResourcePath(const std::string &path)
 {
-    Resources::SetPath(path);
-    return Resources::InitFonts();
+    m_svgSharedDefs.clear();
+    m_doc.GetResources().SetPath(path);
+    return m_doc.GetResources().InitFonts();
+}
+
+bool Toolkit::SetFont(const std::string &fontName)
+{
+    m_svgSharedDefs.clear();
+    return m_doc.GetResources().SetFont(fontName);
 }
 
 bool Toolkit::SetScale(int scale)
@@ -125,7 +139,10 @@ bool Toolkit::SetOutputTo(std::string const &outputTo)
     else if (outputTo == "pae") {
         m_outputTo = PAE;
     }
-    else if (outputTo != "svg") {
+    else if (outputTo == "svg") {
+        m_outputTo = SVGFILE;
+    }
+    else {
         LogError("Output format can only be: mei, humdrum, midi, timemap or svg");
         return false;
     }
@@ -356,6 +373,10 @@ bool Toolkit::LoadUTF16File(const std::string &filename)
 
 bool Toolkit::LoadData(const std::string &data)
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "LoadData");
+
+    m_svgSharedDefs.clear();
+
     std::string newData;
     Input *input = NULL;
 
@@ -363,6 +384,16 @@ bool Toolkit::LoadData(const std::string &data)
     if (inputFormat == AUTO) {
         inputFormat = IdentifyInputFrom(data);
     }
+
+#ifndef NO_HUMDRUM_SUPPORT
+    // Only one humlib conversion at a time - the lock is released once the Humdrum input is deleted
+    std::unique_lock<std::mutex> humlibLock(s_humlibMutex, std::defer_lock);
+    if ((inputFormat == HUMDRUM) || (inputFormat == MUSICXMLHUM) || (inputFormat == MEIHUM)
+        || (inputFormat == MUSEDATAHUM) || (inputFormat == ESAC)) {
+        humlibLock.lock();
+    }
+#endif
+
     if (inputFormat == ABC) {
 #ifndef NO_ABC_SUPPORT
         input = new ABCInput(&m_doc);
@@ -390,39 +421,19 @@ bool Toolkit::LoadData(const std::string &data)
 #ifndef NO_HUMDRUM_SUPPORT
     else if (inputFormat == HUMDRUM) {
         // LogMessage("Importing Humdrum data");
-
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        HumdrumInput *tempinput = new HumdrumInput(&tempdoc);
-        if (GetOutputTo() == HUMDRUM) {
-            tempinput->SetOutputFormat("humdrum");
-        }
-
-        if (!tempinput->Import(data)) {
-            LogError("Error importing Humdrum data (1)");
-            delete tempinput;
-            return false;
-        }
-
-        SetHumdrumBuffer(tempinput->GetHumdrumString().c_str());
-
+        input = new HumdrumInput(&m_doc);
         if (GetOutputTo() == HUMDRUM) {
-            return true;
+            input->SetOutputFormat("humdrum");
         }
-
-        MEIOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-
-        // Read embedded options from input Humdrum file:
-        tempinput->parseEmbeddedOptions(m_doc);
-        delete tempinput;
-
-        input = new MEIInput(&m_doc);
     }
 #endif
     else if (inputFormat == MEI) {
-        input = new MEIInput(&m_doc);
+        MEIInput *meiInput = new MEIInput(&m_doc);
+        // Unsupported attributes are only needed for writing the MEI back or for GetElementAttr
+        if ((GetOutputTo() == SVGFILE) || (GetOutputTo() == MIDI) || (GetOutputTo() == TIMEMAP)) {
+            meiInput->SetReadUnsupportedAttr(false);
+        }
+        input = meiInput;
     }
     else if (inputFormat == MUSICXML) {
         // This is the direct converter from MusicXML to MEI using iomusicxml:
@@ -443,20 +454,9 @@ bool Toolkit::LoadData(const std::string &data)
         std::string buffer = conversion.str();
         SetHumdrumBuffer(buffer.c_str());
 
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
-            LogError("Error importing Humdrum data (2)");
-            delete tempinput;
-            return false;
-        }
-        MEIOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MEIInput(&m_doc);
+        // The Humdrum data is imported directly into the document below
+        input = new HumdrumInput(&m_doc);
+        newData = buffer;
     }
 
     else if (inputFormat == MEIHUM) {
@@ -473,20 +473,9 @@ bool Toolkit::LoadData(const std::string &data)
         std::string buffer = conversion.str();
         SetHumdrumBuffer(buffer.c_str());
 
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
-            LogError("Error importing Humdrum data (3)");
-            delete tempinput;
-            return false;
-        }
-        MEIOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MEIInput(&m_doc);
+        // The Humdrum data is imported directly into the document below
+        input = new HumdrumInput(&m_doc);
+        newData = buffer;
     }
 
     else if (inputFormat == MUSEDATAHUM) {
@@ -501,20 +490,9 @@ bool Toolkit::LoadData(const std::string &data)
         std::string buffer = conversion.str();
         SetHumdrumBuffer(buffer.c_str());
 
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
-            LogError("Error importing Humdrum data (4)");
-            delete tempinput;
-            return false;
-        }
-        MEIOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MEIInput(&m_doc);
+        // The Humdrum data is imported directly into the document below
+        input = new HumdrumInput(&m_doc);
+        newData = buffer;
     }
 
     else if (inputFormat == ESAC) {
@@ -529,20 +507,9 @@ bool Toolkit::LoadData(const std::string &data)
         std::string buffer = conversion.str();
         SetHumdrumBuffer(buffer.c_str());
 
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
-            LogError("Error importing Humdrum data (5)");
-            delete tempinput;
-            return false;
-        }
-        MEIOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MEIInput(&m_doc);
+        // The Humdrum data is imported directly into the document below
+        input = new HumdrumInput(&m_doc);
+        newData = buffer;
     }
 #endif
     else {
@@ -556,6 +523,12 @@ bool Toolkit::LoadData(const std::string &data)
         return false;
     }
 
+#ifndef NO_HUMDRUM_SUPPORT
+    // The kern comments of the layers were not read back when the Humdrum data was converted to MEI
+    HumdrumInput *humdrumInput = dynamic_cast<HumdrumInput *>(input);
+    if (humdrumInput) humdrumInput->SetKernComments(false);
+#endif
+
     // load the file
     if (!input->Import(newData.size() ? newData : data)) {
         LogError("Error importing data");
@@ -563,6 +536,24 @@ bool Toolkit::LoadData(const std::string &data)
         return false;
     }
 
+#ifndef NO_HUMDRUM_SUPPORT
+    if (inputFormat == HUMDRUM) {
+        assert(humdrumInput);
+        SetHumdrumBuffer(humdrumInput->GetHumdrumString().c_str());
+        if (GetOutputTo() == HUMDRUM) {
+            delete input;
+            return true;
+        }
+    }
+#endif
+
+    const bool hasLayoutInformation = input->HasLayoutInformation();
+    delete input;
+
+#ifndef NO_HUMDRUM_SUPPORT
+    if (humlibLock.owns_lock()) humlibLock.unlock();
+#endif
+
     // generate the page header and footer if necessary
     if (m_options->m_footer.GetValue() == FOOTER_auto) {
         m_doc.GenerateFooter();
@@ -591,24 +582,25 @@ bool Toolkit::LoadData(const std::string &data)
     // DARMS have no layout information. MEI files _can_ have it, but it
     // might have been ignored because of the --breaks auto option.
     // Regardless, we won't do layout if the --breaks none option was set.
+    // If the output is MIDI or a timemap, for which the timing is calculated without the graphical layout,
+    // the layout is done only if the pages are accessed (see Toolkit::CastOffDeferredDoc).
+    m_castOffDeferred = false;
     if ((m_doc.GetType() != Transcription || m_doc.GetType() != Facs)
         && (m_options->m_breaks.GetValue() != BREAKS_none)) {
-        if (input->HasLayoutInformation() && (m_options->m_breaks.GetValue() == BREAKS_encoded)) {
-            // LogElapsedTimeStart();
-            m_doc.CastOffEncodingDoc();
-            // LogElapsedTimeEnd("layout");
+        m_castOffEncoding = (hasLayoutInformation && (m_options->m_breaks.GetValue() == BREAKS_encoded));
+        if (!m_castOffEncoding && (m_options->m_breaks.GetValue() == BREAKS_encoded)) {
+            LogWarning("Requesting layout with encoded breaks but nothing provided in the data");
         }
-        else {
-            if (m_options->m_breaks.GetValue() == BREAKS_encoded) {
-                LogWarning("Requesting layout with encoded breaks but nothing provided in the data");
-            }
-            // LogElapsedTimeStart();
-            m_doc.CastOffDoc();
-            // LogElapsedTimeEnd("layout");
+        m_castOffDeferred = true;
+        if ((GetOutputTo() != MIDI) && (GetOutputTo() != TIMEMAP)) {
+            this->CastOffDeferredDoc();
+        }
+        // The pages are not drawn for these outputs
+        if ((GetOutputTo() == MEI) || (GetOutputTo() == HUMDRUM) || (GetOutputTo() == PAE)) {
+            m_doc.ClearStoredHorizontalLayout(false);
         }
     }
 
-    delete input;
     m_view.SetDoc(&m_doc);
 
 #if defined NO_HUMDRUM_SUPPORT
@@ -629,8 +621,23 @@ bool Toolkit::LoadData(const std::string &data)
     return true;
 }
 
+void Toolkit::CastOffDeferredDoc()
+{
+    if (!m_castOffDeferred) return;
+    m_castOffDeferred = false;
+
+    if (m_castOffEncoding) {
+        m_doc.CastOffEncodingDoc();
+    }
+    else {
+        m_doc.CastOffDoc();
+    }
+}
+
 std::string Toolkit::GetMEI(int pageNo, bool scoreBased)
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "GetMEI");
+
     if (GetPageCount() == 0) {
         LogWarning("No data loaded");
         return "";
@@ -981,9 +988,11 @@ bool Toolkit::SetOptions(const std::string &json_options)
         }
     }
 
+    m_svgSharedDefs.clear();
+
     // Forcing font to be reset. Warning: SetOption("font") as a single option will not work.
     // This needs to be fixed
-    if (!Resources::SetFont(m_options->m_font.GetValue())) {
+    if (!m_doc.GetResources().SetFont(m_options->m_font.GetValue())) {
         LogWarning("Font '%s' could not be loaded", m_options->m_font.GetValue().c_str());
     }
 
@@ -1016,16 +1025,8 @@ std::string Toolkit::GetElementAttr(const std::string &xmlId)
 {
     jsonxx::Object o;
 
-    Object *element = NULL;
+    Object *element = m_doc.FindElementByUuid(xmlId);
 
-    // Try to get the element on the current drawing page - it is usually the case and fast
-    if (m_doc.GetDrawingPage()) {
-        element = m_doc.GetDrawingPage()->FindDescendantByUuid(xmlId);
-    }
-    // If it wasn't there, try on the whole doc
-    if (!element) {
-        element = m_doc.FindDescendantByUuid(xmlId);
-    }
     // If not found at all
     if (!element) {
         LogMessage("Element with id '%s' could not be found", xmlId.c_str());
@@ -1069,6 +1070,9 @@ std::string Toolkit::GetExpansionIdsForElement(const std::string &xmlId)
 
 bool Toolkit::Edit(const std::string &json_editorAction)
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "Edit");
+
+    this->CastOffDeferredDoc();
     return m_editorToolkit->ParseEditorAction(json_editorAction);
 }
 
@@ -1104,19 +1108,59 @@ void Toolkit::ResetLogBuffer()
 #endif
 }
 
-void Toolkit::RedoLayout()
+std::string Toolkit::GetProfile()
 {
+    jsonxx::Object toolkit;
+    for (auto &entry : m_profiler.GetEntryPoints()) {
+        jsonxx::Object o;
+        o << "count" << entry.second.m_count;
+        o << "time" << entry.second.m_time;
+        toolkit << entry.first << o;
+    }
+
+    jsonxx::Object passes;
+    for (auto &entry : m_profiler.GetPasses()) {
+        jsonxx::Object o;
+        o << "count" << entry.second.m_count;
+        o << "time" << entry.second.m_time;
+        o << "visits" << entry.second.m_visits;
+        o << "calls" << entry.second.m_calls;
+        passes << entry.first << o;
+    }
+
+    jsonxx::Object profile;
+    profile << "toolkit" << toolkit;
+    profile << "passes" << passes;
+    return profile.json();
+}
+
+void Toolkit::ResetProfile()
+{
+    m_profiler.Reset();
+}
+
+void Toolkit::RedoLayout(bool incremental)
+{
+    ProfilerScope profilerScope(this->GetProfiler(), "RedoLayout");
+
     if ((GetPageCount() == 0) || (m_doc.GetType() == Transcription) || (m_doc.GetType() == Facs)) {
         LogWarning("No data to re-layout");
         return;
     }
 
+    if (incremental) {
+        m_doc.CastOffDocIncremental();
+        return;
+    }
+
     m_doc.UnCastOffDoc();
     m_doc.CastOffDoc();
 }
 
 void Toolkit::RedoPagePitchPosLayout()
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "RedoPagePitchPosLayout");
+
     Page *page = m_doc.GetDrawingPage();
 
     if (!page) {
@@ -1129,6 +1173,8 @@ void Toolkit::RedoPagePitchPosLayout()
 
 bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "RenderToDeviceContext");
+
     if (pageNo > GetPageCount()) {
         LogWarning("Page %d does not exist", pageNo);
         return false;
@@ -1174,6 +1220,8 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
 
 std::string Toolkit::RenderToSVG(int pageNo, bool xml_declaration)
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "RenderToSVG");
+
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
@@ -1196,6 +1244,11 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xml_declaration)
         svg.SetSvgViewBox(true);
     }
 
+    // write only the <defs> not already written in previous SVGs
+    if (m_options->m_svgSharedDefs.GetValue()) {
+        svg.SetSharedDefs(&m_svgSharedDefs);
+    }
+
     // render the page
     RenderToDeviceContext(pageNo, &svg);
 
@@ -1248,6 +1301,8 @@ void Toolkit::GetHumdrum(std::ostream &output)
 
 std::string Toolkit::RenderToMIDI()
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "RenderToMIDI");
+
     smf::MidiFile outputfile;
     outputfile.absoluteTicks();
     m_doc.ExportMIDI(&outputfile);
@@ -1263,6 +1318,8 @@ std::string Toolkit::RenderToMIDI()
 
 std::string Toolkit::RenderToPAE()
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "RenderToPAE");
+
     if (GetPageCount() == 0) {
         LogWarning("No data loaded");
         return "";
@@ -1291,6 +1348,8 @@ bool Toolkit::RenderToPAEFile(const std::string &filename)
 
 std::string Toolkit::RenderToTimemap()
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "RenderToTimemap");
+
     std::string output;
     m_doc.ExportTimemap(output);
     return output;
@@ -1298,48 +1357,72 @@ std::string Toolkit::RenderToTimemap()
 
 std::string Toolkit::GetElementsAtTime(int millisec)
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "GetElementsAtTime");
+
     jsonxx::Object o;
+    this->GetElementsAtTime(millisec, o);
+    return o.json();
+}
+
+std::string Toolkit::GetElementsAtTimes(int startMillisec, int endMillisec, int stepMillisec)
+{
+    ProfilerScope profilerScope(this->GetProfiler(), "GetElementsAtTimes");
+
     jsonxx::Array a;
 
-    // Here we need to check that the midi timemap is done
-    if (!m_doc.HasMidiTimemap()) {
-        // generate MIDI timemap before progressing
-        m_doc.CalculateMidiTimemap();
+    if (stepMillisec <= 0) {
+        LogWarning("The time step must be greater than 0");
+        return a.json();
+    }
+
+    for (int millisec = startMillisec; millisec <= endMillisec; millisec += stepMillisec) {
+        jsonxx::Object o;
+        o << "time" << millisec;
+        this->GetElementsAtTime(millisec, o);
+        a << o;
     }
 
-    MeasureOnsetOffsetComparison matchMeasureTime(millisec);
-    Measure *measure = dynamic_cast<Measure *>(m_doc.FindDescendantByComparison(&matchMeasureTime));
+    return a.json();
+}
+
+void Toolkit::GetElementsAtTime(int millisec, jsonxx::Object &o)
+{
+    // The page numbers are the ones of the cast off document
+    this->CastOffDeferredDoc();
+
+    // The MIDI timemap and the time index are calculated if necessary
+    ArrayOfObjects notes;
+    ArrayOfObjects rests;
+    Measure *measure = m_doc.FindElementsAtTime(millisec, &notes, &rests);
 
     if (!measure) {
-        return o.json();
+        return;
     }
 
-    int repeat = measure->EnclosesTime(millisec);
-    int measureTimeOffset = measure->GetRealTimeOffsetMilliseconds(repeat);
-
     // Get the pageNo from the first note (if any)
     int pageNo = -1;
-    Page *page = dynamic_cast<Page *>(measure->GetFirstAncestor(PAGE));
+    Page *page = vrv_cast<Page *>(measure->GetFirstAncestor(PAGE));
     if (page) pageNo = page->GetIdx() + 1;
 
-    NoteOnsetOffsetComparison matchNoteTime(millisec - measureTimeOffset);
-    ArrayOfObjects notes;
-
-    measure->FindAllDescendantByComparison(&notes, &matchNoteTime);
-
     // Fill the JSON object
+    jsonxx::Array a;
     ArrayOfObjects::iterator iter;
     for (iter = notes.begin(); iter != notes.end(); ++iter) {
         a << (*iter)->GetUuid();
     }
     o << "notes" << a;
+    jsonxx::Array r;
+    for (iter = rests.begin(); iter != rests.end(); ++iter) {
+        r << (*iter)->GetUuid();
+    }
+    o << "rests" << r;
     o << "page" << pageNo;
-
-    return o.json();
 }
 
 bool Toolkit::RenderToMIDIFile(const std::string &filename)
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "RenderToMIDIFile");
+
     smf::MidiFile outputfile;
     outputfile.absoluteTicks();
     m_doc.ExportMIDI(&outputfile);
@@ -1351,6 +1434,8 @@ bool Toolkit::RenderToMIDIFile(const std::string &filename)
 
 bool Toolkit::RenderToTimemapFile(const std::string &filename)
 {
+    ProfilerScope profilerScope(this->GetProfiler(), "RenderToTimemapFile");
+
     std::string outputString;
     m_doc.ExportTimemap(outputString);
 
@@ -1365,16 +1450,18 @@ bool Toolkit::RenderToTimemapFile(const std::string &filename)
 
 int Toolkit::GetPageCount()
 {
+    this->CastOffDeferredDoc();
     return m_doc.GetPageCount();
 }
 
 int Toolkit::GetPageWithElement(const std::string &xmlId)
 {
-    Object *element = m_doc.FindDescendantByUuid(xmlId);
+    this->CastOffDeferredDoc();
+    Object *element = m_doc.FindElementByUuid(xmlId);
     if (!element) {
         return 0;
     }
-    Page *page = dynamic_cast<Page *>(element->GetFirstAncestor(PAGE));
+    Page *page = vrv_cast<Page *>(element->GetFirstAncestor(PAGE));
     if (!page) {
         return 0;
     }
@@ -1383,7 +1470,9 @@ int Toolkit::GetPageWithElement(const std::string &xmlId)
 
 int Toolkit::GetTimeForElement(const std::string &xmlId)
 {
-    Object *element = m_doc.FindDescendantByUuid(xmlId);
+    ProfilerScope profilerScope(this->GetProfiler(), "GetTimeForElement");
+
+    Object *element = m_doc.FindElementByUuid(xmlId);
 
     if (!element) {
         LogWarning("Element '%s' not found", xmlId.c_str());
@@ -1399,9 +1488,9 @@ int Toolkit::GetTimeForElement(const std::string &xmlId)
         if (!m_doc.HasMidiTimemap()) {
             LogWarning("Calculation of MIDI timemap failed, time value is invalid.");
         }
-        Note *note = dynamic_cast<Note *>(element);
+        Note *note = vrv_cast<Note *>(element);
         assert(note);
-        Measure *measure = dynamic_cast<Measure *>(note->GetFirstAncestor(MEASURE));
+        Measure *measure = vrv_cast<Measure *>(note->GetFirstAncestor(MEASURE));
         assert(measure);
         // For now ignore repeats and access always the first
         timeofElement = measure->GetRealTimeOffsetMilliseconds(1);
@@ -1412,7 +1501,9 @@ int Toolkit::GetTimeForElement(const std::string &xmlId)
 
 std::string Toolkit::GetMIDIValuesForElement(const std::string &xmlId)
 {
-    Object *element = m_doc.FindDescendantByUuid(xmlId);
+    ProfilerScope profilerScope(this->GetProfiler(), "GetMIDIValuesForElement");
+
+    Object *element = m_doc.FindElementByUuid(xmlId);
 
     if (!element) {
         LogWarning("Element '%s' not found", xmlId.c_str());
@@ -1421,7 +1512,7 @@ std::string Toolkit::GetMIDIValuesForElement(const std::string &xmlId)
 
     jsonxx::Object o;
     if (element->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(element);
+        Note *note = vrv_cast<Note *>(element);
         assert(note);
         int timeofElement = this->GetTimeForElement(xmlId);
         int pitchofElement = note->GetMIDIPitch();
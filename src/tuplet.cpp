@@ -161,7 +161,7 @@ void Tuplet::CalcDrawingBracketAndNumPos()
     ArrayOfObjects::const_iterator iter = tupletChildren->begin();
     while (iter != tupletChildren->end()) {
         if ((*iter)->Is(CHORD)) {
-            Chord *currentChord = dynamic_cast<Chord *>(*iter);
+            Chord *currentChord = vrv_cast<Chord *>(*iter);
             assert(currentChord);
             if (currentChord->GetDrawingStemDir() == STEMDIRECTION_up) {
                 ups++;
@@ -171,7 +171,7 @@ void Tuplet::CalcDrawingBracketAndNumPos()
             }
         }
         else if ((*iter)->Is(NOTE)) {
-            Note *currentNote = dynamic_cast<Note *>(*iter);
+            Note *currentNote = vrv_cast<Note *>(*iter);
             assert(currentNote);
             if (!currentNote->IsChordTone() && (currentNote->GetDrawingStemDir() == STEMDIRECTION_up)) {
                 ups++;
@@ -207,7 +207,7 @@ void Tuplet::GetDrawingLeftRightXRel(int &XRelLeft, int &XRelRight, Doc *doc)
         //
     }
     else if (m_drawingLeft->Is(CHORD)) {
-        Chord *chord = dynamic_cast<Chord *>(m_drawingLeft);
+        Chord *chord = vrv_cast<Chord *>(m_drawingLeft);
         assert(chord);
         XRelLeft = chord->GetXMin() - m_drawingLeft->GetDrawingX();
     }
@@ -221,7 +221,7 @@ void Tuplet::GetDrawingLeftRightXRel(int &XRelLeft, int &XRelRight, Doc *doc)
         XRelRight += m_drawingRight->GetSelfX2();
     }
     else if (m_drawingRight->Is(CHORD)) {
-        Chord *chord = dynamic_cast<Chord *>(m_drawingRight);
+        Chord *chord = vrv_cast<Chord *>(m_drawingRight);
         assert(chord);
         XRelRight = chord->GetXMax() - chord->GetDrawingX() + (2 * chord->GetDrawingRadius(doc));
     }
@@ -233,14 +233,14 @@ void Tuplet::GetDrawingLeftRightXRel(int &XRelLeft, int &XRelRight, Doc *doc)
 
 int Tuplet::PrepareLayerElementParts(FunctorParams *functorParams)
 {
-    TupletBracket *currentBracket = dynamic_cast<TupletBracket *>(this->FindDescendantByType(TUPLET_BRACKET, 1));
-    TupletNum *currentNum = dynamic_cast<TupletNum *>(this->FindDescendantByType(TUPLET_NUM, 1));
+    TupletBracket *currentBracket = vrv_cast<TupletBracket *>(this->FindDescendantByType(TUPLET_BRACKET, 1));
+    TupletNum *currentNum = vrv_cast<TupletNum *>(this->FindDescendantByType(TUPLET_NUM, 1));
 
     bool beamed = false;
     // Are we contained in a beam?
     if (this->GetFirstAncestor(BEAM, MAX_BEAM_DEPTH)) {
         // is only the tuplet beamed? (will not work with nested tuplets)
-        Beam *currentBeam = dynamic_cast<Beam *>(this->GetFirstAncestor(BEAM, MAX_BEAM_DEPTH));
+        Beam *currentBeam = vrv_cast<Beam *>(this->GetFirstAncestor(BEAM, MAX_BEAM_DEPTH));
         if (currentBeam->GetChildCount() == 1) {
             beamed = true;
         }
@@ -279,7 +279,7 @@ int Tuplet::PrepareLayerElementParts(FunctorParams *functorParams)
 
     /************ Prepare the drawing cue size ************/
 
-    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize);
+    Functor prepareDrawingCueSize(&Object::PrepareDrawingCueSize, "PrepareDrawingCueSize");
     this->Process(&prepareDrawingCueSize, NULL);
 
     /*********** Get the left and right element ***********/
@@ -294,7 +294,7 @@ int Tuplet::PrepareLayerElementParts(FunctorParams *functorParams)
 
 int Tuplet::AdjustTupletsX(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     // Nothing to do if the bracket and the num are not visible
@@ -310,12 +310,12 @@ int Tuplet::AdjustTupletsX(FunctorParams *functorParams)
     assert(m_drawingBracketPos != STAFFREL_basic_NONE);
 
     // Carefull: this will not work if the tuplet has editorial markup (one child) and then notes + one beam
-    Beam *beamParent = dynamic_cast<Beam *>(this->GetFirstAncestor(BEAM, MAX_BEAM_DEPTH));
+    Beam *beamParent = vrv_cast<Beam *>(this->GetFirstAncestor(BEAM, MAX_BEAM_DEPTH));
     // Are we contained in a beam?
     if (beamParent) {
         m_bracketAlignedBeam = beamParent;
     }
-    Beam *beamChild = dynamic_cast<Beam *>(this->FindDescendantByType(BEAM));
+    Beam *beamChild = vrv_cast<Beam *>(this->FindDescendantByType(BEAM));
     // Do we contain a beam?
     if (beamChild) {
         if ((this->GetChildCount(NOTE) == 0) && (this->GetChildCount(CHORD) == 0) && (this->GetChildCount(BEAM) == 1)) {
@@ -351,13 +351,13 @@ int Tuplet::AdjustTupletsX(FunctorParams *functorParams)
     int XRelRight;
     this->GetDrawingLeftRightXRel(XRelLeft, XRelRight, params->m_doc);
 
-    TupletBracket *tupletBracket = dynamic_cast<TupletBracket *>(this->FindDescendantByType(TUPLET_BRACKET));
+    TupletBracket *tupletBracket = vrv_cast<TupletBracket *>(this->FindDescendantByType(TUPLET_BRACKET));
     if (tupletBracket && (this->GetBracketVisible() != BOOLEAN_false)) {
         tupletBracket->SetDrawingXRelLeft(XRelLeft);
         tupletBracket->SetDrawingXRelRight(XRelRight);
     }
 
-    TupletNum *tupletNum = dynamic_cast<TupletNum *>(this->FindDescendantByType(TUPLET_NUM));
+    TupletNum *tupletNum = vrv_cast<TupletNum *>(this->FindDescendantByType(TUPLET_NUM));
     if (tupletNum && (this->GetNumVisible() != BOOLEAN_false)) {
         // We have a bracket and the num is not on its opposite side
         if (tupletBracket && (m_drawingNumPos == m_drawingBracketPos)) {
@@ -373,7 +373,7 @@ int Tuplet::AdjustTupletsX(FunctorParams *functorParams)
 
 int Tuplet::AdjustTupletsY(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     // Nothing to do if the bracket and the num are not visible
@@ -385,7 +385,7 @@ int Tuplet::AdjustTupletsY(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstAncestor(STAFF));
     assert(staff);
     int staffSize = staff->m_drawingStaffSize;
 
@@ -395,7 +395,7 @@ int Tuplet::AdjustTupletsY(FunctorParams *functorParams)
     int verticalMargin = 2 * verticalLine;
     int yReference = staff->GetDrawingY();
 
-    TupletBracket *tupletBracket = dynamic_cast<TupletBracket *>(this->FindDescendantByType(TUPLET_BRACKET));
+    TupletBracket *tupletBracket = vrv_cast<TupletBracket *>(this->FindDescendantByType(TUPLET_BRACKET));
     if (tupletBracket && (this->GetBracketVisible() != BOOLEAN_false)) {
 
         int bracketVerticalMargin = verticalMargin;
@@ -468,7 +468,7 @@ int Tuplet::AdjustTupletsY(FunctorParams *functorParams)
         }
     }
 
-    TupletNum *tupletNum = dynamic_cast<TupletNum *>(this->FindDescendantByType(TUPLET_NUM));
+    TupletNum *tupletNum = vrv_cast<TupletNum *>(this->FindDescendantByType(TUPLET_NUM));
     if (tupletNum && (this->GetNumVisible() != BOOLEAN_false)) {
         // The num is within a bracket
         if (tupletNum->GetAlignedBracket()) {
@@ -78,7 +78,7 @@ StaffAlignment *SystemAligner::GetStaffAlignmentForStaffN(int staffN) const
     StaffAlignment *alignment = NULL;
     int i;
     for (i = 0; i < this->GetChildCount(); ++i) {
-        alignment = dynamic_cast<StaffAlignment *>(m_children.at(i));
+        alignment = vrv_cast<StaffAlignment *>(m_children.at(i));
         assert(alignment);
 
         if ((alignment->GetStaff()) && (alignment->GetStaff()->GetN() == staffN)) return alignment;
@@ -95,7 +95,7 @@ void SystemAligner::FindAllPositionerPointingTo(ArrayOfFloatingPositioners *posi
 
     StaffAlignment *alignment = NULL;
     for (auto &child : m_children) {
-        alignment = dynamic_cast<StaffAlignment *>(child);
+        alignment = vrv_cast<StaffAlignment *>(child);
         assert(alignment);
         FloatingPositioner *positioner = alignment->GetCorrespFloatingPositioner(object);
         if (positioner && (positioner->GetObject() == object)) {
@@ -109,7 +109,7 @@ void SystemAligner::FindAllIntersectionPoints(
 {
     StaffAlignment *alignment = NULL;
     for (auto &child : m_children) {
-        alignment = dynamic_cast<StaffAlignment *>(child);
+        alignment = vrv_cast<StaffAlignment *>(child);
         assert(alignment);
         alignment->FindAllIntersectionPoints(line, boundingBox, classIds, margin);
     }
@@ -198,7 +198,7 @@ void StaffAlignment::SetVerseCount(int verse_count)
 int StaffAlignment::CalcOverflowAbove(BoundingBox *box)
 {
     if (box->Is(FLOATING_POSITIONER)) {
-        FloatingPositioner *positioner = dynamic_cast<FloatingPositioner *>(box);
+        FloatingPositioner *positioner = vrv_cast<FloatingPositioner *>(box);
         assert(positioner);
         return positioner->GetContentTop() - this->GetYRel();
     }
@@ -208,7 +208,7 @@ int StaffAlignment::CalcOverflowAbove(BoundingBox *box)
 int StaffAlignment::CalcOverflowBelow(BoundingBox *box)
 {
     if (box->Is(FLOATING_POSITIONER)) {
-        FloatingPositioner *positioner = dynamic_cast<FloatingPositioner *>(box);
+        FloatingPositioner *positioner = vrv_cast<FloatingPositioner *>(box);
         assert(positioner);
         return -(positioner->GetContentBottom() + m_staffHeight - this->GetYRel());
     }
@@ -326,7 +326,7 @@ void StaffAlignment::ReAdjustFloatingPositionersGrps(AdjustFloatingPositionerGrp
 
 int StaffAlignment::AdjustFloatingPositioners(FunctorParams *functorParams)
 {
-    AdjustFloatingPositionersParams *params = dynamic_cast<AdjustFloatingPositionersParams *>(functorParams);
+    AdjustFloatingPositionersParams *params = vrv_cast<AdjustFloatingPositionersParams *>(functorParams);
     assert(params);
 
     int staffSize = this->GetStaffSize();
@@ -343,11 +343,12 @@ int StaffAlignment::AdjustFloatingPositioners(FunctorParams *functorParams)
             this->SetOverflowBelow(minMargin + this->GetVerseCount() * (height - descender + margin));
             // For now just clear the overflowBelow, which avoids the overlap to be calculated. We could also keep them
             // and check if they are some lyrics in order to know if the overlap needs to be calculated or not.
-            m_overflowBelowBBoxes.clear();
+            m_overflowBelowBBoxes.Reset();
         }
         return FUNCTOR_SIBLINGS;
     }
 
+    ArrayOfBoundingBoxes overlaps;
     ArrayOfFloatingPositioners::iterator iter;
     for (iter = m_floatingPositioners.begin(); iter != m_floatingPositioners.end(); ++iter) {
         assert((*iter)->GetObject());
@@ -360,14 +361,14 @@ int StaffAlignment::AdjustFloatingPositioners(FunctorParams *functorParams)
         if ((params->m_classId == SLUR) || (params->m_classId == TIE)) {
 
             assert((*iter)->Is(FLOATING_CURVE_POSITIONER));
-            FloatingCurvePositioner *curve = dynamic_cast<FloatingCurvePositioner *>(*iter);
+            FloatingCurvePositioner *curve = vrv_cast<FloatingCurvePositioner *>(*iter);
             assert(curve);
 
             bool skipAbove = false;
             bool skipBelow = false;
 
             if ((*iter)->GetObject()->Is(SLUR)) {
-                Slur *slur = dynamic_cast<Slur *>((*iter)->GetObject());
+                Slur *slur = vrv_cast<Slur *>((*iter)->GetObject());
                 assert(slur);
                 slur->GetCrossStaffOverflows(this, curve->GetDir(), skipAbove, skipBelow);
             }
@@ -377,7 +378,7 @@ int StaffAlignment::AdjustFloatingPositioners(FunctorParams *functorParams)
             if (overflowAbove > params->m_doc->GetDrawingStaffLineWidth(staffSize) / 2) {
                 // LogMessage("%sparams->m_doctop overflow: %d", current->GetUuid().c_str(), overflowAbove);
                 this->SetOverflowAbove(overflowAbove);
-                this->m_overflowAboveBBoxes.push_back((*iter));
+                this->m_overflowAboveBBoxes.Add((*iter));
             }
 
             int overflowBelow = 0;
@@ -385,7 +386,7 @@ int StaffAlignment::AdjustFloatingPositioners(FunctorParams *functorParams)
             if (overflowBelow > params->m_doc->GetDrawingStaffLineWidth(staffSize) / 2) {
                 // LogMessage("%s bottom overflow: %d", current->GetUuid().c_str(), overflowBelow);
                 this->SetOverflowBelow(overflowBelow);
-                this->m_overflowBelowBBoxes.push_back((*iter));
+                this->m_overflowBelowBBoxes.Add((*iter));
             }
             continue;
         }
@@ -393,33 +394,28 @@ int StaffAlignment::AdjustFloatingPositioners(FunctorParams *functorParams)
         // This sets the default position (without considering any overflowing box)
         (*iter)->CalcDrawingYRel(params->m_doc, this, NULL);
 
-        ArrayOfBoundingBoxes *overflowBoxes = &m_overflowBelowBBoxes;
+        HorizontalBBoxIndex *overflowBoxes = &m_overflowBelowBBoxes;
         // above?
         data_STAFFREL place = (*iter)->GetDrawingPlace();
         if (place == STAFFREL_above) {
             overflowBoxes = &m_overflowAboveBBoxes;
         }
-        auto i = overflowBoxes->begin();
-        auto end = overflowBoxes->end();
-        while (i != end) {
-            // find all the overflowing elements from the staff that overlap horizonatally
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // update the yRel accordingly
-                (*iter)->CalcDrawingYRel(params->m_doc, this, *i);
-                i++;
-            }
+        // find all the overflowing elements from the staff that overlap horizonatally
+        overflowBoxes->FindHorizontalContentOverlaps(*iter, overlaps);
+        for (auto &overlap : overlaps) {
+            // update the yRel accordingly
+            (*iter)->CalcDrawingYRel(params->m_doc, this, overlap);
         }
         //  Now update the staffAlignment max overflow (above or below) and add the positioner to the list of
         //  overflowing elements
         if (place == STAFFREL_above) {
             int overflowAbove = this->CalcOverflowAbove((*iter));
-            overflowBoxes->push_back((*iter));
+            overflowBoxes->Add((*iter));
             this->SetOverflowAbove(overflowAbove);
         }
         else {
             int overflowBelow = this->CalcOverflowBelow((*iter));
-            overflowBoxes->push_back((*iter));
+            overflowBoxes->Add((*iter));
             this->SetOverflowBelow(overflowBelow);
         }
     }
@@ -429,7 +425,7 @@ int StaffAlignment::AdjustFloatingPositioners(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustFloatingPositionerGrps(FunctorParams *functorParams)
 {
-    AdjustFloatingPositionerGrpsParams *params = dynamic_cast<AdjustFloatingPositionerGrpsParams *>(functorParams);
+    AdjustFloatingPositionerGrpsParams *params = vrv_cast<AdjustFloatingPositionerGrpsParams *>(functorParams);
     assert(params);
 
     ArrayOfFloatingPositioners positioners;
@@ -507,18 +503,18 @@ int StaffAlignment::AdjustFloatingPositionerGrps(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustSlurs(FunctorParams *functorParams)
 {
-    AdjustSlursParams *params = dynamic_cast<AdjustSlursParams *>(functorParams);
+    AdjustSlursParams *params = vrv_cast<AdjustSlursParams *>(functorParams);
     assert(params);
 
     ArrayOfFloatingPositioners::iterator iter;
     for (iter = m_floatingPositioners.begin(); iter != m_floatingPositioners.end(); ++iter) {
         assert((*iter)->GetObject());
         if (!(*iter)->GetObject()->Is(SLUR)) continue;
-        Slur *slur = dynamic_cast<Slur *>((*iter)->GetObject());
+        Slur *slur = vrv_cast<Slur *>((*iter)->GetObject());
         assert(slur);
 
         assert((*iter)->Is(FLOATING_CURVE_POSITIONER));
-        FloatingCurvePositioner *curve = dynamic_cast<FloatingCurvePositioner *>(*iter);
+        FloatingCurvePositioner *curve = vrv_cast<FloatingCurvePositioner *>(*iter);
         assert(curve);
 
         // Skip if no content bounding box is available
@@ -535,7 +531,7 @@ int StaffAlignment::AdjustSlurs(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
 {
-    AdjustStaffOverlapParams *params = dynamic_cast<AdjustStaffOverlapParams *>(functorParams);
+    AdjustStaffOverlapParams *params = vrv_cast<AdjustStaffOverlapParams *>(functorParams);
     assert(params);
 
     // This is the bottom alignment (or something is wrong)
@@ -546,25 +542,19 @@ int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
-    ArrayOfBoundingBoxes::iterator iter;
+    ArrayOfBoundingBoxes overlaps;
     // go through all the elements of the top staff that have an overflow below
-    for (iter = params->m_previous->m_overflowBelowBBoxes.begin();
-         iter != params->m_previous->m_overflowBelowBBoxes.end(); ++iter) {
-        auto i = m_overflowAboveBBoxes.begin();
-        auto end = m_overflowAboveBBoxes.end();
-        while (i != end) {
-            // find all the elements from the bottom staff that have an overflow at the top with an horizontal overlap
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // calculate the vertical overlap and see if this is more than the expected space
-                int overflowBelow = params->m_previous->CalcOverflowBelow(*iter);
-                int overflowAbove = this->CalcOverflowAbove(*i);
-                int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
-                if (spacing < (overflowBelow + overflowAbove)) {
-                    // LogDebug("Overlap %d", (overflowBelow + overflowAbove) - spacing);
-                    this->SetOverlap((overflowBelow + overflowAbove) - spacing);
-                }
-                i++;
+    for (auto &box : params->m_previous->m_overflowBelowBBoxes.GetBoxes()) {
+        // find all the elements from the bottom staff that have an overflow at the top with an horizontal overlap
+        m_overflowAboveBBoxes.FindHorizontalContentOverlaps(box, overlaps);
+        for (auto &overlap : overlaps) {
+            // calculate the vertical overlap and see if this is more than the expected space
+            int overflowBelow = params->m_previous->CalcOverflowBelow(box);
+            int overflowAbove = this->CalcOverflowAbove(overlap);
+            int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
+            if (spacing < (overflowBelow + overflowAbove)) {
+                // LogDebug("Overlap %d", (overflowBelow + overflowAbove) - spacing);
+                this->SetOverlap((overflowBelow + overflowAbove) - spacing);
             }
         }
     }
@@ -576,7 +566,7 @@ int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
 
 int StaffAlignment::AlignVerticallyEnd(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     if (params->m_staffIdx > 0) {
@@ -598,7 +588,7 @@ int StaffAlignment::AlignVerticallyEnd(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustYPos(FunctorParams *functorParams)
 {
-    AdjustYPosParams *params = dynamic_cast<AdjustYPosParams *>(functorParams);
+    AdjustYPosParams *params = vrv_cast<AdjustYPosParams *>(functorParams);
     assert(params);
 
     int maxOverflowAbove;
@@ -638,7 +628,7 @@ int StaffAlignment::AdjustYPos(FunctorParams *functorParams)
 
 int StaffAlignment::JustifyY(FunctorParams *functorParams)
 {
-    JustifyYParams *params = dynamic_cast<JustifyYParams *>(functorParams);
+    JustifyYParams *params = vrv_cast<JustifyYParams *>(functorParams);
     assert(params);
 
     // Skip bottom aligner
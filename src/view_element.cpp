@@ -222,7 +222,7 @@ void View::DrawAccid(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    Accid *accid = dynamic_cast<Accid *>(element);
+    Accid *accid = vrv_cast<Accid *>(element);
     assert(accid);
 
     // This can happen with accid within note with only accid.ges
@@ -246,7 +246,7 @@ void View::DrawAccid(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     if ((accid->GetFunc() == accidLog_FUNC_edit) && (!accid->HasEnclose())) {
         y = staff->GetDrawingY();
         // look at the note position and adjust it if necessary
-        Note *note = dynamic_cast<Note *>(accid->GetFirstAncestor(NOTE, MAX_ACCID_DEPTH));
+        Note *note = vrv_cast<Note *>(accid->GetFirstAncestor(NOTE, MAX_ACCID_DEPTH));
         if (note) {
             // Check if the note is on the top line or above (add a unit for the note head half size)
             if (note->GetDrawingY() >= y) y = note->GetDrawingY() + m_doc->GetDrawingUnit(staff->m_drawingStaffSize);
@@ -276,7 +276,7 @@ void View::DrawArtic(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    Artic *artic = dynamic_cast<Artic *>(element);
+    Artic *artic = vrv_cast<Artic *>(element);
     assert(artic);
 
     /************** draw the artic **************/
@@ -296,7 +296,7 @@ void View::DrawArticPart(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(staff);
     assert(measure);
 
-    ArticPart *articPart = dynamic_cast<ArticPart *>(element);
+    ArticPart *articPart = vrv_cast<ArticPart *>(element);
     assert(articPart);
 
     /************** draw the artic **************/
@@ -377,7 +377,7 @@ void View::DrawBarLine(DeviceContext *dc, LayerElement *element, Layer *layer, S
     assert(staff);
     assert(measure);
 
-    BarLine *barLine = dynamic_cast<BarLine *>(element);
+    BarLine *barLine = vrv_cast<BarLine *>(element);
     assert(barLine);
 
     if (barLine->GetForm() == BARRENDITION_invis) {
@@ -401,7 +401,7 @@ void View::DrawBeatRpt(DeviceContext *dc, LayerElement *element, Layer *layer, S
     assert(staff);
     assert(measure);
 
-    BeatRpt *beatRpt = dynamic_cast<BeatRpt *>(element);
+    BeatRpt *beatRpt = vrv_cast<BeatRpt *>(element);
     assert(beatRpt);
 
     dc->StartGraphic(element, "", element->GetUuid());
@@ -437,7 +437,7 @@ void View::DrawBTrem(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    BTrem *bTrem = dynamic_cast<BTrem *>(element);
+    BTrem *bTrem = vrv_cast<BTrem *>(element);
     assert(bTrem);
 
     data_STEMDIRECTION stemDir = STEMDIRECTION_NONE;
@@ -449,14 +449,14 @@ void View::DrawBTrem(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     bool drawingCueSize = false;
     int x, y;
 
-    Chord *childChord = dynamic_cast<Chord *>(bTrem->FindDescendantByType(CHORD));
+    Chord *childChord = vrv_cast<Chord *>(bTrem->FindDescendantByType(CHORD));
     // Get from the chord or note child
     if (childChord) {
         drawingDur = childChord->GetDur();
         childElement = childChord;
     }
     else {
-        childNote = dynamic_cast<Note *>(bTrem->FindDescendantByType(NOTE));
+        childNote = vrv_cast<Note *>(bTrem->FindDescendantByType(NOTE));
         if (childNote) {
             drawingDur = childNote->GetDur();
             childElement = childNote;
@@ -557,7 +557,7 @@ void View::DrawChord(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    Chord *chord = dynamic_cast<Chord *>(element);
+    Chord *chord = vrv_cast<Chord *>(element);
     assert(chord);
 
     if (chord->m_crossStaff) staff = chord->m_crossStaff;
@@ -577,7 +577,7 @@ void View::DrawClef(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Clef *clef = dynamic_cast<Clef *>(element);
+    Clef *clef = vrv_cast<Clef *>(element);
     assert(clef);
     int x, y;
     if (m_doc->GetType() == Facs && clef->HasFacs()) {
@@ -690,7 +690,7 @@ void View::DrawCustos(DeviceContext *dc, LayerElement *element, Layer *layer, St
     assert(staff);
     assert(measure);
 
-    Custos *custos = dynamic_cast<Custos *>(element);
+    Custos *custos = vrv_cast<Custos *>(element);
     assert(custos);
 
     dc->StartGraphic(element, "", element->GetUuid());
@@ -755,7 +755,7 @@ void View::DrawDot(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
     assert(staff);
     assert(measure);
 
-    Dot *dot = dynamic_cast<Dot *>(element);
+    Dot *dot = vrv_cast<Dot *>(element);
     assert(dot);
 
     dc->StartGraphic(element, "", element->GetUuid());
@@ -789,7 +789,7 @@ void View::DrawDots(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Dots *dots = dynamic_cast<Dots *>(element);
+    Dots *dots = vrv_cast<Dots *>(element);
     assert(dots);
 
     dc->StartGraphic(element, "", element->GetUuid());
@@ -820,17 +820,17 @@ void View::DrawDurationElement(DeviceContext *dc, LayerElement *element, Layer *
     assert(staff);
     assert(measure);
 
-    if (dynamic_cast<Chord *>(element)) {
+    if (element->Is(CHORD)) {
         dc->StartGraphic(element, "", element->GetUuid());
         DrawChord(dc, element, layer, staff, measure);
         dc->EndGraphic(element, this);
     }
-    else if (dynamic_cast<Note *>(element)) {
+    else if (element->Is(NOTE)) {
         dc->StartGraphic(element, "", element->GetUuid());
         DrawNote(dc, element, layer, staff, measure);
         dc->EndGraphic(element, this);
     }
-    else if (dynamic_cast<Rest *>(element)) {
+    else if (element->Is(REST)) {
         dc->StartGraphic(element, "", element->GetUuid());
         DrawRest(dc, element, layer, staff, measure);
         dc->EndGraphic(element, this);
@@ -845,10 +845,10 @@ void View::DrawFlag(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Flag *flag = dynamic_cast<Flag *>(element);
+    Flag *flag = vrv_cast<Flag *>(element);
     assert(flag);
 
-    Stem *stem = dynamic_cast<Stem *>(flag->GetFirstAncestor(STEM));
+    Stem *stem = vrv_cast<Stem *>(flag->GetFirstAncestor(STEM));
     assert(stem);
 
     int x = flag->GetDrawingX() - m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize) / 2;
@@ -886,7 +886,7 @@ void View::DrawHalfmRpt(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(staff);
     assert(measure);
 
-    HalfmRpt *halfmRpt = dynamic_cast<HalfmRpt *>(element);
+    HalfmRpt *halfmRpt = vrv_cast<HalfmRpt *>(element);
     assert(halfmRpt);
 
     int x = halfmRpt->GetDrawingX();
@@ -907,7 +907,7 @@ void View::DrawKeySig(DeviceContext *dc, LayerElement *element, Layer *layer, St
     assert(staff);
     assert(measure);
 
-    KeySig *keySig = dynamic_cast<KeySig *>(element);
+    KeySig *keySig = vrv_cast<KeySig *>(element);
     assert(keySig);
 
     int x, y, i;
@@ -1032,7 +1032,7 @@ void View::DrawMeterSig(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(staff);
     assert(measure);
 
-    MeterSig *meterSig = dynamic_cast<MeterSig *>(element);
+    MeterSig *meterSig = vrv_cast<MeterSig *>(element);
     assert(meterSig);
 
     dc->StartGraphic(element, "", element->GetUuid());
@@ -1069,7 +1069,7 @@ void View::DrawMRest(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    MRest *mRest = dynamic_cast<MRest *>(element);
+    MRest *mRest = vrv_cast<MRest *>(element);
     assert(mRest);
 
     dc->StartGraphic(element, "", element->GetUuid());
@@ -1098,7 +1098,7 @@ void View::DrawMRpt(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    MRpt *mRpt = dynamic_cast<MRpt *>(element);
+    MRpt *mRpt = vrv_cast<MRpt *>(element);
     assert(mRpt);
 
     mRpt->CenterDrawingX();
@@ -1118,7 +1118,7 @@ void View::DrawMRpt2(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    MRpt2 *mRpt2 = dynamic_cast<MRpt2 *>(element);
+    MRpt2 *mRpt2 = vrv_cast<MRpt2 *>(element);
     assert(mRpt2);
 
     mRpt2->CenterDrawingX();
@@ -1138,7 +1138,7 @@ void View::DrawMultiRest(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(staff);
     assert(measure);
 
-    MultiRest *multiRest = dynamic_cast<MultiRest *>(element);
+    MultiRest *multiRest = vrv_cast<MultiRest *>(element);
     assert(multiRest);
 
     multiRest->CenterDrawingX();
@@ -1218,7 +1218,7 @@ void View::DrawMultiRpt(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(staff);
     assert(measure);
 
-    MultiRpt *multiRpt = dynamic_cast<MultiRpt *>(element);
+    MultiRpt *multiRpt = vrv_cast<MultiRpt *>(element);
     assert(multiRpt);
 
     multiRpt->CenterDrawingX();
@@ -1240,7 +1240,7 @@ void View::DrawNote(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Note *note = dynamic_cast<Note *>(element);
+    Note *note = vrv_cast<Note *>(element);
     assert(note);
 
     if (note->IsMensural()) {
@@ -1296,7 +1296,7 @@ void View::DrawRest(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Rest *rest = dynamic_cast<Rest *>(element);
+    Rest *rest = vrv_cast<Rest *>(element);
     assert(rest);
 
     if (rest->IsMensural()) {
@@ -1348,7 +1348,7 @@ void View::DrawStem(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Stem *stem = dynamic_cast<Stem *>(element);
+    Stem *stem = vrv_cast<Stem *>(element);
     assert(stem);
 
     // Do not draw virtual (e.g., whole note) stems
@@ -1373,7 +1373,7 @@ void View::DrawStem(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
 
 void View::DrawSyl(DeviceContext *dc, LayerElement *element, Layer *layer, Staff *staff, Measure *measure)
 {
-    Syl *syl = dynamic_cast<Syl *>(element);
+    Syl *syl = vrv_cast<Syl *>(element);
     assert(syl);
 
     bool isNeume = (staff->m_drawingNotationType == NOTATIONTYPE_neume);
@@ -1428,7 +1428,7 @@ void View::DrawSyl(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
     dc->ResetBrush();
 
     if (syl->GetStart() && syl->GetEnd()) {
-        System *currentSystem = dynamic_cast<System *>(measure->GetFirstAncestor(SYSTEM));
+        System *currentSystem = vrv_cast<System *>(measure->GetFirstAncestor(SYSTEM));
         // Postpone the drawing of the syl to the end of the system; this will call DrawSylConnector
         // that will look if the last note is in the same system (or not) and draw the connectors accordingly
         if (currentSystem) {
@@ -1448,7 +1448,7 @@ void View::DrawVerse(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    Verse *verse = dynamic_cast<Verse *>(element);
+    Verse *verse = vrv_cast<Verse *>(element);
     assert(verse);
 
     dc->StartGraphic(verse, "", verse->GetUuid());
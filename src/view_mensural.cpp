@@ -29,8 +29,8 @@
 
 namespace vrv {
 
-int View::s_drawingLigX[2], View::s_drawingLigY[2]; // to keep coords. of ligatures
-bool View::s_drawingLigObliqua = false; // mark the first pass for an oblique
+thread_local int View::s_drawingLigX[2], View::s_drawingLigY[2]; // to keep coords. of ligatures
+thread_local bool View::s_drawingLigObliqua = false; // mark the first pass for an oblique
 
 //----------------------------------------------------------------------------
 // View - Mensural
@@ -44,7 +44,7 @@ void View::DrawMensuralNote(DeviceContext *dc, LayerElement *element, Layer *lay
     assert(staff);
     assert(measure);
 
-    Note *note = dynamic_cast<Note *>(element);
+    Note *note = vrv_cast<Note *>(element);
     assert(note);
 
     int yNote = element->GetDrawingY();
@@ -108,7 +108,7 @@ void View::DrawMensuralRest(DeviceContext *dc, LayerElement *element, Layer *lay
 
     wchar_t charCode;
 
-    Rest *rest = dynamic_cast<Rest *>(element);
+    Rest *rest = vrv_cast<Rest *>(element);
     assert(rest);
 
     bool drawingCueSize = rest->GetDrawingCueSize();
@@ -138,7 +138,7 @@ void View::DrawMensur(DeviceContext *dc, LayerElement *element, Layer *layer, St
     assert(staff);
     assert(measure);
 
-    Mensur *mensur = dynamic_cast<Mensur *>(element);
+    Mensur *mensur = vrv_cast<Mensur *>(element);
     assert(mensur);
 
     dc->StartGraphic(element, "", element->GetUuid());
@@ -343,7 +343,7 @@ void View::DrawMaximaToBrevis(DeviceContext *dc, int y, LayerElement *element, L
     assert(layer);
     assert(staff);
 
-    Note *note = dynamic_cast<Note *>(element);
+    Note *note = vrv_cast<Note *>(element);
     assert(note);
 
     int xLeft, xRight, yTop, yBottom, y3, y4;
@@ -417,7 +417,7 @@ void View::DrawLigature(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(layer);
     assert(staff);
 
-    Ligature *ligature = dynamic_cast<Ligature *>(element);
+    Ligature *ligature = vrv_cast<Ligature *>(element);
     assert(ligature);
 
     dc->StartGraphic(ligature, "", ligature->GetUuid());
@@ -435,10 +435,10 @@ void View::DrawLigatureNote(DeviceContext *dc, LayerElement *element, Layer *lay
     assert(layer);
     assert(staff);
 
-    Note *note = dynamic_cast<Note *>(element);
+    Note *note = vrv_cast<Note *>(element);
     assert(note);
 
-    Ligature *ligature = dynamic_cast<Ligature *>(note->GetFirstAncestor(LIGATURE));
+    Ligature *ligature = vrv_cast<Ligature *>(note->GetFirstAncestor(LIGATURE));
     assert(ligature);
 
     Note *firstNote = ligature->GetFirstNote();
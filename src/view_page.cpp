@@ -60,6 +60,8 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     assert(dc);
     assert(m_doc);
 
+    dc->SetResources(&m_doc->GetResources());
+
     m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
 
     int i;
@@ -103,37 +105,7 @@ void View::SetScoreDefDrawingWidth(DeviceContext *dc, ScoreDef *scoreDef)
     assert(dc);
     assert(scoreDef);
 
-    char numAlteration = 0;
-
-    // key signature of the scoreDef
-    if (scoreDef->HasKeySigInfo()) {
-        KeySig *keySig = scoreDef->GetKeySig();
-        assert(keySig);
-        numAlteration = (keySig->GetAccidCount() > numAlteration) ? keySig->GetAccidCount() : numAlteration;
-    }
-
-    // longest key signature of the staffDefs
-    const ArrayOfObjects *scoreDefList = scoreDef->GetList(scoreDef); // make sure it's initialized
-    for (ArrayOfObjects::const_iterator it = scoreDefList->begin(); it != scoreDefList->end(); ++it) {
-        StaffDef *staffDef = dynamic_cast<StaffDef *>(*it);
-        assert(staffDef);
-        if (!staffDef->HasKeySigInfo()) continue;
-        KeySig *keySig = staffDef->GetKeySig();
-        assert(keySig);
-        numAlteration = (keySig->GetAccidCount() > numAlteration) ? keySig->GetAccidCount() : numAlteration;
-    }
-
-    int width = 0;
-    // G-clef as default width
-    width += m_doc->GetLeftMargin(CLEF) + m_doc->GetGlyphWidth(SMUFL_E050_gClef, 100, false)
-        + m_doc->GetRightMargin(CLEF);
-    if (numAlteration > 0) {
-        width += m_doc->GetLeftMargin(KEYSIG)
-            + m_doc->GetGlyphWidth(SMUFL_E262_accidentalSharp, 100, false) * TEMP_KEYSIG_STEP
-            + m_doc->GetRightMargin(KEYSIG);
-    }
-
-    scoreDef->SetDrawingWidth(width);
+    scoreDef->SetDrawingWidth(scoreDef->CalcDrawingWidth(m_doc));
 }
 
 //----------------------------------------------------------------------------
@@ -147,7 +119,7 @@ void View::DrawSystem(DeviceContext *dc, System *system)
 
     dc->StartGraphic(system, "", system->GetUuid());
 
-    Measure *firstMeasure = dynamic_cast<Measure *>(system->FindDescendantByType(MEASURE, 1));
+    Measure *firstMeasure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1));
 
     // Draw system divider (from the second one) if scoreDef is optimized
     if (firstMeasure && (m_options->m_systemDivider.GetValue() != SYSTEMDIVIDER_none)) {
@@ -173,7 +145,7 @@ void View::DrawSystem(DeviceContext *dc, System *system)
             if (m_options->m_systemDivider.GetValue() == SYSTEMDIVIDER_left_right) {
                 // Right divider is not taken into account in the layout calculation and can collision with the music
                 // content
-                Measure *lastMeasure = dynamic_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, BACKWARD));
+                Measure *lastMeasure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, BACKWARD));
                 assert(lastMeasure);
                 int x4 = lastMeasure->GetDrawingX() + lastMeasure->GetRightBarLineRight();
                 int x3 = x4 - m_doc->GetDrawingUnit(100) * 6;
@@ -250,7 +222,7 @@ void View::DrawSystemList(DeviceContext *dc, System *system, const ClassId class
         }
         if ((*iter)->Is(classId) && (classId == ENDING)) {
             // cast to Ending check in DrawEnding
-            DrawEnding(dc, dynamic_cast<Ending *>(*iter), system);
+            DrawEnding(dc, vrv_cast<Ending *>(*iter), system);
         }
     }
 }
@@ -263,7 +235,7 @@ void View::DrawScoreDef(
     // we need at least one measure to be able to draw the groups - we need access to the staff elements,
     assert(measure);
 
-    StaffGrp *staffGrp = dynamic_cast<StaffGrp *>(scoreDef->FindDescendantByType(STAFFGRP));
+    StaffGrp *staffGrp = vrv_cast<StaffGrp *>(scoreDef->FindDescendantByType(STAFFGRP));
     if (!staffGrp) {
         return;
     }
@@ -306,7 +278,7 @@ void View::DrawStaffGrp(
     StaffDef *firstDef = NULL;
     ArrayOfObjects::const_iterator iter;
     for (iter = staffDefs->begin(); iter != staffDefs->end(); ++iter) {
-        StaffDef *staffDef = dynamic_cast<StaffDef *>(*iter);
+        StaffDef *staffDef = vrv_cast<StaffDef *>(*iter);
         assert(staffDef);
         if (staffDef->GetDrawingVisibility() != OPTIMIZATION_HIDDEN) {
             firstDef = staffDef;
@@ -317,7 +289,7 @@ void View::DrawStaffGrp(
     StaffDef *lastDef = NULL;
     ArrayOfObjects::const_reverse_iterator riter;
     for (riter = staffDefs->rbegin(); riter != staffDefs->rend(); ++riter) {
-        StaffDef *staffDef = dynamic_cast<StaffDef *>(*riter);
+        StaffDef *staffDef = vrv_cast<StaffDef *>(*riter);
         assert(staffDef);
         if (staffDef->GetDrawingVisibility() != OPTIMIZATION_HIDDEN) {
             lastDef = staffDef;
@@ -358,7 +330,7 @@ void View::DrawStaffGrp(
     int xLabel = x - space;
     int yLabel = yBottom - (yBottom - yTop) / 2 - m_doc->GetDrawingUnit(100);
 
-    System *system = dynamic_cast<System *>(measure->GetFirstAncestor(SYSTEM));
+    System *system = vrv_cast<System *>(measure->GetFirstAncestor(SYSTEM));
 
     this->DrawLabels(dc, measure, system, staffGrp, xLabel, yLabel, abbreviations, 100, space);
 
@@ -418,7 +390,7 @@ void View::DrawStaffDefLabels(DeviceContext *dc, Measure *measure, ScoreDef *sco
 
         AttNIntegerComparison comparison(STAFF, staffDef->GetN());
         Staff *staff = dynamic_cast<Staff *>(measure->FindDescendantByComparison(&comparison, 1));
-        System *system = dynamic_cast<System *>(measure->GetFirstAncestor(SYSTEM));
+        System *system = vrv_cast<System *>(measure->GetFirstAncestor(SYSTEM));
 
         if (!staff || !system) {
             LogDebug("Staff or System missing in View::DrawStaffDefLabels");
@@ -454,8 +426,8 @@ void View::DrawLabels(DeviceContext *dc, Measure *measure, System *system, Objec
     assert(system);
     assert(object->Is({ STAFFDEF, STAFFGRP }));
 
-    Label *label = dynamic_cast<Label *>(object->FindDescendantByType(LABEL, 1));
-    LabelAbbr *labelAbbr = dynamic_cast<LabelAbbr *>(object->FindDescendantByType(LABELABBR, 1));
+    Label *label = vrv_cast<Label *>(object->FindDescendantByType(LABEL, 1));
+    LabelAbbr *labelAbbr = vrv_cast<LabelAbbr *>(object->FindDescendantByType(LABELABBR, 1));
     Object *graphic = label;
 
     std::wstring labelStr = (label) ? label->GetText(label) : L"";
@@ -653,17 +625,18 @@ void View::DrawBarLines(DeviceContext *dc, Measure *measure, StaffGrp *staffGrp,
     if (staffGrp->GetBarThru() != BOOLEAN_true) {
         // recursively draw the children (staffDef or staffGrp) - we assume @barthru is false by default
         int i;
-        StaffGrp *childStaffGrp = NULL;
-        StaffDef *childStaffDef = NULL;
         for (i = 0; i < staffGrp->GetChildCount(); ++i) {
-            childStaffGrp = dynamic_cast<StaffGrp *>(staffGrp->GetChild(i));
-            childStaffDef = dynamic_cast<StaffDef *>(staffGrp->GetChild(i));
-            if (childStaffGrp) {
+            Object *child = staffGrp->GetChild(i);
+            if (child->Is(STAFFGRP)) {
+                StaffGrp *childStaffGrp = vrv_cast<StaffGrp *>(child);
+                assert(childStaffGrp);
                 DrawBarLines(dc, measure, childStaffGrp, barLine, isLastMeasure);
             }
-            else if (childStaffDef) {
+            else if (child->Is(STAFFDEF)) {
+                StaffDef *childStaffDef = vrv_cast<StaffDef *>(child);
+                assert(childStaffDef);
                 AttNIntegerComparison comparison(STAFF, childStaffDef->GetN());
-                Staff *staff = dynamic_cast<Staff *>(measure->FindDescendantByComparison(&comparison, 1));
+                Staff *staff = vrv_cast<Staff *>(measure->FindDescendantByComparison(&comparison, 1));
                 if (!staff) {
                     LogDebug("Could not get staff (%d) while drawing staffGrp - DrawBarLines", childStaffDef->GetN());
                     continue;
@@ -703,7 +676,7 @@ void View::DrawBarLines(DeviceContext *dc, Measure *measure, StaffGrp *staffGrp,
         StaffDef *firstDef = NULL;
         ArrayOfObjects::const_iterator iter;
         for (iter = staffDefs->begin(); iter != staffDefs->end(); ++iter) {
-            StaffDef *staffDef = dynamic_cast<StaffDef *>(*iter);
+            StaffDef *staffDef = vrv_cast<StaffDef *>(*iter);
             assert(staffDef);
             if (staffDef->GetDrawingVisibility() != OPTIMIZATION_HIDDEN) {
                 firstDef = staffDef;
@@ -714,7 +687,7 @@ void View::DrawBarLines(DeviceContext *dc, Measure *measure, StaffGrp *staffGrp,
         StaffDef *lastDef = NULL;
         ArrayOfObjects::const_reverse_iterator riter;
         for (riter = staffDefs->rbegin(); riter != staffDefs->rend(); ++riter) {
-            StaffDef *staffDef = dynamic_cast<StaffDef *>(*riter);
+            StaffDef *staffDef = vrv_cast<StaffDef *>(*riter);
             assert(staffDef);
             if (staffDef->GetDrawingVisibility() != OPTIMIZATION_HIDDEN) {
                 lastDef = staffDef;
@@ -760,7 +733,7 @@ void View::DrawBarLines(DeviceContext *dc, Measure *measure, StaffGrp *staffGrp,
                 childStaffDef = dynamic_cast<StaffDef *>((*it));
                 if (childStaffDef) {
                     AttNIntegerComparison comparison(STAFF, childStaffDef->GetN());
-                    Staff *staff = dynamic_cast<Staff *>(measure->FindDescendantByComparison(&comparison, 1));
+                    Staff *staff = vrv_cast<Staff *>(measure->FindDescendantByComparison(&comparison, 1));
                     if (!staff) {
                         LogDebug(
                             "Could not get staff (%d) while drawing staffGrp - DrawBarLines", childStaffDef->GetN());
@@ -778,7 +751,7 @@ void View::DrawBarLine(DeviceContext *dc, int yTop, int yBottom, BarLine *barLin
     assert(dc);
     assert(barLine);
 
-    Staff *staff = dynamic_cast<Staff *>(barLine->GetFirstAncestor(STAFF));
+    Staff *staff = vrv_cast<Staff *>(barLine->GetFirstAncestor(STAFF));
     int staffSize = (staff) ? staff->m_drawingStaffSize : 100;
 
     int x = barLine->GetDrawingX();
@@ -794,7 +767,7 @@ void View::DrawBarLine(DeviceContext *dc, int yTop, int yBottom, BarLine *barLin
     SegmentedLine line(yTop, yBottom);
     // We do not need to do this during layout calculation
     if (eraseIntersections && !dc->Is(BBOX_DEVICE_CONTEXT)) {
-        System *system = dynamic_cast<System *>(barLine->GetFirstAncestor(SYSTEM));
+        System *system = vrv_cast<System *>(barLine->GetFirstAncestor(SYSTEM));
         if (system) {
             int minX = x1 - barLineWidth / 2;
             int maxX = x1 + barLineWidth / 2;
@@ -912,10 +885,12 @@ void View::DrawMeasure(DeviceContext *dc, Measure *measure, System *system)
     }
 
     if (m_drawingScoreDef.GetMnumVisible() != BOOLEAN_false) {
-        MNum *mnum = dynamic_cast<MNum *>(measure->FindDescendantByType(MNUM));
+        // The measure number comes after the staves (generated ones are appended), so look for it backwards instead
+        // of going through the whole content of the measure
+        MNum *mnum = vrv_cast<MNum *>(measure->FindDescendantByType(MNUM, UNLIMITED_DEPTH, BACKWARD));
         if (mnum) {
             // this should be an option
-            Measure *systemStart = dynamic_cast<Measure *>(system->FindDescendantByType(MEASURE));
+            Measure *systemStart = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE));
             // Draw non-generated measure numbers, and system starting measure numbers > 1.
             if ((measure == systemStart && measure->GetN() != "0" && measure->GetN() != "1") || !mnum->IsGenerated()) {
                 DrawMNum(dc, mnum, measure);
@@ -927,7 +902,7 @@ void View::DrawMeasure(DeviceContext *dc, Measure *measure, System *system)
 
     // Draw the barlines only with measured music
     if (measure->IsMeasuredMusic()) {
-        System *system = dynamic_cast<System *>(measure->GetFirstAncestor(SYSTEM));
+        System *system = vrv_cast<System *>(measure->GetFirstAncestor(SYSTEM));
         assert(system);
         if (measure->GetDrawingLeftBarLine() != BARRENDITION_NONE) {
             DrawScoreDef(dc, system->GetDrawingScoreDef(), measure, measure->GetLeftBarLine()->GetDrawingX(),
@@ -1138,7 +1113,7 @@ void View::DrawStaffDef(DeviceContext *dc, Staff *staff, Measure *measure)
     assert(measure);
 
     // StaffDef information is always in the first layer
-    Layer *layer = dynamic_cast<Layer *>(staff->FindDescendantByType(LAYER));
+    Layer *layer = vrv_cast<Layer *>(staff->FindDescendantByType(LAYER));
     if (!layer || !layer->HasStaffDef()) return;
 
     // StaffDef staffDef;
@@ -1168,7 +1143,7 @@ void View::DrawStaffDefCautionary(DeviceContext *dc, Staff *staff, Measure *meas
     assert(measure);
 
     // StaffDef cautionary information is always in the first layer
-    Layer *layer = dynamic_cast<Layer *>(staff->FindDescendantByType(LAYER));
+    Layer *layer = vrv_cast<Layer *>(staff->FindDescendantByType(LAYER));
     if (!layer || !layer->HasCautionStaffDef()) return;
 
     // StaffDef staffDef;
@@ -1203,7 +1178,7 @@ int View::CalculatePitchCode(Layer *layer, int y_n, int x_pos, int *octave)
     assert(layer);
     assert(octave);
 
-    Staff *parentStaff = dynamic_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+    Staff *parentStaff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
     assert(parentStaff); // Pointer to parent has to be a staff
 
     static int touches[]
@@ -1278,10 +1253,10 @@ void View::DrawLayerList(DeviceContext *dc, Layer *layer, Staff *staff, Measure
 
     for (iter = drawingList->begin(); iter != drawingList->end(); ++iter) {
         if ((*iter)->Is(classId) && (classId == TUPLET_BRACKET)) {
-            DrawTupletBracket(dc, dynamic_cast<LayerElement *>(*iter), layer, staff, measure);
+            DrawTupletBracket(dc, vrv_cast<LayerElement *>(*iter), layer, staff, measure);
         }
         if ((*iter)->Is(classId) && (classId == TUPLET_NUM)) {
-            DrawTupletNum(dc, dynamic_cast<LayerElement *>(*iter), layer, staff, measure);
+            DrawTupletNum(dc, vrv_cast<LayerElement *>(*iter), layer, staff, measure);
         }
     }
 }
@@ -1299,22 +1274,22 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
     for (auto current : *parent->GetChildren()) {
         if (current->Is(MEASURE)) {
             // cast to Measure check in DrawMeasure
-            DrawMeasure(dc, dynamic_cast<Measure *>(current), system);
+            DrawMeasure(dc, vrv_cast<Measure *>(current), system);
         }
         // scoreDef are not drawn directly, but anything else should not be possible
         else if (current->Is(SCOREDEF)) {
             // nothing to do, then
-            ScoreDef *scoreDef = dynamic_cast<ScoreDef *>(current);
+            ScoreDef *scoreDef = vrv_cast<ScoreDef *>(current);
             assert(scoreDef);
             SetScoreDefDrawingWidth(dc, scoreDef);
         }
         else if (current->IsSystemElement()) {
             // cast to EditorialElement check in DrawSystemEditorial element
-            DrawSystemElement(dc, dynamic_cast<SystemElement *>(current), system);
+            DrawSystemElement(dc, vrv_cast<SystemElement *>(current), system);
         }
         else if (current->IsEditorialElement()) {
             // cast to EditorialElement check in DrawSystemEditorial element
-            DrawSystemEditorialElement(dc, dynamic_cast<EditorialElement *>(current), system);
+            DrawSystemEditorialElement(dc, vrv_cast<EditorialElement *>(current), system);
         }
         else {
             assert(false);
@@ -1332,15 +1307,15 @@ void View::DrawMeasureChildren(DeviceContext *dc, Object *parent, Measure *measu
     for (auto current : *parent->GetChildren()) {
         if (current->Is(STAFF)) {
             // cast to Staff check in DrawStaff
-            DrawStaff(dc, dynamic_cast<Staff *>(current), measure, system);
+            DrawStaff(dc, vrv_cast<Staff *>(current), measure, system);
         }
         else if (current->IsControlElement()) {
             // cast to ControlElement check in DrawControlElement
-            DrawControlElement(dc, dynamic_cast<ControlElement *>(current), measure, system);
+            DrawControlElement(dc, vrv_cast<ControlElement *>(current), measure, system);
         }
         else if (current->IsEditorialElement()) {
             // cast to EditorialElement check in DrawMeasureEditorialElement
-            DrawMeasureEditorialElement(dc, dynamic_cast<EditorialElement *>(current), measure, system);
+            DrawMeasureEditorialElement(dc, vrv_cast<EditorialElement *>(current), measure, system);
         }
         else {
             LogDebug("Current is %s", current->GetClassName().c_str());
@@ -1359,11 +1334,11 @@ void View::DrawStaffChildren(DeviceContext *dc, Object *parent, Staff *staff, Me
     for (auto current : *parent->GetChildren()) {
         if (current->Is(LAYER)) {
             // cast to Layer check in DrawLayer
-            DrawLayer(dc, dynamic_cast<Layer *>(current), staff, measure);
+            DrawLayer(dc, vrv_cast<Layer *>(current), staff, measure);
         }
         else if (current->IsEditorialElement()) {
             // cast to EditorialElement check in DrawStaffEditorialElement
-            DrawStaffEditorialElement(dc, dynamic_cast<EditorialElement *>(current), staff, measure);
+            DrawStaffEditorialElement(dc, vrv_cast<EditorialElement *>(current), staff, measure);
         }
         else {
             assert(false);
@@ -1381,11 +1356,11 @@ void View::DrawLayerChildren(DeviceContext *dc, Object *parent, Layer *layer, St
 
     for (auto current : *parent->GetChildren()) {
         if (current->IsLayerElement()) {
-            DrawLayerElement(dc, dynamic_cast<LayerElement *>(current), layer, staff, measure);
+            DrawLayerElement(dc, vrv_cast<LayerElement *>(current), layer, staff, measure);
         }
         else if (current->IsEditorialElement()) {
             // cast to EditorialElement check in DrawLayerEditorialElement
-            DrawLayerEditorialElement(dc, dynamic_cast<EditorialElement *>(current), layer, staff, measure);
+            DrawLayerEditorialElement(dc, vrv_cast<EditorialElement *>(current), layer, staff, measure);
         }
         else {
             assert(false);
@@ -1400,11 +1375,11 @@ void View::DrawTextChildren(DeviceContext *dc, Object *parent, TextDrawingParams
 
     for (auto current : *parent->GetChildren()) {
         if (current->IsTextElement()) {
-            DrawTextElement(dc, dynamic_cast<TextElement *>(current), params);
+            DrawTextElement(dc, vrv_cast<TextElement *>(current), params);
         }
         else if (current->IsEditorialElement()) {
             // cast to EditorialElement check in DrawTextEditorialElement
-            DrawTextEditorialElement(dc, dynamic_cast<EditorialElement *>(current), params);
+            DrawTextEditorialElement(dc, vrv_cast<EditorialElement *>(current), params);
         }
         else {
             assert(false);
@@ -1419,11 +1394,11 @@ void View::DrawFbChildren(DeviceContext *dc, Object *parent, TextDrawingParams &
 
     for (auto current : *parent->GetChildren()) {
         if (current->IsTextElement()) {
-            DrawTextElement(dc, dynamic_cast<TextElement *>(current), params);
+            DrawTextElement(dc, vrv_cast<TextElement *>(current), params);
         }
         else if (current->IsEditorialElement()) {
             // cast to EditorialElement check in DrawLayerEditorialElement
-            DrawFbEditorialElement(dc, dynamic_cast<EditorialElement *>(current), params);
+            DrawFbEditorialElement(dc, vrv_cast<EditorialElement *>(current), params);
         }
         else {
             assert(false);
@@ -1438,18 +1413,18 @@ void View::DrawRunningChildren(DeviceContext *dc, Object *parent, TextDrawingPar
 
     for (auto current : *parent->GetChildren()) {
         if (current->Is(FIG)) {
-            DrawFig(dc, dynamic_cast<Fig *>(current), params);
+            DrawFig(dc, vrv_cast<Fig *>(current), params);
         }
         else if (current->IsTextElement()) {
             // We are now reaching a text element - start set only here because we can have a figure
             TextDrawingParams paramsChild = params;
             dc->StartText(ToDeviceContextX(params.m_x), ToDeviceContextY(params.m_y), HORIZONTALALIGNMENT_left);
-            DrawTextElement(dc, dynamic_cast<TextElement *>(current), paramsChild);
+            DrawTextElement(dc, vrv_cast<TextElement *>(current), paramsChild);
             dc->EndText();
         }
         else if (current->IsEditorialElement()) {
             // cast to EditorialElement check in DrawLayerEditorialElement
-            DrawRunningEditorialElement(dc, dynamic_cast<EditorialElement *>(current), params);
+            DrawRunningEditorialElement(dc, vrv_cast<EditorialElement *>(current), params);
         }
         else {
             assert(false);
@@ -1623,7 +1598,7 @@ void View::DrawAnnot(DeviceContext *dc, EditorialElement *element, bool isTextEl
         dc->StartGraphic(element, "", element->GetUuid());
     }
 
-    Annot *annot = dynamic_cast<Annot *>(element);
+    Annot *annot = vrv_cast<Annot *>(element);
     assert(annot);
     dc->AddDescription(UTF16to8(annot->GetText(annot)));
 
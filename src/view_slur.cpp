@@ -45,7 +45,7 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
 
     FloatingPositioner *positioner = slur->GetCurrentFloatingPositioner();
     assert(positioner && positioner->Is(FLOATING_CURVE_POSITIONER));
-    FloatingCurvePositioner *curve = dynamic_cast<FloatingCurvePositioner *>(positioner);
+    FloatingCurvePositioner *curve = vrv_cast<FloatingCurvePositioner *>(positioner);
     assert(curve);
 
     if (curve->GetDir() == curvature_CURVEDIR_NONE) {
@@ -118,24 +118,24 @@ void View::DrawSlurInitial(FloatingCurvePositioner *curve, Slur *slur, int x1, i
     }
 
     if (start->Is(NOTE)) {
-        startNote = dynamic_cast<Note *>(start);
+        startNote = vrv_cast<Note *>(start);
         assert(startNote);
         startParentChord = startNote->IsChordTone();
         startStemDir = startNote->GetDrawingStemDir();
     }
     else if (start->Is(CHORD)) {
-        startChord = dynamic_cast<Chord *>(start);
+        startChord = vrv_cast<Chord *>(start);
         assert(startChord);
         startStemDir = startChord->GetDrawingStemDir();
     }
     if (end->Is(NOTE)) {
-        endNote = dynamic_cast<Note *>(end);
+        endNote = vrv_cast<Note *>(end);
         assert(endNote);
         endParentChord = endNote->IsChordTone();
         endStemDir = endNote->GetDrawingStemDir();
     }
     else if (end->Is(CHORD)) {
-        endChord = dynamic_cast<Chord *>(end);
+        endChord = vrv_cast<Chord *>(end);
         assert(endChord);
         endStemDir = endChord->GetDrawingStemDir();
     }
@@ -148,17 +148,17 @@ void View::DrawSlurInitial(FloatingCurvePositioner *curve, Slur *slur, int x1, i
     LayerElement *layerElement = NULL;
     // For now, with timestamps, get the first layer. We should eventually look at the @layerident (not implemented)
     if (!start->Is(TIMESTAMP_ATTR)) {
-        layer = dynamic_cast<Layer *>(start->GetFirstAncestor(LAYER));
+        layer = vrv_cast<Layer *>(start->GetFirstAncestor(LAYER));
         layerElement = start;
     }
     else {
-        layer = dynamic_cast<Layer *>(end->GetFirstAncestor(LAYER));
+        layer = vrv_cast<Layer *>(end->GetFirstAncestor(LAYER));
         layerElement = end;
     }
     assert(layer);
 
     if (!start->Is(TIMESTAMP_ATTR) && !end->Is(TIMESTAMP_ATTR) && (spanningType == SPANNING_START_END)) {
-        System *system = dynamic_cast<System *>(staff->GetFirstAncestor(SYSTEM));
+        System *system = vrv_cast<System *>(staff->GetFirstAncestor(SYSTEM));
         assert(system);
         // If we have a start to end situation, then store the curvedir in the slur for mixed drawing stem dir
         // situations
@@ -435,7 +435,7 @@ void View::DrawSlurInitial(FloatingCurvePositioner *curve, Slur *slur, int x1, i
         start->FindAllDescendantByComparison(&artics, &matchType);
         // Then the @n of each first staffDef
         for (articIter = artics.begin(); articIter != artics.end(); ++articIter) {
-            Artic *artic = dynamic_cast<Artic *>(*articIter);
+            Artic *artic = vrv_cast<Artic *>(*articIter);
             assert(artic);
             ArticPart *outsidePart = artic->GetOutsidePart();
             if (outsidePart) {
@@ -453,7 +453,7 @@ void View::DrawSlurInitial(FloatingCurvePositioner *curve, Slur *slur, int x1, i
         end->FindAllDescendantByComparison(&artics, &matchType);
         // Then the @n of each first staffDef
         for (articIter = artics.begin(); articIter != artics.end(); ++articIter) {
-            Artic *artic = dynamic_cast<Artic *>(*articIter);
+            Artic *artic = vrv_cast<Artic *>(*articIter);
             assert(artic);
             ArticPart *outsidePart = artic->GetOutsidePart();
             if (outsidePart) {
@@ -497,7 +497,7 @@ float View::CalcInitialSlur(
 
     /************** content **************/
 
-    System *system = dynamic_cast<System *>(staff->GetFirstAncestor(SYSTEM));
+    System *system = vrv_cast<System *>(staff->GetFirstAncestor(SYSTEM));
     assert(system);
     FindSpannedLayerElementsParams findSpannedLayerElementsParams(slur, slur);
     findSpannedLayerElementsParams.m_minPos = p1.x;
@@ -512,7 +512,7 @@ float View::CalcInitialSlur(
     filters.push_back(&matchStaff);
     filters.push_back(&matchLayer);
 
-    Functor findSpannedLayerElements(&Object::FindSpannedLayerElements);
+    Functor findSpannedLayerElements(&Object::FindSpannedLayerElements, "FindSpannedLayerElements");
     system->Process(&findSpannedLayerElements, &findSpannedLayerElementsParams, NULL, &filters);
 
     curve->ClearSpannedElements();
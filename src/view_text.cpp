@@ -48,7 +48,7 @@ void View::DrawF(DeviceContext *dc, F *f, TextDrawingParams &params)
     DrawTextChildren(dc, f, params);
 
     if (f->GetStart() && f->GetEnd()) {
-        System *currentSystem = dynamic_cast<System *>(f->GetFirstAncestor(SYSTEM));
+        System *currentSystem = vrv_cast<System *>(f->GetFirstAncestor(SYSTEM));
         // Postpone the drawing of the end of the system; this will call DrawFConnector
         if (currentSystem) {
             currentSystem->AddToDrawingList(f);
@@ -167,27 +167,27 @@ void View::DrawTextElement(DeviceContext *dc, TextElement *element, TextDrawingP
     assert(element);
 
     if (element->Is(FIGURE)) {
-        F *f = dynamic_cast<F *>(element);
+        F *f = vrv_cast<F *>(element);
         assert(f);
         DrawF(dc, f, params);
     }
     else if (element->Is(LB)) {
-        Lb *lb = dynamic_cast<Lb *>(element);
+        Lb *lb = vrv_cast<Lb *>(element);
         assert(lb);
         DrawLb(dc, lb, params);
     }
     else if (element->Is(NUM)) {
-        Num *num = dynamic_cast<Num *>(element);
+        Num *num = vrv_cast<Num *>(element);
         assert(num);
         DrawNum(dc, num, params);
     }
     else if (element->Is(REND)) {
-        Rend *rend = dynamic_cast<Rend *>(element);
+        Rend *rend = vrv_cast<Rend *>(element);
         assert(rend);
         DrawRend(dc, rend, params);
     }
     else if (element->Is(TEXT)) {
-        Text *text = dynamic_cast<Text *>(element);
+        Text *text = vrv_cast<Text *>(element);
         assert(text);
         DrawText(dc, text, params);
     }
@@ -257,7 +257,7 @@ void View::DrawFig(DeviceContext *dc, Fig *fig, TextDrawingParams &params)
 
     dc->StartGraphic(fig, "", fig->GetUuid());
 
-    Svg *svg = dynamic_cast<Svg *>(fig->FindDescendantByType(SVG));
+    Svg *svg = vrv_cast<Svg *>(fig->FindDescendantByType(SVG));
     if (svg) {
         params.m_x = fig->GetDrawingX();
         params.m_y = fig->GetDrawingY();
@@ -367,7 +367,7 @@ void View::DrawText(DeviceContext *dc, Text *text, TextDrawingParams &params)
 
     // special case where we want to replace the '#' or 'b' with a VerovioText glyphs
     if (text->GetFirstAncestor(DYNAM)) {
-        DrawDynamString(dc, text->GetText(), params, dynamic_cast<Rend *>(text->GetFirstAncestor(REND)));
+        DrawDynamString(dc, text->GetText(), params, vrv_cast<Rend *>(text->GetFirstAncestor(REND)));
     }
     else if (text->GetFirstAncestor(HARM)) {
         DrawHarmString(dc, text->GetText(), params);
@@ -11,11 +11,15 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <chrono>
 #include <cmath>
+#include <fstream>
+#include <mutex>
 #include <sstream>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/stat.h>
 #include <vector>
 
 #ifndef _WIN32
@@ -60,9 +64,46 @@ namespace vrv {
 // Static members with some default values
 //----------------------------------------------------------------------------
 
-std::string Resources::m_path = "/usr/local/share/verovio";
-std::map<wchar_t, Glyph> Resources::m_font;
-std::map<wchar_t, Glyph> Resources::m_textFont;
+std::string Resources::s_defaultPath = "/usr/local/share/verovio";
+
+/** The header of the binary font bundles (see Resources::WriteFontBundle) */
+struct FontBundleHeader {
+    char m_magic[8];
+    uint32_t m_version;
+    uint32_t m_byteOrder;
+    uint32_t m_glyphCount;
+};
+
+#define FONT_BUNDLE_MAGIC "VRVFONT"
+#define FONT_BUNDLE_VERSION 1
+#define FONT_BUNDLE_BYTE_ORDER 0x01020304
+
+/** The modification time of a file or a directory, or 0 if it does not exist */
+static time_t GetModificationTime(const std::string &filename)
+{
+    struct stat info;
+    if (stat(filename.c_str(), &info) != 0) return 0;
+    return info.st_mtime;
+}
+
+/** The glyph tables shared by all Resources instances, with the font directory as key */
+static std::map<std::string, std::shared_ptr<const Resources::GlyphTable>> s_glyphTables;
+static std::mutex s_glyphTablesMutex;
+
+/** The woff.xml files shared by all Resources instances, with the resource path as key */
+static std::map<std::string, std::shared_ptr<const pugi::xml_document>> s_woffDocuments;
+static std::mutex s_woffDocumentsMutex;
+
+//----------------------------------------------------------------------------
+// Resources
+//----------------------------------------------------------------------------
+
+Resources::Resources()
+{
+    m_fontVersion = 0;
+}
+
+Resources::~Resources() {}
 
 //----------------------------------------------------------------------------
 // Font related methods
@@ -70,6 +111,11 @@ std::map<wchar_t, Glyph> Resources::m_textFont;
 
 bool Resources::InitFonts()
 {
+    m_font.clear();
+    m_textFont.clear();
+    m_tables.clear();
+    this->IndexGlyphs();
+
     // We will need to rethink this for adding the option to add custom fonts
     // Font Bravura first since it is expected to have always all symbols
     if (!LoadFont("Bravura")) LogError("Bravura font could not be loaded.");
@@ -89,38 +135,131 @@ bool Resources::InitFonts()
     return true;
 }
 
-bool Resources::SetFont(std::string fontName)
+bool Resources::SetFont(const std::string &fontName)
 {
     return LoadFont(fontName);
 }
 
-Glyph *Resources::GetGlyph(wchar_t smuflCode)
+const Glyph *Resources::GetGlyph(wchar_t smuflCode) const
+{
+    const unsigned int index = (unsigned int)smuflCode - SMUFL_FIRST_CODE;
+    if (index < m_smuflGlyphs.size()) return m_smuflGlyphs[index];
+    // Outside the SMuFL range
+    GlyphMap::const_iterator it = m_font.find(smuflCode);
+    if (it == m_font.end()) return NULL;
+    return it->second;
+}
+
+const Glyph *Resources::GetTextGlyph(wchar_t code) const
+{
+    if ((unsigned int)code < m_asciiTextGlyphs.size()) return m_asciiTextGlyphs[code];
+    GlyphMap::const_iterator it = m_textFont.find(code);
+    if (it == m_textFont.end()) return NULL;
+    return it->second;
+}
+
+std::shared_ptr<const pugi::xml_document> Resources::GetWoffDocument() const
+{
+    std::string path = this->GetPath();
+
+    std::lock_guard<std::mutex> lock(s_woffDocumentsMutex);
+    if (s_woffDocuments.count(path)) return s_woffDocuments.at(path);
+
+    std::string woff = path + "/woff.xml";
+    std::shared_ptr<pugi::xml_document> woffDoc = std::make_shared<pugi::xml_document>();
+    if (!woffDoc->load_file(woff.c_str())) {
+        LogError("Woff file '%s' could not be loaded", woff.c_str());
+        return NULL;
+    }
+    s_woffDocuments[path] = woffDoc;
+
+    return woffDoc;
+}
+
+bool Resources::LoadFont(const std::string &fontName)
+{
+    std::shared_ptr<const GlyphTable> table = GetFontTable(this->GetPath(), fontName);
+    if (!table) return false;
+
+    // Overlay the glyphs of the font over the ones already loaded
+    for (auto &glyph : *table) {
+        m_font[glyph.first] = &glyph.second;
+    }
+    m_tables.push_back(table);
+    this->IndexGlyphs();
+
+    return true;
+}
+
+void Resources::IndexGlyphs()
 {
-    if (!m_font.count(smuflCode)) return NULL;
-    return &m_font[smuflCode];
+    m_smuflGlyphs.clear();
+    m_asciiTextGlyphs.assign(0x80, NULL);
+
+    // The glyph maps are sorted, so the table goes up to the last code in the SMuFL range
+    GlyphMap::const_iterator it = m_font.lower_bound(SMUFL_FIRST_CODE);
+    for (; (it != m_font.end()) && (it->first <= SMUFL_LAST_CODE); ++it) {
+        m_smuflGlyphs.resize(it->first - SMUFL_FIRST_CODE + 1, NULL);
+        m_smuflGlyphs.back() = it->second;
+    }
+    for (it = m_textFont.begin(); it != m_textFont.end(); ++it) {
+        if ((unsigned int)it->first < m_asciiTextGlyphs.size()) m_asciiTextGlyphs.at(it->first) = it->second;
+    }
+
+    ++m_fontVersion;
 }
 
-Glyph *Resources::GetTextGlyph(wchar_t code)
+bool Resources::InitTextFont(const std::string &fontName)
 {
-    if (!m_textFont.count(code)) return NULL;
-    return &m_textFont[code];
+    std::shared_ptr<const GlyphTable> table = GetTextFontTable(this->GetPath(), fontName);
+    if (!table) return false;
+
+    for (auto &glyph : *table) {
+        if (m_textFont.count(glyph.first) > 0) {
+            LogDebug("Redefining %d with %s", glyph.first, fontName.c_str());
+        }
+        m_textFont[glyph.first] = &glyph.second;
+    }
+    m_tables.push_back(table);
+    this->IndexGlyphs();
+
+    return true;
 }
 
-bool Resources::LoadFont(std::string fontName)
+std::shared_ptr<const Resources::GlyphTable> Resources::GetFontTable(
+    const std::string &path, const std::string &fontName)
 {
+    std::string dirname = path + "/" + fontName;
+
+    std::lock_guard<std::mutex> lock(s_glyphTablesMutex);
+    if (s_glyphTables.count(dirname)) return s_glyphTables.at(dirname);
+
+    // Use the binary bundle if one was generated, otherwise the XML files
+    std::shared_ptr<GlyphTable> table = LoadFontBundle(path, fontName);
+    if (!table) table = LoadFontXML(path, fontName);
+    if (table) s_glyphTables[dirname] = table;
+
+    return table;
+}
+
+std::shared_ptr<Resources::GlyphTable> Resources::LoadFontXML(const std::string &path, const std::string &fontName)
+{
+    std::string dirname = path + "/" + fontName;
+
     ::DIR *dir;
     dirent *pdir;
-    std::string dirname = Resources::GetPath() + "/" + fontName;
     dir = opendir(dirname.c_str());
 
     if (!dir) {
         LogError("Font directory '%s' cannot be read", dirname.c_str());
-        return false;
+        return NULL;
     }
 
+    std::shared_ptr<GlyphTable> table = std::make_shared<GlyphTable>();
+
     // First loop through the fontName directory and load each glyph
     // Since the filename starts with the Unicode code, it is used
-    // to assign the glyph to the corresponding position in m_fonts
+    // to assign the glyph to the corresponding position in the table
     while ((pdir = readdir(dir))) {
         if (strstr(pdir->d_name, ".xml")) {
             // E.g, : E053-gClef8va.xml => strtol extracts E053 as hex
@@ -131,8 +270,8 @@ bool Resources::LoadFont(std::string fontName)
             }
             std::string codeStr = pdir->d_name;
             codeStr = codeStr.substr(0, 4);
-            Glyph glyph(Resources::GetPath() + "/" + fontName + "/" + pdir->d_name, codeStr);
-            m_font[smuflCode] = glyph;
+            Glyph glyph(dirname + "/" + pdir->d_name, codeStr);
+            (*table)[smuflCode] = glyph;
         }
     }
 
@@ -140,17 +279,17 @@ bool Resources::LoadFont(std::string fontName)
 
     // Then load the bounding boxes (if bounding box file is provided)
     pugi::xml_document doc;
-    std::string filename = Resources::GetPath() + "/" + fontName + ".xml";
+    std::string filename = path + "/" + fontName + ".xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
         LogMessage("Font loaded without bounding boxes");
-        return true;
+        return table;
     }
     pugi::xml_node root = doc.first_child();
     if (!root.attribute("units-per-em")) {
         LogWarning("No units-per-em attribute in bouding box file");
-        return true;
+        return table;
     }
     int unitsPerEm = atoi(root.attribute("units-per-em").value());
     pugi::xml_node current;
@@ -158,11 +297,11 @@ bool Resources::LoadFont(std::string fontName)
         Glyph *glyph = NULL;
         if (current.attribute("c")) {
             wchar_t smuflCode = (wchar_t)strtol(current.attribute("c").value(), NULL, 16);
-            if (!m_font.count(smuflCode)) {
+            if (!table->count(smuflCode)) {
                 LogWarning("Glyph with code '%d' not found.", smuflCode);
                 continue;
             }
-            glyph = &m_font[smuflCode];
+            glyph = &(*table)[smuflCode];
             if (glyph->GetUnitsPerEm() != unitsPerEm * 10) {
                 LogWarning("Glyph and bounding box units-per-em for code '%d' miss-match (bounding box: %d)", smuflCode,
                     unitsPerEm);
@@ -191,27 +330,124 @@ bool Resources::LoadFont(std::string fontName)
         }
     }
 
-    return true;
+    return table;
 }
 
-bool Resources::InitTextFont(std::string fontName)
+std::shared_ptr<Resources::GlyphTable> Resources::LoadFontBundle(const std::string &path, const std::string &fontName)
+{
+    std::string filename = path + "/" + fontName + ".bin";
+    std::ifstream input(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!input.is_open()) return NULL;
+
+    // Ignore the bundle if the XML files changed since it was generated - only the bounding boxes and the font
+    // directory (which changes when glyphs are added or removed) are checked, not each glyph file
+    std::string dirname = path + "/" + fontName;
+    const time_t bundleTime = GetModificationTime(filename);
+    for (auto const &source : { path + "/" + fontName + ".xml", dirname }) {
+        if (GetModificationTime(source) > bundleTime) {
+            LogWarning("Font bundle '%s' is older than '%s' and is ignored", filename.c_str(), source.c_str());
+            return NULL;
+        }
+    }
+
+    // Read the bundle at once - the glyphs keep a reference to it for their XML content
+    input.seekg(0, std::ios::end);
+    std::shared_ptr<std::string> bundle = std::make_shared<std::string>((size_t)input.tellg(), '\0');
+    input.seekg(0, std::ios::beg);
+    input.read(&(*bundle)[0], bundle->size());
+    if (!input) {
+        LogWarning("Font bundle '%s' could not be read", filename.c_str());
+        return NULL;
+    }
+
+    // Header with the magic string, the version, a byte order mark and the number of glyphs
+    FontBundleHeader header;
+    if (bundle->size() < sizeof(header)) {
+        LogWarning("Font bundle '%s' is truncated and is ignored", filename.c_str());
+        return NULL;
+    }
+    memcpy(&header, bundle->data(), sizeof(header));
+    if ((memcmp(header.m_magic, FONT_BUNDLE_MAGIC, 8) != 0) || (header.m_version != FONT_BUNDLE_VERSION)
+        || (header.m_byteOrder != FONT_BUNDLE_BYTE_ORDER)) {
+        LogWarning("Font bundle '%s' is not valid or outdated and is ignored", filename.c_str());
+        return NULL;
+    }
+
+    std::shared_ptr<GlyphTable> table = std::make_shared<GlyphTable>();
+    size_t pos = sizeof(header);
+    for (uint32_t i = 0; i < header.m_glyphCount; ++i) {
+        Glyph glyph;
+        if (!glyph.ReadBinary(bundle, pos, dirname)) {
+            LogWarning("Font bundle '%s' is truncated and is ignored", filename.c_str());
+            return NULL;
+        }
+        wchar_t smuflCode = (wchar_t)strtol(glyph.GetCodeStr().c_str(), NULL, 16);
+        (*table)[smuflCode] = glyph;
+    }
+
+    return table;
+}
+
+bool Resources::WriteFontBundle(const std::string &path, const std::string &fontName)
+{
+    std::shared_ptr<GlyphTable> table = LoadFontXML(path, fontName);
+    if (!table) return false;
+
+    FontBundleHeader header;
+    memcpy(header.m_magic, FONT_BUNDLE_MAGIC, 8);
+    header.m_version = FONT_BUNDLE_VERSION;
+    header.m_byteOrder = FONT_BUNDLE_BYTE_ORDER;
+    header.m_glyphCount = (uint32_t)table->size();
+
+    std::string buffer((const char *)&header, sizeof(header));
+    for (auto const &glyph : *table) {
+        std::ifstream source(glyph.second.GetPath().c_str(), std::ios::in | std::ios::binary);
+        if (!source.is_open()) {
+            LogError("Glyph file '%s' cannot be read", glyph.second.GetPath().c_str());
+            return false;
+        }
+        std::stringstream xml;
+        xml << source.rdbuf();
+        glyph.second.WriteBinary(buffer, glyph.second.GetPath().substr(path.size() + fontName.size() + 2), xml.str());
+    }
+
+    std::string filename = path + "/" + fontName + ".bin";
+    std::ofstream output(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!output.is_open()) {
+        LogError("Font bundle '%s' cannot be written", filename.c_str());
+        return false;
+    }
+    output.write(buffer.data(), buffer.size());
+
+    return (bool)output;
+}
+
+std::shared_ptr<const Resources::GlyphTable> Resources::GetTextFontTable(
+    const std::string &path, const std::string &fontName)
 {
-    // For the text font, we load the bounding boxes only
-    pugi::xml_document doc;
     // For now, we have only Times bounding boxes for ASCII chars
     // For any other char, we currently use 'o' bounding box
-    std::string filename = Resources::GetPath() + "/text/" + fontName + ".xml";
+    std::string filename = path + "/text/" + fontName + ".xml";
+
+    std::lock_guard<std::mutex> lock(s_glyphTablesMutex);
+    if (s_glyphTables.count(filename)) return s_glyphTables.at(filename);
+
+    // For the text font, we load the bounding boxes only
+    pugi::xml_document doc;
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
         LogMessage("Cannot load bounding boxes for text font '%s'", filename.c_str());
-        return false;
+        return NULL;
     }
     pugi::xml_node root = doc.first_child();
     if (!root.attribute("units-per-em")) {
         LogWarning("No units-per-em attribute in bouding box file");
-        return false;
+        return NULL;
     }
+
+    std::shared_ptr<GlyphTable> table = std::make_shared<GlyphTable>();
+
     int unitsPerEm = atoi(root.attribute("units-per-em").value());
     pugi::xml_node current;
     for (current = root.child("g"); current; current = current.next_sibling("g")) {
@@ -228,13 +464,12 @@ bool Resources::InitTextFont(std::string fontName)
             if (current.attribute("h")) height = atof(current.attribute("h").value());
             glyph.SetBoundingBox(x, y, width, height);
             if (current.attribute("h-a-x")) glyph.SetHorizAdvX(atof(current.attribute("h-a-x").value()));
-            if (m_textFont.count(code) > 0) {
-                LogDebug("Redefining %d with %s", code, fontName.c_str());
-            }
-            m_textFont[code] = glyph;
+            (*table)[code] = glyph;
         }
     }
-    return true;
+
+    s_glyphTables[filename] = table;
+    return table;
 }
 
 //----------------------------------------------------------------------------
@@ -242,12 +477,12 @@ bool Resources::InitTextFont(std::string fontName)
 //----------------------------------------------------------------------------
 
 /** Global for LogElapsedTimeXXX functions (debugging purposes) */
-struct timeval start;
+thread_local struct timeval start;
 /** For disabling log */
 bool noLog = false;
 
 #ifdef __EMSCRIPTEN__
-std::vector<std::string> logBuffer;
+thread_local std::vector<std::string> logBuffer;
 #endif
 
 void LogElapsedTimeStart()
@@ -265,6 +500,64 @@ void LogElapsedTimeEnd(const char *msg)
     LogMessage("Elapsed time (%s): %.3fs", msg, elapsedTime / 1000);
 }
 
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+thread_local Profiler *Profiler::s_current = NULL;
+
+void Profiler::Reset()
+{
+    m_entryPoints.clear();
+    m_passes.clear();
+}
+
+void Profiler::AddEntryPoint(const std::string &name, double time)
+{
+    Entry &entry = m_entryPoints[name];
+    entry.m_count++;
+    entry.m_time += time;
+}
+
+void Profiler::AddPass(const std::string &name, double time, long visits, long calls)
+{
+    Entry &entry = m_passes[name];
+    entry.m_count++;
+    entry.m_time += time;
+    entry.m_visits += visits;
+    entry.m_calls += calls;
+}
+
+double Profiler::GetTime()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//----------------------------------------------------------------------------
+// ProfilerScope
+//----------------------------------------------------------------------------
+
+ProfilerScope::ProfilerScope(Profiler *profiler, const std::string &name)
+{
+    m_profiler = profiler;
+    m_previous = NULL;
+    m_start = 0.0;
+    if (!m_profiler) return;
+
+    m_name = name;
+    m_previous = Profiler::s_current;
+    Profiler::s_current = m_profiler;
+    m_start = Profiler::GetTime();
+}
+
+ProfilerScope::~ProfilerScope()
+{
+    if (!m_profiler) return;
+
+    m_profiler->AddEntryPoint(m_name, Profiler::GetTime() - m_start);
+    Profiler::s_current = m_previous;
+}
+
 void LogDebug(const char *fmt, ...)
 {
     if (noLog) return;
@@ -0,0 +1,1229 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        benchmark.cpp
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+//----------------------------------------------------------------------------
+
+#include "bboxdevicecontext.h"
+#include "comparison.h"
+#include "doc.h"
+#include "durationinterface.h"
+#include "floatingobject.h"
+#include "functorparams.h"
+#include "glyph.h"
+#include "iohumdrum.h"
+#include "iomei.h"
+#include "iomusxml.h"
+#include "measure.h"
+#include "pugixml.hpp"
+#include "svgdevicecontext.h"
+#include "toolkit.h"
+#include "verticalaligner.h"
+#include "view.h"
+#include "vrv.h"
+
+//----------------------------------------------------------------------------
+
+#include "MidiFile.h"
+
+// Micro-benchmarks for the code paths tuned for performance, run on a corpus of files
+// Usage: benchmark <name> [-n <runs>] [-r <resources>] <file> [<file> ...]
+// For each file, the best time over the runs is reported in milliseconds (for each phase of the benchmark, if any)
+// Usage: benchmark object-memory <file>
+// Report the number and the size of the objects per class once the MEI file is loaded (glibc only)
+// Usage: benchmark parallel-toolkits [-j <threads>] [-r <resources>] <file> [<file> ...]
+// Render each file in each font with one toolkit per job on a pool of threads and check the output against a serial run
+// Usage: benchmark glyph-io [-r <resources>] <file> [<file> ...]
+// Report the time and the file reads of the SVG rendering with the parsed glyphs cached, and the svgSharedDefs output
+// Usage: benchmark lead-sheet <measures>
+// Write a dense lead sheet to the standard output, e.g., for the floating-positioners benchmark
+// Usage: benchmark incremental-cast-off [-r <resources>] <file> [<file> ...]
+// Check the pages of each file edited and cast off incrementally against a full cast off (run by doc/svg-tests.sh)
+
+namespace {
+
+// The duration of the phases of a benchmark run in milliseconds
+typedef std::vector<std::pair<std::string, double>> Phases;
+typedef std::function<void(const std::string &data, Phases &phases)> BenchmarkFunc;
+
+// The resource path for the benchmarks doing the layout
+std::string s_resourcePath = vrv::Resources::GetDefaultPath();
+
+class PhaseTimer {
+public:
+    PhaseTimer() : m_start(std::chrono::steady_clock::now()) {}
+
+    // Add the time elapsed since the previous phase
+    void EndPhase(Phases &phases, const std::string &name)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::milli> elapsed = now - m_start;
+        phases.push_back({ name, elapsed.count() });
+        m_start = now;
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+std::string ReadFile(const std::string &filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) return "";
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    return buffer.str();
+}
+
+// The best time of each phase is kept independently; benchmarks without phases are timed as a whole
+Phases TimeBest(const BenchmarkFunc &func, const std::string &data, int runs)
+{
+    Phases best;
+    for (int i = 0; i < runs; ++i) {
+        Phases phases;
+        PhaseTimer timer;
+        func(data, phases);
+        if (phases.empty()) timer.EndPhase(phases, "");
+        if (i == 0) {
+            best = phases;
+            continue;
+        }
+        for (size_t j = 0; j < best.size(); ++j) best.at(j).second = std::min(best.at(j).second, phases.at(j).second);
+    }
+    return best;
+}
+
+// Import an MEI file with the fonts of the resource path and prepare the document for the cast-off and the layout
+void LoadPreparedDoc(vrv::Doc &doc, const std::string &data)
+{
+    doc.GetResources().SetPath(s_resourcePath);
+    doc.GetResources().InitFonts();
+    vrv::MEIInput input(&doc);
+    input.Import(data);
+    doc.GenerateMeasureNumbers();
+    doc.PrepareDrawing();
+}
+
+// Import an MEI file, preserving or not the unsupported attributes
+void MEIImport(const std::string &data, bool readUnsupportedAttr)
+{
+    vrv::Doc doc;
+    vrv::MEIInput input(&doc);
+    input.SetReadUnsupportedAttr(readUnsupportedAttr);
+    input.Import(data);
+}
+
+#ifndef NO_HUMDRUM_SUPPORT
+// Load the Humdrum data as it was done by the toolkit before: imported in a temporary document, written to
+// score-based MEI and loaded from it
+bool LoadHumdrumRoundTrip(vrv::Toolkit &toolkit, const std::string &humdrum)
+{
+    vrv::Doc tempDoc;
+    tempDoc.SetOptions(toolkit.GetOptions());
+    vrv::HumdrumInput input(&tempDoc);
+    if (!input.Import(humdrum)) return false;
+    vrv::MEIOutput output(&tempDoc, "");
+    output.SetScoreBasedMEI(true);
+    const std::string mei = output.GetOutput();
+    toolkit.SetInputFrom("mei");
+    return toolkit.LoadData(mei);
+}
+
+// Load a file with the toolkit from a format converted to Humdrum, then load the Humdrum data of the conversion
+// imported directly in the document, and as it was done before with the MEI round-trip
+void HumdrumImport(const std::string &data, const std::string &inputFrom, Phases &phases)
+{
+    const std::string options = "{\"breaks\": \"none\"}";
+    vrv::Toolkit toolkit(false);
+    toolkit.SetResourcePath(s_resourcePath);
+    toolkit.SetOptions(options);
+    toolkit.SetInputFrom(inputFrom);
+    PhaseTimer timer;
+    toolkit.LoadData(data);
+    timer.EndPhase(phases, "load");
+    const std::string humdrum = toolkit.GetHumdrum();
+
+    vrv::Toolkit direct(false);
+    direct.SetResourcePath(s_resourcePath);
+    direct.SetOptions(options);
+    direct.SetInputFrom("humdrum");
+    timer = PhaseTimer();
+    direct.LoadData(humdrum);
+    timer.EndPhase(phases, "humdrum direct");
+
+    vrv::Toolkit roundTrip(false);
+    roundTrip.SetResourcePath(s_resourcePath);
+    roundTrip.SetOptions(options);
+    timer = PhaseTimer();
+    LoadHumdrumRoundTrip(roundTrip, humdrum);
+    timer.EndPhase(phases, "humdrum mei round-trip");
+}
+#endif
+
+// Import a partwise MusicXML file, reporting the parsing of the XML document on its own and the import (which includes
+// it), and load it with the toolkit, which also does the cast-off
+void MusicXmlImport(const std::string &data, Phases &phases)
+{
+    PhaseTimer timer;
+    {
+        pugi::xml_document xmlDoc;
+        xmlDoc.load_string(data.c_str());
+    }
+    timer.EndPhase(phases, "parse");
+
+    {
+        vrv::Doc doc;
+        vrv::MusicXmlInput input(&doc);
+        input.Import(data);
+    }
+    timer.EndPhase(phases, "import");
+
+    vrv::Toolkit toolkit(false);
+    toolkit.SetResourcePath(s_resourcePath);
+    toolkit.SetInputFrom("musicxml");
+    timer = PhaseTimer();
+    toolkit.LoadData(data);
+    timer.EndPhase(phases, "load");
+}
+
+// Lay out all the pages of an MEI file, reporting the time spent in the bounding box drawings of the layout, and
+// redraw each page once in a bounding box device context (the cost of one of these drawings)
+void BoundingBoxes(const std::string &data, Phases &phases)
+{
+    vrv::Doc doc;
+    LoadPreparedDoc(doc, data);
+    doc.CastOffDoc();
+
+    vrv::View view;
+    view.SetDoc(&doc);
+    vrv::Profiler profiler;
+    PhaseTimer timer;
+    {
+        vrv::ProfilerScope scope(&profiler, "LayOut");
+        for (int i = 0; i < doc.GetPageCount(); ++i) view.SetPage(i, true);
+    }
+    timer.EndPhase(phases, "layout");
+    auto drawing = profiler.GetPasses().find("DrawBoundingBoxes");
+    phases.push_back({ "drawing in layout", (drawing != profiler.GetPasses().end()) ? drawing->second.m_time : 0.0 });
+
+    for (int i = 0; i < doc.GetPageCount(); ++i) {
+        view.SetPage(i, false);
+        vrv::BBoxDeviceContext bBoxDC(&view, 0, 0);
+        view.DrawCurrentPage(&bBoxDC, false);
+    }
+    timer.EndPhase(phases, "redraw");
+}
+
+// Cast off an MEI file and lay out all the pages, restoring the horizontal layout of the measures stored by the
+// cast-off, and lay them out again in another document with the stored layout freed, as it was done before
+void StoredLayout(const std::string &data, Phases &phases)
+{
+    for (bool restore : { true, false }) {
+        vrv::Doc doc;
+        LoadPreparedDoc(doc, data);
+
+        vrv::View view;
+        view.SetDoc(&doc);
+        PhaseTimer timer;
+        doc.CastOffDoc();
+        if (restore) {
+            timer.EndPhase(phases, "cast-off");
+        }
+        else {
+            doc.ClearStoredHorizontalLayout(false);
+            timer = PhaseTimer();
+        }
+        for (int i = 0; i < doc.GetPageCount(); ++i) view.SetPage(i, true);
+        timer.EndPhase(phases, (restore) ? "layout" : "layout without stored");
+    }
+}
+
+// The floating objects, for the positioners of the staff alignments
+class IsFloatingObjectComparison : public vrv::Comparison {
+public:
+    virtual bool operator()(vrv::Object *object) { return object->IsFloatingObject(); }
+    virtual bool MatchesType(vrv::Object *object) { return true; }
+};
+
+// Lay out an MEI file in a single system, as with --breaks none, reporting the time of the passes adjusting the floating
+// positioners and the staff overlaps, and look for the positioners overlapping each positioner of a staff alignment as
+// they are added, with a horizontal index as the staff alignment does, and by checking all of them as done before
+void FloatingPositioners(const std::string &data, Phases &phases)
+{
+    vrv::Doc doc;
+    LoadPreparedDoc(doc, data);
+
+    vrv::View view;
+    view.SetDoc(&doc);
+    vrv::Profiler profiler;
+    PhaseTimer timer;
+    {
+        vrv::ProfilerScope scope(&profiler, "LayOut");
+        view.SetPage(0, true);
+    }
+    timer.EndPhase(phases, "layout");
+    for (const std::string name : { "AdjustFloatingPositioners", "AdjustStaffOverlap" }) {
+        auto pass = profiler.GetPasses().find(name);
+        phases.push_back({ name, (pass != profiler.GetPasses().end()) ? pass->second.m_time : 0.0 });
+    }
+
+    // The positioners of each staff alignment above and below, which are the boxes indexed in the layout
+    IsFloatingObjectComparison matchFloatingObject;
+    vrv::ArrayOfObjects objects;
+    doc.FindAllDescendantByComparison(&objects, &matchFloatingObject);
+    std::map<std::pair<vrv::StaffAlignment *, int>, vrv::ArrayOfBoundingBoxes> overflows;
+    for (auto &object : objects) {
+        vrv::FloatingPositioner *positioner = vrv_cast<vrv::FloatingObject *>(object)->GetCurrentFloatingPositioner();
+        if (!positioner || !positioner->GetAlignment() || !positioner->HasContentBB()) continue;
+        overflows[{ positioner->GetAlignment(), positioner->GetDrawingPlace() }].push_back(positioner);
+    }
+    timer = PhaseTimer();
+
+    vrv::ArrayOfBoundingBoxes overlaps;
+    volatile size_t count = 0;
+    for (auto &overflow : overflows) {
+        vrv::HorizontalBBoxIndex index;
+        for (auto &box : overflow.second) {
+            index.FindHorizontalContentOverlaps(box, overlaps);
+            count += overlaps.size();
+            index.Add(box);
+        }
+    }
+    timer.EndPhase(phases, "index");
+    for (auto &overflow : overflows) {
+        vrv::ArrayOfBoundingBoxes boxes;
+        for (auto &box : overflow.second) {
+            overlaps.clear();
+            for (auto &other : boxes) {
+                if (box->HorizontalContentOverlap(other)) overlaps.push_back(other);
+            }
+            count += overlaps.size();
+            boxes.push_back(box);
+        }
+    }
+    timer.EndPhase(phases, "all boxes");
+}
+
+// The y position of a bezier at position x evaluated with pow, as it was done by BoundingBox::CalcBezierAtPosition
+int CalcBezierAtPositionWithPow(const vrv::Point bezier[4], int x)
+{
+    double t = 0.0;
+    if (bezier[3].x != bezier[0].x) t = (double)(x - bezier[0].x) / (double)(bezier[3].x - bezier[0].x);
+    t = std::min(1.0, std::max(0.0, t));
+    return pow((1 - t), 3) * bezier[0].y + 3 * t * pow((1 - t), 2) * bezier[1].y + 3 * (1 - t) * pow(t, 2) * bezier[2].y
+        + pow(t, 3) * bezier[3].y;
+}
+
+// Lay out an MEI file in a single system, reporting the time of the pass adjusting the slurs, and evaluate the curves
+// of the slurs on the left and on the right of their spanned elements, with a BezierCurve for all the elements of a slur
+// as the layout does, and with the thick bezier and the points evaluated for each element as done before; the
+// adjustments of all the slurs are also calculated with FloatingCurvePositioner::CalcAdjustments
+void Slurs(const std::string &data, Phases &phases)
+{
+    const int repeat = 100;
+    vrv::Doc doc;
+    LoadPreparedDoc(doc, data);
+
+    vrv::View view;
+    view.SetDoc(&doc);
+    vrv::Profiler profiler;
+    PhaseTimer timer;
+    {
+        vrv::ProfilerScope scope(&profiler, "LayOut");
+        view.SetPage(0, true);
+    }
+    timer.EndPhase(phases, "layout");
+    auto pass = profiler.GetPasses().find("AdjustSlurs");
+    phases.push_back({ "AdjustSlurs", (pass != profiler.GetPasses().end()) ? pass->second.m_time : 0.0 });
+
+    // The curve positioners of the slurs with the left and the right of their spanned elements
+    vrv::ClassIdComparison matchSlur(vrv::SLUR);
+    vrv::ArrayOfObjects slurs;
+    doc.FindAllDescendantByComparison(&slurs, &matchSlur);
+    std::vector<std::pair<vrv::FloatingCurvePositioner *, std::vector<int>>> curves;
+    for (auto &slur : slurs) {
+        vrv::FloatingPositioner *positioner = vrv_cast<vrv::FloatingObject *>(slur)->GetCurrentFloatingPositioner();
+        if (!positioner || !positioner->Is(vrv::FLOATING_CURVE_POSITIONER)) continue;
+        vrv::FloatingCurvePositioner *curve = vrv_cast<vrv::FloatingCurvePositioner *>(positioner);
+        curves.push_back({ curve, {} });
+        for (auto &spannedElement : *curve->GetSpannedElements()) {
+            curves.back().second.push_back(spannedElement->m_boundingBox->GetSelfLeft());
+            curves.back().second.push_back(spannedElement->m_boundingBox->GetSelfRight());
+        }
+    }
+    timer = PhaseTimer();
+
+    long batchSum = 0;
+    std::vector<int> ys;
+    for (int i = 0; i < repeat; ++i) {
+        for (auto &curve : curves) {
+            const int count = (int)curve.second.size();
+            ys.resize(count);
+            curve.first->GetTopCurve().CalcYAtPositions(curve.second.data(), ys.data(), count);
+            for (int y : ys) batchSum += y;
+            curve.first->GetBottomCurve().CalcYAtPositions(curve.second.data(), ys.data(), count);
+            for (int y : ys) batchSum += y;
+        }
+    }
+    timer.EndPhase(phases, "batch");
+    long perPointSum = 0;
+    for (int i = 0; i < repeat; ++i) {
+        for (auto &curve : curves) {
+            vrv::Point points[4];
+            curve.first->GetPoints(points);
+            for (size_t j = 0; j < curve.second.size(); j += 2) {
+                vrv::Point topBezier[4], bottomBezier[4];
+                vrv::BoundingBox::CalcThickBezier(
+                    points, curve.first->GetThickness(), curve.first->GetAngle(), topBezier, bottomBezier);
+                perPointSum += CalcBezierAtPositionWithPow(topBezier, curve.second.at(j));
+                perPointSum += CalcBezierAtPositionWithPow(topBezier, curve.second.at(j + 1));
+                perPointSum += CalcBezierAtPositionWithPow(bottomBezier, curve.second.at(j));
+                perPointSum += CalcBezierAtPositionWithPow(bottomBezier, curve.second.at(j + 1));
+            }
+        }
+    }
+    timer.EndPhase(phases, "per point");
+    // The terms are added in the same order in both evaluations, which give the same values
+    if (batchSum != perPointSum) {
+        std::cerr << "The batch evaluation differs from the one per point" << std::endl;
+    }
+
+    // The adjustments mark the elements that fit as discarded, which need to be reset for each run
+    std::vector<int> adjustments;
+    timer = PhaseTimer();
+    for (int i = 0; i < repeat; ++i) {
+        for (auto &curve : curves) {
+            for (auto &spannedElement : *curve.first->GetSpannedElements()) spannedElement->m_discarded = false;
+            curve.first->CalcAdjustments(curve.first->GetSpannedElements(), adjustments);
+        }
+    }
+    timer.EndPhase(phases, "CalcAdjustments");
+}
+
+// Lay out all the pages of an MEI file (the cast-off and the layout of each page), and query the metrics of all the
+// glyphs of the music font and of the ASCII characters of the text font the way the layout does
+void GlyphMetrics(const std::string &data, Phases &phases)
+{
+    const int repeat = 100;
+    vrv::Doc doc;
+    LoadPreparedDoc(doc, data);
+
+    std::vector<wchar_t> codes;
+    for (wchar_t code = 0xE000; code <= 0xF8FF; ++code) {
+        if (doc.GetResources().GetGlyph(code)) codes.push_back(code);
+    }
+    std::vector<wchar_t> textCodes;
+    for (wchar_t code = 0x20; code < 0x7F; ++code) {
+        if (doc.GetResources().GetTextGlyph(code)) textCodes.push_back(code);
+    }
+
+    vrv::View view;
+    view.SetDoc(&doc);
+    PhaseTimer timer;
+    doc.CastOffDoc();
+    for (int i = 0; i < doc.GetPageCount(); ++i) view.SetPage(i, true);
+    timer.EndPhase(phases, "layout");
+
+    const int staffSizes[] = { 100, 75 };
+    volatile int sum = 0;
+    for (int i = 0; i < repeat; ++i) {
+        for (wchar_t code : codes) {
+            for (int staffSize : staffSizes) {
+                for (bool graceSize : { false, true }) {
+                    sum += doc.GetGlyphWidth(code, staffSize, graceSize) + doc.GetGlyphHeight(code, staffSize, graceSize)
+                        + doc.GetGlyphAdvX(code, staffSize, graceSize)
+                        + doc.GetGlyphDescender(code, staffSize, graceSize);
+                }
+            }
+        }
+    }
+    timer.EndPhase(phases, "music glyphs");
+
+    vrv::FontInfo *font = doc.GetDrawingLyricFont(100);
+    for (int i = 0; i < repeat; ++i) {
+        for (wchar_t code : textCodes) {
+            for (bool graceSize : { false, true }) {
+                sum += doc.GetTextGlyphWidth(code, font, graceSize) + doc.GetTextGlyphHeight(code, font, graceSize)
+                    + doc.GetTextGlyphAdvX(code, font, graceSize) + doc.GetTextGlyphDescender(code, font, graceSize);
+            }
+        }
+    }
+    timer.EndPhase(phases, "text glyphs");
+}
+
+// Traverse an imported MEI file with functors visiting all the objects, unfiltered and filtered by staff and layer
+void Traversal(const std::string &data, Phases &phases)
+{
+    const int repeat = 10;
+    vrv::Doc doc;
+    vrv::MEIInput input(&doc);
+    input.SetReadUnsupportedAttr(false);
+    input.Import(data);
+
+    PhaseTimer timer;
+    for (int i = 0; i < repeat; ++i) doc.SetCurrentScoreDefDoc(true);
+    timer.EndPhase(phases, "scoredef");
+
+    vrv::ClassIdComparison matchNote(vrv::NOTE);
+    vrv::ArrayOfObjects notes;
+    for (int i = 0; i < repeat; ++i) {
+        notes.clear();
+        doc.FindAllDescendantByComparison(&notes, &matchNote);
+    }
+    timer.EndPhase(phases, "find");
+
+    vrv::AttNIntegerComparison matchStaff(vrv::STAFF, 1);
+    vrv::AttNIntegerComparison matchLayer(vrv::LAYER, 1);
+    vrv::ArrayOfComparisons filters = { &matchStaff, &matchLayer };
+    for (int i = 0; i < repeat; ++i) {
+        notes.clear();
+        vrv::FindAllByComparisonParams findAllByComparisonParams(&matchNote, &notes);
+        vrv::Functor findAllByComparison(&vrv::Object::FindAllByComparison);
+        doc.Process(&findAllByComparison, &findAllByComparisonParams, NULL, &filters);
+    }
+    timer.EndPhase(phases, "filtered");
+}
+
+// Look up the uuids of notes of an MEI file with a walk of the document and with the uuid index of the Doc, then again
+// after a note is deleted, which updates the index instead of rebuilding it
+void UuidLookup(const std::string &data, Phases &phases)
+{
+    const int walkLookups = 100;
+    const int indexRepeat = 100;
+    vrv::Doc doc;
+    vrv::MEIInput input(&doc);
+    input.Import(data);
+
+    vrv::ClassIdComparison matchNote(vrv::NOTE);
+    vrv::ArrayOfObjects notes;
+    doc.FindAllDescendantByComparison(&notes, &matchNote);
+    if (notes.size() < 2) return;
+    vrv::Object *deleted = notes.at(notes.size() / 2);
+    std::vector<std::string> uuids;
+    for (int i = 0; i < walkLookups; ++i) {
+        vrv::Object *note = notes.at(i * notes.size() / walkLookups);
+        if (note != deleted) uuids.push_back(note->GetUuid());
+    }
+
+    PhaseTimer timer;
+    for (auto &uuid : uuids) doc.FindDescendantByUuid(uuid);
+    timer.EndPhase(phases, "walk");
+    doc.FindElementByUuid(uuids.front());
+    timer.EndPhase(phases, "index build");
+    for (int i = 0; i < indexRepeat; ++i) {
+        for (auto &uuid : uuids) doc.FindElementByUuid(uuid);
+    }
+    timer.EndPhase(phases, "index x" + std::to_string(indexRepeat));
+    deleted->GetParent()->DeleteChild(deleted);
+    for (int i = 0; i < indexRepeat; ++i) {
+        for (auto &uuid : uuids) doc.FindElementByUuid(uuid);
+    }
+    timer.EndPhase(phases, "after delete x" + std::to_string(indexRepeat));
+}
+
+// Calculate the MIDI timemap of a cast off MEI file, which builds the real time index, and look for the notes and rests
+// playing every 100 ms with the index, and for the notes with the comparisons walking the document as done before
+void ElementsAtTime(const std::string &data, Phases &phases)
+{
+    const int step = 100;
+    vrv::Doc doc;
+    LoadPreparedDoc(doc, data);
+    doc.CastOffDoc();
+
+    PhaseTimer timer;
+    doc.CalculateMidiTimemap();
+    timer.EndPhase(phases, "timemap");
+
+    // The end of the last measure playing
+    vrv::ClassIdComparison matchMeasure(vrv::MEASURE);
+    vrv::ArrayOfObjects measures;
+    doc.FindAllDescendantByComparison(&measures, &matchMeasure);
+    int end = 0;
+    for (auto &object : measures) {
+        vrv::Measure *measure = vrv_cast<vrv::Measure *>(object);
+        for (int repeat = 1; repeat <= measure->GetRepeatCount(); ++repeat) {
+            end = std::max(end,
+                (int)(measure->GetRealTimeOffsetMilliseconds(repeat) + measure->GetRealTimeDurationMilliseconds()));
+        }
+    }
+    const std::string queries = " x" + std::to_string(end / step + 1);
+    timer.EndPhase(phases, "measures");
+
+    vrv::ArrayOfObjects notes;
+    vrv::ArrayOfObjects rests;
+    for (int time = 0; time <= end; time += step) {
+        notes.clear();
+        rests.clear();
+        doc.FindElementsAtTime(time, &notes, &rests);
+    }
+    timer.EndPhase(phases, "index" + queries);
+
+    for (int time = 0; time <= end; time += step) {
+        vrv::MeasureOnsetOffsetComparison matchMeasureTime(time);
+        vrv::Measure *measure = dynamic_cast<vrv::Measure *>(doc.FindDescendantByComparison(&matchMeasureTime));
+        if (!measure) continue;
+        int measureTimeOffset = measure->GetRealTimeOffsetMilliseconds(measure->EnclosesTime(time));
+        vrv::NoteOnsetOffsetComparison matchNoteTime(time - measureTimeOffset);
+        notes.clear();
+        measure->FindAllDescendantByComparison(&notes, &matchNoteTime);
+    }
+    timer.EndPhase(phases, "walk" + queries);
+}
+
+// Process a functor on each staff / layer of the layer tree, with one pass for each of them in a single traversal as
+// the document does, or with one traversal filtered by staff and layer for each of them as done before
+void ProcessByLayer(vrv::Doc &doc, const vrv::IntTree &layerTree, vrv::Functor &functor,
+    const std::function<vrv::FunctorParams *(vrv::Functor *functor, int staffN)> &createParams, bool singleTraversal)
+{
+    std::list<vrv::AttNIntegerComparison> comparisons;
+    std::list<vrv::FunctorPass> passes;
+    std::vector<std::unique_ptr<vrv::FunctorParams>> params;
+    vrv::ArrayOfFunctorPasses functorPasses;
+    for (auto &staff : layerTree.child) {
+        for (auto &layer : staff.second.child) {
+            comparisons.emplace_back(vrv::STAFF, staff.first);
+            vrv::AttNIntegerComparison *matchStaff = &comparisons.back();
+            comparisons.emplace_back(vrv::LAYER, layer.first);
+            vrv::AttNIntegerComparison *matchLayer = &comparisons.back();
+            if (singleTraversal) {
+                passes.emplace_back(functor, nullptr);
+                // The functor of the pass is the one given to the params (e.g., for processing @sameas)
+                params.emplace_back(createParams(&passes.back().m_functor, staff.first));
+                passes.back().m_functorParams = params.back().get();
+                passes.back().m_filters = { matchStaff, matchLayer };
+                functorPasses.push_back(&passes.back());
+            }
+            else {
+                params.emplace_back(createParams(&functor, staff.first));
+                vrv::ArrayOfComparisons filters = { matchStaff, matchLayer };
+                doc.Process(&functor, params.back().get(), NULL, &filters);
+            }
+        }
+    }
+    if (singleTraversal) doc.ProcessPasses(functorPasses);
+}
+
+// Run the MIDI generation and the preparation passes processed by staff / layer on an MEI file, in a single traversal
+// with Object::ProcessPasses, and with one traversal for each staff / layer as done before
+void Passes(const std::string &data, Phases &phases)
+{
+    vrv::Doc doc;
+    LoadPreparedDoc(doc, data);
+    doc.CalculateMidiTimemap();
+
+    vrv::PrepareProcessingListsParams prepareProcessingListsParams;
+    vrv::Functor prepareProcessingLists(&vrv::Object::PrepareProcessingLists, "PrepareProcessingLists");
+    doc.Process(&prepareProcessingLists, &prepareProcessingListsParams);
+    const vrv::IntTree &layerTree = prepareProcessingListsParams.m_layerTree;
+
+    for (bool singleTraversal : { true, false }) {
+        const std::string label = (singleTraversal) ? " single" : " sequential";
+        PhaseTimer timer;
+        std::list<smf::MidiFile> midiFiles;
+        vrv::Functor generateMIDI(&vrv::Object::GenerateMIDI, "GenerateMIDI");
+        ProcessByLayer(
+            doc, layerTree, generateMIDI,
+            [&midiFiles](vrv::Functor *functor, int staffN) {
+                midiFiles.emplace_back();
+                midiFiles.back().absoluteTicks();
+                midiFiles.back().addTracks(staffN);
+                vrv::GenerateMIDIParams *params = new vrv::GenerateMIDIParams(&midiFiles.back(), functor);
+                params->m_midiTrack = staffN;
+                return params;
+            },
+            singleTraversal);
+        timer.EndPhase(phases, "GenerateMIDI" + label);
+
+        vrv::Functor preparePointersByLayer(&vrv::Object::PreparePointersByLayer, "PreparePointersByLayer");
+        ProcessByLayer(
+            doc, layerTree, preparePointersByLayer,
+            [](vrv::Functor *, int) { return new vrv::PreparePointersByLayerParams(); }, singleTraversal);
+        timer.EndPhase(phases, "PreparePointersByLayer" + label);
+
+        vrv::Functor prepareRpt(&vrv::Object::PrepareRpt, "PrepareRpt");
+        ProcessByLayer(
+            doc, layerTree, prepareRpt,
+            [&doc](vrv::Functor *, int) { return new vrv::PrepareRptParams(&doc.m_scoreDef); }, singleTraversal);
+        timer.EndPhase(phases, "PrepareRpt" + label);
+    }
+}
+
+// Load an MEI file for the MIDI output, which defers the cast off, and render it to MIDI, then request the page count
+// (the deferred cast off); the same for the SVG output, where the cast off is done by the load
+void MidiOutput(const std::string &data, Phases &phases)
+{
+    for (const std::string outputTo : { "midi", "svg" }) {
+        vrv::Toolkit toolkit(false);
+        toolkit.SetResourcePath(s_resourcePath);
+        toolkit.SetOutputTo(outputTo);
+        PhaseTimer timer;
+        toolkit.LoadData(data);
+        timer.EndPhase(phases, outputTo + " load");
+        toolkit.RenderToMIDI();
+        timer.EndPhase(phases, outputTo + " midi");
+        toolkit.GetPageCount();
+        timer.EndPhase(phases, outputTo + " page count");
+    }
+}
+
+// Load an MEI file with and without the lazy layout and render its first page, as for a preview
+void LazyLayout(const std::string &data, Phases &phases)
+{
+    for (bool lazy : { false, true }) {
+        vrv::Toolkit toolkit(false);
+        toolkit.SetResourcePath(s_resourcePath);
+        toolkit.SetOptions((lazy) ? "{\"lazyLayout\": true}" : "{\"lazyLayout\": false}");
+        const std::string label = (lazy) ? "lazy " : "";
+        PhaseTimer timer;
+        toolkit.LoadData(data);
+        timer.EndPhase(phases, label + "load");
+        toolkit.RenderToSVG(1);
+        timer.EndPhase(phases, label + "first page");
+    }
+}
+
+const std::map<std::string, BenchmarkFunc> &GetBenchmarks()
+{
+    static const std::map<std::string, BenchmarkFunc> benchmarks = {
+        { "bounding-boxes", BoundingBoxes },
+        { "elements-at-time", ElementsAtTime },
+        { "floating-positioners", FloatingPositioners },
+        { "glyph-metrics", GlyphMetrics },
+#ifndef NO_HUMDRUM_SUPPORT
+        { "humdrum-import", [](const std::string &data, Phases &phases) { HumdrumImport(data, "humdrum", phases); } },
+        { "mei-hum-import", [](const std::string &data, Phases &phases) { HumdrumImport(data, "mei-hum", phases); } },
+        { "musicxml-hum-import",
+            [](const std::string &data, Phases &phases) { HumdrumImport(data, "musicxml-hum", phases); } },
+#endif
+        { "lazy-layout", LazyLayout },
+        { "mei-import", [](const std::string &data, Phases &) { MEIImport(data, true); } },
+        { "mei-import-render", [](const std::string &data, Phases &) { MEIImport(data, false); } },
+        { "midi-output", MidiOutput },
+        { "musicxml-import", MusicXmlImport },
+        { "passes", Passes },
+        { "slurs", Slurs },
+        { "stored-layout", StoredLayout },
+        { "traversal", Traversal },
+        { "uuid-lookup", UuidLookup },
+    };
+    return benchmarks;
+}
+
+void PrintPhases(const std::string &label, const Phases &phases)
+{
+    std::cout << label << ":";
+    for (size_t i = 0; i < phases.size(); ++i) {
+        std::cout << (i ? ", " : " ");
+        if (!phases.at(i).first.empty()) std::cout << phases.at(i).first << " ";
+        std::cout << phases.at(i).second << " ms";
+    }
+    std::cout << std::endl;
+}
+
+void DisplayUsage()
+{
+    std::cerr << "Usage: benchmark <name> [-n <runs>] [-r <resources>] <file> [<file> ...]" << std::endl
+              << "Benchmarks:";
+    for (auto &benchmark : GetBenchmarks()) std::cerr << " " << benchmark.first;
+    std::cerr << std::endl;
+    std::cerr << "Usage: benchmark object-memory <file>" << std::endl;
+    std::cerr << "Usage: benchmark parallel-toolkits [-j <threads>] [-r <resources>] <file> [<file> ...]" << std::endl;
+    std::cerr << "Usage: benchmark glyph-io [-r <resources>] <file> [<file> ...]" << std::endl;
+    std::cerr << "Usage: benchmark lead-sheet <measures>" << std::endl;
+    std::cerr << "Usage: benchmark incremental-cast-off [-r <resources>] <file> [<file> ...]" << std::endl;
+}
+
+// A file rendered in a font: all the pages in SVG and the timemap
+struct ToolkitJob {
+    std::string m_data;
+    std::string m_font;
+    std::vector<std::string> m_output;
+};
+
+void RenderJob(ToolkitJob &job)
+{
+    // The same uuids regardless of the thread
+    vrv::Object::SeedUuid(1);
+    vrv::Toolkit toolkit(false);
+    job.m_output.clear();
+    if (!toolkit.SetResourcePath(s_resourcePath) || !toolkit.SetFont(job.m_font)) return;
+    toolkit.SetOutputTo("svg");
+    if (!toolkit.LoadData(job.m_data)) return;
+    for (int i = 1; i <= toolkit.GetPageCount(); ++i) job.m_output.push_back(toolkit.RenderToSVG(i));
+    job.m_output.push_back(toolkit.RenderToTimemap());
+}
+
+// Stress test of the toolkits used in parallel (see the Toolkit documentation): the jobs are rendered serially first,
+// then again by the threads each taking the next job, and the output of each job has to be the same
+int ParallelToolkits(const std::vector<std::string> &files, int threads)
+{
+    const std::vector<std::string> fonts = { "Leipzig", "Bravura", "Gootville", "Petaluma" };
+    std::vector<ToolkitJob> jobs;
+    for (auto &file : files) {
+        const std::string data = ReadFile(file);
+        if (data.empty()) {
+            std::cerr << "The file '" << file << "' could not be read." << std::endl;
+            return 1;
+        }
+        for (auto &font : fonts) jobs.push_back({ data, font, {} });
+    }
+    std::vector<ToolkitJob> references = jobs;
+
+    PhaseTimer timer;
+    Phases phases;
+    for (auto &reference : references) RenderJob(reference);
+    timer.EndPhase(phases, "serial");
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; ++i) {
+        workers.push_back(std::thread([&jobs, &next]() {
+            for (size_t j = next++; j < jobs.size(); j = next++) RenderJob(jobs.at(j));
+        }));
+    }
+    for (auto &worker : workers) worker.join();
+    timer.EndPhase(phases, std::to_string(threads) + " threads");
+
+    int failed = 0;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        const std::string label = files.at(i / fonts.size()) + " (" + jobs.at(i).m_font + ")";
+        if (references.at(i).m_output.empty()) {
+            std::cerr << label << " could not be rendered" << std::endl;
+            ++failed;
+        }
+        else if (jobs.at(i).m_output != references.at(i).m_output) {
+            std::cerr << label << " rendered differently in parallel" << std::endl;
+            ++failed;
+        }
+    }
+    PrintPhases(std::to_string(jobs.size()) + " jobs", phases);
+    std::cout << "Failed: " << failed << std::endl;
+    return (failed > 0) ? 1 : 0;
+}
+
+// A dense lead sheet with chord symbols and lyrics on every beat, and dynamics, directions, hairpins and slurs in
+// every measure, which fill the overflowing boxes of the staff alignment
+std::string GenerateLeadSheet(int measures)
+{
+    const char *pitches[] = { "c", "d", "e", "f", "g", "a", "b" };
+    const char *chords[] = { "C", "Dm7", "G7", "Am", "F#m7b5", "Bb", "E7(#9)" };
+    const char *dynamics[] = { "pp", "mf", "ff", "sfz" };
+    std::ostringstream mei;
+    mei << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl
+        << "<mei xmlns=\"http://www.music-encoding.org/ns/mei\" meiversion=\"4.0.0\">" << std::endl
+        << "<meiHead><fileDesc><titleStmt><title>Lead sheet</title></titleStmt><pubStmt/></fileDesc></meiHead>"
+        << std::endl
+        << "<music><body><mdiv><score><scoreDef meter.count=\"4\" meter.unit=\"4\" key.sig=\"1f\">"
+        << "<staffGrp><staffDef n=\"1\" lines=\"5\" clef.shape=\"G\" clef.line=\"2\"/></staffGrp></scoreDef>"
+        << "<section>" << std::endl;
+    for (int m = 1; m <= measures; ++m) {
+        mei << "<measure n=\"" << m << "\"><staff n=\"1\"><layer n=\"1\">";
+        for (int beat = 1; beat <= 4; ++beat) {
+            const int pitch = (m * 3 + beat * 5) % 7;
+            mei << "<note xml:id=\"n" << m << "_" << beat << "\" dur=\"4\" pname=\"" << pitches[pitch] << "\" oct=\""
+                << ((pitch < 3) ? 5 : 4) << "\"><verse n=\"1\"><syl>la" << m << "</syl></verse>"
+                << "<verse n=\"2\"><syl>lo" << beat << "</syl></verse></note>";
+        }
+        mei << "</layer></staff>";
+        for (int beat = 1; beat <= 4; ++beat) {
+            mei << "<harm staff=\"1\" tstamp=\"" << beat << "\">" << chords[(m + beat) % 7] << "</harm>";
+        }
+        mei << "<dynam staff=\"1\" tstamp=\"1\">" << dynamics[m % 4] << "</dynam>"
+            << "<dir staff=\"1\" tstamp=\"3\" place=\"above\">rit. " << m << "</dir>"
+            << "<hairpin staff=\"1\" tstamp=\"2\" tstamp2=\"1m+1\" form=\"" << ((m % 2) ? "cres" : "dim") << "\"/>"
+            << "<slur staff=\"1\" startid=\"#n" << m << "_1\" endid=\"#n" << m << "_4\" curvedir=\"above\"/>";
+        if (m % 8 == 0) mei << "<fermata staff=\"1\" startid=\"#n" << m << "_4\"/>";
+        mei << "</measure>" << std::endl;
+    }
+    mei << "</section></score></mdiv></body></music></mei>" << std::endl;
+    return mei.str();
+}
+
+// The read calls and the bytes read by the process so far (Linux only)
+struct ReadCount {
+    long m_calls = 0;
+    long m_bytes = 0;
+};
+
+ReadCount GetReadCount()
+{
+    ReadCount count;
+    std::ifstream io("/proc/self/io");
+    std::string key;
+    long value;
+    while (io >> key >> value) {
+        if (key == "syscr:") {
+            count.m_calls = value;
+        }
+        else if (key == "rchar:") {
+            count.m_bytes = value;
+        }
+    }
+    return count;
+}
+
+// Time a step and count the file reads it does, without the ones of reading the counts
+class ReadTimer {
+public:
+    ReadTimer() : m_start(GetReadCount()), m_time(std::chrono::steady_clock::now())
+    {
+        const ReadCount again = GetReadCount();
+        m_overhead.m_calls = again.m_calls - m_start.m_calls;
+        m_overhead.m_bytes = again.m_bytes - m_start.m_bytes;
+        m_start = GetReadCount();
+    }
+
+    // Print the time and the reads since the previous step
+    void EndStep(const std::string &name)
+    {
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_time;
+        const ReadCount count = GetReadCount();
+        std::cout << (m_first ? " " : ", ") << name << " " << elapsed.count() << " ms ("
+                  << count.m_calls - m_start.m_calls - m_overhead.m_calls << " reads, "
+                  << count.m_bytes - m_start.m_bytes - m_overhead.m_bytes << " bytes)";
+        m_first = false;
+        m_start = GetReadCount();
+        m_time = std::chrono::steady_clock::now();
+    }
+
+private:
+    bool m_first = true;
+    ReadCount m_start;
+    ReadCount m_overhead;
+    std::chrono::steady_clock::time_point m_time;
+};
+
+// Render all the pages of each file in SVG, reporting the time and the file reads of the load, of the first rendering
+// (parsing the glyphs used, once for the process), and of a second one with the parsed glyphs; then parse the glyphs
+// and the woff font of each page as it was done for each SVG before; and render the pages with svgSharedDefs, with the
+// size of the output with and without it
+int GlyphIO(const std::vector<std::string> &files)
+{
+    vrv::Resources resources;
+    resources.SetPath(s_resourcePath);
+    resources.InitFonts();
+    const std::regex symbol("<symbol id=\"([0-9A-F]{4})\"");
+
+    for (auto &file : files) {
+        const std::string data = ReadFile(file);
+        std::cout << file << ":";
+        ReadTimer timer;
+        vrv::Toolkit toolkit(false);
+        toolkit.SetResourcePath(s_resourcePath);
+        toolkit.SetOutputTo("svg");
+        if (!toolkit.LoadData(data)) {
+            std::cout << " could not be loaded" << std::endl;
+            continue;
+        }
+        timer.EndStep("load");
+        std::vector<std::string> svgs;
+        for (int i = 1; i <= toolkit.GetPageCount(); ++i) svgs.push_back(toolkit.RenderToSVG(i));
+        timer.EndStep("render " + std::to_string(svgs.size()) + " pages");
+        for (int i = 1; i <= toolkit.GetPageCount(); ++i) toolkit.RenderToSVG(i);
+        timer.EndStep("render again");
+
+        int parsed = 0;
+        for (auto &svg : svgs) {
+            for (auto iter = std::sregex_iterator(svg.begin(), svg.end(), symbol); iter != std::sregex_iterator();
+                 ++iter) {
+                const vrv::Glyph *glyph = resources.GetGlyph((wchar_t)std::stoi((*iter)[1], NULL, 16));
+                if (!glyph) continue;
+                pugi::xml_document xmlDocument;
+                size_t length = 0;
+                const char *xml = glyph->GetXML(length);
+                if (xml) {
+                    xmlDocument.load_buffer(xml, length);
+                }
+                else {
+                    xmlDocument.load_file(glyph->GetPath().c_str());
+                }
+                ++parsed;
+            }
+            if (svg.find("@font-face") != std::string::npos) {
+                pugi::xml_document woff;
+                woff.load_file((resources.GetPath() + "/woff.xml").c_str());
+                ++parsed;
+            }
+        }
+        timer.EndStep("parse " + std::to_string(parsed) + " defs by page");
+
+        size_t size = 0;
+        for (auto &svg : svgs) size += svg.size();
+        toolkit.SetOptions("{\"svgSharedDefs\": true}");
+        size_t sharedSize = 0;
+        for (int i = 1; i <= toolkit.GetPageCount(); ++i) sharedSize += toolkit.RenderToSVG(i).size();
+        timer.EndStep("render with shared defs");
+        std::cout << ", svg " << size << " bytes, " << sharedSize << " bytes with shared defs" << std::endl;
+    }
+    return 0;
+}
+
+// Load an MEI file, edit the measure in the middle of it as the editor does and cast it off again, incrementally or fully,
+// returning the SVG of all the pages without the generated ids
+std::vector<std::string> RenderEditedPages(const std::string &data, bool incremental)
+{
+    // The same uuids for both cast offs
+    vrv::Object::SeedUuid(1);
+    vrv::Doc doc;
+    LoadPreparedDoc(doc, data);
+    doc.CastOffDoc();
+
+    std::vector<std::string> pages;
+    vrv::ClassIdComparison matchNote(vrv::NOTE);
+    vrv::ArrayOfObjects objects;
+    doc.FindAllDescendantByComparison(&objects, &matchNote);
+    if (objects.empty()) return pages;
+    vrv::Measure *measure = vrv_cast<vrv::Measure *>(objects.at(objects.size() / 2)->GetFirstAncestor(vrv::MEASURE));
+
+    // Make all the notes, rests and chords of the measure breves, so it is much wider
+    vrv::InterfaceComparison matchDuration(vrv::INTERFACE_DURATION);
+    objects.clear();
+    measure->FindAllDescendantByComparison(&objects, &matchDuration);
+    for (auto &object : objects) object->GetDurationInterface()->SetDur(vrv::DURATION_breve);
+    measure->SetEdited(true);
+    doc.PrepareDrawing();
+
+    if (incremental) {
+        doc.CastOffDocIncremental();
+    }
+    else {
+        doc.UnCastOffDoc();
+        doc.CastOffDoc();
+    }
+
+    static const std::regex uuid("-[0-9]{8,}\"");
+    vrv::View view;
+    view.SetDoc(&doc);
+    for (int i = 0; i < doc.GetPageCount(); ++i) {
+        view.SetPage(i);
+        vrv::SvgDeviceContext svg;
+        svg.SetWidth(doc.GetAdjustedDrawingPageWidth());
+        svg.SetHeight(doc.GetAdjustedDrawingPageHeight());
+        view.DrawCurrentPage(&svg, false);
+        pages.push_back(std::regex_replace(svg.GetStringSVG(), uuid, "\""));
+    }
+    return pages;
+}
+
+// Check that the incremental cast off after editing a measure gives the same page breaks and the same SVG as a full one
+int IncrementalCastOff(const std::vector<std::string> &files)
+{
+    int failed = 0;
+    for (auto &file : files) {
+        const std::string data = ReadFile(file);
+        const std::vector<std::string> pages = RenderEditedPages(data, true);
+        const std::vector<std::string> expected = RenderEditedPages(data, false);
+        if (expected.empty()) {
+            std::cout << file << ": no note to edit" << std::endl;
+            ++failed;
+        }
+        else if (pages.size() != expected.size()) {
+            std::cout << file << ": " << pages.size() << " pages instead of " << expected.size() << std::endl;
+            ++failed;
+        }
+        else {
+            auto differs = std::mismatch(pages.begin(), pages.end(), expected.begin());
+            if (differs.first != pages.end()) {
+                std::cout << file << ": page " << (differs.first - pages.begin()) + 1 << " differs" << std::endl;
+                ++failed;
+            }
+            else {
+                std::cout << file << ": ok (" << pages.size() << " pages)" << std::endl;
+            }
+        }
+    }
+    return (failed > 0) ? 1 : 0;
+}
+
+#ifdef __GLIBC__
+struct ClassMemory {
+    int m_count = 0;
+    size_t m_bytes = 0;
+};
+
+void CountObjects(vrv::Object *object, std::map<std::string, ClassMemory> &classes)
+{
+    ClassMemory &memory = classes[object->GetClassName()];
+    memory.m_count++;
+    memory.m_bytes += malloc_usable_size(object);
+    for (auto child : *object->GetChildren()) CountObjects(child, classes);
+}
+
+// The size of the objects is the one of their allocation, the heap is everything allocated for loading the file
+int ObjectMemory(const std::string &data)
+{
+    const size_t heapStart = mallinfo2().uordblks;
+    vrv::Doc *doc = new vrv::Doc();
+    vrv::MEIInput input(doc);
+    input.Import(data);
+    const size_t heap = mallinfo2().uordblks - heapStart;
+
+    std::map<std::string, ClassMemory> classes;
+    CountObjects(doc, classes);
+    std::vector<std::pair<std::string, ClassMemory>> sorted(classes.begin(), classes.end());
+    std::sort(sorted.begin(), sorted.end(),
+        [](const auto &a, const auto &b) { return a.second.m_bytes > b.second.m_bytes; });
+
+    int count = 0;
+    size_t bytes = 0;
+    std::cout << std::left << std::setw(24) << "Class" << std::right << std::setw(10) << "Objects" << std::setw(14)
+              << "Bytes" << std::setw(10) << "Average" << std::endl;
+    for (auto &entry : sorted) {
+        std::cout << std::left << std::setw(24) << entry.first << std::right << std::setw(10) << entry.second.m_count
+                  << std::setw(14) << entry.second.m_bytes << std::setw(10)
+                  << entry.second.m_bytes / entry.second.m_count << std::endl;
+        count += entry.second.m_count;
+        bytes += entry.second.m_bytes;
+    }
+    std::cout << std::left << std::setw(24) << "Total" << std::right << std::setw(10) << count << std::setw(14)
+              << bytes << std::endl;
+    std::cout << "Heap: " << heap << " bytes (" << heap / count << " per object)" << std::endl;
+
+    delete doc;
+    return 0;
+}
+#endif
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        DisplayUsage();
+        return 1;
+    }
+
+    if (!strcmp(argv[1], "object-memory")) {
+#ifdef __GLIBC__
+        vrv::DisableLog();
+        const std::string data = ReadFile(argv[2]);
+        if (data.empty()) {
+            std::cerr << "The file '" << argv[2] << "' could not be read." << std::endl;
+            return 1;
+        }
+        return ObjectMemory(data);
+#else
+        std::cerr << "The object memory report is available only with glibc." << std::endl;
+        return 1;
+#endif
+    }
+
+    if (!strcmp(argv[1], "glyph-io")) {
+        int first = 2;
+        if ((argc > first + 2) && !strcmp(argv[first], "-r")) {
+            s_resourcePath = argv[first + 1];
+            first += 2;
+        }
+        vrv::DisableLog();
+        std::cout << std::fixed << std::setprecision(1);
+        return GlyphIO(std::vector<std::string>(argv + first, argv + argc));
+    }
+
+    if (!strcmp(argv[1], "lead-sheet")) {
+        std::cout << GenerateLeadSheet(std::max(1, atoi(argv[2])));
+        return 0;
+    }
+
+    if (!strcmp(argv[1], "parallel-toolkits")) {
+        // At least four threads even on fewer cores since this is a test of the toolkits running concurrently
+        int threads = std::max(4, (int)std::thread::hardware_concurrency());
+        int first = 2;
+        while ((argc > first + 2) && (argv[first][0] == '-')) {
+            if (!strcmp(argv[first], "-j")) {
+                threads = std::max(1, atoi(argv[first + 1]));
+            }
+            else if (!strcmp(argv[first], "-r")) {
+                s_resourcePath = argv[first + 1];
+            }
+            else {
+                DisplayUsage();
+                return 1;
+            }
+            first += 2;
+        }
+        vrv::DisableLog();
+        std::cout << std::fixed << std::setprecision(1);
+        return ParallelToolkits(std::vector<std::string>(argv + first, argv + argc), threads);
+    }
+
+    if (!strcmp(argv[1], "incremental-cast-off")) {
+        int first = 2;
+        if ((argc > first + 2) && !strcmp(argv[first], "-r")) {
+            s_resourcePath = argv[first + 1];
+            first += 2;
+        }
+        vrv::DisableLog();
+        return IncrementalCastOff(std::vector<std::string>(argv + first, argv + argc));
+    }
+
+    auto benchmark = GetBenchmarks().find(argv[1]);
+    if (benchmark == GetBenchmarks().end()) {
+        std::cerr << "Unknown benchmark '" << argv[1] << "'." << std::endl;
+        DisplayUsage();
+        return 1;
+    }
+
+    int first = 2;
+    int runs = 5;
+    while ((argc > first + 2) && (argv[first][0] == '-')) {
+        if (!strcmp(argv[first], "-n")) {
+            runs = std::max(1, atoi(argv[first + 1]));
+        }
+        else if (!strcmp(argv[first], "-r")) {
+            s_resourcePath = argv[first + 1];
+        }
+        else {
+            DisplayUsage();
+            return 1;
+        }
+        first += 2;
+    }
+
+    // Keep the output for the timings
+    vrv::DisableLog();
+
+    Phases total;
+    std::cout << std::fixed << std::setprecision(1);
+    for (int i = first; i < argc; ++i) {
+        const std::string data = ReadFile(argv[i]);
+        if (data.empty()) {
+            std::cerr << "The file '" << argv[i] << "' could not be read." << std::endl;
+            return 1;
+        }
+        const Phases best = TimeBest(benchmark->second, data, runs);
+        if (total.empty()) {
+            for (auto &phase : best) total.push_back({ phase.first, 0.0 });
+        }
+        for (size_t j = 0; j < best.size(); ++j) total.at(j).second += best.at(j).second;
+        PrintPhases(argv[i], best);
+    }
+    PrintPhases("Total", total);
+
+    return 0;
+}
@@ -22,17 +22,19 @@ extern "C" {
 void *vrvToolkit_constructor()
 {
     // set the default resource path
-    Resources::SetPath("/data");
+    Toolkit *tk = new Toolkit(false);
+    tk->SetResourcePath("/data");
 
-    return new Toolkit();
+    return tk;
 }
 
 void *vrvToolkit_constructorResourcePath(const char* resourcePath)
 {
     // set the resource path
-    Resources::SetPath(resourcePath);
+    Toolkit *tk = new Toolkit(false);
+    tk->SetResourcePath(resourcePath);
 
-    return new Toolkit();
+    return tk;
 }
 
 void vrvToolkit_destructor(Toolkit *tk)
@@ -74,6 +76,12 @@ const char *vrvToolkit_getElementsAtTime(Toolkit *tk, int millisec)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementsAtTimes(Toolkit *tk, int startMillisec, int endMillisec, int stepMillisec)
+{
+    tk->SetCString(tk->GetElementsAtTimes(startMillisec, endMillisec, stepMillisec));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId)
 {
     tk->SetCString(tk->GetExpansionIdsForElement(xmlId));
@@ -126,6 +134,12 @@ int vrvToolkit_getPageWithElement(Toolkit *tk, const char *xmlId)
     return tk->GetPageWithElement(xmlId);
 }
 
+const char *vrvToolkit_getProfile(Toolkit *tk)
+{
+    tk->SetCString(tk->GetProfile());
+    return tk->GetCString();
+}
+
 double vrvToolkit_getTimeForElement(Toolkit *tk, const char *xmlId)
 {
     return tk->GetTimeForElement(xmlId);
@@ -169,11 +183,21 @@ void vrvToolkit_redoLayout(Toolkit *tk)
     tk->RedoLayout();
 }
 
+void vrvToolkit_redoLayoutIncremental(Toolkit *tk)
+{
+    tk->RedoLayout(true);
+}
+
 void vrvToolkit_redoPagePitchPosLayout(Toolkit *tk)
 {
     tk->RedoPagePitchPosLayout();
 }
 
+void vrvToolkit_resetProfile(Toolkit *tk)
+{
+    tk->ResetProfile();
+}
+
 const char *vrvToolkit_renderData(Toolkit *tk, const char *data, const char *options)
 {
     tk->ResetLogBuffer();
@@ -16,6 +16,7 @@ bool vrvToolkit_edit(Toolkit *tk, const char *editorAction);
 const char *vrvToolkit_getAvailableOptions(Toolkit *tk);
 const char *vrvToolkit_getElementAttr(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getElementsAtTime(Toolkit *tk, int millisec);
+const char *vrvToolkit_getElementsAtTimes(Toolkit *tk, int startMillisec, int endMillisec, int stepMillisec);
 const char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getHumdrum(Toolkit *tk);
 const char *vrvToolkit_getLog(Toolkit *tk);
@@ -25,6 +26,7 @@ const char *vrvToolkit_getNotatedIdForElement(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getOptions(Toolkit *tk, bool default_values);
 int vrvToolkit_getPageCount(Toolkit *tk);
 int vrvToolkit_getPageWithElement(Toolkit *tk, const char *xmlId);
+const char *vrvToolkit_getProfile(Toolkit *tk);
 double vrvToolkit_getTimeForElement(Toolkit *tk, const char *xmlId);
 const char *vrvToolkit_getVersion(Toolkit *tk);
 bool vrvToolkit_loadData(Toolkit *tk, const char *data);
@@ -32,6 +34,8 @@ const char *vrvToolkit_renderToMIDI(Toolkit *tk, const char *c_options);
 const char *vrvToolkit_renderToSVG(Toolkit *tk, int page_no, const char *c_options);
 const char *vrvToolkit_renderToTimemap(Toolkit *tk);
 void vrvToolkit_redoLayout(Toolkit *tk);
+void vrvToolkit_redoLayoutIncremental(Toolkit *tk);
 void vrvToolkit_redoPagePitchPosLayout(Toolkit *tk);
+void vrvToolkit_resetProfile(Toolkit *tk);
 const char *vrvToolkit_renderData(Toolkit *tk, const char *data, const char *options);
 void vrvToolkit_setOptions(Toolkit *tk, const char *options);
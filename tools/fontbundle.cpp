@@ -0,0 +1,38 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        fontbundle.cpp
+// Author:      Verovio contributors
+// Created:     2026
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <string>
+
+//----------------------------------------------------------------------------
+
+#include "vrv.h"
+
+// Generate the binary font bundles (<font>.bin) from the XML files of the resource directory
+// Usage: fontbundle <resource-path> <font> [<font> ...]
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        std::cerr << "Usage: fontbundle <resource-path> <font> [<font> ...]" << std::endl;
+        return 1;
+    }
+
+    std::string path = argv[1];
+    int failed = 0;
+    for (int i = 2; i < argc; ++i) {
+        if (!vrv::Resources::WriteFontBundle(path, argv[i])) {
+            std::cerr << "The bundle for the font '" << argv[i] << "' could not be written." << std::endl;
+            ++failed;
+        }
+        else {
+            std::cerr << "Bundle written to " << path << "/" << argv[i] << ".bin." << std::endl;
+        }
+    }
+
+    return (failed > 0) ? 1 : 0;
+}
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Post-process the code generated by libmei for Verovio.
+
+The libmei parser produces string-to-value converters that take a std::string by value and test it with a chain of
+comparisons, and attribute readers that look up and remove each attribute by name. This script rewrites them:
+
+  * AttConverter::StrTo* take a std::string_view and dispatch on the length of the value first;
+  * Att*::Read* fetch each attribute handle once and only remove it from the node when asked to (removeAttr);
+  * the destructors of the Att* classes are not virtual, which avoids a vtable pointer per att class in the objects
+    (they are never deleted through a pointer to an att class).
+
+It is to be run on the ./libmei directory each time the code is regenerated. It is idempotent.
+
+    python3 tools/libmei_postprocess.py libmei
+"""
+
+import glob
+import os
+import re
+import sys
+from collections import OrderedDict
+
+COLUMN_LIMIT = 120
+
+# StrTo declarations and definitions in attconverter.h / .cpp
+DECL_RE = re.compile(r"^(    \w+ StrTo\w+\()std::string value(, bool logWarning = true\) const;)$", re.M)
+DEF_RE = re.compile(
+    r"^(?P<ret>\w+) (?P<name>AttConverter::StrTo\w+)\(std::string value, bool logWarning\) const\n"
+    r"\{\n(?P<tests>(?:    if \(value == \"[^\"]*\"\) return \w+;\n)+)"
+    r"    if \(logWarning && !value\.empty\(\)\)\n"
+    r"        LogWarning\((?P<msg>\"[^\"]*\"), value\.c_str\(\)\);\n"
+    r"    return (?P<none>\w+);\n\}\n",
+    re.M,
+)
+TEST_RE = re.compile(r"    if \(value == \"(?P<str>[^\"]*)\"\) return (?P<val>\w+);\n")
+
+# Read declarations and definitions in atts_*.h / .cpp
+DESTRUCTOR_DECL_RE = re.compile(r"^    virtual (~Att\w+\(\);)$", re.M)
+READ_DECL_RE = re.compile(r"^(    bool Read\w+\(pugi::xml_node element)\);$", re.M)
+READ_DEF_RE = re.compile(r"^(bool Att\w+::Read\w+\(pugi::xml_node element)\)$", re.M)
+READ_ATTR_RE = re.compile(
+    r"^    if \(element\.attribute\(\"(?P<attr>[^\"]+)\"\)\) \{\n"
+    r"        this->(?P<setter>Set\w+)\((?P<conv>\w+)\(element\.attribute\(\"(?P=attr)\"\)\.value\(\)\)\);\n"
+    r"        element\.remove_attribute\(\"(?P=attr)\"\);\n",
+    re.M,
+)
+
+
+def convert_definition(match):
+    tests = OrderedDict()
+    for test in TEST_RE.finditer(match.group("tests")):
+        tests.setdefault(len(test.group("str")), []).append(test)
+    signature = "{} {}(std::string_view value, bool logWarning) const".format(match.group("ret"), match.group("name"))
+    if len(signature) > COLUMN_LIMIT:
+        signature = "{} {}(\n    std::string_view value, bool logWarning) const".format(
+            match.group("ret"), match.group("name"))
+    lines = [signature, "{", "    switch (value.size()) {"]
+    for length in sorted(tests):
+        lines.append("        case {}:".format(length))
+        for test in tests[length]:
+            lines.append('            if (value == "{}") return {};'.format(test.group("str"), test.group("val")))
+        lines.append("            break;")
+    lines.append("        default: break;")
+    lines.append("    }")
+    lines.append("    if (logWarning && !value.empty())")
+    lines.append("        LogWarning({}, std::string(value).c_str());".format(match.group("msg")))
+    lines.append("    return {};".format(match.group("none")))
+    lines.append("}")
+    return "\n".join(lines) + "\n"
+
+
+def convert_read(match):
+    return (
+        "    if (pugi::xml_attribute attribute = element.attribute(\"{attr}\")) {{\n"
+        "        this->{setter}({conv}(attribute.value()));\n"
+        "        if (removeAttr) element.remove_attribute(attribute);\n"
+    ).format(**match.groupdict())
+
+
+def rewrite(path, conversions):
+    with open(path) as f:
+        content = f.read()
+    updated = content
+    for regex, replacement in conversions:
+        updated = regex.sub(replacement, updated)
+    if updated != content:
+        with open(path, "w") as f:
+            f.write(updated)
+        print("Updated {}".format(path))
+
+
+def main(libmei_dir):
+    rewrite(
+        os.path.join(libmei_dir, "attconverter.h"),
+        [
+            (DECL_RE, r"\1std::string_view value\2"),
+            (re.compile(r"^#include <string>\n(?!#include <string_view>)", re.M),
+                "#include <string>\n#include <string_view>\n"),
+        ],
+    )
+    rewrite(os.path.join(libmei_dir, "attconverter.cpp"), [(DEF_RE, convert_definition)])
+    for path in sorted(glob.glob(os.path.join(libmei_dir, "atts_*.h"))):
+        rewrite(path, [(READ_DECL_RE, r"\1, bool removeAttr = true);"), (DESTRUCTOR_DECL_RE, r"    \1")])
+    for path in sorted(glob.glob(os.path.join(libmei_dir, "atts_*.cpp"))):
+        rewrite(path, [(READ_DEF_RE, r"\1, bool removeAttr)"), (READ_ATTR_RE, convert_read)])
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.exit("Usage: {} <libmei directory>".format(sys.argv[0]))
+    main(sys.argv[1])
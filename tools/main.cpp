@@ -5,21 +5,32 @@
 // Copyright (c) Authors and others. All rights reserved.
 /////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
+#include <thread>
+#include <vector>
 
 #ifndef _WIN32
+#include <dirent.h>
 #include <getopt.h>
 #else
+#include "win_dirent.h"
 #include "win_getopt.h"
 #endif
 
 //----------------------------------------------------------------------------
 
+#include "jsonxx.h"
 #include "options.h"
 #include "toolkit.h"
 #include "vrv.h"
@@ -82,6 +93,16 @@ bool dir_exists(std::string dir)
     }
 }
 
+bool file_readable(const std::string &filename)
+{
+    struct stat st;
+    if ((stat(filename.c_str(), &st) != 0) || (((st.st_mode) & S_IFMT) != S_IFREG)) {
+        return false;
+    }
+    std::ifstream in(filename.c_str());
+    return in.is_open();
+}
+
 void display_version()
 {
     std::cout << "Verovio " << vrv::GetVersion() << std::endl;
@@ -109,13 +130,19 @@ void display_usage()
     std::cout << " -?, --help            Display this message" << std::endl;
     std::cout << " -a, --all-pages       Output all pages" << std::endl;
     std::cout << " -f, --format <s>      Select input format: abc, darms, mei, pae, xml (default is mei)" << std::endl;
+    std::cout << " -j, --jobs <i>        Number of threads for --batch (default is the number of cores) or -a to SVG"
+              << std::endl;
     std::cout << " -o, --outfile <s>     Output file name (use \"-\" for standard output)" << std::endl;
     std::cout << " -p, --page <i>        Select the page to engrave (default is 1)" << std::endl;
-    std::cout << " -r, --resources <s>   Path to SVG resources (default is " << vrv::Resources::GetPath() << ")" << std::endl;
+    std::cout << " -r, --resources <s>   Path to SVG resources (default is " << vrv::Resources::GetDefaultPath() << ")" << std::endl;
     std::cout << " -s, --scale <i>       Scale percent (default is " << DEFAULT_SCALE << ")" << std::endl;
     std::cout << " -t, --type <s>        Select output format: mei, svg, or midi (default is svg)" << std::endl;
     std::cout << " -v, --version         Display the version number" << std::endl;
     std::cout << " -x, --xml-id-seed <i> Seed the random number generator for XML IDs" << std::endl;
+    std::cout << " --batch <s>           Convert the files of a directory or listed in a file into the -o directory"
+              << std::endl;
+    std::cout << " --batch-summary <s>   Output file for the JSON summary of --batch (default is standard output)"
+              << std::endl;
 
     vrv::Options options;
     std::vector<vrv::OptionGrp *> *grp = options.GetGrps();
@@ -186,22 +213,430 @@ void display_usage()
     }
 }
 
+/**
+ * The output settings shared by all the files converted in one run.
+ */
+struct OutputSettings {
+    std::string outformat = "svg";
+    int page = 1;
+    bool all_pages = false;
+    bool std_output = false;
+    // The number of worker threads (for the batch mode and for rendering all pages)
+    int jobs = 1;
+    // The seed for the XML IDs (0 for none)
+    unsigned int seed = 0;
+};
+
+/**
+ * Set up a worker toolkit with the resources and the options of the main toolkit.
+ * This has to be called from the main thread before the worker is started.
+ */
+bool init_worker(vrv::Toolkit &worker, vrv::Toolkit &toolkit, const OutputSettings &settings)
+{
+    if (!worker.SetResourcePath(toolkit.GetResourcePath())) return false;
+    *worker.GetOptions() = *toolkit.GetOptions();
+    if (!worker.SetFont(worker.GetOptions()->m_font.GetValue())) return false;
+    worker.SetScale(toolkit.GetScale());
+    worker.SetInputFrom((vrv::FileFormat)toolkit.GetInputFrom());
+    worker.SetOutputTo(settings.outformat);
+    return true;
+}
+
+/**
+ * Render the pages [from;to[ of a loaded file to SVG files with settings.jobs threads.
+ * The main toolkit renders its share of the pages while the other workers load the file again.
+ * Since the layout is deterministic, the pages are the same in all the workers.
+ */
+bool write_svg_pages_parallel(vrv::Toolkit &toolkit, const std::string &infile, const std::string &outfile, int from,
+    int to, const OutputSettings &settings, std::vector<std::string> &outputs, std::string &error)
+{
+    const int jobs = std::min(settings.jobs, to - from);
+    const int pageCount = toolkit.GetPageCount();
+
+    std::vector<std::unique_ptr<vrv::Toolkit>> workers;
+    for (int i = 1; i < jobs; ++i) {
+        workers.push_back(std::unique_ptr<vrv::Toolkit>(new vrv::Toolkit(false)));
+        if (!init_worker(*workers.back(), toolkit, settings)) {
+            error = "The resources of the worker could not be initialized.";
+            return false;
+        }
+    }
+
+    std::vector<std::string> filenames(to - from);
+    std::vector<std::string> errors(to - from);
+    for (int p = from; p < to; ++p) {
+        filenames.at(p - from) = outfile + vrv::StringFormat("_%03d", p) + ".svg";
+    }
+
+    // Each worker renders every jobs-th page starting at from + first
+    auto render = [&](vrv::Toolkit &worker, int first) {
+        for (int p = from + first; p < to; p += jobs) {
+            if (!worker.RenderToSVGFile(filenames.at(p - from), p)) {
+                errors.at(p - from) = "Unable to write SVG to " + filenames.at(p - from) + ".";
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < jobs; ++i) {
+        threads.push_back(std::thread([&, i]() {
+            vrv::Toolkit &worker = *workers.at(i - 1);
+            if (settings.seed) vrv::Object::SeedUuid(settings.seed);
+            if (!worker.LoadFile(infile) || (worker.GetPageCount() != pageCount)) {
+                for (int p = from + i; p < to; p += jobs) {
+                    errors.at(p - from) = "The file '" + infile + "' could not be reloaded by a worker.";
+                }
+                return;
+            }
+            render(worker, i);
+        }));
+    }
+    render(toolkit, 0);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (int p = from; p < to; ++p) {
+        if (!errors.at(p - from).empty()) {
+            error = errors.at(p - from);
+            return false;
+        }
+        outputs.push_back(filenames.at(p - from));
+    }
+    return true;
+}
+
+/**
+ * Write the output of a loaded file in the format given by the settings.
+ * The files written are added to outputs. Returns false and sets error if something went wrong.
+ */
+bool write_output(vrv::Toolkit &toolkit, const std::string &infile, std::string outfile,
+    const OutputSettings &settings, std::vector<std::string> &outputs, std::string &error)
+{
+    const std::string &outformat = settings.outformat;
+    const int page = settings.page;
+
+    // The MIDI and the timemap are not page-based and are written without the layout
+    const bool pageBased = (toolkit.GetOutputTo() != vrv::MIDI) && (toolkit.GetOutputTo() != vrv::TIMEMAP);
+
+    if ((toolkit.GetOutputTo() != vrv::HUMDRUM) && pageBased) {
+        // Check the page range
+        if (page > toolkit.GetPageCount()) {
+            error = vrv::StringFormat("The page requested (%d) is not in the page range (max is %d).", page,
+                toolkit.GetPageCount());
+            return false;
+        }
+        if (page < 1) {
+            error = "The page number has to be greater than 0.";
+            return false;
+        }
+    }
+
+    int from = page;
+    int to = page + 1;
+    if (settings.all_pages && pageBased) {
+        to = toolkit.GetPageCount() + 1;
+    }
+
+    if (outformat == "svg") {
+        if (settings.all_pages && !settings.std_output && (settings.jobs > 1) && (to - from > 1)) {
+            return write_svg_pages_parallel(toolkit, infile, outfile, from, to, settings, outputs, error);
+        }
+        int p;
+        for (p = from; p < to; ++p) {
+            std::string cur_outfile = outfile;
+            if (settings.all_pages) {
+                cur_outfile += vrv::StringFormat("_%03d", p);
+            }
+            cur_outfile += ".svg";
+            if (settings.std_output) {
+                std::cout << toolkit.RenderToSVG(p);
+            }
+            else if (!toolkit.RenderToSVGFile(cur_outfile, p)) {
+                error = "Unable to write SVG to " + cur_outfile + ".";
+                return false;
+            }
+            else {
+                outputs.push_back(cur_outfile);
+            }
+        }
+    }
+    else if (outformat == "midi") {
+        outfile += ".mid";
+        if (settings.std_output) {
+            error = "Midi cannot write to standard output.";
+            return false;
+        }
+        else if (!toolkit.RenderToMIDIFile(outfile)) {
+            error = "Unable to write MIDI to " + outfile + ".";
+            return false;
+        }
+        else {
+            outputs.push_back(outfile);
+        }
+    }
+    else if (outformat == "timemap") {
+        outfile += ".json";
+        if (settings.std_output) {
+            std::cout << toolkit.RenderToTimemap();
+        }
+        else if (!toolkit.RenderToTimemapFile(outfile)) {
+            error = "Unable to write MIDI to " + outfile + ".";
+            return false;
+        }
+        else {
+            outputs.push_back(outfile);
+        }
+    }
+    else if (outformat == "humdrum" || outformat == "hum") {
+        outfile += ".krn";
+        if (settings.std_output) {
+            toolkit.GetHumdrum(std::cout);
+        }
+        else {
+            if (!toolkit.GetHumdrumFile(outfile)) {
+                error = "Unable to write Humdrum to " + outfile + ".";
+                return false;
+            }
+            else {
+                outputs.push_back(outfile);
+            }
+        }
+    }
+    else if (outformat == "pae") {
+        outfile += ".pae";
+        if (settings.std_output) {
+            std::cout << toolkit.RenderToPAE();
+        }
+        else if (!toolkit.RenderToPAEFile(outfile)) {
+            error = "Unable to write PAE to " + outfile + ".";
+            return false;
+        }
+        else {
+            outputs.push_back(outfile);
+        }
+    }
+    else {
+        if (settings.all_pages) {
+            toolkit.SetScoreBasedMei(true);
+            outfile += ".mei";
+            if (settings.std_output) {
+                error = "MEI output of all pages to standard output is not possible.";
+                return false;
+            }
+            else if (!toolkit.SaveFile(outfile)) {
+                error = "Unable to write MEI to " + outfile + ".";
+                return false;
+            }
+            else {
+                outputs.push_back(outfile);
+            }
+        }
+        else {
+            if (settings.std_output) {
+                std::cout << toolkit.GetMEI(page);
+            }
+            else {
+                error = "MEI output of one page is available only to standard output.";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Get the list of files for the batch mode.
+ * The input is either a directory (all its files, not recursively) or a text file with one path per line.
+ */
+bool get_batch_files(const std::string &batch, std::vector<std::string> &files)
+{
+    if (dir_exists(batch)) {
+        ::DIR *dir = opendir(batch.c_str());
+        if (!dir) return false;
+        dirent *pdir;
+        while ((pdir = readdir(dir))) {
+            std::string filename = batch + "/" + pdir->d_name;
+            struct stat st;
+            // Skip hidden files and sub-directories
+            if ((pdir->d_name[0] == '.') || (stat(filename.c_str(), &st) != 0) || (((st.st_mode) & S_IFMT) != S_IFREG))
+                continue;
+            files.push_back(filename);
+        }
+        closedir(dir);
+        std::sort(files.begin(), files.end());
+        return true;
+    }
+
+    std::ifstream list(batch.c_str());
+    if (!list.is_open()) return false;
+    for (std::string line; getline(list, line);) {
+        // Skip empty lines and comments
+        if (!line.empty() && (line.back() == '\r')) line.pop_back();
+        if (line.empty() || (line[0] == '#')) continue;
+        files.push_back(line);
+    }
+    return true;
+}
+
+/**
+ * Convert all the files of the batch with a pool of settings.jobs workers, each with its own toolkit.
+ * A JSON summary with the timing and the errors for each file is written to summary (or to the standard output).
+ * Returns the number of files that failed.
+ */
+int run_batch(vrv::Toolkit &toolkit, const std::vector<std::string> &files, const std::string &outdir,
+    const std::string &summary, const OutputSettings &settings)
+{
+    struct BatchResult {
+        bool success = false;
+        std::string error;
+        std::vector<std::string> outputs;
+        int pages = 0;
+        double loadTime = 0.0;
+        double renderTime = 0.0;
+    };
+
+    typedef std::chrono::steady_clock Clock;
+    auto elapsed = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+
+    // The output file names without the extension, which have to be unique since the files are written in parallel
+    std::vector<std::string> outfiles;
+    std::map<std::string, std::string> outfileInputs;
+    for (auto const &infile : files) {
+        outfiles.push_back(removeExtension(outdir.empty() ? infile : outdir + "/" + basename(infile)));
+        auto inserted = outfileInputs.insert({ outfiles.back(), infile });
+        if (!inserted.second) {
+            std::cerr << "The files '" << inserted.first->second << "' and '" << infile
+                      << "' would be written to the same output " << outfiles.back() << "." << std::endl;
+            exit(1);
+        }
+    }
+
+    const Clock::time_point batchStart = Clock::now();
+    const int jobs = std::max(1, std::min(settings.jobs, (int)files.size()));
+
+    // Pages are rendered sequentially within each file
+    OutputSettings fileSettings = settings;
+    fileSettings.jobs = 1;
+
+    std::vector<std::unique_ptr<vrv::Toolkit>> workers;
+    for (int i = 0; i < jobs; ++i) {
+        workers.push_back(std::unique_ptr<vrv::Toolkit>(new vrv::Toolkit(false)));
+        if (!init_worker(*workers.back(), toolkit, settings)) {
+            std::cerr << "The resources of the worker could not be initialized." << std::endl;
+            exit(1);
+        }
+    }
+
+    std::vector<BatchResult> results(files.size());
+    std::atomic<size_t> next(0);
+
+    auto work = [&](vrv::Toolkit &worker) {
+        for (size_t i = next++; i < files.size(); i = next++) {
+            const std::string &infile = files.at(i);
+            BatchResult &result = results.at(i);
+            const std::string &outfile = outfiles.at(i);
+
+            // Seed for each file for having the same IDs regardless of the worker
+            if (settings.seed) vrv::Object::SeedUuid(settings.seed);
+
+            Clock::time_point start = Clock::now();
+            if (!file_readable(infile)) {
+                result.error = "The file '" + infile + "' could not be opened.";
+                continue;
+            }
+            if (!worker.LoadFile(infile)) {
+                result.error = "The file '" + infile + "' could not be loaded.";
+                result.loadTime = elapsed(start);
+                continue;
+            }
+            result.loadTime = elapsed(start);
+            if ((worker.GetOutputTo() != vrv::MIDI) && (worker.GetOutputTo() != vrv::TIMEMAP)) {
+                result.pages = worker.GetPageCount();
+            }
+
+            start = Clock::now();
+            result.success = write_output(worker, infile, outfile, fileSettings, result.outputs, result.error);
+            result.renderTime = elapsed(start);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < jobs; ++i) {
+        threads.push_back(std::thread(work, std::ref(*workers.at(i))));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    int failed = 0;
+    jsonxx::Array fileArray;
+    for (size_t i = 0; i < files.size(); ++i) {
+        const BatchResult &result = results.at(i);
+        jsonxx::Object o;
+        o << "input" << files.at(i);
+        o << "status" << std::string(result.success ? "ok" : "error");
+        if (!result.success) {
+            o << "error" << result.error;
+            ++failed;
+        }
+        o << "pages" << result.pages;
+        o << "loadTime" << result.loadTime;
+        o << "renderTime" << result.renderTime;
+        jsonxx::Array outputArray;
+        for (auto const &output : result.outputs) {
+            outputArray << output;
+        }
+        o << "outputs" << outputArray;
+        fileArray << o;
+    }
+
+    jsonxx::Object report;
+    report << "jobs" << jobs;
+    report << "files" << (int)files.size();
+    report << "succeeded" << (int)files.size() - failed;
+    report << "failed" << failed;
+    report << "time" << elapsed(batchStart);
+    report << "results" << fileArray;
+
+    if (summary.empty() || (summary == "-")) {
+        std::cout << report.json() << std::endl;
+    }
+    else {
+        std::ofstream output(summary.c_str());
+        if (!output.is_open()) {
+            std::cerr << "Unable to write the batch summary to " << summary << "." << std::endl;
+            return (failed > 0) ? failed : 1;
+        }
+        output << report.json() << std::endl;
+        std::cerr << "Batch summary written to " << summary << "." << std::endl;
+    }
+
+    return failed;
+}
+
 int main(int argc, char **argv)
 {
     std::string infile;
     std::string svgdir;
     std::string outfile;
     std::string outformat = "svg";
+    std::string batch;
+    std::string batch_summary;
     bool std_output = false;
 
     int all_pages = 0;
     int page = 1;
+    int jobs = 0;
+    unsigned int seed = 0;
     int show_help = 0;
     int show_version = 0;
 
     // Create the toolkit instance without loading the font because
     // the resource path might be specified in the parameters
-    // The fonts will be loaded later with Resources::InitFonts()
+    // The fonts will be loaded later with Toolkit::SetResourcePath()
     vrv::Toolkit toolkit(false);
 
     if (argc < 2) {
@@ -214,6 +649,7 @@ int main(int argc, char **argv)
         = { { "all-pages", no_argument, 0, 'a' },
             { "from", required_argument, 0, 'f' },
             { "help", no_argument, 0, '?' },
+            { "jobs", required_argument, 0, 'j' },
             { "outfile", required_argument, 0, 'o' },
             { "page", required_argument, 0, 'p' },
             { "resources", required_argument, 0, 'r' },
@@ -221,6 +657,8 @@ int main(int argc, char **argv)
             { "to", required_argument, 0, 't' },
             { "version", no_argument, 0, 'v' },
             { "xml-id-seed", required_argument, 0, 'x' },
+            { "batch", required_argument, 0, 'B' },
+            { "batch-summary", required_argument, 0, 'S' },
             // deprecated - some use undocumented short options to catch them as such
             { "border", required_argument, 0, 'b' },
             { "format", required_argument, 0, 'd' },
@@ -276,7 +714,7 @@ int main(int argc, char **argv)
     int option_index = 0;
     vrv::Option *opt = NULL;
     vrv::OptionBool *optBool = NULL;
-    while ((c = getopt_long(argc, argv, "?ab:f:h:ino:p:r:s:t:w:vx:", long_options, &option_index)) != -1) {
+    while ((c = getopt_long(argc, argv, "?ab:f:h:ij:no:p:r:s:t:w:vx:", long_options, &option_index)) != -1) {
         switch (c) {
             case 0:
                 key = long_options[option_index].name;
@@ -345,16 +783,26 @@ int main(int argc, char **argv)
                 };
                 break;
 
+            case 'B': batch = std::string(optarg); break;
+
             case 'h':
                 vrv::LogWarning("Option -h is deprecated; use --page-height instead");
                 options->m_pageHeight.SetValue(optarg);
                 break;
 
+            case 'j':
+                jobs = atoi(optarg);
+                if (jobs < 1) {
+                    std::cerr << "The number of jobs has to be greater than 0." << std::endl;
+                    exit(1);
+                }
+                break;
+
             case 'o': outfile = std::string(optarg); break;
 
             case 'p': page = atoi(optarg); break;
 
-            case 'r': vrv::Resources::SetPath(optarg); break;
+            case 'r': vrv::Resources::SetDefaultPath(optarg); break;
 
             case 't':
                 outformat = std::string(optarg);
@@ -367,6 +815,8 @@ int main(int argc, char **argv)
                 }
                 break;
 
+            case 'S': batch_summary = std::string(optarg); break;
+
             case 'v': show_version = 1; break;
 
             case 'w':
@@ -374,7 +824,10 @@ int main(int argc, char **argv)
                 options->m_pageWidth.SetValue(optarg);
                 break;
 
-            case 'x': vrv::Object::SeedUuid(atoi(optarg)); break;
+            case 'x':
+                seed = atoi(optarg);
+                vrv::Object::SeedUuid(seed);
+                break;
 
             case '?':
                 display_usage();
@@ -398,7 +851,7 @@ int main(int argc, char **argv)
     if (optind <= argc - 1) {
         infile = std::string(argv[optind]);
     }
-    else {
+    else if (batch.empty()) {
         std::cerr << "Incorrect number of arguments: expected one input file but found none." << std::endl << std::endl;
         display_usage();
         exit(1);
@@ -406,21 +859,21 @@ int main(int argc, char **argv)
 
     // Make sure the user uses a valid Resource path
     // Save many headaches for empty SVGs
-    if (!dir_exists(vrv::Resources::GetPath())) {
-        std::cerr << "The resources path " << vrv::Resources::GetPath() << " could not be found; please use -r option."
-                  << std::endl;
+    if (!dir_exists(vrv::Resources::GetDefaultPath())) {
+        std::cerr << "The resources path " << vrv::Resources::GetDefaultPath()
+                  << " could not be found; please use -r option." << std::endl;
         exit(1);
     }
 
     // Load the music font from the resource directory
-    if (!vrv::Resources::InitFonts()) {
+    if (!toolkit.SetResourcePath(vrv::Resources::GetDefaultPath())) {
         std::cerr << "The music font could not be loaded; please check the contents of the resource directory."
                   << std::endl;
         exit(1);
     }
 
     // Load a specified font
-    if (!vrv::Resources::SetFont(options->m_font.GetValue())) {
+    if (!toolkit.SetFont(options->m_font.GetValue())) {
         std::cerr << "Font '" << options->m_font.GetValue() << "' could not be loaded." << std::endl;
         exit(1);
     }
@@ -430,6 +883,42 @@ int main(int argc, char **argv)
         std::cerr << "Output format (" << outformat << ") can only be 'mei', 'svg', 'midi', 'humdrum' or 'pae'." << std::endl;
         exit(1);
     }
+    // Set it also when svg is the default output format
+    toolkit.SetOutputTo(outformat);
+
+    OutputSettings settings;
+    settings.outformat = outformat;
+    settings.page = page;
+    settings.all_pages = all_pages;
+    settings.jobs = (jobs > 0) ? jobs : 1;
+    settings.seed = seed;
+
+    // Batch mode with the output directory given with -o
+    if (!batch.empty()) {
+        if (!infile.empty()) {
+            std::cerr << "No input file can be given with --batch." << std::endl;
+            exit(1);
+        }
+        if (outfile == "-") {
+            std::cerr << "The batch mode cannot write to the standard output." << std::endl;
+            exit(1);
+        }
+        if (!outfile.empty() && !dir_exists(outfile)) {
+            std::cerr << "The output directory " << outfile << " could not be found." << std::endl;
+            exit(1);
+        }
+        std::vector<std::string> files;
+        if (!get_batch_files(batch, files)) {
+            std::cerr << "The batch input '" << batch << "' could not be read." << std::endl;
+            exit(1);
+        }
+        if (jobs == 0) {
+            settings.jobs = std::max(1, (int)std::thread::hardware_concurrency());
+        }
+        int failed = run_batch(toolkit, files, outfile, batch_summary, settings);
+        free(long_options);
+        return (failed > 0) ? 1 : 0;
+    }
 
     // Make sure we provide a file name or output to std output with std input
     if ((infile == "-") && (outfile.empty())) {
@@ -461,134 +950,30 @@ int main(int argc, char **argv)
         }
     }
     else {
-        if (!toolkit.LoadFile(infile)) {
+        if (!file_readable(infile)) {
             std::cerr << "The file '" << infile << "' could not be opened." << std::endl;
             exit(1);
         }
-    }
-
-    if (toolkit.GetOutputTo() != vrv::HUMDRUM) {
-        // Check the page range
-        if (page > toolkit.GetPageCount()) {
-            std::cerr << "The page requested (" << page << ") is not in the page range (max is "
-                      << toolkit.GetPageCount() << ")." << std::endl;
-            exit(1);
-        }
-        if (page < 1) {
-            std::cerr << "The page number has to be greater than 0." << std::endl;
+        if (!toolkit.LoadFile(infile)) {
+            std::cerr << "The file '" << infile << "' could not be loaded." << std::endl;
             exit(1);
         }
     }
 
-    int from = page;
-    int to = page + 1;
-    if (all_pages) {
-        to = toolkit.GetPageCount() + 1;
-    }
+    settings.std_output = std_output;
 
-    if (outformat == "svg") {
-        int p;
-        for (p = from; p < to; ++p) {
-            std::string cur_outfile = outfile;
-            if (all_pages) {
-                cur_outfile += vrv::StringFormat("_%03d", p);
-            }
-            cur_outfile += ".svg";
-            if (std_output) {
-                std::cout << toolkit.RenderToSVG(p);
-            }
-            else if (!toolkit.RenderToSVGFile(cur_outfile, p)) {
-                std::cerr << "Unable to write SVG to " << cur_outfile << "." << std::endl;
-                exit(1);
-            }
-            else {
-                std::cerr << "Output written to " << cur_outfile << "." << std::endl;
-            }
-        }
+    std::vector<std::string> outputs;
+    std::string error;
+    bool success = write_output(toolkit, infile, outfile, settings, outputs, error);
+    for (auto const &output : outputs) {
+        std::cerr << "Output written to " << output << "." << std::endl;
     }
-
-    else if (outformat == "midi") {
-        outfile += ".mid";
-        if (std_output) {
-            std::cerr << "Midi cannot write to standard output." << std::endl;
-            exit(1);
-        }
-        else if (!toolkit.RenderToMIDIFile(outfile)) {
-            std::cerr << "Unable to write MIDI to " << outfile << "." << std::endl;
-            exit(1);
-        }
-        else {
-            std::cerr << "Output written to " << outfile << "." << std::endl;
-        }
-    }
-    else if (outformat == "timemap") {
-        outfile += ".json";
-        if (std_output) {
-            std::string output;
-            std::cout << toolkit.RenderToTimemap();
-        }
-        else if (!toolkit.RenderToTimemapFile(outfile)) {
-            std::cerr << "Unable to write MIDI to " << outfile << "." << std::endl;
-            exit(1);
-        }
-        else {
-            std::cerr << "Output written to " << outfile << "." << std::endl;
-        }
+    if (options->m_profile.GetValue()) {
+        std::cerr << toolkit.GetProfile() << std::endl;
     }
-    else if (outformat == "humdrum" || outformat == "hum") {
-        outfile += ".krn";
-        if (std_output) {
-            toolkit.GetHumdrum(std::cout);
-        }
-        else {
-            if (!toolkit.GetHumdrumFile(outfile)) {
-                std::cerr << "Unable to write Humdrum to " << outfile << "." << std::endl;
-                exit(1);
-            }
-            else {
-                std::cerr << "Output written to " << outfile << "." << std::endl;
-            }
-        }
-    }
-    else if (outformat == "pae") {
-        outfile += ".pae";
-        if (std_output) {
-            std::string output;
-            std::cout << toolkit.RenderToPAE();
-        }
-        else if (!toolkit.RenderToPAEFile(outfile)) {
-            std::cerr << "Unable to write PAE to " << outfile << "." << std::endl;
-            exit(1);
-        }
-        else {
-            std::cerr << "Output written to " << outfile << "." << std::endl;
-        }
-    }
-    else {
-        if (all_pages) {
-            toolkit.SetScoreBasedMei(true);
-            outfile += ".mei";
-            if (std_output) {
-                std::cerr << "MEI output of all pages to standard output is not possible." << std::endl;
-                exit(1);
-            }
-            else if (!toolkit.SaveFile(outfile)) {
-                std::cerr << "Unable to write MEI to " << outfile << "." << std::endl;
-                exit(1);
-            }
-            else {
-                std::cerr << "Output written to " << outfile << "." << std::endl;
-            }
-        }
-        else {
-            if (std_output) {
-                std::cout << toolkit.GetMEI(page);
-            }
-            else {
-                std::cerr << "MEI output of one page is available only to standard output." << std::endl;
-                exit(1);
-            }
-        }
+    if (!success) {
+        std::cerr << error << std::endl;
+        exit(1);
     }
 
     free(long_options);